@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/find_version"
+  "generated/rev.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/find_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
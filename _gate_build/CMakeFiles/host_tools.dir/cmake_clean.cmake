@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/host_tools"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/host_tools.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,975 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openttd.dir/generated/rev.cpp.o"
+  "CMakeFiles/openttd.dir/generated/rev.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/md5/md5.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/md5/md5.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/monocypher/monocypher.c.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/monocypher/monocypher.c.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/randombytes/randombytes.c.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/randombytes/randombytes.c.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o"
+  "CMakeFiles/openttd.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_config.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_config.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_core.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_core.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_info.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_info.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_instance.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_instance.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ai/ai_scanner.cpp.o"
+  "CMakeFiles/openttd.dir/src/ai/ai_scanner.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/aircraft_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/aircraft_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/aircraft_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/aircraft_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/airport.cpp.o"
+  "CMakeFiles/openttd.dir/src/airport.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/airport_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/airport_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/animated_tile.cpp.o"
+  "CMakeFiles/openttd.dir/src/animated_tile.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/articulated_vehicles.cpp.o"
+  "CMakeFiles/openttd.dir/src/articulated_vehicles.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/autoreplace.cpp.o"
+  "CMakeFiles/openttd.dir/src/autoreplace.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/autoreplace_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/autoreplace_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/autoreplace_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/autoreplace_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/base_consist.cpp.o"
+  "CMakeFiles/openttd.dir/src/base_consist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/blitter/null.cpp.o"
+  "CMakeFiles/openttd.dir/src/blitter/null.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/bmp.cpp.o"
+  "CMakeFiles/openttd.dir/src/bmp.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/bootstrap_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/bootstrap_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/bridge_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/bridge_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/bridge_map.cpp.o"
+  "CMakeFiles/openttd.dir/src/bridge_map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/build_vehicle_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/build_vehicle_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cargoaction.cpp.o"
+  "CMakeFiles/openttd.dir/src/cargoaction.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cargomonitor.cpp.o"
+  "CMakeFiles/openttd.dir/src/cargomonitor.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cargopacket.cpp.o"
+  "CMakeFiles/openttd.dir/src/cargopacket.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cargotype.cpp.o"
+  "CMakeFiles/openttd.dir/src/cargotype.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cheat.cpp.o"
+  "CMakeFiles/openttd.dir/src/cheat.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cheat_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/cheat_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/clear_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/clear_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/command.cpp.o"
+  "CMakeFiles/openttd.dir/src/command.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/company_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/company_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/company_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/company_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/console.cpp.o"
+  "CMakeFiles/openttd.dir/src/console.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/console_cmds.cpp.o"
+  "CMakeFiles/openttd.dir/src/console_cmds.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/console_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/console_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/alloc_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/alloc_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/bitmath_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/bitmath_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/geometry_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/geometry_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/math_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/math_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/pool_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/pool_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/random_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/random_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/core/serialisation.cpp.o"
+  "CMakeFiles/openttd.dir/src/core/serialisation.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/cpu.cpp.o"
+  "CMakeFiles/openttd.dir/src/cpu.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/crashlog.cpp.o"
+  "CMakeFiles/openttd.dir/src/crashlog.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/currency.cpp.o"
+  "CMakeFiles/openttd.dir/src/currency.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/date.cpp.o"
+  "CMakeFiles/openttd.dir/src/date.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/date_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/date_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/debug.cpp.o"
+  "CMakeFiles/openttd.dir/src/debug.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/dedicated.cpp.o"
+  "CMakeFiles/openttd.dir/src/dedicated.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/departures.cpp.o"
+  "CMakeFiles/openttd.dir/src/departures.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/departures_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/departures_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/depot.cpp.o"
+  "CMakeFiles/openttd.dir/src/depot.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/depot_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/depot_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/depot_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/depot_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/disaster_vehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/disaster_vehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/dock_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/dock_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/driver.cpp.o"
+  "CMakeFiles/openttd.dir/src/driver.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/economy.cpp.o"
+  "CMakeFiles/openttd.dir/src/economy.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/effectvehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/effectvehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/elrail.cpp.o"
+  "CMakeFiles/openttd.dir/src/elrail.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/engine.cpp.o"
+  "CMakeFiles/openttd.dir/src/engine.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/engine_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/engine_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/error_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/error_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/event_logs.cpp.o"
+  "CMakeFiles/openttd.dir/src/event_logs.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fileio.cpp.o"
+  "CMakeFiles/openttd.dir/src/fileio.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fios.cpp.o"
+  "CMakeFiles/openttd.dir/src/fios.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fios_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/fios_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fontcache.cpp.o"
+  "CMakeFiles/openttd.dir/src/fontcache.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fontcache/spritefontcache.cpp.o"
+  "CMakeFiles/openttd.dir/src/fontcache/spritefontcache.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/fontcache/truetypefontcache.cpp.o"
+  "CMakeFiles/openttd.dir/src/fontcache/truetypefontcache.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/framerate_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/framerate_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_config.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_config.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_core.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_core.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_info.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_info.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_instance.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_instance.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_scanner.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_scanner.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/game/game_text.cpp.o"
+  "CMakeFiles/openttd.dir/src/game/game_text.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/gamelog.cpp.o"
+  "CMakeFiles/openttd.dir/src/gamelog.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/genworld.cpp.o"
+  "CMakeFiles/openttd.dir/src/genworld.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/genworld_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/genworld_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/gfx.cpp.o"
+  "CMakeFiles/openttd.dir/src/gfx.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/gfx_layout.cpp.o"
+  "CMakeFiles/openttd.dir/src/gfx_layout.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/gfxinit.cpp.o"
+  "CMakeFiles/openttd.dir/src/gfxinit.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/goal.cpp.o"
+  "CMakeFiles/openttd.dir/src/goal.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/goal_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/goal_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/graph_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/graph_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ground_vehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/ground_vehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/group_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/group_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/group_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/group_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/heightmap.cpp.o"
+  "CMakeFiles/openttd.dir/src/heightmap.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/highscore.cpp.o"
+  "CMakeFiles/openttd.dir/src/highscore.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/highscore_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/highscore_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/hotkeys.cpp.o"
+  "CMakeFiles/openttd.dir/src/hotkeys.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/industry_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/industry_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/industry_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/industry_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/infrastructure.cpp.o"
+  "CMakeFiles/openttd.dir/src/infrastructure.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ini.cpp.o"
+  "CMakeFiles/openttd.dir/src/ini.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ini_load.cpp.o"
+  "CMakeFiles/openttd.dir/src/ini_load.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/intro_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/intro_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/landscape.cpp.o"
+  "CMakeFiles/openttd.dir/src/landscape.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/league_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/league_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/league_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/league_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/demands.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/demands.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/flowmapper.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/flowmapper.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraph.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraph.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraph_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraph_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraphjob.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraphjob.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraphschedule.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/linkgraphschedule.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/mcf.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/mcf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/linkgraph/refresh.cpp.o"
+  "CMakeFiles/openttd.dir/src/linkgraph/refresh.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/main_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/main_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/map.cpp.o"
+  "CMakeFiles/openttd.dir/src/map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc/countedobj.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc/countedobj.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc/dbg_helpers.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc/dbg_helpers.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc/getoptdata.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc/getoptdata.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/misc_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/misc_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/mixer.cpp.o"
+  "CMakeFiles/openttd.dir/src/mixer.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/music.cpp.o"
+  "CMakeFiles/openttd.dir/src/music.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/music/midifile.cpp.o"
+  "CMakeFiles/openttd.dir/src/music/midifile.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/music/null_m.cpp.o"
+  "CMakeFiles/openttd.dir/src/music/null_m.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/music_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/music_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/address.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/address.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/config.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/config.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/core.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/core.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/game_info.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/game_info.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/host.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/host.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/http_curl.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/http_curl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/os_abstraction.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/os_abstraction.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/packet.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/packet.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_admin.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_admin.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_connect.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_connect.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_content.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_content.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_coordinator.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_coordinator.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_game.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_game.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_stun.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_stun.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_turn.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/tcp_turn.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/core/udp.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/core/udp.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_admin.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_admin.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_chat_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_chat_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_client.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_client.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_command.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_command.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_content.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_content.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_content_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_content_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_coordinator.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_coordinator.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_gamelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_gamelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_query.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_query.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_server.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_server.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_stun.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_stun.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_turn.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_turn.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/network/network_udp.cpp.o"
+  "CMakeFiles/openttd.dir/src/network/network_udp.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_airport.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_airport.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_airporttiles.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_airporttiles.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_analysis.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_analysis.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_canal.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_canal.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_cargo.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_cargo.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_commons.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_commons.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_config.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_config.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_debug_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_debug_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_engine.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_engine.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_extension.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_extension.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_generic.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_generic.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_house.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_house.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_industries.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_industries.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_industrytiles.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_industrytiles.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_newlandscape.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_newlandscape.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_newsignals.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_newsignals.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_object.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_object.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_optimiser.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_optimiser.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_profiling.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_profiling.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_railtype.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_railtype.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_roadstop.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_roadstop.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_roadtype.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_roadtype.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_sound.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_sound.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_spritegroup.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_spritegroup.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_station.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_station.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_storage.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_storage.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_text.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_text.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_town.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_town.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/newgrf_townname.cpp.o"
+  "CMakeFiles/openttd.dir/src/newgrf_townname.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/news_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/news_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/object_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/object_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/object_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/object_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/openttd.cpp.o"
+  "CMakeFiles/openttd.dir/src/openttd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/order_backup.cpp.o"
+  "CMakeFiles/openttd.dir/src/order_backup.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/order_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/order_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/order_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/order_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/os/unix/crashlog_unix.cpp.o"
+  "CMakeFiles/openttd.dir/src/os/unix/crashlog_unix.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/os/unix/unix.cpp.o"
+  "CMakeFiles/openttd.dir/src/os/unix/unix.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/osk_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/osk_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/aystar.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/aystar.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/npf.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/npf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/queue.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/npf/queue.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/water_regions.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/water_regions.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_rail.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_rail.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_rail_region.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_rail_region.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_road.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_road.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_ship.cpp.o"
+  "CMakeFiles/openttd.dir/src/pathfinder/yapf/yapf_ship.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/pbs.cpp.o"
+  "CMakeFiles/openttd.dir/src/pbs.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/plans.cpp.o"
+  "CMakeFiles/openttd.dir/src/plans.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/plans_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/plans_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/plans_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/plans_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/programmable_signals.cpp.o"
+  "CMakeFiles/openttd.dir/src/programmable_signals.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/programmable_signals_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/programmable_signals_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/progress.cpp.o"
+  "CMakeFiles/openttd.dir/src/progress.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/rail.cpp.o"
+  "CMakeFiles/openttd.dir/src/rail.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/rail_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/rail_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/rail_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/rail_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/random_access_file.cpp.o"
+  "CMakeFiles/openttd.dir/src/random_access_file.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/road.cpp.o"
+  "CMakeFiles/openttd.dir/src/road.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/road_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/road_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/road_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/road_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/road_map.cpp.o"
+  "CMakeFiles/openttd.dir/src/road_map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/roadstop.cpp.o"
+  "CMakeFiles/openttd.dir/src/roadstop.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/roadveh_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/roadveh_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/roadveh_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/roadveh_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/afterload.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/afterload.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/ai_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/ai_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/airport_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/airport_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/animated_tile_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/animated_tile_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/autoreplace_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/autoreplace_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/bridge_signal_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/bridge_signal_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/cargomonitor_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/cargomonitor_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/cargopacket_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/cargopacket_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/cheat_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/cheat_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/company_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/company_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/debug_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/debug_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/depot_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/depot_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/economy_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/economy_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/engine_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/engine_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/extended_ver_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/extended_ver_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/game_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/game_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/gamelog_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/gamelog_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/goal_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/goal_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/group_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/group_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/industry_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/industry_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/labelmaps_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/labelmaps_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/league_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/league_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/linkgraph_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/linkgraph_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/map_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/map_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/misc_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/misc_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/newgrf_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/newgrf_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/newsignals_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/newsignals_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/object_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/object_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/oldloader.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/oldloader.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/oldloader_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/oldloader_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/order_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/order_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/plans_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/plans_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/saveload.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/saveload.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/signal_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/signal_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/signs_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/signs_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/station_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/station_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/storage_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/storage_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/story_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/story_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/strings_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/strings_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/subsidy_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/subsidy_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/tbtr_template_replacement_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/tbtr_template_replacement_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/tbtr_template_veh_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/tbtr_template_veh_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/town_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/town_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/tracerestrict_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/tracerestrict_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/train_speed_adaptation.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/train_speed_adaptation.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/tunnel_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/tunnel_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/ai_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/ai_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/airport_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/airport_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/animated_tile_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/animated_tile_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/autoreplace_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/autoreplace_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cargomonitor_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cargomonitor_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cargopacket_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cargopacket_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cheat_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/cheat_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/company_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/company_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/depot_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/depot_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/economy_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/economy_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/engine_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/engine_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/game_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/game_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/gamelog_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/gamelog_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/goal_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/goal_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/group_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/group_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/industry_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/industry_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/labelmaps_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/labelmaps_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/league_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/league_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/linkgraph_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/linkgraph_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/map_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/map_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/misc_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/misc_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/newgrf_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/newgrf_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/object_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/object_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/order_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/order_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/saveload.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/saveload.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/settings_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/settings_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/signs_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/signs_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/station_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/station_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/storage_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/storage_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/story_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/story_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/subsidy_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/subsidy_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/town_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/town_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/vehicle_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/upstream/vehicle_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/vehicle_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/vehicle_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/waypoint_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/waypoint_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/saveload/yapf_cache_sl.cpp.o"
+  "CMakeFiles/openttd.dir/src/saveload/yapf_cache_sl.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/schdispatch_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/schdispatch_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/schdispatch_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/schdispatch_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/scope_info.cpp.o"
+  "CMakeFiles/openttd.dir/src/scope_info.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/screenshot.cpp.o"
+  "CMakeFiles/openttd.dir/src/screenshot.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/screenshot_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/screenshot_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_accounting.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_accounting.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_admin.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_admin.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_airport.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_airport.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_base.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_base.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_basestation.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_basestation.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_bridge.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_bridge.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_bridgelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_bridgelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargo.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargo.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargolist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargolist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargomonitor.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_cargomonitor.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_client.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_client.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_clientlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_clientlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_company.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_company.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_companymode.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_companymode.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_controller.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_controller.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_date.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_date.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_depotlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_depotlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_engine.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_engine.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_enginelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_enginelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_error.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_error.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_event.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_event.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_event_types.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_event_types.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_execmode.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_execmode.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_game.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_game.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_gamesettings.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_gamesettings.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_goal.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_goal.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_group.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_group.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_grouplist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_grouplist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_industry.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_industry.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrylist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrylist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrytype.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrytype.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrytypelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_industrytypelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_inflation.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_inflation.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_infrastructure.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_infrastructure.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_league.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_league.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_list.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_list.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_log.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_log.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_map.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_marine.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_marine.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_newgrf.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_newgrf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_news.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_news.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_object.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_object.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_objecttype.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_objecttype.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_objecttypelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_objecttypelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_order.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_order.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_priorityqueue.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_priorityqueue.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_rail.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_rail.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_railtypelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_railtypelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_road.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_road.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_roadtypelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_roadtypelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_sign.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_sign.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_signlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_signlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_station.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_station.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_stationlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_stationlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_story_page.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_story_page.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_storypageelementlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_storypageelementlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_storypagelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_storypagelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_subsidy.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_subsidy.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_subsidylist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_subsidylist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_testmode.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_testmode.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_text.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_text.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_tile.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_tile.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_tilelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_tilelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_town.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_town.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_townlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_townlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_tunnel.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_tunnel.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_vehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_vehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_vehiclelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_vehiclelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_viewport.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_viewport.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_waypoint.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_waypoint.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_waypointlist.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_waypointlist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/api/script_window.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/api/script_window.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_config.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_config.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_info.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_info.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_info_dummy.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_info_dummy.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_instance.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_instance.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/script_scanner.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/script_scanner.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/squirrel.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/squirrel.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/script/squirrel_std.cpp.o"
+  "CMakeFiles/openttd.dir/src/script/squirrel_std.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/settings.cpp.o"
+  "CMakeFiles/openttd.dir/src/settings.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/settings_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/settings_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ship_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/ship_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/ship_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/ship_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/signal.cpp.o"
+  "CMakeFiles/openttd.dir/src/signal.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/signs.cpp.o"
+  "CMakeFiles/openttd.dir/src/signs.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/signs_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/signs_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/signs_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/signs_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/smallmap_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/smallmap_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/sound.cpp.o"
+  "CMakeFiles/openttd.dir/src/sound.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/sound/null_s.cpp.o"
+  "CMakeFiles/openttd.dir/src/sound/null_s.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/sprite.cpp.o"
+  "CMakeFiles/openttd.dir/src/sprite.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/spritecache.cpp.o"
+  "CMakeFiles/openttd.dir/src/spritecache.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/spriteloader/grf.cpp.o"
+  "CMakeFiles/openttd.dir/src/spriteloader/grf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/spriteloader/sprite_file.cpp.o"
+  "CMakeFiles/openttd.dir/src/spriteloader/sprite_file.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/station.cpp.o"
+  "CMakeFiles/openttd.dir/src/station.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/station_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/station_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/station_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/station_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/statusbar_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/statusbar_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/story.cpp.o"
+  "CMakeFiles/openttd.dir/src/story.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/story_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/story_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/strgen/strgen_base.cpp.o"
+  "CMakeFiles/openttd.dir/src/strgen/strgen_base.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/string.cpp.o"
+  "CMakeFiles/openttd.dir/src/string.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/stringfilter.cpp.o"
+  "CMakeFiles/openttd.dir/src/stringfilter.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/strings.cpp.o"
+  "CMakeFiles/openttd.dir/src/strings.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/subsidy.cpp.o"
+  "CMakeFiles/openttd.dir/src/subsidy.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/subsidy_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/subsidy_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tbtr_template_gui_create.cpp.o"
+  "CMakeFiles/openttd.dir/src/tbtr_template_gui_create.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tbtr_template_gui_main.cpp.o"
+  "CMakeFiles/openttd.dir/src/tbtr_template_gui_main.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tbtr_template_vehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/tbtr_template_vehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tbtr_template_vehicle_func.cpp.o"
+  "CMakeFiles/openttd.dir/src/tbtr_template_vehicle_func.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/terraform_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/terraform_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/terraform_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/terraform_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/textbuf.cpp.o"
+  "CMakeFiles/openttd.dir/src/textbuf.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/texteff.cpp.o"
+  "CMakeFiles/openttd.dir/src/texteff.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/textfile_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/textfile_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tgp.cpp.o"
+  "CMakeFiles/openttd.dir/src/tgp.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tile_map.cpp.o"
+  "CMakeFiles/openttd.dir/src/tile_map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tilearea.cpp.o"
+  "CMakeFiles/openttd.dir/src/tilearea.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/timetable_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/timetable_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/timetable_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/timetable_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/toolbar_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/toolbar_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/town_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/town_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/town_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/town_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/townname.cpp.o"
+  "CMakeFiles/openttd.dir/src/townname.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tracerestrict.cpp.o"
+  "CMakeFiles/openttd.dir/src/tracerestrict.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tracerestrict_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/tracerestrict_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/train_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/train_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/train_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/train_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/transparency_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/transparency_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tree_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/tree_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tree_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/tree_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tunnel_map.cpp.o"
+  "CMakeFiles/openttd.dir/src/tunnel_map.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/tunnelbridge_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/tunnelbridge_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/vehicle.cpp.o"
+  "CMakeFiles/openttd.dir/src/vehicle.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/vehicle_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/vehicle_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/vehicle_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/vehicle_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/vehiclelist.cpp.o"
+  "CMakeFiles/openttd.dir/src/vehiclelist.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/video/dedicated_v.cpp.o"
+  "CMakeFiles/openttd.dir/src/video/dedicated_v.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/video/null_v.cpp.o"
+  "CMakeFiles/openttd.dir/src/video/null_v.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/video/video_driver.cpp.o"
+  "CMakeFiles/openttd.dir/src/video/video_driver.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/viewport.cpp.o"
+  "CMakeFiles/openttd.dir/src/viewport.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/viewport_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/viewport_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/void_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/void_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/water_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/water_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/waypoint.cpp.o"
+  "CMakeFiles/openttd.dir/src/waypoint.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/waypoint_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/waypoint_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/waypoint_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/waypoint_gui.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/widget.cpp.o"
+  "CMakeFiles/openttd.dir/src/widget.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/widgets/dropdown.cpp.o"
+  "CMakeFiles/openttd.dir/src/widgets/dropdown.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/widgets/slider.cpp.o"
+  "CMakeFiles/openttd.dir/src/widgets/slider.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/window.cpp.o"
+  "CMakeFiles/openttd.dir/src/window.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/worker_thread.cpp.o"
+  "CMakeFiles/openttd.dir/src/worker_thread.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/zoning_cmd.cpp.o"
+  "CMakeFiles/openttd.dir/src/zoning_cmd.cpp.o.d"
+  "CMakeFiles/openttd.dir/src/zoning_gui.cpp.o"
+  "CMakeFiles/openttd.dir/src/zoning_gui.cpp.o.d"
+  "openttd"
+  "openttd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/openttd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/regression"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/regression_stationlist"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regression_stationlist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(regression_regression "/usr/bin/cmake" "-DOPENTTD_EXECUTABLE=/root/repo/_gate_build/openttd" "-DEDITBIN_EXECUTABLE=" "-DREGRESSION_TEST=regression" "-P" "/root/repo/cmake/scripts/Regression.cmake")
+set_tests_properties(regression_regression PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build" _BACKTRACE_TRIPLES "/root/repo/cmake/CreateRegression.cmake;72;add_test;/root/repo/CMakeLists.txt;469;create_regression;/root/repo/CMakeLists.txt;0;")
+add_test(regression_stationlist "/usr/bin/cmake" "-DOPENTTD_EXECUTABLE=/root/repo/_gate_build/openttd" "-DEDITBIN_EXECUTABLE=" "-DREGRESSION_TEST=stationlist" "-P" "/root/repo/cmake/scripts/Regression.cmake")
+set_tests_properties(regression_stationlist PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build" _BACKTRACE_TRIPLES "/root/repo/cmake/CreateRegression.cmake;72;add_test;/root/repo/CMakeLists.txt;469;create_regression;/root/repo/CMakeLists.txt;0;")
+subdirs("bin")
+subdirs("src")
+subdirs("media")
@@ -0,0 +1,6158 @@
+/* This file is automatically generated. Do not modify */
+
+#ifndef TABLE_STRINGS_H
+#define TABLE_STRINGS_H
+
+static const StringID STR_NULL = 0x0;
+static const StringID STR_EMPTY = 0x1;
+static const StringID STR_UNDEFINED = 0x2;
+static const StringID STR_JUST_NOTHING = 0x3;
+static const StringID STR_CARGO_PLURAL_NOTHING = 0x4;
+static const StringID STR_CARGO_PLURAL_PASSENGERS = 0x5;
+static const StringID STR_CARGO_PLURAL_COAL = 0x6;
+static const StringID STR_CARGO_PLURAL_MAIL = 0x7;
+static const StringID STR_CARGO_PLURAL_OIL = 0x8;
+static const StringID STR_CARGO_PLURAL_LIVESTOCK = 0x9;
+static const StringID STR_CARGO_PLURAL_GOODS = 0xA;
+static const StringID STR_CARGO_PLURAL_GRAIN = 0xB;
+static const StringID STR_CARGO_PLURAL_WOOD = 0xC;
+static const StringID STR_CARGO_PLURAL_IRON_ORE = 0xD;
+static const StringID STR_CARGO_PLURAL_STEEL = 0xE;
+static const StringID STR_CARGO_PLURAL_VALUABLES = 0xF;
+static const StringID STR_CARGO_PLURAL_COPPER_ORE = 0x10;
+static const StringID STR_CARGO_PLURAL_MAIZE = 0x11;
+static const StringID STR_CARGO_PLURAL_FRUIT = 0x12;
+static const StringID STR_CARGO_PLURAL_DIAMONDS = 0x13;
+static const StringID STR_CARGO_PLURAL_FOOD = 0x14;
+static const StringID STR_CARGO_PLURAL_PAPER = 0x15;
+static const StringID STR_CARGO_PLURAL_GOLD = 0x16;
+static const StringID STR_CARGO_PLURAL_WATER = 0x17;
+static const StringID STR_CARGO_PLURAL_WHEAT = 0x18;
+static const StringID STR_CARGO_PLURAL_RUBBER = 0x19;
+static const StringID STR_CARGO_PLURAL_SUGAR = 0x1A;
+static const StringID STR_CARGO_PLURAL_TOYS = 0x1B;
+static const StringID STR_CARGO_PLURAL_SWEETS = 0x1C;
+static const StringID STR_CARGO_PLURAL_COLA = 0x1D;
+static const StringID STR_CARGO_PLURAL_CANDYFLOSS = 0x1E;
+static const StringID STR_CARGO_PLURAL_BUBBLES = 0x1F;
+static const StringID STR_CARGO_PLURAL_TOFFEE = 0x20;
+static const StringID STR_CARGO_PLURAL_BATTERIES = 0x21;
+static const StringID STR_CARGO_PLURAL_PLASTIC = 0x22;
+static const StringID STR_CARGO_PLURAL_FIZZY_DRINKS = 0x23;
+static const StringID STR_CARGO_SINGULAR_NOTHING = 0x24;
+static const StringID STR_CARGO_SINGULAR_PASSENGER = 0x25;
+static const StringID STR_CARGO_SINGULAR_COAL = 0x26;
+static const StringID STR_CARGO_SINGULAR_MAIL = 0x27;
+static const StringID STR_CARGO_SINGULAR_OIL = 0x28;
+static const StringID STR_CARGO_SINGULAR_LIVESTOCK = 0x29;
+static const StringID STR_CARGO_SINGULAR_GOODS = 0x2A;
+static const StringID STR_CARGO_SINGULAR_GRAIN = 0x2B;
+static const StringID STR_CARGO_SINGULAR_WOOD = 0x2C;
+static const StringID STR_CARGO_SINGULAR_IRON_ORE = 0x2D;
+static const StringID STR_CARGO_SINGULAR_STEEL = 0x2E;
+static const StringID STR_CARGO_SINGULAR_VALUABLES = 0x2F;
+static const StringID STR_CARGO_SINGULAR_COPPER_ORE = 0x30;
+static const StringID STR_CARGO_SINGULAR_MAIZE = 0x31;
+static const StringID STR_CARGO_SINGULAR_FRUIT = 0x32;
+static const StringID STR_CARGO_SINGULAR_DIAMOND = 0x33;
+static const StringID STR_CARGO_SINGULAR_FOOD = 0x34;
+static const StringID STR_CARGO_SINGULAR_PAPER = 0x35;
+static const StringID STR_CARGO_SINGULAR_GOLD = 0x36;
+static const StringID STR_CARGO_SINGULAR_WATER = 0x37;
+static const StringID STR_CARGO_SINGULAR_WHEAT = 0x38;
+static const StringID STR_CARGO_SINGULAR_RUBBER = 0x39;
+static const StringID STR_CARGO_SINGULAR_SUGAR = 0x3A;
+static const StringID STR_CARGO_SINGULAR_TOY = 0x3B;
+static const StringID STR_CARGO_SINGULAR_SWEETS = 0x3C;
+static const StringID STR_CARGO_SINGULAR_COLA = 0x3D;
+static const StringID STR_CARGO_SINGULAR_CANDYFLOSS = 0x3E;
+static const StringID STR_CARGO_SINGULAR_BUBBLE = 0x3F;
+static const StringID STR_CARGO_SINGULAR_TOFFEE = 0x40;
+static const StringID STR_CARGO_SINGULAR_BATTERY = 0x41;
+static const StringID STR_CARGO_SINGULAR_PLASTIC = 0x42;
+static const StringID STR_CARGO_SINGULAR_FIZZY_DRINK = 0x43;
+static const StringID STR_QUANTITY_NOTHING = 0x44;
+static const StringID STR_QUANTITY_PASSENGERS = 0x45;
+static const StringID STR_QUANTITY_COAL = 0x46;
+static const StringID STR_QUANTITY_MAIL = 0x47;
+static const StringID STR_QUANTITY_OIL = 0x48;
+static const StringID STR_QUANTITY_LIVESTOCK = 0x49;
+static const StringID STR_QUANTITY_GOODS = 0x4A;
+static const StringID STR_QUANTITY_GRAIN = 0x4B;
+static const StringID STR_QUANTITY_WOOD = 0x4C;
+static const StringID STR_QUANTITY_IRON_ORE = 0x4D;
+static const StringID STR_QUANTITY_STEEL = 0x4E;
+static const StringID STR_QUANTITY_VALUABLES = 0x4F;
+static const StringID STR_QUANTITY_COPPER_ORE = 0x50;
+static const StringID STR_QUANTITY_MAIZE = 0x51;
+static const StringID STR_QUANTITY_FRUIT = 0x52;
+static const StringID STR_QUANTITY_DIAMONDS = 0x53;
+static const StringID STR_QUANTITY_FOOD = 0x54;
+static const StringID STR_QUANTITY_PAPER = 0x55;
+static const StringID STR_QUANTITY_GOLD = 0x56;
+static const StringID STR_QUANTITY_WATER = 0x57;
+static const StringID STR_QUANTITY_WHEAT = 0x58;
+static const StringID STR_QUANTITY_RUBBER = 0x59;
+static const StringID STR_QUANTITY_SUGAR = 0x5A;
+static const StringID STR_QUANTITY_TOYS = 0x5B;
+static const StringID STR_QUANTITY_SWEETS = 0x5C;
+static const StringID STR_QUANTITY_COLA = 0x5D;
+static const StringID STR_QUANTITY_CANDYFLOSS = 0x5E;
+static const StringID STR_QUANTITY_BUBBLES = 0x5F;
+static const StringID STR_QUANTITY_TOFFEE = 0x60;
+static const StringID STR_QUANTITY_BATTERIES = 0x61;
+static const StringID STR_QUANTITY_PLASTIC = 0x62;
+static const StringID STR_QUANTITY_FIZZY_DRINKS = 0x63;
+static const StringID STR_QUANTITY_N_A = 0x64;
+static const StringID STR_ABBREV_NOTHING = 0x65;
+static const StringID STR_ABBREV_PASSENGERS = 0x66;
+static const StringID STR_ABBREV_COAL = 0x67;
+static const StringID STR_ABBREV_MAIL = 0x68;
+static const StringID STR_ABBREV_OIL = 0x69;
+static const StringID STR_ABBREV_LIVESTOCK = 0x6A;
+static const StringID STR_ABBREV_GOODS = 0x6B;
+static const StringID STR_ABBREV_GRAIN = 0x6C;
+static const StringID STR_ABBREV_WOOD = 0x6D;
+static const StringID STR_ABBREV_IRON_ORE = 0x6E;
+static const StringID STR_ABBREV_STEEL = 0x6F;
+static const StringID STR_ABBREV_VALUABLES = 0x70;
+static const StringID STR_ABBREV_COPPER_ORE = 0x71;
+static const StringID STR_ABBREV_MAIZE = 0x72;
+static const StringID STR_ABBREV_FRUIT = 0x73;
+static const StringID STR_ABBREV_DIAMONDS = 0x74;
+static const StringID STR_ABBREV_FOOD = 0x75;
+static const StringID STR_ABBREV_PAPER = 0x76;
+static const StringID STR_ABBREV_GOLD = 0x77;
+static const StringID STR_ABBREV_WATER = 0x78;
+static const StringID STR_ABBREV_WHEAT = 0x79;
+static const StringID STR_ABBREV_RUBBER = 0x7A;
+static const StringID STR_ABBREV_SUGAR = 0x7B;
+static const StringID STR_ABBREV_TOYS = 0x7C;
+static const StringID STR_ABBREV_SWEETS = 0x7D;
+static const StringID STR_ABBREV_COLA = 0x7E;
+static const StringID STR_ABBREV_CANDYFLOSS = 0x7F;
+static const StringID STR_ABBREV_BUBBLES = 0x80;
+static const StringID STR_ABBREV_TOFFEE = 0x81;
+static const StringID STR_ABBREV_BATTERIES = 0x82;
+static const StringID STR_ABBREV_PLASTIC = 0x83;
+static const StringID STR_ABBREV_FIZZY_DRINKS = 0x84;
+static const StringID STR_ABBREV_NONE = 0x85;
+static const StringID STR_ABBREV_ALL = 0x86;
+static const StringID STR_PASSENGERS = 0x87;
+static const StringID STR_BAGS = 0x88;
+static const StringID STR_TONS = 0x89;
+static const StringID STR_LITERS = 0x8A;
+static const StringID STR_ITEMS = 0x8B;
+static const StringID STR_CRATES = 0x8C;
+static const StringID STR_COLOUR_DEFAULT = 0x8D;
+static const StringID STR_COLOUR_DARK_BLUE = 0x8E;
+static const StringID STR_COLOUR_PALE_GREEN = 0x8F;
+static const StringID STR_COLOUR_PINK = 0x90;
+static const StringID STR_COLOUR_YELLOW = 0x91;
+static const StringID STR_COLOUR_RED = 0x92;
+static const StringID STR_COLOUR_LIGHT_BLUE = 0x93;
+static const StringID STR_COLOUR_GREEN = 0x94;
+static const StringID STR_COLOUR_DARK_GREEN = 0x95;
+static const StringID STR_COLOUR_BLUE = 0x96;
+static const StringID STR_COLOUR_CREAM = 0x97;
+static const StringID STR_COLOUR_MAUVE = 0x98;
+static const StringID STR_COLOUR_PURPLE = 0x99;
+static const StringID STR_COLOUR_ORANGE = 0x9A;
+static const StringID STR_COLOUR_BROWN = 0x9B;
+static const StringID STR_COLOUR_GREY = 0x9C;
+static const StringID STR_COLOUR_WHITE = 0x9D;
+static const StringID STR_COLOUR_RANDOM = 0x9E;
+static const StringID STR_UNITS_VELOCITY_IMPERIAL = 0x9F;
+static const StringID STR_UNITS_VELOCITY_METRIC = 0xA0;
+static const StringID STR_UNITS_VELOCITY_SI = 0xA1;
+static const StringID STR_UNITS_VELOCITY_GAMEUNITS = 0xA2;
+static const StringID STR_UNITS_VELOCITY_KNOTS = 0xA3;
+static const StringID STR_UNITS_POWER_IMPERIAL = 0xA4;
+static const StringID STR_UNITS_POWER_METRIC = 0xA5;
+static const StringID STR_UNITS_POWER_SI = 0xA6;
+static const StringID STR_UNITS_POWER_IMPERIAL_TO_WEIGHT_IMPERIAL = 0xA7;
+static const StringID STR_UNITS_POWER_IMPERIAL_TO_WEIGHT_METRIC = 0xA8;
+static const StringID STR_UNITS_POWER_IMPERIAL_TO_WEIGHT_SI = 0xA9;
+static const StringID STR_UNITS_POWER_METRIC_TO_WEIGHT_IMPERIAL = 0xAA;
+static const StringID STR_UNITS_POWER_METRIC_TO_WEIGHT_METRIC = 0xAB;
+static const StringID STR_UNITS_POWER_METRIC_TO_WEIGHT_SI = 0xAC;
+static const StringID STR_UNITS_POWER_SI_TO_WEIGHT_IMPERIAL = 0xAD;
+static const StringID STR_UNITS_POWER_SI_TO_WEIGHT_METRIC = 0xAE;
+static const StringID STR_UNITS_POWER_SI_TO_WEIGHT_SI = 0xAF;
+static const StringID STR_UNITS_WEIGHT_SHORT_IMPERIAL = 0xB0;
+static const StringID STR_UNITS_WEIGHT_SHORT_METRIC = 0xB1;
+static const StringID STR_UNITS_WEIGHT_SHORT_SI = 0xB2;
+static const StringID STR_UNITS_WEIGHT_LONG_IMPERIAL = 0xB3;
+static const StringID STR_UNITS_WEIGHT_LONG_METRIC = 0xB4;
+static const StringID STR_UNITS_WEIGHT_LONG_SI = 0xB5;
+static const StringID STR_UNITS_VOLUME_SHORT_IMPERIAL = 0xB6;
+static const StringID STR_UNITS_VOLUME_SHORT_METRIC = 0xB7;
+static const StringID STR_UNITS_VOLUME_SHORT_SI = 0xB8;
+static const StringID STR_UNITS_VOLUME_LONG_IMPERIAL = 0xB9;
+static const StringID STR_UNITS_VOLUME_LONG_METRIC = 0xBA;
+static const StringID STR_UNITS_VOLUME_LONG_SI = 0xBB;
+static const StringID STR_UNITS_FORCE_IMPERIAL = 0xBC;
+static const StringID STR_UNITS_FORCE_METRIC = 0xBD;
+static const StringID STR_UNITS_FORCE_SI = 0xBE;
+static const StringID STR_UNITS_HEIGHT_IMPERIAL = 0xBF;
+static const StringID STR_UNITS_HEIGHT_METRIC = 0xC0;
+static const StringID STR_UNITS_HEIGHT_SI = 0xC1;
+static const StringID STR_LIST_FILTER_TITLE = 0xC2;
+static const StringID STR_LIST_FILTER_OSKTITLE = 0xC3;
+static const StringID STR_LIST_FILTER_TOOLTIP = 0xC4;
+static const StringID STR_TOOLTIP_GROUP_ORDER = 0xC5;
+static const StringID STR_TOOLTIP_SORT_ORDER = 0xC6;
+static const StringID STR_TOOLTIP_SORT_CRITERIA = 0xC7;
+static const StringID STR_TOOLTIP_FILTER_CRITERIA = 0xC8;
+static const StringID STR_BUTTON_SORT_BY = 0xC9;
+static const StringID STR_BUTTON_CATCHMENT = 0xCA;
+static const StringID STR_TOOLTIP_CATCHMENT = 0xCB;
+static const StringID STR_TOOLTIP_CLOSE_WINDOW = 0xCC;
+static const StringID STR_TOOLTIP_WINDOW_TITLE_DRAG_THIS = 0xCD;
+static const StringID STR_TOOLTIP_SHADE = 0xCE;
+static const StringID STR_TOOLTIP_DEBUG = 0xCF;
+static const StringID STR_TOOLTIP_DEFSIZE = 0xD0;
+static const StringID STR_TOOLTIP_STICKY = 0xD1;
+static const StringID STR_TOOLTIP_RESIZE = 0xD2;
+static const StringID STR_TOOLTIP_TOGGLE_LARGE_SMALL_WINDOW = 0xD3;
+static const StringID STR_TOOLTIP_VSCROLL_BAR_SCROLLS_LIST = 0xD4;
+static const StringID STR_TOOLTIP_HSCROLL_BAR_SCROLLS_LIST = 0xD5;
+static const StringID STR_TOOLTIP_DEMOLISH_BUILDINGS_ETC = 0xD6;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_TRAIN = 0xD7;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_ROAD_VEHICLE = 0xD8;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_SHIP = 0xD9;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_AIRCRAFT = 0xDA;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_TRAIN_TOOLTIP = 0xDB;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_ROAD_VEHICLE_TOOLTIP = 0xDC;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_SHIP_TOOLTIP = 0xDD;
+static const StringID STR_SHOW_HIDDEN_ENGINES_VEHICLE_AIRCRAFT_TOOLTIP = 0xDE;
+static const StringID STR_BUTTON_DEFAULT = 0xDF;
+static const StringID STR_BUTTON_CANCEL = 0xE0;
+static const StringID STR_BUTTON_OK = 0xE1;
+static const StringID STR_WARNING_PASSWORD_SECURITY = 0xE2;
+static const StringID STR_OSK_KEYBOARD_LAYOUT = 0xE3;
+static const StringID STR_OSK_KEYBOARD_LAYOUT_CAPS = 0xE4;
+static const StringID STR_MEASURE_LENGTH = 0xE5;
+static const StringID STR_MEASURE_AREA = 0xE6;
+static const StringID STR_MEASURE_LENGTH_HEIGHTDIFF = 0xE7;
+static const StringID STR_MEASURE_AREA_HEIGHTDIFF = 0xE8;
+static const StringID STR_SORT_BY_CAPTION_NAME = 0xE9;
+static const StringID STR_SORT_BY_CAPTION_DATE = 0xEA;
+static const StringID STR_SORT_BY_NAME = 0xEB;
+static const StringID STR_SORT_BY_PRODUCTION = 0xEC;
+static const StringID STR_SORT_BY_TYPE = 0xED;
+static const StringID STR_SORT_BY_TRANSPORTED = 0xEE;
+static const StringID STR_SORT_BY_NUMBER = 0xEF;
+static const StringID STR_SORT_BY_PROFIT_LAST_YEAR = 0xF0;
+static const StringID STR_SORT_BY_PROFIT_THIS_YEAR = 0xF1;
+static const StringID STR_SORT_BY_AGE = 0xF2;
+static const StringID STR_SORT_BY_RELIABILITY = 0xF3;
+static const StringID STR_SORT_BY_TOTAL_CAPACITY_PER_CARGOTYPE = 0xF4;
+static const StringID STR_SORT_BY_MAX_SPEED = 0xF5;
+static const StringID STR_SORT_BY_MODEL = 0xF6;
+static const StringID STR_SORT_BY_VALUE = 0xF7;
+static const StringID STR_SORT_BY_LENGTH = 0xF8;
+static const StringID STR_SORT_BY_LIFE_TIME = 0xF9;
+static const StringID STR_SORT_BY_TIMETABLE_DELAY = 0xFA;
+static const StringID STR_SORT_BY_FACILITY = 0xFB;
+static const StringID STR_SORT_BY_WAITING_TOTAL = 0xFC;
+static const StringID STR_SORT_BY_WAITING_AVAILABLE = 0xFD;
+static const StringID STR_SORT_BY_RATING_MAX = 0xFE;
+static const StringID STR_SORT_BY_RATING_MIN = 0xFF;
+static const StringID STR_SORT_BY_ENGINE_ID = 0x100;
+static const StringID STR_SORT_BY_COST = 0x101;
+static const StringID STR_SORT_BY_POWER = 0x102;
+static const StringID STR_SORT_BY_TRACTIVE_EFFORT = 0x103;
+static const StringID STR_SORT_BY_INTRO_DATE = 0x104;
+static const StringID STR_SORT_BY_RUNNING_COST = 0x105;
+static const StringID STR_SORT_BY_POWER_VS_RUNNING_COST = 0x106;
+static const StringID STR_SORT_BY_CARGO_CAPACITY = 0x107;
+static const StringID STR_SORT_BY_RANGE = 0x108;
+static const StringID STR_SORT_BY_POPULATION = 0x109;
+static const StringID STR_SORT_BY_RATING = 0x10A;
+static const StringID STR_SORT_BY_NUM_VEHICLES = 0x10B;
+static const StringID STR_SORT_BY_TOTAL_PROFIT_LAST_YEAR = 0x10C;
+static const StringID STR_SORT_BY_TOTAL_PROFIT_THIS_YEAR = 0x10D;
+static const StringID STR_SORT_BY_AVERAGE_PROFIT_LAST_YEAR = 0x10E;
+static const StringID STR_SORT_BY_AVERAGE_PROFIT_THIS_YEAR = 0x10F;
+static const StringID STR_GROUP_BY_NONE = 0x110;
+static const StringID STR_GROUP_BY_SHARED_ORDERS = 0x111;
+static const StringID STR_GOTO_ORDER_VIEW = 0x112;
+static const StringID STR_GOTO_ORDER_VIEW_TOOLTIP = 0x113;
+static const StringID STR_TOOLBAR_TOOLTIP_PAUSE_GAME = 0x114;
+static const StringID STR_TOOLBAR_TOOLTIP_FORWARD = 0x115;
+static const StringID STR_TOOLBAR_TOOLTIP_OPTIONS = 0x116;
+static const StringID STR_TOOLBAR_TOOLTIP_SAVE_GAME_ABANDON_GAME = 0x117;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_MAP = 0x118;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_TOWN_DIRECTORY = 0x119;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_SUBSIDIES = 0x11A;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_LIST_OF_COMPANY_STATIONS = 0x11B;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_COMPANY_FINANCES = 0x11C;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_COMPANY_GENERAL = 0x11D;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_STORY_BOOK = 0x11E;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_GOALS_LIST = 0x11F;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_GRAPHS = 0x120;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_COMPANY_LEAGUE = 0x121;
+static const StringID STR_TOOLBAR_TOOLTIP_FUND_CONSTRUCTION_OF_NEW = 0x122;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_LIST_OF_COMPANY_TRAINS = 0x123;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_LIST_OF_COMPANY_ROAD_VEHICLES = 0x124;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_LIST_OF_COMPANY_SHIPS = 0x125;
+static const StringID STR_TOOLBAR_TOOLTIP_DISPLAY_LIST_OF_COMPANY_AIRCRAFT = 0x126;
+static const StringID STR_TOOLBAR_TOOLTIP_ZOOM_THE_VIEW_IN = 0x127;
+static const StringID STR_TOOLBAR_TOOLTIP_ZOOM_THE_VIEW_OUT = 0x128;
+static const StringID STR_TOOLBAR_TOOLTIP_BUILD_RAILROAD_TRACK = 0x129;
+static const StringID STR_TOOLBAR_TOOLTIP_BUILD_ROADS = 0x12A;
+static const StringID STR_TOOLBAR_TOOLTIP_BUILD_TRAMWAYS = 0x12B;
+static const StringID STR_TOOLBAR_TOOLTIP_BUILD_SHIP_DOCKS = 0x12C;
+static const StringID STR_TOOLBAR_TOOLTIP_BUILD_AIRPORTS = 0x12D;
+static const StringID STR_TOOLBAR_TOOLTIP_LANDSCAPING = 0x12E;
+static const StringID STR_TOOLBAR_TOOLTIP_SHOW_SOUND_MUSIC_WINDOW = 0x12F;
+static const StringID STR_TOOLBAR_TOOLTIP_SHOW_LAST_MESSAGE_NEWS = 0x130;
+static const StringID STR_TOOLBAR_TOOLTIP_LAND_BLOCK_INFORMATION = 0x131;
+static const StringID STR_TOOLBAR_TOOLTIP_SWITCH_TOOLBAR = 0x132;
+static const StringID STR_SCENEDIT_TOOLBAR_TOOLTIP_SAVE_SCENARIO_LOAD_SCENARIO = 0x133;
+static const StringID STR_SCENEDIT_TOOLBAR_OPENTTD = 0x134;
+static const StringID STR_SCENEDIT_TOOLBAR_SCENARIO_EDITOR = 0x135;
+static const StringID STR_SCENEDIT_TOOLBAR_TOOLTIP_MOVE_THE_STARTING_DATE_BACKWARD = 0x136;
+static const StringID STR_SCENEDIT_TOOLBAR_TOOLTIP_MOVE_THE_STARTING_DATE_FORWARD = 0x137;
+static const StringID STR_SCENEDIT_TOOLBAR_TOOLTIP_SET_DATE = 0x138;
+static const StringID STR_SCENEDIT_TOOLBAR_TOOLTIP_DISPLAY_MAP_TOWN_DIRECTORY = 0x139;
+static const StringID STR_SCENEDIT_TOOLBAR_LANDSCAPE_GENERATION = 0x13A;
+static const StringID STR_SCENEDIT_TOOLBAR_TOWN_GENERATION = 0x13B;
+static const StringID STR_SCENEDIT_TOOLBAR_INDUSTRY_GENERATION = 0x13C;
+static const StringID STR_SCENEDIT_TOOLBAR_ROAD_CONSTRUCTION = 0x13D;
+static const StringID STR_SCENEDIT_TOOLBAR_TRAM_CONSTRUCTION = 0x13E;
+static const StringID STR_SCENEDIT_TOOLBAR_PLANT_TREES = 0x13F;
+static const StringID STR_SCENEDIT_TOOLBAR_PLACE_SIGN = 0x140;
+static const StringID STR_SCENEDIT_TOOLBAR_PLACE_OBJECT = 0x141;
+static const StringID STR_SCENEDIT_FILE_MENU_SAVE_SCENARIO = 0x142;
+static const StringID STR_SCENEDIT_FILE_MENU_LOAD_SCENARIO = 0x143;
+static const StringID STR_SCENEDIT_FILE_MENU_SAVE_HEIGHTMAP = 0x144;
+static const StringID STR_SCENEDIT_FILE_MENU_LOAD_HEIGHTMAP = 0x145;
+static const StringID STR_SCENEDIT_FILE_MENU_QUIT_EDITOR = 0x146;
+static const StringID STR_SCENEDIT_FILE_MENU_SEPARATOR = 0x147;
+static const StringID STR_SCENEDIT_FILE_MENU_QUIT = 0x148;
+static const StringID STR_SETTINGS_MENU_GAME_OPTIONS = 0x149;
+static const StringID STR_SETTINGS_MENU_CONFIG_SETTINGS_TREE = 0x14A;
+static const StringID STR_SETTINGS_MENU_AI_SETTINGS = 0x14B;
+static const StringID STR_SETTINGS_MENU_GAMESCRIPT_SETTINGS = 0x14C;
+static const StringID STR_SETTINGS_MENU_NEWGRF_SETTINGS = 0x14D;
+static const StringID STR_SETTINGS_MENU_TRANSPARENCY_OPTIONS = 0x14E;
+static const StringID STR_SETTINGS_MENU_TOWN_NAMES_DISPLAYED = 0x14F;
+static const StringID STR_SETTINGS_MENU_STATION_NAMES_DISPLAYED = 0x150;
+static const StringID STR_SETTINGS_MENU_WAYPOINTS_DISPLAYED = 0x151;
+static const StringID STR_SETTINGS_MENU_SIGNS_DISPLAYED = 0x152;
+static const StringID STR_SETTINGS_MENU_SHOW_COMPETITOR_SIGNS = 0x153;
+static const StringID STR_SETTINGS_MENU_FULL_ANIMATION = 0x154;
+static const StringID STR_SETTINGS_MENU_FULL_DETAIL = 0x155;
+static const StringID STR_SETTINGS_MENU_TRANSPARENT_BUILDINGS = 0x156;
+static const StringID STR_SETTINGS_MENU_TRANSPARENT_SIGNS = 0x157;
+static const StringID STR_FILE_MENU_SAVE_GAME = 0x158;
+static const StringID STR_FILE_MENU_LOAD_GAME = 0x159;
+static const StringID STR_FILE_MENU_QUIT_GAME = 0x15A;
+static const StringID STR_FILE_MENU_SEPARATOR = 0x15B;
+static const StringID STR_FILE_MENU_EXIT = 0x15C;
+static const StringID STR_MAP_MENU_MAP_OF_WORLD = 0x15D;
+static const StringID STR_MAP_MENU_EXTRA_VIEWPORT = 0x15E;
+static const StringID STR_MAP_MENU_LINGRAPH_LEGEND = 0x15F;
+static const StringID STR_MAP_MENU_SIGN_LIST = 0x160;
+static const StringID STR_TOWN_MENU_TOWN_DIRECTORY = 0x161;
+static const StringID STR_TOWN_MENU_FOUND_TOWN = 0x162;
+static const StringID STR_SUBSIDIES_MENU_SUBSIDIES = 0x163;
+static const StringID STR_GRAPH_MENU_OPERATING_PROFIT_GRAPH = 0x164;
+static const StringID STR_GRAPH_MENU_INCOME_GRAPH = 0x165;
+static const StringID STR_GRAPH_MENU_DELIVERED_CARGO_GRAPH = 0x166;
+static const StringID STR_GRAPH_MENU_PERFORMANCE_HISTORY_GRAPH = 0x167;
+static const StringID STR_GRAPH_MENU_COMPANY_VALUE_GRAPH = 0x168;
+static const StringID STR_GRAPH_MENU_CARGO_PAYMENT_RATES = 0x169;
+static const StringID STR_GRAPH_MENU_COMPANY_LEAGUE_TABLE = 0x16A;
+static const StringID STR_GRAPH_MENU_DETAILED_PERFORMANCE_RATING = 0x16B;
+static const StringID STR_GRAPH_MENU_HIGHSCORE = 0x16C;
+static const StringID STR_INDUSTRY_MENU_INDUSTRY_DIRECTORY = 0x16D;
+static const StringID STR_INDUSTRY_MENU_INDUSTRY_CHAIN = 0x16E;
+static const StringID STR_INDUSTRY_MENU_FUND_NEW_INDUSTRY = 0x16F;
+static const StringID STR_RAIL_MENU_RAILROAD_CONSTRUCTION = 0x170;
+static const StringID STR_RAIL_MENU_ELRAIL_CONSTRUCTION = 0x171;
+static const StringID STR_RAIL_MENU_MONORAIL_CONSTRUCTION = 0x172;
+static const StringID STR_RAIL_MENU_MAGLEV_CONSTRUCTION = 0x173;
+static const StringID STR_ROAD_MENU_ROAD_CONSTRUCTION = 0x174;
+static const StringID STR_ROAD_MENU_TRAM_CONSTRUCTION = 0x175;
+static const StringID STR_WATERWAYS_MENU_WATERWAYS_CONSTRUCTION = 0x176;
+static const StringID STR_AIRCRAFT_MENU_AIRPORT_CONSTRUCTION = 0x177;
+static const StringID STR_LANDSCAPING_MENU_LANDSCAPING = 0x178;
+static const StringID STR_LANDSCAPING_MENU_PLANT_TREES = 0x179;
+static const StringID STR_LANDSCAPING_MENU_PLACE_SIGN = 0x17A;
+static const StringID STR_TOOLBAR_SOUND_MUSIC = 0x17B;
+static const StringID STR_NEWS_MENU_LAST_MESSAGE_NEWS_REPORT = 0x17C;
+static const StringID STR_NEWS_MENU_MESSAGE_HISTORY_MENU = 0x17D;
+static const StringID STR_NEWS_MENU_DELETE_ALL_MESSAGES = 0x17E;
+static const StringID STR_ABOUT_MENU_LAND_BLOCK_INFO = 0x17F;
+static const StringID STR_ABOUT_MENU_SEPARATOR = 0x180;
+static const StringID STR_ABOUT_MENU_TOGGLE_CONSOLE = 0x181;
+static const StringID STR_ABOUT_MENU_AI_DEBUG = 0x182;
+static const StringID STR_ABOUT_MENU_SCREENSHOT = 0x183;
+static const StringID STR_ABOUT_MENU_SHOW_FRAMERATE = 0x184;
+static const StringID STR_ABOUT_MENU_SHOW_TOGGLE_MODIFIER_KEYS = 0x185;
+static const StringID STR_ABOUT_MENU_ABOUT_OPENTTD = 0x186;
+static const StringID STR_ABOUT_MENU_SPRITE_ALIGNER = 0x187;
+static const StringID STR_ABOUT_MENU_TOGGLE_BOUNDING_BOXES = 0x188;
+static const StringID STR_ABOUT_MENU_TOGGLE_DIRTY_BLOCKS = 0x189;
+static const StringID STR_ORDINAL_NUMBER_1ST = 0x18A;
+static const StringID STR_ORDINAL_NUMBER_2ND = 0x18B;
+static const StringID STR_ORDINAL_NUMBER_3RD = 0x18C;
+static const StringID STR_ORDINAL_NUMBER_4TH = 0x18D;
+static const StringID STR_ORDINAL_NUMBER_5TH = 0x18E;
+static const StringID STR_ORDINAL_NUMBER_6TH = 0x18F;
+static const StringID STR_ORDINAL_NUMBER_7TH = 0x190;
+static const StringID STR_ORDINAL_NUMBER_8TH = 0x191;
+static const StringID STR_ORDINAL_NUMBER_9TH = 0x192;
+static const StringID STR_ORDINAL_NUMBER_10TH = 0x193;
+static const StringID STR_ORDINAL_NUMBER_11TH = 0x194;
+static const StringID STR_ORDINAL_NUMBER_12TH = 0x195;
+static const StringID STR_ORDINAL_NUMBER_13TH = 0x196;
+static const StringID STR_ORDINAL_NUMBER_14TH = 0x197;
+static const StringID STR_ORDINAL_NUMBER_15TH = 0x198;
+static const StringID STR_DAY_NUMBER_1ST = 0x199;
+static const StringID STR_DAY_NUMBER_2ND = 0x19A;
+static const StringID STR_DAY_NUMBER_3RD = 0x19B;
+static const StringID STR_DAY_NUMBER_4TH = 0x19C;
+static const StringID STR_DAY_NUMBER_5TH = 0x19D;
+static const StringID STR_DAY_NUMBER_6TH = 0x19E;
+static const StringID STR_DAY_NUMBER_7TH = 0x19F;
+static const StringID STR_DAY_NUMBER_8TH = 0x1A0;
+static const StringID STR_DAY_NUMBER_9TH = 0x1A1;
+static const StringID STR_DAY_NUMBER_10TH = 0x1A2;
+static const StringID STR_DAY_NUMBER_11TH = 0x1A3;
+static const StringID STR_DAY_NUMBER_12TH = 0x1A4;
+static const StringID STR_DAY_NUMBER_13TH = 0x1A5;
+static const StringID STR_DAY_NUMBER_14TH = 0x1A6;
+static const StringID STR_DAY_NUMBER_15TH = 0x1A7;
+static const StringID STR_DAY_NUMBER_16TH = 0x1A8;
+static const StringID STR_DAY_NUMBER_17TH = 0x1A9;
+static const StringID STR_DAY_NUMBER_18TH = 0x1AA;
+static const StringID STR_DAY_NUMBER_19TH = 0x1AB;
+static const StringID STR_DAY_NUMBER_20TH = 0x1AC;
+static const StringID STR_DAY_NUMBER_21ST = 0x1AD;
+static const StringID STR_DAY_NUMBER_22ND = 0x1AE;
+static const StringID STR_DAY_NUMBER_23RD = 0x1AF;
+static const StringID STR_DAY_NUMBER_24TH = 0x1B0;
+static const StringID STR_DAY_NUMBER_25TH = 0x1B1;
+static const StringID STR_DAY_NUMBER_26TH = 0x1B2;
+static const StringID STR_DAY_NUMBER_27TH = 0x1B3;
+static const StringID STR_DAY_NUMBER_28TH = 0x1B4;
+static const StringID STR_DAY_NUMBER_29TH = 0x1B5;
+static const StringID STR_DAY_NUMBER_30TH = 0x1B6;
+static const StringID STR_DAY_NUMBER_31ST = 0x1B7;
+static const StringID STR_MONTH_ABBREV_JAN = 0x1B8;
+static const StringID STR_MONTH_ABBREV_FEB = 0x1B9;
+static const StringID STR_MONTH_ABBREV_MAR = 0x1BA;
+static const StringID STR_MONTH_ABBREV_APR = 0x1BB;
+static const StringID STR_MONTH_ABBREV_MAY = 0x1BC;
+static const StringID STR_MONTH_ABBREV_JUN = 0x1BD;
+static const StringID STR_MONTH_ABBREV_JUL = 0x1BE;
+static const StringID STR_MONTH_ABBREV_AUG = 0x1BF;
+static const StringID STR_MONTH_ABBREV_SEP = 0x1C0;
+static const StringID STR_MONTH_ABBREV_OCT = 0x1C1;
+static const StringID STR_MONTH_ABBREV_NOV = 0x1C2;
+static const StringID STR_MONTH_ABBREV_DEC = 0x1C3;
+static const StringID STR_MONTH_JAN = 0x1C4;
+static const StringID STR_MONTH_FEB = 0x1C5;
+static const StringID STR_MONTH_MAR = 0x1C6;
+static const StringID STR_MONTH_APR = 0x1C7;
+static const StringID STR_MONTH_MAY = 0x1C8;
+static const StringID STR_MONTH_JUN = 0x1C9;
+static const StringID STR_MONTH_JUL = 0x1CA;
+static const StringID STR_MONTH_AUG = 0x1CB;
+static const StringID STR_MONTH_SEP = 0x1CC;
+static const StringID STR_MONTH_OCT = 0x1CD;
+static const StringID STR_MONTH_NOV = 0x1CE;
+static const StringID STR_MONTH_DEC = 0x1CF;
+static const StringID STR_GRAPH_KEY_BUTTON = 0x1D0;
+static const StringID STR_GRAPH_KEY_TOOLTIP = 0x1D1;
+static const StringID STR_GRAPH_X_LABEL_MONTH = 0x1D2;
+static const StringID STR_GRAPH_X_LABEL_MONTH_YEAR = 0x1D3;
+static const StringID STR_GRAPH_Y_LABEL = 0x1D4;
+static const StringID STR_GRAPH_Y_LABEL_NUMBER = 0x1D5;
+static const StringID STR_GRAPH_OPERATING_PROFIT_CAPTION = 0x1D6;
+static const StringID STR_GRAPH_INCOME_CAPTION = 0x1D7;
+static const StringID STR_GRAPH_CARGO_DELIVERED_CAPTION = 0x1D8;
+static const StringID STR_GRAPH_COMPANY_PERFORMANCE_RATINGS_CAPTION = 0x1D9;
+static const StringID STR_GRAPH_COMPANY_VALUES_CAPTION = 0x1DA;
+static const StringID STR_GRAPH_CARGO_PAYMENT_RATES_CAPTION = 0x1DB;
+static const StringID STR_GRAPH_CARGO_PAYMENT_RATES_X_LABEL = 0x1DC;
+static const StringID STR_GRAPH_CARGO_PAYMENT_RATES_TITLE = 0x1DD;
+static const StringID STR_GRAPH_CARGO_ENABLE_ALL = 0x1DE;
+static const StringID STR_GRAPH_CARGO_DISABLE_ALL = 0x1DF;
+static const StringID STR_GRAPH_CARGO_TOOLTIP_ENABLE_ALL = 0x1E0;
+static const StringID STR_GRAPH_CARGO_TOOLTIP_DISABLE_ALL = 0x1E1;
+static const StringID STR_GRAPH_CARGO_PAYMENT_TOGGLE_CARGO = 0x1E2;
+static const StringID STR_GRAPH_CARGO_PAYMENT_CARGO = 0x1E3;
+static const StringID STR_GRAPH_PERFORMANCE_DETAIL_TOOLTIP = 0x1E4;
+static const StringID STR_GRAPH_KEY_CAPTION = 0x1E5;
+static const StringID STR_GRAPH_KEY_COMPANY_SELECTION_TOOLTIP = 0x1E6;
+static const StringID STR_COMPANY_LEAGUE_TABLE_CAPTION = 0x1E7;
+static const StringID STR_COMPANY_LEAGUE_COMPANY_NAME = 0x1E8;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_ENGINEER = 0x1E9;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_TRAFFIC_MANAGER = 0x1EA;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_TRANSPORT_COORDINATOR = 0x1EB;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_ROUTE_SUPERVISOR = 0x1EC;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_DIRECTOR = 0x1ED;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_CHIEF_EXECUTIVE = 0x1EE;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_CHAIRMAN = 0x1EF;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_PRESIDENT = 0x1F0;
+static const StringID STR_COMPANY_LEAGUE_PERFORMANCE_TITLE_TYCOON = 0x1F1;
+static const StringID STR_PERFORMANCE_DETAIL = 0x1F2;
+static const StringID STR_PERFORMANCE_DETAIL_KEY = 0x1F3;
+static const StringID STR_PERFORMANCE_DETAIL_AMOUNT_CURRENCY = 0x1F4;
+static const StringID STR_PERFORMANCE_DETAIL_AMOUNT_INT = 0x1F5;
+static const StringID STR_PERFORMANCE_DETAIL_PERCENT = 0x1F6;
+static const StringID STR_PERFORMANCE_DETAIL_SELECT_COMPANY_TOOLTIP = 0x1F7;
+static const StringID STR_PERFORMANCE_DETAIL_VEHICLES = 0x1F8;
+static const StringID STR_PERFORMANCE_DETAIL_STATIONS = 0x1F9;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_PROFIT = 0x1FA;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_INCOME = 0x1FB;
+static const StringID STR_PERFORMANCE_DETAIL_MAX_INCOME = 0x1FC;
+static const StringID STR_PERFORMANCE_DETAIL_DELIVERED = 0x1FD;
+static const StringID STR_PERFORMANCE_DETAIL_CARGO = 0x1FE;
+static const StringID STR_PERFORMANCE_DETAIL_MONEY = 0x1FF;
+static const StringID STR_PERFORMANCE_DETAIL_LOAN = 0x200;
+static const StringID STR_PERFORMANCE_DETAIL_TOTAL = 0x201;
+static const StringID STR_PERFORMANCE_DETAIL_VEHICLES_TOOLTIP = 0x202;
+static const StringID STR_PERFORMANCE_DETAIL_STATIONS_TOOLTIP = 0x203;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_PROFIT_TOOLTIP = 0x204;
+static const StringID STR_PERFORMANCE_DETAIL_MIN_INCOME_TOOLTIP = 0x205;
+static const StringID STR_PERFORMANCE_DETAIL_MAX_INCOME_TOOLTIP = 0x206;
+static const StringID STR_PERFORMANCE_DETAIL_DELIVERED_TOOLTIP = 0x207;
+static const StringID STR_PERFORMANCE_DETAIL_CARGO_TOOLTIP = 0x208;
+static const StringID STR_PERFORMANCE_DETAIL_MONEY_TOOLTIP = 0x209;
+static const StringID STR_PERFORMANCE_DETAIL_LOAN_TOOLTIP = 0x20A;
+static const StringID STR_PERFORMANCE_DETAIL_TOTAL_TOOLTIP = 0x20B;
+static const StringID STR_MUSIC_JAZZ_JUKEBOX_CAPTION = 0x20C;
+static const StringID STR_MUSIC_PLAYLIST_ALL = 0x20D;
+static const StringID STR_MUSIC_PLAYLIST_OLD_STYLE = 0x20E;
+static const StringID STR_MUSIC_PLAYLIST_NEW_STYLE = 0x20F;
+static const StringID STR_MUSIC_PLAYLIST_EZY_STREET = 0x210;
+static const StringID STR_MUSIC_PLAYLIST_CUSTOM_1 = 0x211;
+static const StringID STR_MUSIC_PLAYLIST_CUSTOM_2 = 0x212;
+static const StringID STR_MUSIC_MUSIC_VOLUME = 0x213;
+static const StringID STR_MUSIC_EFFECTS_VOLUME = 0x214;
+static const StringID STR_MUSIC_TRACK_NONE = 0x215;
+static const StringID STR_MUSIC_TRACK_DIGIT = 0x216;
+static const StringID STR_MUSIC_TITLE_NONE = 0x217;
+static const StringID STR_MUSIC_TITLE_NOMUSIC = 0x218;
+static const StringID STR_MUSIC_TITLE_NAME = 0x219;
+static const StringID STR_MUSIC_TRACK = 0x21A;
+static const StringID STR_MUSIC_XTITLE = 0x21B;
+static const StringID STR_MUSIC_SHUFFLE = 0x21C;
+static const StringID STR_MUSIC_PROGRAM = 0x21D;
+static const StringID STR_MUSIC_TOOLTIP_SKIP_TO_PREVIOUS_TRACK = 0x21E;
+static const StringID STR_MUSIC_TOOLTIP_SKIP_TO_NEXT_TRACK_IN_SELECTION = 0x21F;
+static const StringID STR_MUSIC_TOOLTIP_STOP_PLAYING_MUSIC = 0x220;
+static const StringID STR_MUSIC_TOOLTIP_START_PLAYING_MUSIC = 0x221;
+static const StringID STR_MUSIC_TOOLTIP_DRAG_SLIDERS_TO_SET_MUSIC = 0x222;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_ALL_TRACKS_PROGRAM = 0x223;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_OLD_STYLE_MUSIC = 0x224;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_NEW_STYLE_MUSIC = 0x225;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_EZY_STREET_STYLE = 0x226;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_CUSTOM_1_USER_DEFINED = 0x227;
+static const StringID STR_MUSIC_TOOLTIP_SELECT_CUSTOM_2_USER_DEFINED = 0x228;
+static const StringID STR_MUSIC_TOOLTIP_TOGGLE_PROGRAM_SHUFFLE = 0x229;
+static const StringID STR_MUSIC_TOOLTIP_SHOW_MUSIC_TRACK_SELECTION = 0x22A;
+static const StringID STR_PLAYLIST_MUSIC_SELECTION_SETNAME = 0x22B;
+static const StringID STR_PLAYLIST_TRACK_NAME = 0x22C;
+static const StringID STR_PLAYLIST_TRACK_INDEX = 0x22D;
+static const StringID STR_PLAYLIST_PROGRAM = 0x22E;
+static const StringID STR_PLAYLIST_CLEAR = 0x22F;
+static const StringID STR_PLAYLIST_CHANGE_SET = 0x230;
+static const StringID STR_PLAYLIST_TOOLTIP_CLEAR_CURRENT_PROGRAM_CUSTOM1 = 0x231;
+static const StringID STR_PLAYLIST_TOOLTIP_CHANGE_SET = 0x232;
+static const StringID STR_PLAYLIST_TOOLTIP_CLICK_TO_ADD_TRACK = 0x233;
+static const StringID STR_PLAYLIST_TOOLTIP_CLICK_TO_REMOVE_TRACK = 0x234;
+static const StringID STR_HIGHSCORE_TOP_COMPANIES_WHO_REACHED = 0x235;
+static const StringID STR_HIGHSCORE_TOP_COMPANIES_NETWORK_GAME = 0x236;
+static const StringID STR_HIGHSCORE_POSITION = 0x237;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_BUSINESSMAN = 0x238;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_ENTREPRENEUR = 0x239;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_INDUSTRIALIST = 0x23A;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_CAPITALIST = 0x23B;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_MAGNATE = 0x23C;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_MOGUL = 0x23D;
+static const StringID STR_HIGHSCORE_PERFORMANCE_TITLE_TYCOON_OF_THE_CENTURY = 0x23E;
+static const StringID STR_HIGHSCORE_NAME = 0x23F;
+static const StringID STR_HIGHSCORE_STATS = 0x240;
+static const StringID STR_HIGHSCORE_COMPANY_ACHIEVES_STATUS = 0x241;
+static const StringID STR_HIGHSCORE_PRESIDENT_OF_COMPANY_ACHIEVES_STATUS = 0x242;
+static const StringID STR_SMALLMAP_CAPTION = 0x243;
+static const StringID STR_SMALLMAP_TYPE_CONTOURS = 0x244;
+static const StringID STR_SMALLMAP_TYPE_VEHICLES = 0x245;
+static const StringID STR_SMALLMAP_TYPE_INDUSTRIES = 0x246;
+static const StringID STR_SMALLMAP_TYPE_ROUTEMAP = 0x247;
+static const StringID STR_SMALLMAP_TYPE_ROUTES = 0x248;
+static const StringID STR_SMALLMAP_TYPE_VEGETATION = 0x249;
+static const StringID STR_SMALLMAP_TYPE_OWNERS = 0x24A;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_LAND_CONTOURS_ON_MAP = 0x24B;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_VEHICLES_ON_MAP = 0x24C;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_INDUSTRIES_ON_MAP = 0x24D;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_LINK_STATS_ON_MAP = 0x24E;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_TRANSPORT_ROUTES_ON = 0x24F;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_VEGETATION_ON_MAP = 0x250;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_LAND_OWNERS_ON_MAP = 0x251;
+static const StringID STR_SMALLMAP_TOOLTIP_INDUSTRY_SELECTION = 0x252;
+static const StringID STR_SMALLMAP_TOOLTIP_COMPANY_SELECTION = 0x253;
+static const StringID STR_SMALLMAP_TOOLTIP_CARGO_SELECTION = 0x254;
+static const StringID STR_SMALLMAP_LEGENDA_ROADS = 0x255;
+static const StringID STR_SMALLMAP_LEGENDA_RAILROADS = 0x256;
+static const StringID STR_SMALLMAP_LEGENDA_STATIONS_AIRPORTS_DOCKS = 0x257;
+static const StringID STR_SMALLMAP_LEGENDA_BUILDINGS_INDUSTRIES = 0x258;
+static const StringID STR_SMALLMAP_LEGENDA_VEHICLES = 0x259;
+static const StringID STR_SMALLMAP_LEGENDA_TRAINS = 0x25A;
+static const StringID STR_SMALLMAP_LEGENDA_ROAD_VEHICLES = 0x25B;
+static const StringID STR_SMALLMAP_LEGENDA_SHIPS = 0x25C;
+static const StringID STR_SMALLMAP_LEGENDA_AIRCRAFT = 0x25D;
+static const StringID STR_SMALLMAP_LEGENDA_TRANSPORT_ROUTES = 0x25E;
+static const StringID STR_SMALLMAP_LEGENDA_FOREST = 0x25F;
+static const StringID STR_SMALLMAP_LEGENDA_RAILROAD_STATION = 0x260;
+static const StringID STR_SMALLMAP_LEGENDA_TRUCK_LOADING_BAY = 0x261;
+static const StringID STR_SMALLMAP_LEGENDA_BUS_STATION = 0x262;
+static const StringID STR_SMALLMAP_LEGENDA_AIRPORT_HELIPORT = 0x263;
+static const StringID STR_SMALLMAP_LEGENDA_DOCK = 0x264;
+static const StringID STR_SMALLMAP_LEGENDA_ROUGH_LAND = 0x265;
+static const StringID STR_SMALLMAP_LEGENDA_GRASS_LAND = 0x266;
+static const StringID STR_SMALLMAP_LEGENDA_BARE_LAND = 0x267;
+static const StringID STR_SMALLMAP_LEGENDA_RAINFOREST = 0x268;
+static const StringID STR_SMALLMAP_LEGENDA_FIELDS = 0x269;
+static const StringID STR_SMALLMAP_LEGENDA_TREES = 0x26A;
+static const StringID STR_SMALLMAP_LEGENDA_ROCKS = 0x26B;
+static const StringID STR_SMALLMAP_LEGENDA_WATER = 0x26C;
+static const StringID STR_SMALLMAP_LEGENDA_NO_OWNER = 0x26D;
+static const StringID STR_SMALLMAP_LEGENDA_TOWNS = 0x26E;
+static const StringID STR_SMALLMAP_LEGENDA_INDUSTRIES = 0x26F;
+static const StringID STR_SMALLMAP_LEGENDA_DESERT = 0x270;
+static const StringID STR_SMALLMAP_LEGENDA_SNOW = 0x271;
+static const StringID STR_SMALLMAP_TOOLTIP_TOGGLE_TOWN_NAMES_ON_OFF = 0x272;
+static const StringID STR_SMALLMAP_CENTER = 0x273;
+static const StringID STR_SMALLMAP_INDUSTRY = 0x274;
+static const StringID STR_SMALLMAP_LINKSTATS = 0x275;
+static const StringID STR_SMALLMAP_COMPANY = 0x276;
+static const StringID STR_SMALLMAP_TOWN = 0x277;
+static const StringID STR_SMALLMAP_DISABLE_ALL = 0x278;
+static const StringID STR_SMALLMAP_ENABLE_ALL = 0x279;
+static const StringID STR_SMALLMAP_SHOW_HEIGHT = 0x27A;
+static const StringID STR_SMALLMAP_TOOLTIP_DISABLE_ALL_INDUSTRIES = 0x27B;
+static const StringID STR_SMALLMAP_TOOLTIP_ENABLE_ALL_INDUSTRIES = 0x27C;
+static const StringID STR_SMALLMAP_TOOLTIP_SHOW_HEIGHT = 0x27D;
+static const StringID STR_SMALLMAP_TOOLTIP_DISABLE_ALL_COMPANIES = 0x27E;
+static const StringID STR_SMALLMAP_TOOLTIP_ENABLE_ALL_COMPANIES = 0x27F;
+static const StringID STR_SMALLMAP_TOOLTIP_DISABLE_ALL_CARGOS = 0x280;
+static const StringID STR_SMALLMAP_TOOLTIP_ENABLE_ALL_CARGOS = 0x281;
+static const StringID STR_STATUSBAR_TOOLTIP_SHOW_LAST_NEWS = 0x282;
+static const StringID STR_STATUSBAR_COMPANY_NAME = 0x283;
+static const StringID STR_STATUSBAR_PAUSED = 0x284;
+static const StringID STR_STATUSBAR_PAUSED_LINK_GRAPH = 0x285;
+static const StringID STR_STATUSBAR_AUTOSAVE = 0x286;
+static const StringID STR_STATUSBAR_SAVING_GAME = 0x287;
+static const StringID STR_STATUSBAR_SPECTATOR = 0x288;
+static const StringID STR_MESSAGE_HISTORY = 0x289;
+static const StringID STR_MESSAGE_HISTORY_TOOLTIP = 0x28A;
+static const StringID STR_MESSAGE_NEWS_FORMAT = 0x28B;
+static const StringID STR_NEWS_MESSAGE_CAPTION = 0x28C;
+static const StringID STR_NEWS_CUSTOM_ITEM = 0x28D;
+static const StringID STR_NEWS_FIRST_TRAIN_ARRIVAL = 0x28E;
+static const StringID STR_NEWS_FIRST_BUS_ARRIVAL = 0x28F;
+static const StringID STR_NEWS_FIRST_TRUCK_ARRIVAL = 0x290;
+static const StringID STR_NEWS_FIRST_PASSENGER_TRAM_ARRIVAL = 0x291;
+static const StringID STR_NEWS_FIRST_CARGO_TRAM_ARRIVAL = 0x292;
+static const StringID STR_NEWS_FIRST_SHIP_ARRIVAL = 0x293;
+static const StringID STR_NEWS_FIRST_AIRCRAFT_ARRIVAL = 0x294;
+static const StringID STR_NEWS_TRAIN_CRASH = 0x295;
+static const StringID STR_NEWS_ROAD_VEHICLE_CRASH_DRIVER = 0x296;
+static const StringID STR_NEWS_ROAD_VEHICLE_CRASH = 0x297;
+static const StringID STR_NEWS_AIRCRAFT_CRASH = 0x298;
+static const StringID STR_NEWS_PLANE_CRASH_OUT_OF_FUEL = 0x299;
+static const StringID STR_NEWS_DISASTER_ZEPPELIN = 0x29A;
+static const StringID STR_NEWS_DISASTER_SMALL_UFO = 0x29B;
+static const StringID STR_NEWS_DISASTER_AIRPLANE_OIL_REFINERY = 0x29C;
+static const StringID STR_NEWS_DISASTER_HELICOPTER_FACTORY = 0x29D;
+static const StringID STR_NEWS_DISASTER_BIG_UFO = 0x29E;
+static const StringID STR_NEWS_DISASTER_COAL_MINE_SUBSIDENCE = 0x29F;
+static const StringID STR_NEWS_DISASTER_FLOOD_VEHICLE = 0x2A0;
+static const StringID STR_NEWS_COMPANY_IN_TROUBLE_TITLE = 0x2A1;
+static const StringID STR_NEWS_COMPANY_IN_TROUBLE_DESCRIPTION = 0x2A2;
+static const StringID STR_NEWS_COMPANY_MERGER_TITLE = 0x2A3;
+static const StringID STR_NEWS_COMPANY_MERGER_DESCRIPTION = 0x2A4;
+static const StringID STR_NEWS_COMPANY_BANKRUPT_TITLE = 0x2A5;
+static const StringID STR_NEWS_COMPANY_BANKRUPT_DESCRIPTION = 0x2A6;
+static const StringID STR_NEWS_COMPANY_LAUNCH_TITLE = 0x2A7;
+static const StringID STR_NEWS_COMPANY_LAUNCH_DESCRIPTION = 0x2A8;
+static const StringID STR_NEWS_MERGER_TAKEOVER_TITLE = 0x2A9;
+static const StringID STR_PRESIDENT_NAME_MANAGER = 0x2AA;
+static const StringID STR_NEWS_NEW_TOWN = 0x2AB;
+static const StringID STR_NEWS_NEW_TOWN_UNSPONSORED = 0x2AC;
+static const StringID STR_NEWS_INDUSTRY_CONSTRUCTION = 0x2AD;
+static const StringID STR_NEWS_INDUSTRY_PLANTED = 0x2AE;
+static const StringID STR_NEWS_INDUSTRY_CLOSURE_GENERAL = 0x2AF;
+static const StringID STR_NEWS_INDUSTRY_CLOSURE_SUPPLY_PROBLEMS = 0x2B0;
+static const StringID STR_NEWS_INDUSTRY_CLOSURE_LACK_OF_TREES = 0x2B1;
+static const StringID STR_NEWS_EURO_INTRODUCTION = 0x2B2;
+static const StringID STR_NEWS_BEGIN_OF_RECESSION = 0x2B3;
+static const StringID STR_NEWS_END_OF_RECESSION = 0x2B4;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_GENERAL = 0x2B5;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_COAL = 0x2B6;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_OIL = 0x2B7;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_FARM = 0x2B8;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_SMOOTH = 0x2B9;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_DECREASE_GENERAL = 0x2BA;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_DECREASE_FARM = 0x2BB;
+static const StringID STR_NEWS_INDUSTRY_PRODUCTION_DECREASE_SMOOTH = 0x2BC;
+static const StringID STR_NEWS_TRAIN_IS_WAITING = 0x2BD;
+static const StringID STR_NEWS_ROAD_VEHICLE_IS_WAITING = 0x2BE;
+static const StringID STR_NEWS_SHIP_IS_WAITING = 0x2BF;
+static const StringID STR_NEWS_AIRCRAFT_IS_WAITING = 0x2C0;
+static const StringID STR_NEWS_VEHICLE_HAS_TOO_FEW_ORDERS = 0x2C1;
+static const StringID STR_NEWS_VEHICLE_HAS_VOID_ORDER = 0x2C2;
+static const StringID STR_NEWS_VEHICLE_HAS_DUPLICATE_ENTRY = 0x2C3;
+static const StringID STR_NEWS_VEHICLE_HAS_INVALID_ENTRY = 0x2C4;
+static const StringID STR_NEWS_PLANE_USES_TOO_SHORT_RUNWAY = 0x2C5;
+static const StringID STR_NEWS_VEHICLE_IS_GETTING_OLD = 0x2C6;
+static const StringID STR_NEWS_VEHICLE_IS_GETTING_VERY_OLD = 0x2C7;
+static const StringID STR_NEWS_VEHICLE_IS_GETTING_VERY_OLD_AND = 0x2C8;
+static const StringID STR_NEWS_TRAIN_IS_STUCK = 0x2C9;
+static const StringID STR_NEWS_VEHICLE_IS_LOST = 0x2CA;
+static const StringID STR_NEWS_VEHICLE_IS_UNPROFITABLE = 0x2CB;
+static const StringID STR_NEWS_AIRCRAFT_DEST_TOO_FAR = 0x2CC;
+static const StringID STR_NEWS_ORDER_REFIT_FAILED = 0x2CD;
+static const StringID STR_NEWS_VEHICLE_AUTORENEW_FAILED = 0x2CE;
+static const StringID STR_NEWS_NEW_VEHICLE_NOW_AVAILABLE = 0x2CF;
+static const StringID STR_NEWS_NEW_VEHICLE_TYPE = 0x2D0;
+static const StringID STR_NEWS_NEW_VEHICLE_NOW_AVAILABLE_WITH_TYPE = 0x2D1;
+static const StringID STR_NEWS_SHOW_VEHICLE_GROUP_TOOLTIP = 0x2D2;
+static const StringID STR_NEWS_STATION_NO_LONGER_ACCEPTS_CARGO = 0x2D3;
+static const StringID STR_NEWS_STATION_NO_LONGER_ACCEPTS_CARGO_OR_CARGO = 0x2D4;
+static const StringID STR_NEWS_STATION_NOW_ACCEPTS_CARGO = 0x2D5;
+static const StringID STR_NEWS_STATION_NOW_ACCEPTS_CARGO_AND_CARGO = 0x2D6;
+static const StringID STR_NEWS_OFFER_OF_SUBSIDY_EXPIRED = 0x2D7;
+static const StringID STR_NEWS_SUBSIDY_WITHDRAWN_SERVICE = 0x2D8;
+static const StringID STR_NEWS_SERVICE_SUBSIDY_OFFERED = 0x2D9;
+static const StringID STR_NEWS_SERVICE_SUBSIDY_AWARDED_HALF = 0x2DA;
+static const StringID STR_NEWS_SERVICE_SUBSIDY_AWARDED_DOUBLE = 0x2DB;
+static const StringID STR_NEWS_SERVICE_SUBSIDY_AWARDED_TRIPLE = 0x2DC;
+static const StringID STR_NEWS_SERVICE_SUBSIDY_AWARDED_QUADRUPLE = 0x2DD;
+static const StringID STR_NEWS_ROAD_REBUILDING = 0x2DE;
+static const StringID STR_NEWS_EXCLUSIVE_RIGHTS_TITLE = 0x2DF;
+static const StringID STR_NEWS_EXCLUSIVE_RIGHTS_DESCRIPTION = 0x2E0;
+static const StringID STR_EXTRA_VIEWPORT_TITLE = 0x2E1;
+static const StringID STR_EXTRA_VIEW_MOVE_VIEW_TO_MAIN = 0x2E2;
+static const StringID STR_EXTRA_VIEW_MOVE_VIEW_TO_MAIN_TT = 0x2E3;
+static const StringID STR_EXTRA_VIEW_MOVE_MAIN_TO_VIEW = 0x2E4;
+static const StringID STR_EXTRA_VIEW_MOVE_MAIN_TO_VIEW_TT = 0x2E5;
+static const StringID STR_GAME_OPTIONS_CAPTION = 0x2E6;
+static const StringID STR_GAME_OPTIONS_CURRENCY_UNITS_FRAME = 0x2E7;
+static const StringID STR_GAME_OPTIONS_CURRENCY_UNITS_DROPDOWN_TOOLTIP = 0x2E8;
+static const StringID STR_GAME_OPTIONS_CURRENCY_GBP = 0x2E9;
+static const StringID STR_GAME_OPTIONS_CURRENCY_USD = 0x2EA;
+static const StringID STR_GAME_OPTIONS_CURRENCY_EUR = 0x2EB;
+static const StringID STR_GAME_OPTIONS_CURRENCY_JPY = 0x2EC;
+static const StringID STR_GAME_OPTIONS_CURRENCY_ATS = 0x2ED;
+static const StringID STR_GAME_OPTIONS_CURRENCY_BEF = 0x2EE;
+static const StringID STR_GAME_OPTIONS_CURRENCY_CHF = 0x2EF;
+static const StringID STR_GAME_OPTIONS_CURRENCY_CZK = 0x2F0;
+static const StringID STR_GAME_OPTIONS_CURRENCY_DEM = 0x2F1;
+static const StringID STR_GAME_OPTIONS_CURRENCY_DKK = 0x2F2;
+static const StringID STR_GAME_OPTIONS_CURRENCY_ESP = 0x2F3;
+static const StringID STR_GAME_OPTIONS_CURRENCY_FIM = 0x2F4;
+static const StringID STR_GAME_OPTIONS_CURRENCY_FRF = 0x2F5;
+static const StringID STR_GAME_OPTIONS_CURRENCY_GRD = 0x2F6;
+static const StringID STR_GAME_OPTIONS_CURRENCY_HUF = 0x2F7;
+static const StringID STR_GAME_OPTIONS_CURRENCY_ISK = 0x2F8;
+static const StringID STR_GAME_OPTIONS_CURRENCY_ITL = 0x2F9;
+static const StringID STR_GAME_OPTIONS_CURRENCY_NLG = 0x2FA;
+static const StringID STR_GAME_OPTIONS_CURRENCY_NOK = 0x2FB;
+static const StringID STR_GAME_OPTIONS_CURRENCY_PLN = 0x2FC;
+static const StringID STR_GAME_OPTIONS_CURRENCY_RON = 0x2FD;
+static const StringID STR_GAME_OPTIONS_CURRENCY_RUR = 0x2FE;
+static const StringID STR_GAME_OPTIONS_CURRENCY_SIT = 0x2FF;
+static const StringID STR_GAME_OPTIONS_CURRENCY_SEK = 0x300;
+static const StringID STR_GAME_OPTIONS_CURRENCY_TRY = 0x301;
+static const StringID STR_GAME_OPTIONS_CURRENCY_SKK = 0x302;
+static const StringID STR_GAME_OPTIONS_CURRENCY_BRL = 0x303;
+static const StringID STR_GAME_OPTIONS_CURRENCY_EEK = 0x304;
+static const StringID STR_GAME_OPTIONS_CURRENCY_LTL = 0x305;
+static const StringID STR_GAME_OPTIONS_CURRENCY_KRW = 0x306;
+static const StringID STR_GAME_OPTIONS_CURRENCY_ZAR = 0x307;
+static const StringID STR_GAME_OPTIONS_CURRENCY_CUSTOM = 0x308;
+static const StringID STR_GAME_OPTIONS_CURRENCY_GEL = 0x309;
+static const StringID STR_GAME_OPTIONS_CURRENCY_IRR = 0x30A;
+static const StringID STR_GAME_OPTIONS_CURRENCY_RUB = 0x30B;
+static const StringID STR_GAME_OPTIONS_CURRENCY_MXN = 0x30C;
+static const StringID STR_GAME_OPTIONS_CURRENCY_NTD = 0x30D;
+static const StringID STR_GAME_OPTIONS_CURRENCY_CNY = 0x30E;
+static const StringID STR_GAME_OPTIONS_CURRENCY_HKD = 0x30F;
+static const StringID STR_GAME_OPTIONS_CURRENCY_INR = 0x310;
+static const StringID STR_GAME_OPTIONS_CURRENCY_IDR = 0x311;
+static const StringID STR_GAME_OPTIONS_CURRENCY_MYR = 0x312;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_FRAME = 0x313;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_TOOLTIP = 0x314;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_OFF = 0x315;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_1_MONTH = 0x316;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_3_MONTHS = 0x317;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_6_MONTHS = 0x318;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_12_MONTHS = 0x319;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_DAYS_CUSTOM_LABEL = 0x31A;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_MINUTES_CUSTOM_LABEL = 0x31B;
+static const StringID STR_GAME_OPTIONS_LANGUAGE = 0x31C;
+static const StringID STR_GAME_OPTIONS_LANGUAGE_TOOLTIP = 0x31D;
+static const StringID STR_GAME_OPTIONS_LANGUAGE_PERCENTAGE = 0x31E;
+static const StringID STR_GAME_OPTIONS_FULLSCREEN = 0x31F;
+static const StringID STR_GAME_OPTIONS_FULLSCREEN_TOOLTIP = 0x320;
+static const StringID STR_GAME_OPTIONS_RESOLUTION = 0x321;
+static const StringID STR_GAME_OPTIONS_RESOLUTION_TOOLTIP = 0x322;
+static const StringID STR_GAME_OPTIONS_RESOLUTION_OTHER = 0x323;
+static const StringID STR_GAME_OPTIONS_RESOLUTION_ITEM = 0x324;
+static const StringID STR_GAME_OPTIONS_VIDEO_ACCELERATION = 0x325;
+static const StringID STR_GAME_OPTIONS_VIDEO_ACCELERATION_TOOLTIP = 0x326;
+static const StringID STR_GAME_OPTIONS_VIDEO_ACCELERATION_RESTART = 0x327;
+static const StringID STR_GAME_OPTIONS_VIDEO_VSYNC = 0x328;
+static const StringID STR_GAME_OPTIONS_VIDEO_VSYNC_TOOLTIP = 0x329;
+static const StringID STR_GAME_OPTIONS_VIDEO_DRIVER_INFO = 0x32A;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_FRAME = 0x32B;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_TOOLTIP = 0x32C;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_AUTO = 0x32D;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_AUTO_TOOLTIP = 0x32E;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_BEVELS = 0x32F;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_BEVELS_TOOLTIP = 0x330;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_1X = 0x331;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_2X = 0x332;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_3X = 0x333;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_4X = 0x334;
+static const StringID STR_GAME_OPTIONS_GUI_SCALE_5X = 0x335;
+static const StringID STR_GAME_OPTIONS_GRAPHICS = 0x336;
+static const StringID STR_GAME_OPTIONS_REFRESH_RATE = 0x337;
+static const StringID STR_GAME_OPTIONS_REFRESH_RATE_TOOLTIP = 0x338;
+static const StringID STR_GAME_OPTIONS_REFRESH_RATE_ITEM = 0x339;
+static const StringID STR_GAME_OPTIONS_REFRESH_RATE_WARNING = 0x33A;
+static const StringID STR_GAME_OPTIONS_BASE_GRF = 0x33B;
+static const StringID STR_GAME_OPTIONS_BASE_GRF_TOOLTIP = 0x33C;
+static const StringID STR_GAME_OPTIONS_BASE_GRF_STATUS = 0x33D;
+static const StringID STR_GAME_OPTIONS_BASE_GRF_DESCRIPTION_TOOLTIP = 0x33E;
+static const StringID STR_GAME_OPTIONS_BASE_SFX = 0x33F;
+static const StringID STR_GAME_OPTIONS_BASE_SFX_TOOLTIP = 0x340;
+static const StringID STR_GAME_OPTIONS_BASE_SFX_DESCRIPTION_TOOLTIP = 0x341;
+static const StringID STR_GAME_OPTIONS_BASE_MUSIC = 0x342;
+static const StringID STR_GAME_OPTIONS_BASE_MUSIC_TOOLTIP = 0x343;
+static const StringID STR_GAME_OPTIONS_BASE_MUSIC_STATUS = 0x344;
+static const StringID STR_GAME_OPTIONS_BASE_MUSIC_DESCRIPTION_TOOLTIP = 0x345;
+static const StringID STR_ERROR_RESOLUTION_LIST_FAILED = 0x346;
+static const StringID STR_ERROR_FULLSCREEN_FAILED = 0x347;
+static const StringID STR_CURRENCY_WINDOW = 0x348;
+static const StringID STR_CURRENCY_EXCHANGE_RATE = 0x349;
+static const StringID STR_CURRENCY_DECREASE_EXCHANGE_RATE_TOOLTIP = 0x34A;
+static const StringID STR_CURRENCY_INCREASE_EXCHANGE_RATE_TOOLTIP = 0x34B;
+static const StringID STR_CURRENCY_SET_EXCHANGE_RATE_TOOLTIP = 0x34C;
+static const StringID STR_CURRENCY_SEPARATOR = 0x34D;
+static const StringID STR_CURRENCY_SET_CUSTOM_CURRENCY_SEPARATOR_TOOLTIP = 0x34E;
+static const StringID STR_CURRENCY_PREFIX = 0x34F;
+static const StringID STR_CURRENCY_SET_CUSTOM_CURRENCY_PREFIX_TOOLTIP = 0x350;
+static const StringID STR_CURRENCY_SUFFIX = 0x351;
+static const StringID STR_CURRENCY_SET_CUSTOM_CURRENCY_SUFFIX_TOOLTIP = 0x352;
+static const StringID STR_CURRENCY_SWITCH_TO_EURO = 0x353;
+static const StringID STR_CURRENCY_SWITCH_TO_EURO_NEVER = 0x354;
+static const StringID STR_CURRENCY_SET_CUSTOM_CURRENCY_TO_EURO_TOOLTIP = 0x355;
+static const StringID STR_CURRENCY_DECREASE_CUSTOM_CURRENCY_TO_EURO_TOOLTIP = 0x356;
+static const StringID STR_CURRENCY_INCREASE_CUSTOM_CURRENCY_TO_EURO_TOOLTIP = 0x357;
+static const StringID STR_CURRENCY_PREVIEW = 0x358;
+static const StringID STR_CURRENCY_CUSTOM_CURRENCY_PREVIEW_TOOLTIP = 0x359;
+static const StringID STR_CURRENCY_CHANGE_PARAMETER = 0x35A;
+static const StringID STR_NONE = 0x35B;
+static const StringID STR_FUNDING_ONLY = 0x35C;
+static const StringID STR_MINIMAL = 0x35D;
+static const StringID STR_NUM_VERY_LOW = 0x35E;
+static const StringID STR_NUM_LOW = 0x35F;
+static const StringID STR_NUM_NORMAL = 0x360;
+static const StringID STR_NUM_HIGH = 0x361;
+static const StringID STR_NUM_CUSTOM = 0x362;
+static const StringID STR_NUM_CUSTOM_NUMBER = 0x363;
+static const StringID STR_VARIETY_NONE = 0x364;
+static const StringID STR_VARIETY_VERY_LOW = 0x365;
+static const StringID STR_VARIETY_LOW = 0x366;
+static const StringID STR_VARIETY_MEDIUM = 0x367;
+static const StringID STR_VARIETY_HIGH = 0x368;
+static const StringID STR_VARIETY_VERY_HIGH = 0x369;
+static const StringID STR_AI_SPEED_VERY_SLOW = 0x36A;
+static const StringID STR_AI_SPEED_SLOW = 0x36B;
+static const StringID STR_AI_SPEED_MEDIUM = 0x36C;
+static const StringID STR_AI_SPEED_FAST = 0x36D;
+static const StringID STR_AI_SPEED_VERY_FAST = 0x36E;
+static const StringID STR_SEA_LEVEL_VERY_LOW = 0x36F;
+static const StringID STR_SEA_LEVEL_LOW = 0x370;
+static const StringID STR_SEA_LEVEL_MEDIUM = 0x371;
+static const StringID STR_SEA_LEVEL_HIGH = 0x372;
+static const StringID STR_SEA_LEVEL_CUSTOM = 0x373;
+static const StringID STR_SEA_LEVEL_CUSTOM_PERCENTAGE = 0x374;
+static const StringID STR_RIVERS_NONE = 0x375;
+static const StringID STR_RIVERS_FEW = 0x376;
+static const StringID STR_RIVERS_MODERATE = 0x377;
+static const StringID STR_RIVERS_LOT = 0x378;
+static const StringID STR_DISASTER_NONE = 0x379;
+static const StringID STR_DISASTER_REDUCED = 0x37A;
+static const StringID STR_DISASTER_NORMAL = 0x37B;
+static const StringID STR_SUBSIDY_X1_5 = 0x37C;
+static const StringID STR_SUBSIDY_X2 = 0x37D;
+static const StringID STR_SUBSIDY_X3 = 0x37E;
+static const StringID STR_SUBSIDY_X4 = 0x37F;
+static const StringID STR_CLIMATE_TEMPERATE_LANDSCAPE = 0x380;
+static const StringID STR_CLIMATE_SUB_ARCTIC_LANDSCAPE = 0x381;
+static const StringID STR_CLIMATE_SUB_TROPICAL_LANDSCAPE = 0x382;
+static const StringID STR_CLIMATE_TOYLAND_LANDSCAPE = 0x383;
+static const StringID STR_TERRAIN_TYPE_VERY_FLAT = 0x384;
+static const StringID STR_TERRAIN_TYPE_FLAT = 0x385;
+static const StringID STR_TERRAIN_TYPE_HILLY = 0x386;
+static const StringID STR_TERRAIN_TYPE_MOUNTAINOUS = 0x387;
+static const StringID STR_TERRAIN_TYPE_ALPINIST = 0x388;
+static const StringID STR_TERRAIN_TYPE_CUSTOM = 0x389;
+static const StringID STR_TERRAIN_TYPE_CUSTOM_VALUE = 0x38A;
+static const StringID STR_CITY_APPROVAL_LENIENT = 0x38B;
+static const StringID STR_CITY_APPROVAL_TOLERANT = 0x38C;
+static const StringID STR_CITY_APPROVAL_HOSTILE = 0x38D;
+static const StringID STR_CITY_APPROVAL_PERMISSIVE = 0x38E;
+static const StringID STR_WARNING_NO_SUITABLE_AI = 0x38F;
+static const StringID STR_CONFIG_SETTING_TREE_CAPTION = 0x390;
+static const StringID STR_CONFIG_SETTING_FILTER_TITLE = 0x391;
+static const StringID STR_CONFIG_SETTING_EXPAND_ALL = 0x392;
+static const StringID STR_CONFIG_SETTING_COLLAPSE_ALL = 0x393;
+static const StringID STR_CONFIG_SETTING_RESET_ALL = 0x394;
+static const StringID STR_CONFIG_SETTING_NO_EXPLANATION_AVAILABLE_HELPTEXT = 0x395;
+static const StringID STR_CONFIG_SETTING_DEFAULT_VALUE = 0x396;
+static const StringID STR_CONFIG_SETTING_TYPE = 0x397;
+static const StringID STR_CONFIG_SETTING_TYPE_CLIENT = 0x398;
+static const StringID STR_CONFIG_SETTING_TYPE_GAME_MENU = 0x399;
+static const StringID STR_CONFIG_SETTING_TYPE_GAME_INGAME = 0x39A;
+static const StringID STR_CONFIG_SETTING_TYPE_COMPANY_MENU = 0x39B;
+static const StringID STR_CONFIG_SETTING_TYPE_COMPANY_INGAME = 0x39C;
+static const StringID STR_CONFIG_SETTING_RESET_ALL_CONFIRMATION_DIALOG_CAPTION = 0x39D;
+static const StringID STR_CONFIG_SETTING_RESET_ALL_CONFIRMATION_DIALOG_TEXT = 0x39E;
+static const StringID STR_CONFIG_SETTING_RESTRICT_CATEGORY = 0x39F;
+static const StringID STR_CONFIG_SETTING_RESTRICT_TYPE = 0x3A0;
+static const StringID STR_CONFIG_SETTING_RESTRICT_DROPDOWN_HELPTEXT = 0x3A1;
+static const StringID STR_CONFIG_SETTING_RESTRICT_BASIC = 0x3A2;
+static const StringID STR_CONFIG_SETTING_RESTRICT_ADVANCED = 0x3A3;
+static const StringID STR_CONFIG_SETTING_RESTRICT_ALL = 0x3A4;
+static const StringID STR_CONFIG_SETTING_RESTRICT_CHANGED_AGAINST_DEFAULT = 0x3A5;
+static const StringID STR_CONFIG_SETTING_RESTRICT_CHANGED_AGAINST_NEW = 0x3A6;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_HELPTEXT = 0x3A7;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_ALL = 0x3A8;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_CLIENT = 0x3A9;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_GAME_MENU = 0x3AA;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_GAME_INGAME = 0x3AB;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_COMPANY_MENU = 0x3AC;
+static const StringID STR_CONFIG_SETTING_TYPE_DROPDOWN_COMPANY_INGAME = 0x3AD;
+static const StringID STR_CONFIG_SETTINGS_NONE = 0x3AE;
+static const StringID STR_CONFIG_SETTING_CATEGORY_HIDES = 0x3AF;
+static const StringID STR_CONFIG_SETTING_TYPE_HIDES = 0x3B0;
+static const StringID STR_CONFIG_SETTING_CATEGORY_AND_TYPE_HIDES = 0x3B1;
+static const StringID STR_CONFIG_SETTING_OFF = 0x3B2;
+static const StringID STR_CONFIG_SETTING_ON = 0x3B3;
+static const StringID STR_CONFIG_SETTING_DISABLED = 0x3B4;
+static const StringID STR_CONFIG_SETTING_COMPANIES_OFF = 0x3B5;
+static const StringID STR_CONFIG_SETTING_COMPANIES_OWN = 0x3B6;
+static const StringID STR_CONFIG_SETTING_COMPANIES_ALL = 0x3B7;
+static const StringID STR_CONFIG_SETTING_NONE = 0x3B8;
+static const StringID STR_CONFIG_SETTING_ORIGINAL = 0x3B9;
+static const StringID STR_CONFIG_SETTING_REALISTIC = 0x3BA;
+static const StringID STR_CONFIG_SETTING_HORIZONTAL_POS_LEFT = 0x3BB;
+static const StringID STR_CONFIG_SETTING_HORIZONTAL_POS_CENTER = 0x3BC;
+static const StringID STR_CONFIG_SETTING_HORIZONTAL_POS_RIGHT = 0x3BD;
+static const StringID STR_CONFIG_SETTING_MAXIMUM_INITIAL_LOAN = 0x3BE;
+static const StringID STR_CONFIG_SETTING_MAXIMUM_INITIAL_LOAN_HELPTEXT = 0x3BF;
+static const StringID STR_CONFIG_SETTING_MAXIMUM_INITIAL_LOAN_VALUE = 0x3C0;
+static const StringID STR_CONFIG_SETTING_MAXIMUM_INITIAL_LOAN_DISABLED = 0x3C1;
+static const StringID STR_CONFIG_SETTING_INTEREST_RATE = 0x3C2;
+static const StringID STR_CONFIG_SETTING_INTEREST_RATE_HELPTEXT = 0x3C3;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS = 0x3C4;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_HELPTEXT = 0x3C5;
+static const StringID STR_CONFIG_SETTING_CONSTRUCTION_SPEED = 0x3C6;
+static const StringID STR_CONFIG_SETTING_CONSTRUCTION_SPEED_HELPTEXT = 0x3C7;
+static const StringID STR_CONFIG_SETTING_VEHICLE_BREAKDOWNS = 0x3C8;
+static const StringID STR_CONFIG_SETTING_VEHICLE_BREAKDOWNS_HELPTEXT = 0x3C9;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_MULTIPLIER = 0x3CA;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_MULTIPLIER_HELPTEXT = 0x3CB;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_DURATION = 0x3CC;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_DURATION_HELPTEXT = 0x3CD;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_DURATION_VALUE = 0x3CE;
+static const StringID STR_CONFIG_SETTING_SUBSIDY_DURATION_DISABLED = 0x3CF;
+static const StringID STR_CONFIG_SETTING_CONSTRUCTION_COSTS = 0x3D0;
+static const StringID STR_CONFIG_SETTING_CONSTRUCTION_COSTS_HELPTEXT = 0x3D1;
+static const StringID STR_CONFIG_SETTING_RECESSIONS = 0x3D2;
+static const StringID STR_CONFIG_SETTING_RECESSIONS_HELPTEXT = 0x3D3;
+static const StringID STR_CONFIG_SETTING_TRAIN_REVERSING = 0x3D4;
+static const StringID STR_CONFIG_SETTING_TRAIN_REVERSING_HELPTEXT = 0x3D5;
+static const StringID STR_CONFIG_SETTING_DISASTERS = 0x3D6;
+static const StringID STR_CONFIG_SETTING_DISASTERS_HELPTEXT = 0x3D7;
+static const StringID STR_CONFIG_SETTING_CITY_APPROVAL = 0x3D8;
+static const StringID STR_CONFIG_SETTING_CITY_APPROVAL_HELPTEXT = 0x3D9;
+static const StringID STR_CONFIG_SETTING_MAP_HEIGHT_LIMIT = 0x3DA;
+static const StringID STR_CONFIG_SETTING_MAP_HEIGHT_LIMIT_HELPTEXT = 0x3DB;
+static const StringID STR_CONFIG_SETTING_MAP_HEIGHT_LIMIT_VALUE = 0x3DC;
+static const StringID STR_CONFIG_SETTING_MAP_HEIGHT_LIMIT_AUTO = 0x3DD;
+static const StringID STR_CONFIG_SETTING_TOO_HIGH_MOUNTAIN = 0x3DE;
+static const StringID STR_CONFIG_SETTING_AUTOSLOPE = 0x3DF;
+static const StringID STR_CONFIG_SETTING_AUTOSLOPE_HELPTEXT = 0x3E0;
+static const StringID STR_CONFIG_SETTING_CATCHMENT = 0x3E1;
+static const StringID STR_CONFIG_SETTING_CATCHMENT_HELPTEXT = 0x3E2;
+static const StringID STR_CONFIG_SETTING_SERVE_NEUTRAL_INDUSTRIES = 0x3E3;
+static const StringID STR_CONFIG_SETTING_SERVE_NEUTRAL_INDUSTRIES_HELPTEXT = 0x3E4;
+static const StringID STR_CONFIG_SETTING_EXTRADYNAMITE = 0x3E5;
+static const StringID STR_CONFIG_SETTING_EXTRADYNAMITE_HELPTEXT = 0x3E6;
+static const StringID STR_CONFIG_SETTING_TRAIN_LENGTH = 0x3E7;
+static const StringID STR_CONFIG_SETTING_TRAIN_LENGTH_HELPTEXT = 0x3E8;
+static const StringID STR_CONFIG_SETTING_TILE_LENGTH = 0x3E9;
+static const StringID STR_CONFIG_SETTING_SMOKE_AMOUNT = 0x3EA;
+static const StringID STR_CONFIG_SETTING_SMOKE_AMOUNT_HELPTEXT = 0x3EB;
+static const StringID STR_CONFIG_SETTING_TRAIN_ACCELERATION_MODEL = 0x3EC;
+static const StringID STR_CONFIG_SETTING_TRAIN_ACCELERATION_MODEL_HELPTEXT = 0x3ED;
+static const StringID STR_CONFIG_SETTING_ROAD_VEHICLE_ACCELERATION_MODEL = 0x3EE;
+static const StringID STR_CONFIG_SETTING_ROAD_VEHICLE_ACCELERATION_MODEL_HELPTEXT = 0x3EF;
+static const StringID STR_CONFIG_SETTING_TRAIN_SLOPE_STEEPNESS = 0x3F0;
+static const StringID STR_CONFIG_SETTING_TRAIN_SLOPE_STEEPNESS_HELPTEXT = 0x3F1;
+static const StringID STR_CONFIG_SETTING_PERCENTAGE = 0x3F2;
+static const StringID STR_CONFIG_SETTING_ROAD_VEHICLE_SLOPE_STEEPNESS = 0x3F3;
+static const StringID STR_CONFIG_SETTING_ROAD_VEHICLE_SLOPE_STEEPNESS_HELPTEXT = 0x3F4;
+static const StringID STR_CONFIG_SETTING_FORBID_90_DEG = 0x3F5;
+static const StringID STR_CONFIG_SETTING_FORBID_90_DEG_HELPTEXT = 0x3F6;
+static const StringID STR_CONFIG_SETTING_DISTANT_JOIN_STATIONS = 0x3F7;
+static const StringID STR_CONFIG_SETTING_DISTANT_JOIN_STATIONS_HELPTEXT = 0x3F8;
+static const StringID STR_CONFIG_SETTING_INFLATION = 0x3F9;
+static const StringID STR_CONFIG_SETTING_INFLATION_HELPTEXT = 0x3FA;
+static const StringID STR_CONFIG_SETTING_MAX_BRIDGE_LENGTH = 0x3FB;
+static const StringID STR_CONFIG_SETTING_MAX_BRIDGE_LENGTH_HELPTEXT = 0x3FC;
+static const StringID STR_CONFIG_SETTING_MAX_BRIDGE_HEIGHT = 0x3FD;
+static const StringID STR_CONFIG_SETTING_MAX_BRIDGE_HEIGHT_HELPTEXT = 0x3FE;
+static const StringID STR_CONFIG_SETTING_MAX_TUNNEL_LENGTH = 0x3FF;
+static const StringID STR_CONFIG_SETTING_MAX_TUNNEL_LENGTH_HELPTEXT = 0x400;
+static const StringID STR_CONFIG_SETTING_RAW_INDUSTRY_CONSTRUCTION_METHOD = 0x401;
+static const StringID STR_CONFIG_SETTING_RAW_INDUSTRY_CONSTRUCTION_METHOD_HELPTEXT = 0x402;
+static const StringID STR_CONFIG_SETTING_RAW_INDUSTRY_CONSTRUCTION_METHOD_NONE = 0x403;
+static const StringID STR_CONFIG_SETTING_RAW_INDUSTRY_CONSTRUCTION_METHOD_NORMAL = 0x404;
+static const StringID STR_CONFIG_SETTING_RAW_INDUSTRY_CONSTRUCTION_METHOD_PROSPECTING = 0x405;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_PLATFORM = 0x406;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_PLATFORM_HELPTEXT = 0x407;
+static const StringID STR_CONFIG_SETTING_MULTIPINDTOWN = 0x408;
+static const StringID STR_CONFIG_SETTING_MULTIPINDTOWN_HELPTEXT = 0x409;
+static const StringID STR_CONFIG_SETTING_SIGNALSIDE = 0x40A;
+static const StringID STR_CONFIG_SETTING_SIGNALSIDE_HELPTEXT = 0x40B;
+static const StringID STR_CONFIG_SETTING_SIGNALSIDE_LEFT = 0x40C;
+static const StringID STR_CONFIG_SETTING_SIGNALSIDE_DRIVING_SIDE = 0x40D;
+static const StringID STR_CONFIG_SETTING_SIGNALSIDE_RIGHT = 0x40E;
+static const StringID STR_CONFIG_SETTING_SHOWFINANCES = 0x40F;
+static const StringID STR_CONFIG_SETTING_SHOWFINANCES_HELPTEXT = 0x410;
+static const StringID STR_CONFIG_SETTING_NONSTOP_BY_DEFAULT = 0x411;
+static const StringID STR_CONFIG_SETTING_NONSTOP_BY_DEFAULT_HELPTEXT = 0x412;
+static const StringID STR_CONFIG_SETTING_STOP_LOCATION = 0x413;
+static const StringID STR_CONFIG_SETTING_STOP_LOCATION_HELPTEXT = 0x414;
+static const StringID STR_CONFIG_SETTING_STOP_LOCATION_NEAR_END = 0x415;
+static const StringID STR_CONFIG_SETTING_STOP_LOCATION_MIDDLE = 0x416;
+static const StringID STR_CONFIG_SETTING_STOP_LOCATION_FAR_END = 0x417;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL = 0x418;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL_HELPTEXT = 0x419;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL_DISABLED = 0x41A;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL_MAIN_VIEWPORT_FULLSCREEN = 0x41B;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL_MAIN_VIEWPORT = 0x41C;
+static const StringID STR_CONFIG_SETTING_AUTOSCROLL_EVERY_VIEWPORT = 0x41D;
+static const StringID STR_CONFIG_SETTING_BRIBE = 0x41E;
+static const StringID STR_CONFIG_SETTING_BRIBE_HELPTEXT = 0x41F;
+static const StringID STR_CONFIG_SETTING_ALLOW_EXCLUSIVE = 0x420;
+static const StringID STR_CONFIG_SETTING_ALLOW_EXCLUSIVE_HELPTEXT = 0x421;
+static const StringID STR_CONFIG_SETTING_ALLOW_FUND_BUILDINGS = 0x422;
+static const StringID STR_CONFIG_SETTING_ALLOW_FUND_BUILDINGS_HELPTEXT = 0x423;
+static const StringID STR_CONFIG_SETTING_ALLOW_FUND_ROAD = 0x424;
+static const StringID STR_CONFIG_SETTING_ALLOW_FUND_ROAD_HELPTEXT = 0x425;
+static const StringID STR_CONFIG_SETTING_ALLOW_GIVE_MONEY = 0x426;
+static const StringID STR_CONFIG_SETTING_ALLOW_GIVE_MONEY_HELPTEXT = 0x427;
+static const StringID STR_CONFIG_SETTING_FREIGHT_TRAINS = 0x428;
+static const StringID STR_CONFIG_SETTING_FREIGHT_TRAINS_HELPTEXT = 0x429;
+static const StringID STR_CONFIG_SETTING_PLANE_SPEED = 0x42A;
+static const StringID STR_CONFIG_SETTING_PLANE_SPEED_HELPTEXT = 0x42B;
+static const StringID STR_CONFIG_SETTING_PLANE_SPEED_VALUE = 0x42C;
+static const StringID STR_CONFIG_SETTING_PLANE_CRASHES = 0x42D;
+static const StringID STR_CONFIG_SETTING_PLANE_CRASHES_HELPTEXT = 0x42E;
+static const StringID STR_CONFIG_SETTING_PLANE_CRASHES_NONE = 0x42F;
+static const StringID STR_CONFIG_SETTING_PLANE_CRASHES_REDUCED = 0x430;
+static const StringID STR_CONFIG_SETTING_PLANE_CRASHES_NORMAL = 0x431;
+static const StringID STR_CONFIG_SETTING_STOP_ON_TOWN_ROAD = 0x432;
+static const StringID STR_CONFIG_SETTING_STOP_ON_TOWN_ROAD_HELPTEXT = 0x433;
+static const StringID STR_CONFIG_SETTING_STOP_ON_COMPETITOR_ROAD = 0x434;
+static const StringID STR_CONFIG_SETTING_STOP_ON_COMPETITOR_ROAD_HELPTEXT = 0x435;
+static const StringID STR_CONFIG_SETTING_DYNAMIC_ENGINES_EXISTING_VEHICLES = 0x436;
+static const StringID STR_CONFIG_SETTING_INFRASTRUCTURE_MAINTENANCE = 0x437;
+static const StringID STR_CONFIG_SETTING_INFRASTRUCTURE_MAINTENANCE_HELPTEXT = 0x438;
+static const StringID STR_CONFIG_SETTING_COMPANY_STARTING_COLOUR = 0x439;
+static const StringID STR_CONFIG_SETTING_COMPANY_STARTING_COLOUR_HELPTEXT = 0x43A;
+static const StringID STR_CONFIG_SETTING_NEVER_EXPIRE_AIRPORTS = 0x43B;
+static const StringID STR_CONFIG_SETTING_NEVER_EXPIRE_AIRPORTS_HELPTEXT = 0x43C;
+static const StringID STR_CONFIG_SETTING_WARN_LOST_VEHICLE = 0x43D;
+static const StringID STR_CONFIG_SETTING_WARN_LOST_VEHICLE_HELPTEXT = 0x43E;
+static const StringID STR_CONFIG_SETTING_ORDER_REVIEW = 0x43F;
+static const StringID STR_CONFIG_SETTING_ORDER_REVIEW_HELPTEXT = 0x440;
+static const StringID STR_CONFIG_SETTING_ORDER_REVIEW_OFF = 0x441;
+static const StringID STR_CONFIG_SETTING_ORDER_REVIEW_EXDEPOT = 0x442;
+static const StringID STR_CONFIG_SETTING_ORDER_REVIEW_ON = 0x443;
+static const StringID STR_CONFIG_SETTING_WARN_INCOME_LESS = 0x444;
+static const StringID STR_CONFIG_SETTING_WARN_INCOME_LESS_HELPTEXT = 0x445;
+static const StringID STR_CONFIG_SETTING_NEVER_EXPIRE_VEHICLES = 0x446;
+static const StringID STR_CONFIG_SETTING_NEVER_EXPIRE_VEHICLES_HELPTEXT = 0x447;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_VEHICLE = 0x448;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_VEHICLE_HELPTEXT = 0x449;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONTHS = 0x44A;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONTHS_HELPTEXT = 0x44B;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONTHS_VALUE_BEFORE = 0x44C;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONTHS_VALUE_AFTER = 0x44D;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONEY = 0x44E;
+static const StringID STR_CONFIG_SETTING_AUTORENEW_MONEY_HELPTEXT = 0x44F;
+static const StringID STR_CONFIG_SETTING_ERRMSG_DURATION = 0x450;
+static const StringID STR_CONFIG_SETTING_ERRMSG_DURATION_HELPTEXT = 0x451;
+static const StringID STR_CONFIG_SETTING_ERRMSG_DURATION_VALUE = 0x452;
+static const StringID STR_CONFIG_SETTING_HOVER_DELAY = 0x453;
+static const StringID STR_CONFIG_SETTING_HOVER_DELAY_HELPTEXT = 0x454;
+static const StringID STR_CONFIG_SETTING_HOVER_DELAY_VALUE = 0x455;
+static const StringID STR_CONFIG_SETTING_HOVER_DELAY_DISABLED = 0x456;
+static const StringID STR_CONFIG_SETTING_POPULATION_IN_LABEL = 0x457;
+static const StringID STR_CONFIG_SETTING_POPULATION_IN_LABEL_HELPTEXT = 0x458;
+static const StringID STR_CONFIG_SETTING_GRAPH_LINE_THICKNESS = 0x459;
+static const StringID STR_CONFIG_SETTING_GRAPH_LINE_THICKNESS_HELPTEXT = 0x45A;
+static const StringID STR_CONFIG_SETTING_SHOW_NEWGRF_NAME = 0x45B;
+static const StringID STR_CONFIG_SETTING_SHOW_NEWGRF_NAME_HELPTEXT = 0x45C;
+static const StringID STR_CONFIG_SETTING_SHOW_CARGO_IN_LISTS = 0x45D;
+static const StringID STR_CONFIG_SETTING_SHOW_CARGO_IN_LISTS_HELPTEXT = 0x45E;
+static const StringID STR_CONFIG_SETTING_LANDSCAPE = 0x45F;
+static const StringID STR_CONFIG_SETTING_LANDSCAPE_HELPTEXT = 0x460;
+static const StringID STR_CONFIG_SETTING_LAND_GENERATOR = 0x461;
+static const StringID STR_CONFIG_SETTING_LAND_GENERATOR_HELPTEXT = 0x462;
+static const StringID STR_CONFIG_SETTING_LAND_GENERATOR_ORIGINAL = 0x463;
+static const StringID STR_CONFIG_SETTING_LAND_GENERATOR_TERRA_GENESIS = 0x464;
+static const StringID STR_CONFIG_SETTING_TERRAIN_TYPE = 0x465;
+static const StringID STR_CONFIG_SETTING_TERRAIN_TYPE_HELPTEXT = 0x466;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_DENSITY = 0x467;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_DENSITY_HELPTEXT = 0x468;
+static const StringID STR_CONFIG_SETTING_OIL_REF_EDGE_DISTANCE = 0x469;
+static const StringID STR_CONFIG_SETTING_OIL_REF_EDGE_DISTANCE_HELPTEXT = 0x46A;
+static const StringID STR_CONFIG_SETTING_SNOWLINE_HEIGHT = 0x46B;
+static const StringID STR_CONFIG_SETTING_SNOWLINE_HEIGHT_HELPTEXT = 0x46C;
+static const StringID STR_CONFIG_SETTING_SNOW_COVERAGE = 0x46D;
+static const StringID STR_CONFIG_SETTING_SNOW_COVERAGE_HELPTEXT = 0x46E;
+static const StringID STR_CONFIG_SETTING_SNOW_COVERAGE_VALUE = 0x46F;
+static const StringID STR_CONFIG_SETTING_DESERT_COVERAGE = 0x470;
+static const StringID STR_CONFIG_SETTING_DESERT_COVERAGE_HELPTEXT = 0x471;
+static const StringID STR_CONFIG_SETTING_DESERT_COVERAGE_VALUE = 0x472;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN = 0x473;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN_HELPTEXT = 0x474;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN_VERY_SMOOTH = 0x475;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN_SMOOTH = 0x476;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN_ROUGH = 0x477;
+static const StringID STR_CONFIG_SETTING_ROUGHNESS_OF_TERRAIN_VERY_ROUGH = 0x478;
+static const StringID STR_CONFIG_SETTING_VARIETY = 0x479;
+static const StringID STR_CONFIG_SETTING_VARIETY_HELPTEXT = 0x47A;
+static const StringID STR_CONFIG_SETTING_RIVER_AMOUNT = 0x47B;
+static const StringID STR_CONFIG_SETTING_RIVER_AMOUNT_HELPTEXT = 0x47C;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER = 0x47D;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER_HELPTEXT = 0x47E;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER_NONE = 0x47F;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER_ORIGINAL = 0x480;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER_IMPROVED = 0x481;
+static const StringID STR_CONFIG_SETTING_TREE_PLACER_PERFECT = 0x482;
+static const StringID STR_CONFIG_SETTING_ROAD_SIDE = 0x483;
+static const StringID STR_CONFIG_SETTING_ROAD_SIDE_HELPTEXT = 0x484;
+static const StringID STR_CONFIG_SETTING_ROAD_SIDE_LEFT = 0x485;
+static const StringID STR_CONFIG_SETTING_ROAD_SIDE_RIGHT = 0x486;
+static const StringID STR_CONFIG_SETTING_HEIGHTMAP_ROTATION = 0x487;
+static const StringID STR_CONFIG_SETTING_HEIGHTMAP_ROTATION_COUNTER_CLOCKWISE = 0x488;
+static const StringID STR_CONFIG_SETTING_HEIGHTMAP_ROTATION_CLOCKWISE = 0x489;
+static const StringID STR_CONFIG_SETTING_SE_FLAT_WORLD_HEIGHT = 0x48A;
+static const StringID STR_CONFIG_SETTING_EDGES_NOT_EMPTY = 0x48B;
+static const StringID STR_CONFIG_SETTING_EDGES_NOT_WATER = 0x48C;
+static const StringID STR_CONFIG_SETTING_STATION_SPREAD = 0x48D;
+static const StringID STR_CONFIG_SETTING_STATION_SPREAD_HELPTEXT = 0x48E;
+static const StringID STR_CONFIG_SETTING_SERVICEATHELIPAD = 0x48F;
+static const StringID STR_CONFIG_SETTING_SERVICEATHELIPAD_HELPTEXT = 0x490;
+static const StringID STR_CONFIG_SETTING_LINK_TERRAFORM_TOOLBAR = 0x491;
+static const StringID STR_CONFIG_SETTING_LINK_TERRAFORM_TOOLBAR_HELPTEXT = 0x492;
+static const StringID STR_CONFIG_SETTING_SMALLMAP_LAND_COLOUR = 0x493;
+static const StringID STR_CONFIG_SETTING_SMALLMAP_LAND_COLOUR_HELPTEXT = 0x494;
+static const StringID STR_CONFIG_SETTING_SMALLMAP_LAND_COLOUR_GREEN = 0x495;
+static const StringID STR_CONFIG_SETTING_SMALLMAP_LAND_COLOUR_DARK_GREEN = 0x496;
+static const StringID STR_CONFIG_SETTING_SMALLMAP_LAND_COLOUR_VIOLET = 0x497;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS = 0x498;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS_HELPTEXT = 0x499;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS_GREEN_TO_RED = 0x49A;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS_GREEN_TO_BLUE = 0x49B;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS_GREY_TO_RED = 0x49C;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_COLOURS_GREYSCALE = 0x49D;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE = 0x49E;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE_HELPTEXT = 0x49F;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE_DEFAULT = 0x4A0;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE_RMB_LOCKED = 0x4A1;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE_RMB = 0x4A2;
+static const StringID STR_CONFIG_SETTING_SCROLLMODE_LMB = 0x4A3;
+static const StringID STR_CONFIG_SETTING_SMOOTH_SCROLLING = 0x4A4;
+static const StringID STR_CONFIG_SETTING_SMOOTH_SCROLLING_HELPTEXT = 0x4A5;
+static const StringID STR_CONFIG_SETTING_MEASURE_TOOLTIP = 0x4A6;
+static const StringID STR_CONFIG_SETTING_MEASURE_TOOLTIP_HELPTEXT = 0x4A7;
+static const StringID STR_CONFIG_SETTING_LIVERIES = 0x4A8;
+static const StringID STR_CONFIG_SETTING_LIVERIES_HELPTEXT = 0x4A9;
+static const StringID STR_CONFIG_SETTING_LIVERIES_NONE = 0x4AA;
+static const StringID STR_CONFIG_SETTING_LIVERIES_OWN = 0x4AB;
+static const StringID STR_CONFIG_SETTING_LIVERIES_ALL = 0x4AC;
+static const StringID STR_CONFIG_SETTING_PREFER_TEAMCHAT = 0x4AD;
+static const StringID STR_CONFIG_SETTING_PREFER_TEAMCHAT_HELPTEXT = 0x4AE;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_MULTIPLIER = 0x4AF;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_MULTIPLIER_HELPTEXT = 0x4B0;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_SCROLLING = 0x4B1;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_SCROLLING_HELPTEXT = 0x4B2;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_ZOOM = 0x4B3;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_SCROLL = 0x4B4;
+static const StringID STR_CONFIG_SETTING_SCROLLWHEEL_OFF = 0x4B5;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION = 0x4B6;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION_HELPTEXT = 0x4B7;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION_DISABLED = 0x4B8;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION_DOUBLE_CLICK = 0x4B9;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION_SINGLE_CLICK_FOCUS = 0x4BA;
+static const StringID STR_CONFIG_SETTING_OSK_ACTIVATION_SINGLE_CLICK = 0x4BB;
+static const StringID STR_CONFIG_SETTING_USE_RELAY_SERVICE = 0x4BC;
+static const StringID STR_CONFIG_SETTING_USE_RELAY_SERVICE_HELPTEXT = 0x4BD;
+static const StringID STR_CONFIG_SETTING_USE_RELAY_SERVICE_NEVER = 0x4BE;
+static const StringID STR_CONFIG_SETTING_USE_RELAY_SERVICE_ASK = 0x4BF;
+static const StringID STR_CONFIG_SETTING_USE_RELAY_SERVICE_ALLOW = 0x4C0;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_BTN_EMU = 0x4C1;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_BTN_EMU_HELPTEXT = 0x4C2;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_BTN_EMU_COMMAND = 0x4C3;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_BTN_EMU_CONTROL = 0x4C4;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_BTN_EMU_OFF = 0x4C5;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_WND_CLOSE = 0x4C6;
+static const StringID STR_CONFIG_SETTING_RIGHT_MOUSE_WND_CLOSE_HELPTEXT = 0x4C7;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE = 0x4C8;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_HELPTEXT = 0x4C9;
+static const StringID STR_CONFIG_SETTING_DATE_FORMAT_IN_SAVE_NAMES = 0x4CA;
+static const StringID STR_CONFIG_SETTING_DATE_FORMAT_IN_SAVE_NAMES_HELPTEXT = 0x4CB;
+static const StringID STR_CONFIG_SETTING_DATE_FORMAT_IN_SAVE_NAMES_LONG = 0x4CC;
+static const StringID STR_CONFIG_SETTING_DATE_FORMAT_IN_SAVE_NAMES_SHORT = 0x4CD;
+static const StringID STR_CONFIG_SETTING_DATE_FORMAT_IN_SAVE_NAMES_ISO = 0x4CE;
+static const StringID STR_CONFIG_SETTING_PAUSE_ON_NEW_GAME = 0x4CF;
+static const StringID STR_CONFIG_SETTING_PAUSE_ON_NEW_GAME_HELPTEXT = 0x4D0;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL = 0x4D1;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL_HELPTEXT = 0x4D2;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL_NO_ACTIONS = 0x4D3;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL_ALL_NON_CONSTRUCTION = 0x4D4;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL_ALL_NON_LANDSCAPING = 0x4D5;
+static const StringID STR_CONFIG_SETTING_COMMAND_PAUSE_LEVEL_ALL_ACTIONS = 0x4D6;
+static const StringID STR_CONFIG_SETTING_ADVANCED_VEHICLE_LISTS = 0x4D7;
+static const StringID STR_CONFIG_SETTING_ADVANCED_VEHICLE_LISTS_HELPTEXT = 0x4D8;
+static const StringID STR_CONFIG_SETTING_LOADING_INDICATORS = 0x4D9;
+static const StringID STR_CONFIG_SETTING_LOADING_INDICATORS_HELPTEXT = 0x4DA;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_IN_TICKS = 0x4DB;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_IN_TICKS_HELPTEXT = 0x4DC;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SHOW_ARRIVAL_DEPARTURE = 0x4DD;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SHOW_ARRIVAL_DEPARTURE_HELPTEXT = 0x4DE;
+static const StringID STR_CONFIG_SETTING_QUICKGOTO = 0x4DF;
+static const StringID STR_CONFIG_SETTING_QUICKGOTO_HELPTEXT = 0x4E0;
+static const StringID STR_CONFIG_SETTING_DEFAULT_RAIL_TYPE = 0x4E1;
+static const StringID STR_CONFIG_SETTING_DEFAULT_RAIL_TYPE_HELPTEXT = 0x4E2;
+static const StringID STR_CONFIG_SETTING_DEFAULT_RAIL_TYPE_FIRST = 0x4E3;
+static const StringID STR_CONFIG_SETTING_DEFAULT_RAIL_TYPE_LAST = 0x4E4;
+static const StringID STR_CONFIG_SETTING_DEFAULT_RAIL_TYPE_MOST_USED = 0x4E5;
+static const StringID STR_CONFIG_SETTING_DEFAULT_ROAD_TYPE_DEFAULT = 0x4E6;
+static const StringID STR_CONFIG_SETTING_SHOW_TRACK_RESERVATION = 0x4E7;
+static const StringID STR_CONFIG_SETTING_SHOW_TRACK_RESERVATION_HELPTEXT = 0x4E8;
+static const StringID STR_CONFIG_SETTING_PERSISTENT_BUILDINGTOOLS = 0x4E9;
+static const StringID STR_CONFIG_SETTING_PERSISTENT_BUILDINGTOOLS_HELPTEXT = 0x4EA;
+static const StringID STR_CONFIG_SETTING_AUTO_REMOVE_SIGNALS = 0x4EB;
+static const StringID STR_CONFIG_SETTING_AUTO_REMOVE_SIGNALS_HELPTEXT = 0x4EC;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_SPEED_LIMIT = 0x4ED;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_SPEED_LIMIT_HELPTEXT = 0x4EE;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_SPEED_LIMIT_VAL = 0x4EF;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_SPEED_LIMIT_ZERO = 0x4F0;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_REFRESH_RATE = 0x4F1;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_REFRESH_RATE_HELPTEXT = 0x4F2;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_REFRESH_RATE_VAL = 0x4F3;
+static const StringID STR_CONFIG_SETTING_FAST_FORWARD_REFRESH_RATE_ZERO = 0x4F4;
+static const StringID STR_CONFIG_SETTING_SOUND_TICKER = 0x4F5;
+static const StringID STR_CONFIG_SETTING_SOUND_TICKER_HELPTEXT = 0x4F6;
+static const StringID STR_CONFIG_SETTING_SOUND_NEWS = 0x4F7;
+static const StringID STR_CONFIG_SETTING_SOUND_NEWS_HELPTEXT = 0x4F8;
+static const StringID STR_CONFIG_SETTING_SOUND_NEW_YEAR = 0x4F9;
+static const StringID STR_CONFIG_SETTING_SOUND_NEW_YEAR_HELPTEXT = 0x4FA;
+static const StringID STR_CONFIG_SETTING_SOUND_CONFIRM = 0x4FB;
+static const StringID STR_CONFIG_SETTING_SOUND_CONFIRM_HELPTEXT = 0x4FC;
+static const StringID STR_CONFIG_SETTING_SOUND_CLICK = 0x4FD;
+static const StringID STR_CONFIG_SETTING_SOUND_CLICK_HELPTEXT = 0x4FE;
+static const StringID STR_CONFIG_SETTING_SOUND_DISASTER = 0x4FF;
+static const StringID STR_CONFIG_SETTING_SOUND_DISASTER_HELPTEXT = 0x500;
+static const StringID STR_CONFIG_SETTING_SOUND_VEHICLE = 0x501;
+static const StringID STR_CONFIG_SETTING_SOUND_VEHICLE_HELPTEXT = 0x502;
+static const StringID STR_CONFIG_SETTING_SOUND_AMBIENT = 0x503;
+static const StringID STR_CONFIG_SETTING_SOUND_AMBIENT_HELPTEXT = 0x504;
+static const StringID STR_CONFIG_SETTING_MAX_TRAINS = 0x505;
+static const StringID STR_CONFIG_SETTING_MAX_TRAINS_HELPTEXT = 0x506;
+static const StringID STR_CONFIG_SETTING_MAX_ROAD_VEHICLES = 0x507;
+static const StringID STR_CONFIG_SETTING_MAX_ROAD_VEHICLES_HELPTEXT = 0x508;
+static const StringID STR_CONFIG_SETTING_MAX_AIRCRAFT = 0x509;
+static const StringID STR_CONFIG_SETTING_MAX_AIRCRAFT_HELPTEXT = 0x50A;
+static const StringID STR_CONFIG_SETTING_MAX_SHIPS = 0x50B;
+static const StringID STR_CONFIG_SETTING_MAX_SHIPS_HELPTEXT = 0x50C;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_TRAINS = 0x50D;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_TRAINS_HELPTEXT = 0x50E;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_ROAD_VEHICLES = 0x50F;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_ROAD_VEHICLES_HELPTEXT = 0x510;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_AIRCRAFT = 0x511;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_AIRCRAFT_HELPTEXT = 0x512;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_SHIPS = 0x513;
+static const StringID STR_CONFIG_SETTING_AI_BUILDS_SHIPS_HELPTEXT = 0x514;
+static const StringID STR_CONFIG_SETTING_AI_PROFILE = 0x515;
+static const StringID STR_CONFIG_SETTING_AI_PROFILE_HELPTEXT = 0x516;
+static const StringID STR_CONFIG_SETTING_AI_PROFILE_EASY = 0x517;
+static const StringID STR_CONFIG_SETTING_AI_PROFILE_MEDIUM = 0x518;
+static const StringID STR_CONFIG_SETTING_AI_PROFILE_HARD = 0x519;
+static const StringID STR_CONFIG_SETTING_AI_IN_MULTIPLAYER = 0x51A;
+static const StringID STR_CONFIG_SETTING_AI_IN_MULTIPLAYER_HELPTEXT = 0x51B;
+static const StringID STR_CONFIG_SETTING_SCRIPT_MAX_OPCODES = 0x51C;
+static const StringID STR_CONFIG_SETTING_SCRIPT_MAX_OPCODES_HELPTEXT = 0x51D;
+static const StringID STR_CONFIG_SETTING_SCRIPT_MAX_MEMORY = 0x51E;
+static const StringID STR_CONFIG_SETTING_SCRIPT_MAX_MEMORY_HELPTEXT = 0x51F;
+static const StringID STR_CONFIG_SETTING_SCRIPT_MAX_MEMORY_VALUE = 0x520;
+static const StringID STR_CONFIG_SETTING_SERVINT_ISPERCENT = 0x521;
+static const StringID STR_CONFIG_SETTING_SERVINT_ISPERCENT_HELPTEXT = 0x522;
+static const StringID STR_CONFIG_SETTING_SERVINT_TRAINS = 0x523;
+static const StringID STR_CONFIG_SETTING_SERVINT_TRAINS_HELPTEXT = 0x524;
+static const StringID STR_CONFIG_SETTING_SERVINT_ROAD_VEHICLES = 0x525;
+static const StringID STR_CONFIG_SETTING_SERVINT_ROAD_VEHICLES_HELPTEXT = 0x526;
+static const StringID STR_CONFIG_SETTING_SERVINT_AIRCRAFT = 0x527;
+static const StringID STR_CONFIG_SETTING_SERVINT_AIRCRAFT_HELPTEXT = 0x528;
+static const StringID STR_CONFIG_SETTING_SERVINT_SHIPS = 0x529;
+static const StringID STR_CONFIG_SETTING_SERVINT_SHIPS_HELPTEXT = 0x52A;
+static const StringID STR_CONFIG_SETTING_SERVINT_VALUE = 0x52B;
+static const StringID STR_CONFIG_SETTING_SERVINT_DISABLED = 0x52C;
+static const StringID STR_CONFIG_SETTING_NOSERVICE = 0x52D;
+static const StringID STR_CONFIG_SETTING_NOSERVICE_HELPTEXT = 0x52E;
+static const StringID STR_CONFIG_SETTING_WAGONSPEEDLIMITS = 0x52F;
+static const StringID STR_CONFIG_SETTING_WAGONSPEEDLIMITS_HELPTEXT = 0x530;
+static const StringID STR_CONFIG_SETTING_DISABLE_ELRAILS = 0x531;
+static const StringID STR_CONFIG_SETTING_DISABLE_ELRAILS_HELPTEXT = 0x532;
+static const StringID STR_CONFIG_SETTING_NEWS_ARRIVAL_FIRST_VEHICLE_OWN = 0x533;
+static const StringID STR_CONFIG_SETTING_NEWS_ARRIVAL_FIRST_VEHICLE_OWN_HELPTEXT = 0x534;
+static const StringID STR_CONFIG_SETTING_NEWS_ARRIVAL_FIRST_VEHICLE_OTHER = 0x535;
+static const StringID STR_CONFIG_SETTING_NEWS_ARRIVAL_FIRST_VEHICLE_OTHER_HELPTEXT = 0x536;
+static const StringID STR_CONFIG_SETTING_NEWS_ACCIDENTS_DISASTERS = 0x537;
+static const StringID STR_CONFIG_SETTING_NEWS_ACCIDENTS_DISASTERS_HELPTEXT = 0x538;
+static const StringID STR_CONFIG_SETTING_NEWS_ACCIDENT_OTHER = 0x539;
+static const StringID STR_CONFIG_SETTING_NEWS_ACCIDENT_OTHER_HELPTEXT = 0x53A;
+static const StringID STR_CONFIG_SETTING_NEWS_COMPANY_INFORMATION = 0x53B;
+static const StringID STR_CONFIG_SETTING_NEWS_COMPANY_INFORMATION_HELPTEXT = 0x53C;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_OPEN = 0x53D;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_OPEN_HELPTEXT = 0x53E;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CLOSE = 0x53F;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CLOSE_HELPTEXT = 0x540;
+static const StringID STR_CONFIG_SETTING_NEWS_ECONOMY_CHANGES = 0x541;
+static const StringID STR_CONFIG_SETTING_NEWS_ECONOMY_CHANGES_HELPTEXT = 0x542;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_COMPANY = 0x543;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_COMPANY_HELPTEXT = 0x544;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_OTHER = 0x545;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_OTHER_HELPTEXT = 0x546;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_UNSERVED = 0x547;
+static const StringID STR_CONFIG_SETTING_NEWS_INDUSTRY_CHANGES_UNSERVED_HELPTEXT = 0x548;
+static const StringID STR_CONFIG_SETTING_NEWS_ADVICE = 0x549;
+static const StringID STR_CONFIG_SETTING_NEWS_ADVICE_HELPTEXT = 0x54A;
+static const StringID STR_CONFIG_SETTING_NEWS_NEW_VEHICLES = 0x54B;
+static const StringID STR_CONFIG_SETTING_NEWS_NEW_VEHICLES_HELPTEXT = 0x54C;
+static const StringID STR_CONFIG_SETTING_NEWS_CHANGES_ACCEPTANCE = 0x54D;
+static const StringID STR_CONFIG_SETTING_NEWS_CHANGES_ACCEPTANCE_HELPTEXT = 0x54E;
+static const StringID STR_CONFIG_SETTING_NEWS_SUBSIDIES = 0x54F;
+static const StringID STR_CONFIG_SETTING_NEWS_SUBSIDIES_HELPTEXT = 0x550;
+static const StringID STR_CONFIG_SETTING_NEWS_GENERAL_INFORMATION = 0x551;
+static const StringID STR_CONFIG_SETTING_NEWS_GENERAL_INFORMATION_HELPTEXT = 0x552;
+static const StringID STR_CONFIG_SETTING_NEWS_MESSAGES_OFF = 0x553;
+static const StringID STR_CONFIG_SETTING_NEWS_MESSAGES_SUMMARY = 0x554;
+static const StringID STR_CONFIG_SETTING_NEWS_MESSAGES_FULL = 0x555;
+static const StringID STR_CONFIG_SETTING_COLOURED_NEWS_YEAR = 0x556;
+static const StringID STR_CONFIG_SETTING_COLOURED_NEWS_YEAR_HELPTEXT = 0x557;
+static const StringID STR_CONFIG_SETTING_STARTING_YEAR = 0x558;
+static const StringID STR_CONFIG_SETTING_ENDING_YEAR = 0x559;
+static const StringID STR_CONFIG_SETTING_ENDING_YEAR_HELPTEXT = 0x55A;
+static const StringID STR_CONFIG_SETTING_ENDING_YEAR_VALUE = 0x55B;
+static const StringID STR_CONFIG_SETTING_ENDING_YEAR_ZERO = 0x55C;
+static const StringID STR_CONFIG_SETTING_ECONOMY_TYPE = 0x55D;
+static const StringID STR_CONFIG_SETTING_ECONOMY_TYPE_HELPTEXT = 0x55E;
+static const StringID STR_CONFIG_SETTING_ECONOMY_TYPE_ORIGINAL = 0x55F;
+static const StringID STR_CONFIG_SETTING_ECONOMY_TYPE_SMOOTH = 0x560;
+static const StringID STR_CONFIG_SETTING_ECONOMY_TYPE_FROZEN = 0x561;
+static const StringID STR_CONFIG_SETTING_ALLOW_SHARES = 0x562;
+static const StringID STR_CONFIG_SETTING_ALLOW_SHARES_HELPTEXT = 0x563;
+static const StringID STR_CONFIG_SETTING_MIN_YEARS_FOR_SHARES = 0x564;
+static const StringID STR_CONFIG_SETTING_MIN_YEARS_FOR_SHARES_HELPTEXT = 0x565;
+static const StringID STR_CONFIG_SETTING_MIN_YEARS_FOR_SHARES_VALUE = 0x566;
+static const StringID STR_CONFIG_SETTING_MIN_YEARS_FOR_SHARES_NO_MIN = 0x567;
+static const StringID STR_CONFIG_SETTING_FEEDER_PAYMENT_SHARE = 0x568;
+static const StringID STR_CONFIG_SETTING_FEEDER_PAYMENT_SHARE_HELPTEXT = 0x569;
+static const StringID STR_CONFIG_SETTING_DRAG_SIGNALS_DENSITY = 0x56A;
+static const StringID STR_CONFIG_SETTING_DRAG_SIGNALS_DENSITY_HELPTEXT = 0x56B;
+static const StringID STR_CONFIG_SETTING_DRAG_SIGNALS_DENSITY_VALUE = 0x56C;
+static const StringID STR_CONFIG_SETTING_DRAG_SIGNALS_FIXED_DISTANCE = 0x56D;
+static const StringID STR_CONFIG_SETTING_DRAG_SIGNALS_FIXED_DISTANCE_HELPTEXT = 0x56E;
+static const StringID STR_CONFIG_SETTING_SEMAPHORE_BUILD_BEFORE_DATE = 0x56F;
+static const StringID STR_CONFIG_SETTING_SEMAPHORE_BUILD_BEFORE_DATE_HELPTEXT = 0x570;
+static const StringID STR_CONFIG_SETTING_CYCLE_SIGNAL_TYPES = 0x571;
+static const StringID STR_CONFIG_SETTING_CYCLE_SIGNAL_TYPES_HELPTEXT = 0x572;
+static const StringID STR_CONFIG_SETTING_CYCLE_SIGNAL_PBS = 0x573;
+static const StringID STR_CONFIG_SETTING_CYCLE_SIGNAL_ALL = 0x574;
+static const StringID STR_CONFIG_SETTING_SIGNAL_GUI_MODE = 0x575;
+static const StringID STR_CONFIG_SETTING_SIGNAL_GUI_MODE_HELPTEXT = 0x576;
+static const StringID STR_CONFIG_SETTING_SIGNAL_GUI_MODE_PATH = 0x577;
+static const StringID STR_CONFIG_SETTING_SIGNAL_GUI_MODE_ALL_CYCLE_PATH = 0x578;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT = 0x579;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_HELPTEXT = 0x57A;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_DEFAULT = 0x57B;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_BETTER_ROADS = 0x57C;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_2X2_GRID = 0x57D;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_3X3_GRID = 0x57E;
+static const StringID STR_CONFIG_SETTING_TOWN_LAYOUT_RANDOM = 0x57F;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_ROADS = 0x580;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_ROADS_HELPTEXT = 0x581;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_LEVEL_CROSSINGS = 0x582;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_LEVEL_CROSSINGS_HELPTEXT = 0x583;
+static const StringID STR_CONFIG_SETTING_NOISE_LEVEL = 0x584;
+static const StringID STR_CONFIG_SETTING_NOISE_LEVEL_HELPTEXT = 0x585;
+static const StringID STR_CONFIG_SETTING_TOWN_FOUNDING = 0x586;
+static const StringID STR_CONFIG_SETTING_TOWN_FOUNDING_HELPTEXT = 0x587;
+static const StringID STR_CONFIG_SETTING_TOWN_FOUNDING_FORBIDDEN = 0x588;
+static const StringID STR_CONFIG_SETTING_TOWN_FOUNDING_ALLOWED = 0x589;
+static const StringID STR_CONFIG_SETTING_TOWN_FOUNDING_ALLOWED_CUSTOM_LAYOUT = 0x58A;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGOGENMODE = 0x58B;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGOGENMODE_HELPTEXT = 0x58C;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGOGENMODE_ORIGINAL = 0x58D;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGOGENMODE_BITCOUNT = 0x58E;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT = 0x58F;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT_HELPTEXT = 0x590;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT_NO_SPREAD = 0x591;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT_SPREAD_RAINFOREST = 0x592;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT_SPREAD_ALL = 0x593;
+static const StringID STR_CONFIG_SETTING_EXTRA_TREE_PLACEMENT_NO_GROWTH_NO_SPREAD = 0x594;
+static const StringID STR_CONFIG_SETTING_TOOLBAR_POS = 0x595;
+static const StringID STR_CONFIG_SETTING_TOOLBAR_POS_HELPTEXT = 0x596;
+static const StringID STR_CONFIG_SETTING_STATUSBAR_POS = 0x597;
+static const StringID STR_CONFIG_SETTING_STATUSBAR_POS_HELPTEXT = 0x598;
+static const StringID STR_CONFIG_SETTING_SNAP_RADIUS = 0x599;
+static const StringID STR_CONFIG_SETTING_SNAP_RADIUS_HELPTEXT = 0x59A;
+static const StringID STR_CONFIG_SETTING_SNAP_RADIUS_VALUE = 0x59B;
+static const StringID STR_CONFIG_SETTING_SNAP_RADIUS_DISABLED = 0x59C;
+static const StringID STR_CONFIG_SETTING_SOFT_LIMIT = 0x59D;
+static const StringID STR_CONFIG_SETTING_SOFT_LIMIT_HELPTEXT = 0x59E;
+static const StringID STR_CONFIG_SETTING_SOFT_LIMIT_VALUE = 0x59F;
+static const StringID STR_CONFIG_SETTING_SOFT_LIMIT_DISABLED = 0x5A0;
+static const StringID STR_CONFIG_SETTING_ZOOM_MIN = 0x5A1;
+static const StringID STR_CONFIG_SETTING_ZOOM_MIN_HELPTEXT = 0x5A2;
+static const StringID STR_CONFIG_SETTING_ZOOM_MAX = 0x5A3;
+static const StringID STR_CONFIG_SETTING_ZOOM_MAX_HELPTEXT = 0x5A4;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_MIN = 0x5A5;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_IN_2X = 0x5A6;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_NORMAL = 0x5A7;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_2X = 0x5A8;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_4X = 0x5A9;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_8X = 0x5AA;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_16X = 0x5AB;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_32X = 0x5AC;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_64X = 0x5AD;
+static const StringID STR_CONFIG_SETTING_ZOOM_LVL_OUT_128X = 0x5AE;
+static const StringID STR_CONFIG_SETTING_SPRITE_ZOOM_MIN = 0x5AF;
+static const StringID STR_CONFIG_SETTING_SPRITE_ZOOM_MIN_HELPTEXT = 0x5B0;
+static const StringID STR_CONFIG_SETTING_SPRITE_ZOOM_LVL_MIN = 0x5B1;
+static const StringID STR_CONFIG_SETTING_SPRITE_ZOOM_LVL_IN_2X = 0x5B2;
+static const StringID STR_CONFIG_SETTING_SPRITE_ZOOM_LVL_NORMAL = 0x5B3;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH = 0x5B4;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_HELPTEXT = 0x5B5;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_EXTREME_SLOW = 0x5B6;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_VERY_SLOW = 0x5B7;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_NONE = 0x5B8;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_SLOW = 0x5B9;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_NORMAL = 0x5BA;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_FAST = 0x5BB;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_VERY_FAST = 0x5BC;
+static const StringID STR_CONFIG_SETTING_LARGER_TOWNS = 0x5BD;
+static const StringID STR_CONFIG_SETTING_LARGER_TOWNS_HELPTEXT = 0x5BE;
+static const StringID STR_CONFIG_SETTING_LARGER_TOWNS_VALUE = 0x5BF;
+static const StringID STR_CONFIG_SETTING_LARGER_TOWNS_DISABLED = 0x5C0;
+static const StringID STR_CONFIG_SETTING_CITY_SIZE_MULTIPLIER = 0x5C1;
+static const StringID STR_CONFIG_SETTING_CITY_SIZE_MULTIPLIER_HELPTEXT = 0x5C2;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_INTERVAL = 0x5C3;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_INTERVAL_HELPTEXT = 0x5C4;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_TIME = 0x5C5;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_TIME_HELPTEXT = 0x5C6;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PAX = 0x5C7;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PAX_HELPTEXT = 0x5C8;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_MAIL = 0x5C9;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_MAIL_HELPTEXT = 0x5CA;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_ARMOURED = 0x5CB;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_ARMOURED_HELPTEXT = 0x5CC;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_DEFAULT = 0x5CD;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_DEFAULT_HELPTEXT = 0x5CE;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_MANUAL = 0x5CF;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_ASYMMETRIC = 0x5D0;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_ASYMMETRIC_EQ = 0x5D1;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_ASYMMETRIC_NEAREST = 0x5D2;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_SYMMETRIC = 0x5D3;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_ACCURACY = 0x5D4;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_ACCURACY_HELPTEXT = 0x5D5;
+static const StringID STR_CONFIG_SETTING_DEMAND_DISTANCE = 0x5D6;
+static const StringID STR_CONFIG_SETTING_DEMAND_DISTANCE_HELPTEXT = 0x5D7;
+static const StringID STR_CONFIG_SETTING_DEMAND_SIZE = 0x5D8;
+static const StringID STR_CONFIG_SETTING_DEMAND_SIZE_HELPTEXT = 0x5D9;
+static const StringID STR_CONFIG_SETTING_SHORT_PATH_SATURATION = 0x5DA;
+static const StringID STR_CONFIG_SETTING_SHORT_PATH_SATURATION_HELPTEXT = 0x5DB;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY = 0x5DC;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_NAUTICAL = 0x5DD;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_HELPTEXT = 0x5DE;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_IMPERIAL = 0x5DF;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_METRIC = 0x5E0;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_SI = 0x5E1;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_GAMEUNITS = 0x5E2;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VELOCITY_KNOTS = 0x5E3;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_POWER = 0x5E4;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_POWER_HELPTEXT = 0x5E5;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_POWER_IMPERIAL = 0x5E6;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_POWER_METRIC = 0x5E7;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_POWER_SI = 0x5E8;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_WEIGHT = 0x5E9;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_WEIGHT_HELPTEXT = 0x5EA;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_WEIGHT_IMPERIAL = 0x5EB;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_WEIGHT_METRIC = 0x5EC;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_WEIGHT_SI = 0x5ED;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VOLUME = 0x5EE;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VOLUME_HELPTEXT = 0x5EF;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VOLUME_IMPERIAL = 0x5F0;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VOLUME_METRIC = 0x5F1;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_VOLUME_SI = 0x5F2;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_FORCE = 0x5F3;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_FORCE_HELPTEXT = 0x5F4;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_FORCE_IMPERIAL = 0x5F5;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_FORCE_METRIC = 0x5F6;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_FORCE_SI = 0x5F7;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_HEIGHT = 0x5F8;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_HEIGHT_HELPTEXT = 0x5F9;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_HEIGHT_IMPERIAL = 0x5FA;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_HEIGHT_METRIC = 0x5FB;
+static const StringID STR_CONFIG_SETTING_LOCALISATION_UNITS_HEIGHT_SI = 0x5FC;
+static const StringID STR_CONFIG_SETTING_LOCALISATION = 0x5FD;
+static const StringID STR_CONFIG_SETTING_GRAPHICS = 0x5FE;
+static const StringID STR_CONFIG_SETTING_SOUND = 0x5FF;
+static const StringID STR_CONFIG_SETTING_INTERFACE = 0x600;
+static const StringID STR_CONFIG_SETTING_INTERFACE_GENERAL = 0x601;
+static const StringID STR_CONFIG_SETTING_INTERFACE_VIEWPORTS = 0x602;
+static const StringID STR_CONFIG_SETTING_INTERFACE_CONSTRUCTION = 0x603;
+static const StringID STR_CONFIG_SETTING_ADVISORS = 0x604;
+static const StringID STR_CONFIG_SETTING_COMPANY = 0x605;
+static const StringID STR_CONFIG_SETTING_ACCOUNTING = 0x606;
+static const StringID STR_CONFIG_SETTING_VEHICLES = 0x607;
+static const StringID STR_CONFIG_SETTING_VEHICLES_PHYSICS = 0x608;
+static const StringID STR_CONFIG_SETTING_VEHICLES_ROUTING = 0x609;
+static const StringID STR_CONFIG_SETTING_LIMITATIONS = 0x60A;
+static const StringID STR_CONFIG_SETTING_ACCIDENTS = 0x60B;
+static const StringID STR_CONFIG_SETTING_GENWORLD = 0x60C;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT = 0x60D;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_AUTHORITIES = 0x60E;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_TOWNS = 0x60F;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_INDUSTRIES = 0x610;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_CARGODIST = 0x611;
+static const StringID STR_CONFIG_SETTING_AI = 0x612;
+static const StringID STR_CONFIG_SETTING_AI_NPC = 0x613;
+static const StringID STR_CONFIG_SETTING_NETWORK = 0x614;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_TRAINS = 0x615;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_TRAINS_HELPTEXT = 0x616;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_ROAD_VEHICLES = 0x617;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_ROAD_VEHICLES_HELPTEXT = 0x618;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_SHIPS = 0x619;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_FOR_SHIPS_HELPTEXT = 0x61A;
+static const StringID STR_CONFIG_SETTING_REVERSE_AT_SIGNALS = 0x61B;
+static const StringID STR_CONFIG_SETTING_REVERSE_AT_SIGNALS_HELPTEXT = 0x61C;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_NPF = 0x61D;
+static const StringID STR_CONFIG_SETTING_PATHFINDER_YAPF = 0x61E;
+static const StringID STR_CONFIG_SETTING_QUERY_CAPTION = 0x61F;
+static const StringID STR_CONFIG_ERROR = 0x620;
+static const StringID STR_CONFIG_ERROR_ARRAY = 0x621;
+static const StringID STR_CONFIG_ERROR_INVALID_VALUE = 0x622;
+static const StringID STR_CONFIG_ERROR_TRAILING_CHARACTERS = 0x623;
+static const StringID STR_CONFIG_ERROR_DUPLICATE_GRFID = 0x624;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF = 0x625;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF_NOT_FOUND = 0x626;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF_UNSAFE = 0x627;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF_SYSTEM = 0x628;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF_INCOMPATIBLE = 0x629;
+static const StringID STR_CONFIG_ERROR_INVALID_GRF_UNKNOWN = 0x62A;
+static const StringID STR_CONFIG_ERROR_INVALID_SAVEGAME_COMPRESSION_LEVEL = 0x62B;
+static const StringID STR_CONFIG_ERROR_INVALID_SAVEGAME_COMPRESSION_ALGORITHM = 0x62C;
+static const StringID STR_CONFIG_ERROR_INVALID_BASE_GRAPHICS_NOT_FOUND = 0x62D;
+static const StringID STR_CONFIG_ERROR_INVALID_BASE_SOUNDS_NOT_FOUND = 0x62E;
+static const StringID STR_CONFIG_ERROR_INVALID_BASE_MUSIC_NOT_FOUND = 0x62F;
+static const StringID STR_CONFIG_ERROR_OUT_OF_MEMORY = 0x630;
+static const StringID STR_CONFIG_ERROR_SPRITECACHE_TOO_BIG = 0x631;
+static const StringID STR_VIDEO_DRIVER_ERROR = 0x632;
+static const StringID STR_VIDEO_DRIVER_ERROR_NO_HARDWARE_ACCELERATION = 0x633;
+static const StringID STR_INTRO_CAPTION = 0x634;
+static const StringID STR_INTRO_NEW_GAME = 0x635;
+static const StringID STR_INTRO_LOAD_GAME = 0x636;
+static const StringID STR_INTRO_PLAY_SCENARIO = 0x637;
+static const StringID STR_INTRO_PLAY_HEIGHTMAP = 0x638;
+static const StringID STR_INTRO_SCENARIO_EDITOR = 0x639;
+static const StringID STR_INTRO_MULTIPLAYER = 0x63A;
+static const StringID STR_INTRO_GAME_OPTIONS = 0x63B;
+static const StringID STR_INTRO_HIGHSCORE = 0x63C;
+static const StringID STR_INTRO_CONFIG_SETTINGS_TREE = 0x63D;
+static const StringID STR_INTRO_NEWGRF_SETTINGS = 0x63E;
+static const StringID STR_INTRO_ONLINE_CONTENT = 0x63F;
+static const StringID STR_INTRO_AI_SETTINGS = 0x640;
+static const StringID STR_INTRO_GAMESCRIPT_SETTINGS = 0x641;
+static const StringID STR_INTRO_QUIT = 0x642;
+static const StringID STR_INTRO_TOOLTIP_NEW_GAME = 0x643;
+static const StringID STR_INTRO_TOOLTIP_LOAD_GAME = 0x644;
+static const StringID STR_INTRO_TOOLTIP_PLAY_HEIGHTMAP = 0x645;
+static const StringID STR_INTRO_TOOLTIP_PLAY_SCENARIO = 0x646;
+static const StringID STR_INTRO_TOOLTIP_SCENARIO_EDITOR = 0x647;
+static const StringID STR_INTRO_TOOLTIP_MULTIPLAYER = 0x648;
+static const StringID STR_INTRO_TOOLTIP_TEMPERATE = 0x649;
+static const StringID STR_INTRO_TOOLTIP_SUB_ARCTIC_LANDSCAPE = 0x64A;
+static const StringID STR_INTRO_TOOLTIP_SUB_TROPICAL_LANDSCAPE = 0x64B;
+static const StringID STR_INTRO_TOOLTIP_TOYLAND_LANDSCAPE = 0x64C;
+static const StringID STR_INTRO_TOOLTIP_GAME_OPTIONS = 0x64D;
+static const StringID STR_INTRO_TOOLTIP_HIGHSCORE = 0x64E;
+static const StringID STR_INTRO_TOOLTIP_CONFIG_SETTINGS_TREE = 0x64F;
+static const StringID STR_INTRO_TOOLTIP_NEWGRF_SETTINGS = 0x650;
+static const StringID STR_INTRO_TOOLTIP_ONLINE_CONTENT = 0x651;
+static const StringID STR_INTRO_TOOLTIP_AI_SETTINGS = 0x652;
+static const StringID STR_INTRO_TOOLTIP_GAMESCRIPT_SETTINGS = 0x653;
+static const StringID STR_INTRO_TOOLTIP_QUIT = 0x654;
+static const StringID STR_INTRO_BASESET = 0x655;
+static const StringID STR_INTRO_TRANSLATION = 0x656;
+static const StringID STR_QUIT_CAPTION = 0x657;
+static const StringID STR_QUIT_ARE_YOU_SURE_YOU_WANT_TO_EXIT_OPENTTD = 0x658;
+static const StringID STR_QUIT_YES = 0x659;
+static const StringID STR_QUIT_NO = 0x65A;
+static const StringID STR_ABANDON_GAME_CAPTION = 0x65B;
+static const StringID STR_ABANDON_GAME_QUERY = 0x65C;
+static const StringID STR_ABANDON_SCENARIO_QUERY = 0x65D;
+static const StringID STR_CHEATS = 0x65E;
+static const StringID STR_CHEATS_TOOLTIP = 0x65F;
+static const StringID STR_CHEATS_NOTE = 0x660;
+static const StringID STR_CHEAT_MONEY = 0x661;
+static const StringID STR_CHEAT_CHANGE_COMPANY = 0x662;
+static const StringID STR_CHEAT_EXTRA_DYNAMITE = 0x663;
+static const StringID STR_CHEAT_CROSSINGTUNNELS = 0x664;
+static const StringID STR_CHEAT_NO_JETCRASH = 0x665;
+static const StringID STR_CHEAT_EDIT_MAX_HL = 0x666;
+static const StringID STR_CHEAT_EDIT_MAX_HL_QUERY_CAPT = 0x667;
+static const StringID STR_CHEAT_CHANGE_DATE = 0x668;
+static const StringID STR_CHEAT_CHANGE_DATE_QUERY_CAPT = 0x669;
+static const StringID STR_CHEAT_SETUP_PROD = 0x66A;
+static const StringID STR_LIVERY_CAPTION = 0x66B;
+static const StringID STR_LIVERY_GENERAL_TOOLTIP = 0x66C;
+static const StringID STR_LIVERY_TRAIN_TOOLTIP = 0x66D;
+static const StringID STR_LIVERY_ROAD_VEHICLE_TOOLTIP = 0x66E;
+static const StringID STR_LIVERY_SHIP_TOOLTIP = 0x66F;
+static const StringID STR_LIVERY_AIRCRAFT_TOOLTIP = 0x670;
+static const StringID STR_LIVERY_PRIMARY_TOOLTIP = 0x671;
+static const StringID STR_LIVERY_SECONDARY_TOOLTIP = 0x672;
+static const StringID STR_LIVERY_PANEL_TOOLTIP = 0x673;
+static const StringID STR_LIVERY_DEFAULT = 0x674;
+static const StringID STR_LIVERY_STEAM = 0x675;
+static const StringID STR_LIVERY_DIESEL = 0x676;
+static const StringID STR_LIVERY_ELECTRIC = 0x677;
+static const StringID STR_LIVERY_MONORAIL = 0x678;
+static const StringID STR_LIVERY_MAGLEV = 0x679;
+static const StringID STR_LIVERY_DMU = 0x67A;
+static const StringID STR_LIVERY_EMU = 0x67B;
+static const StringID STR_LIVERY_PASSENGER_WAGON_STEAM = 0x67C;
+static const StringID STR_LIVERY_PASSENGER_WAGON_DIESEL = 0x67D;
+static const StringID STR_LIVERY_PASSENGER_WAGON_ELECTRIC = 0x67E;
+static const StringID STR_LIVERY_PASSENGER_WAGON_MONORAIL = 0x67F;
+static const StringID STR_LIVERY_PASSENGER_WAGON_MAGLEV = 0x680;
+static const StringID STR_LIVERY_FREIGHT_WAGON = 0x681;
+static const StringID STR_LIVERY_BUS = 0x682;
+static const StringID STR_LIVERY_TRUCK = 0x683;
+static const StringID STR_LIVERY_PASSENGER_SHIP = 0x684;
+static const StringID STR_LIVERY_FREIGHT_SHIP = 0x685;
+static const StringID STR_LIVERY_HELICOPTER = 0x686;
+static const StringID STR_LIVERY_SMALL_PLANE = 0x687;
+static const StringID STR_LIVERY_LARGE_PLANE = 0x688;
+static const StringID STR_LIVERY_PASSENGER_TRAM = 0x689;
+static const StringID STR_LIVERY_FREIGHT_TRAM = 0x68A;
+static const StringID STR_FACE_CAPTION = 0x68B;
+static const StringID STR_FACE_CANCEL_TOOLTIP = 0x68C;
+static const StringID STR_FACE_OK_TOOLTIP = 0x68D;
+static const StringID STR_FACE_RANDOM = 0x68E;
+static const StringID STR_FACE_MALE_BUTTON = 0x68F;
+static const StringID STR_FACE_MALE_TOOLTIP = 0x690;
+static const StringID STR_FACE_FEMALE_BUTTON = 0x691;
+static const StringID STR_FACE_FEMALE_TOOLTIP = 0x692;
+static const StringID STR_FACE_NEW_FACE_BUTTON = 0x693;
+static const StringID STR_FACE_NEW_FACE_TOOLTIP = 0x694;
+static const StringID STR_FACE_ADVANCED = 0x695;
+static const StringID STR_FACE_ADVANCED_TOOLTIP = 0x696;
+static const StringID STR_FACE_SIMPLE = 0x697;
+static const StringID STR_FACE_SIMPLE_TOOLTIP = 0x698;
+static const StringID STR_FACE_LOAD = 0x699;
+static const StringID STR_FACE_LOAD_TOOLTIP = 0x69A;
+static const StringID STR_FACE_LOAD_DONE = 0x69B;
+static const StringID STR_FACE_FACECODE = 0x69C;
+static const StringID STR_FACE_FACECODE_TOOLTIP = 0x69D;
+static const StringID STR_FACE_FACECODE_CAPTION = 0x69E;
+static const StringID STR_FACE_FACECODE_SET = 0x69F;
+static const StringID STR_FACE_FACECODE_ERR = 0x6A0;
+static const StringID STR_FACE_SAVE = 0x6A1;
+static const StringID STR_FACE_SAVE_TOOLTIP = 0x6A2;
+static const StringID STR_FACE_SAVE_DONE = 0x6A3;
+static const StringID STR_FACE_EUROPEAN = 0x6A4;
+static const StringID STR_FACE_SELECT_EUROPEAN = 0x6A5;
+static const StringID STR_FACE_AFRICAN = 0x6A6;
+static const StringID STR_FACE_SELECT_AFRICAN = 0x6A7;
+static const StringID STR_FACE_YES = 0x6A8;
+static const StringID STR_FACE_NO = 0x6A9;
+static const StringID STR_FACE_MOUSTACHE_EARRING_TOOLTIP = 0x6AA;
+static const StringID STR_FACE_HAIR = 0x6AB;
+static const StringID STR_FACE_HAIR_TOOLTIP = 0x6AC;
+static const StringID STR_FACE_EYEBROWS = 0x6AD;
+static const StringID STR_FACE_EYEBROWS_TOOLTIP = 0x6AE;
+static const StringID STR_FACE_EYECOLOUR = 0x6AF;
+static const StringID STR_FACE_EYECOLOUR_TOOLTIP = 0x6B0;
+static const StringID STR_FACE_GLASSES = 0x6B1;
+static const StringID STR_FACE_GLASSES_TOOLTIP = 0x6B2;
+static const StringID STR_FACE_GLASSES_TOOLTIP_2 = 0x6B3;
+static const StringID STR_FACE_NOSE = 0x6B4;
+static const StringID STR_FACE_NOSE_TOOLTIP = 0x6B5;
+static const StringID STR_FACE_LIPS = 0x6B6;
+static const StringID STR_FACE_MOUSTACHE = 0x6B7;
+static const StringID STR_FACE_LIPS_MOUSTACHE_TOOLTIP = 0x6B8;
+static const StringID STR_FACE_CHIN = 0x6B9;
+static const StringID STR_FACE_CHIN_TOOLTIP = 0x6BA;
+static const StringID STR_FACE_JACKET = 0x6BB;
+static const StringID STR_FACE_JACKET_TOOLTIP = 0x6BC;
+static const StringID STR_FACE_COLLAR = 0x6BD;
+static const StringID STR_FACE_COLLAR_TOOLTIP = 0x6BE;
+static const StringID STR_FACE_TIE = 0x6BF;
+static const StringID STR_FACE_EARRING = 0x6C0;
+static const StringID STR_FACE_TIE_EARRING_TOOLTIP = 0x6C1;
+static const StringID STR_NETWORK_SERVER_VISIBILITY_LOCAL = 0x6C2;
+static const StringID STR_NETWORK_SERVER_VISIBILITY_PUBLIC = 0x6C3;
+static const StringID STR_NETWORK_SERVER_VISIBILITY_INVITE_ONLY = 0x6C4;
+static const StringID STR_NETWORK_SERVER_LIST_CAPTION = 0x6C5;
+static const StringID STR_NETWORK_SERVER_LIST_PLAYER_NAME = 0x6C6;
+static const StringID STR_NETWORK_SERVER_LIST_ENTER_NAME_TOOLTIP = 0x6C7;
+static const StringID STR_NETWORK_SERVER_LIST_GAME_NAME = 0x6C8;
+static const StringID STR_NETWORK_SERVER_LIST_GAME_NAME_TOOLTIP = 0x6C9;
+static const StringID STR_NETWORK_SERVER_LIST_GENERAL_ONLINE = 0x6CA;
+static const StringID STR_NETWORK_SERVER_LIST_CLIENTS_CAPTION = 0x6CB;
+static const StringID STR_NETWORK_SERVER_LIST_CLIENTS_CAPTION_TOOLTIP = 0x6CC;
+static const StringID STR_NETWORK_SERVER_LIST_MAP_SIZE_SHORT = 0x6CD;
+static const StringID STR_NETWORK_SERVER_LIST_MAP_SIZE_CAPTION = 0x6CE;
+static const StringID STR_NETWORK_SERVER_LIST_MAP_SIZE_CAPTION_TOOLTIP = 0x6CF;
+static const StringID STR_NETWORK_SERVER_LIST_DATE_CAPTION = 0x6D0;
+static const StringID STR_NETWORK_SERVER_LIST_DATE_CAPTION_TOOLTIP = 0x6D1;
+static const StringID STR_NETWORK_SERVER_LIST_YEARS_CAPTION = 0x6D2;
+static const StringID STR_NETWORK_SERVER_LIST_YEARS_CAPTION_TOOLTIP = 0x6D3;
+static const StringID STR_NETWORK_SERVER_LIST_INFO_ICONS_TOOLTIP = 0x6D4;
+static const StringID STR_NETWORK_SERVER_LIST_CLICK_GAME_TO_SELECT = 0x6D5;
+static const StringID STR_NETWORK_SERVER_LIST_LAST_JOINED_SERVER = 0x6D6;
+static const StringID STR_NETWORK_SERVER_LIST_CLICK_TO_SELECT_LAST = 0x6D7;
+static const StringID STR_NETWORK_SERVER_LIST_GAME_INFO = 0x6D8;
+static const StringID STR_NETWORK_SERVER_LIST_CLIENTS = 0x6D9;
+static const StringID STR_NETWORK_SERVER_LIST_LANDSCAPE = 0x6DA;
+static const StringID STR_NETWORK_SERVER_LIST_MAP_SIZE = 0x6DB;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_VERSION = 0x6DC;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_ADDRESS = 0x6DD;
+static const StringID STR_NETWORK_SERVER_LIST_INVITE_CODE = 0x6DE;
+static const StringID STR_NETWORK_SERVER_LIST_START_DATE = 0x6DF;
+static const StringID STR_NETWORK_SERVER_LIST_CURRENT_DATE = 0x6E0;
+static const StringID STR_NETWORK_SERVER_LIST_GAMESCRIPT = 0x6E1;
+static const StringID STR_NETWORK_SERVER_LIST_PASSWORD = 0x6E2;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_OFFLINE = 0x6E3;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_FULL = 0x6E4;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_BANNED = 0x6E5;
+static const StringID STR_NETWORK_SERVER_LIST_SERVER_TOO_OLD = 0x6E6;
+static const StringID STR_NETWORK_SERVER_LIST_VERSION_MISMATCH = 0x6E7;
+static const StringID STR_NETWORK_SERVER_LIST_GRF_MISMATCH = 0x6E8;
+static const StringID STR_NETWORK_SERVER_LIST_JOIN_GAME = 0x6E9;
+static const StringID STR_NETWORK_SERVER_LIST_REFRESH = 0x6EA;
+static const StringID STR_NETWORK_SERVER_LIST_REFRESH_TOOLTIP = 0x6EB;
+static const StringID STR_NETWORK_SERVER_LIST_SEARCH_SERVER_INTERNET = 0x6EC;
+static const StringID STR_NETWORK_SERVER_LIST_SEARCH_SERVER_INTERNET_TOOLTIP = 0x6ED;
+static const StringID STR_NETWORK_SERVER_LIST_SEARCH_SERVER_LAN = 0x6EE;
+static const StringID STR_NETWORK_SERVER_LIST_SEARCH_SERVER_LAN_TOOLTIP = 0x6EF;
+static const StringID STR_NETWORK_SERVER_LIST_ADD_SERVER = 0x6F0;
+static const StringID STR_NETWORK_SERVER_LIST_ADD_SERVER_TOOLTIP = 0x6F1;
+static const StringID STR_NETWORK_SERVER_LIST_START_SERVER = 0x6F2;
+static const StringID STR_NETWORK_SERVER_LIST_START_SERVER_TOOLTIP = 0x6F3;
+static const StringID STR_NETWORK_SERVER_LIST_PLAYER_NAME_OSKTITLE = 0x6F4;
+static const StringID STR_NETWORK_SERVER_LIST_ENTER_SERVER_ADDRESS = 0x6F5;
+static const StringID STR_NETWORK_START_SERVER_CAPTION = 0x6F6;
+static const StringID STR_NETWORK_START_SERVER_NEW_GAME_NAME = 0x6F7;
+static const StringID STR_NETWORK_START_SERVER_NEW_GAME_NAME_TOOLTIP = 0x6F8;
+static const StringID STR_NETWORK_START_SERVER_SET_PASSWORD = 0x6F9;
+static const StringID STR_NETWORK_START_SERVER_PASSWORD_TOOLTIP = 0x6FA;
+static const StringID STR_NETWORK_START_SERVER_VISIBILITY_LABEL = 0x6FB;
+static const StringID STR_NETWORK_START_SERVER_VISIBILITY_TOOLTIP = 0x6FC;
+static const StringID STR_NETWORK_START_SERVER_CLIENTS_SELECT = 0x6FD;
+static const StringID STR_NETWORK_START_SERVER_NUMBER_OF_CLIENTS = 0x6FE;
+static const StringID STR_NETWORK_START_SERVER_NUMBER_OF_CLIENTS_TOOLTIP = 0x6FF;
+static const StringID STR_NETWORK_START_SERVER_COMPANIES_SELECT = 0x700;
+static const StringID STR_NETWORK_START_SERVER_NUMBER_OF_COMPANIES = 0x701;
+static const StringID STR_NETWORK_START_SERVER_NUMBER_OF_COMPANIES_TOOLTIP = 0x702;
+static const StringID STR_NETWORK_START_SERVER_NEW_GAME_NAME_OSKTITLE = 0x703;
+static const StringID STR_NETWORK_CONNECTING_CAPTION = 0x704;
+static const StringID STR_NETWORK_CONNECTING_WAITING = 0x705;
+static const StringID STR_NETWORK_CONNECTING_DOWNLOADING_1 = 0x706;
+static const StringID STR_NETWORK_CONNECTING_DOWNLOADING_2 = 0x707;
+static const StringID STR_NETWORK_CONNECTING_1 = 0x708;
+static const StringID STR_NETWORK_CONNECTING_2 = 0x709;
+static const StringID STR_NETWORK_CONNECTING_3 = 0x70A;
+static const StringID STR_NETWORK_CONNECTING_4 = 0x70B;
+static const StringID STR_NETWORK_CONNECTING_5 = 0x70C;
+static const StringID STR_NETWORK_CONNECTING_6 = 0x70D;
+static const StringID STR_NETWORK_CONNECTING_SPECIAL_1 = 0x70E;
+static const StringID STR_NETWORK_CONNECTING_SPECIAL_2 = 0x70F;
+static const StringID STR_NETWORK_CONNECTION_DISCONNECT = 0x710;
+static const StringID STR_NETWORK_NEED_GAME_PASSWORD_CAPTION = 0x711;
+static const StringID STR_NETWORK_NEED_COMPANY_PASSWORD_CAPTION = 0x712;
+static const StringID STR_NETWORK_COMPANY_LIST_CLIENT_LIST = 0x713;
+static const StringID STR_NETWORK_COMPANY_LIST_SPECTATE = 0x714;
+static const StringID STR_NETWORK_CLIENT_LIST_CAPTION = 0x715;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER = 0x716;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_NAME = 0x717;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_NAME_TOOLTIP = 0x718;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_NAME_EDIT_TOOLTIP = 0x719;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_NAME_QUERY_CAPTION = 0x71A;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_VISIBILITY = 0x71B;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_VISIBILITY_TOOLTIP = 0x71C;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_INVITE_CODE = 0x71D;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_INVITE_CODE_TOOLTIP = 0x71E;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE = 0x71F;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_TOOLTIP = 0x720;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER = 0x721;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_NAME = 0x722;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_NAME_TOOLTIP = 0x723;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_NAME_EDIT_TOOLTIP = 0x724;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_NAME_QUERY_CAPTION = 0x725;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_CLIENT_TOOLTIP = 0x726;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_COMPANY_TOOLTIP = 0x727;
+static const StringID STR_NETWORK_CLIENT_LIST_JOIN_TOOLTIP = 0x728;
+static const StringID STR_NETWORK_CLIENT_LIST_CHAT_CLIENT_TOOLTIP = 0x729;
+static const StringID STR_NETWORK_CLIENT_LIST_CHAT_COMPANY_TOOLTIP = 0x72A;
+static const StringID STR_NETWORK_CLIENT_LIST_CHAT_SPECTATOR_TOOLTIP = 0x72B;
+static const StringID STR_NETWORK_CLIENT_LIST_SPECTATORS = 0x72C;
+static const StringID STR_NETWORK_CLIENT_LIST_NEW_COMPANY = 0x72D;
+static const StringID STR_NETWORK_CLIENT_LIST_NEW_COMPANY_TOOLTIP = 0x72E;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_ICON_SELF_TOOLTIP = 0x72F;
+static const StringID STR_NETWORK_CLIENT_LIST_PLAYER_ICON_HOST_TOOLTIP = 0x730;
+static const StringID STR_NETWORK_CLIENT_LIST_CLIENT_COMPANY_COUNT = 0x731;
+static const StringID STR_NETWORK_CLIENT_LIST_CLIENT_COMPANY_COUNT_TOOLTIP = 0x732;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_UNKNOWN = 0x733;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_ISOLATED = 0x734;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_DIRECT = 0x735;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_STUN = 0x736;
+static const StringID STR_NETWORK_CLIENT_LIST_SERVER_CONNECTION_TYPE_TURN = 0x737;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_CLIENT_KICK = 0x738;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_CLIENT_BAN = 0x739;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_COMPANY_RESET = 0x73A;
+static const StringID STR_NETWORK_CLIENT_LIST_ADMIN_COMPANY_UNLOCK = 0x73B;
+static const StringID STR_NETWORK_CLIENT_LIST_ASK_CAPTION = 0x73C;
+static const StringID STR_NETWORK_CLIENT_LIST_ASK_CLIENT_KICK = 0x73D;
+static const StringID STR_NETWORK_CLIENT_LIST_ASK_CLIENT_BAN = 0x73E;
+static const StringID STR_NETWORK_CLIENT_LIST_ASK_COMPANY_RESET = 0x73F;
+static const StringID STR_NETWORK_CLIENT_LIST_ASK_COMPANY_UNLOCK = 0x740;
+static const StringID STR_NETWORK_ASK_RELAY_CAPTION = 0x741;
+static const StringID STR_NETWORK_ASK_RELAY_TEXT = 0x742;
+static const StringID STR_NETWORK_ASK_RELAY_NO = 0x743;
+static const StringID STR_NETWORK_ASK_RELAY_YES_ONCE = 0x744;
+static const StringID STR_NETWORK_ASK_RELAY_YES_ALWAYS = 0x745;
+static const StringID STR_NETWORK_SPECTATORS = 0x746;
+static const StringID STR_COMPANY_PASSWORD_CANCEL = 0x747;
+static const StringID STR_COMPANY_PASSWORD_OK = 0x748;
+static const StringID STR_COMPANY_PASSWORD_CAPTION = 0x749;
+static const StringID STR_COMPANY_PASSWORD_MAKE_DEFAULT = 0x74A;
+static const StringID STR_COMPANY_PASSWORD_MAKE_DEFAULT_TOOLTIP = 0x74B;
+static const StringID STR_COMPANY_VIEW_JOIN = 0x74C;
+static const StringID STR_COMPANY_VIEW_JOIN_TOOLTIP = 0x74D;
+static const StringID STR_COMPANY_VIEW_PASSWORD = 0x74E;
+static const StringID STR_COMPANY_VIEW_PASSWORD_TOOLTIP = 0x74F;
+static const StringID STR_COMPANY_VIEW_SET_PASSWORD = 0x750;
+static const StringID STR_NETWORK_CHAT_SEND = 0x751;
+static const StringID STR_NETWORK_CHAT_COMPANY_CAPTION = 0x752;
+static const StringID STR_NETWORK_CHAT_CLIENT_CAPTION = 0x753;
+static const StringID STR_NETWORK_CHAT_ALL_CAPTION = 0x754;
+static const StringID STR_NETWORK_CHAT_COMPANY = 0x755;
+static const StringID STR_NETWORK_CHAT_TO_COMPANY = 0x756;
+static const StringID STR_NETWORK_CHAT_CLIENT = 0x757;
+static const StringID STR_NETWORK_CHAT_TO_CLIENT = 0x758;
+static const StringID STR_NETWORK_CHAT_ALL = 0x759;
+static const StringID STR_NETWORK_CHAT_EXTERNAL = 0x75A;
+static const StringID STR_NETWORK_CHAT_OSKTITLE = 0x75B;
+static const StringID STR_NETWORK_ERROR_NOTAVAILABLE = 0x75C;
+static const StringID STR_NETWORK_ERROR_NOCONNECTION = 0x75D;
+static const StringID STR_NETWORK_ERROR_NEWGRF_MISMATCH = 0x75E;
+static const StringID STR_NETWORK_ERROR_DESYNC = 0x75F;
+static const StringID STR_NETWORK_ERROR_LOSTCONNECTION = 0x760;
+static const StringID STR_NETWORK_ERROR_SAVEGAMEERROR = 0x761;
+static const StringID STR_NETWORK_ERROR_SERVER_START = 0x762;
+static const StringID STR_NETWORK_ERROR_SERVER_ERROR = 0x763;
+static const StringID STR_NETWORK_ERROR_BAD_PLAYER_NAME = 0x764;
+static const StringID STR_NETWORK_ERROR_BAD_SERVER_NAME = 0x765;
+static const StringID STR_NETWORK_ERROR_WRONG_REVISION = 0x766;
+static const StringID STR_NETWORK_ERROR_WRONG_PASSWORD = 0x767;
+static const StringID STR_NETWORK_ERROR_SERVER_FULL = 0x768;
+static const StringID STR_NETWORK_ERROR_SERVER_BANNED = 0x769;
+static const StringID STR_NETWORK_ERROR_KICKED = 0x76A;
+static const StringID STR_NETWORK_ERROR_KICK_MESSAGE = 0x76B;
+static const StringID STR_NETWORK_ERROR_CHEATER = 0x76C;
+static const StringID STR_NETWORK_ERROR_TOO_MANY_COMMANDS = 0x76D;
+static const StringID STR_NETWORK_ERROR_TIMEOUT_PASSWORD = 0x76E;
+static const StringID STR_NETWORK_ERROR_TIMEOUT_COMPUTER = 0x76F;
+static const StringID STR_NETWORK_ERROR_TIMEOUT_MAP = 0x770;
+static const StringID STR_NETWORK_ERROR_TIMEOUT_JOIN = 0x771;
+static const StringID STR_NETWORK_ERROR_INVALID_CLIENT_NAME = 0x772;
+static const StringID STR_NETWORK_ERROR_CLIENT_GUI_LOST_CONNECTION_CAPTION = 0x773;
+static const StringID STR_NETWORK_ERROR_CLIENT_GUI_LOST_CONNECTION = 0x774;
+static const StringID STR_NETWORK_ERROR_CLIENT_GENERAL = 0x775;
+static const StringID STR_NETWORK_ERROR_CLIENT_DESYNC = 0x776;
+static const StringID STR_NETWORK_ERROR_CLIENT_SAVEGAME = 0x777;
+static const StringID STR_NETWORK_ERROR_CLIENT_CONNECTION_LOST = 0x778;
+static const StringID STR_NETWORK_ERROR_CLIENT_PROTOCOL_ERROR = 0x779;
+static const StringID STR_NETWORK_ERROR_CLIENT_NEWGRF_MISMATCH = 0x77A;
+static const StringID STR_NETWORK_ERROR_CLIENT_NOT_AUTHORIZED = 0x77B;
+static const StringID STR_NETWORK_ERROR_CLIENT_NOT_EXPECTED = 0x77C;
+static const StringID STR_NETWORK_ERROR_CLIENT_WRONG_REVISION = 0x77D;
+static const StringID STR_NETWORK_ERROR_CLIENT_NAME_IN_USE = 0x77E;
+static const StringID STR_NETWORK_ERROR_CLIENT_WRONG_PASSWORD = 0x77F;
+static const StringID STR_NETWORK_ERROR_CLIENT_COMPANY_MISMATCH = 0x780;
+static const StringID STR_NETWORK_ERROR_CLIENT_KICKED = 0x781;
+static const StringID STR_NETWORK_ERROR_CLIENT_CHEATER = 0x782;
+static const StringID STR_NETWORK_ERROR_CLIENT_SERVER_FULL = 0x783;
+static const StringID STR_NETWORK_ERROR_CLIENT_TOO_MANY_COMMANDS = 0x784;
+static const StringID STR_NETWORK_ERROR_CLIENT_TIMEOUT_PASSWORD = 0x785;
+static const StringID STR_NETWORK_ERROR_CLIENT_TIMEOUT_COMPUTER = 0x786;
+static const StringID STR_NETWORK_ERROR_CLIENT_TIMEOUT_MAP = 0x787;
+static const StringID STR_NETWORK_ERROR_CLIENT_TIMEOUT_JOIN = 0x788;
+static const StringID STR_NETWORK_ERROR_CLIENT_INVALID_CLIENT_NAME = 0x789;
+static const StringID STR_NETWORK_SERVER_MESSAGE = 0x78A;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_PAUSED = 0x78B;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_STILL_PAUSED_1 = 0x78C;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_STILL_PAUSED_2 = 0x78D;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_STILL_PAUSED_3 = 0x78E;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_STILL_PAUSED_4 = 0x78F;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_STILL_PAUSED_5 = 0x790;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_UNPAUSED = 0x791;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_REASON_NOT_ENOUGH_PLAYERS = 0x792;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_REASON_CONNECTING_CLIENTS = 0x793;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_REASON_MANUAL = 0x794;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_REASON_GAME_SCRIPT = 0x795;
+static const StringID STR_NETWORK_SERVER_MESSAGE_GAME_REASON_LINK_GRAPH = 0x796;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_LEAVING = 0x797;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_JOINED = 0x798;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_JOINED_ID = 0x799;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_COMPANY_JOIN = 0x79A;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_COMPANY_SPECTATE = 0x79B;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_COMPANY_NEW = 0x79C;
+static const StringID STR_NETWORK_MESSAGE_CLIENT_LEFT = 0x79D;
+static const StringID STR_NETWORK_MESSAGE_NAME_CHANGE = 0x79E;
+static const StringID STR_NETWORK_MESSAGE_GIVE_MONEY = 0x79F;
+static const StringID STR_NETWORK_MESSAGE_SERVER_SHUTDOWN = 0x7A0;
+static const StringID STR_NETWORK_MESSAGE_SERVER_REBOOT = 0x7A1;
+static const StringID STR_NETWORK_MESSAGE_KICKED = 0x7A2;
+static const StringID STR_NETWORK_ERROR_COORDINATOR_REGISTRATION_FAILED = 0x7A3;
+static const StringID STR_NETWORK_ERROR_COORDINATOR_REUSE_OF_INVITE_CODE = 0x7A4;
+static const StringID STR_NETWORK_ERROR_COORDINATOR_ISOLATED = 0x7A5;
+static const StringID STR_NETWORK_ERROR_COORDINATOR_ISOLATED_DETAIL = 0x7A6;
+static const StringID STR_CONTENT_TITLE = 0x7A7;
+static const StringID STR_CONTENT_TYPE_CAPTION = 0x7A8;
+static const StringID STR_CONTENT_TYPE_CAPTION_TOOLTIP = 0x7A9;
+static const StringID STR_CONTENT_NAME_CAPTION = 0x7AA;
+static const StringID STR_CONTENT_NAME_CAPTION_TOOLTIP = 0x7AB;
+static const StringID STR_CONTENT_MATRIX_TOOLTIP = 0x7AC;
+static const StringID STR_CONTENT_SELECT_ALL_CAPTION = 0x7AD;
+static const StringID STR_CONTENT_SELECT_ALL_CAPTION_TOOLTIP = 0x7AE;
+static const StringID STR_CONTENT_SELECT_UPDATES_CAPTION = 0x7AF;
+static const StringID STR_CONTENT_SELECT_UPDATES_CAPTION_TOOLTIP = 0x7B0;
+static const StringID STR_CONTENT_UNSELECT_ALL_CAPTION = 0x7B1;
+static const StringID STR_CONTENT_UNSELECT_ALL_CAPTION_TOOLTIP = 0x7B2;
+static const StringID STR_CONTENT_SEARCH_EXTERNAL = 0x7B3;
+static const StringID STR_CONTENT_SEARCH_EXTERNAL_TOOLTIP = 0x7B4;
+static const StringID STR_CONTENT_SEARCH_EXTERNAL_DISCLAIMER_CAPTION = 0x7B5;
+static const StringID STR_CONTENT_SEARCH_EXTERNAL_DISCLAIMER = 0x7B6;
+static const StringID STR_CONTENT_FILTER_TITLE = 0x7B7;
+static const StringID STR_CONTENT_OPEN_URL = 0x7B8;
+static const StringID STR_CONTENT_OPEN_URL_TOOLTIP = 0x7B9;
+static const StringID STR_CONTENT_DOWNLOAD_CAPTION = 0x7BA;
+static const StringID STR_CONTENT_DOWNLOAD_CAPTION_TOOLTIP = 0x7BB;
+static const StringID STR_CONTENT_TOTAL_DOWNLOAD_SIZE = 0x7BC;
+static const StringID STR_CONTENT_DETAIL_TITLE = 0x7BD;
+static const StringID STR_CONTENT_DETAIL_SUBTITLE_UNSELECTED = 0x7BE;
+static const StringID STR_CONTENT_DETAIL_SUBTITLE_SELECTED = 0x7BF;
+static const StringID STR_CONTENT_DETAIL_SUBTITLE_AUTOSELECTED = 0x7C0;
+static const StringID STR_CONTENT_DETAIL_SUBTITLE_ALREADY_HERE = 0x7C1;
+static const StringID STR_CONTENT_DETAIL_SUBTITLE_DOES_NOT_EXIST = 0x7C2;
+static const StringID STR_CONTENT_DETAIL_UPDATE = 0x7C3;
+static const StringID STR_CONTENT_DETAIL_NAME = 0x7C4;
+static const StringID STR_CONTENT_DETAIL_VERSION = 0x7C5;
+static const StringID STR_CONTENT_DETAIL_DESCRIPTION = 0x7C6;
+static const StringID STR_CONTENT_DETAIL_URL = 0x7C7;
+static const StringID STR_CONTENT_DETAIL_TYPE = 0x7C8;
+static const StringID STR_CONTENT_DETAIL_FILESIZE = 0x7C9;
+static const StringID STR_CONTENT_DETAIL_SELECTED_BECAUSE_OF = 0x7CA;
+static const StringID STR_CONTENT_DETAIL_DEPENDENCIES = 0x7CB;
+static const StringID STR_CONTENT_DETAIL_TAGS = 0x7CC;
+static const StringID STR_CONTENT_NO_ZLIB = 0x7CD;
+static const StringID STR_CONTENT_NO_ZLIB_SUB = 0x7CE;
+static const StringID STR_CONTENT_TYPE_BASE_GRAPHICS = 0x7CF;
+static const StringID STR_CONTENT_TYPE_NEWGRF = 0x7D0;
+static const StringID STR_CONTENT_TYPE_AI = 0x7D1;
+static const StringID STR_CONTENT_TYPE_AI_LIBRARY = 0x7D2;
+static const StringID STR_CONTENT_TYPE_SCENARIO = 0x7D3;
+static const StringID STR_CONTENT_TYPE_HEIGHTMAP = 0x7D4;
+static const StringID STR_CONTENT_TYPE_BASE_SOUNDS = 0x7D5;
+static const StringID STR_CONTENT_TYPE_BASE_MUSIC = 0x7D6;
+static const StringID STR_CONTENT_TYPE_GAME_SCRIPT = 0x7D7;
+static const StringID STR_CONTENT_TYPE_GS_LIBRARY = 0x7D8;
+static const StringID STR_CONTENT_DOWNLOAD_TITLE = 0x7D9;
+static const StringID STR_CONTENT_DOWNLOAD_INITIALISE = 0x7DA;
+static const StringID STR_CONTENT_DOWNLOAD_FILE = 0x7DB;
+static const StringID STR_CONTENT_DOWNLOAD_COMPLETE = 0x7DC;
+static const StringID STR_CONTENT_DOWNLOAD_PROGRESS_SIZE = 0x7DD;
+static const StringID STR_CONTENT_ERROR_COULD_NOT_CONNECT = 0x7DE;
+static const StringID STR_CONTENT_ERROR_COULD_NOT_DOWNLOAD = 0x7DF;
+static const StringID STR_CONTENT_ERROR_COULD_NOT_DOWNLOAD_FILE_NOT_WRITABLE = 0x7E0;
+static const StringID STR_CONTENT_ERROR_COULD_NOT_EXTRACT = 0x7E1;
+static const StringID STR_MISSING_GRAPHICS_SET_CAPTION = 0x7E2;
+static const StringID STR_MISSING_GRAPHICS_SET_MESSAGE = 0x7E3;
+static const StringID STR_MISSING_GRAPHICS_YES_DOWNLOAD = 0x7E4;
+static const StringID STR_MISSING_GRAPHICS_NO_QUIT = 0x7E5;
+static const StringID STR_MISSING_GRAPHICS_ERROR_TITLE = 0x7E6;
+static const StringID STR_MISSING_GRAPHICS_ERROR = 0x7E7;
+static const StringID STR_MISSING_GRAPHICS_ERROR_QUIT = 0x7E8;
+static const StringID STR_TRANSPARENCY_CAPTION = 0x7E9;
+static const StringID STR_TRANSPARENT_SIGNS_TOOLTIP = 0x7EA;
+static const StringID STR_TRANSPARENT_TREES_TOOLTIP = 0x7EB;
+static const StringID STR_TRANSPARENT_HOUSES_TOOLTIP = 0x7EC;
+static const StringID STR_TRANSPARENT_INDUSTRIES_TOOLTIP = 0x7ED;
+static const StringID STR_TRANSPARENT_BUILDINGS_TOOLTIP = 0x7EE;
+static const StringID STR_TRANSPARENT_BRIDGES_TOOLTIP = 0x7EF;
+static const StringID STR_TRANSPARENT_STRUCTURES_TOOLTIP = 0x7F0;
+static const StringID STR_TRANSPARENT_CATENARY_TOOLTIP = 0x7F1;
+static const StringID STR_TRANSPARENT_LOADING_TOOLTIP = 0x7F2;
+static const StringID STR_TRANSPARENT_INVISIBLE_TOOLTIP = 0x7F3;
+static const StringID STR_LINKGRAPH_LEGEND_CAPTION = 0x7F4;
+static const StringID STR_LINKGRAPH_LEGEND_ALL = 0x7F5;
+static const StringID STR_LINKGRAPH_LEGEND_NONE = 0x7F6;
+static const StringID STR_LINKGRAPH_LEGEND_SELECT_COMPANIES = 0x7F7;
+static const StringID STR_LINKGRAPH_LEGEND_COMPANY_TOOLTIP = 0x7F8;
+static const StringID STR_LINKGRAPH_LEGEND_UNUSED = 0x7F9;
+static const StringID STR_LINKGRAPH_LEGEND_SATURATED = 0x7FA;
+static const StringID STR_LINKGRAPH_LEGEND_OVERLOADED = 0x7FB;
+static const StringID STR_LINKGRAPH_STATS_TOOLTIP = 0x7FC;
+static const StringID STR_LINKGRAPH_STATS_TOOLTIP_RETURN_EXTENSION = 0x7FD;
+static const StringID STR_LINKGRAPH_STATS_TOOLTIP_TIME_EXTENSION = 0x7FE;
+static const StringID STR_STATION_BUILD_COVERAGE_AREA_TITLE = 0x7FF;
+static const StringID STR_STATION_BUILD_COVERAGE_OFF = 0x800;
+static const StringID STR_STATION_BUILD_COVERAGE_ON = 0x801;
+static const StringID STR_STATION_BUILD_COVERAGE_AREA_OFF_TOOLTIP = 0x802;
+static const StringID STR_STATION_BUILD_COVERAGE_AREA_ON_TOOLTIP = 0x803;
+static const StringID STR_STATION_BUILD_ACCEPTS_CARGO = 0x804;
+static const StringID STR_STATION_BUILD_SUPPLIES_CARGO = 0x805;
+static const StringID STR_STATION_BUILD_INFRASTRUCTURE_COST = 0x806;
+static const StringID STR_JOIN_STATION_CAPTION = 0x807;
+static const StringID STR_JOIN_STATION_CREATE_SPLITTED_STATION = 0x808;
+static const StringID STR_JOIN_WAYPOINT_CAPTION = 0x809;
+static const StringID STR_JOIN_WAYPOINT_CREATE_SPLITTED_WAYPOINT = 0x80A;
+static const StringID STR_TOOLBAR_DISABLED_NO_VEHICLE_AVAILABLE = 0x80B;
+static const StringID STR_RAIL_TOOLBAR_RAILROAD_CONSTRUCTION_CAPTION = 0x80C;
+static const StringID STR_RAIL_TOOLBAR_ELRAIL_CONSTRUCTION_CAPTION = 0x80D;
+static const StringID STR_RAIL_TOOLBAR_MONORAIL_CONSTRUCTION_CAPTION = 0x80E;
+static const StringID STR_RAIL_TOOLBAR_MAGLEV_CONSTRUCTION_CAPTION = 0x80F;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_RAILROAD_TRACK = 0x810;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_AUTORAIL = 0x811;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_TRAIN_DEPOT_FOR_BUILDING = 0x812;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_CONVERT_RAIL_TO_WAYPOINT = 0x813;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_RAILROAD_STATION = 0x814;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_RAILROAD_SIGNALS = 0x815;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_RAILROAD_BRIDGE = 0x816;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_RAILROAD_TUNNEL = 0x817;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_TOGGLE_BUILD_REMOVE_FOR = 0x818;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_CONVERT_RAIL = 0x819;
+static const StringID STR_RAIL_NAME_RAILROAD = 0x81A;
+static const StringID STR_RAIL_NAME_ELRAIL = 0x81B;
+static const StringID STR_RAIL_NAME_MONORAIL = 0x81C;
+static const StringID STR_RAIL_NAME_MAGLEV = 0x81D;
+static const StringID STR_BUILD_DEPOT_TRAIN_ORIENTATION_CAPTION = 0x81E;
+static const StringID STR_BUILD_DEPOT_TRAIN_ORIENTATION_TOOLTIP = 0x81F;
+static const StringID STR_WAYPOINT_CAPTION = 0x820;
+static const StringID STR_WAYPOINT_GRAPHICS_TOOLTIP = 0x821;
+static const StringID STR_STATION_BUILD_RAIL_CAPTION = 0x822;
+static const StringID STR_STATION_BUILD_ORIENTATION = 0x823;
+static const StringID STR_STATION_BUILD_RAILROAD_ORIENTATION_TOOLTIP = 0x824;
+static const StringID STR_STATION_BUILD_NUMBER_OF_TRACKS = 0x825;
+static const StringID STR_STATION_BUILD_NUMBER_OF_TRACKS_TOOLTIP = 0x826;
+static const StringID STR_STATION_BUILD_PLATFORM_LENGTH = 0x827;
+static const StringID STR_STATION_BUILD_PLATFORM_LENGTH_TOOLTIP = 0x828;
+static const StringID STR_STATION_BUILD_DRAG_DROP = 0x829;
+static const StringID STR_STATION_BUILD_DRAG_DROP_TOOLTIP = 0x82A;
+static const StringID STR_STATION_BUILD_STATION_CLASS_TOOLTIP = 0x82B;
+static const StringID STR_STATION_BUILD_STATION_TYPE_TOOLTIP = 0x82C;
+static const StringID STR_STATION_CLASS_DFLT = 0x82D;
+static const StringID STR_STATION_CLASS_WAYP = 0x82E;
+static const StringID STR_BUILD_SIGNAL_CAPTION = 0x82F;
+static const StringID STR_BUILD_SIGNAL_TOGGLE_ADVANCED_SIGNAL_TOOLTIP = 0x830;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_NORM_TOOLTIP = 0x831;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_ENTRY_TOOLTIP = 0x832;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_EXIT_TOOLTIP = 0x833;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_COMBO_TOOLTIP = 0x834;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_PBS_TOOLTIP = 0x835;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_PBS_OWAY_TOOLTIP = 0x836;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_NORM_TOOLTIP = 0x837;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_ENTRY_TOOLTIP = 0x838;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_EXIT_TOOLTIP = 0x839;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_COMBO_TOOLTIP = 0x83A;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_PBS_TOOLTIP = 0x83B;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_PBS_OWAY_TOOLTIP = 0x83C;
+static const StringID STR_BUILD_SIGNAL_CONVERT_TOOLTIP = 0x83D;
+static const StringID STR_BUILD_SIGNAL_DRAG_SIGNALS_DENSITY_TOOLTIP = 0x83E;
+static const StringID STR_BUILD_SIGNAL_DRAG_SIGNALS_DENSITY_DECREASE_TOOLTIP = 0x83F;
+static const StringID STR_BUILD_SIGNAL_DRAG_SIGNALS_DENSITY_INCREASE_TOOLTIP = 0x840;
+static const StringID STR_SELECT_RAIL_BRIDGE_CAPTION = 0x841;
+static const StringID STR_SELECT_ROAD_BRIDGE_CAPTION = 0x842;
+static const StringID STR_SELECT_BRIDGE_SELECTION_TOOLTIP = 0x843;
+static const StringID STR_SELECT_BRIDGE_INFO_NAME = 0x844;
+static const StringID STR_SELECT_BRIDGE_INFO_NAME_MAX_SPEED = 0x845;
+static const StringID STR_SELECT_BRIDGE_INFO_NAME_COST = 0x846;
+static const StringID STR_SELECT_BRIDGE_INFO_NAME_MAX_SPEED_COST = 0x847;
+static const StringID STR_BRIDGE_NAME_SUSPENSION_STEEL = 0x848;
+static const StringID STR_BRIDGE_NAME_GIRDER_STEEL = 0x849;
+static const StringID STR_BRIDGE_NAME_CANTILEVER_STEEL = 0x84A;
+static const StringID STR_BRIDGE_NAME_SUSPENSION_CONCRETE = 0x84B;
+static const StringID STR_BRIDGE_NAME_WOODEN = 0x84C;
+static const StringID STR_BRIDGE_NAME_CONCRETE = 0x84D;
+static const StringID STR_BRIDGE_NAME_TUBULAR_STEEL = 0x84E;
+static const StringID STR_BRIDGE_TUBULAR_SILICON = 0x84F;
+static const StringID STR_ROAD_TOOLBAR_ROAD_CONSTRUCTION_CAPTION = 0x850;
+static const StringID STR_ROAD_TOOLBAR_TRAM_CONSTRUCTION_CAPTION = 0x851;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_ROAD_SECTION = 0x852;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_TRAMWAY_SECTION = 0x853;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_AUTOROAD = 0x854;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_AUTOTRAM = 0x855;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_ROAD_VEHICLE_DEPOT = 0x856;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_TRAM_VEHICLE_DEPOT = 0x857;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_BUS_STATION = 0x858;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_PASSENGER_TRAM_STATION = 0x859;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_TRUCK_LOADING_BAY = 0x85A;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_CARGO_TRAM_STATION = 0x85B;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_TOGGLE_ONE_WAY_ROAD = 0x85C;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_ROAD_BRIDGE = 0x85D;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_TRAMWAY_BRIDGE = 0x85E;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_ROAD_TUNNEL = 0x85F;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_BUILD_TRAMWAY_TUNNEL = 0x860;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_TOGGLE_BUILD_REMOVE_FOR_ROAD = 0x861;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_TOGGLE_BUILD_REMOVE_FOR_TRAMWAYS = 0x862;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_CONVERT_ROAD = 0x863;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_CONVERT_TRAM = 0x864;
+static const StringID STR_ROAD_NAME_ROAD = 0x865;
+static const StringID STR_ROAD_NAME_TRAM = 0x866;
+static const StringID STR_BUILD_DEPOT_ROAD_ORIENTATION_CAPTION = 0x867;
+static const StringID STR_BUILD_DEPOT_ROAD_ORIENTATION_SELECT_TOOLTIP = 0x868;
+static const StringID STR_BUILD_DEPOT_TRAM_ORIENTATION_CAPTION = 0x869;
+static const StringID STR_BUILD_DEPOT_TRAM_ORIENTATION_SELECT_TOOLTIP = 0x86A;
+static const StringID STR_STATION_BUILD_BUS_ORIENTATION = 0x86B;
+static const StringID STR_STATION_BUILD_BUS_ORIENTATION_TOOLTIP = 0x86C;
+static const StringID STR_STATION_BUILD_TRUCK_ORIENTATION = 0x86D;
+static const StringID STR_STATION_BUILD_TRUCK_ORIENTATION_TOOLTIP = 0x86E;
+static const StringID STR_STATION_BUILD_PASSENGER_TRAM_ORIENTATION = 0x86F;
+static const StringID STR_STATION_BUILD_PASSENGER_TRAM_ORIENTATION_TOOLTIP = 0x870;
+static const StringID STR_STATION_BUILD_CARGO_TRAM_ORIENTATION = 0x871;
+static const StringID STR_STATION_BUILD_CARGO_TRAM_ORIENTATION_TOOLTIP = 0x872;
+static const StringID STR_WATERWAYS_TOOLBAR_CAPTION = 0x873;
+static const StringID STR_WATERWAYS_TOOLBAR_CAPTION_SE = 0x874;
+static const StringID STR_WATERWAYS_TOOLBAR_BUILD_CANALS_TOOLTIP = 0x875;
+static const StringID STR_WATERWAYS_TOOLBAR_BUILD_LOCKS_TOOLTIP = 0x876;
+static const StringID STR_WATERWAYS_TOOLBAR_BUILD_DEPOT_TOOLTIP = 0x877;
+static const StringID STR_WATERWAYS_TOOLBAR_BUILD_DOCK_TOOLTIP = 0x878;
+static const StringID STR_WATERWAYS_TOOLBAR_BUOY_TOOLTIP = 0x879;
+static const StringID STR_WATERWAYS_TOOLBAR_BUILD_AQUEDUCT_TOOLTIP = 0x87A;
+static const StringID STR_WATERWAYS_TOOLBAR_CREATE_LAKE_TOOLTIP = 0x87B;
+static const StringID STR_WATERWAYS_TOOLBAR_CREATE_RIVER_TOOLTIP = 0x87C;
+static const StringID STR_DEPOT_BUILD_SHIP_CAPTION = 0x87D;
+static const StringID STR_DEPOT_BUILD_SHIP_ORIENTATION_TOOLTIP = 0x87E;
+static const StringID STR_STATION_BUILD_DOCK_CAPTION = 0x87F;
+static const StringID STR_TOOLBAR_AIRCRAFT_CAPTION = 0x880;
+static const StringID STR_TOOLBAR_AIRCRAFT_BUILD_AIRPORT_TOOLTIP = 0x881;
+static const StringID STR_STATION_BUILD_AIRPORT_CAPTION = 0x882;
+static const StringID STR_STATION_BUILD_AIRPORT_TOOLTIP = 0x883;
+static const StringID STR_STATION_BUILD_AIRPORT_CLASS_LABEL = 0x884;
+static const StringID STR_STATION_BUILD_AIRPORT_LAYOUT_NAME = 0x885;
+static const StringID STR_AIRPORT_SMALL = 0x886;
+static const StringID STR_AIRPORT_CITY = 0x887;
+static const StringID STR_AIRPORT_METRO = 0x888;
+static const StringID STR_AIRPORT_INTERNATIONAL = 0x889;
+static const StringID STR_AIRPORT_COMMUTER = 0x88A;
+static const StringID STR_AIRPORT_INTERCONTINENTAL = 0x88B;
+static const StringID STR_AIRPORT_HELIPORT = 0x88C;
+static const StringID STR_AIRPORT_HELIDEPOT = 0x88D;
+static const StringID STR_AIRPORT_HELISTATION = 0x88E;
+static const StringID STR_AIRPORT_CLASS_SMALL = 0x88F;
+static const StringID STR_AIRPORT_CLASS_LARGE = 0x890;
+static const StringID STR_AIRPORT_CLASS_HUB = 0x891;
+static const StringID STR_AIRPORT_CLASS_HELIPORTS = 0x892;
+static const StringID STR_STATION_BUILD_NOISE = 0x893;
+static const StringID STR_LANDSCAPING_TOOLBAR = 0x894;
+static const StringID STR_LANDSCAPING_TOOLTIP_LOWER_A_CORNER_OF_LAND = 0x895;
+static const StringID STR_LANDSCAPING_TOOLTIP_RAISE_A_CORNER_OF_LAND = 0x896;
+static const StringID STR_LANDSCAPING_LEVEL_LAND_TOOLTIP = 0x897;
+static const StringID STR_LANDSCAPING_TOOLTIP_PURCHASE_LAND = 0x898;
+static const StringID STR_OBJECT_BUILD_CAPTION = 0x899;
+static const StringID STR_OBJECT_BUILD_TOOLTIP = 0x89A;
+static const StringID STR_OBJECT_BUILD_CLASS_TOOLTIP = 0x89B;
+static const StringID STR_OBJECT_BUILD_PREVIEW_TOOLTIP = 0x89C;
+static const StringID STR_OBJECT_BUILD_SIZE = 0x89D;
+static const StringID STR_OBJECT_CLASS_LTHS = 0x89E;
+static const StringID STR_OBJECT_CLASS_TRNS = 0x89F;
+static const StringID STR_PLANT_TREE_CAPTION = 0x8A0;
+static const StringID STR_PLANT_TREE_TOOLTIP = 0x8A1;
+static const StringID STR_TREES_RANDOM_TYPE = 0x8A2;
+static const StringID STR_TREES_RANDOM_TYPE_TOOLTIP = 0x8A3;
+static const StringID STR_TREES_RANDOM_TREES_BUTTON = 0x8A4;
+static const StringID STR_TREES_RANDOM_TREES_TOOLTIP = 0x8A5;
+static const StringID STR_TREES_MODE_NORMAL_BUTTON = 0x8A6;
+static const StringID STR_TREES_MODE_NORMAL_TOOLTIP = 0x8A7;
+static const StringID STR_TREES_MODE_FOREST_SM_BUTTON = 0x8A8;
+static const StringID STR_TREES_MODE_FOREST_SM_TOOLTIP = 0x8A9;
+static const StringID STR_TREES_MODE_FOREST_LG_BUTTON = 0x8AA;
+static const StringID STR_TREES_MODE_FOREST_LG_TOOLTIP = 0x8AB;
+static const StringID STR_TERRAFORM_TOOLBAR_LAND_GENERATION_CAPTION = 0x8AC;
+static const StringID STR_TERRAFORM_TOOLTIP_PLACE_ROCKY_AREAS_ON_LANDSCAPE = 0x8AD;
+static const StringID STR_TERRAFORM_TOOLTIP_DEFINE_DESERT_AREA = 0x8AE;
+static const StringID STR_TERRAFORM_TOOLTIP_INCREASE_SIZE_OF_LAND_AREA = 0x8AF;
+static const StringID STR_TERRAFORM_TOOLTIP_DECREASE_SIZE_OF_LAND_AREA = 0x8B0;
+static const StringID STR_TERRAFORM_TOOLTIP_GENERATE_RANDOM_LAND = 0x8B1;
+static const StringID STR_TERRAFORM_SE_NEW_WORLD = 0x8B2;
+static const StringID STR_TERRAFORM_RESET_LANDSCAPE = 0x8B3;
+static const StringID STR_TERRAFORM_RESET_LANDSCAPE_TOOLTIP = 0x8B4;
+static const StringID STR_QUERY_RESET_LANDSCAPE_CAPTION = 0x8B5;
+static const StringID STR_RESET_LANDSCAPE_CONFIRMATION_TEXT = 0x8B6;
+static const StringID STR_FOUND_TOWN_CAPTION = 0x8B7;
+static const StringID STR_FOUND_TOWN_NEW_TOWN_BUTTON = 0x8B8;
+static const StringID STR_FOUND_TOWN_NEW_TOWN_TOOLTIP = 0x8B9;
+static const StringID STR_FOUND_TOWN_RANDOM_TOWN_BUTTON = 0x8BA;
+static const StringID STR_FOUND_TOWN_RANDOM_TOWN_TOOLTIP = 0x8BB;
+static const StringID STR_FOUND_TOWN_MANY_RANDOM_TOWNS = 0x8BC;
+static const StringID STR_FOUND_TOWN_RANDOM_TOWNS_TOOLTIP = 0x8BD;
+static const StringID STR_FOUND_TOWN_EXPAND_ALL_TOWNS = 0x8BE;
+static const StringID STR_FOUND_TOWN_EXPAND_ALL_TOWNS_TOOLTIP = 0x8BF;
+static const StringID STR_FOUND_TOWN_NAME_TITLE = 0x8C0;
+static const StringID STR_FOUND_TOWN_NAME_EDITOR_TITLE = 0x8C1;
+static const StringID STR_FOUND_TOWN_NAME_EDITOR_HELP = 0x8C2;
+static const StringID STR_FOUND_TOWN_NAME_RANDOM_BUTTON = 0x8C3;
+static const StringID STR_FOUND_TOWN_NAME_RANDOM_TOOLTIP = 0x8C4;
+static const StringID STR_FOUND_TOWN_INITIAL_SIZE_TITLE = 0x8C5;
+static const StringID STR_FOUND_TOWN_INITIAL_SIZE_SMALL_BUTTON = 0x8C6;
+static const StringID STR_FOUND_TOWN_INITIAL_SIZE_MEDIUM_BUTTON = 0x8C7;
+static const StringID STR_FOUND_TOWN_INITIAL_SIZE_LARGE_BUTTON = 0x8C8;
+static const StringID STR_FOUND_TOWN_SIZE_RANDOM = 0x8C9;
+static const StringID STR_FOUND_TOWN_INITIAL_SIZE_TOOLTIP = 0x8CA;
+static const StringID STR_FOUND_TOWN_CITY = 0x8CB;
+static const StringID STR_FOUND_TOWN_CITY_TOOLTIP = 0x8CC;
+static const StringID STR_FOUND_TOWN_ROAD_LAYOUT = 0x8CD;
+static const StringID STR_FOUND_TOWN_SELECT_TOWN_ROAD_LAYOUT = 0x8CE;
+static const StringID STR_FOUND_TOWN_SELECT_LAYOUT_ORIGINAL = 0x8CF;
+static const StringID STR_FOUND_TOWN_SELECT_LAYOUT_BETTER_ROADS = 0x8D0;
+static const StringID STR_FOUND_TOWN_SELECT_LAYOUT_2X2_GRID = 0x8D1;
+static const StringID STR_FOUND_TOWN_SELECT_LAYOUT_3X3_GRID = 0x8D2;
+static const StringID STR_FOUND_TOWN_SELECT_LAYOUT_RANDOM = 0x8D3;
+static const StringID STR_FUND_INDUSTRY_CAPTION = 0x8D4;
+static const StringID STR_FUND_INDUSTRY_SELECTION_TOOLTIP = 0x8D5;
+static const StringID STR_FUND_INDUSTRY_MANY_RANDOM_INDUSTRIES = 0x8D6;
+static const StringID STR_FUND_INDUSTRY_MANY_RANDOM_INDUSTRIES_TOOLTIP = 0x8D7;
+static const StringID STR_FUND_INDUSTRY_MANY_RANDOM_INDUSTRIES_CAPTION = 0x8D8;
+static const StringID STR_FUND_INDUSTRY_MANY_RANDOM_INDUSTRIES_QUERY = 0x8D9;
+static const StringID STR_FUND_INDUSTRY_INDUSTRY_BUILD_COST = 0x8DA;
+static const StringID STR_FUND_INDUSTRY_PROSPECT_NEW_INDUSTRY = 0x8DB;
+static const StringID STR_FUND_INDUSTRY_BUILD_NEW_INDUSTRY = 0x8DC;
+static const StringID STR_FUND_INDUSTRY_FUND_NEW_INDUSTRY = 0x8DD;
+static const StringID STR_FUND_INDUSTRY_REMOVE_ALL_INDUSTRIES = 0x8DE;
+static const StringID STR_FUND_INDUSTRY_REMOVE_ALL_INDUSTRIES_TOOLTIP = 0x8DF;
+static const StringID STR_FUND_INDUSTRY_REMOVE_ALL_INDUSTRIES_CAPTION = 0x8E0;
+static const StringID STR_FUND_INDUSTRY_REMOVE_ALL_INDUSTRIES_QUERY = 0x8E1;
+static const StringID STR_INDUSTRY_CARGOES_INDUSTRY_CAPTION = 0x8E2;
+static const StringID STR_INDUSTRY_CARGOES_CARGO_CAPTION = 0x8E3;
+static const StringID STR_INDUSTRY_CARGOES_PRODUCERS = 0x8E4;
+static const StringID STR_INDUSTRY_CARGOES_CUSTOMERS = 0x8E5;
+static const StringID STR_INDUSTRY_CARGOES_HOUSES = 0x8E6;
+static const StringID STR_INDUSTRY_CARGOES_INDUSTRY_TOOLTIP = 0x8E7;
+static const StringID STR_INDUSTRY_CARGOES_CARGO_TOOLTIP = 0x8E8;
+static const StringID STR_INDUSTRY_DISPLAY_CHAIN = 0x8E9;
+static const StringID STR_INDUSTRY_DISPLAY_CHAIN_TOOLTIP = 0x8EA;
+static const StringID STR_INDUSTRY_CARGOES_NOTIFY_SMALLMAP = 0x8EB;
+static const StringID STR_INDUSTRY_CARGOES_NOTIFY_SMALLMAP_TOOLTIP = 0x8EC;
+static const StringID STR_INDUSTRY_CARGOES_SELECT_CARGO = 0x8ED;
+static const StringID STR_INDUSTRY_CARGOES_SELECT_CARGO_TOOLTIP = 0x8EE;
+static const StringID STR_INDUSTRY_CARGOES_SELECT_INDUSTRY = 0x8EF;
+static const StringID STR_INDUSTRY_CARGOES_SELECT_INDUSTRY_TOOLTIP = 0x8F0;
+static const StringID STR_LAND_AREA_INFORMATION_CAPTION = 0x8F1;
+static const StringID STR_LAND_AREA_INFORMATION_LOCATION_TOOLTIP = 0x8F2;
+static const StringID STR_LAND_AREA_INFORMATION_COST_TO_CLEAR_N_A = 0x8F3;
+static const StringID STR_LAND_AREA_INFORMATION_COST_TO_CLEAR = 0x8F4;
+static const StringID STR_LAND_AREA_INFORMATION_REVENUE_WHEN_CLEARED = 0x8F5;
+static const StringID STR_LAND_AREA_INFORMATION_OWNER_N_A = 0x8F6;
+static const StringID STR_LAND_AREA_INFORMATION_OWNER = 0x8F7;
+static const StringID STR_LAND_AREA_INFORMATION_ROAD_OWNER = 0x8F8;
+static const StringID STR_LAND_AREA_INFORMATION_TRAM_OWNER = 0x8F9;
+static const StringID STR_LAND_AREA_INFORMATION_RAIL_OWNER = 0x8FA;
+static const StringID STR_LAND_AREA_INFORMATION_LOCAL_AUTHORITY = 0x8FB;
+static const StringID STR_LAND_AREA_INFORMATION_LOCAL_AUTHORITY_NONE = 0x8FC;
+static const StringID STR_LAND_AREA_INFORMATION_LANDINFO_COORDS = 0x8FD;
+static const StringID STR_LAND_AREA_INFORMATION_BUILD_DATE = 0x8FE;
+static const StringID STR_LAND_AREA_INFORMATION_STATION_CLASS = 0x8FF;
+static const StringID STR_LAND_AREA_INFORMATION_STATION_TYPE = 0x900;
+static const StringID STR_LAND_AREA_INFORMATION_AIRPORT_CLASS = 0x901;
+static const StringID STR_LAND_AREA_INFORMATION_AIRPORT_NAME = 0x902;
+static const StringID STR_LAND_AREA_INFORMATION_AIRPORTTILE_NAME = 0x903;
+static const StringID STR_LAND_AREA_INFORMATION_NEWGRF_NAME = 0x904;
+static const StringID STR_LAND_AREA_INFORMATION_CARGO_ACCEPTED = 0x905;
+static const StringID STR_LAND_AREA_INFORMATION_CARGO_EIGHTS = 0x906;
+static const StringID STR_LANG_AREA_INFORMATION_RAIL_TYPE = 0x907;
+static const StringID STR_LANG_AREA_INFORMATION_ROAD_TYPE = 0x908;
+static const StringID STR_LANG_AREA_INFORMATION_TRAM_TYPE = 0x909;
+static const StringID STR_LANG_AREA_INFORMATION_RAIL_SPEED_LIMIT = 0x90A;
+static const StringID STR_LANG_AREA_INFORMATION_ROAD_SPEED_LIMIT = 0x90B;
+static const StringID STR_LANG_AREA_INFORMATION_TRAM_SPEED_LIMIT = 0x90C;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_ROCKS = 0x90D;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_ROUGH_LAND = 0x90E;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_BARE_LAND = 0x90F;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_GRASS = 0x910;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_FIELDS = 0x911;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_SNOW_COVERED_LAND = 0x912;
+static const StringID STR_LAI_CLEAR_DESCRIPTION_DESERT = 0x913;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK = 0x914;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_SIGNALS = 0x915;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRESIGNALS = 0x916;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXITSIGNALS = 0x917;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_COMBOSIGNALS = 0x918;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PBSSIGNALS = 0x919;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NOENTRYSIGNALS = 0x91A;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_PRESIGNALS = 0x91B;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_EXITSIGNALS = 0x91C;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_COMBOSIGNALS = 0x91D;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_PBSSIGNALS = 0x91E;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_NOENTRYSIGNALS = 0x91F;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_EXITSIGNALS = 0x920;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_COMBOSIGNALS = 0x921;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_PBSSIGNALS = 0x922;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_NOENTRYSIGNALS = 0x923;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXIT_COMBOSIGNALS = 0x924;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXIT_PBSSIGNALS = 0x925;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXIT_NOENTRYSIGNALS = 0x926;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_COMBO_PBSSIGNALS = 0x927;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_COMBO_NOENTRYSIGNALS = 0x928;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PBS_NOENTRYSIGNALS = 0x929;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRAIN_DEPOT = 0x92A;
+static const StringID STR_LAI_ROAD_DESCRIPTION_ROAD = 0x92B;
+static const StringID STR_LAI_ROAD_DESCRIPTION_ROAD_WITH_STREETLIGHTS = 0x92C;
+static const StringID STR_LAI_ROAD_DESCRIPTION_TREE_LINED_ROAD = 0x92D;
+static const StringID STR_LAI_ROAD_DESCRIPTION_ROAD_VEHICLE_DEPOT = 0x92E;
+static const StringID STR_LAI_ROAD_DESCRIPTION_ROAD_RAIL_LEVEL_CROSSING = 0x92F;
+static const StringID STR_LAI_ROAD_DESCRIPTION_TRAMWAY = 0x930;
+static const StringID STR_LAI_TOWN_INDUSTRY_DESCRIPTION_UNDER_CONSTRUCTION = 0x931;
+static const StringID STR_LAI_TREE_NAME_TREES = 0x932;
+static const StringID STR_LAI_TREE_NAME_RAINFOREST = 0x933;
+static const StringID STR_LAI_TREE_NAME_CACTUS_PLANTS = 0x934;
+static const StringID STR_LAI_STATION_DESCRIPTION_RAILROAD_STATION = 0x935;
+static const StringID STR_LAI_STATION_DESCRIPTION_AIRCRAFT_HANGAR = 0x936;
+static const StringID STR_LAI_STATION_DESCRIPTION_AIRPORT = 0x937;
+static const StringID STR_LAI_STATION_DESCRIPTION_TRUCK_LOADING_AREA = 0x938;
+static const StringID STR_LAI_STATION_DESCRIPTION_BUS_STATION = 0x939;
+static const StringID STR_LAI_STATION_DESCRIPTION_SHIP_DOCK = 0x93A;
+static const StringID STR_LAI_STATION_DESCRIPTION_BUOY = 0x93B;
+static const StringID STR_LAI_STATION_DESCRIPTION_WAYPOINT = 0x93C;
+static const StringID STR_LAI_WATER_DESCRIPTION_WATER = 0x93D;
+static const StringID STR_LAI_WATER_DESCRIPTION_CANAL = 0x93E;
+static const StringID STR_LAI_WATER_DESCRIPTION_LOCK = 0x93F;
+static const StringID STR_LAI_WATER_DESCRIPTION_RIVER = 0x940;
+static const StringID STR_LAI_WATER_DESCRIPTION_COAST_OR_RIVERBANK = 0x941;
+static const StringID STR_LAI_WATER_DESCRIPTION_SHIP_DEPOT = 0x942;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_RAILROAD = 0x943;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_ROAD = 0x944;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_SUSPENSION_STEEL = 0x945;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_GIRDER_STEEL = 0x946;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_CANTILEVER_STEEL = 0x947;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_SUSPENSION_CONCRETE = 0x948;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_WOODEN = 0x949;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_CONCRETE = 0x94A;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAIL_TUBULAR_STEEL = 0x94B;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_SUSPENSION_STEEL = 0x94C;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_GIRDER_STEEL = 0x94D;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_CANTILEVER_STEEL = 0x94E;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_SUSPENSION_CONCRETE = 0x94F;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_WOODEN = 0x950;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_CONCRETE = 0x951;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_ROAD_TUBULAR_STEEL = 0x952;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_AQUEDUCT = 0x953;
+static const StringID STR_LAI_OBJECT_DESCRIPTION_TRANSMITTER = 0x954;
+static const StringID STR_LAI_OBJECT_DESCRIPTION_LIGHTHOUSE = 0x955;
+static const StringID STR_LAI_OBJECT_DESCRIPTION_COMPANY_HEADQUARTERS = 0x956;
+static const StringID STR_LAI_OBJECT_DESCRIPTION_COMPANY_OWNED_LAND = 0x957;
+static const StringID STR_ABOUT_OPENTTD = 0x958;
+static const StringID STR_ABOUT_ORIGINAL_COPYRIGHT = 0x959;
+static const StringID STR_ABOUT_VERSION = 0x95A;
+static const StringID STR_ABOUT_COPYRIGHT_OPENTTD = 0x95B;
+static const StringID STR_FRAMERATE_CAPTION = 0x95C;
+static const StringID STR_FRAMERATE_CAPTION_SMALL = 0x95D;
+static const StringID STR_FRAMERATE_RATE_GAMELOOP = 0x95E;
+static const StringID STR_FRAMERATE_RATE_GAMELOOP_TOOLTIP = 0x95F;
+static const StringID STR_FRAMERATE_RATE_BLITTER = 0x960;
+static const StringID STR_FRAMERATE_RATE_BLITTER_TOOLTIP = 0x961;
+static const StringID STR_FRAMERATE_SPEED_FACTOR = 0x962;
+static const StringID STR_FRAMERATE_SPEED_FACTOR_TOOLTIP = 0x963;
+static const StringID STR_FRAMERATE_CURRENT = 0x964;
+static const StringID STR_FRAMERATE_AVERAGE = 0x965;
+static const StringID STR_FRAMERATE_MEMORYUSE = 0x966;
+static const StringID STR_FRAMERATE_DATA_POINTS = 0x967;
+static const StringID STR_FRAMERATE_MS_GOOD = 0x968;
+static const StringID STR_FRAMERATE_MS_WARN = 0x969;
+static const StringID STR_FRAMERATE_MS_BAD = 0x96A;
+static const StringID STR_FRAMERATE_FPS_GOOD = 0x96B;
+static const StringID STR_FRAMERATE_FPS_WARN = 0x96C;
+static const StringID STR_FRAMERATE_FPS_BAD = 0x96D;
+static const StringID STR_FRAMERATE_BYTES_GOOD = 0x96E;
+static const StringID STR_FRAMERATE_GRAPH_MILLISECONDS = 0x96F;
+static const StringID STR_FRAMERATE_GRAPH_SECONDS = 0x970;
+static const StringID STR_FRAMERATE_GAMELOOP = 0x971;
+static const StringID STR_FRAMERATE_GL_ECONOMY = 0x972;
+static const StringID STR_FRAMERATE_GL_TRAINS = 0x973;
+static const StringID STR_FRAMERATE_GL_ROADVEHS = 0x974;
+static const StringID STR_FRAMERATE_GL_SHIPS = 0x975;
+static const StringID STR_FRAMERATE_GL_AIRCRAFT = 0x976;
+static const StringID STR_FRAMERATE_GL_LANDSCAPE = 0x977;
+static const StringID STR_FRAMERATE_GL_LINKGRAPH = 0x978;
+static const StringID STR_FRAMERATE_DRAWING = 0x979;
+static const StringID STR_FRAMERATE_DRAWING_VIEWPORTS = 0x97A;
+static const StringID STR_FRAMERATE_VIDEO = 0x97B;
+static const StringID STR_FRAMERATE_SOUND = 0x97C;
+static const StringID STR_FRAMERATE_ALLSCRIPTS = 0x97D;
+static const StringID STR_FRAMERATE_GAMESCRIPT = 0x97E;
+static const StringID STR_FRAMERATE_AI = 0x97F;
+static const StringID STR_FRAMETIME_CAPTION_GAMELOOP = 0x980;
+static const StringID STR_FRAMETIME_CAPTION_GL_ECONOMY = 0x981;
+static const StringID STR_FRAMETIME_CAPTION_GL_TRAINS = 0x982;
+static const StringID STR_FRAMETIME_CAPTION_GL_ROADVEHS = 0x983;
+static const StringID STR_FRAMETIME_CAPTION_GL_SHIPS = 0x984;
+static const StringID STR_FRAMETIME_CAPTION_GL_AIRCRAFT = 0x985;
+static const StringID STR_FRAMETIME_CAPTION_GL_LANDSCAPE = 0x986;
+static const StringID STR_FRAMETIME_CAPTION_GL_LINKGRAPH = 0x987;
+static const StringID STR_FRAMETIME_CAPTION_DRAWING = 0x988;
+static const StringID STR_FRAMETIME_CAPTION_DRAWING_VIEWPORTS = 0x989;
+static const StringID STR_FRAMETIME_CAPTION_VIDEO = 0x98A;
+static const StringID STR_FRAMETIME_CAPTION_SOUND = 0x98B;
+static const StringID STR_FRAMETIME_CAPTION_ALLSCRIPTS = 0x98C;
+static const StringID STR_FRAMETIME_CAPTION_GAMESCRIPT = 0x98D;
+static const StringID STR_FRAMETIME_CAPTION_AI = 0x98E;
+static const StringID STR_SAVELOAD_SAVE_CAPTION = 0x98F;
+static const StringID STR_SAVELOAD_LOAD_CAPTION = 0x990;
+static const StringID STR_SAVELOAD_SAVE_SCENARIO = 0x991;
+static const StringID STR_SAVELOAD_LOAD_SCENARIO = 0x992;
+static const StringID STR_SAVELOAD_LOAD_HEIGHTMAP = 0x993;
+static const StringID STR_SAVELOAD_SAVE_HEIGHTMAP = 0x994;
+static const StringID STR_SAVELOAD_HOME_BUTTON = 0x995;
+static const StringID STR_SAVELOAD_BYTES_FREE = 0x996;
+static const StringID STR_SAVELOAD_LIST_TOOLTIP = 0x997;
+static const StringID STR_SAVELOAD_EDITBOX_TOOLTIP = 0x998;
+static const StringID STR_SAVELOAD_DELETE_BUTTON = 0x999;
+static const StringID STR_SAVELOAD_DELETE_TOOLTIP = 0x99A;
+static const StringID STR_SAVELOAD_SAVE_BUTTON = 0x99B;
+static const StringID STR_SAVELOAD_SAVE_TOOLTIP = 0x99C;
+static const StringID STR_SAVELOAD_LOAD_BUTTON = 0x99D;
+static const StringID STR_SAVELOAD_LOAD_TOOLTIP = 0x99E;
+static const StringID STR_SAVELOAD_LOAD_HEIGHTMAP_TOOLTIP = 0x99F;
+static const StringID STR_SAVELOAD_DETAIL_CAPTION = 0x9A0;
+static const StringID STR_SAVELOAD_DETAIL_NOT_AVAILABLE = 0x9A1;
+static const StringID STR_SAVELOAD_DETAIL_COMPANY_INDEX = 0x9A2;
+static const StringID STR_SAVELOAD_DETAIL_GRFSTATUS = 0x9A3;
+static const StringID STR_SAVELOAD_FILTER_TITLE = 0x9A4;
+static const StringID STR_SAVELOAD_OVERWRITE_TITLE = 0x9A5;
+static const StringID STR_SAVELOAD_OVERWRITE_WARNING = 0x9A6;
+static const StringID STR_SAVELOAD_DIRECTORY = 0x9A7;
+static const StringID STR_SAVELOAD_PARENT_DIRECTORY = 0x9A8;
+static const StringID STR_SAVELOAD_OSKTITLE = 0x9A9;
+static const StringID STR_MAPGEN_WORLD_GENERATION_CAPTION = 0x9AA;
+static const StringID STR_MAPGEN_MAPSIZE = 0x9AB;
+static const StringID STR_MAPGEN_MAPSIZE_TOOLTIP = 0x9AC;
+static const StringID STR_MAPGEN_BY = 0x9AD;
+static const StringID STR_MAPGEN_NUMBER_OF_TOWNS = 0x9AE;
+static const StringID STR_MAPGEN_TOWN_NAME_LABEL = 0x9AF;
+static const StringID STR_MAPGEN_TOWN_NAME_DROPDOWN_TOOLTIP = 0x9B0;
+static const StringID STR_MAPGEN_DATE = 0x9B1;
+static const StringID STR_MAPGEN_NUMBER_OF_INDUSTRIES = 0x9B2;
+static const StringID STR_MAPGEN_HEIGHTMAP_HEIGHT = 0x9B3;
+static const StringID STR_MAPGEN_HEIGHTMAP_HEIGHT_UP = 0x9B4;
+static const StringID STR_MAPGEN_HEIGHTMAP_HEIGHT_DOWN = 0x9B5;
+static const StringID STR_MAPGEN_SNOW_COVERAGE = 0x9B6;
+static const StringID STR_MAPGEN_SNOW_COVERAGE_UP = 0x9B7;
+static const StringID STR_MAPGEN_SNOW_COVERAGE_DOWN = 0x9B8;
+static const StringID STR_MAPGEN_SNOW_COVERAGE_TEXT = 0x9B9;
+static const StringID STR_MAPGEN_DESERT_COVERAGE = 0x9BA;
+static const StringID STR_MAPGEN_DESERT_COVERAGE_UP = 0x9BB;
+static const StringID STR_MAPGEN_DESERT_COVERAGE_DOWN = 0x9BC;
+static const StringID STR_MAPGEN_DESERT_COVERAGE_TEXT = 0x9BD;
+static const StringID STR_MAPGEN_TERRAIN_TYPE = 0x9BE;
+static const StringID STR_MAPGEN_SEA_LEVEL = 0x9BF;
+static const StringID STR_MAPGEN_QUANTITY_OF_RIVERS = 0x9C0;
+static const StringID STR_MAPGEN_SMOOTHNESS = 0x9C1;
+static const StringID STR_MAPGEN_VARIETY = 0x9C2;
+static const StringID STR_MAPGEN_GENERATE = 0x9C3;
+static const StringID STR_MAPGEN_NEWGRF_SETTINGS = 0x9C4;
+static const StringID STR_MAPGEN_NEWGRF_SETTINGS_TOOLTIP = 0x9C5;
+static const StringID STR_MAPGEN_AI_SETTINGS = 0x9C6;
+static const StringID STR_MAPGEN_AI_SETTINGS_TOOLTIP = 0x9C7;
+static const StringID STR_MAPGEN_GS_SETTINGS = 0x9C8;
+static const StringID STR_MAPGEN_GS_SETTINGS_TOOLTIP = 0x9C9;
+static const StringID STR_MAPGEN_TOWN_NAME_ORIGINAL_ENGLISH = 0x9CA;
+static const StringID STR_MAPGEN_TOWN_NAME_FRENCH = 0x9CB;
+static const StringID STR_MAPGEN_TOWN_NAME_GERMAN = 0x9CC;
+static const StringID STR_MAPGEN_TOWN_NAME_ADDITIONAL_ENGLISH = 0x9CD;
+static const StringID STR_MAPGEN_TOWN_NAME_LATIN_AMERICAN = 0x9CE;
+static const StringID STR_MAPGEN_TOWN_NAME_SILLY = 0x9CF;
+static const StringID STR_MAPGEN_TOWN_NAME_SWEDISH = 0x9D0;
+static const StringID STR_MAPGEN_TOWN_NAME_DUTCH = 0x9D1;
+static const StringID STR_MAPGEN_TOWN_NAME_FINNISH = 0x9D2;
+static const StringID STR_MAPGEN_TOWN_NAME_POLISH = 0x9D3;
+static const StringID STR_MAPGEN_TOWN_NAME_SLOVAK = 0x9D4;
+static const StringID STR_MAPGEN_TOWN_NAME_NORWEGIAN = 0x9D5;
+static const StringID STR_MAPGEN_TOWN_NAME_HUNGARIAN = 0x9D6;
+static const StringID STR_MAPGEN_TOWN_NAME_AUSTRIAN = 0x9D7;
+static const StringID STR_MAPGEN_TOWN_NAME_ROMANIAN = 0x9D8;
+static const StringID STR_MAPGEN_TOWN_NAME_CZECH = 0x9D9;
+static const StringID STR_MAPGEN_TOWN_NAME_SWISS = 0x9DA;
+static const StringID STR_MAPGEN_TOWN_NAME_DANISH = 0x9DB;
+static const StringID STR_MAPGEN_TOWN_NAME_TURKISH = 0x9DC;
+static const StringID STR_MAPGEN_TOWN_NAME_ITALIAN = 0x9DD;
+static const StringID STR_MAPGEN_TOWN_NAME_CATALAN = 0x9DE;
+static const StringID STR_MAPGEN_BORDER_TYPE = 0x9DF;
+static const StringID STR_MAPGEN_NORTHWEST = 0x9E0;
+static const StringID STR_MAPGEN_NORTHEAST = 0x9E1;
+static const StringID STR_MAPGEN_SOUTHEAST = 0x9E2;
+static const StringID STR_MAPGEN_SOUTHWEST = 0x9E3;
+static const StringID STR_MAPGEN_BORDER_FREEFORM = 0x9E4;
+static const StringID STR_MAPGEN_BORDER_WATER = 0x9E5;
+static const StringID STR_MAPGEN_BORDER_RANDOM = 0x9E6;
+static const StringID STR_MAPGEN_BORDER_RANDOMIZE = 0x9E7;
+static const StringID STR_MAPGEN_BORDER_MANUAL = 0x9E8;
+static const StringID STR_MAPGEN_HEIGHTMAP_ROTATION = 0x9E9;
+static const StringID STR_MAPGEN_HEIGHTMAP_NAME = 0x9EA;
+static const StringID STR_MAPGEN_HEIGHTMAP_SIZE_LABEL = 0x9EB;
+static const StringID STR_MAPGEN_HEIGHTMAP_SIZE = 0x9EC;
+static const StringID STR_MAPGEN_TERRAIN_TYPE_QUERY_CAPT = 0x9ED;
+static const StringID STR_MAPGEN_HEIGHTMAP_HEIGHT_QUERY_CAPT = 0x9EE;
+static const StringID STR_MAPGEN_SNOW_COVERAGE_QUERY_CAPT = 0x9EF;
+static const StringID STR_MAPGEN_DESERT_COVERAGE_QUERY_CAPT = 0x9F0;
+static const StringID STR_MAPGEN_START_DATE_QUERY_CAPT = 0x9F1;
+static const StringID STR_SE_MAPGEN_CAPTION = 0x9F2;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD = 0x9F3;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD_TOOLTIP = 0x9F4;
+static const StringID STR_SE_MAPGEN_RANDOM_LAND = 0x9F5;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD_HEIGHT = 0x9F6;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD_HEIGHT_DOWN = 0x9F7;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD_HEIGHT_UP = 0x9F8;
+static const StringID STR_SE_MAPGEN_FLAT_WORLD_HEIGHT_QUERY_CAPT = 0x9F9;
+static const StringID STR_GENERATION_WORLD = 0x9FA;
+static const StringID STR_GENERATION_ABORT = 0x9FB;
+static const StringID STR_GENERATION_ABORT_CAPTION = 0x9FC;
+static const StringID STR_GENERATION_ABORT_MESSAGE = 0x9FD;
+static const StringID STR_GENERATION_PROGRESS = 0x9FE;
+static const StringID STR_GENERATION_PROGRESS_NUM = 0x9FF;
+static const StringID STR_GENERATION_WORLD_GENERATION = 0xA00;
+static const StringID STR_GENERATION_RIVER_GENERATION = 0xA01;
+static const StringID STR_GENERATION_TREE_GENERATION = 0xA02;
+static const StringID STR_GENERATION_OBJECT_GENERATION = 0xA03;
+static const StringID STR_GENERATION_CLEARING_TILES = 0xA04;
+static const StringID STR_GENERATION_SETTINGUP_GAME = 0xA05;
+static const StringID STR_GENERATION_PREPARING_TILELOOP = 0xA06;
+static const StringID STR_GENERATION_PREPARING_SCRIPT = 0xA07;
+static const StringID STR_GENERATION_PREPARING_GAME = 0xA08;
+static const StringID STR_NEWGRF_SETTINGS_CAPTION = 0xA09;
+static const StringID STR_NEWGRF_SETTINGS_INFO_TITLE = 0xA0A;
+static const StringID STR_NEWGRF_SETTINGS_ACTIVE_LIST = 0xA0B;
+static const StringID STR_NEWGRF_SETTINGS_INACTIVE_LIST = 0xA0C;
+static const StringID STR_NEWGRF_SETTINGS_SELECT_PRESET = 0xA0D;
+static const StringID STR_NEWGRF_FILTER_TITLE = 0xA0E;
+static const StringID STR_NEWGRF_SETTINGS_PRESET_LIST_TOOLTIP = 0xA0F;
+static const StringID STR_NEWGRF_SETTINGS_PRESET_SAVE = 0xA10;
+static const StringID STR_NEWGRF_SETTINGS_PRESET_SAVE_TOOLTIP = 0xA11;
+static const StringID STR_NEWGRF_SETTINGS_PRESET_DELETE = 0xA12;
+static const StringID STR_NEWGRF_SETTINGS_PRESET_DELETE_TOOLTIP = 0xA13;
+static const StringID STR_NEWGRF_SETTINGS_ADD = 0xA14;
+static const StringID STR_NEWGRF_SETTINGS_ADD_FILE_TOOLTIP = 0xA15;
+static const StringID STR_NEWGRF_SETTINGS_RESCAN_FILES = 0xA16;
+static const StringID STR_NEWGRF_SETTINGS_RESCAN_FILES_TOOLTIP = 0xA17;
+static const StringID STR_NEWGRF_SETTINGS_REMOVE = 0xA18;
+static const StringID STR_NEWGRF_SETTINGS_REMOVE_TOOLTIP = 0xA19;
+static const StringID STR_NEWGRF_SETTINGS_MOVEUP = 0xA1A;
+static const StringID STR_NEWGRF_SETTINGS_MOVEUP_TOOLTIP = 0xA1B;
+static const StringID STR_NEWGRF_SETTINGS_MOVEDOWN = 0xA1C;
+static const StringID STR_NEWGRF_SETTINGS_MOVEDOWN_TOOLTIP = 0xA1D;
+static const StringID STR_NEWGRF_SETTINGS_UPGRADE = 0xA1E;
+static const StringID STR_NEWGRF_SETTINGS_UPGRADE_TOOLTIP = 0xA1F;
+static const StringID STR_NEWGRF_SETTINGS_FILE_TOOLTIP = 0xA20;
+static const StringID STR_NEWGRF_SETTINGS_SET_PARAMETERS = 0xA21;
+static const StringID STR_NEWGRF_SETTINGS_SHOW_PARAMETERS = 0xA22;
+static const StringID STR_NEWGRF_SETTINGS_TOGGLE_PALETTE = 0xA23;
+static const StringID STR_NEWGRF_SETTINGS_TOGGLE_PALETTE_TOOLTIP = 0xA24;
+static const StringID STR_NEWGRF_SETTINGS_APPLY_CHANGES = 0xA25;
+static const StringID STR_NEWGRF_SETTINGS_FIND_MISSING_CONTENT_BUTTON = 0xA26;
+static const StringID STR_NEWGRF_SETTINGS_FIND_MISSING_CONTENT_TOOLTIP = 0xA27;
+static const StringID STR_NEWGRF_SETTINGS_FILENAME = 0xA28;
+static const StringID STR_NEWGRF_SETTINGS_GRF_ID = 0xA29;
+static const StringID STR_NEWGRF_SETTINGS_VERSION = 0xA2A;
+static const StringID STR_NEWGRF_SETTINGS_MIN_VERSION = 0xA2B;
+static const StringID STR_NEWGRF_SETTINGS_MD5SUM = 0xA2C;
+static const StringID STR_NEWGRF_SETTINGS_PALETTE = 0xA2D;
+static const StringID STR_NEWGRF_SETTINGS_PALETTE_DEFAULT = 0xA2E;
+static const StringID STR_NEWGRF_SETTINGS_PALETTE_DEFAULT_32BPP = 0xA2F;
+static const StringID STR_NEWGRF_SETTINGS_PALETTE_LEGACY = 0xA30;
+static const StringID STR_NEWGRF_SETTINGS_PALETTE_LEGACY_32BPP = 0xA31;
+static const StringID STR_NEWGRF_SETTINGS_PARAMETER = 0xA32;
+static const StringID STR_NEWGRF_SETTINGS_PARAMETER_NONE = 0xA33;
+static const StringID STR_NEWGRF_SETTINGS_NO_INFO = 0xA34;
+static const StringID STR_NEWGRF_SETTINGS_NOT_FOUND = 0xA35;
+static const StringID STR_NEWGRF_SETTINGS_DISABLED = 0xA36;
+static const StringID STR_NEWGRF_SETTINGS_INCOMPATIBLE = 0xA37;
+static const StringID STR_SAVE_PRESET_CAPTION = 0xA38;
+static const StringID STR_SAVE_PRESET_LIST_TOOLTIP = 0xA39;
+static const StringID STR_SAVE_PRESET_TITLE = 0xA3A;
+static const StringID STR_SAVE_PRESET_EDITBOX_TOOLTIP = 0xA3B;
+static const StringID STR_SAVE_PRESET_CANCEL = 0xA3C;
+static const StringID STR_SAVE_PRESET_CANCEL_TOOLTIP = 0xA3D;
+static const StringID STR_SAVE_PRESET_SAVE = 0xA3E;
+static const StringID STR_SAVE_PRESET_SAVE_TOOLTIP = 0xA3F;
+static const StringID STR_NEWGRF_PARAMETERS_CAPTION = 0xA40;
+static const StringID STR_NEWGRF_PARAMETERS_CLOSE = 0xA41;
+static const StringID STR_NEWGRF_PARAMETERS_RESET = 0xA42;
+static const StringID STR_NEWGRF_PARAMETERS_RESET_TOOLTIP = 0xA43;
+static const StringID STR_NEWGRF_PARAMETERS_DEFAULT_NAME = 0xA44;
+static const StringID STR_NEWGRF_PARAMETERS_SETTING = 0xA45;
+static const StringID STR_NEWGRF_PARAMETERS_NUM_PARAM = 0xA46;
+static const StringID STR_NEWGRF_INSPECT_CAPTION = 0xA47;
+static const StringID STR_NEWGRF_INSPECT_PARENT_BUTTON = 0xA48;
+static const StringID STR_NEWGRF_INSPECT_PARENT_TOOLTIP = 0xA49;
+static const StringID STR_NEWGRF_INSPECT_CAPTION_OBJECT_AT = 0xA4A;
+static const StringID STR_NEWGRF_INSPECT_CAPTION_OBJECT_AT_OBJECT = 0xA4B;
+static const StringID STR_NEWGRF_INSPECT_CAPTION_OBJECT_AT_RAIL_TYPE = 0xA4C;
+static const StringID STR_NEWGRF_INSPECT_QUERY_CAPTION = 0xA4D;
+static const StringID STR_SPRITE_ALIGNER_CAPTION = 0xA4E;
+static const StringID STR_SPRITE_ALIGNER_NEXT_BUTTON = 0xA4F;
+static const StringID STR_SPRITE_ALIGNER_NEXT_TOOLTIP = 0xA50;
+static const StringID STR_SPRITE_ALIGNER_GOTO_BUTTON = 0xA51;
+static const StringID STR_SPRITE_ALIGNER_GOTO_TOOLTIP = 0xA52;
+static const StringID STR_SPRITE_ALIGNER_PREVIOUS_BUTTON = 0xA53;
+static const StringID STR_SPRITE_ALIGNER_PREVIOUS_TOOLTIP = 0xA54;
+static const StringID STR_SPRITE_ALIGNER_SPRITE_TOOLTIP = 0xA55;
+static const StringID STR_SPRITE_ALIGNER_MOVE_TOOLTIP = 0xA56;
+static const StringID STR_SPRITE_ALIGNER_CENTRE_OFFSET = 0xA57;
+static const StringID STR_SPRITE_ALIGNER_CENTRE_SPRITE = 0xA58;
+static const StringID STR_SPRITE_ALIGNER_CROSSHAIR = 0xA59;
+static const StringID STR_SPRITE_ALIGNER_RESET_BUTTON = 0xA5A;
+static const StringID STR_SPRITE_ALIGNER_RESET_TOOLTIP = 0xA5B;
+static const StringID STR_SPRITE_ALIGNER_OFFSETS_ABS = 0xA5C;
+static const StringID STR_SPRITE_ALIGNER_OFFSETS_REL = 0xA5D;
+static const StringID STR_SPRITE_ALIGNER_PICKER_BUTTON = 0xA5E;
+static const StringID STR_SPRITE_ALIGNER_PICKER_TOOLTIP = 0xA5F;
+static const StringID STR_SPRITE_ALIGNER_GOTO_CAPTION = 0xA60;
+static const StringID STR_NEWGRF_ERROR_MSG_INFO = 0xA61;
+static const StringID STR_NEWGRF_ERROR_MSG_WARNING = 0xA62;
+static const StringID STR_NEWGRF_ERROR_MSG_ERROR = 0xA63;
+static const StringID STR_NEWGRF_ERROR_MSG_FATAL = 0xA64;
+static const StringID STR_NEWGRF_ERROR_FATAL_POPUP = 0xA65;
+static const StringID STR_NEWGRF_ERROR_POPUP = 0xA66;
+static const StringID STR_NEWGRF_ERROR_VERSION_NUMBER = 0xA67;
+static const StringID STR_NEWGRF_ERROR_DOS_OR_WINDOWS = 0xA68;
+static const StringID STR_NEWGRF_ERROR_UNSET_SWITCH = 0xA69;
+static const StringID STR_NEWGRF_ERROR_INVALID_PARAMETER = 0xA6A;
+static const StringID STR_NEWGRF_ERROR_LOAD_BEFORE = 0xA6B;
+static const StringID STR_NEWGRF_ERROR_LOAD_AFTER = 0xA6C;
+static const StringID STR_NEWGRF_ERROR_OTTD_VERSION_NUMBER = 0xA6D;
+static const StringID STR_NEWGRF_ERROR_AFTER_TRANSLATED_FILE = 0xA6E;
+static const StringID STR_NEWGRF_ERROR_TOO_MANY_NEWGRFS_LOADED = 0xA6F;
+static const StringID STR_NEWGRF_ERROR_STATIC_GRF_CAUSES_DESYNC = 0xA70;
+static const StringID STR_NEWGRF_ERROR_UNEXPECTED_SPRITE = 0xA71;
+static const StringID STR_NEWGRF_ERROR_UNKNOWN_PROPERTY = 0xA72;
+static const StringID STR_NEWGRF_ERROR_INVALID_ID = 0xA73;
+static const StringID STR_NEWGRF_ERROR_CORRUPT_SPRITE = 0xA74;
+static const StringID STR_NEWGRF_ERROR_MULTIPLE_ACTION_8 = 0xA75;
+static const StringID STR_NEWGRF_ERROR_READ_BOUNDS = 0xA76;
+static const StringID STR_NEWGRF_ERROR_GRM_FAILED = 0xA77;
+static const StringID STR_NEWGRF_ERROR_FORCEFULLY_DISABLED = 0xA78;
+static const StringID STR_NEWGRF_ERROR_INVALID_SPRITE_LAYOUT = 0xA79;
+static const StringID STR_NEWGRF_ERROR_LIST_PROPERTY_TOO_LONG = 0xA7A;
+static const StringID STR_NEWGRF_ERROR_INDPROD_CALLBACK = 0xA7B;
+static const StringID STR_NEWGRF_POPUP_CAUTION_CAPTION = 0xA7C;
+static const StringID STR_NEWGRF_CONFIRMATION_TEXT = 0xA7D;
+static const StringID STR_NEWGRF_DUPLICATE_GRFID = 0xA7E;
+static const StringID STR_NEWGRF_COMPATIBLE_LOADED = 0xA7F;
+static const StringID STR_NEWGRF_TOO_MANY_NEWGRFS = 0xA80;
+static const StringID STR_NEWGRF_COMPATIBLE_LOAD_WARNING = 0xA81;
+static const StringID STR_NEWGRF_DISABLED_WARNING = 0xA82;
+static const StringID STR_NEWGRF_UNPAUSE_WARNING_TITLE = 0xA83;
+static const StringID STR_NEWGRF_UNPAUSE_WARNING = 0xA84;
+static const StringID STR_NEWGRF_LIST_NONE = 0xA85;
+static const StringID STR_NEWGRF_LIST_ALL_FOUND = 0xA86;
+static const StringID STR_NEWGRF_LIST_COMPATIBLE = 0xA87;
+static const StringID STR_NEWGRF_LIST_MISSING = 0xA88;
+static const StringID STR_NEWGRF_BROKEN = 0xA89;
+static const StringID STR_NEWGRF_BROKEN_POWERED_WAGON = 0xA8A;
+static const StringID STR_NEWGRF_BROKEN_VEHICLE_LENGTH = 0xA8B;
+static const StringID STR_NEWGRF_BROKEN_CAPACITY = 0xA8C;
+static const StringID STR_BROKEN_VEHICLE_LENGTH = 0xA8D;
+static const StringID STR_NEWGRF_BUGGY = 0xA8E;
+static const StringID STR_NEWGRF_BUGGY_ARTICULATED_CARGO = 0xA8F;
+static const StringID STR_NEWGRF_BUGGY_ENDLESS_PRODUCTION_CALLBACK = 0xA90;
+static const StringID STR_NEWGRF_BUGGY_UNKNOWN_CALLBACK_RESULT = 0xA91;
+static const StringID STR_NEWGRF_BUGGY_INVALID_CARGO_PRODUCTION_CALLBACK = 0xA92;
+static const StringID STR_NEWGRF_INVALID_CARGO = 0xA93;
+static const StringID STR_NEWGRF_INVALID_CARGO_ABBREV = 0xA94;
+static const StringID STR_NEWGRF_INVALID_CARGO_QUANTITY = 0xA95;
+static const StringID STR_NEWGRF_INVALID_ENGINE = 0xA96;
+static const StringID STR_NEWGRF_INVALID_INDUSTRYTYPE = 0xA97;
+static const StringID STR_INVALID_VEHICLE = 0xA98;
+static const StringID STR_NEWGRF_SCAN_CAPTION = 0xA99;
+static const StringID STR_NEWGRF_SCAN_MESSAGE = 0xA9A;
+static const StringID STR_NEWGRF_SCAN_STATUS = 0xA9B;
+static const StringID STR_NEWGRF_SCAN_ARCHIVES = 0xA9C;
+static const StringID STR_SIGN_LIST_CAPTION = 0xA9D;
+static const StringID STR_SIGN_LIST_MATCH_CASE = 0xA9E;
+static const StringID STR_SIGN_LIST_MATCH_CASE_TOOLTIP = 0xA9F;
+static const StringID STR_EDIT_SIGN_CAPTION = 0xAA0;
+static const StringID STR_EDIT_SIGN_LOCATION_TOOLTIP = 0xAA1;
+static const StringID STR_EDIT_SIGN_NEXT_SIGN_TOOLTIP = 0xAA2;
+static const StringID STR_EDIT_SIGN_PREVIOUS_SIGN_TOOLTIP = 0xAA3;
+static const StringID STR_EDIT_SIGN_SIGN_OSKTITLE = 0xAA4;
+static const StringID STR_TOWN_DIRECTORY_CAPTION = 0xAA5;
+static const StringID STR_TOWN_DIRECTORY_NONE = 0xAA6;
+static const StringID STR_TOWN_DIRECTORY_TOWN = 0xAA7;
+static const StringID STR_TOWN_DIRECTORY_CITY = 0xAA8;
+static const StringID STR_TOWN_DIRECTORY_LIST_TOOLTIP = 0xAA9;
+static const StringID STR_TOWN_POPULATION = 0xAAA;
+static const StringID STR_TOWN_VIEW_TOWN_CAPTION = 0xAAB;
+static const StringID STR_TOWN_VIEW_CITY_CAPTION = 0xAAC;
+static const StringID STR_TOWN_VIEW_POPULATION_HOUSES = 0xAAD;
+static const StringID STR_TOWN_VIEW_CARGO_LAST_MONTH_MAX = 0xAAE;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH = 0xAAF;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH_REQUIRED_GENERAL = 0xAB0;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH_REQUIRED_WINTER = 0xAB1;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH_DELIVERED_GENERAL = 0xAB2;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH_REQUIRED = 0xAB3;
+static const StringID STR_TOWN_VIEW_CARGO_FOR_TOWNGROWTH_DELIVERED = 0xAB4;
+static const StringID STR_TOWN_VIEW_TOWN_GROWS_EVERY = 0xAB5;
+static const StringID STR_TOWN_VIEW_TOWN_GROWS_EVERY_FUNDED = 0xAB6;
+static const StringID STR_TOWN_VIEW_TOWN_GROW_STOPPED = 0xAB7;
+static const StringID STR_TOWN_VIEW_NOISE_IN_TOWN = 0xAB8;
+static const StringID STR_TOWN_VIEW_CENTER_TOOLTIP = 0xAB9;
+static const StringID STR_TOWN_VIEW_LOCAL_AUTHORITY_BUTTON = 0xABA;
+static const StringID STR_TOWN_VIEW_LOCAL_AUTHORITY_TOOLTIP = 0xABB;
+static const StringID STR_TOWN_VIEW_RENAME_TOOLTIP = 0xABC;
+static const StringID STR_TOWN_VIEW_EXPAND_BUTTON = 0xABD;
+static const StringID STR_TOWN_VIEW_EXPAND_TOOLTIP = 0xABE;
+static const StringID STR_TOWN_VIEW_DELETE_BUTTON = 0xABF;
+static const StringID STR_TOWN_VIEW_DELETE_TOOLTIP = 0xAC0;
+static const StringID STR_TOWN_VIEW_RENAME_TOWN_BUTTON = 0xAC1;
+static const StringID STR_LOCAL_AUTHORITY_CAPTION = 0xAC2;
+static const StringID STR_LOCAL_AUTHORITY_ZONE = 0xAC3;
+static const StringID STR_LOCAL_AUTHORITY_ZONE_TOOLTIP = 0xAC4;
+static const StringID STR_LOCAL_AUTHORITY_COMPANY_RATINGS = 0xAC5;
+static const StringID STR_LOCAL_AUTHORITY_COMPANY_RATING = 0xAC6;
+static const StringID STR_LOCAL_AUTHORITY_ACTIONS_TITLE = 0xAC7;
+static const StringID STR_LOCAL_AUTHORITY_ACTIONS_TOOLTIP = 0xAC8;
+static const StringID STR_LOCAL_AUTHORITY_DO_IT_BUTTON = 0xAC9;
+static const StringID STR_LOCAL_AUTHORITY_DO_IT_TOOLTIP = 0xACA;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_SMALL_ADVERTISING_CAMPAIGN = 0xACB;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_MEDIUM_ADVERTISING_CAMPAIGN = 0xACC;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_LARGE_ADVERTISING_CAMPAIGN = 0xACD;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_ROAD_RECONSTRUCTION = 0xACE;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_STATUE_OF_COMPANY = 0xACF;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_NEW_BUILDINGS = 0xAD0;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_EXCLUSIVE_TRANSPORT = 0xAD1;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_BRIBE = 0xAD2;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_SMALL_ADVERTISING = 0xAD3;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_MEDIUM_ADVERTISING = 0xAD4;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_LARGE_ADVERTISING = 0xAD5;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_ROAD_RECONSTRUCTION = 0xAD6;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_STATUE_OF_COMPANY = 0xAD7;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_NEW_BUILDINGS = 0xAD8;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_EXCLUSIVE_TRANSPORT = 0xAD9;
+static const StringID STR_LOCAL_AUTHORITY_ACTION_TOOLTIP_BRIBE = 0xADA;
+static const StringID STR_GOALS_CAPTION = 0xADB;
+static const StringID STR_GOALS_SPECTATOR_CAPTION = 0xADC;
+static const StringID STR_GOALS_SPECTATOR = 0xADD;
+static const StringID STR_GOALS_GLOBAL_BUTTON = 0xADE;
+static const StringID STR_GOALS_GLOBAL_BUTTON_HELPTEXT = 0xADF;
+static const StringID STR_GOALS_COMPANY_BUTTON = 0xAE0;
+static const StringID STR_GOALS_COMPANY_BUTTON_HELPTEXT = 0xAE1;
+static const StringID STR_GOALS_TEXT = 0xAE2;
+static const StringID STR_GOALS_NONE = 0xAE3;
+static const StringID STR_GOALS_PROGRESS = 0xAE4;
+static const StringID STR_GOALS_PROGRESS_COMPLETE = 0xAE5;
+static const StringID STR_GOALS_TOOLTIP_CLICK_ON_SERVICE_TO_CENTER = 0xAE6;
+static const StringID STR_GOAL_QUESTION_CAPTION_QUESTION = 0xAE7;
+static const StringID STR_GOAL_QUESTION_CAPTION_INFORMATION = 0xAE8;
+static const StringID STR_GOAL_QUESTION_CAPTION_WARNING = 0xAE9;
+static const StringID STR_GOAL_QUESTION_CAPTION_ERROR = 0xAEA;
+static const StringID STR_GOAL_QUESTION_BUTTON_CANCEL = 0xAEB;
+static const StringID STR_GOAL_QUESTION_BUTTON_OK = 0xAEC;
+static const StringID STR_GOAL_QUESTION_BUTTON_NO = 0xAED;
+static const StringID STR_GOAL_QUESTION_BUTTON_YES = 0xAEE;
+static const StringID STR_GOAL_QUESTION_BUTTON_DECLINE = 0xAEF;
+static const StringID STR_GOAL_QUESTION_BUTTON_ACCEPT = 0xAF0;
+static const StringID STR_GOAL_QUESTION_BUTTON_IGNORE = 0xAF1;
+static const StringID STR_GOAL_QUESTION_BUTTON_RETRY = 0xAF2;
+static const StringID STR_GOAL_QUESTION_BUTTON_PREVIOUS = 0xAF3;
+static const StringID STR_GOAL_QUESTION_BUTTON_NEXT = 0xAF4;
+static const StringID STR_GOAL_QUESTION_BUTTON_STOP = 0xAF5;
+static const StringID STR_GOAL_QUESTION_BUTTON_START = 0xAF6;
+static const StringID STR_GOAL_QUESTION_BUTTON_GO = 0xAF7;
+static const StringID STR_GOAL_QUESTION_BUTTON_CONTINUE = 0xAF8;
+static const StringID STR_GOAL_QUESTION_BUTTON_RESTART = 0xAF9;
+static const StringID STR_GOAL_QUESTION_BUTTON_POSTPONE = 0xAFA;
+static const StringID STR_GOAL_QUESTION_BUTTON_SURRENDER = 0xAFB;
+static const StringID STR_GOAL_QUESTION_BUTTON_CLOSE = 0xAFC;
+static const StringID STR_SUBSIDIES_CAPTION = 0xAFD;
+static const StringID STR_SUBSIDIES_OFFERED_TITLE = 0xAFE;
+static const StringID STR_SUBSIDIES_OFFERED_FROM_TO = 0xAFF;
+static const StringID STR_SUBSIDIES_NONE = 0xB00;
+static const StringID STR_SUBSIDIES_SUBSIDISED_TITLE = 0xB01;
+static const StringID STR_SUBSIDIES_SUBSIDISED_FROM_TO = 0xB02;
+static const StringID STR_SUBSIDIES_TOOLTIP_CLICK_ON_SERVICE_TO_CENTER = 0xB03;
+static const StringID STR_STORY_BOOK_CAPTION = 0xB04;
+static const StringID STR_STORY_BOOK_SPECTATOR_CAPTION = 0xB05;
+static const StringID STR_STORY_BOOK_SPECTATOR = 0xB06;
+static const StringID STR_STORY_BOOK_TITLE = 0xB07;
+static const StringID STR_STORY_BOOK_GENERIC_PAGE_ITEM = 0xB08;
+static const StringID STR_STORY_BOOK_SEL_PAGE_TOOLTIP = 0xB09;
+static const StringID STR_STORY_BOOK_PREV_PAGE = 0xB0A;
+static const StringID STR_STORY_BOOK_PREV_PAGE_TOOLTIP = 0xB0B;
+static const StringID STR_STORY_BOOK_NEXT_PAGE = 0xB0C;
+static const StringID STR_STORY_BOOK_NEXT_PAGE_TOOLTIP = 0xB0D;
+static const StringID STR_STORY_BOOK_INVALID_GOAL_REF = 0xB0E;
+static const StringID STR_STATION_LIST_TOOLTIP = 0xB0F;
+static const StringID STR_STATION_LIST_USE_CTRL_TO_SELECT_MORE = 0xB10;
+static const StringID STR_STATION_LIST_CAPTION = 0xB11;
+static const StringID STR_STATION_LIST_STATION = 0xB12;
+static const StringID STR_STATION_LIST_WAYPOINT = 0xB13;
+static const StringID STR_STATION_LIST_NONE = 0xB14;
+static const StringID STR_STATION_LIST_SELECT_ALL_FACILITIES = 0xB15;
+static const StringID STR_STATION_LIST_SELECT_ALL_TYPES = 0xB16;
+static const StringID STR_STATION_LIST_NO_WAITING_CARGO = 0xB17;
+static const StringID STR_STATION_VIEW_CAPTION = 0xB18;
+static const StringID STR_STATION_VIEW_WAITING_CARGO = 0xB19;
+static const StringID STR_STATION_VIEW_RESERVED = 0xB1A;
+static const StringID STR_STATION_VIEW_ACCEPTS_BUTTON = 0xB1B;
+static const StringID STR_STATION_VIEW_ACCEPTS_TOOLTIP = 0xB1C;
+static const StringID STR_STATION_VIEW_ACCEPTS_CARGO = 0xB1D;
+static const StringID STR_STATION_VIEW_EXCLUSIVE_RIGHTS_SELF = 0xB1E;
+static const StringID STR_STATION_VIEW_EXCLUSIVE_RIGHTS_COMPANY = 0xB1F;
+static const StringID STR_STATION_VIEW_RATINGS_BUTTON = 0xB20;
+static const StringID STR_STATION_VIEW_RATINGS_TOOLTIP = 0xB21;
+static const StringID STR_STATION_VIEW_SUPPLY_RATINGS_TITLE = 0xB22;
+static const StringID STR_STATION_VIEW_CARGO_SUPPLY_RATING = 0xB23;
+static const StringID STR_STATION_VIEW_GROUP = 0xB24;
+static const StringID STR_STATION_VIEW_WAITING_STATION = 0xB25;
+static const StringID STR_STATION_VIEW_WAITING_AMOUNT = 0xB26;
+static const StringID STR_STATION_VIEW_PLANNED_STATION = 0xB27;
+static const StringID STR_STATION_VIEW_PLANNED_AMOUNT = 0xB28;
+static const StringID STR_STATION_VIEW_FROM = 0xB29;
+static const StringID STR_STATION_VIEW_VIA = 0xB2A;
+static const StringID STR_STATION_VIEW_TO = 0xB2B;
+static const StringID STR_STATION_VIEW_FROM_ANY = 0xB2C;
+static const StringID STR_STATION_VIEW_TO_ANY = 0xB2D;
+static const StringID STR_STATION_VIEW_VIA_ANY = 0xB2E;
+static const StringID STR_STATION_VIEW_FROM_HERE = 0xB2F;
+static const StringID STR_STATION_VIEW_VIA_HERE = 0xB30;
+static const StringID STR_STATION_VIEW_TO_HERE = 0xB31;
+static const StringID STR_STATION_VIEW_NONSTOP = 0xB32;
+static const StringID STR_STATION_VIEW_GROUP_S_V_D = 0xB33;
+static const StringID STR_STATION_VIEW_GROUP_S_D_V = 0xB34;
+static const StringID STR_STATION_VIEW_GROUP_V_S_D = 0xB35;
+static const StringID STR_STATION_VIEW_GROUP_V_D_S = 0xB36;
+static const StringID STR_STATION_VIEW_GROUP_D_S_V = 0xB37;
+static const StringID STR_STATION_VIEW_GROUP_D_V_S = 0xB38;
+static const StringID STR_CARGO_RATING_APPALLING = 0xB39;
+static const StringID STR_CARGO_RATING_VERY_POOR = 0xB3A;
+static const StringID STR_CARGO_RATING_POOR = 0xB3B;
+static const StringID STR_CARGO_RATING_MEDIOCRE = 0xB3C;
+static const StringID STR_CARGO_RATING_GOOD = 0xB3D;
+static const StringID STR_CARGO_RATING_VERY_GOOD = 0xB3E;
+static const StringID STR_CARGO_RATING_EXCELLENT = 0xB3F;
+static const StringID STR_CARGO_RATING_OUTSTANDING = 0xB40;
+static const StringID STR_STATION_VIEW_CENTER_TOOLTIP = 0xB41;
+static const StringID STR_STATION_VIEW_RENAME_TOOLTIP = 0xB42;
+static const StringID STR_STATION_VIEW_SCHEDULED_TRAINS_TOOLTIP = 0xB43;
+static const StringID STR_STATION_VIEW_SCHEDULED_ROAD_VEHICLES_TOOLTIP = 0xB44;
+static const StringID STR_STATION_VIEW_SCHEDULED_AIRCRAFT_TOOLTIP = 0xB45;
+static const StringID STR_STATION_VIEW_SCHEDULED_SHIPS_TOOLTIP = 0xB46;
+static const StringID STR_STATION_VIEW_RENAME_STATION_CAPTION = 0xB47;
+static const StringID STR_STATION_VIEW_CLOSE_AIRPORT = 0xB48;
+static const StringID STR_STATION_VIEW_CLOSE_AIRPORT_TOOLTIP = 0xB49;
+static const StringID STR_WAYPOINT_VIEW_CAPTION = 0xB4A;
+static const StringID STR_WAYPOINT_VIEW_CENTER_TOOLTIP = 0xB4B;
+static const StringID STR_WAYPOINT_VIEW_CHANGE_WAYPOINT_NAME = 0xB4C;
+static const StringID STR_BUOY_VIEW_CENTER_TOOLTIP = 0xB4D;
+static const StringID STR_BUOY_VIEW_CHANGE_BUOY_NAME = 0xB4E;
+static const StringID STR_EDIT_WAYPOINT_NAME = 0xB4F;
+static const StringID STR_FINANCES_CAPTION = 0xB50;
+static const StringID STR_FINANCES_YEAR = 0xB51;
+static const StringID STR_FINANCES_REVENUE_TITLE = 0xB52;
+static const StringID STR_FINANCES_OPERATING_EXPENSES_TITLE = 0xB53;
+static const StringID STR_FINANCES_CAPITAL_EXPENSES_TITLE = 0xB54;
+static const StringID STR_FINANCES_SECTION_CONSTRUCTION = 0xB55;
+static const StringID STR_FINANCES_SECTION_NEW_VEHICLES = 0xB56;
+static const StringID STR_FINANCES_SECTION_TRAIN_RUNNING_COSTS = 0xB57;
+static const StringID STR_FINANCES_SECTION_ROAD_VEHICLE_RUNNING_COSTS = 0xB58;
+static const StringID STR_FINANCES_SECTION_AIRCRAFT_RUNNING_COSTS = 0xB59;
+static const StringID STR_FINANCES_SECTION_SHIP_RUNNING_COSTS = 0xB5A;
+static const StringID STR_FINANCES_SECTION_INFRASTRUCTURE = 0xB5B;
+static const StringID STR_FINANCES_SECTION_TRAIN_REVENUE = 0xB5C;
+static const StringID STR_FINANCES_SECTION_ROAD_VEHICLE_REVENUE = 0xB5D;
+static const StringID STR_FINANCES_SECTION_AIRCRAFT_REVENUE = 0xB5E;
+static const StringID STR_FINANCES_SECTION_SHIP_REVENUE = 0xB5F;
+static const StringID STR_FINANCES_SECTION_LOAN_INTEREST = 0xB60;
+static const StringID STR_FINANCES_SECTION_OTHER = 0xB61;
+static const StringID STR_FINANCES_SECTION_INFRASTRUCTURE_COSTS = 0xB62;
+static const StringID STR_FINANCES_SECTION_INFRASTRUCTURE_INCOME = 0xB63;
+static const StringID STR_FINANCES_TOTAL_CAPTION = 0xB64;
+static const StringID STR_FINANCES_NEGATIVE_INCOME = 0xB65;
+static const StringID STR_FINANCES_ZERO_INCOME = 0xB66;
+static const StringID STR_FINANCES_POSITIVE_INCOME = 0xB67;
+static const StringID STR_FINANCES_PROFIT = 0xB68;
+static const StringID STR_FINANCES_BANK_BALANCE_TITLE = 0xB69;
+static const StringID STR_FINANCES_OWN_FUNDS_TITLE = 0xB6A;
+static const StringID STR_FINANCES_LOAN_TITLE = 0xB6B;
+static const StringID STR_FINANCES_INTEREST_RATE = 0xB6C;
+static const StringID STR_FINANCES_MAX_LOAN = 0xB6D;
+static const StringID STR_FINANCES_TOTAL_CURRENCY = 0xB6E;
+static const StringID STR_FINANCES_BANK_BALANCE = 0xB6F;
+static const StringID STR_FINANCES_BORROW_BUTTON = 0xB70;
+static const StringID STR_FINANCES_BORROW_TOOLTIP = 0xB71;
+static const StringID STR_FINANCES_REPAY_BUTTON = 0xB72;
+static const StringID STR_FINANCES_REPAY_TOOLTIP = 0xB73;
+static const StringID STR_FINANCES_INFRASTRUCTURE_BUTTON = 0xB74;
+static const StringID STR_COMPANY_VIEW_CAPTION = 0xB75;
+static const StringID STR_COMPANY_VIEW_PRESIDENT_MANAGER_TITLE = 0xB76;
+static const StringID STR_COMPANY_VIEW_INAUGURATED_TITLE = 0xB77;
+static const StringID STR_COMPANY_VIEW_COLOUR_SCHEME_TITLE = 0xB78;
+static const StringID STR_COMPANY_VIEW_VEHICLES_TITLE = 0xB79;
+static const StringID STR_COMPANY_VIEW_TRAINS = 0xB7A;
+static const StringID STR_COMPANY_VIEW_ROAD_VEHICLES = 0xB7B;
+static const StringID STR_COMPANY_VIEW_AIRCRAFT = 0xB7C;
+static const StringID STR_COMPANY_VIEW_SHIPS = 0xB7D;
+static const StringID STR_COMPANY_VIEW_VEHICLES_NONE = 0xB7E;
+static const StringID STR_COMPANY_VIEW_COMPANY_VALUE = 0xB7F;
+static const StringID STR_COMPANY_VIEW_SHARES_OWNED_BY = 0xB80;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE = 0xB81;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_RAIL = 0xB82;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_ROAD = 0xB83;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_WATER = 0xB84;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_STATION = 0xB85;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_AIRPORT = 0xB86;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_NONE = 0xB87;
+static const StringID STR_COMPANY_VIEW_BUILD_HQ_BUTTON = 0xB88;
+static const StringID STR_COMPANY_VIEW_BUILD_HQ_TOOLTIP = 0xB89;
+static const StringID STR_COMPANY_VIEW_VIEW_HQ_BUTTON = 0xB8A;
+static const StringID STR_COMPANY_VIEW_VIEW_HQ_TOOLTIP = 0xB8B;
+static const StringID STR_COMPANY_VIEW_RELOCATE_HQ = 0xB8C;
+static const StringID STR_COMPANY_VIEW_RELOCATE_COMPANY_HEADQUARTERS = 0xB8D;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_BUTTON = 0xB8E;
+static const StringID STR_COMPANY_VIEW_INFRASTRUCTURE_TOOLTIP = 0xB8F;
+static const StringID STR_COMPANY_VIEW_GIVE_MONEY_BUTTON = 0xB90;
+static const StringID STR_COMPANY_VIEW_GIVE_MONEY_TOOLTIP = 0xB91;
+static const StringID STR_COMPANY_VIEW_NEW_FACE_BUTTON = 0xB92;
+static const StringID STR_COMPANY_VIEW_NEW_FACE_TOOLTIP = 0xB93;
+static const StringID STR_COMPANY_VIEW_COLOUR_SCHEME_BUTTON = 0xB94;
+static const StringID STR_COMPANY_VIEW_COLOUR_SCHEME_TOOLTIP = 0xB95;
+static const StringID STR_COMPANY_VIEW_COMPANY_NAME_BUTTON = 0xB96;
+static const StringID STR_COMPANY_VIEW_COMPANY_NAME_TOOLTIP = 0xB97;
+static const StringID STR_COMPANY_VIEW_PRESIDENT_NAME_BUTTON = 0xB98;
+static const StringID STR_COMPANY_VIEW_PRESIDENT_NAME_TOOLTIP = 0xB99;
+static const StringID STR_COMPANY_VIEW_BUY_SHARE_BUTTON = 0xB9A;
+static const StringID STR_COMPANY_VIEW_SELL_SHARE_BUTTON = 0xB9B;
+static const StringID STR_COMPANY_VIEW_BUY_SHARE_TOOLTIP = 0xB9C;
+static const StringID STR_COMPANY_VIEW_SELL_SHARE_TOOLTIP = 0xB9D;
+static const StringID STR_COMPANY_VIEW_COMPANY_NAME_QUERY_CAPTION = 0xB9E;
+static const StringID STR_COMPANY_VIEW_PRESIDENT_S_NAME_QUERY_CAPTION = 0xB9F;
+static const StringID STR_COMPANY_VIEW_GIVE_MONEY_QUERY_CAPTION = 0xBA0;
+static const StringID STR_BUY_COMPANY_MESSAGE = 0xBA1;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_CAPTION = 0xBA2;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_RAIL_SECT = 0xBA3;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_SIGNALS = 0xBA4;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_ROAD_SECT = 0xBA5;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_TRAM_SECT = 0xBA6;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_WATER_SECT = 0xBA7;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_CANALS = 0xBA8;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_STATION_SECT = 0xBA9;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_STATIONS = 0xBAA;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_AIRPORTS = 0xBAB;
+static const StringID STR_COMPANY_INFRASTRUCTURE_VIEW_TOTAL = 0xBAC;
+static const StringID STR_INDUSTRY_DIRECTORY_CAPTION = 0xBAD;
+static const StringID STR_INDUSTRY_DIRECTORY_NONE = 0xBAE;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_INFO = 0xBAF;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_NOPROD = 0xBB0;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_PROD1 = 0xBB1;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_PROD2 = 0xBB2;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_PROD3 = 0xBB3;
+static const StringID STR_INDUSTRY_DIRECTORY_ITEM_PRODMORE = 0xBB4;
+static const StringID STR_INDUSTRY_DIRECTORY_LIST_CAPTION = 0xBB5;
+static const StringID STR_INDUSTRY_DIRECTORY_ACCEPTED_CARGO_FILTER = 0xBB6;
+static const StringID STR_INDUSTRY_DIRECTORY_PRODUCED_CARGO_FILTER = 0xBB7;
+static const StringID STR_INDUSTRY_DIRECTORY_FILTER_ALL_TYPES = 0xBB8;
+static const StringID STR_INDUSTRY_DIRECTORY_FILTER_NONE = 0xBB9;
+static const StringID STR_INDUSTRY_VIEW_CAPTION = 0xBBA;
+static const StringID STR_INDUSTRY_VIEW_PRODUCTION_LAST_MONTH_TITLE = 0xBBB;
+static const StringID STR_INDUSTRY_VIEW_TRANSPORTED = 0xBBC;
+static const StringID STR_INDUSTRY_VIEW_LOCATION_TOOLTIP = 0xBBD;
+static const StringID STR_INDUSTRY_VIEW_PRODUCTION_LEVEL = 0xBBE;
+static const StringID STR_INDUSTRY_VIEW_INDUSTRY_ANNOUNCED_CLOSURE = 0xBBF;
+static const StringID STR_INDUSTRY_VIEW_REQUIRES_N_CARGO = 0xBC0;
+static const StringID STR_INDUSTRY_VIEW_PRODUCES_N_CARGO = 0xBC1;
+static const StringID STR_INDUSTRY_VIEW_CARGO_LIST_EXTENSION = 0xBC2;
+static const StringID STR_INDUSTRY_VIEW_REQUIRES = 0xBC3;
+static const StringID STR_INDUSTRY_VIEW_ACCEPT_CARGO = 0xBC4;
+static const StringID STR_INDUSTRY_VIEW_ACCEPT_CARGO_AMOUNT = 0xBC5;
+static const StringID STR_CONFIG_GAME_PRODUCTION = 0xBC6;
+static const StringID STR_CONFIG_GAME_PRODUCTION_LEVEL = 0xBC7;
+static const StringID STR_VEHICLE_LIST_TRAIN_CAPTION = 0xBC8;
+static const StringID STR_VEHICLE_LIST_ROAD_VEHICLE_CAPTION = 0xBC9;
+static const StringID STR_VEHICLE_LIST_SHIP_CAPTION = 0xBCA;
+static const StringID STR_VEHICLE_LIST_AIRCRAFT_CAPTION = 0xBCB;
+static const StringID STR_VEHICLE_LIST_TRAIN_LIST_TOOLTIP = 0xBCC;
+static const StringID STR_VEHICLE_LIST_ROAD_VEHICLE_TOOLTIP = 0xBCD;
+static const StringID STR_VEHICLE_LIST_SHIP_TOOLTIP = 0xBCE;
+static const StringID STR_VEHICLE_LIST_AIRCRAFT_TOOLTIP = 0xBCF;
+static const StringID STR_VEHICLE_LIST_AVAILABLE_TRAINS = 0xBD0;
+static const StringID STR_VEHICLE_LIST_AVAILABLE_ROAD_VEHICLES = 0xBD1;
+static const StringID STR_VEHICLE_LIST_AVAILABLE_SHIPS = 0xBD2;
+static const StringID STR_VEHICLE_LIST_AVAILABLE_AIRCRAFT = 0xBD3;
+static const StringID STR_VEHICLE_LIST_MANAGE_LIST = 0xBD4;
+static const StringID STR_VEHICLE_LIST_MANAGE_LIST_TOOLTIP = 0xBD5;
+static const StringID STR_VEHICLE_LIST_REPLACE_VEHICLES = 0xBD6;
+static const StringID STR_VEHICLE_LIST_SEND_FOR_SERVICING = 0xBD7;
+static const StringID STR_VEHICLE_LIST_PROFIT_THIS_YEAR_LAST_YEAR = 0xBD8;
+static const StringID STR_VEHICLE_LIST_CARGO = 0xBD9;
+static const StringID STR_VEHICLE_LIST_NAME_AND_CARGO = 0xBDA;
+static const StringID STR_VEHICLE_LIST_SEND_TRAIN_TO_DEPOT = 0xBDB;
+static const StringID STR_VEHICLE_LIST_SEND_ROAD_VEHICLE_TO_DEPOT = 0xBDC;
+static const StringID STR_VEHICLE_LIST_SEND_SHIP_TO_DEPOT = 0xBDD;
+static const StringID STR_VEHICLE_LIST_SEND_AIRCRAFT_TO_HANGAR = 0xBDE;
+static const StringID STR_VEHICLE_LIST_MASS_STOP_LIST_TOOLTIP = 0xBDF;
+static const StringID STR_VEHICLE_LIST_MASS_START_LIST_TOOLTIP = 0xBE0;
+static const StringID STR_VEHICLE_LIST_AVAILABLE_ENGINES_TOOLTIP = 0xBE1;
+static const StringID STR_VEHICLE_LIST_SHARED_ORDERS_LIST_CAPTION = 0xBE2;
+static const StringID STR_GROUP_ALL_TRAINS = 0xBE3;
+static const StringID STR_GROUP_ALL_ROAD_VEHICLES = 0xBE4;
+static const StringID STR_GROUP_ALL_SHIPS = 0xBE5;
+static const StringID STR_GROUP_ALL_AIRCRAFTS = 0xBE6;
+static const StringID STR_GROUP_DEFAULT_TRAINS = 0xBE7;
+static const StringID STR_GROUP_DEFAULT_ROAD_VEHICLES = 0xBE8;
+static const StringID STR_GROUP_DEFAULT_SHIPS = 0xBE9;
+static const StringID STR_GROUP_DEFAULT_AIRCRAFTS = 0xBEA;
+static const StringID STR_GROUP_COUNT_WITH_SUBGROUP = 0xBEB;
+static const StringID STR_GROUPS_CLICK_ON_GROUP_FOR_TOOLTIP = 0xBEC;
+static const StringID STR_GROUP_CREATE_TOOLTIP = 0xBED;
+static const StringID STR_GROUP_DELETE_TOOLTIP = 0xBEE;
+static const StringID STR_GROUP_RENAME_TOOLTIP = 0xBEF;
+static const StringID STR_GROUP_LIVERY_TOOLTIP = 0xBF0;
+static const StringID STR_GROUP_REPLACE_PROTECTION_TOOLTIP = 0xBF1;
+static const StringID STR_QUERY_GROUP_DELETE_CAPTION = 0xBF2;
+static const StringID STR_GROUP_DELETE_QUERY_TEXT = 0xBF3;
+static const StringID STR_GROUP_ADD_SHARED_VEHICLE = 0xBF4;
+static const StringID STR_GROUP_REMOVE_ALL_VEHICLES = 0xBF5;
+static const StringID STR_GROUP_RENAME_CAPTION = 0xBF6;
+static const StringID STR_GROUP_PROFIT_THIS_YEAR = 0xBF7;
+static const StringID STR_GROUP_PROFIT_LAST_YEAR = 0xBF8;
+static const StringID STR_GROUP_OCCUPANCY = 0xBF9;
+static const StringID STR_GROUP_OCCUPANCY_VALUE = 0xBFA;
+static const StringID STR_BUY_VEHICLE_TRAIN_RAIL_CAPTION = 0xBFB;
+static const StringID STR_BUY_VEHICLE_TRAIN_ELRAIL_CAPTION = 0xBFC;
+static const StringID STR_BUY_VEHICLE_TRAIN_MONORAIL_CAPTION = 0xBFD;
+static const StringID STR_BUY_VEHICLE_TRAIN_MAGLEV_CAPTION = 0xBFE;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_CAPTION = 0xBFF;
+static const StringID STR_BUY_VEHICLE_TRAM_VEHICLE_CAPTION = 0xC00;
+static const StringID STR_BUY_VEHICLE_TRAIN_ALL_CAPTION = 0xC01;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_ALL_CAPTION = 0xC02;
+static const StringID STR_BUY_VEHICLE_SHIP_CAPTION = 0xC03;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_CAPTION = 0xC04;
+static const StringID STR_PURCHASE_INFO_COST_WEIGHT = 0xC05;
+static const StringID STR_PURCHASE_INFO_COST_REFIT_WEIGHT = 0xC06;
+static const StringID STR_PURCHASE_INFO_SPEED_POWER = 0xC07;
+static const StringID STR_PURCHASE_INFO_SPEED = 0xC08;
+static const StringID STR_PURCHASE_INFO_SPEED_OCEAN = 0xC09;
+static const StringID STR_PURCHASE_INFO_SPEED_CANAL = 0xC0A;
+static const StringID STR_PURCHASE_INFO_RUNNINGCOST = 0xC0B;
+static const StringID STR_PURCHASE_INFO_CAPACITY = 0xC0C;
+static const StringID STR_PURCHASE_INFO_REFITTABLE = 0xC0D;
+static const StringID STR_PURCHASE_INFO_DESIGNED_LIFE = 0xC0E;
+static const StringID STR_PURCHASE_INFO_RELIABILITY = 0xC0F;
+static const StringID STR_PURCHASE_INFO_COST = 0xC10;
+static const StringID STR_PURCHASE_INFO_COST_REFIT = 0xC11;
+static const StringID STR_PURCHASE_INFO_WEIGHT_CWEIGHT = 0xC12;
+static const StringID STR_PURCHASE_INFO_COST_SPEED = 0xC13;
+static const StringID STR_PURCHASE_INFO_COST_REFIT_SPEED = 0xC14;
+static const StringID STR_PURCHASE_INFO_AIRCRAFT_CAPACITY = 0xC15;
+static const StringID STR_PURCHASE_INFO_PWAGPOWER_PWAGWEIGHT = 0xC16;
+static const StringID STR_PURCHASE_INFO_REFITTABLE_TO = 0xC17;
+static const StringID STR_PURCHASE_INFO_ALL_TYPES = 0xC18;
+static const StringID STR_PURCHASE_INFO_NONE = 0xC19;
+static const StringID STR_PURCHASE_INFO_ENGINES_ONLY = 0xC1A;
+static const StringID STR_PURCHASE_INFO_ALL_BUT = 0xC1B;
+static const StringID STR_PURCHASE_INFO_MAX_TE = 0xC1C;
+static const StringID STR_PURCHASE_INFO_AIRCRAFT_RANGE = 0xC1D;
+static const StringID STR_PURCHASE_INFO_AIRCRAFT_TYPE = 0xC1E;
+static const StringID STR_CARGO_TYPE_FILTER_ALL = 0xC1F;
+static const StringID STR_CARGO_TYPE_FILTER_FREIGHT = 0xC20;
+static const StringID STR_CARGO_TYPE_FILTER_NONE = 0xC21;
+static const StringID STR_BUY_VEHICLE_TRAIN_LIST_TOOLTIP = 0xC22;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_LIST_TOOLTIP = 0xC23;
+static const StringID STR_BUY_VEHICLE_SHIP_LIST_TOOLTIP = 0xC24;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_LIST_TOOLTIP = 0xC25;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_VEHICLE_BUTTON = 0xC26;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_BUY_VEHICLE_BUTTON = 0xC27;
+static const StringID STR_BUY_VEHICLE_SHIP_BUY_VEHICLE_BUTTON = 0xC28;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_BUY_VEHICLE_BUTTON = 0xC29;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_VEHICLE_BUTTON = 0xC2A;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_BUY_REFIT_VEHICLE_BUTTON = 0xC2B;
+static const StringID STR_BUY_VEHICLE_SHIP_BUY_REFIT_VEHICLE_BUTTON = 0xC2C;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_BUY_REFIT_VEHICLE_BUTTON = 0xC2D;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_VEHICLE_TOOLTIP = 0xC2E;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_BUY_VEHICLE_TOOLTIP = 0xC2F;
+static const StringID STR_BUY_VEHICLE_SHIP_BUY_VEHICLE_TOOLTIP = 0xC30;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_BUY_VEHICLE_TOOLTIP = 0xC31;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_VEHICLE_TOOLTIP = 0xC32;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_BUY_REFIT_VEHICLE_TOOLTIP = 0xC33;
+static const StringID STR_BUY_VEHICLE_SHIP_BUY_REFIT_VEHICLE_TOOLTIP = 0xC34;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_BUY_REFIT_VEHICLE_TOOLTIP = 0xC35;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_BUTTON = 0xC36;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_RENAME_BUTTON = 0xC37;
+static const StringID STR_BUY_VEHICLE_SHIP_RENAME_BUTTON = 0xC38;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_RENAME_BUTTON = 0xC39;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_TOOLTIP = 0xC3A;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_RENAME_TOOLTIP = 0xC3B;
+static const StringID STR_BUY_VEHICLE_SHIP_RENAME_TOOLTIP = 0xC3C;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_RENAME_TOOLTIP = 0xC3D;
+static const StringID STR_BUY_VEHICLE_TRAIN_HIDE_TOGGLE_BUTTON = 0xC3E;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_HIDE_TOGGLE_BUTTON = 0xC3F;
+static const StringID STR_BUY_VEHICLE_SHIP_HIDE_TOGGLE_BUTTON = 0xC40;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_HIDE_TOGGLE_BUTTON = 0xC41;
+static const StringID STR_BUY_VEHICLE_TRAIN_SHOW_TOGGLE_BUTTON = 0xC42;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_SHOW_TOGGLE_BUTTON = 0xC43;
+static const StringID STR_BUY_VEHICLE_SHIP_SHOW_TOGGLE_BUTTON = 0xC44;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_SHOW_TOGGLE_BUTTON = 0xC45;
+static const StringID STR_BUY_VEHICLE_TRAIN_HIDE_SHOW_TOGGLE_TOOLTIP = 0xC46;
+static const StringID STR_BUY_VEHICLE_ROAD_VEHICLE_HIDE_SHOW_TOGGLE_TOOLTIP = 0xC47;
+static const StringID STR_BUY_VEHICLE_SHIP_HIDE_SHOW_TOGGLE_TOOLTIP = 0xC48;
+static const StringID STR_BUY_VEHICLE_AIRCRAFT_HIDE_SHOW_TOGGLE_TOOLTIP = 0xC49;
+static const StringID STR_QUERY_RENAME_TRAIN_TYPE_CAPTION = 0xC4A;
+static const StringID STR_QUERY_RENAME_ROAD_VEHICLE_TYPE_CAPTION = 0xC4B;
+static const StringID STR_QUERY_RENAME_SHIP_TYPE_CAPTION = 0xC4C;
+static const StringID STR_QUERY_RENAME_AIRCRAFT_TYPE_CAPTION = 0xC4D;
+static const StringID STR_DEPOT_CAPTION = 0xC4E;
+static const StringID STR_DEPOT_RENAME_TOOLTIP = 0xC4F;
+static const StringID STR_DEPOT_RENAME_DEPOT_CAPTION = 0xC50;
+static const StringID STR_DEPOT_NO_ENGINE = 0xC51;
+static const StringID STR_DEPOT_VEHICLE_TOOLTIP = 0xC52;
+static const StringID STR_DEPOT_VEHICLE_TOOLTIP_CHAIN = 0xC53;
+static const StringID STR_DEPOT_VEHICLE_TOOLTIP_CARGO = 0xC54;
+static const StringID STR_DEPOT_TRAIN_LIST_TOOLTIP = 0xC55;
+static const StringID STR_DEPOT_ROAD_VEHICLE_LIST_TOOLTIP = 0xC56;
+static const StringID STR_DEPOT_SHIP_LIST_TOOLTIP = 0xC57;
+static const StringID STR_DEPOT_AIRCRAFT_LIST_TOOLTIP = 0xC58;
+static const StringID STR_DEPOT_TRAIN_SELL_TOOLTIP = 0xC59;
+static const StringID STR_DEPOT_ROAD_VEHICLE_SELL_TOOLTIP = 0xC5A;
+static const StringID STR_DEPOT_SHIP_SELL_TOOLTIP = 0xC5B;
+static const StringID STR_DEPOT_AIRCRAFT_SELL_TOOLTIP = 0xC5C;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_TRAIN_TOOLTIP = 0xC5D;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_ROAD_VEHICLE_TOOLTIP = 0xC5E;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_SHIP_TOOLTIP = 0xC5F;
+static const StringID STR_DEPOT_SELL_ALL_BUTTON_AIRCRAFT_TOOLTIP = 0xC60;
+static const StringID STR_DEPOT_AUTOREPLACE_TRAIN_TOOLTIP = 0xC61;
+static const StringID STR_DEPOT_AUTOREPLACE_ROAD_VEHICLE_TOOLTIP = 0xC62;
+static const StringID STR_DEPOT_AUTOREPLACE_SHIP_TOOLTIP = 0xC63;
+static const StringID STR_DEPOT_AUTOREPLACE_AIRCRAFT_TOOLTIP = 0xC64;
+static const StringID STR_DEPOT_TRAIN_NEW_VEHICLES_BUTTON = 0xC65;
+static const StringID STR_DEPOT_ROAD_VEHICLE_NEW_VEHICLES_BUTTON = 0xC66;
+static const StringID STR_DEPOT_SHIP_NEW_VEHICLES_BUTTON = 0xC67;
+static const StringID STR_DEPOT_AIRCRAFT_NEW_VEHICLES_BUTTON = 0xC68;
+static const StringID STR_DEPOT_TRAIN_NEW_VEHICLES_TOOLTIP = 0xC69;
+static const StringID STR_DEPOT_ROAD_VEHICLE_NEW_VEHICLES_TOOLTIP = 0xC6A;
+static const StringID STR_DEPOT_SHIP_NEW_VEHICLES_TOOLTIP = 0xC6B;
+static const StringID STR_DEPOT_AIRCRAFT_NEW_VEHICLES_TOOLTIP = 0xC6C;
+static const StringID STR_DEPOT_CLONE_TRAIN = 0xC6D;
+static const StringID STR_DEPOT_CLONE_ROAD_VEHICLE = 0xC6E;
+static const StringID STR_DEPOT_CLONE_SHIP = 0xC6F;
+static const StringID STR_DEPOT_CLONE_AIRCRAFT = 0xC70;
+static const StringID STR_DEPOT_CLONE_TRAIN_DEPOT_INFO = 0xC71;
+static const StringID STR_DEPOT_CLONE_ROAD_VEHICLE_DEPOT_INFO = 0xC72;
+static const StringID STR_DEPOT_CLONE_SHIP_DEPOT_INFO = 0xC73;
+static const StringID STR_DEPOT_CLONE_AIRCRAFT_INFO_HANGAR_WINDOW = 0xC74;
+static const StringID STR_DEPOT_TRAIN_LOCATION_TOOLTIP = 0xC75;
+static const StringID STR_DEPOT_ROAD_VEHICLE_LOCATION_TOOLTIP = 0xC76;
+static const StringID STR_DEPOT_SHIP_LOCATION_TOOLTIP = 0xC77;
+static const StringID STR_DEPOT_AIRCRAFT_LOCATION_TOOLTIP = 0xC78;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_TRAIN_TOOLTIP = 0xC79;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_ROAD_VEHICLE_TOOLTIP = 0xC7A;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_SHIP_TOOLTIP = 0xC7B;
+static const StringID STR_DEPOT_VEHICLE_ORDER_LIST_AIRCRAFT_TOOLTIP = 0xC7C;
+static const StringID STR_DEPOT_MASS_STOP_DEPOT_TRAIN_TOOLTIP = 0xC7D;
+static const StringID STR_DEPOT_MASS_STOP_DEPOT_ROAD_VEHICLE_TOOLTIP = 0xC7E;
+static const StringID STR_DEPOT_MASS_STOP_DEPOT_SHIP_TOOLTIP = 0xC7F;
+static const StringID STR_DEPOT_MASS_STOP_HANGAR_TOOLTIP = 0xC80;
+static const StringID STR_DEPOT_MASS_START_DEPOT_TRAIN_TOOLTIP = 0xC81;
+static const StringID STR_DEPOT_MASS_START_DEPOT_ROAD_VEHICLE_TOOLTIP = 0xC82;
+static const StringID STR_DEPOT_MASS_START_DEPOT_SHIP_TOOLTIP = 0xC83;
+static const StringID STR_DEPOT_MASS_START_HANGAR_TOOLTIP = 0xC84;
+static const StringID STR_DEPOT_DRAG_WHOLE_TRAIN_TO_SELL_TOOLTIP = 0xC85;
+static const StringID STR_DEPOT_SELL_CONFIRMATION_TEXT = 0xC86;
+static const StringID STR_ENGINE_PREVIEW_CAPTION = 0xC87;
+static const StringID STR_ENGINE_PREVIEW_MESSAGE = 0xC88;
+static const StringID STR_ENGINE_PREVIEW_RAILROAD_LOCOMOTIVE = 0xC89;
+static const StringID STR_ENGINE_PREVIEW_ELRAIL_LOCOMOTIVE = 0xC8A;
+static const StringID STR_ENGINE_PREVIEW_MONORAIL_LOCOMOTIVE = 0xC8B;
+static const StringID STR_ENGINE_PREVIEW_MAGLEV_LOCOMOTIVE = 0xC8C;
+static const StringID STR_ENGINE_PREVIEW_ROAD_VEHICLE = 0xC8D;
+static const StringID STR_ENGINE_PREVIEW_TRAM_VEHICLE = 0xC8E;
+static const StringID STR_ENGINE_PREVIEW_AIRCRAFT = 0xC8F;
+static const StringID STR_ENGINE_PREVIEW_SHIP = 0xC90;
+static const StringID STR_ENGINE_PREVIEW_COST_WEIGHT_SPEED_POWER = 0xC91;
+static const StringID STR_ENGINE_PREVIEW_COST_WEIGHT_SPEED_POWER_MAX_TE = 0xC92;
+static const StringID STR_ENGINE_PREVIEW_COST_MAX_SPEED_CAP_RUNCOST = 0xC93;
+static const StringID STR_ENGINE_PREVIEW_COST_MAX_SPEED_TYPE_CAP_CAP_RUNCOST = 0xC94;
+static const StringID STR_ENGINE_PREVIEW_COST_MAX_SPEED_TYPE_CAP_RUNCOST = 0xC95;
+static const StringID STR_ENGINE_PREVIEW_COST_MAX_SPEED_TYPE_RANGE_CAP_CAP_RUNCOST = 0xC96;
+static const StringID STR_ENGINE_PREVIEW_COST_MAX_SPEED_TYPE_RANGE_CAP_RUNCOST = 0xC97;
+static const StringID STR_REPLACE_VEHICLES_WHITE = 0xC98;
+static const StringID STR_REPLACE_VEHICLE_VEHICLES_IN_USE = 0xC99;
+static const StringID STR_REPLACE_VEHICLE_VEHICLES_IN_USE_TOOLTIP = 0xC9A;
+static const StringID STR_REPLACE_VEHICLE_AVAILABLE_VEHICLES = 0xC9B;
+static const StringID STR_REPLACE_VEHICLE_AVAILABLE_VEHICLES_TOOLTIP = 0xC9C;
+static const StringID STR_REPLACE_VEHICLE_TRAIN = 0xC9D;
+static const StringID STR_REPLACE_VEHICLE_ROAD_VEHICLE = 0xC9E;
+static const StringID STR_REPLACE_VEHICLE_SHIP = 0xC9F;
+static const StringID STR_REPLACE_VEHICLE_AIRCRAFT = 0xCA0;
+static const StringID STR_REPLACE_HELP_LEFT_ARRAY = 0xCA1;
+static const StringID STR_REPLACE_HELP_RIGHT_ARRAY = 0xCA2;
+static const StringID STR_REPLACE_VEHICLES_START = 0xCA3;
+static const StringID STR_REPLACE_VEHICLES_NOW = 0xCA4;
+static const StringID STR_REPLACE_VEHICLES_WHEN_OLD = 0xCA5;
+static const StringID STR_REPLACE_HELP_START_BUTTON = 0xCA6;
+static const StringID STR_REPLACE_NOT_REPLACING = 0xCA7;
+static const StringID STR_REPLACE_NOT_REPLACING_VEHICLE_SELECTED = 0xCA8;
+static const StringID STR_REPLACE_REPLACING_WHEN_OLD = 0xCA9;
+static const StringID STR_REPLACE_VEHICLES_STOP = 0xCAA;
+static const StringID STR_REPLACE_HELP_STOP_BUTTON = 0xCAB;
+static const StringID STR_REPLACE_ENGINE_WAGON_SELECT_HELP = 0xCAC;
+static const StringID STR_REPLACE_ENGINES = 0xCAD;
+static const StringID STR_REPLACE_WAGONS = 0xCAE;
+static const StringID STR_REPLACE_ALL_RAILTYPE = 0xCAF;
+static const StringID STR_REPLACE_ALL_ROADTYPE = 0xCB0;
+static const StringID STR_REPLACE_HELP_RAILTYPE = 0xCB1;
+static const StringID STR_REPLACE_HELP_ROADTYPE = 0xCB2;
+static const StringID STR_REPLACE_HELP_REPLACE_INFO_TAB = 0xCB3;
+static const StringID STR_REPLACE_RAIL_VEHICLES = 0xCB4;
+static const StringID STR_REPLACE_ELRAIL_VEHICLES = 0xCB5;
+static const StringID STR_REPLACE_MONORAIL_VEHICLES = 0xCB6;
+static const StringID STR_REPLACE_MAGLEV_VEHICLES = 0xCB7;
+static const StringID STR_REPLACE_ROAD_VEHICLES = 0xCB8;
+static const StringID STR_REPLACE_TRAM_VEHICLES = 0xCB9;
+static const StringID STR_REPLACE_REMOVE_WAGON = 0xCBA;
+static const StringID STR_REPLACE_REMOVE_WAGON_HELP = 0xCBB;
+static const StringID STR_REPLACE_REMOVE_WAGON_GROUP_HELP = 0xCBC;
+static const StringID STR_VEHICLE_VIEW_CAPTION = 0xCBD;
+static const StringID STR_VEHICLE_VIEW_TRAIN_CENTER_TOOLTIP = 0xCBE;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_CENTER_TOOLTIP = 0xCBF;
+static const StringID STR_VEHICLE_VIEW_SHIP_CENTER_TOOLTIP = 0xCC0;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_CENTER_TOOLTIP = 0xCC1;
+static const StringID STR_VEHICLE_VIEW_TRAIN_SEND_TO_DEPOT_TOOLTIP = 0xCC2;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_SEND_TO_DEPOT_TOOLTIP = 0xCC3;
+static const StringID STR_VEHICLE_VIEW_SHIP_SEND_TO_DEPOT_TOOLTIP = 0xCC4;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_SEND_TO_DEPOT_TOOLTIP = 0xCC5;
+static const StringID STR_VEHICLE_VIEW_CLONE_TRAIN_INFO = 0xCC6;
+static const StringID STR_VEHICLE_VIEW_CLONE_ROAD_VEHICLE_INFO = 0xCC7;
+static const StringID STR_VEHICLE_VIEW_CLONE_SHIP_INFO = 0xCC8;
+static const StringID STR_VEHICLE_VIEW_CLONE_AIRCRAFT_INFO = 0xCC9;
+static const StringID STR_VEHICLE_VIEW_TRAIN_IGNORE_SIGNAL_TOOLTIP = 0xCCA;
+static const StringID STR_VEHICLE_VIEW_TRAIN_REVERSE_TOOLTIP = 0xCCB;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_REVERSE_TOOLTIP = 0xCCC;
+static const StringID STR_VEHICLE_VIEW_ORDER_LOCATION_TOOLTIP = 0xCCD;
+static const StringID STR_VEHICLE_VIEW_TRAIN_REFIT_TOOLTIP = 0xCCE;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_REFIT_TOOLTIP = 0xCCF;
+static const StringID STR_VEHICLE_VIEW_SHIP_REFIT_TOOLTIP = 0xCD0;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_REFIT_TOOLTIP = 0xCD1;
+static const StringID STR_VEHICLE_VIEW_TRAIN_ORDERS_TOOLTIP = 0xCD2;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_ORDERS_TOOLTIP = 0xCD3;
+static const StringID STR_VEHICLE_VIEW_SHIP_ORDERS_TOOLTIP = 0xCD4;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_ORDERS_TOOLTIP = 0xCD5;
+static const StringID STR_VEHICLE_VIEW_TRAIN_SHOW_DETAILS_TOOLTIP = 0xCD6;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_SHOW_DETAILS_TOOLTIP = 0xCD7;
+static const StringID STR_VEHICLE_VIEW_SHIP_SHOW_DETAILS_TOOLTIP = 0xCD8;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_SHOW_DETAILS_TOOLTIP = 0xCD9;
+static const StringID STR_VEHICLE_VIEW_TRAIN_STATUS_START_STOP_TOOLTIP = 0xCDA;
+static const StringID STR_VEHICLE_VIEW_ROAD_VEHICLE_STATUS_START_STOP_TOOLTIP = 0xCDB;
+static const StringID STR_VEHICLE_VIEW_SHIP_STATE_STATUS_STOP_TOOLTIP = 0xCDC;
+static const StringID STR_VEHICLE_VIEW_AIRCRAFT_STATUS_START_STOP_TOOLTIP = 0xCDD;
+static const StringID STR_VEHICLE_STATUS_LOADING_UNLOADING = 0xCDE;
+static const StringID STR_VEHICLE_STATUS_LEAVING = 0xCDF;
+static const StringID STR_VEHICLE_STATUS_CRASHED = 0xCE0;
+static const StringID STR_VEHICLE_STATUS_BROKEN_DOWN = 0xCE1;
+static const StringID STR_VEHICLE_STATUS_STOPPED = 0xCE2;
+static const StringID STR_VEHICLE_STATUS_TRAIN_STOPPING_VEL = 0xCE3;
+static const StringID STR_VEHICLE_STATUS_TRAIN_NO_POWER = 0xCE4;
+static const StringID STR_VEHICLE_STATUS_TRAIN_STUCK = 0xCE5;
+static const StringID STR_VEHICLE_STATUS_AIRCRAFT_TOO_FAR = 0xCE6;
+static const StringID STR_VEHICLE_STATUS_HEADING_FOR_STATION_VEL = 0xCE7;
+static const StringID STR_VEHICLE_STATUS_NO_ORDERS_VEL = 0xCE8;
+static const StringID STR_VEHICLE_STATUS_HEADING_FOR_WAYPOINT_VEL = 0xCE9;
+static const StringID STR_VEHICLE_STATUS_HEADING_FOR_DEPOT_VEL = 0xCEA;
+static const StringID STR_VEHICLE_STATUS_HEADING_FOR_DEPOT_SERVICE_VEL = 0xCEB;
+static const StringID STR_VEHICLE_STATUS_CANNOT_REACH_STATION_VEL = 0xCEC;
+static const StringID STR_VEHICLE_STATUS_CANNOT_REACH_WAYPOINT_VEL = 0xCED;
+static const StringID STR_VEHICLE_STATUS_CANNOT_REACH_DEPOT_VEL = 0xCEE;
+static const StringID STR_VEHICLE_STATUS_CANNOT_REACH_DEPOT_SERVICE_VEL = 0xCEF;
+static const StringID STR_VEHICLE_COMMAND_STOPPED_SMALL = 0xCF0;
+static const StringID STR_VEHICLE_COMMAND_STOPPED = 0xCF1;
+static const StringID STR_VEHICLE_COMMAND_STARTED_SMALL = 0xCF2;
+static const StringID STR_VEHICLE_COMMAND_STARTED = 0xCF3;
+static const StringID STR_VEHICLE_DETAILS_CAPTION = 0xCF4;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_RENAME = 0xCF5;
+static const StringID STR_VEHICLE_DETAILS_ROAD_VEHICLE_RENAME = 0xCF6;
+static const StringID STR_VEHICLE_DETAILS_SHIP_RENAME = 0xCF7;
+static const StringID STR_VEHICLE_DETAILS_AIRCRAFT_RENAME = 0xCF8;
+static const StringID STR_VEHICLE_INFO_AGE_RUNNING_COST_YR = 0xCF9;
+static const StringID STR_VEHICLE_INFO_AGE = 0xCFA;
+static const StringID STR_VEHICLE_INFO_AGE_RED = 0xCFB;
+static const StringID STR_VEHICLE_INFO_MAX_SPEED = 0xCFC;
+static const StringID STR_VEHICLE_INFO_MAX_SPEED_TYPE = 0xCFD;
+static const StringID STR_VEHICLE_INFO_MAX_SPEED_TYPE_RANGE = 0xCFE;
+static const StringID STR_VEHICLE_INFO_WEIGHT_POWER_MAX_SPEED = 0xCFF;
+static const StringID STR_VEHICLE_INFO_WEIGHT_POWER_MAX_SPEED_MAX_TE = 0xD00;
+static const StringID STR_VEHICLE_INFO_PROFIT_THIS_YEAR_LAST_YEAR = 0xD01;
+static const StringID STR_VEHICLE_INFO_PROFIT_THIS_YEAR_LAST_YEAR_MIN_PERFORMANCE = 0xD02;
+static const StringID STR_VEHICLE_INFO_RELIABILITY_BREAKDOWNS = 0xD03;
+static const StringID STR_VEHICLE_INFO_BUILT_VALUE = 0xD04;
+static const StringID STR_VEHICLE_INFO_NO_CAPACITY = 0xD05;
+static const StringID STR_VEHICLE_INFO_CAPACITY = 0xD06;
+static const StringID STR_VEHICLE_INFO_CAPACITY_MULT = 0xD07;
+static const StringID STR_VEHICLE_INFO_CAPACITY_CAPACITY = 0xD08;
+static const StringID STR_VEHICLE_INFO_FEEDER_CARGO_VALUE = 0xD09;
+static const StringID STR_VEHICLE_DETAILS_SERVICING_INTERVAL_DAYS = 0xD0A;
+static const StringID STR_VEHICLE_DETAILS_SERVICING_INTERVAL_PERCENT = 0xD0B;
+static const StringID STR_VEHICLE_DETAILS_INCREASE_SERVICING_INTERVAL_TOOLTIP = 0xD0C;
+static const StringID STR_VEHICLE_DETAILS_DECREASE_SERVICING_INTERVAL_TOOLTIP = 0xD0D;
+static const StringID STR_SERVICE_INTERVAL_DROPDOWN_TOOLTIP = 0xD0E;
+static const StringID STR_VEHICLE_DETAILS_DEFAULT = 0xD0F;
+static const StringID STR_VEHICLE_DETAILS_DAYS = 0xD10;
+static const StringID STR_VEHICLE_DETAILS_PERCENT = 0xD11;
+static const StringID STR_QUERY_RENAME_TRAIN_CAPTION = 0xD12;
+static const StringID STR_QUERY_RENAME_ROAD_VEHICLE_CAPTION = 0xD13;
+static const StringID STR_QUERY_RENAME_SHIP_CAPTION = 0xD14;
+static const StringID STR_QUERY_RENAME_AIRCRAFT_CAPTION = 0xD15;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_ENGINE_BUILT_AND_VALUE = 0xD16;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_WAGON_VALUE = 0xD17;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_TOTAL_CAPACITY_TEXT = 0xD18;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_TOTAL_CAPACITY = 0xD19;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_TOTAL_CAPACITY_MULT = 0xD1A;
+static const StringID STR_VEHICLE_DETAILS_CARGO_EMPTY = 0xD1B;
+static const StringID STR_VEHICLE_DETAILS_CARGO_FROM = 0xD1C;
+static const StringID STR_VEHICLE_DETAILS_CARGO_FROM_MULT = 0xD1D;
+static const StringID STR_VEHICLE_DETAIL_TAB_CARGO = 0xD1E;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_CARGO_TOOLTIP = 0xD1F;
+static const StringID STR_VEHICLE_DETAIL_TAB_INFORMATION = 0xD20;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_INFORMATION_TOOLTIP = 0xD21;
+static const StringID STR_VEHICLE_DETAIL_TAB_CAPACITIES = 0xD22;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_CAPACITIES_TOOLTIP = 0xD23;
+static const StringID STR_VEHICLE_DETAIL_TAB_TOTAL_CARGO = 0xD24;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_TOTAL_CARGO_TOOLTIP = 0xD25;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_ARTICULATED_RV_CAPACITY = 0xD26;
+static const StringID STR_REFIT_CAPTION = 0xD27;
+static const StringID STR_REFIT_TITLE = 0xD28;
+static const StringID STR_REFIT_NEW_CAPACITY_COST_OF_REFIT = 0xD29;
+static const StringID STR_REFIT_NEW_CAPACITY_INCOME_FROM_REFIT = 0xD2A;
+static const StringID STR_REFIT_NEW_CAPACITY_COST_OF_AIRCRAFT_REFIT = 0xD2B;
+static const StringID STR_REFIT_NEW_CAPACITY_INCOME_FROM_AIRCRAFT_REFIT = 0xD2C;
+static const StringID STR_REFIT_SELECT_VEHICLES_TOOLTIP = 0xD2D;
+static const StringID STR_REFIT_TRAIN_LIST_TOOLTIP = 0xD2E;
+static const StringID STR_REFIT_ROAD_VEHICLE_LIST_TOOLTIP = 0xD2F;
+static const StringID STR_REFIT_SHIP_LIST_TOOLTIP = 0xD30;
+static const StringID STR_REFIT_AIRCRAFT_LIST_TOOLTIP = 0xD31;
+static const StringID STR_REFIT_TRAIN_REFIT_BUTTON = 0xD32;
+static const StringID STR_REFIT_ROAD_VEHICLE_REFIT_BUTTON = 0xD33;
+static const StringID STR_REFIT_SHIP_REFIT_BUTTON = 0xD34;
+static const StringID STR_REFIT_AIRCRAFT_REFIT_BUTTON = 0xD35;
+static const StringID STR_REFIT_TRAIN_REFIT_TOOLTIP = 0xD36;
+static const StringID STR_REFIT_ROAD_VEHICLE_REFIT_TOOLTIP = 0xD37;
+static const StringID STR_REFIT_SHIP_REFIT_TOOLTIP = 0xD38;
+static const StringID STR_REFIT_AIRCRAFT_REFIT_TOOLTIP = 0xD39;
+static const StringID STR_ORDERS_CAPTION = 0xD3A;
+static const StringID STR_ORDERS_TIMETABLE_VIEW = 0xD3B;
+static const StringID STR_ORDERS_TIMETABLE_VIEW_TOOLTIP = 0xD3C;
+static const StringID STR_ORDERS_LIST_TOOLTIP = 0xD3D;
+static const StringID STR_ORDER_INDEX = 0xD3E;
+static const StringID STR_ORDER_TEXT = 0xD3F;
+static const StringID STR_ORDERS_END_OF_ORDERS = 0xD40;
+static const StringID STR_ORDERS_END_OF_SHARED_ORDERS = 0xD41;
+static const StringID STR_ORDER_NON_STOP = 0xD42;
+static const StringID STR_ORDER_GO_TO = 0xD43;
+static const StringID STR_ORDER_GO_NON_STOP_TO = 0xD44;
+static const StringID STR_ORDER_GO_VIA = 0xD45;
+static const StringID STR_ORDER_GO_NON_STOP_VIA = 0xD46;
+static const StringID STR_ORDER_TOOLTIP_NON_STOP = 0xD47;
+static const StringID STR_ORDER_TOGGLE_FULL_LOAD = 0xD48;
+static const StringID STR_ORDER_DROP_LOAD_IF_POSSIBLE = 0xD49;
+static const StringID STR_ORDER_DROP_FULL_LOAD_ALL = 0xD4A;
+static const StringID STR_ORDER_DROP_FULL_LOAD_ANY = 0xD4B;
+static const StringID STR_ORDER_DROP_NO_LOADING = 0xD4C;
+static const StringID STR_ORDER_TOOLTIP_FULL_LOAD = 0xD4D;
+static const StringID STR_ORDER_TOGGLE_UNLOAD = 0xD4E;
+static const StringID STR_ORDER_DROP_UNLOAD_IF_ACCEPTED = 0xD4F;
+static const StringID STR_ORDER_DROP_UNLOAD = 0xD50;
+static const StringID STR_ORDER_DROP_TRANSFER = 0xD51;
+static const StringID STR_ORDER_DROP_NO_UNLOADING = 0xD52;
+static const StringID STR_ORDER_TOOLTIP_UNLOAD = 0xD53;
+static const StringID STR_ORDER_REFIT = 0xD54;
+static const StringID STR_ORDER_REFIT_TOOLTIP = 0xD55;
+static const StringID STR_ORDER_REFIT_AUTO = 0xD56;
+static const StringID STR_ORDER_REFIT_AUTO_TOOLTIP = 0xD57;
+static const StringID STR_ORDER_DROP_REFIT_AUTO = 0xD58;
+static const StringID STR_ORDER_DROP_REFIT_AUTO_ANY = 0xD59;
+static const StringID STR_ORDER_SERVICE = 0xD5A;
+static const StringID STR_ORDER_DROP_GO_ALWAYS_DEPOT = 0xD5B;
+static const StringID STR_ORDER_DROP_SERVICE_DEPOT = 0xD5C;
+static const StringID STR_ORDER_DROP_HALT_DEPOT = 0xD5D;
+static const StringID STR_ORDER_SERVICE_TOOLTIP = 0xD5E;
+static const StringID STR_ORDER_CONDITIONAL_VARIABLE_TOOLTIP = 0xD5F;
+static const StringID STR_ORDER_CONDITIONAL_LOAD_PERCENTAGE = 0xD60;
+static const StringID STR_ORDER_CONDITIONAL_RELIABILITY = 0xD61;
+static const StringID STR_ORDER_CONDITIONAL_MAX_SPEED = 0xD62;
+static const StringID STR_ORDER_CONDITIONAL_AGE = 0xD63;
+static const StringID STR_ORDER_CONDITIONAL_REQUIRES_SERVICE = 0xD64;
+static const StringID STR_ORDER_CONDITIONAL_UNCONDITIONALLY = 0xD65;
+static const StringID STR_ORDER_CONDITIONAL_REMAINING_LIFETIME = 0xD66;
+static const StringID STR_ORDER_CONDITIONAL_MAX_RELIABILITY = 0xD67;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING = 0xD68;
+static const StringID STR_ORDER_CONDITIONAL_ACCEPTANCE_DROPDOWN = 0xD69;
+static const StringID STR_ORDER_CONDITIONAL_FREE_PLATFORMS = 0xD6A;
+static const StringID STR_ORDER_CONDITIONAL_PERCENT = 0xD6B;
+static const StringID STR_ORDER_CONDITIONAL_SLOT_OCCUPANCY = 0xD6C;
+static const StringID STR_ORDER_CONDITIONAL_TRAIN_IN_SLOT = 0xD6D;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_LOAD_PERCENTAGE = 0xD6E;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING_AMOUNT = 0xD6F;
+static const StringID STR_ORDER_CONDITIONAL_COUNTER_VALUE = 0xD70;
+static const StringID STR_ORDER_CONDITIONAL_TIME_DATE_VALUE = 0xD71;
+static const StringID STR_ORDER_CONDITIONAL_TIMETABLE_STATE = 0xD72;
+static const StringID STR_ORDER_CONDITIONAL_DISPATCH_SLOT = 0xD73;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_TOOLTIP = 0xD74;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_EQUALS = 0xD75;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_NOT_EQUALS = 0xD76;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_LESS_THAN = 0xD77;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_LESS_EQUALS = 0xD78;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_MORE_THAN = 0xD79;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_MORE_EQUALS = 0xD7A;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_IS_TRUE = 0xD7B;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_IS_FALSE = 0xD7C;
+static const StringID STR_ORDER_CONDITIONAL_VALUE_TOOLTIP = 0xD7D;
+static const StringID STR_ORDER_CONDITIONAL_VALUE_CAPT = 0xD7E;
+static const StringID STR_ORDERS_SKIP_BUTTON = 0xD7F;
+static const StringID STR_ORDERS_SKIP_TOOLTIP = 0xD80;
+static const StringID STR_ORDERS_DELETE_BUTTON = 0xD81;
+static const StringID STR_ORDERS_DELETE_TOOLTIP = 0xD82;
+static const StringID STR_ORDERS_DELETE_ALL_TOOLTIP = 0xD83;
+static const StringID STR_ORDERS_STOP_SHARING_BUTTON = 0xD84;
+static const StringID STR_ORDERS_STOP_SHARING_TOOLTIP = 0xD85;
+static const StringID STR_ORDERS_GO_TO_BUTTON = 0xD86;
+static const StringID STR_ORDER_GO_TO_NEAREST_DEPOT = 0xD87;
+static const StringID STR_ORDER_GO_TO_NEAREST_HANGAR = 0xD88;
+static const StringID STR_ORDER_CONDITIONAL = 0xD89;
+static const StringID STR_ORDER_SHARE = 0xD8A;
+static const StringID STR_ORDERS_GO_TO_TOOLTIP = 0xD8B;
+static const StringID STR_ORDERS_VEH_WITH_SHARED_ORDERS_LIST_TOOLTIP = 0xD8C;
+static const StringID STR_ORDER_GO_TO_WAYPOINT = 0xD8D;
+static const StringID STR_ORDER_GO_NON_STOP_TO_WAYPOINT = 0xD8E;
+static const StringID STR_ORDER_SERVICE_AT = 0xD8F;
+static const StringID STR_ORDER_SERVICE_NON_STOP_AT = 0xD90;
+static const StringID STR_ORDER_NEAREST_DEPOT = 0xD91;
+static const StringID STR_ORDER_NEAREST_HANGAR = 0xD92;
+static const StringID STR_ORDER_TRAIN_DEPOT = 0xD93;
+static const StringID STR_ORDER_ROAD_VEHICLE_DEPOT = 0xD94;
+static const StringID STR_ORDER_SHIP_DEPOT = 0xD95;
+static const StringID STR_ORDER_GO_TO_NEAREST_DEPOT_FORMAT = 0xD96;
+static const StringID STR_ORDER_GO_TO_DEPOT_FORMAT = 0xD97;
+static const StringID STR_ORDER_REFIT_ORDER = 0xD98;
+static const StringID STR_ORDER_REFIT_STOP_ORDER = 0xD99;
+static const StringID STR_ORDER_STOP_ORDER = 0xD9A;
+static const StringID STR_ORDER_GO_TO_STATION = 0xD9B;
+static const StringID STR_ORDER_GO_TO_STATION_CAN_T_USE_STATION = 0xD9C;
+static const StringID STR_ORDER_IMPLICIT = 0xD9D;
+static const StringID STR_ORDER_FULL_LOAD = 0xD9E;
+static const StringID STR_ORDER_FULL_LOAD_ANY = 0xD9F;
+static const StringID STR_ORDER_NO_LOAD = 0xDA0;
+static const StringID STR_ORDER_UNLOAD = 0xDA1;
+static const StringID STR_ORDER_UNLOAD_FULL_LOAD = 0xDA2;
+static const StringID STR_ORDER_UNLOAD_FULL_LOAD_ANY = 0xDA3;
+static const StringID STR_ORDER_UNLOAD_NO_LOAD = 0xDA4;
+static const StringID STR_ORDER_TRANSFER = 0xDA5;
+static const StringID STR_ORDER_TRANSFER_FULL_LOAD = 0xDA6;
+static const StringID STR_ORDER_TRANSFER_FULL_LOAD_ANY = 0xDA7;
+static const StringID STR_ORDER_TRANSFER_NO_LOAD = 0xDA8;
+static const StringID STR_ORDER_NO_UNLOAD = 0xDA9;
+static const StringID STR_ORDER_NO_UNLOAD_FULL_LOAD = 0xDAA;
+static const StringID STR_ORDER_NO_UNLOAD_FULL_LOAD_ANY = 0xDAB;
+static const StringID STR_ORDER_NO_UNLOAD_NO_LOAD = 0xDAC;
+static const StringID STR_ORDER_AUTO_REFIT = 0xDAD;
+static const StringID STR_ORDER_FULL_LOAD_REFIT = 0xDAE;
+static const StringID STR_ORDER_FULL_LOAD_ANY_REFIT = 0xDAF;
+static const StringID STR_ORDER_UNLOAD_REFIT = 0xDB0;
+static const StringID STR_ORDER_UNLOAD_FULL_LOAD_REFIT = 0xDB1;
+static const StringID STR_ORDER_UNLOAD_FULL_LOAD_ANY_REFIT = 0xDB2;
+static const StringID STR_ORDER_TRANSFER_REFIT = 0xDB3;
+static const StringID STR_ORDER_TRANSFER_FULL_LOAD_REFIT = 0xDB4;
+static const StringID STR_ORDER_TRANSFER_FULL_LOAD_ANY_REFIT = 0xDB5;
+static const StringID STR_ORDER_NO_UNLOAD_REFIT = 0xDB6;
+static const StringID STR_ORDER_NO_UNLOAD_FULL_LOAD_REFIT = 0xDB7;
+static const StringID STR_ORDER_NO_UNLOAD_FULL_LOAD_ANY_REFIT = 0xDB8;
+static const StringID STR_ORDER_AUTO_REFIT_ANY = 0xDB9;
+static const StringID STR_ORDER_STOP_LOCATION_NEAR_END = 0xDBA;
+static const StringID STR_ORDER_STOP_LOCATION_MIDDLE = 0xDBB;
+static const StringID STR_ORDER_STOP_LOCATION_FAR_END = 0xDBC;
+static const StringID STR_ORDER_STOP_LOCATION_THROUGH = 0xDBD;
+static const StringID STR_ORDER_OUT_OF_RANGE = 0xDBE;
+static const StringID STR_ORDER_CONDITIONAL_UNCONDITIONAL = 0xDBF;
+static const StringID STR_ORDER_CONDITIONAL_NUM = 0xDC0;
+static const StringID STR_ORDER_CONDITIONAL_TRUE_FALSE = 0xDC1;
+static const StringID STR_INVALID_ORDER = 0xDC2;
+static const StringID STR_TIMETABLE_TITLE = 0xDC3;
+static const StringID STR_TIMETABLE_ORDER_VIEW = 0xDC4;
+static const StringID STR_TIMETABLE_ORDER_VIEW_TOOLTIP = 0xDC5;
+static const StringID STR_TIMETABLE_TOOLTIP = 0xDC6;
+static const StringID STR_TIMETABLE_NO_TRAVEL = 0xDC7;
+static const StringID STR_TIMETABLE_NOT_TIMETABLEABLE = 0xDC8;
+static const StringID STR_TIMETABLE_TRAVEL_NOT_TIMETABLED = 0xDC9;
+static const StringID STR_TIMETABLE_TRAVEL_NOT_TIMETABLED_SPEED = 0xDCA;
+static const StringID STR_TIMETABLE_TRAVEL_FOR = 0xDCB;
+static const StringID STR_TIMETABLE_TRAVEL_FOR_SPEED = 0xDCC;
+static const StringID STR_TIMETABLE_TRAVEL_FOR_ESTIMATED = 0xDCD;
+static const StringID STR_TIMETABLE_TRAVEL_FOR_SPEED_ESTIMATED = 0xDCE;
+static const StringID STR_TIMETABLE_STAY_FOR_ESTIMATED = 0xDCF;
+static const StringID STR_TIMETABLE_AND_TRAVEL_FOR_ESTIMATED = 0xDD0;
+static const StringID STR_TIMETABLE_STAY_FOR = 0xDD1;
+static const StringID STR_TIMETABLE_AND_TRAVEL_FOR = 0xDD2;
+static const StringID STR_TIMETABLE_DAYS = 0xDD3;
+static const StringID STR_TIMETABLE_TICKS = 0xDD4;
+static const StringID STR_TIMETABLE_TOTAL_TIME = 0xDD5;
+static const StringID STR_TIMETABLE_TOTAL_TIME_INCOMPLETE = 0xDD6;
+static const StringID STR_TIMETABLE_STATUS_ON_TIME = 0xDD7;
+static const StringID STR_TIMETABLE_STATUS_LATE = 0xDD8;
+static const StringID STR_TIMETABLE_STATUS_EARLY = 0xDD9;
+static const StringID STR_TIMETABLE_STATUS_NOT_STARTED = 0xDDA;
+static const StringID STR_TIMETABLE_STATUS_START_AT = 0xDDB;
+static const StringID STR_TIMETABLE_STARTING_DATE = 0xDDC;
+static const StringID STR_TIMETABLE_STARTING_DATE_TOOLTIP = 0xDDD;
+static const StringID STR_TIMETABLE_CHANGE_TIME = 0xDDE;
+static const StringID STR_TIMETABLE_WAIT_TIME_TOOLTIP = 0xDDF;
+static const StringID STR_TIMETABLE_CLEAR_TIME = 0xDE0;
+static const StringID STR_TIMETABLE_CLEAR_TIME_TOOLTIP = 0xDE1;
+static const StringID STR_TIMETABLE_CHANGE_SPEED = 0xDE2;
+static const StringID STR_TIMETABLE_CHANGE_SPEED_TOOLTIP = 0xDE3;
+static const StringID STR_TIMETABLE_CLEAR_SPEED = 0xDE4;
+static const StringID STR_TIMETABLE_CLEAR_SPEED_TOOLTIP = 0xDE5;
+static const StringID STR_TIMETABLE_RESET_LATENESS = 0xDE6;
+static const StringID STR_TIMETABLE_RESET_LATENESS_TOOLTIP = 0xDE7;
+static const StringID STR_TIMETABLE_AUTOFILL = 0xDE8;
+static const StringID STR_TIMETABLE_AUTOFILL_TOOLTIP = 0xDE9;
+static const StringID STR_TIMETABLE_EXPECTED = 0xDEA;
+static const StringID STR_TIMETABLE_SCHEDULED = 0xDEB;
+static const StringID STR_TIMETABLE_EXPECTED_TOOLTIP = 0xDEC;
+static const StringID STR_TIMETABLE_ARRIVAL_ABBREVIATION = 0xDED;
+static const StringID STR_TIMETABLE_DEPARTURE_ABBREVIATION = 0xDEE;
+static const StringID STR_DATE_CAPTION = 0xDEF;
+static const StringID STR_DATE_SET_DATE = 0xDF0;
+static const StringID STR_DATE_SET_DATE_TOOLTIP = 0xDF1;
+static const StringID STR_DATE_DAY_TOOLTIP = 0xDF2;
+static const StringID STR_DATE_MONTH_TOOLTIP = 0xDF3;
+static const StringID STR_DATE_YEAR_TOOLTIP = 0xDF4;
+static const StringID STR_AI_DEBUG = 0xDF5;
+static const StringID STR_AI_DEBUG_NAME_AND_VERSION = 0xDF6;
+static const StringID STR_AI_DEBUG_NAME_TOOLTIP = 0xDF7;
+static const StringID STR_AI_DEBUG_SETTINGS = 0xDF8;
+static const StringID STR_AI_DEBUG_SETTINGS_TOOLTIP = 0xDF9;
+static const StringID STR_AI_DEBUG_RELOAD = 0xDFA;
+static const StringID STR_AI_DEBUG_RELOAD_TOOLTIP = 0xDFB;
+static const StringID STR_AI_DEBUG_BREAK_STR_ON_OFF_TOOLTIP = 0xDFC;
+static const StringID STR_AI_DEBUG_BREAK_ON_LABEL = 0xDFD;
+static const StringID STR_AI_DEBUG_BREAK_STR_OSKTITLE = 0xDFE;
+static const StringID STR_AI_DEBUG_BREAK_STR_TOOLTIP = 0xDFF;
+static const StringID STR_AI_DEBUG_MATCH_CASE = 0xE00;
+static const StringID STR_AI_DEBUG_MATCH_CASE_TOOLTIP = 0xE01;
+static const StringID STR_AI_DEBUG_CONTINUE = 0xE02;
+static const StringID STR_AI_DEBUG_CONTINUE_TOOLTIP = 0xE03;
+static const StringID STR_AI_DEBUG_SELECT_AI_TOOLTIP = 0xE04;
+static const StringID STR_AI_GAME_SCRIPT = 0xE05;
+static const StringID STR_AI_GAME_SCRIPT_TOOLTIP = 0xE06;
+static const StringID STR_ERROR_AI_NO_AI_FOUND = 0xE07;
+static const StringID STR_ERROR_AI_PLEASE_REPORT_CRASH = 0xE08;
+static const StringID STR_ERROR_AI_DEBUG_SERVER_ONLY = 0xE09;
+static const StringID STR_AI_CONFIG_CAPTION_AI = 0xE0A;
+static const StringID STR_AI_CONFIG_CAPTION_GAMESCRIPT = 0xE0B;
+static const StringID STR_AI_CONFIG_GAMELIST_TOOLTIP = 0xE0C;
+static const StringID STR_AI_CONFIG_AILIST_TOOLTIP = 0xE0D;
+static const StringID STR_AI_CONFIG_HUMAN_PLAYER = 0xE0E;
+static const StringID STR_AI_CONFIG_RANDOM_AI = 0xE0F;
+static const StringID STR_AI_CONFIG_NONE = 0xE10;
+static const StringID STR_AI_CONFIG_NAME_VERSION = 0xE11;
+static const StringID STR_AI_CONFIG_MAX_COMPETITORS = 0xE12;
+static const StringID STR_AI_CONFIG_MOVE_UP = 0xE13;
+static const StringID STR_AI_CONFIG_MOVE_UP_TOOLTIP = 0xE14;
+static const StringID STR_AI_CONFIG_MOVE_DOWN = 0xE15;
+static const StringID STR_AI_CONFIG_MOVE_DOWN_TOOLTIP = 0xE16;
+static const StringID STR_AI_CONFIG_GAMESCRIPT = 0xE17;
+static const StringID STR_AI_CONFIG_GAMESCRIPT_PARAM = 0xE18;
+static const StringID STR_AI_CONFIG_AI = 0xE19;
+static const StringID STR_AI_CONFIG_CHANGE_AI = 0xE1A;
+static const StringID STR_AI_CONFIG_CHANGE_GAMESCRIPT = 0xE1B;
+static const StringID STR_AI_CONFIG_CHANGE_TOOLTIP = 0xE1C;
+static const StringID STR_AI_CONFIG_CONFIGURE = 0xE1D;
+static const StringID STR_AI_CONFIG_CONFIGURE_TOOLTIP = 0xE1E;
+static const StringID STR_AI_LIST_CAPTION = 0xE1F;
+static const StringID STR_AI_LIST_CAPTION_AI = 0xE20;
+static const StringID STR_AI_LIST_CAPTION_GAMESCRIPT = 0xE21;
+static const StringID STR_AI_LIST_TOOLTIP = 0xE22;
+static const StringID STR_AI_LIST_AUTHOR = 0xE23;
+static const StringID STR_AI_LIST_VERSION = 0xE24;
+static const StringID STR_AI_LIST_URL = 0xE25;
+static const StringID STR_AI_LIST_ACCEPT = 0xE26;
+static const StringID STR_AI_LIST_ACCEPT_TOOLTIP = 0xE27;
+static const StringID STR_AI_LIST_CANCEL = 0xE28;
+static const StringID STR_AI_LIST_CANCEL_TOOLTIP = 0xE29;
+static const StringID STR_SCREENSHOT_CAPTION = 0xE2A;
+static const StringID STR_SCREENSHOT_SCREENSHOT = 0xE2B;
+static const StringID STR_SCREENSHOT_ZOOMIN_SCREENSHOT = 0xE2C;
+static const StringID STR_SCREENSHOT_DEFAULTZOOM_SCREENSHOT = 0xE2D;
+static const StringID STR_SCREENSHOT_WORLD_SCREENSHOT = 0xE2E;
+static const StringID STR_SCREENSHOT_HEIGHTMAP_SCREENSHOT = 0xE2F;
+static const StringID STR_SCREENSHOT_MINIMAP_SCREENSHOT = 0xE30;
+static const StringID STR_AI_SETTINGS_CAPTION = 0xE31;
+static const StringID STR_AI_SETTINGS_CAPTION_AI = 0xE32;
+static const StringID STR_AI_SETTINGS_CAPTION_GAMESCRIPT = 0xE33;
+static const StringID STR_AI_SETTINGS_CLOSE = 0xE34;
+static const StringID STR_AI_SETTINGS_RESET = 0xE35;
+static const StringID STR_AI_SETTINGS_SETTING = 0xE36;
+static const StringID STR_AI_SETTINGS_START_DELAY = 0xE37;
+static const StringID STR_TEXTFILE_WRAP_TEXT = 0xE38;
+static const StringID STR_TEXTFILE_WRAP_TEXT_TOOLTIP = 0xE39;
+static const StringID STR_TEXTFILE_VIEW_README = 0xE3A;
+static const StringID STR_TEXTFILE_VIEW_CHANGELOG = 0xE3B;
+static const StringID STR_TEXTFILE_VIEW_LICENCE = 0xE3C;
+static const StringID STR_TEXTFILE_README_CAPTION = 0xE3D;
+static const StringID STR_TEXTFILE_CHANGELOG_CAPTION = 0xE3E;
+static const StringID STR_TEXTFILE_LICENCE_CAPTION = 0xE3F;
+static const StringID STR_PERCENT_UP_SMALL = 0xE40;
+static const StringID STR_PERCENT_UP = 0xE41;
+static const StringID STR_PERCENT_DOWN_SMALL = 0xE42;
+static const StringID STR_PERCENT_DOWN = 0xE43;
+static const StringID STR_PERCENT_UP_DOWN_SMALL = 0xE44;
+static const StringID STR_PERCENT_UP_DOWN = 0xE45;
+static const StringID STR_PERCENT_NONE_SMALL = 0xE46;
+static const StringID STR_PERCENT_NONE = 0xE47;
+static const StringID STR_INCOME_FLOAT_COST_SMALL = 0xE48;
+static const StringID STR_INCOME_FLOAT_COST = 0xE49;
+static const StringID STR_INCOME_FLOAT_INCOME_SMALL = 0xE4A;
+static const StringID STR_INCOME_FLOAT_INCOME = 0xE4B;
+static const StringID STR_FEEDER_TINY = 0xE4C;
+static const StringID STR_FEEDER = 0xE4D;
+static const StringID STR_FEEDER_INCOME_TINY = 0xE4E;
+static const StringID STR_FEEDER_INCOME = 0xE4F;
+static const StringID STR_FEEDER_COST_TINY = 0xE50;
+static const StringID STR_FEEDER_COST = 0xE51;
+static const StringID STR_MESSAGE_ESTIMATED_COST = 0xE52;
+static const StringID STR_MESSAGE_ESTIMATED_INCOME = 0xE53;
+static const StringID STR_ERROR_SAVE_STILL_IN_PROGRESS = 0xE54;
+static const StringID STR_ERROR_AUTOSAVE_FAILED = 0xE55;
+static const StringID STR_ERROR_UNABLE_TO_READ_DRIVE = 0xE56;
+static const StringID STR_ERROR_GAME_SAVE_FAILED = 0xE57;
+static const StringID STR_ERROR_UNABLE_TO_DELETE_FILE = 0xE58;
+static const StringID STR_ERROR_GAME_LOAD_FAILED = 0xE59;
+static const StringID STR_GAME_SAVELOAD_ERROR_BROKEN_INTERNAL_ERROR = 0xE5A;
+static const StringID STR_GAME_SAVELOAD_ERROR_BROKEN_SAVEGAME = 0xE5B;
+static const StringID STR_GAME_SAVELOAD_ERROR_TOO_NEW_SAVEGAME = 0xE5C;
+static const StringID STR_GAME_SAVELOAD_ERROR_FILE_NOT_READABLE = 0xE5D;
+static const StringID STR_GAME_SAVELOAD_ERROR_FILE_NOT_WRITEABLE = 0xE5E;
+static const StringID STR_GAME_SAVELOAD_ERROR_DATA_INTEGRITY_CHECK_FAILED = 0xE5F;
+static const StringID STR_GAME_SAVELOAD_ERROR_PATCHPACK = 0xE60;
+static const StringID STR_GAME_SAVELOAD_NOT_AVAILABLE = 0xE61;
+static const StringID STR_WARNING_LOADGAME_REMOVED_TRAMS = 0xE62;
+static const StringID STR_ERROR_COULD_NOT_CREATE_TOWN = 0xE63;
+static const StringID STR_ERROR_NO_TOWN_IN_SCENARIO = 0xE64;
+static const StringID STR_ERROR_PNGMAP = 0xE65;
+static const StringID STR_ERROR_PNGMAP_FILE_NOT_FOUND = 0xE66;
+static const StringID STR_ERROR_PNGMAP_IMAGE_TYPE = 0xE67;
+static const StringID STR_ERROR_PNGMAP_MISC = 0xE68;
+static const StringID STR_ERROR_BMPMAP = 0xE69;
+static const StringID STR_ERROR_BMPMAP_IMAGE_TYPE = 0xE6A;
+static const StringID STR_ERROR_HEIGHTMAP_TOO_LARGE = 0xE6B;
+static const StringID STR_WARNING_HEIGHTMAP_SCALE_CAPTION = 0xE6C;
+static const StringID STR_WARNING_HEIGHTMAP_SCALE_MESSAGE = 0xE6D;
+static const StringID STR_WARNING_FALLBACK_SOUNDSET = 0xE6E;
+static const StringID STR_WARNING_SCREENSHOT_SIZE_CAPTION = 0xE6F;
+static const StringID STR_WARNING_SCREENSHOT_SIZE_MESSAGE = 0xE70;
+static const StringID STR_MESSAGE_HEIGHTMAP_SUCCESSFULLY = 0xE71;
+static const StringID STR_MESSAGE_SCREENSHOT_SUCCESSFULLY = 0xE72;
+static const StringID STR_ERROR_SCREENSHOT_FAILED = 0xE73;
+static const StringID STR_ERROR_MESSAGE_CAPTION = 0xE74;
+static const StringID STR_ERROR_MESSAGE_CAPTION_OTHER_COMPANY = 0xE75;
+static const StringID STR_ERROR_OFF_EDGE_OF_MAP = 0xE76;
+static const StringID STR_ERROR_TOO_CLOSE_TO_EDGE_OF_MAP = 0xE77;
+static const StringID STR_ERROR_NOT_ENOUGH_CASH_REQUIRES_CURRENCY = 0xE78;
+static const StringID STR_ERROR_FLAT_LAND_REQUIRED = 0xE79;
+static const StringID STR_ERROR_LAND_SLOPED_IN_WRONG_DIRECTION = 0xE7A;
+static const StringID STR_ERROR_CAN_T_DO_THIS = 0xE7B;
+static const StringID STR_ERROR_BUILDING_MUST_BE_DEMOLISHED = 0xE7C;
+static const StringID STR_ERROR_CAN_T_CLEAR_THIS_AREA = 0xE7D;
+static const StringID STR_ERROR_SITE_UNSUITABLE = 0xE7E;
+static const StringID STR_ERROR_ALREADY_BUILT = 0xE7F;
+static const StringID STR_ERROR_OWNED_BY = 0xE80;
+static const StringID STR_ERROR_AREA_IS_OWNED_BY_ANOTHER = 0xE81;
+static const StringID STR_ERROR_TERRAFORM_LIMIT_REACHED = 0xE82;
+static const StringID STR_ERROR_CLEARING_LIMIT_REACHED = 0xE83;
+static const StringID STR_ERROR_TREE_PLANT_LIMIT_REACHED = 0xE84;
+static const StringID STR_ERROR_NAME_MUST_BE_UNIQUE = 0xE85;
+static const StringID STR_ERROR_GENERIC_OBJECT_IN_THE_WAY = 0xE86;
+static const StringID STR_ERROR_NOT_ALLOWED_WHILE_PAUSED = 0xE87;
+static const StringID STR_ERROR_LOCAL_AUTHORITY_REFUSES_TO_ALLOW_THIS = 0xE88;
+static const StringID STR_ERROR_LOCAL_AUTHORITY_REFUSES_AIRPORT = 0xE89;
+static const StringID STR_ERROR_LOCAL_AUTHORITY_REFUSES_NOISE = 0xE8A;
+static const StringID STR_ERROR_BRIBE_FAILED = 0xE8B;
+static const StringID STR_ERROR_CAN_T_RAISE_LAND_HERE = 0xE8C;
+static const StringID STR_ERROR_CAN_T_LOWER_LAND_HERE = 0xE8D;
+static const StringID STR_ERROR_CAN_T_LEVEL_LAND_HERE = 0xE8E;
+static const StringID STR_ERROR_EXCAVATION_WOULD_DAMAGE = 0xE8F;
+static const StringID STR_ERROR_ALREADY_AT_SEA_LEVEL = 0xE90;
+static const StringID STR_ERROR_TOO_HIGH = 0xE91;
+static const StringID STR_ERROR_ALREADY_LEVELLED = 0xE92;
+static const StringID STR_ERROR_BRIDGE_TOO_HIGH_AFTER_LOWER_LAND = 0xE93;
+static const StringID STR_ERROR_CAN_T_CHANGE_COMPANY_NAME = 0xE94;
+static const StringID STR_ERROR_CAN_T_CHANGE_PRESIDENT = 0xE95;
+static const StringID STR_ERROR_MAXIMUM_PERMITTED_LOAN = 0xE96;
+static const StringID STR_ERROR_CAN_T_BORROW_ANY_MORE_MONEY = 0xE97;
+static const StringID STR_ERROR_LOAN_ALREADY_REPAYED = 0xE98;
+static const StringID STR_ERROR_CURRENCY_REQUIRED = 0xE99;
+static const StringID STR_ERROR_CAN_T_REPAY_LOAN = 0xE9A;
+static const StringID STR_ERROR_INSUFFICIENT_FUNDS = 0xE9B;
+static const StringID STR_ERROR_CAN_T_GIVE_MONEY = 0xE9C;
+static const StringID STR_ERROR_CAN_T_BUY_COMPANY = 0xE9D;
+static const StringID STR_ERROR_CAN_T_BUILD_COMPANY_HEADQUARTERS = 0xE9E;
+static const StringID STR_ERROR_CAN_T_BUY_25_SHARE_IN_THIS = 0xE9F;
+static const StringID STR_ERROR_CAN_T_SELL_25_SHARE_IN = 0xEA0;
+static const StringID STR_ERROR_PROTECTED = 0xEA1;
+static const StringID STR_ERROR_CAN_T_GENERATE_TOWN = 0xEA2;
+static const StringID STR_ERROR_CAN_T_RENAME_TOWN = 0xEA3;
+static const StringID STR_ERROR_CAN_T_FOUND_TOWN_HERE = 0xEA4;
+static const StringID STR_ERROR_CAN_T_EXPAND_TOWN = 0xEA5;
+static const StringID STR_ERROR_TOO_CLOSE_TO_EDGE_OF_MAP_SUB = 0xEA6;
+static const StringID STR_ERROR_TOO_CLOSE_TO_ANOTHER_TOWN = 0xEA7;
+static const StringID STR_ERROR_TOO_MANY_TOWNS = 0xEA8;
+static const StringID STR_ERROR_NO_SPACE_FOR_TOWN = 0xEA9;
+static const StringID STR_ERROR_TOWN_EXPAND_WARN_NO_ROADS = 0xEAA;
+static const StringID STR_ERROR_ROAD_WORKS_IN_PROGRESS = 0xEAB;
+static const StringID STR_ERROR_TOWN_CAN_T_DELETE = 0xEAC;
+static const StringID STR_ERROR_STATUE_NO_SUITABLE_PLACE = 0xEAD;
+static const StringID STR_ERROR_TOO_MANY_INDUSTRIES = 0xEAE;
+static const StringID STR_ERROR_CAN_T_GENERATE_INDUSTRIES = 0xEAF;
+static const StringID STR_ERROR_CAN_T_BUILD_HERE = 0xEB0;
+static const StringID STR_ERROR_CAN_T_CONSTRUCT_THIS_INDUSTRY = 0xEB1;
+static const StringID STR_ERROR_CAN_T_PROSPECT_INDUSTRY = 0xEB2;
+static const StringID STR_ERROR_INDUSTRY_TOO_CLOSE = 0xEB3;
+static const StringID STR_ERROR_MUST_FOUND_TOWN_FIRST = 0xEB4;
+static const StringID STR_ERROR_ONLY_ONE_ALLOWED_PER_TOWN = 0xEB5;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_IN_TOWNS_WITH_POPULATION_OF_1200 = 0xEB6;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_IN_RAINFOREST = 0xEB7;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_IN_DESERT = 0xEB8;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_IN_TOWNS = 0xEB9;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_NEAR_TOWN_CENTER = 0xEBA;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_IN_LOW_AREAS = 0xEBB;
+static const StringID STR_ERROR_CAN_ONLY_BE_POSITIONED = 0xEBC;
+static const StringID STR_ERROR_FOREST_CAN_ONLY_BE_PLANTED = 0xEBD;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_ABOVE_SNOW_LINE = 0xEBE;
+static const StringID STR_ERROR_CAN_ONLY_BE_BUILT_BELOW_SNOW_LINE = 0xEBF;
+static const StringID STR_ERROR_PROSPECTING_WAS_UNLUCKY = 0xEC0;
+static const StringID STR_ERROR_NO_SUITABLE_PLACES_FOR_PROSPECTING = 0xEC1;
+static const StringID STR_ERROR_NO_SUITABLE_PLACES_FOR_INDUSTRIES = 0xEC2;
+static const StringID STR_ERROR_NO_SUITABLE_PLACES_FOR_INDUSTRIES_EXPLANATION = 0xEC3;
+static const StringID STR_ERROR_CAN_T_BUILD_RAILROAD_STATION = 0xEC4;
+static const StringID STR_ERROR_CAN_T_BUILD_BUS_STATION = 0xEC5;
+static const StringID STR_ERROR_CAN_T_BUILD_TRUCK_STATION = 0xEC6;
+static const StringID STR_ERROR_CAN_T_BUILD_PASSENGER_TRAM_STATION = 0xEC7;
+static const StringID STR_ERROR_CAN_T_BUILD_CARGO_TRAM_STATION = 0xEC8;
+static const StringID STR_ERROR_CAN_T_BUILD_DOCK_HERE = 0xEC9;
+static const StringID STR_ERROR_CAN_T_BUILD_AIRPORT_HERE = 0xECA;
+static const StringID STR_ERROR_ADJOINS_MORE_THAN_ONE_EXISTING = 0xECB;
+static const StringID STR_ERROR_STATION_TOO_SPREAD_OUT = 0xECC;
+static const StringID STR_ERROR_TOO_MANY_STATIONS_LOADING = 0xECD;
+static const StringID STR_ERROR_TOO_MANY_STATION_SPECS = 0xECE;
+static const StringID STR_ERROR_TOO_MANY_BUS_STOPS = 0xECF;
+static const StringID STR_ERROR_TOO_MANY_TRUCK_STOPS = 0xED0;
+static const StringID STR_ERROR_TOO_CLOSE_TO_ANOTHER_DOCK = 0xED1;
+static const StringID STR_ERROR_TOO_CLOSE_TO_ANOTHER_AIRPORT = 0xED2;
+static const StringID STR_ERROR_CAN_T_RENAME_STATION = 0xED3;
+static const StringID STR_ERROR_DRIVE_THROUGH_ON_TOWN_ROAD = 0xED4;
+static const StringID STR_ERROR_DRIVE_THROUGH_DIRECTION = 0xED5;
+static const StringID STR_ERROR_DRIVE_THROUGH_CORNER = 0xED6;
+static const StringID STR_ERROR_DRIVE_THROUGH_JUNCTION = 0xED7;
+static const StringID STR_ERROR_CAN_T_REMOVE_PART_OF_STATION = 0xED8;
+static const StringID STR_ERROR_MUST_REMOVE_RAILWAY_STATION_FIRST = 0xED9;
+static const StringID STR_ERROR_CAN_T_REMOVE_BUS_STATION = 0xEDA;
+static const StringID STR_ERROR_CAN_T_REMOVE_TRUCK_STATION = 0xEDB;
+static const StringID STR_ERROR_CAN_T_REMOVE_PASSENGER_TRAM_STATION = 0xEDC;
+static const StringID STR_ERROR_CAN_T_REMOVE_CARGO_TRAM_STATION = 0xEDD;
+static const StringID STR_ERROR_MUST_REMOVE_ROAD_STOP_FIRST = 0xEDE;
+static const StringID STR_ERROR_THERE_IS_NO_STATION = 0xEDF;
+static const StringID STR_ERROR_MUST_DEMOLISH_RAILROAD = 0xEE0;
+static const StringID STR_ERROR_MUST_DEMOLISH_BUS_STATION_FIRST = 0xEE1;
+static const StringID STR_ERROR_MUST_DEMOLISH_TRUCK_STATION_FIRST = 0xEE2;
+static const StringID STR_ERROR_MUST_DEMOLISH_PASSENGER_TRAM_STATION_FIRST = 0xEE3;
+static const StringID STR_ERROR_MUST_DEMOLISH_CARGO_TRAM_STATION_FIRST = 0xEE4;
+static const StringID STR_ERROR_MUST_DEMOLISH_DOCK_FIRST = 0xEE5;
+static const StringID STR_ERROR_MUST_DEMOLISH_AIRPORT_FIRST = 0xEE6;
+static const StringID STR_ERROR_WAYPOINT_ADJOINS_MORE_THAN_ONE_EXISTING = 0xEE7;
+static const StringID STR_ERROR_TOO_CLOSE_TO_ANOTHER_WAYPOINT = 0xEE8;
+static const StringID STR_ERROR_CAN_T_BUILD_TRAIN_WAYPOINT = 0xEE9;
+static const StringID STR_ERROR_CAN_T_POSITION_BUOY_HERE = 0xEEA;
+static const StringID STR_ERROR_CAN_T_CHANGE_WAYPOINT_NAME = 0xEEB;
+static const StringID STR_ERROR_CAN_T_REMOVE_TRAIN_WAYPOINT = 0xEEC;
+static const StringID STR_ERROR_MUST_REMOVE_RAILWAYPOINT_FIRST = 0xEED;
+static const StringID STR_ERROR_BUOY_IN_THE_WAY = 0xEEE;
+static const StringID STR_ERROR_BUOY_IS_IN_USE = 0xEEF;
+static const StringID STR_ERROR_CAN_T_BUILD_TRAIN_DEPOT = 0xEF0;
+static const StringID STR_ERROR_CAN_T_BUILD_ROAD_DEPOT = 0xEF1;
+static const StringID STR_ERROR_CAN_T_BUILD_TRAM_DEPOT = 0xEF2;
+static const StringID STR_ERROR_CAN_T_BUILD_SHIP_DEPOT = 0xEF3;
+static const StringID STR_ERROR_CAN_T_RENAME_DEPOT = 0xEF4;
+static const StringID STR_ERROR_TRAIN_MUST_BE_STOPPED_INSIDE_DEPOT = 0xEF5;
+static const StringID STR_ERROR_ROAD_VEHICLE_MUST_BE_STOPPED_INSIDE_DEPOT = 0xEF6;
+static const StringID STR_ERROR_SHIP_MUST_BE_STOPPED_INSIDE_DEPOT = 0xEF7;
+static const StringID STR_ERROR_AIRCRAFT_MUST_BE_STOPPED_INSIDE_HANGAR = 0xEF8;
+static const StringID STR_ERROR_TRAINS_CAN_ONLY_BE_ALTERED_INSIDE_A_DEPOT = 0xEF9;
+static const StringID STR_ERROR_TRAIN_TOO_LONG = 0xEFA;
+static const StringID STR_ERROR_CAN_T_REVERSE_DIRECTION_RAIL_VEHICLE = 0xEFB;
+static const StringID STR_ERROR_CAN_T_REVERSE_DIRECTION_RAIL_VEHICLE_MULTIPLE_UNITS = 0xEFC;
+static const StringID STR_ERROR_INCOMPATIBLE_RAIL_TYPES = 0xEFD;
+static const StringID STR_ERROR_CAN_T_MOVE_VEHICLE = 0xEFE;
+static const StringID STR_ERROR_REAR_ENGINE_FOLLOW_FRONT = 0xEFF;
+static const StringID STR_ERROR_UNABLE_TO_FIND_ROUTE_TO = 0xF00;
+static const StringID STR_ERROR_UNABLE_TO_FIND_LOCAL_DEPOT = 0xF01;
+static const StringID STR_ERROR_DEPOT_WRONG_DEPOT_TYPE = 0xF02;
+static const StringID STR_ERROR_TRAIN_TOO_LONG_AFTER_REPLACEMENT = 0xF03;
+static const StringID STR_ERROR_AUTOREPLACE_NOTHING_TO_DO = 0xF04;
+static const StringID STR_ERROR_AUTOREPLACE_MONEY_LIMIT = 0xF05;
+static const StringID STR_ERROR_AUTOREPLACE_INCOMPATIBLE_CARGO = 0xF06;
+static const StringID STR_ERROR_AUTOREPLACE_INCOMPATIBLE_REFIT = 0xF07;
+static const StringID STR_ERROR_IMPOSSIBLE_TRACK_COMBINATION = 0xF08;
+static const StringID STR_ERROR_MUST_REMOVE_SIGNALS_FIRST = 0xF09;
+static const StringID STR_ERROR_NO_SUITABLE_RAILROAD_TRACK = 0xF0A;
+static const StringID STR_ERROR_MUST_REMOVE_RAILROAD_TRACK = 0xF0B;
+static const StringID STR_ERROR_CROSSING_ON_ONEWAY_ROAD = 0xF0C;
+static const StringID STR_ERROR_CROSSING_DISALLOWED_RAIL = 0xF0D;
+static const StringID STR_ERROR_CROSSING_DISALLOWED_ROAD = 0xF0E;
+static const StringID STR_ERROR_CAN_T_BUILD_SIGNALS_HERE = 0xF0F;
+static const StringID STR_ERROR_CAN_T_BUILD_RAILROAD_TRACK = 0xF10;
+static const StringID STR_ERROR_CAN_T_REMOVE_RAILROAD_TRACK = 0xF11;
+static const StringID STR_ERROR_CAN_T_REMOVE_SIGNALS_FROM = 0xF12;
+static const StringID STR_ERROR_SIGNAL_CAN_T_CONVERT_SIGNALS_HERE = 0xF13;
+static const StringID STR_ERROR_THERE_IS_NO_RAILROAD_TRACK = 0xF14;
+static const StringID STR_ERROR_THERE_ARE_NO_SIGNALS = 0xF15;
+static const StringID STR_ERROR_CAN_T_CONVERT_RAIL = 0xF16;
+static const StringID STR_ERROR_MUST_REMOVE_ROAD_FIRST = 0xF17;
+static const StringID STR_ERROR_ONEWAY_ROADS_CAN_T_HAVE_JUNCTION = 0xF18;
+static const StringID STR_ERROR_CAN_T_BUILD_ROAD_HERE = 0xF19;
+static const StringID STR_ERROR_CAN_T_BUILD_TRAMWAY_HERE = 0xF1A;
+static const StringID STR_ERROR_CAN_T_REMOVE_ROAD_FROM = 0xF1B;
+static const StringID STR_ERROR_CAN_T_REMOVE_TRAMWAY_FROM = 0xF1C;
+static const StringID STR_ERROR_THERE_IS_NO_ROAD = 0xF1D;
+static const StringID STR_ERROR_THERE_IS_NO_TRAMWAY = 0xF1E;
+static const StringID STR_ERROR_CAN_T_CONVERT_ROAD = 0xF1F;
+static const StringID STR_ERROR_CAN_T_CONVERT_TRAMWAY = 0xF20;
+static const StringID STR_ERROR_NO_SUITABLE_ROAD = 0xF21;
+static const StringID STR_ERROR_NO_SUITABLE_TRAMWAY = 0xF22;
+static const StringID STR_ERROR_CAN_T_BUILD_CANALS = 0xF23;
+static const StringID STR_ERROR_CAN_T_BUILD_LOCKS = 0xF24;
+static const StringID STR_ERROR_CAN_T_PLACE_RIVERS = 0xF25;
+static const StringID STR_ERROR_MUST_BE_BUILT_ON_WATER = 0xF26;
+static const StringID STR_ERROR_CAN_T_BUILD_ON_WATER = 0xF27;
+static const StringID STR_ERROR_CAN_T_BUILD_ON_SEA = 0xF28;
+static const StringID STR_ERROR_CAN_T_BUILD_ON_CANAL = 0xF29;
+static const StringID STR_ERROR_CAN_T_BUILD_ON_RIVER = 0xF2A;
+static const StringID STR_ERROR_MUST_DEMOLISH_CANAL_FIRST = 0xF2B;
+static const StringID STR_ERROR_CAN_T_BUILD_AQUEDUCT_HERE = 0xF2C;
+static const StringID STR_ERROR_TREE_ALREADY_HERE = 0xF2D;
+static const StringID STR_ERROR_TREE_WRONG_TERRAIN_FOR_TREE_TYPE = 0xF2E;
+static const StringID STR_ERROR_CAN_T_PLANT_TREE_HERE = 0xF2F;
+static const StringID STR_ERROR_CAN_T_BUILD_BRIDGE_HERE = 0xF30;
+static const StringID STR_ERROR_MUST_DEMOLISH_BRIDGE_FIRST = 0xF31;
+static const StringID STR_ERROR_CAN_T_START_AND_END_ON = 0xF32;
+static const StringID STR_ERROR_BRIDGEHEADS_NOT_SAME_HEIGHT = 0xF33;
+static const StringID STR_ERROR_BRIDGE_TOO_LOW_FOR_TERRAIN = 0xF34;
+static const StringID STR_ERROR_BRIDGE_TOO_HIGH_FOR_TERRAIN = 0xF35;
+static const StringID STR_ERROR_START_AND_END_MUST_BE_IN = 0xF36;
+static const StringID STR_ERROR_ENDS_OF_BRIDGE_MUST_BOTH = 0xF37;
+static const StringID STR_ERROR_BRIDGE_TOO_LONG = 0xF38;
+static const StringID STR_ERROR_BRIDGE_THROUGH_MAP_BORDER = 0xF39;
+static const StringID STR_ERROR_CAN_T_BUILD_TUNNEL_HERE = 0xF3A;
+static const StringID STR_ERROR_SITE_UNSUITABLE_FOR_TUNNEL = 0xF3B;
+static const StringID STR_ERROR_MUST_DEMOLISH_TUNNEL_FIRST = 0xF3C;
+static const StringID STR_ERROR_ANOTHER_TUNNEL_IN_THE_WAY = 0xF3D;
+static const StringID STR_ERROR_TUNNEL_THROUGH_MAP_BORDER = 0xF3E;
+static const StringID STR_ERROR_UNABLE_TO_EXCAVATE_LAND = 0xF3F;
+static const StringID STR_ERROR_TUNNEL_TOO_LONG = 0xF40;
+static const StringID STR_ERROR_TOO_MANY_OBJECTS = 0xF41;
+static const StringID STR_ERROR_CAN_T_BUILD_OBJECT = 0xF42;
+static const StringID STR_ERROR_OBJECT_IN_THE_WAY = 0xF43;
+static const StringID STR_ERROR_COMPANY_HEADQUARTERS_IN = 0xF44;
+static const StringID STR_ERROR_CAN_T_PURCHASE_THIS_LAND = 0xF45;
+static const StringID STR_ERROR_YOU_ALREADY_OWN_IT = 0xF46;
+static const StringID STR_ERROR_BUILD_OBJECT_LIMIT_REACHED = 0xF47;
+static const StringID STR_ERROR_GROUP_CAN_T_CREATE = 0xF48;
+static const StringID STR_ERROR_GROUP_CAN_T_DELETE = 0xF49;
+static const StringID STR_ERROR_GROUP_CAN_T_RENAME = 0xF4A;
+static const StringID STR_ERROR_GROUP_CAN_T_SET_PARENT = 0xF4B;
+static const StringID STR_ERROR_GROUP_CAN_T_SET_PARENT_RECURSION = 0xF4C;
+static const StringID STR_ERROR_GROUP_CAN_T_REMOVE_ALL_VEHICLES = 0xF4D;
+static const StringID STR_ERROR_GROUP_CAN_T_ADD_VEHICLE = 0xF4E;
+static const StringID STR_ERROR_GROUP_CAN_T_ADD_SHARED_VEHICLE = 0xF4F;
+static const StringID STR_ERROR_TRAIN_IN_THE_WAY = 0xF50;
+static const StringID STR_ERROR_ROAD_VEHICLE_IN_THE_WAY = 0xF51;
+static const StringID STR_ERROR_SHIP_IN_THE_WAY = 0xF52;
+static const StringID STR_ERROR_AIRCRAFT_IN_THE_WAY = 0xF53;
+static const StringID STR_ERROR_RAIL_VEHICLE_NOT_AVAILABLE = 0xF54;
+static const StringID STR_ERROR_ROAD_VEHICLE_NOT_AVAILABLE = 0xF55;
+static const StringID STR_ERROR_SHIP_NOT_AVAILABLE = 0xF56;
+static const StringID STR_ERROR_AIRCRAFT_NOT_AVAILABLE = 0xF57;
+static const StringID STR_ERROR_CAN_T_REFIT_TRAIN = 0xF58;
+static const StringID STR_ERROR_CAN_T_REFIT_ROAD_VEHICLE = 0xF59;
+static const StringID STR_ERROR_CAN_T_REFIT_SHIP = 0xF5A;
+static const StringID STR_ERROR_CAN_T_REFIT_AIRCRAFT = 0xF5B;
+static const StringID STR_ERROR_CAN_T_RENAME_TRAIN = 0xF5C;
+static const StringID STR_ERROR_CAN_T_RENAME_ROAD_VEHICLE = 0xF5D;
+static const StringID STR_ERROR_CAN_T_RENAME_SHIP = 0xF5E;
+static const StringID STR_ERROR_CAN_T_RENAME_AIRCRAFT = 0xF5F;
+static const StringID STR_ERROR_CAN_T_STOP_START_TRAIN = 0xF60;
+static const StringID STR_ERROR_CAN_T_STOP_START_ROAD_VEHICLE = 0xF61;
+static const StringID STR_ERROR_CAN_T_STOP_START_SHIP = 0xF62;
+static const StringID STR_ERROR_CAN_T_STOP_START_AIRCRAFT = 0xF63;
+static const StringID STR_ERROR_CAN_T_SEND_TRAIN_TO_DEPOT = 0xF64;
+static const StringID STR_ERROR_CAN_T_SEND_ROAD_VEHICLE_TO_DEPOT = 0xF65;
+static const StringID STR_ERROR_CAN_T_SEND_SHIP_TO_DEPOT = 0xF66;
+static const StringID STR_ERROR_CAN_T_SEND_AIRCRAFT_TO_HANGAR = 0xF67;
+static const StringID STR_ERROR_CAN_T_BUY_TRAIN = 0xF68;
+static const StringID STR_ERROR_CAN_T_BUY_ROAD_VEHICLE = 0xF69;
+static const StringID STR_ERROR_CAN_T_BUY_SHIP = 0xF6A;
+static const StringID STR_ERROR_CAN_T_BUY_AIRCRAFT = 0xF6B;
+static const StringID STR_ERROR_CAN_T_RENAME_TRAIN_TYPE = 0xF6C;
+static const StringID STR_ERROR_CAN_T_RENAME_ROAD_VEHICLE_TYPE = 0xF6D;
+static const StringID STR_ERROR_CAN_T_RENAME_SHIP_TYPE = 0xF6E;
+static const StringID STR_ERROR_CAN_T_RENAME_AIRCRAFT_TYPE = 0xF6F;
+static const StringID STR_ERROR_CAN_T_SELL_TRAIN = 0xF70;
+static const StringID STR_ERROR_CAN_T_SELL_ROAD_VEHICLE = 0xF71;
+static const StringID STR_ERROR_CAN_T_SELL_SHIP = 0xF72;
+static const StringID STR_ERROR_CAN_T_SELL_AIRCRAFT = 0xF73;
+static const StringID STR_ERROR_TOO_MANY_VEHICLES_IN_GAME = 0xF74;
+static const StringID STR_ERROR_CAN_T_CHANGE_SERVICING = 0xF75;
+static const StringID STR_ERROR_VEHICLE_IS_DESTROYED = 0xF76;
+static const StringID STR_ERROR_CAN_T_CLONE_VEHICLE_LIST = 0xF77;
+static const StringID STR_ERROR_NO_VEHICLES_AVAILABLE_AT_ALL = 0xF78;
+static const StringID STR_ERROR_NO_VEHICLES_AVAILABLE_AT_ALL_EXPLANATION = 0xF79;
+static const StringID STR_ERROR_NO_VEHICLES_AVAILABLE_YET = 0xF7A;
+static const StringID STR_ERROR_NO_VEHICLES_AVAILABLE_YET_EXPLANATION = 0xF7B;
+static const StringID STR_ERROR_CAN_T_MAKE_TRAIN_PASS_SIGNAL = 0xF7C;
+static const StringID STR_ERROR_CAN_T_REVERSE_DIRECTION_TRAIN = 0xF7D;
+static const StringID STR_ERROR_TRAIN_START_NO_POWER = 0xF7E;
+static const StringID STR_ERROR_CAN_T_MAKE_ROAD_VEHICLE_TURN = 0xF7F;
+static const StringID STR_ERROR_AIRCRAFT_IS_IN_FLIGHT = 0xF80;
+static const StringID STR_ERROR_NO_MORE_SPACE_FOR_ORDERS = 0xF81;
+static const StringID STR_ERROR_TOO_MANY_ORDERS = 0xF82;
+static const StringID STR_ERROR_CAN_T_INSERT_NEW_ORDER = 0xF83;
+static const StringID STR_ERROR_CAN_T_DELETE_THIS_ORDER = 0xF84;
+static const StringID STR_ERROR_CAN_T_MODIFY_THIS_ORDER = 0xF85;
+static const StringID STR_ERROR_CAN_T_MOVE_THIS_ORDER = 0xF86;
+static const StringID STR_ERROR_CAN_T_SKIP_ORDER = 0xF87;
+static const StringID STR_ERROR_CAN_T_SKIP_TO_ORDER = 0xF88;
+static const StringID STR_ERROR_CAN_T_COPY_SHARE_ORDER = 0xF89;
+static const StringID STR_ERROR_CAN_T_ADD_ORDER = 0xF8A;
+static const StringID STR_ERROR_CAN_T_ADD_ORDER_SHARED = 0xF8B;
+static const StringID STR_ERROR_CAN_T_COPY_ORDER_VEHICLE_LIST = 0xF8C;
+static const StringID STR_ERROR_CAN_T_SHARE_ORDER_VEHICLE_LIST = 0xF8D;
+static const StringID STR_ERROR_CAN_T_SHARE_ORDER_LIST = 0xF8E;
+static const StringID STR_ERROR_CAN_T_STOP_SHARING_ORDER_LIST = 0xF8F;
+static const StringID STR_ERROR_CAN_T_COPY_ORDER_LIST = 0xF90;
+static const StringID STR_ERROR_TOO_FAR_FROM_PREVIOUS_DESTINATION = 0xF91;
+static const StringID STR_ERROR_AIRCRAFT_NOT_ENOUGH_RANGE = 0xF92;
+static const StringID STR_ERROR_NO_RAIL_STATION = 0xF93;
+static const StringID STR_ERROR_NO_BUS_STATION = 0xF94;
+static const StringID STR_ERROR_NO_TRUCK_STATION = 0xF95;
+static const StringID STR_ERROR_NO_DOCK = 0xF96;
+static const StringID STR_ERROR_NO_AIRPORT = 0xF97;
+static const StringID STR_ERROR_NO_STOP_COMPATIBLE_ROAD_TYPE = 0xF98;
+static const StringID STR_ERROR_NO_STOP_COMPATIBLE_TRAM_TYPE = 0xF99;
+static const StringID STR_ERROR_NO_STOP_ARTICULATED_VEHICLE = 0xF9A;
+static const StringID STR_ERROR_AIRPORT_NO_PLANES = 0xF9B;
+static const StringID STR_ERROR_AIRPORT_NO_HELICOPTERS = 0xF9C;
+static const StringID STR_ERROR_NO_RAIL_WAYPOINT = 0xF9D;
+static const StringID STR_ERROR_NO_BUOY = 0xF9E;
+static const StringID STR_ERROR_CAN_T_TIMETABLE_VEHICLE = 0xF9F;
+static const StringID STR_ERROR_TIMETABLE_ONLY_WAIT_AT_STATIONS = 0xFA0;
+static const StringID STR_ERROR_TIMETABLE_NOT_STOPPING_HERE = 0xFA1;
+static const StringID STR_ERROR_TOO_MANY_SIGNS = 0xFA2;
+static const StringID STR_ERROR_CAN_T_PLACE_SIGN_HERE = 0xFA3;
+static const StringID STR_ERROR_CAN_T_CHANGE_SIGN_NAME = 0xFA4;
+static const StringID STR_ERROR_CAN_T_DELETE_SIGN = 0xFA5;
+static const StringID STR_DESKTOP_SHORTCUT_COMMENT = 0xFA6;
+static const StringID STR_BASEGRAPHICS_DOS_DESCRIPTION = 0xFA7;
+static const StringID STR_BASEGRAPHICS_DOS_DE_DESCRIPTION = 0xFA8;
+static const StringID STR_BASEGRAPHICS_WIN_DESCRIPTION = 0xFA9;
+static const StringID STR_BASESOUNDS_DOS_DESCRIPTION = 0xFAA;
+static const StringID STR_BASESOUNDS_WIN_DESCRIPTION = 0xFAB;
+static const StringID STR_BASESOUNDS_NONE_DESCRIPTION = 0xFAC;
+static const StringID STR_BASEMUSIC_WIN_DESCRIPTION = 0xFAD;
+static const StringID STR_BASEMUSIC_DOS_DESCRIPTION = 0xFAE;
+static const StringID STR_BASEMUSIC_TTO_DESCRIPTION = 0xFAF;
+static const StringID STR_BASEMUSIC_NONE_DESCRIPTION = 0xFB0;
+
+static const StringID STR_TOWN_BUILDING_NAME_TALL_OFFICE_BLOCK_1 = 0x2000;
+static const StringID STR_TOWN_BUILDING_NAME_OFFICE_BLOCK_1 = 0x2001;
+static const StringID STR_TOWN_BUILDING_NAME_SMALL_BLOCK_OF_FLATS_1 = 0x2002;
+static const StringID STR_TOWN_BUILDING_NAME_CHURCH_1 = 0x2003;
+static const StringID STR_TOWN_BUILDING_NAME_LARGE_OFFICE_BLOCK_1 = 0x2004;
+static const StringID STR_TOWN_BUILDING_NAME_TOWN_HOUSES_1 = 0x2005;
+static const StringID STR_TOWN_BUILDING_NAME_HOTEL_1 = 0x2006;
+static const StringID STR_TOWN_BUILDING_NAME_STATUE_1 = 0x2007;
+static const StringID STR_TOWN_BUILDING_NAME_FOUNTAIN_1 = 0x2008;
+static const StringID STR_TOWN_BUILDING_NAME_PARK_1 = 0x2009;
+static const StringID STR_TOWN_BUILDING_NAME_OFFICE_BLOCK_2 = 0x200A;
+static const StringID STR_TOWN_BUILDING_NAME_SHOPS_AND_OFFICES_1 = 0x200B;
+static const StringID STR_TOWN_BUILDING_NAME_MODERN_OFFICE_BUILDING_1 = 0x200C;
+static const StringID STR_TOWN_BUILDING_NAME_WAREHOUSE_1 = 0x200D;
+static const StringID STR_TOWN_BUILDING_NAME_OFFICE_BLOCK_3 = 0x200E;
+static const StringID STR_TOWN_BUILDING_NAME_STADIUM_1 = 0x200F;
+static const StringID STR_TOWN_BUILDING_NAME_OLD_HOUSES_1 = 0x2010;
+static const StringID STR_TOWN_BUILDING_NAME_COTTAGES_1 = 0x2011;
+static const StringID STR_TOWN_BUILDING_NAME_HOUSES_1 = 0x2012;
+static const StringID STR_TOWN_BUILDING_NAME_FLATS_1 = 0x2013;
+static const StringID STR_TOWN_BUILDING_NAME_TALL_OFFICE_BLOCK_2 = 0x2014;
+static const StringID STR_TOWN_BUILDING_NAME_SHOPS_AND_OFFICES_2 = 0x2015;
+static const StringID STR_TOWN_BUILDING_NAME_SHOPS_AND_OFFICES_3 = 0x2016;
+static const StringID STR_TOWN_BUILDING_NAME_THEATER_1 = 0x2017;
+static const StringID STR_TOWN_BUILDING_NAME_STADIUM_2 = 0x2018;
+static const StringID STR_TOWN_BUILDING_NAME_OFFICES_1 = 0x2019;
+static const StringID STR_TOWN_BUILDING_NAME_HOUSES_2 = 0x201A;
+static const StringID STR_TOWN_BUILDING_NAME_CINEMA_1 = 0x201B;
+static const StringID STR_TOWN_BUILDING_NAME_SHOPPING_MALL_1 = 0x201C;
+static const StringID STR_TOWN_BUILDING_NAME_IGLOO_1 = 0x201D;
+static const StringID STR_TOWN_BUILDING_NAME_TEPEES_1 = 0x201E;
+static const StringID STR_TOWN_BUILDING_NAME_TEAPOT_HOUSE_1 = 0x201F;
+static const StringID STR_TOWN_BUILDING_NAME_PIGGY_BANK_1 = 0x2020;
+
+static const StringID STR_INDUSTRY_NAME_COAL_MINE = 0x4800;
+static const StringID STR_INDUSTRY_NAME_POWER_STATION = 0x4801;
+static const StringID STR_INDUSTRY_NAME_SAWMILL = 0x4802;
+static const StringID STR_INDUSTRY_NAME_FOREST = 0x4803;
+static const StringID STR_INDUSTRY_NAME_OIL_REFINERY = 0x4804;
+static const StringID STR_INDUSTRY_NAME_OIL_RIG = 0x4805;
+static const StringID STR_INDUSTRY_NAME_FACTORY = 0x4806;
+static const StringID STR_INDUSTRY_NAME_PRINTING_WORKS = 0x4807;
+static const StringID STR_INDUSTRY_NAME_STEEL_MILL = 0x4808;
+static const StringID STR_INDUSTRY_NAME_FARM = 0x4809;
+static const StringID STR_INDUSTRY_NAME_COPPER_ORE_MINE = 0x480A;
+static const StringID STR_INDUSTRY_NAME_OIL_WELLS = 0x480B;
+static const StringID STR_INDUSTRY_NAME_BANK = 0x480C;
+static const StringID STR_INDUSTRY_NAME_FOOD_PROCESSING_PLANT = 0x480D;
+static const StringID STR_INDUSTRY_NAME_PAPER_MILL = 0x480E;
+static const StringID STR_INDUSTRY_NAME_GOLD_MINE = 0x480F;
+static const StringID STR_INDUSTRY_NAME_BANK_TROPIC_ARCTIC = 0x4810;
+static const StringID STR_INDUSTRY_NAME_DIAMOND_MINE = 0x4811;
+static const StringID STR_INDUSTRY_NAME_IRON_ORE_MINE = 0x4812;
+static const StringID STR_INDUSTRY_NAME_FRUIT_PLANTATION = 0x4813;
+static const StringID STR_INDUSTRY_NAME_RUBBER_PLANTATION = 0x4814;
+static const StringID STR_INDUSTRY_NAME_WATER_SUPPLY = 0x4815;
+static const StringID STR_INDUSTRY_NAME_WATER_TOWER = 0x4816;
+static const StringID STR_INDUSTRY_NAME_FACTORY_2 = 0x4817;
+static const StringID STR_INDUSTRY_NAME_FARM_2 = 0x4818;
+static const StringID STR_INDUSTRY_NAME_LUMBER_MILL = 0x4819;
+static const StringID STR_INDUSTRY_NAME_COTTON_CANDY_FOREST = 0x481A;
+static const StringID STR_INDUSTRY_NAME_CANDY_FACTORY = 0x481B;
+static const StringID STR_INDUSTRY_NAME_BATTERY_FARM = 0x481C;
+static const StringID STR_INDUSTRY_NAME_COLA_WELLS = 0x481D;
+static const StringID STR_INDUSTRY_NAME_TOY_SHOP = 0x481E;
+static const StringID STR_INDUSTRY_NAME_TOY_FACTORY = 0x481F;
+static const StringID STR_INDUSTRY_NAME_PLASTIC_FOUNTAINS = 0x4820;
+static const StringID STR_INDUSTRY_NAME_FIZZY_DRINK_FACTORY = 0x4821;
+static const StringID STR_INDUSTRY_NAME_BUBBLE_GENERATOR = 0x4822;
+static const StringID STR_INDUSTRY_NAME_TOFFEE_QUARRY = 0x4823;
+static const StringID STR_INDUSTRY_NAME_SUGAR_MINE = 0x4824;
+
+static const StringID STR_SV_EMPTY = 0x6000;
+static const StringID STR_SV_UNNAMED = 0x6001;
+static const StringID STR_SV_TRAIN_NAME = 0x6002;
+static const StringID STR_SV_ROAD_VEHICLE_NAME = 0x6003;
+static const StringID STR_SV_SHIP_NAME = 0x6004;
+static const StringID STR_SV_AIRCRAFT_NAME = 0x6005;
+static const StringID STR_SV_STNAME = 0x6006;
+static const StringID STR_SV_STNAME_NORTH = 0x6007;
+static const StringID STR_SV_STNAME_SOUTH = 0x6008;
+static const StringID STR_SV_STNAME_EAST = 0x6009;
+static const StringID STR_SV_STNAME_WEST = 0x600A;
+static const StringID STR_SV_STNAME_CENTRAL = 0x600B;
+static const StringID STR_SV_STNAME_TRANSFER = 0x600C;
+static const StringID STR_SV_STNAME_HALT = 0x600D;
+static const StringID STR_SV_STNAME_VALLEY = 0x600E;
+static const StringID STR_SV_STNAME_HEIGHTS = 0x600F;
+static const StringID STR_SV_STNAME_WOODS = 0x6010;
+static const StringID STR_SV_STNAME_LAKESIDE = 0x6011;
+static const StringID STR_SV_STNAME_EXCHANGE = 0x6012;
+static const StringID STR_SV_STNAME_AIRPORT = 0x6013;
+static const StringID STR_SV_STNAME_OILFIELD = 0x6014;
+static const StringID STR_SV_STNAME_MINES = 0x6015;
+static const StringID STR_SV_STNAME_DOCKS = 0x6016;
+static const StringID STR_SV_STNAME_BUOY = 0x6017;
+static const StringID STR_SV_STNAME_WAYPOINT = 0x6018;
+
+static const StringID STR_SV_STNAME_ANNEXE = 0x6020;
+static const StringID STR_SV_STNAME_SIDINGS = 0x6021;
+static const StringID STR_SV_STNAME_BRANCH = 0x6022;
+static const StringID STR_SV_STNAME_UPPER = 0x6023;
+static const StringID STR_SV_STNAME_LOWER = 0x6024;
+static const StringID STR_SV_STNAME_HELIPORT = 0x6025;
+static const StringID STR_SV_STNAME_FOREST = 0x6026;
+static const StringID STR_SV_STNAME_FALLBACK = 0x6027;
+
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_KIRBY_PAUL_TANK_STEAM = 0x8000;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_MJS_250_DIESEL = 0x8001;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_PLODDYPHUT_CHOO_CHOO = 0x8002;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_POWERNAUT_CHOO_CHOO = 0x8003;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_MIGHTYMOVER_CHOO_CHOO = 0x8004;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_PLODDYPHUT_DIESEL = 0x8005;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_POWERNAUT_DIESEL = 0x8006;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_WILLS_2_8_0_STEAM = 0x8007;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_CHANEY_JUBILEE_STEAM = 0x8008;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_GINZU_A4_STEAM = 0x8009;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_SH_8P_STEAM = 0x800A;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_MANLEY_MOREL_DMU_DIESEL = 0x800B;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_DASH_DIESEL = 0x800C;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_SH_HENDRY_25_DIESEL = 0x800D;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_UU_37_DIESEL = 0x800E;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_FLOSS_47_DIESEL = 0x800F;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_CS_4000_DIESEL = 0x8010;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_CS_2400_DIESEL = 0x8011;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_CENTENNIAL_DIESEL = 0x8012;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_KELLING_3100_DIESEL = 0x8013;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_TURNER_TURBO_DIESEL = 0x8014;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_MJS_1000_DIESEL = 0x8015;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_SH_125_DIESEL = 0x8016;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_SH_30_ELECTRIC = 0x8017;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_SH_40_ELECTRIC = 0x8018;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_T_I_M_ELECTRIC = 0x8019;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_RAIL_ASIASTAR_ELECTRIC = 0x801A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_PASSENGER_CAR = 0x801B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_MAIL_VAN = 0x801C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_COAL_CAR = 0x801D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_OIL_TANKER = 0x801E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_LIVESTOCK_VAN = 0x801F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_GOODS_VAN = 0x8020;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_GRAIN_HOPPER = 0x8021;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_WOOD_TRUCK = 0x8022;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_IRON_ORE_HOPPER = 0x8023;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_STEEL_TRUCK = 0x8024;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_ARMORED_VAN = 0x8025;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_FOOD_VAN = 0x8026;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_PAPER_TRUCK = 0x8027;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_COPPER_ORE_HOPPER = 0x8028;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_WATER_TANKER = 0x8029;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_FRUIT_TRUCK = 0x802A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_RUBBER_TRUCK = 0x802B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_SUGAR_TRUCK = 0x802C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_COTTON_CANDY_HOPPER = 0x802D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_TOFFEE_HOPPER = 0x802E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_BUBBLE_VAN = 0x802F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_COLA_TANKER = 0x8030;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_CANDY_VAN = 0x8031;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_TOY_VAN = 0x8032;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_BATTERY_TRUCK = 0x8033;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_FIZZY_DRINK_TRUCK = 0x8034;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_RAIL_PLASTIC_TRUCK = 0x8035;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MONORAIL_X2001_ELECTRIC = 0x8036;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MONORAIL_MILLENNIUM_Z1_ELECTRIC = 0x8037;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MONORAIL_WIZZOWOW_Z99 = 0x8038;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_PASSENGER_CAR = 0x8039;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_MAIL_VAN = 0x803A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_COAL_CAR = 0x803B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_OIL_TANKER = 0x803C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_LIVESTOCK_VAN = 0x803D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_GOODS_VAN = 0x803E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_GRAIN_HOPPER = 0x803F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_WOOD_TRUCK = 0x8040;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_IRON_ORE_HOPPER = 0x8041;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_STEEL_TRUCK = 0x8042;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_ARMORED_VAN = 0x8043;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_FOOD_VAN = 0x8044;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_PAPER_TRUCK = 0x8045;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_COPPER_ORE_HOPPER = 0x8046;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_WATER_TANKER = 0x8047;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_FRUIT_TRUCK = 0x8048;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_RUBBER_TRUCK = 0x8049;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_SUGAR_TRUCK = 0x804A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_COTTON_CANDY_HOPPER = 0x804B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_TOFFEE_HOPPER = 0x804C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_BUBBLE_VAN = 0x804D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_COLA_TANKER = 0x804E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_CANDY_VAN = 0x804F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_TOY_VAN = 0x8050;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_BATTERY_TRUCK = 0x8051;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_FIZZY_DRINK_TRUCK = 0x8052;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MONORAIL_PLASTIC_TRUCK = 0x8053;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MAGLEV_LEV1_LEVIATHAN_ELECTRIC = 0x8054;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MAGLEV_LEV2_CYCLOPS_ELECTRIC = 0x8055;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MAGLEV_LEV3_PEGASUS_ELECTRIC = 0x8056;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MAGLEV_LEV4_CHIMAERA_ELECTRIC = 0x8057;
+static const StringID STR_VEHICLE_NAME_TRAIN_ENGINE_MAGLEV_WIZZOWOW_ROCKETEER = 0x8058;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_PASSENGER_CAR = 0x8059;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_MAIL_VAN = 0x805A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_COAL_CAR = 0x805B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_OIL_TANKER = 0x805C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_LIVESTOCK_VAN = 0x805D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_GOODS_VAN = 0x805E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_GRAIN_HOPPER = 0x805F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_WOOD_TRUCK = 0x8060;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_IRON_ORE_HOPPER = 0x8061;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_STEEL_TRUCK = 0x8062;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_ARMORED_VAN = 0x8063;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_FOOD_VAN = 0x8064;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_PAPER_TRUCK = 0x8065;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_COPPER_ORE_HOPPER = 0x8066;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_WATER_TANKER = 0x8067;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_FRUIT_TRUCK = 0x8068;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_RUBBER_TRUCK = 0x8069;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_SUGAR_TRUCK = 0x806A;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_COTTON_CANDY_HOPPER = 0x806B;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_TOFFEE_HOPPER = 0x806C;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_BUBBLE_VAN = 0x806D;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_COLA_TANKER = 0x806E;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_CANDY_VAN = 0x806F;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_TOY_VAN = 0x8070;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_BATTERY_TRUCK = 0x8071;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_FIZZY_DRINK_TRUCK = 0x8072;
+static const StringID STR_VEHICLE_NAME_TRAIN_WAGON_MAGLEV_PLASTIC_TRUCK = 0x8073;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_REGAL_BUS = 0x8074;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_HEREFORD_LEOPARD_BUS = 0x8075;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_BUS = 0x8076;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_MKII_SUPERBUS = 0x8077;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PLODDYPHUT_MKI_BUS = 0x8078;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PLODDYPHUT_MKII_BUS = 0x8079;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PLODDYPHUT_MKIII_BUS = 0x807A;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_COAL_TRUCK = 0x807B;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_COAL_TRUCK = 0x807C;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_DW_COAL_TRUCK = 0x807D;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_MAIL_TRUCK = 0x807E;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_REYNARD_MAIL_TRUCK = 0x807F;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PERRY_MAIL_TRUCK = 0x8080;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_MAIL_TRUCK = 0x8081;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_MAIL_TRUCK = 0x8082;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_MAIL_TRUCK = 0x8083;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WITCOMBE_OIL_TANKER = 0x8084;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_OIL_TANKER = 0x8085;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PERRY_OIL_TANKER = 0x8086;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_TALBOTT_LIVESTOCK_VAN = 0x8087;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_LIVESTOCK_VAN = 0x8088;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_LIVESTOCK_VAN = 0x8089;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_GOODS_TRUCK = 0x808A;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_CRAIGHEAD_GOODS_TRUCK = 0x808B;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_GOSS_GOODS_TRUCK = 0x808C;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_HEREFORD_GRAIN_TRUCK = 0x808D;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_THOMAS_GRAIN_TRUCK = 0x808E;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_GOSS_GRAIN_TRUCK = 0x808F;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WITCOMBE_WOOD_TRUCK = 0x8090;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_WOOD_TRUCK = 0x8091;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MORELAND_WOOD_TRUCK = 0x8092;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_IRON_ORE_TRUCK = 0x8093;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_IRON_ORE_TRUCK = 0x8094;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_CHIPPY_IRON_ORE_TRUCK = 0x8095;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_STEEL_TRUCK = 0x8096;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_STEEL_TRUCK = 0x8097;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_KELLING_STEEL_TRUCK = 0x8098;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_ARMORED_TRUCK = 0x8099;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_ARMORED_TRUCK = 0x809A;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_ARMORED_TRUCK = 0x809B;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_FOSTER_FOOD_VAN = 0x809C;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_PERRY_FOOD_VAN = 0x809D;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_CHIPPY_FOOD_VAN = 0x809E;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_PAPER_TRUCK = 0x809F;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_PAPER_TRUCK = 0x80A0;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_PAPER_TRUCK = 0x80A1;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_COPPER_ORE_TRUCK = 0x80A2;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_COPPER_ORE_TRUCK = 0x80A3;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_GOSS_COPPER_ORE_TRUCK = 0x80A4;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_WATER_TANKER = 0x80A5;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_WATER_TANKER = 0x80A6;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MPS_WATER_TANKER = 0x80A7;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_FRUIT_TRUCK = 0x80A8;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_FRUIT_TRUCK = 0x80A9;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_KELLING_FRUIT_TRUCK = 0x80AA;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_BALOGH_RUBBER_TRUCK = 0x80AB;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_UHL_RUBBER_TRUCK = 0x80AC;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_RMT_RUBBER_TRUCK = 0x80AD;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_SUGAR_TRUCK = 0x80AE;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_SUGAR_TRUCK = 0x80AF;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_SUGAR_TRUCK = 0x80B0;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_COLA_TRUCK = 0x80B1;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_COLA_TRUCK = 0x80B2;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_COLA_TRUCK = 0x80B3;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_COTTON_CANDY = 0x80B4;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_COTTON_CANDY = 0x80B5;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_COTTON_CANDY_TRUCK = 0x80B6;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_TOFFEE_TRUCK = 0x80B7;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_TOFFEE_TRUCK = 0x80B8;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_TOFFEE_TRUCK = 0x80B9;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_TOY_VAN = 0x80BA;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_TOY_VAN = 0x80BB;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_TOY_VAN = 0x80BC;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_CANDY_TRUCK = 0x80BD;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_CANDY_TRUCK = 0x80BE;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_CANDY_TRUCK = 0x80BF;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_BATTERY_TRUCK = 0x80C0;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_BATTERY_TRUCK = 0x80C1;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_BATTERY_TRUCK = 0x80C2;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_FIZZY_DRINK = 0x80C3;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_FIZZY_DRINK = 0x80C4;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_FIZZY_DRINK_TRUCK = 0x80C5;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_PLASTIC_TRUCK = 0x80C6;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_PLASTIC_TRUCK = 0x80C7;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_PLASTIC_TRUCK = 0x80C8;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_MIGHTYMOVER_BUBBLE_TRUCK = 0x80C9;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_POWERNAUGHT_BUBBLE_TRUCK = 0x80CA;
+static const StringID STR_VEHICLE_NAME_ROAD_VEHICLE_WIZZOWOW_BUBBLE_TRUCK = 0x80CB;
+static const StringID STR_VEHICLE_NAME_SHIP_MPS_OIL_TANKER = 0x80CC;
+static const StringID STR_VEHICLE_NAME_SHIP_CS_INC_OIL_TANKER = 0x80CD;
+static const StringID STR_VEHICLE_NAME_SHIP_MPS_PASSENGER_FERRY = 0x80CE;
+static const StringID STR_VEHICLE_NAME_SHIP_FFP_PASSENGER_FERRY = 0x80CF;
+static const StringID STR_VEHICLE_NAME_SHIP_BAKEWELL_300_HOVERCRAFT = 0x80D0;
+static const StringID STR_VEHICLE_NAME_SHIP_CHUGGER_CHUG_PASSENGER = 0x80D1;
+static const StringID STR_VEHICLE_NAME_SHIP_SHIVERSHAKE_PASSENGER_FERRY = 0x80D2;
+static const StringID STR_VEHICLE_NAME_SHIP_YATE_CARGO_SHIP = 0x80D3;
+static const StringID STR_VEHICLE_NAME_SHIP_BAKEWELL_CARGO_SHIP = 0x80D4;
+static const StringID STR_VEHICLE_NAME_SHIP_MIGHTYMOVER_CARGO_SHIP = 0x80D5;
+static const StringID STR_VEHICLE_NAME_SHIP_POWERNAUT_CARGO_SHIP = 0x80D6;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_SAMPSON_U52 = 0x80D7;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_COLEMAN_COUNT = 0x80D8;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_FFP_DART = 0x80D9;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_YATE_HAUGAN = 0x80DA;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_COTSWALD_LB_3 = 0x80DB;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_LUCKETT_LB_8 = 0x80DC;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_LUCKETT_LB_9 = 0x80DD;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_LUCKETT_LB80 = 0x80DE;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_LUCKETT_LB_10 = 0x80DF;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_BAKEWELL_LUCKETT_LB_11 = 0x80E0;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_YATE_AEROSPACE_YAC_1_11 = 0x80E1;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_100 = 0x80E2;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_200 = 0x80E3;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_300 = 0x80E4;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_400 = 0x80E5;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_500 = 0x80E6;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_600 = 0x80E7;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_GURU_GALAXY = 0x80E8;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_AIRTAXI_A21 = 0x80E9;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_AIRTAXI_A31 = 0x80EA;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_AIRTAXI_A32 = 0x80EB;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_AIRTAXI_A33 = 0x80EC;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_YATE_AEROSPACE_YAE46 = 0x80ED;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DINGER_100 = 0x80EE;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_AIRTAXI_A34_1000 = 0x80EF;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_YATE_Z_SHUTTLE = 0x80F0;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_KELLING_K1 = 0x80F1;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_KELLING_K6 = 0x80F2;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_KELLING_K7 = 0x80F3;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DARWIN_700 = 0x80F4;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_FFP_HYPERDART_2 = 0x80F5;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DINGER_200 = 0x80F6;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_DINGER_1000 = 0x80F7;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_PLODDYPHUT_100 = 0x80F8;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_PLODDYPHUT_500 = 0x80F9;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_FLASHBANG_X1 = 0x80FA;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_JUGGERPLANE_M1 = 0x80FB;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_FLASHBANG_WIZZER = 0x80FC;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_TRICARIO_HELICOPTER = 0x80FD;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_GURU_X2_HELICOPTER = 0x80FE;
+static const StringID STR_VEHICLE_NAME_AIRCRAFT_POWERNAUT_HELICOPTER = 0x80FF;
+
+static const StringID STR_FORMAT_DATE_TINY = 0x8800;
+static const StringID STR_FORMAT_DATE_SHORT = 0x8801;
+static const StringID STR_FORMAT_DATE_LONG = 0x8802;
+static const StringID STR_FORMAT_DATE_ISO = 0x8803;
+static const StringID STR_FORMAT_COMPANY_NUM = 0x8804;
+static const StringID STR_FORMAT_GROUP_NAME = 0x8805;
+static const StringID STR_FORMAT_GROUP_VEHICLE_NAME = 0x8806;
+static const StringID STR_FORMAT_INDUSTRY_NAME = 0x8807;
+static const StringID STR_FORMAT_BUOY_NAME = 0x8808;
+static const StringID STR_FORMAT_BUOY_NAME_SERIAL = 0x8809;
+static const StringID STR_FORMAT_WAYPOINT_NAME = 0x880A;
+static const StringID STR_FORMAT_WAYPOINT_NAME_SERIAL = 0x880B;
+static const StringID STR_FORMAT_DEPOT_NAME_TRAIN = 0x880C;
+static const StringID STR_FORMAT_DEPOT_NAME_TRAIN_SERIAL = 0x880D;
+static const StringID STR_FORMAT_DEPOT_NAME_ROAD_VEHICLE = 0x880E;
+static const StringID STR_FORMAT_DEPOT_NAME_ROAD_VEHICLE_SERIAL = 0x880F;
+static const StringID STR_FORMAT_DEPOT_NAME_SHIP = 0x8810;
+static const StringID STR_FORMAT_DEPOT_NAME_SHIP_SERIAL = 0x8811;
+static const StringID STR_FORMAT_DEPOT_NAME_AIRCRAFT = 0x8812;
+static const StringID STR_UNKNOWN_STATION = 0x8813;
+static const StringID STR_DEFAULT_SIGN_NAME = 0x8814;
+static const StringID STR_COMPANY_SOMEONE = 0x8815;
+static const StringID STR_SAVEGAME_NAME_DEFAULT = 0x8816;
+static const StringID STR_SAVEGAME_NAME_SPECTATOR = 0x8817;
+static const StringID STR_VIEWPORT_TOWN_POP_VERY_POOR_RATING = 0x8818;
+static const StringID STR_VIEWPORT_TOWN_POP_MEDIOCRE_RATING = 0x8819;
+static const StringID STR_VIEWPORT_TOWN_POP_GOOD_RATING = 0x881A;
+static const StringID STR_VIEWPORT_TOWN_POP = 0x881B;
+static const StringID STR_VIEWPORT_TOWN_POP_EXCELLENT_RATING = 0x881C;
+static const StringID STR_VIEWPORT_TOWN_VERY_POOR_RATING = 0x881D;
+static const StringID STR_VIEWPORT_TOWN_MEDIOCRE_RATING = 0x881E;
+static const StringID STR_VIEWPORT_TOWN_GOOD_RATING = 0x881F;
+static const StringID STR_VIEWPORT_TOWN = 0x8820;
+static const StringID STR_VIEWPORT_TOWN_EXCELLENT_RATING = 0x8821;
+static const StringID STR_VIEWPORT_TOWN_TINY_BLACK = 0x8822;
+static const StringID STR_VIEWPORT_TOWN_TINY_VERY_POOR_RATING = 0x8823;
+static const StringID STR_VIEWPORT_TOWN_TINY_MEDIOCRE_RATING = 0x8824;
+static const StringID STR_VIEWPORT_TOWN_TINY_GOOD_RATING = 0x8825;
+static const StringID STR_VIEWPORT_TOWN_TINY_WHITE = 0x8826;
+static const StringID STR_VIEWPORT_TOWN_TINY_EXCELLENT_RATING = 0x8827;
+static const StringID STR_VIEWPORT_SIGN_SMALL_BLACK = 0x8828;
+static const StringID STR_VIEWPORT_SIGN_SMALL_WHITE = 0x8829;
+static const StringID STR_VIEWPORT_STATION = 0x882A;
+static const StringID STR_VIEWPORT_STATION_TINY = 0x882B;
+static const StringID STR_VIEWPORT_WAYPOINT = 0x882C;
+static const StringID STR_VIEWPORT_WAYPOINT_TINY = 0x882D;
+static const StringID STR_COMPANY_NAME = 0x882E;
+static const StringID STR_COMPANY_NAME_COMPANY_NUM = 0x882F;
+static const StringID STR_DEPOT_NAME = 0x8830;
+static const StringID STR_ENGINE_NAME = 0x8831;
+static const StringID STR_HIDDEN_ENGINE_NAME = 0x8832;
+static const StringID STR_GROUP_NAME = 0x8833;
+static const StringID STR_INDUSTRY_NAME = 0x8834;
+static const StringID STR_PRESIDENT_NAME = 0x8835;
+static const StringID STR_SIGN_NAME = 0x8836;
+static const StringID STR_STATION_NAME = 0x8837;
+static const StringID STR_TOWN_NAME = 0x8838;
+static const StringID STR_VEHICLE_NAME = 0x8839;
+static const StringID STR_WAYPOINT_NAME = 0x883A;
+static const StringID STR_JUST_CARGO = 0x883B;
+static const StringID STR_JUST_CHECKMARK = 0x883C;
+static const StringID STR_JUST_COMMA = 0x883D;
+static const StringID STR_JUST_CURRENCY_SHORT = 0x883E;
+static const StringID STR_JUST_CURRENCY_LONG = 0x883F;
+static const StringID STR_JUST_CARGO_LIST = 0x8840;
+static const StringID STR_JUST_INT = 0x8841;
+static const StringID STR_JUST_DATE_TINY = 0x8842;
+static const StringID STR_JUST_DATE_SHORT = 0x8843;
+static const StringID STR_JUST_DATE_LONG = 0x8844;
+static const StringID STR_JUST_DATE_ISO = 0x8845;
+static const StringID STR_JUST_STRING = 0x8846;
+static const StringID STR_JUST_STRING_STRING = 0x8847;
+static const StringID STR_JUST_RAW_STRING = 0x8848;
+static const StringID STR_JUST_BIG_RAW_STRING = 0x8849;
+static const StringID STR_BLACK_COMMA = 0x884A;
+static const StringID STR_TINY_BLACK_COMA = 0x884B;
+static const StringID STR_TINY_COMMA = 0x884C;
+static const StringID STR_BLUE_COMMA = 0x884D;
+static const StringID STR_RED_COMMA = 0x884E;
+static const StringID STR_WHITE_COMMA = 0x884F;
+static const StringID STR_TINY_BLACK_DECIMAL = 0x8850;
+static const StringID STR_COMPANY_MONEY = 0x8851;
+static const StringID STR_BLACK_DATE_LONG = 0x8852;
+static const StringID STR_WHITE_DATE_LONG = 0x8853;
+static const StringID STR_SHORT_DATE = 0x8854;
+static const StringID STR_DATE_LONG_SMALL = 0x8855;
+static const StringID STR_TINY_GROUP = 0x8856;
+static const StringID STR_BLACK_INT = 0x8857;
+static const StringID STR_ORANGE_INT = 0x8858;
+static const StringID STR_WHITE_SIGN = 0x8859;
+static const StringID STR_TINY_BLACK_STATION = 0x885A;
+static const StringID STR_BLACK_STRING = 0x885B;
+static const StringID STR_BLACK_RAW_STRING = 0x885C;
+static const StringID STR_ORANGE_STRING = 0x885D;
+static const StringID STR_LTBLUE_STRING = 0x885E;
+static const StringID STR_WHITE_STRING = 0x885F;
+static const StringID STR_ORANGE_STRING1_WHITE = 0x8860;
+static const StringID STR_ORANGE_STRING1_LTBLUE = 0x8861;
+static const StringID STR_TINY_BLACK_HEIGHT = 0x8862;
+static const StringID STR_TINY_BLACK_VEHICLE = 0x8863;
+static const StringID STR_TINY_RIGHT_ARROW = 0x8864;
+static const StringID STR_BLACK_1 = 0x8865;
+static const StringID STR_BLACK_2 = 0x8866;
+static const StringID STR_BLACK_3 = 0x8867;
+static const StringID STR_BLACK_4 = 0x8868;
+static const StringID STR_BLACK_5 = 0x8869;
+static const StringID STR_BLACK_6 = 0x886A;
+static const StringID STR_BLACK_7 = 0x886B;
+static const StringID STR_TRAIN = 0x886C;
+static const StringID STR_BUS = 0x886D;
+static const StringID STR_LORRY = 0x886E;
+static const StringID STR_PLANE = 0x886F;
+static const StringID STR_SHIP = 0x8870;
+static const StringID STR_TOOLBAR_RAILTYPE_VELOCITY = 0x8871;
+static const StringID STR_UNIT_NAME_VELOCITY_IMPERIAL = 0x8872;
+static const StringID STR_UNIT_NAME_VELOCITY_METRIC = 0x8873;
+static const StringID STR_UNIT_NAME_VELOCITY_SI = 0x8874;
+static const StringID STR_UNIT_NAME_VELOCITY_GAMEUNITS = 0x8875;
+static const StringID STR_BUTTON_RENAME = 0x8876;
+static const StringID STR_MEASURE_DIST_HEIGHTDIFF = 0x8877;
+static const StringID STR_SORT_BY_PROFIT_LIFETIME = 0x8878;
+static const StringID STR_SORT_BY_AVG_ORDER_OCCUPANCY = 0x8879;
+static const StringID STR_SORT_BY_MAX_SPEED_LOADED = 0x887A;
+static const StringID STR_SORT_BY_VEHICLES_CALLING = 0x887B;
+static const StringID STR_SORT_BY_CARGO_CAPACITY_VS_RUNNING_COST = 0x887C;
+static const StringID STR_SORT_BY_VEHICLE_COUNT = 0x887D;
+static const StringID STR_SCENEDIT_TOOLBAR_PLACE_HOUSE = 0x887E;
+static const StringID STR_SETTINGS_MENU_ZONING = 0x887F;
+static const StringID STR_SETTINGS_MENU_MONEY_TEXT_EFFECTS = 0x8880;
+static const StringID STR_SETTINGS_MENU_SHOW_HIDDEN_SIGNS = 0x8881;
+static const StringID STR_MAP_MENU_PLAN_LIST = 0x8882;
+static const StringID STR_VEHICLE_TYPE_TRAINS = 0x8883;
+static const StringID STR_VEHICLE_TYPE_ROAD_VEHICLES = 0x8884;
+static const StringID STR_VEHICLE_TYPE_SHIPS = 0x8885;
+static const StringID STR_VEHICLE_TYPE_AIRCRAFT = 0x8886;
+static const StringID STR_GRAPH_CARGO_PAYMENT_RATES_X_LABEL_SPEED = 0x8887;
+static const StringID STR_GRAPH_CARGO_PAYMENT_RATES_TITLE_AVG_SPEED = 0x8888;
+static const StringID STR_GRAPH_STATION_CARGO_CAPTION = 0x8889;
+static const StringID STR_GRAPH_STATION_CARGO_X_LABEL = 0x888A;
+static const StringID STR_GRAPH_STATION_CARGO_TITLE = 0x888B;
+static const StringID STR_GRAPH_CARGO_DAYS_MODE = 0x888C;
+static const StringID STR_GRAPH_CARGO_SPEED_MODE = 0x888D;
+static const StringID STR_GRAPH_CARGO_TOOLTIP_DAYS_MODE = 0x888E;
+static const StringID STR_GRAPH_CARGO_TOOLTIP_SPEED_MODE = 0x888F;
+static const StringID STR_SMALLMAP_SCREENSHOT = 0x8890;
+static const StringID STR_NEWS_VEHICLE_NO_DEPOT_ORDER = 0x8891;
+static const StringID STR_NEWS_TRAIN_OVERSHOT_STATION = 0x8892;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_DAYS_CUSTOM = 0x8893;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_DAYS_CUSTOM_SINGULAR = 0x8894;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DROPDOWN_EVERY_MINUTES_CUSTOM = 0x8895;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_DAYS_QUERY_CAPT = 0x8896;
+static const StringID STR_GAME_OPTIONS_AUTOSAVE_MINUTES_QUERY_CAPT = 0x8897;
+static const StringID STR_RIVERS_VERY_MANY = 0x8898;
+static const StringID STR_RIVERS_EXTREMELY_MANY = 0x8899;
+static const StringID STR_CONFIG_SETTING_ADVISED_LEAVE_DEFAULT = 0x889A;
+static const StringID STR_CONFIG_SETTING_TRAIN_BRAKING_REALISTIC = 0x889B;
+static const StringID STR_CONFIG_SETTING_TRAIN_BRAKING_ASPECT_LIMITED_ON = 0x889C;
+static const StringID STR_CONFIG_SETTING_REALISTIC_BRAKING_SIGNALS_NOT_ALLOWED = 0x889D;
+static const StringID STR_CONFIG_SETTING_DELIVERY_BALANCED = 0x889E;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_IN_DEPOT = 0x889F;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_IN_DEPOT_HELPTEXT = 0x88A0;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_IN_DEPOT_VALUE = 0x88A1;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_WHEN_STOPPED = 0x88A2;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_WHEN_STOPPED_HELPTEXT = 0x88A3;
+static const StringID STR_CONFIG_SETTING_RUNNING_COSTS_WHEN_STOPPED_VALUE = 0x88A4;
+static const StringID STR_CONFIG_SETTING_MONEY_CHEAT_MULTIPLAYER = 0x88A5;
+static const StringID STR_CONFIG_SETTING_MONEY_CHEAT_MULTIPLAYER_HELPTEXT = 0x88A6;
+static const StringID STR_CONFIG_SETTING_RENAME_TOWNS_MULTIPLAYER = 0x88A7;
+static const StringID STR_CONFIG_SETTING_RENAME_TOWNS_MULTIPLAYER_HELPTEXT = 0x88A8;
+static const StringID STR_CONFIG_SETTING_OVERRIDE_TOWN_SETTINGS_MULTIPLAYER = 0x88A9;
+static const StringID STR_CONFIG_SETTING_OVERRIDE_TOWN_SETTINGS_MULTIPLAYER_HELPTEXT = 0x88AA;
+static const StringID STR_CONFIG_SETTING_CATCHMENT_INCREASE = 0x88AB;
+static const StringID STR_CONFIG_SETTING_CATCHMENT_INCREASE_HELPTEXT = 0x88AC;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_CARGO_CLASS_WAIT_TIME = 0x88AD;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_CARGO_CLASS_WAIT_TIME_HELPTEXT = 0x88AE;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_SIZE_CARGO_AMOUNT = 0x88AF;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_SIZE_CARGO_AMOUNT_HELPTEXT = 0x88B0;
+static const StringID STR_CONFIG_SETTING_CARGO_DELIVERY_MODE = 0x88B1;
+static const StringID STR_CONFIG_SETTING_CARGO_DELIVERY_MODE_HELPTEXT = 0x88B2;
+static const StringID STR_CONFIG_SETTING_TRAIN_BRAKING_MODEL = 0x88B3;
+static const StringID STR_CONFIG_SETTING_TRAIN_BRAKING_MODEL_HELPTEXT = 0x88B4;
+static const StringID STR_CONFIG_SETTING_REALISTIC_BRAKING_ASPECT_LIMITED = 0x88B5;
+static const StringID STR_CONFIG_SETTING_REALISTIC_BRAKING_ASPECT_LIMITED_HELPTEXT = 0x88B6;
+static const StringID STR_CONFIG_SETTING_THROUGH_LOAD_SPEED_LIMIT = 0x88B7;
+static const StringID STR_CONFIG_SETTING_THROUGH_LOAD_SPEED_LIMIT_HELPTEXT = 0x88B8;
+static const StringID STR_CONFIG_SETTING_RAIL_DEPOT_SPEED_LIMIT = 0x88B9;
+static const StringID STR_CONFIG_SETTING_RAIL_DEPOT_SPEED_LIMIT_HELPTEXT = 0x88BA;
+static const StringID STR_CONFIG_SETTING_BACK_ONE_WAY_PBS_SAFE_WAITING = 0x88BB;
+static const StringID STR_CONFIG_SETTING_BACK_ONE_WAY_PBS_SAFE_WAITING_HELPTEXT = 0x88BC;
+static const StringID STR_CONFIG_SETTING_INFLATION_FIXED_DATES = 0x88BD;
+static const StringID STR_CONFIG_SETTING_INFLATION_FIXED_DATES_HELPTEXT = 0x88BE;
+static const StringID STR_CONFIG_SETTING_IMPROVED_BREAKDOWNS = 0x88BF;
+static const StringID STR_CONFIG_SETTING_SHIP_COLLISION_AVOIDANCE = 0x88C0;
+static const StringID STR_CONFIG_SETTING_SHIP_COLLISION_AVOIDANCE_HELPTEXT = 0x88C1;
+static const StringID STR_CONFIG_SETTING_CHUNNEL = 0x88C2;
+static const StringID STR_CONFIG_SETTING_CHUNNEL_HELPTEXT = 0x88C3;
+static const StringID STR_CONFIG_SETTING_NO_TRAIN_CRASH_OTHER_COMPANY = 0x88C4;
+static const StringID STR_CONFIG_SETTING_NO_TRAIN_CRASH_OTHER_COMPANY_HELPTEXT = 0x88C5;
+static const StringID STR_CONFIG_SETTING_ROADVEH_ARTICULATED_OVERTAKING = 0x88C6;
+static const StringID STR_CONFIG_SETTING_ROADVEH_ARTICULATED_OVERTAKING_HELPTEXT = 0x88C7;
+static const StringID STR_CONFIG_SETTING_ROADVEH_CANT_QUANTUM_TUNNEL = 0x88C8;
+static const StringID STR_CONFIG_SETTING_ROADVEH_CANT_QUANTUM_TUNNEL_HELPTEXT = 0x88C9;
+static const StringID STR_CONFIG_SETTING_DRIVE_THROUGH_TRAIN_DEPOT = 0x88CA;
+static const StringID STR_CONFIG_SETTING_DRIVE_THROUGH_TRAIN_DEPOT_HELPTEXT = 0x88CB;
+static const StringID STR_CONFIG_SETTING_WARN_RESTRICTION_WAIT_VEHICLE = 0x88CC;
+static const StringID STR_CONFIG_SETTING_WARN_RESTRICTION_WAIT_VEHICLE_HELPTEXT = 0x88CD;
+static const StringID STR_CONFIG_SETTING_WARN_NO_DEPOT_ORDER = 0x88CE;
+static const StringID STR_CONFIG_SETTING_WARN_NO_DEPOT_ORDER_HELPTEXT = 0x88CF;
+static const StringID STR_CONFIG_SETTING_WARN_NO_DEPOT_ORDER_IF_BREAKDOWNS_ON = 0x88D0;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_VEHICLES_AFTER = 0x88D1;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_VEHICLES_AFTER_HELPTEXT = 0x88D2;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_VEHICLES_AFTER_VALUE = 0x88D3;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_VEHICLES_AFTER_ZERO = 0x88D4;
+static const StringID STR_CONFIG_SETTING_NO_INTRODUCE_VEHICLES_AFTER = 0x88D5;
+static const StringID STR_CONFIG_SETTING_NO_INTRODUCE_VEHICLES_AFTER_HELPTEXT = 0x88D6;
+static const StringID STR_CONFIG_SETTING_NO_INTRODUCE_VEHICLES_AFTER_VALUE = 0x88D7;
+static const StringID STR_CONFIG_SETTING_NO_INTRODUCE_VEHICLES_AFTER_ZERO = 0x88D8;
+static const StringID STR_CONFIG_SETTING_SHOW_WAGON_INTRO_YEAR = 0x88D9;
+static const StringID STR_CONFIG_SETTING_SHOW_WAGON_INTRO_YEAR_HELPTEXT = 0x88DA;
+static const StringID STR_CONFIG_SETTING_SHOW_TRAIN_LENGTH_IN_DETAILS = 0x88DB;
+static const StringID STR_CONFIG_SETTING_SHOW_TRAIN_LENGTH_IN_DETAILS_HELPTEXT = 0x88DC;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_GROUP_IN_DETAILS = 0x88DD;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_GROUP_IN_DETAILS_HELPTEXT = 0x88DE;
+static const StringID STR_CONFIG_SETTING_SHOW_TRAIN_WEIGHT_RATIOS_IN_DETAILS = 0x88DF;
+static const StringID STR_CONFIG_SETTING_SHOW_TRAIN_WEIGHT_RATIOS_IN_DETAILS_HELPTEXT = 0x88E0;
+static const StringID STR_CONFIG_SETTING_SHOW_RESTRICTED_SIG_DEF = 0x88E1;
+static const StringID STR_CONFIG_SETTING_SHOW_RESTRICTED_SIG_DEF_HELPTEXT = 0x88E2;
+static const StringID STR_CONFIG_SETTING_SHOW_ALL_SIG_DEF = 0x88E3;
+static const StringID STR_CONFIG_SETTING_SHOW_ALL_SIG_DEF_HELPTEXT = 0x88E4;
+static const StringID STR_CONFIG_SETTING_SHOW_ADV_TRACE_RESTRICT_FEATURES = 0x88E5;
+static const StringID STR_CONFIG_SETTING_SHOW_ADV_TRACE_RESTRICT_FEATURES_HELPTEXT = 0x88E6;
+static const StringID STR_CONFIG_SETTING_SHOW_PROGSIG_FEATURES = 0x88E7;
+static const StringID STR_CONFIG_SETTING_SHOW_PROGSIG_FEATURES_HELPTEXT = 0x88E8;
+static const StringID STR_CONFIG_SETTING_SHOW_NOENTRYSIG_FEATURES = 0x88E9;
+static const StringID STR_CONFIG_SETTING_SHOW_NOENTRYSIG_FEATURES_HELPTEXT = 0x88EA;
+static const StringID STR_CONFIG_SETTING_SHOW_VEH_LIST_CARGO_FILTER = 0x88EB;
+static const StringID STR_CONFIG_SETTING_SHOW_VEH_LIST_CARGO_FILTER_HELPTEXT = 0x88EC;
+static const StringID STR_CONFIG_SETTING_SHOW_ADV_LOADING_MODE_FEATURES = 0x88ED;
+static const StringID STR_CONFIG_SETTING_SHOW_ADV_LOADING_MODE_FEATURES_HELPTEXT = 0x88EE;
+static const StringID STR_CONFIG_SETTING_DISABLE_TOP_VEH_LIST_MASS_ACTIONS = 0x88EF;
+static const StringID STR_CONFIG_SETTING_DISABLE_TOP_VEH_LIST_MASS_ACTIONS_HELPTEXT = 0x88F0;
+static const StringID STR_CONFIG_SETTING_SHOW_DEPOT_SELL_GUI = 0x88F1;
+static const StringID STR_CONFIG_SETTING_SHOW_DEPOT_SELL_GUI_HELPTEXT = 0x88F2;
+static const StringID STR_CONFIG_SETTING_OPEN_VEHICLE_GUI_CLONE_SHARE = 0x88F3;
+static const StringID STR_CONFIG_SETTING_OPEN_VEHICLE_GUI_CLONE_SHARE_HELPTEXT = 0x88F4;
+static const StringID STR_CONFIG_SETTING_VEHICLE_NAMES = 0x88F5;
+static const StringID STR_CONFIG_SETTING_VEHICLE_NAMES_HELPTEXT = 0x88F6;
+static const StringID STR_CONFIG_SETTING_VEHICLE_NAMES_TRADITIONAL = 0x88F7;
+static const StringID STR_CONFIG_SETTING_VEHICLE_NAMES_MODERN = 0x88F8;
+static const StringID STR_CONFIG_SETTING_VEHICLE_NAMES_LONG = 0x88F9;
+static const StringID STR_CONFIG_SETTING_SHADED_TREES_ON_SLOPES = 0x88FA;
+static const StringID STR_CONFIG_SETTING_SHADED_TREES_ON_SLOPES_HELPTEXT = 0x88FB;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_TOOLTIP_MODE = 0x88FC;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_TOOLTIP_MODE_HELPTEXT = 0x88FD;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_TOOLTIP_MODE_OFF = 0x88FE;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_TOOLTIP_MODE_SIMPLE = 0x88FF;
+static const StringID STR_CONFIG_SETTING_STATION_RATING_TOOLTIP_MODE_DETAILED = 0x8900;
+static const StringID STR_CONFIG_SETTING_DEMOLISH_CONFIRM_MODE = 0x8901;
+static const StringID STR_CONFIG_SETTING_DEMOLISH_CONFIRM_MODE_HELPTEXT = 0x8902;
+static const StringID STR_CONFIG_SETTING_DEMOLISH_CONFIRM_MODE_OFF = 0x8903;
+static const StringID STR_CONFIG_SETTING_DEMOLISH_CONFIRM_MODE_INDUSTRY = 0x8904;
+static const StringID STR_CONFIG_SETTING_DEMOLISH_CONFIRM_MODE_ALL = 0x8905;
+static const StringID STR_CONFIG_SETTING_DUAL_PANE_TRAIN_PURCHASE_WINDOW = 0x8906;
+static const StringID STR_CONFIG_SETTING_DUAL_PANE_TRAIN_PURCHASE_WINDOW_HELPTEXT = 0x8907;
+static const StringID STR_CONFIG_SETTING_DUAL_PANE_TRAIN_PURCHASE_WINDOW_DUAL_BUTTONS = 0x8908;
+static const StringID STR_CONFIG_SETTING_DUAL_PANE_TRAIN_PURCHASE_WINDOW_DUAL_BUTTONS_HELPTEXT = 0x8909;
+static const StringID STR_CONFIG_SETTING_ALLOW_HIDE_WAYPOINT_LABEL = 0x890A;
+static const StringID STR_CONFIG_SETTING_ALLOW_HIDE_WAYPOINT_LABEL_HELPTEXT = 0x890B;
+static const StringID STR_CONFIG_SETTING_DISABLE_WATER_ANIMATION = 0x890C;
+static const StringID STR_CONFIG_SETTING_DISABLE_WATER_ANIMATION_HELPTEXT = 0x890D;
+static const StringID STR_CONFIG_SETTING_DISABLE_WATER_ANIMATION_8X = 0x890E;
+static const StringID STR_CONFIG_SETTING_DISABLE_WATER_ANIMATION_16X = 0x890F;
+static const StringID STR_CONFIG_SETTING_DISABLE_WATER_ANIMATION_32X = 0x8910;
+static const StringID STR_CONFIG_SETTING_SHOW_ORDER_OCCUPANCY_BY_DEFAULT = 0x8911;
+static const StringID STR_CONFIG_SETTING_SHOW_ORDER_OCCUPANCY_BY_DEFAULT_HELPTEXT = 0x8912;
+static const StringID STR_CONFIG_SETTING_SHOW_ORDER_MANAGEMENT_BY_DEFAULT = 0x8913;
+static const StringID STR_CONFIG_SETTING_SHOW_ORDER_MANAGEMENT_BY_DEFAULT_HELPTEXT = 0x8914;
+static const StringID STR_CONFIG_SETTING_SHOW_GROUP_HIERARCHY_NAME = 0x8915;
+static const StringID STR_CONFIG_SETTING_SHOW_GROUP_HIERARCHY_NAME_HELPTEXT = 0x8916;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_GROUP_HIERARCHY_NAME = 0x8917;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_GROUP_HIERARCHY_NAME_HELPTEXT = 0x8918;
+static const StringID STR_CONFIG_SETTING_ADV_SIG_BRIDGE_TUN_MODES = 0x8919;
+static const StringID STR_CONFIG_SETTING_ADV_SIG_BRIDGE_TUN_MODES_HELPTEXT = 0x891A;
+static const StringID STR_CONFIG_SETTING_SORT_TRACK_TYPES_BY_SPEED = 0x891B;
+static const StringID STR_CONFIG_SETTING_SORT_TRACK_TYPES_BY_SPEED_HELPTEXT = 0x891C;
+static const StringID STR_CONFIG_SETTING_MAX_SIGNAL_EVALUATIONS = 0x891D;
+static const StringID STR_CONFIG_SETTING_MAX_SIGNAL_EVALUATIONS_HELPTEXT = 0x891E;
+static const StringID STR_CONFIG_SETTING_RAINFORESTLINE_HEIGHT = 0x891F;
+static const StringID STR_CONFIG_SETTING_RAINFORESTLINE_HEIGHT_HELPTEXT = 0x8920;
+static const StringID STR_CONFIG_SETTING_CLIMATE_THRESHOLD_MODE = 0x8921;
+static const StringID STR_CONFIG_SETTING_CLIMATE_THRESHOLD_MODE_HELPTEXT = 0x8922;
+static const StringID STR_CONFIG_SETTING_CLIMATE_THRESHOLD_COVERAGE = 0x8923;
+static const StringID STR_CONFIG_SETTING_CLIMATE_THRESHOLD_MANUAL = 0x8924;
+static const StringID STR_CONFIG_SETTING_RIVER_MIN_LENGTH = 0x8925;
+static const StringID STR_CONFIG_SETTING_RIVER_MIN_LENGTH_HELPTEXT = 0x8926;
+static const StringID STR_CONFIG_SETTING_RIVER_ROUTE_RANDOM = 0x8927;
+static const StringID STR_CONFIG_SETTING_RIVER_ROUTE_RANDOM_HELPTEXT = 0x8928;
+static const StringID STR_CONFIG_SETTING_RIVERS_TOP_OF_HILL = 0x8929;
+static const StringID STR_CONFIG_SETTING_RIVERS_TOP_OF_HILL_HELPTEXT = 0x892A;
+static const StringID STR_CONFIG_SETTING_RIVER_TROPICS_WIDTH = 0x892B;
+static const StringID STR_CONFIG_SETTING_RIVER_TROPICS_WIDTH_HELPTEXT = 0x892C;
+static const StringID STR_CONFIG_SETTING_LAKE_TROPICS_WIDTH = 0x892D;
+static const StringID STR_CONFIG_SETTING_LAKE_TROPICS_WIDTH_HELPTEXT = 0x892E;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH = 0x892F;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH_HELPTEXT = 0x8930;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH_DEFAULT = 0x8931;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH_MEDIUM = 0x8932;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH_LARGE = 0x8933;
+static const StringID STR_CONFIG_SETTING_COAST_TROPICS_WIDTH_EXTRALARGE = 0x8934;
+static const StringID STR_CONFIG_SETTING_LAKE_SIZE = 0x8935;
+static const StringID STR_CONFIG_SETTING_LAKE_SIZE_HELPTEXT = 0x8936;
+static const StringID STR_CONFIG_SETTING_LAKE_SIZE_VALUE = 0x8937;
+static const StringID STR_CONFIG_SETTING_LAKE_SIZE_ZERO = 0x8938;
+static const StringID STR_CONFIG_SETTING_LAKES_ALLOWED_IN_DESERTS = 0x8939;
+static const StringID STR_CONFIG_SETTING_LAKES_ALLOWED_IN_DESERTS_HELPTEXT = 0x893A;
+static const StringID STR_CONFIG_SETTING_ROCKS_AMOUNT = 0x893B;
+static const StringID STR_CONFIG_SETTING_ROCKS_AMOUNT_HELPTEXT = 0x893C;
+static const StringID STR_CONFIG_SETTING_HEIGHT_ROCKS = 0x893D;
+static const StringID STR_CONFIG_SETTING_HEIGHT_ROCKS_HELPTEXT = 0x893E;
+static const StringID STR_CONFIG_SETTING_NONSTOP_ORDER_ONLY = 0x893F;
+static const StringID STR_CONFIG_SETTING_NONSTOP_ORDER_ONLY_HELPTEXT = 0x8940;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_MODE = 0x8941;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_MODE_HELPTEXT = 0x8942;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_MODE_OFF = 0x8943;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_MODE_ALL_LOCATIONS = 0x8944;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_MODE_STATIONS_ONLY = 0x8945;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_STEPS = 0x8946;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_ROUTE_STEPS_HELPTEXT = 0x8947;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_LIST_COMPANY_COLOUR = 0x8948;
+static const StringID STR_CONFIG_SETTING_SHOW_VEHICLE_LIST_COMPANY_COLOUR_HELPTEXT = 0x8949;
+static const StringID STR_CONFIG_SETTING_ENABLE_SINGLE_VEH_SHARED_ORDER_GUI = 0x894A;
+static const StringID STR_CONFIG_SETTING_ENABLE_SINGLE_VEH_SHARED_ORDER_GUI_HELPTEXT = 0x894B;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SCAN_SURROUNDINGS = 0x894C;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SLOPES = 0x894D;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_BRIDGES = 0x894E;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_TUNNELS = 0x894F;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SCROLLING_VP = 0x8950;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SCROLLING_VP_NOTHING = 0x8951;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SCROLLING_VP_CONTOUR = 0x8952;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SCROLLING_VP_BLEND = 0x8953;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_SCROLLING_VP_ALL = 0x8954;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_USE_OWNER_COLOUR_BRIDGE_TUNNEL = 0x8955;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_DEFAULT_MODE = 0x8956;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_DEFAULT_MODE_HELPTEXT = 0x8957;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_ACTION_DBLCLICK = 0x8958;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_ACTION_DBLCLICK_DO_NOTHING = 0x8959;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_ACTION_DBLCLICK_ZOOM_MAIN = 0x895A;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_ACTION_DBLCLICK_NEW_EXTRA = 0x895B;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_VEHICLE_ROUTE = 0x895C;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_SHOW_VEHICLE_ROUTE_HELPTEXT = 0x895D;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_DRAW_ROUTE_DASH = 0x895E;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_DRAW_ROUTE_DASH_VALUE = 0x895F;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_DRAW_ROUTE_DASH_DISABLED = 0x8960;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_CUSTOM_DAYS = 0x8961;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_CUSTOM_DAYS_HELPTEXT = 0x8962;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_CUSTOM_MINUTES = 0x8963;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_CUSTOM_MINUTES_HELPTEXT = 0x8964;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_ON_NETWORK_DISCONNECT = 0x8965;
+static const StringID STR_CONFIG_SETTING_AUTOSAVE_ON_NETWORK_DISCONNECT_HELPTEXT = 0x8966;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM = 0x8967;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM_HELPTEXT = 0x8968;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM_DISABLED = 0x8969;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM_DIFFERENT = 0x896A;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM_DIFFERENT_UNKNOWN = 0x896B;
+static const StringID STR_CONFIG_SETTING_SAVEGAME_OVERWRITE_CONFIRM_ENABLED = 0x896C;
+static const StringID STR_CONFIG_SETTING_AUTO_TIMETABLE_BY_DEFAULT = 0x896D;
+static const StringID STR_CONFIG_SETTING_AUTO_TIMETABLE_BY_DEFAULT_HELPTEXT = 0x896E;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION_BY_DEFAULT = 0x896F;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION_BY_DEFAULT_HELPTEXT = 0x8970;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_LEFTOVER_TICKS = 0x8971;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_LEFTOVER_TICKS_HELPTEXT = 0x8972;
+static const StringID STR_CONFIG_SETTING_OVERRIDE_TIME_SETTINGS = 0x8973;
+static const StringID STR_CONFIG_SETTING_OVERRIDE_TIME_SETTINGS_HELPTEXT = 0x8974;
+static const StringID STR_CONFIG_SETTING_TIME_IN_MINUTES = 0x8975;
+static const StringID STR_CONFIG_SETTING_TIME_IN_MINUTES_HELPTEXT = 0x8976;
+static const StringID STR_CONFIG_SETTING_TICKS_PER_MINUTE = 0x8977;
+static const StringID STR_CONFIG_SETTING_TICKS_PER_MINUTE_HELPTEXT = 0x8978;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME = 0x8979;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME_HELPTEXT = 0x897A;
+static const StringID STR_CONFIG_SETTING_CLOCK_OFFSET = 0x897B;
+static const StringID STR_CONFIG_SETTING_CLOCK_OFFSET_HELPTEXT = 0x897C;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME_NONE = 0x897D;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME_Y = 0x897E;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME_YM = 0x897F;
+static const StringID STR_CONFIG_SETTING_DATE_WITH_TIME_YMD = 0x8980;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_START_TEXT_ENTRY = 0x8981;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_START_TEXT_ENTRY_HELPTEXT = 0x8982;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION = 0x8983;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION_HELPTEXT = 0x8984;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION_RATE = 0x8985;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_SEPARATION_RATE_HELPTEXT = 0x8986;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_AUTOFILL_ROUNDING_TICKS = 0x8987;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_AUTOFILL_ROUNDING_TICKS_HELPTEXT = 0x8988;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_AUTOFILL_ROUNDING_TICKS_VALUE = 0x8989;
+static const StringID STR_CONFIG_SETTING_TIMETABLE_AUTOFILL_ROUNDING_TICKS_DEFAULT = 0x898A;
+static const StringID STR_CONFIG_SETTING_DEFAULT_ROAD_TYPE = 0x898B;
+static const StringID STR_CONFIG_SETTING_DEFAULT_ROAD_TYPE_HELPTEXT = 0x898C;
+static const StringID STR_CONFIG_SETTING_ENABLE_BUILD_RIVER = 0x898D;
+static const StringID STR_CONFIG_SETTING_ENABLE_BUILD_RIVER_HELPTEXT = 0x898E;
+static const StringID STR_CONFIG_SETTING_ENABLE_REMOVE_WATER = 0x898F;
+static const StringID STR_CONFIG_SETTING_ENABLE_REMOVE_WATER_HELPTEXT = 0x8990;
+static const StringID STR_CONFIG_SETTING_SHARING_RAIL = 0x8991;
+static const StringID STR_CONFIG_SETTING_SHARING_ROAD = 0x8992;
+static const StringID STR_CONFIG_SETTING_SHARING_WATER = 0x8993;
+static const StringID STR_CONFIG_SETTING_SHARING_AIR = 0x8994;
+static const StringID STR_CONFIG_SETTING_SHARING_FEE_RAIL = 0x8995;
+static const StringID STR_CONFIG_SETTING_SHARING_FEE_ROAD = 0x8996;
+static const StringID STR_CONFIG_SETTING_SHARING_FEE_WATER = 0x8997;
+static const StringID STR_CONFIG_SETTING_SHARING_FEE_AIR = 0x8998;
+static const StringID STR_CONFIG_SETTING_SHARING_FEE_HELPTEXT = 0x8999;
+static const StringID STR_CONFIG_SETTING_SHARING_PAYMENT_IN_DEBT = 0x899A;
+static const StringID STR_CONFIG_SETTING_SHARING_USED_BY_VEHICLES = 0x899B;
+static const StringID STR_CONFIG_SETTING_SHARING_ORDERS_TO_OTHERS = 0x899C;
+static const StringID STR_CONFIG_SETTING_INFRA_OTHERS_BUY_IN_DEPOT_RAIL = 0x899D;
+static const StringID STR_CONFIG_SETTING_INFRA_OTHERS_BUY_IN_DEPOT_ROAD = 0x899E;
+static const StringID STR_CONFIG_SETTING_INFRA_OTHERS_BUY_IN_DEPOT_WATER = 0x899F;
+static const StringID STR_CONFIG_SETTING_INFRA_OTHERS_BUY_IN_DEPOT_AIR = 0x89A0;
+static const StringID STR_CONFIG_SETTING_TRAIN_SPEED_ADAPTATION = 0x89A1;
+static const StringID STR_CONFIG_SETTING_TRAIN_SPEED_ADAPTATION_HELPTEXT = 0x89A2;
+static const StringID STR_CONFIG_SETTING_SLOW_ROAD_VEHICLES_IN_CURVES = 0x89A3;
+static const StringID STR_CONFIG_SETTING_SLOW_ROAD_VEHICLES_IN_CURVES_HELPTEXT = 0x89A4;
+static const StringID STR_CONFIG_SETTING_SIMULATE_SIGNALS = 0x89A5;
+static const StringID STR_CONFIG_SETTING_SIMULATE_SIGNALS_HELPTEXT = 0x89A6;
+static const StringID STR_CONFIG_SETTING_SIMULATE_SIGNALS_VALUE = 0x89A7;
+static const StringID STR_CONFIG_SETTING_DAY_LENGTH_FACTOR = 0x89A8;
+static const StringID STR_CONFIG_SETTING_DAY_LENGTH_FACTOR_HELPTEXT = 0x89A9;
+static const StringID STR_CONFIG_SETTING_TOWN_TUNNELS = 0x89AA;
+static const StringID STR_CONFIG_SETTING_TOWN_TUNNELS_HELPTEXT = 0x89AB;
+static const StringID STR_CONFIG_SETTING_TOWN_TUNNELS_FORBIDDEN = 0x89AC;
+static const StringID STR_CONFIG_SETTING_TOWN_TUNNELS_ALLOWED_OBSTRUCTION = 0x89AD;
+static const StringID STR_CONFIG_SETTING_TOWN_TUNNELS_ALLOWED = 0x89AE;
+static const StringID STR_CONFIG_SETTING_TOWN_MAX_ROAD_SLOPE = 0x89AF;
+static const StringID STR_CONFIG_SETTING_TOWN_MAX_ROAD_SLOPE_HELPTEXT = 0x89B0;
+static const StringID STR_CONFIG_SETTING_TOWN_MAX_ROAD_SLOPE_VALUE = 0x89B1;
+static const StringID STR_CONFIG_SETTING_TOWN_MAX_ROAD_SLOPE_ZERO = 0x89B2;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_BRIDGES = 0x89B3;
+static const StringID STR_CONFIG_SETTING_ALLOW_TOWN_BRIDGES_HELPTEXT = 0x89B4;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGO_FACTOR = 0x89B5;
+static const StringID STR_CONFIG_SETTING_TOWN_CARGO_FACTOR_HELPTEXT = 0x89B6;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_CARGO_FACTOR = 0x89B7;
+static const StringID STR_CONFIG_SETTING_INDUSTRY_CARGO_FACTOR_HELPTEXT = 0x89B8;
+static const StringID STR_CONFIG_SETTING_TOWN_ABOVE_HEIGHT = 0x89B9;
+static const StringID STR_CONFIG_SETTING_TOWN_ABOVE_HEIGHT_HELPTEXT = 0x89BA;
+static const StringID STR_CONFIG_SETTING_MIN_TOWN_LAND_AREA = 0x89BB;
+static const StringID STR_CONFIG_SETTING_MIN_TOWN_LAND_AREA_HELPTEXT = 0x89BC;
+static const StringID STR_CONFIG_SETTING_MIN_CITY_LAND_AREA = 0x89BD;
+static const StringID STR_CONFIG_SETTING_MIN_CITY_LAND_AREA_HELPTEXT = 0x89BE;
+static const StringID STR_CONFIG_SETTING_MIN_LAND_AREA_VALUE = 0x89BF;
+static const StringID STR_CONFIG_SETTING_MIN_LAND_AREA_ZERO = 0x89C0;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE = 0x89C1;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE_HELPTEXT = 0x89C2;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE_RANGE = 0x89C3;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE_RANGE_HELPTEXT = 0x89C4;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE_DYNAMIC_RANGE = 0x89C5;
+static const StringID STR_CONFIG_SETTING_TREES_AROUND_SNOWLINE_DYNAMIC_RANGE_HELPTEXT = 0x89C6;
+static const StringID STR_CONFIG_SETTING_BUILD_PUBLIC_ROADS = 0x89C7;
+static const StringID STR_CONFIG_SETTING_BUILD_PUBLIC_ROADS_HELPTEXT = 0x89C8;
+static const StringID STR_CONFIG_SETTING_BUILD_PUBLIC_ROADS_NONE = 0x89C9;
+static const StringID STR_CONFIG_SETTING_BUILD_PUBLIC_ROADS_WITH_CURVES = 0x89CA;
+static const StringID STR_CONFIG_SETTING_BUILD_PUBLIC_ROADS_AVOID_CURVES = 0x89CB;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH = 0x89CC;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_HELPTEXT = 0x89CD;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_NORMAL = 0x89CE;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_SLOW = 0x89CF;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_VERY_SLOW = 0x89D0;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_EXTREMELY_SLOW = 0x89D1;
+static const StringID STR_CONFIG_SETTING_TREE_GROWTH_STATIC = 0x89D2;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONES = 0x89D3;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_CALC_MODE = 0x89D4;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_CALC_MODE_HELPTEXT = 0x89D5;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_0_MULT = 0x89D6;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_0_MULT_HELPTEXT = 0x89D7;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_1_MULT = 0x89D8;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_1_MULT_HELPTEXT = 0x89D9;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_2_MULT = 0x89DA;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_2_MULT_HELPTEXT = 0x89DB;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_3_MULT = 0x89DC;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_3_MULT_HELPTEXT = 0x89DD;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_4_MULT = 0x89DE;
+static const StringID STR_CONFIG_SETTING_TOWN_ZONE_4_MULT_HELPTEXT = 0x89DF;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_0_MULT = 0x89E0;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_0_MULT_HELPTEXT = 0x89E1;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_1_MULT = 0x89E2;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_1_MULT_HELPTEXT = 0x89E3;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_2_MULT = 0x89E4;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_2_MULT_HELPTEXT = 0x89E5;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_3_MULT = 0x89E6;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_3_MULT_HELPTEXT = 0x89E7;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_4_MULT = 0x89E8;
+static const StringID STR_CONFIG_SETTING_CITY_ZONE_4_MULT_HELPTEXT = 0x89E9;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_CARGO_TRANSPORTED = 0x89EA;
+static const StringID STR_CONFIG_SETTING_TOWN_GROWTH_CARGO_TRANSPORTED_HELPTEXT = 0x89EB;
+static const StringID STR_CONFIG_SETTING_RANDOM_ROAD_RECONSTRUCTION = 0x89EC;
+static const StringID STR_CONFIG_SETTING_RANDOM_ROAD_RECONSTRUCTION_HELPTEXT = 0x89ED;
+static const StringID STR_CONFIG_SETTING_CARGO_PAYMENT_ALGORITHM = 0x89EE;
+static const StringID STR_CONFIG_SETTING_CARGO_PAYMENT_ALGORITHM_HELPTEXT = 0x89EF;
+static const StringID STR_CONFIG_SETTING_CARGO_PAYMENT_ALGORITHM_TRADITIONAL = 0x89F0;
+static const StringID STR_CONFIG_SETTING_CARGO_PAYMENT_ALGORITHM_MODERN = 0x89F1;
+static const StringID STR_CONFIG_SETTING_TOWN_MIN_DISTANCE = 0x89F2;
+static const StringID STR_CONFIG_SETTING_TOWN_MIN_DISTANCE_HELPTEXT = 0x89F3;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_NOT_DAYLENGTH_SCALED = 0x89F4;
+static const StringID STR_CONFIG_SETTING_LINKGRAPH_NOT_DAYLENGTH_SCALED_HELPTEXT = 0x89F5;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PER_CARGO = 0x89F6;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PER_CARGO_PARAM = 0x89F7;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PER_CARGO_HELPTEXT = 0x89F8;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_PER_CARGO_DEFAULT = 0x89F9;
+static const StringID STR_CONFIG_SETTING_DISTRIBUTION_HELPTEXT_EXTRA = 0x89FA;
+static const StringID STR_CONFIG_SETTING_AIRCRAFT_PATH_COST = 0x89FB;
+static const StringID STR_CONFIG_SETTING_AIRCRAFT_PATH_COST_HELPTEXT = 0x89FC;
+static const StringID STR_CONFIG_SETTING_SYNC_LOCALE_SETTINGS_NETWORK_SERVER = 0x89FD;
+static const StringID STR_CONFIG_SETTING_SYNC_LOCALE_SETTINGS_NETWORK_SERVER_HELPTEXT = 0x89FE;
+static const StringID STR_CONFIG_SETTING_INTERFACE_DEPARTUREBOARDS = 0x89FF;
+static const StringID STR_CONFIG_SETTING_INTERFACE_WALLCLOCK = 0x8A00;
+static const StringID STR_CONFIG_SETTING_INTERFACE_TIME_CLIENT = 0x8A01;
+static const StringID STR_CONFIG_SETTING_INTERFACE_TIME_SAVEGAME = 0x8A02;
+static const StringID STR_CONFIG_SETTING_INTERFACE_TIMETABLE = 0x8A03;
+static const StringID STR_CONFIG_SETTING_INTERFACE_ADV_SIGNALS = 0x8A04;
+static const StringID STR_CONFIG_SETTING_GENWORLD_RIVERS_LAKES = 0x8A05;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_CARGODIST_PER_CARGO_OVERRIDE = 0x8A06;
+static const StringID STR_CONFIG_SETTING_ENVIRONMENT_TREES = 0x8A07;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_MAP_OPTIONS = 0x8A08;
+static const StringID STR_CONFIG_SETTING_VIEWPORT_SIGNALS = 0x8A09;
+static const StringID STR_CONFIG_SETTING_VEHICLE_ROUTE_OVERLAY = 0x8A0A;
+static const StringID STR_CONFIG_SETTING_SHARING = 0x8A0B;
+static const StringID STR_CONFIG_SETTING_SCENARIO_EDITOR = 0x8A0C;
+static const StringID STR_CONFIG_SETTING_REROUTE_RV_ON_LAYOUT_CHANGE = 0x8A0D;
+static const StringID STR_CONFIG_SETTING_REROUTE_RV_ON_LAYOUT_CHANGE_HELPTEXT = 0x8A0E;
+static const StringID STR_CONFIG_SETTING_REROUTE_RV_ON_LAYOUT_CHANGE_NO = 0x8A0F;
+static const StringID STR_CONFIG_SETTING_REROUTE_RV_ON_LAYOUT_CHANGE_REMOVE_ONLY = 0x8A10;
+static const StringID STR_CONFIG_SETTING_REROUTE_RV_ON_LAYOUT_CHANGE_YES = 0x8A11;
+static const StringID STR_CONFIG_SETTING_ENABLE_ROAD_CUSTOM_BRIDGE_HEADS = 0x8A12;
+static const StringID STR_CONFIG_SETTING_ENABLE_ROAD_CUSTOM_BRIDGE_HEADS_HELPTEXT = 0x8A13;
+static const StringID STR_CONFIG_SETTING_ENABLE_RAIL_CUSTOM_BRIDGE_HEADS = 0x8A14;
+static const StringID STR_CONFIG_SETTING_ENABLE_RAIL_CUSTOM_BRIDGE_HEADS_HELPTEXT = 0x8A15;
+static const StringID STR_CONFIG_SETTING_ALLOW_GRF_OBJECTS_UNDER_BRIDGES = 0x8A16;
+static const StringID STR_CONFIG_SETTING_ALLOW_GRF_OBJECTS_UNDER_BRIDGES_HELPTEXT = 0x8A17;
+static const StringID STR_CONFIG_SETTING_ALLOW_GRF_STATIONS_UNDER_BRIDGES = 0x8A18;
+static const StringID STR_CONFIG_SETTING_ALLOW_GRF_STATIONS_UNDER_BRIDGES_HELPTEXT = 0x8A19;
+static const StringID STR_CONFIG_SETTING_ALLOW_ROAD_STATIONS_UNDER_BRIDGES = 0x8A1A;
+static const StringID STR_CONFIG_SETTING_ALLOW_ROAD_STATIONS_UNDER_BRIDGES_HELPTEXT = 0x8A1B;
+static const StringID STR_CONFIG_SETTING_ALLOW_ROAD_STATIONS_UNDER_BRIDGES_HELPTEXT_EXTRA = 0x8A1C;
+static const StringID STR_CONFIG_SETTING_ALLOW_DOCKS_UNDER_BRIDGES = 0x8A1D;
+static const StringID STR_CONFIG_SETTING_ALLOW_DOCKS_UNDER_BRIDGES_HELPTEXT = 0x8A1E;
+static const StringID STR_CONFIG_SETTING_PURCHASE_LAND_PERMITTED = 0x8A1F;
+static const StringID STR_CONFIG_SETTING_PURCHASE_LAND_PERMITTED_HELPTEXT = 0x8A20;
+static const StringID STR_CONFIG_SETTING_BUILD_OBJECT_PERMITTED = 0x8A21;
+static const StringID STR_CONFIG_SETTING_BUILD_OBJECT_PERMITTED_HELPTEXT = 0x8A22;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_OBJECTS_AFTER = 0x8A23;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_OBJECTS_AFTER_HELPTEXT = 0x8A24;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_OBJECTS_AFTER_VALUE = 0x8A25;
+static const StringID STR_CONFIG_SETTING_NO_EXPIRE_OBJECTS_AFTER_ZERO = 0x8A26;
+static const StringID STR_CONFIG_SETTING_IGNORE_OBJECT_INTRO_DATES = 0x8A27;
+static const StringID STR_CONFIG_SETTING_IGNORE_OBJECT_INTRO_DATES_HELPTEXT = 0x8A28;
+static const StringID STR_PURCHASE_LAND_PERMITTED_NO = 0x8A29;
+static const StringID STR_PURCHASE_LAND_PERMITTED_SINGLE = 0x8A2A;
+static const StringID STR_PURCHASE_LAND_PERMITTED_AREA = 0x8A2B;
+static const StringID STR_PURCHASE_LAND_NOT_PERMITTED = 0x8A2C;
+static const StringID STR_PURCHASE_LAND_NOT_PERMITTED_BULK = 0x8A2D;
+static const StringID STR_BUILD_OBJECT_NOT_PERMITTED_BULK = 0x8A2E;
+static const StringID STR_CONFIG_SETTING_ADJACENT_CROSSINGS = 0x8A2F;
+static const StringID STR_CONFIG_SETTING_ADJACENT_CROSSINGS_HELPTEXT = 0x8A30;
+static const StringID STR_CONFIG_SETTING_SAFER_CROSSINGS = 0x8A31;
+static const StringID STR_CONFIG_SETTING_SAFER_CROSSINGS_HELPTEXT = 0x8A32;
+static const StringID STR_CONFIG_SETTING_PAY_FOR_REPAIR_VEHICLE = 0x8A33;
+static const StringID STR_CONFIG_SETTING_PAY_FOR_REPAIR_VEHICLE_HELPTEXT = 0x8A34;
+static const StringID STR_CONFIG_SETTING_REPAIR_COST = 0x8A35;
+static const StringID STR_CONFIG_SETTING_REPAIR_COST_HELPTEXT = 0x8A36;
+static const StringID STR_CONFIG_OCCUPANCY_SMOOTHNESS = 0x8A37;
+static const StringID STR_CONFIG_OCCUPANCY_SMOOTHNESS_HELPTEXT = 0x8A38;
+static const StringID STR_CONFIG_SETTING_ADVANCE_ORDER_ON_CLONE = 0x8A39;
+static const StringID STR_CONFIG_SETTING_ADVANCE_ORDER_ON_CLONE_HELPTEXT = 0x8A3A;
+static const StringID STR_CONFIG_SETTING_COPY_CLONE_ADD_TO_GROUP = 0x8A3B;
+static const StringID STR_CONFIG_SETTING_COPY_CLONE_ADD_TO_GROUP_HELPTEXT = 0x8A3C;
+static const StringID STR_CONFIG_SETTING_REMAIN_IF_NEXT_ORDER_SAME_STATION = 0x8A3D;
+static const StringID STR_CONFIG_SETTING_REMAIN_IF_NEXT_ORDER_SAME_STATION_HELPTEXT = 0x8A3E;
+static const StringID STR_CONFIG_SETTING_SCENARIO_MULTIPLE_BUILDINGS = 0x8A3F;
+static const StringID STR_CONFIG_SETTING_SCENARIO_MULTIPLE_BUILDINGS_HELPTEXT = 0x8A40;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_DATES = 0x8A41;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_DATES_HELPTEXT = 0x8A42;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_ZONES = 0x8A43;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_ZONES_HELPTEXT = 0x8A44;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_GRF = 0x8A45;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_GRF_HELPTEXT = 0x8A46;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_ZONES_OFF = 0x8A47;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_ZONES_WITHIN_TOWN = 0x8A48;
+static const StringID STR_CONFIG_SETTING_SCENARIO_HOUSE_IGNORE_ZONES_ANYWHERE = 0x8A49;
+static const StringID STR_CONFIG_SETTING_NETWORK_CHANGE_NOT_ALLOWED = 0x8A4A;
+static const StringID STR_CONFIG_SETTING_NETWORK_CHANGE_NOT_ALLOWED_NEWGRF = 0x8A4B;
+static const StringID STR_CHEAT_EDIT_MONEY_QUERY_CAPT = 0x8A4C;
+static const StringID STR_CHEAT_INFLATION_COST = 0x8A4D;
+static const StringID STR_CHEAT_INFLATION_COST_QUERY_CAPT = 0x8A4E;
+static const StringID STR_CHEAT_INFLATION_INCOME = 0x8A4F;
+static const StringID STR_CHEAT_INFLATION_INCOME_QUERY_CAPT = 0x8A50;
+static const StringID STR_CHEAT_STATION_RATING = 0x8A51;
+static const StringID STR_CHEAT_TOWN_RATING = 0x8A52;
+static const StringID STR_NETWORK_MESSAGE_GIVE_MONEY_RECEIVE = 0x8A53;
+static const StringID STR_NETWORK_MESSAGE_GAVE_MONEY_AWAY = 0x8A54;
+static const StringID STR_NETWORK_MESSAGE_MONEY_GIVE_SRC_DESCRIPTION = 0x8A55;
+static const StringID STR_TRANSPARENT_TUNNELS_TOOLTIP = 0x8A56;
+static const StringID STR_LINKGRAPH_STATS_TOOLTIP_TIME_EXTENSION_GENERAL = 0x8A57;
+static const StringID STR_LINKGRAPH_STATS_TOOLTIP_CAPACITY = 0x8A58;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_BUILD_POLYRAIL = 0x8A59;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_PROG_TOOLTIP = 0x8A5A;
+static const StringID STR_BUILD_SIGNAL_SEMAPHORE_NO_ENTRY_TOOLTIP = 0x8A5B;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_PROG_TOOLTIP = 0x8A5C;
+static const StringID STR_BUILD_SIGNAL_ELECTRIC_NO_ENTRY_TOOLTIP = 0x8A5D;
+static const StringID STR_BUILD_SIGNAL_DEFAULT_STYLE = 0x8A5E;
+static const StringID STR_BUILD_SIGNAL_STYLE_TOOLTIP = 0x8A5F;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_EQUALS = 0x8A60;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_NOT_EQUALS = 0x8A61;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_LESS_THAN = 0x8A62;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_LESS_EQUALS = 0x8A63;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_MORE_THAN = 0x8A64;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_MORE_EQUALS = 0x8A65;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_CARGO_EQUALS = 0x8A66;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_CARGO_NOT_EQUALS = 0x8A67;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_HAS_STATUS = 0x8A68;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_DOESNT_HAVE_STATUS = 0x8A69;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_PASS = 0x8A6A;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARATOR_DOESNT_PASS = 0x8A6B;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_IF = 0x8A6C;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ELIF = 0x8A6D;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ORIF = 0x8A6E;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ELSE = 0x8A6F;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ENDIF = 0x8A70;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_LENGTH = 0x8A71;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_MAX_SPEED = 0x8A72;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_CURRENT_ORDER = 0x8A73;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_NEXT_ORDER = 0x8A74;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_LAST_VISITED_STATION = 0x8A75;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_CARGO = 0x8A76;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_LOAD_PERCENT = 0x8A77;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_ENTRY_DIRECTION = 0x8A78;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_ENTRY_SIGNAL = 0x8A79;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_ENTRY_SIGNAL_LONG = 0x8A7A;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_RES_END_SIGNAL = 0x8A7B;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_RES_END_SIGNAL_LONG = 0x8A7C;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_RES_END_TILE = 0x8A7D;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_PBS_RES_END_TILE_LONG = 0x8A7E;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_GROUP = 0x8A7F;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_SLOT = 0x8A80;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_SLOT_OCCUPANCY = 0x8A81;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_SLOT_OCCUPANCY_REMAINING = 0x8A82;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_SLOT_OCCUPANCY_SHORT = 0x8A83;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_SLOT_OCCUPANCY_REMAINING_SHORT = 0x8A84;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_COUNTER_VALUE = 0x8A85;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TIME_DATE_VALUE = 0x8A86;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_RESERVED_TILES_AHEAD = 0x8A87;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_WEIGHT = 0x8A88;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_POWER = 0x8A89;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_MAX_TE = 0x8A8A;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_POWER_WEIGHT_RATIO = 0x8A8B;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_MAX_TE_WEIGHT_RATIO = 0x8A8C;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_OWNER = 0x8A8D;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_STATUS = 0x8A8E;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_TRAIN_ENGINE_CLASS = 0x8A8F;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_ORDER_TARGET_DIRECTION = 0x8A90;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_RESERVATION_THROUGH = 0x8A91;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_RESERVATION_THROUGH_SHORT = 0x8A92;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_UNDEFINED = 0x8A93;
+static const StringID STR_TRACE_RESTRICT_VARIABLE_UNDEFINED_RED = 0x8A94;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_INTEGER = 0x8A95;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_SPEED = 0x8A96;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_WEIGHT = 0x8A97;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_POWER = 0x8A98;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_FORCE = 0x8A99;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_POWER_WEIGHT_RATIO = 0x8A9A;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_FORCE_WEIGHT_RATIO = 0x8A9B;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_TIME_HHMM = 0x8A9C;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ORDER_STATION = 0x8A9D;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ORDER_WAYPOINT = 0x8A9E;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ORDER_DEPOT = 0x8A9F;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_CARGO = 0x8AA0;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ENTRY_DIRECTION = 0x8AA1;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ENTRY_SIGNAL_FACE = 0x8AA2;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ENTRY_SIGNAL_TYPE = 0x8AA3;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_TILE_INDEX = 0x8AA4;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_GROUP = 0x8AA5;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_GROUP_STR = 0x8AA6;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_OWNER = 0x8AA7;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_SLOT = 0x8AA8;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_SLOT_STR = 0x8AA9;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_SLOT_OCCUPANCY = 0x8AAA;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_SLOT_OCCUPANCY_STR = 0x8AAB;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_TRAIN_STATUS = 0x8AAC;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COUNTER = 0x8AAD;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COUNTER_STR = 0x8AAE;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_ENGINE_CLASSES = 0x8AAF;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_TARGET_DIRECTION = 0x8AB0;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_PASSES_TILE_INDEX = 0x8AB1;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_UNDEFINED = 0x8AB2;
+static const StringID STR_TRACE_RESTRICT_CONDITIONAL_COMPARE_UNDEFINED = 0x8AB3;
+static const StringID STR_TRACE_RESTRICT_PF_PENALTY_ITEM = 0x8AB4;
+static const StringID STR_TRACE_RESTRICT_PF_PENALTY_ITEM_PRESET = 0x8AB5;
+static const StringID STR_TRACE_RESTRICT_WHITE = 0x8AB6;
+static const StringID STR_TRACE_RESTRICT_START = 0x8AB7;
+static const StringID STR_TRACE_RESTRICT_END = 0x8AB8;
+static const StringID STR_TRACE_RESTRICT_PF_DENY = 0x8AB9;
+static const StringID STR_TRACE_RESTRICT_PF_ALLOW = 0x8ABA;
+static const StringID STR_TRACE_RESTRICT_PF_ALLOW_LONG = 0x8ABB;
+static const StringID STR_TRACE_RESTRICT_RESERVE_THROUGH = 0x8ABC;
+static const StringID STR_TRACE_RESTRICT_RESERVE_THROUGH_CANCEL = 0x8ABD;
+static const StringID STR_TRACE_RESTRICT_LONG_RESERVE = 0x8ABE;
+static const StringID STR_TRACE_RESTRICT_LONG_RESERVE_CANCEL = 0x8ABF;
+static const StringID STR_TRACE_RESTRICT_WAIT_AT_PBS = 0x8AC0;
+static const StringID STR_TRACE_RESTRICT_WAIT_AT_PBS_CANCEL = 0x8AC1;
+static const StringID STR_TRACE_RESTRICT_PBS_RES_END_WAIT = 0x8AC2;
+static const StringID STR_TRACE_RESTRICT_PBS_RES_END_WAIT_CANCEL = 0x8AC3;
+static const StringID STR_TRACE_RESTRICT_PBS_RES_END_WAIT_SHORT = 0x8AC4;
+static const StringID STR_TRACE_RESTRICT_PBS_RES_END_WAIT_CANCEL_SHORT = 0x8AC5;
+static const StringID STR_TRACE_RESTRICT_PF_PENALTY = 0x8AC6;
+static const StringID STR_TRACE_RESTRICT_PF_VALUE_SMALL = 0x8AC7;
+static const StringID STR_TRACE_RESTRICT_PF_VALUE_MEDIUM = 0x8AC8;
+static const StringID STR_TRACE_RESTRICT_PF_VALUE_LARGE = 0x8AC9;
+static const StringID STR_TRACE_RESTRICT_PF_VALUE_CUSTOM = 0x8ACA;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_FRONT = 0x8ACB;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_BACK = 0x8ACC;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_NE = 0x8ACD;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_SE = 0x8ACE;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_SW = 0x8ACF;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_NW = 0x8AD0;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_TUNBRIDGE_ENTRANCE = 0x8AD1;
+static const StringID STR_TRACE_RESTRICT_DIRECTION_TUNBRIDGE_EXIT = 0x8AD2;
+static const StringID STR_TRACE_RESTRICT_COMPANY = 0x8AD3;
+static const StringID STR_TRACE_RESTRICT_UNDEFINED_COMPANY = 0x8AD4;
+static const StringID STR_TRACE_RESTRICT_SLOT_OP = 0x8AD5;
+static const StringID STR_TRACE_RESTRICT_REVERSE = 0x8AD6;
+static const StringID STR_TRACE_RESTRICT_SPEED_RESTRICTION = 0x8AD7;
+static const StringID STR_TRACE_RESTRICT_NEWS_CONTROL = 0x8AD8;
+static const StringID STR_TRACE_RESTRICT_COUNTER_OP = 0x8AD9;
+static const StringID STR_TRACE_RESTRICT_PF_PENALTY_CONTROL = 0x8ADA;
+static const StringID STR_TRACE_RESTRICT_SPEED_ADAPTATION_CONTROL = 0x8ADB;
+static const StringID STR_TRACE_RESTRICT_SIGNAL_MODE_CONTROL = 0x8ADC;
+static const StringID STR_TRACE_RESTRICT_SLOT_ACQUIRE_WAIT = 0x8ADD;
+static const StringID STR_TRACE_RESTRICT_SLOT_TRY_ACQUIRE = 0x8ADE;
+static const StringID STR_TRACE_RESTRICT_SLOT_TRY_ACQUIRE_ON_RES = 0x8ADF;
+static const StringID STR_TRACE_RESTRICT_SLOT_RELEASE_FRONT = 0x8AE0;
+static const StringID STR_TRACE_RESTRICT_SLOT_RELEASE_BACK = 0x8AE1;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_ACQUIRE_WAIT = 0x8AE2;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_TRY_ACQUIRE = 0x8AE3;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_RELEASE = 0x8AE4;
+static const StringID STR_TRACE_RESTRICT_SLOT_ACQUIRE_WAIT_ITEM = 0x8AE5;
+static const StringID STR_TRACE_RESTRICT_SLOT_TRY_ACQUIRE_ITEM = 0x8AE6;
+static const StringID STR_TRACE_RESTRICT_SLOT_TRY_ACQUIRE_ITEM_RES_ONLY = 0x8AE7;
+static const StringID STR_TRACE_RESTRICT_SLOT_RELEASE_FRONT_ITEM = 0x8AE8;
+static const StringID STR_TRACE_RESTRICT_SLOT_RELEASE_BACK_ITEM = 0x8AE9;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_ACQUIRE_WAIT_ITEM = 0x8AEA;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_TRY_ACQUIRE_ITEM = 0x8AEB;
+static const StringID STR_TRACE_RESTRICT_SLOT_PBS_RES_END_RELEASE_ITEM = 0x8AEC;
+static const StringID STR_TRACE_RESTRICT_SLOT_NAME = 0x8AED;
+static const StringID STR_TRACE_RESTRICT_SLOT_NAME_PREFIXED = 0x8AEE;
+static const StringID STR_TRACE_RESTRICT_SLOT_LIST_HEADER = 0x8AEF;
+static const StringID STR_TRACE_RESTRICT_SLOT_LIST_SEPARATOR = 0x8AF0;
+static const StringID STR_TRACE_RESTRICT_COUNTER_NAME = 0x8AF1;
+static const StringID STR_TRACE_RESTRICT_COUNTER_INCREASE = 0x8AF2;
+static const StringID STR_TRACE_RESTRICT_COUNTER_DECREASE = 0x8AF3;
+static const StringID STR_TRACE_RESTRICT_COUNTER_SET = 0x8AF4;
+static const StringID STR_TRACE_RESTRICT_COUNTER_INCREASE_ITEM = 0x8AF5;
+static const StringID STR_TRACE_RESTRICT_COUNTER_DECREASE_ITEM = 0x8AF6;
+static const StringID STR_TRACE_RESTRICT_COUNTER_SET_ITEM = 0x8AF7;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_EMPTY = 0x8AF8;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_FULL = 0x8AF9;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_BROKEN_DOWN = 0x8AFA;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_NEEDS_REPAIR = 0x8AFB;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_REVERSING = 0x8AFC;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_HEADING_TO_STATION_WAYPOINT = 0x8AFD;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_HEADING_TO_DEPOT = 0x8AFE;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_LOADING = 0x8AFF;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_WAITING = 0x8B00;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_LOST = 0x8B01;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_REQUIRES_SERVICE = 0x8B02;
+static const StringID STR_TRACE_RESTRICT_TRAIN_STATUS_STOPPING_AT_STATION_WAYPOINT = 0x8B03;
+static const StringID STR_TRACE_RESTRICT_REVERSE_SIG = 0x8B04;
+static const StringID STR_TRACE_RESTRICT_REVERSE_SIG_CANCEL = 0x8B05;
+static const StringID STR_TRACE_RESTRICT_SET_SPEED_RESTRICTION = 0x8B06;
+static const StringID STR_TRACE_RESTRICT_REMOVE_SPEED_RESTRICTION = 0x8B07;
+static const StringID STR_TRACE_RESTRICT_TRAIN_NOT_STUCK = 0x8B08;
+static const StringID STR_TRACE_RESTRICT_TRAIN_NOT_STUCK_CANCEL = 0x8B09;
+static const StringID STR_TRACE_RESTRICT_TRAIN_NOT_STUCK_SHORT = 0x8B0A;
+static const StringID STR_TRACE_RESTRICT_TRAIN_NOT_STUCK_CANCEL_SHORT = 0x8B0B;
+static const StringID STR_TRACE_RESTRICT_NO_PBS_BACK_PENALTY = 0x8B0C;
+static const StringID STR_TRACE_RESTRICT_NO_PBS_BACK_PENALTY_CANCEL = 0x8B0D;
+static const StringID STR_TRACE_RESTRICT_NO_PBS_BACK_PENALTY_SHORT = 0x8B0E;
+static const StringID STR_TRACE_RESTRICT_NO_PBS_BACK_PENALTY_CANCEL_SHORT = 0x8B0F;
+static const StringID STR_TRACE_RESTRICT_MAKE_TRAIN_SPEED_ADAPTATION_EXEMPT = 0x8B10;
+static const StringID STR_TRACE_RESTRICT_REMOVE_TRAIN_SPEED_ADAPTATION_EXEMPT = 0x8B11;
+static const StringID STR_TRACE_RESTRICT_MAKE_TRAIN_SPEED_ADAPTATION_EXEMPT_SHORT = 0x8B12;
+static const StringID STR_TRACE_RESTRICT_REMOVE_TRAIN_SPEED_ADAPTATION_EXEMPT_SHORT = 0x8B13;
+static const StringID STR_TRACE_RESTRICT_USE_NORMAL_ASPECT_MODE = 0x8B14;
+static const StringID STR_TRACE_RESTRICT_USE_SHUNT_ASPECT_MODE = 0x8B15;
+static const StringID STR_TRACE_RESTRICT_USE_NORMAL_ASPECT_MODE_SHORT = 0x8B16;
+static const StringID STR_TRACE_RESTRICT_USE_SHUNT_ASPECT_MODE_SHORT = 0x8B17;
+static const StringID STR_TRACE_RESTRICT_TIME_MINUTE = 0x8B18;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR = 0x8B19;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR_MINUTE = 0x8B1A;
+static const StringID STR_TRACE_RESTRICT_TIME_DAY = 0x8B1B;
+static const StringID STR_TRACE_RESTRICT_TIME_MONTH = 0x8B1C;
+static const StringID STR_TRACE_RESTRICT_TIME_MINUTE_ITEM = 0x8B1D;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR_ITEM = 0x8B1E;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR_MINUTE_ITEM = 0x8B1F;
+static const StringID STR_TRACE_RESTRICT_TIME_DAY_ITEM = 0x8B20;
+static const StringID STR_TRACE_RESTRICT_TIME_MONTH_ITEM = 0x8B21;
+static const StringID STR_TRACE_RESTRICT_TIME_MINUTE_SHORT = 0x8B22;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR_SHORT = 0x8B23;
+static const StringID STR_TRACE_RESTRICT_TIME_HOUR_MINUTE_SHORT = 0x8B24;
+static const StringID STR_TRACE_RESTRICT_TIME_DAY_ITEM_SHORT = 0x8B25;
+static const StringID STR_TRACE_RESTRICT_TIME_MONTH_ITEM_SHORT = 0x8B26;
+static const StringID STR_TRACE_RESTRICT_TIMETABLE_LATENESS = 0x8B27;
+static const StringID STR_TRACE_RESTRICT_TIMETABLE_EARLINESS = 0x8B28;
+static const StringID STR_TRACE_RESTRICT_DISPATCH_SLOT_NEXT = 0x8B29;
+static const StringID STR_TRACE_RESTRICT_DISPATCH_SLOT_LAST = 0x8B2A;
+static const StringID STR_TRACE_RESTRICT_DISPATCH_SLOT_SHORT_NEXT = 0x8B2B;
+static const StringID STR_TRACE_RESTRICT_DISPATCH_SLOT_SHORT_LAST = 0x8B2C;
+static const StringID STR_TRACE_RESTRICT_VALUE_CAPTION = 0x8B2D;
+static const StringID STR_TRACE_RESTRICT_CAPTION = 0x8B2E;
+static const StringID STR_TRACE_RESTRICT_CAPTION_SHARED = 0x8B2F;
+static const StringID STR_TRACE_RESTRICT_UP_BTN_TOOLTIP = 0x8B30;
+static const StringID STR_TRACE_RESTRICT_DOWN_BTN_TOOLTIP = 0x8B31;
+static const StringID STR_TRACE_RESTRICT_TYPE_TOOLTIP = 0x8B32;
+static const StringID STR_TRACE_RESTRICT_COND_COMPARATOR_TOOLTIP = 0x8B33;
+static const StringID STR_TRACE_RESTRICT_COND_VALUE_TOOLTIP = 0x8B34;
+static const StringID STR_TRACE_RESTRICT_CONDFLAGS_TOOLTIP = 0x8B35;
+static const StringID STR_TRACE_RESTRICT_GOTO_SIGNAL_TOOLTIP = 0x8B36;
+static const StringID STR_TRACE_RESTRICT_SLOT_OP_TOOLTIP = 0x8B37;
+static const StringID STR_TRACE_RESTRICT_SLOT_GUI_LIST_TOOLTIP = 0x8B38;
+static const StringID STR_TRACE_RESTRICT_SLOT_CREATE_TOOLTIP = 0x8B39;
+static const StringID STR_TRACE_RESTRICT_SLOT_DELETE_TOOLTIP = 0x8B3A;
+static const StringID STR_TRACE_RESTRICT_SLOT_RENAME_TOOLTIP = 0x8B3B;
+static const StringID STR_TRACE_RESTRICT_SLOT_SET_MAX_OCCUPANCY_TOOLTIP = 0x8B3C;
+static const StringID STR_TRACE_RESTRICT_SLOT_CAPTION = 0x8B3D;
+static const StringID STR_TRACE_RESTRICT_SLOT_MANAGE = 0x8B3E;
+static const StringID STR_TRACE_RESTRICT_SLOT_MAX_OCCUPANCY = 0x8B3F;
+static const StringID STR_TRACE_RESTRICT_SLOT_RENAME_CAPTION = 0x8B40;
+static const StringID STR_TRACE_RESTRICT_SLOT_CREATE_CAPTION = 0x8B41;
+static const StringID STR_TRACE_RESTRICT_SLOT_SET_MAX_OCCUPANCY_CAPTION = 0x8B42;
+static const StringID STR_TRACE_RESTRICT_SLOT_QUERY_DELETE_CAPTION = 0x8B43;
+static const StringID STR_TRACE_RESTRICT_SLOT_DELETE_QUERY_TEXT = 0x8B44;
+static const StringID STR_TRACE_RESTRICT_COUNTER_OP_TOOLTIP = 0x8B45;
+static const StringID STR_TRACE_RESTRICT_COUNTER_GUI_LIST_TOOLTIP = 0x8B46;
+static const StringID STR_TRACE_RESTRICT_COUNTER_CREATE = 0x8B47;
+static const StringID STR_TRACE_RESTRICT_COUNTER_DELETE = 0x8B48;
+static const StringID STR_TRACE_RESTRICT_COUNTER_RENAME = 0x8B49;
+static const StringID STR_TRACE_RESTRICT_COUNTER_SET_VALUE = 0x8B4A;
+static const StringID STR_TRACE_RESTRICT_COUNTER_CREATE_TOOLTIP = 0x8B4B;
+static const StringID STR_TRACE_RESTRICT_COUNTER_DELETE_TOOLTIP = 0x8B4C;
+static const StringID STR_TRACE_RESTRICT_COUNTER_RENAME_TOOLTIP = 0x8B4D;
+static const StringID STR_TRACE_RESTRICT_COUNTER_SET_VALUE_TOOLTIP = 0x8B4E;
+static const StringID STR_TRACE_RESTRICT_COUNTER_CAPTION = 0x8B4F;
+static const StringID STR_TRACE_RESTRICT_COUNTER_MANAGE = 0x8B50;
+static const StringID STR_TRACE_RESTRICT_COUNTER_RENAME_CAPTION = 0x8B51;
+static const StringID STR_TRACE_RESTRICT_COUNTER_CREATE_CAPTION = 0x8B52;
+static const StringID STR_TRACE_RESTRICT_COUNTER_SET_VALUE_CAPTION = 0x8B53;
+static const StringID STR_TRACE_RESTRICT_COUNTER_QUERY_DELETE_CAPTION = 0x8B54;
+static const StringID STR_TRACE_RESTRICT_COUNTER_DELETE_QUERY_TEXT = 0x8B55;
+static const StringID STR_TRACE_RESTRICT_INSERT = 0x8B56;
+static const StringID STR_TRACE_RESTRICT_REMOVE = 0x8B57;
+static const StringID STR_TRACE_RESTRICT_RESET = 0x8B58;
+static const StringID STR_TRACE_RESTRICT_COPY = 0x8B59;
+static const StringID STR_TRACE_RESTRICT_APPEND = 0x8B5A;
+static const StringID STR_TRACE_RESTRICT_DUPLICATE = 0x8B5B;
+static const StringID STR_TRACE_RESTRICT_SHARE = 0x8B5C;
+static const StringID STR_TRACE_RESTRICT_UNSHARE = 0x8B5D;
+static const StringID STR_TRACE_RESTRICT_SELECT_TARGET = 0x8B5E;
+static const StringID STR_TRACE_RESTRICT_SELECT_SIGNAL = 0x8B5F;
+static const StringID STR_TRACE_RESTRICT_SELECT_TILE = 0x8B60;
+static const StringID STR_TRACE_RESTRICT_INSERT_TOOLTIP = 0x8B61;
+static const StringID STR_TRACE_RESTRICT_REMOVE_TOOLTIP = 0x8B62;
+static const StringID STR_TRACE_RESTRICT_RESET_TOOLTIP = 0x8B63;
+static const StringID STR_TRACE_RESTRICT_COPY_TOOLTIP = 0x8B64;
+static const StringID STR_TRACE_RESTRICT_DUPLICATE_TOOLTIP = 0x8B65;
+static const StringID STR_TRACE_RESTRICT_SHARE_TOOLTIP = 0x8B66;
+static const StringID STR_TRACE_RESTRICT_UNSHARE_TOOLTIP = 0x8B67;
+static const StringID STR_TRACE_RESTRICT_SIGNAL_GUI_TOOLTIP = 0x8B68;
+static const StringID STR_TRACE_RESTRICT_INSTRUCTION_LIST_TOOLTIP = 0x8B69;
+static const StringID STR_TRACE_RESTRICT_HIGHLIGHT_TOOLTIP = 0x8B6A;
+static const StringID STR_TRACE_RESTRICT_WARNING_REQUIRES_REALISTIC_BRAKING = 0x8B6B;
+static const StringID STR_TRACE_RESTRICT_WARNING_SIGNAL_MODE_CONTROL_ONLY = 0x8B6C;
+static const StringID STR_TRACE_RESTRICT_WARNING_NO_SIGNAL_MODE_CONTROL = 0x8B6D;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_INSERT_ITEM = 0x8B6E;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_MODIFY_ITEM = 0x8B6F;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_REMOVE_ITEM = 0x8B70;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_MOVE_ITEM = 0x8B71;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_DUPLICATE_ITEM = 0x8B72;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALUE_TOO_LARGE = 0x8B73;
+static const StringID STR_TRACE_RESTRICT_ERROR_NO_PROGRAM = 0x8B74;
+static const StringID STR_TRACE_RESTRICT_ERROR_OFFSET_TOO_LARGE = 0x8B75;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_CHANGE_CONDITIONALITY = 0x8B76;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_REMOVE_ENDIF = 0x8B77;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_SHALLOW_REMOVE_IF_ELIF = 0x8B78;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALIDATE_END_CONDSTACK = 0x8B79;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALIDATE_NO_IF = 0x8B7A;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALIDATE_DUP_ELSE = 0x8B7B;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALIDATE_ELIF_NO_IF = 0x8B7C;
+static const StringID STR_TRACE_RESTRICT_ERROR_VALIDATE_UNKNOWN_INSTRUCTION = 0x8B7D;
+static const StringID STR_TRACE_RESTRICT_ERROR_SOURCE_SAME_AS_TARGET = 0x8B7E;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_RESET_SIGNAL = 0x8B7F;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_COPY_PROGRAM = 0x8B80;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_COPY_APPEND_PROGRAM = 0x8B81;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_SHARE_PROGRAM = 0x8B82;
+static const StringID STR_TRACE_RESTRICT_ERROR_CAN_T_UNSHARE_PROGRAM = 0x8B83;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_CREATE = 0x8B84;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_DELETE = 0x8B85;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_RENAME = 0x8B86;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_ADD_VEHICLE = 0x8B87;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_REMOVE_VEHICLE = 0x8B88;
+static const StringID STR_TRACE_RESTRICT_ERROR_SLOT_CAN_T_SET_MAX_OCCUPANCY = 0x8B89;
+static const StringID STR_TRACE_RESTRICT_ERROR_COUNTER_CAN_T_CREATE = 0x8B8A;
+static const StringID STR_TRACE_RESTRICT_ERROR_COUNTER_CAN_T_DELETE = 0x8B8B;
+static const StringID STR_TRACE_RESTRICT_ERROR_COUNTER_CAN_T_RENAME = 0x8B8C;
+static const StringID STR_TRACE_RESTRICT_ERROR_COUNTER_CAN_T_MODIFY = 0x8B8D;
+static const StringID STR_PROGRAM_SIGNAL_TOOLTIP = 0x8B8E;
+static const StringID STR_ERR_PROGSIG_INVALID_INSTRUCTION = 0x8B8F;
+static const StringID STR_ERR_PROGSIG_INVALID_OPCODE = 0x8B90;
+static const StringID STR_ERR_PROGSIG_NOT_THERE = 0x8B91;
+static const StringID STR_ERR_PROGSIG_INVALID_SIGNAL_STATE = 0x8B92;
+static const StringID STR_ERR_PROGSIG_INVALID_CONDITION = 0x8B93;
+static const StringID STR_ERR_PROGSIG_INVALID_CONDITION_FIELD = 0x8B94;
+static const StringID STR_ERR_PROGSIG_INVALID_COMPARATOR = 0x8B95;
+static const StringID STR_ERR_PROGSIG_INVALID_SIGNAL = 0x8B96;
+static const StringID STR_PROGSIG_CAPTION = 0x8B97;
+static const StringID STR_PROGSIG_COND_VARIABLE_TOOLTIP = 0x8B98;
+static const StringID STR_PROGSIG_COND_COMPARATOR_TOOLTIP = 0x8B99;
+static const StringID STR_PROGSIG_COND_VALUE_TOOLTIP = 0x8B9A;
+static const StringID STR_PROGSIG_SIGNAL_STATE_TOOLTIP = 0x8B9B;
+static const StringID STR_PROGSIG_COND_SET_SIGNAL = 0x8B9C;
+static const StringID STR_PROGSIG_COND_SET_SIGNAL_TOOLTIP = 0x8B9D;
+static const StringID STR_PROGSIG_GOTO_SIGNAL = 0x8B9E;
+static const StringID STR_PROGSIG_GOTO_SIGNAL_TOOLTIP = 0x8B9F;
+static const StringID STR_PROGSIG_INSERT_TOOLTIP = 0x8BA0;
+static const StringID STR_PROGSIG_REMOVE_TOOLTIP = 0x8BA1;
+static const StringID STR_PROGSIG_REMOVE_PROGRAM_TOOLTIP = 0x8BA2;
+static const StringID STR_PROGSIG_COPY_PROGRAM_TOOLTIP = 0x8BA3;
+static const StringID STR_PROGSIG_COND_SLOT_TOOLTIP = 0x8BA4;
+static const StringID STR_PROGSIG_COND_COUNTER_TOOLTIP = 0x8BA5;
+static const StringID STR_PROGSIG_REMOVE_PROGRAM = 0x8BA6;
+static const StringID STR_PROGSIG_COPY_PROGRAM = 0x8BA7;
+static const StringID STR_PROGSIG_REMOVE = 0x8BA8;
+static const StringID STR_PROGSIG_INSERT = 0x8BA9;
+static const StringID STR_PROGSIG_INSERT_IF = 0x8BAA;
+static const StringID STR_PROGSIG_INSERT_SET_SIGNAL = 0x8BAB;
+static const StringID STR_PROGSIG_FIRST = 0x8BAC;
+static const StringID STR_PROGSIG_LAST = 0x8BAD;
+static const StringID STR_PROGSIG_IF = 0x8BAE;
+static const StringID STR_PROGSIG_ELSE = 0x8BAF;
+static const StringID STR_PROGSIG_ENDIF = 0x8BB0;
+static const StringID STR_PROGSIG_SET_SIGNAL = 0x8BB1;
+static const StringID STR_PROGSIG_COND_ALWAYS = 0x8BB2;
+static const StringID STR_PROGSIG_COND_NEVER = 0x8BB3;
+static const StringID STR_PROGSIG_COND_COMPARE = 0x8BB4;
+static const StringID STR_PROGSIG_COND_SLOT_COMPARE = 0x8BB5;
+static const StringID STR_PROGSIG_COND_SLOT_COMPARE_INVALID = 0x8BB6;
+static const StringID STR_PROGSIG_COND_SLOT_REMAINING_COMPARE = 0x8BB7;
+static const StringID STR_PROGSIG_COND_SLOT_REMAINING_COMPARE_INVALID = 0x8BB8;
+static const StringID STR_PROGSIG_COND_COUNTER_COMPARE = 0x8BB9;
+static const StringID STR_PROGSIG_COND_COUNTER_COMPARE_INVALID = 0x8BBA;
+static const StringID STR_PROGSIG_COND_SIGNAL_STATE = 0x8BBB;
+static const StringID STR_PROGSIG_COND_SLOT = 0x8BBC;
+static const StringID STR_PROGSIG_COND_SLOT_REMAINING = 0x8BBD;
+static const StringID STR_PROGSIG_COND_COUNTER = 0x8BBE;
+static const StringID STR_PROGSIG_CONDVAR_SIGNAL_STATE_SPECIFIED = 0x8BBF;
+static const StringID STR_PROGSIG_CONDVAR_SIGNAL_STATE_UNSPECIFIED = 0x8BC0;
+static const StringID STR_PROGSIG_CONDVAR_NUM_RED = 0x8BC1;
+static const StringID STR_PROGSIG_CONDVAR_NUM_GREEN = 0x8BC2;
+static const StringID STR_PROGSIG_CONDITION_VALUE_CAPT = 0x8BC3;
+static const StringID STR_ERROR_CAN_T_INSERT_INSTRUCTION = 0x8BC4;
+static const StringID STR_ERROR_CAN_T_MODIFY_INSTRUCTION = 0x8BC5;
+static const StringID STR_ERROR_CAN_T_REMOVE_INSTRUCTION = 0x8BC6;
+static const StringID STR_ERROR_CAN_T_GOTO_UNDEFINED_SIGNAL = 0x8BC7;
+static const StringID STR_ERROR_NOT_AN_EXIT_SIGNAL = 0x8BC8;
+static const StringID STR_ERROR_NOT_AN_PROG_SIGNAL = 0x8BC9;
+static const StringID STR_ERROR_CANNOT_USE_SELF = 0x8BCA;
+static const StringID STR_ERROR_CAN_T_DEPEND_UPON_BIDIRECTIONAL_SIGNALS = 0x8BCB;
+static const StringID STR_ERROR_INVALID_SIGNAL = 0x8BCC;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_CONVERT_ROAD_TO_WAYPOINT = 0x8BCD;
+static const StringID STR_ROAD_TOOLBAR_TOOLTIP_CONVERT_TRAM_TO_WAYPOINT = 0x8BCE;
+static const StringID STR_WATERWAYS_TOOLBAR_CREATE_RIVER_IN_GAME_TOOLTIP = 0x8BCF;
+static const StringID STR_LANDSCAPING_TOOLTIP_RULER_TOOL = 0x8BD0;
+static const StringID STR_HOUSE_BUILD_CAPTION = 0x8BD1;
+static const StringID STR_HOUSE_BUILD_CUSTOM_CAPTION = 0x8BD2;
+static const StringID STR_HOUSE_BUILD_HOUSESET_LIST_TOOLTIP = 0x8BD3;
+static const StringID STR_HOUSE_BUILD_SELECT_HOUSE_TOOLTIP = 0x8BD4;
+static const StringID STR_HOUSE_BUILD_HOUSE_NAME = 0x8BD5;
+static const StringID STR_HOUSE_BUILD_HISTORICAL_BUILDING = 0x8BD6;
+static const StringID STR_HOUSE_BUILD_HOUSE_POPULATION = 0x8BD7;
+static const StringID STR_HOUSE_BUILD_HOUSE_ZONES = 0x8BD8;
+static const StringID STR_HOUSE_BUILD_HOUSE_ZONE_DISABLED = 0x8BD9;
+static const StringID STR_HOUSE_BUILD_HOUSE_ZONE_ENABLED = 0x8BDA;
+static const StringID STR_HOUSE_BUILD_LANDSCAPE = 0x8BDB;
+static const StringID STR_HOUSE_BUILD_LANDSCAPE_ABOVE_OR_BELOW_SNOWLINE = 0x8BDC;
+static const StringID STR_HOUSE_BUILD_LANDSCAPE_ONLY_ABOVE_SNOWLINE = 0x8BDD;
+static const StringID STR_HOUSE_BUILD_LANDSCAPE_ONLY_BELOW_SNOWLINE = 0x8BDE;
+static const StringID STR_HOUSE_BUILD_YEARS = 0x8BDF;
+static const StringID STR_HOUSE_BUILD_YEARS_BAD_YEAR = 0x8BE0;
+static const StringID STR_HOUSE_BUILD_YEARS_GOOD_YEAR = 0x8BE1;
+static const StringID STR_HOUSE_BUILD_SUPPLIED_CARGO = 0x8BE2;
+static const StringID STR_HOUSE_BUILD_ACCEPTED_CARGO = 0x8BE3;
+static const StringID STR_HOUSE_BUILD_CARGO_FIRST = 0x8BE4;
+static const StringID STR_HOUSE_BUILD_CARGO_SEPARATED = 0x8BE5;
+static const StringID STR_HOUSE_BUILD_CARGO_VALUE_JUST_NAME = 0x8BE6;
+static const StringID STR_HOUSE_BUILD_CARGO_VALUE_EIGHTS = 0x8BE7;
+static const StringID STR_BASIC_HOUSE_SET_NAME = 0x8BE8;
+static const StringID STR_SELECT_TOWN_CAPTION = 0x8BE9;
+static const StringID STR_SELECT_TOWN_LIST_ITEM = 0x8BEA;
+static const StringID STR_TREES_REMOVE_TREES_BUTTON = 0x8BEB;
+static const StringID STR_TREES_REMOVE_TREES_TOOLTIP = 0x8BEC;
+static const StringID STR_TERRAFORM_PUBLIC_ROADS = 0x8BED;
+static const StringID STR_TERRAFORM_PUBLIC_ROADS_TOOLTIP = 0x8BEE;
+static const StringID STR_INDUSTRY_CARGOES_NOTIFY_SMALLMAP_ALL = 0x8BEF;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PROGSIGNALS = 0x8BF0;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NOENTRY2SIGNALS = 0x8BF1;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_PROGSIGNALS = 0x8BF2;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NORMAL_NOENTRY2SIGNALS = 0x8BF3;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_PROGSIGNALS = 0x8BF4;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PRE_NOENTRY2SIGNALS = 0x8BF5;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXIT_PROGSIGNALS = 0x8BF6;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_EXIT_NOENTRY2SIGNALS = 0x8BF7;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_COMBO_PROGSIGNALS = 0x8BF8;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_COMBO_NOENTRY2SIGNALS = 0x8BF9;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PBS_NOENTRY2SIGNALS = 0x8BFA;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PBS_PROGSIGNALS = 0x8BFB;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NOENTRY_PROGSIGNALS = 0x8BFC;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_NOENTRY_NOENTRY2SIGNALS = 0x8BFD;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_WITH_PROG_NOENTRY2SIGNALS = 0x8BFE;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_SIGNAL_STYLE = 0x8BFF;
+static const StringID STR_LAI_RAIL_DESCRIPTION_TRACK_SIGNAL_STYLE2 = 0x8C00;
+static const StringID STR_LAI_RAIL_DESCRIPTION_RESTRICTED_SIGNAL = 0x8C01;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_RAILROAD_CHUNNEL = 0x8C02;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_RAILROAD_SIGNAL = 0x8C03;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_RAILROAD_SIGNAL_CHUNNEL = 0x8C04;
+static const StringID STR_LAI_TUNNEL_DESCRIPTION_ROAD_CHUNNEL = 0x8C05;
+static const StringID STR_LAI_BRIDGE_DESCRIPTION_RAILROAD_SIGNAL = 0x8C06;
+static const StringID STR_SAVELOAD_UNKNOWN_ID = 0x8C07;
+static const StringID STR_SAVELOAD_DIFFERENT_ID = 0x8C08;
+static const StringID STR_SAVELOAD_OVERWRITE_TITLE_DIFFERENT_ID = 0x8C09;
+static const StringID STR_SAVELOAD_OVERWRITE_WARNING_DIFFERENT_ID = 0x8C0A;
+static const StringID STR_MAPGEN_SNOW_LINE_HEIGHT = 0x8C0B;
+static const StringID STR_MAPGEN_SNOW_LINE_UP = 0x8C0C;
+static const StringID STR_MAPGEN_SNOW_LINE_DOWN = 0x8C0D;
+static const StringID STR_MAPGEN_RAINFOREST_LINE_HEIGHT = 0x8C0E;
+static const StringID STR_MAPGEN_RAINFOREST_LINE_UP = 0x8C0F;
+static const StringID STR_MAPGEN_RAINFOREST_LINE_DOWN = 0x8C10;
+static const StringID STR_MAPGEN_TOO_MANY_TILES_MESSAGE = 0x8C11;
+static const StringID STR_MAPGEN_SNOW_LINE_QUERY_CAPT = 0x8C12;
+static const StringID STR_MAPGEN_RAINFOREST_LINE_QUERY_CAPT = 0x8C13;
+static const StringID STR_GENERATION_PUBLIC_ROADS_GENERATION = 0x8C14;
+static const StringID STR_NEWGRF_INSPECT_REFRESH = 0x8C15;
+static const StringID STR_NEWGRF_INSPECT_REFRESH_TOOLTIP = 0x8C16;
+static const StringID STR_NEWGRF_INSPECT_LOG_CONSOLE = 0x8C17;
+static const StringID STR_NEWGRF_INSPECT_LOG_CONSOLE_TOOLTIP = 0x8C18;
+static const StringID STR_NEWGRF_INSPECT_DUPLICATE = 0x8C19;
+static const StringID STR_NEWGRF_INSPECT_DUPLICATE_TOOLTIP = 0x8C1A;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP = 0x8C1B;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_TOOLTIP = 0x8C1C;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_UNOPT = 0x8C1D;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_UNOPT_TOOLTIP = 0x8C1E;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_GOTO = 0x8C1F;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_GOTO_TOOLTIP = 0x8C20;
+static const StringID STR_NEWGRF_INSPECT_SPRITE_DUMP_PANEL_TOOLTIP = 0x8C21;
+static const StringID STR_NEWGRF_INSPECT_CAPTION_OBJECT_AT_ROAD_TYPE = 0x8C22;
+static const StringID STR_NEWGRF_INSPECT_CAPTION_OBJECT_AT_SIGNALS = 0x8C23;
+static const StringID STR_NEWGRF_ERROR_UNIMPLEMETED_MAPPED_FEATURE_ID = 0x8C24;
+static const StringID STR_NEWGRF_ERROR_UNIMPLEMETED_MAPPED_PROPERTY = 0x8C25;
+static const StringID STR_NEWGRF_ERROR_UNIMPLEMETED_MAPPED_ACTION5_TYPE = 0x8C26;
+static const StringID STR_NEWGRF_TOO_MANY_STRINGS = 0x8C27;
+static const StringID STR_NEWGRF_TOO_MANY_STRINGS_DETAIL = 0x8C28;
+static const StringID STR_TOWN_VIEW_NOISE_IN_TOWN_NO_LIMIT = 0x8C29;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_ALLOW_ROADS = 0x8C2A;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_ALLOW_LEVEL_CROSSINGS = 0x8C2B;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_TUNNELS = 0x8C2C;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_MAX_ROAD_SLOPE = 0x8C2D;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_TOWN_GROWTH = 0x8C2E;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_BRIDGES = 0x8C2F;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_DEFAULT = 0x8C30;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_STR = 0x8C31;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_TEXT = 0x8C32;
+static const StringID STR_LOCAL_AUTHORITY_SETTING_OVERRIDE_TOOLTIP = 0x8C33;
+static const StringID STR_STATION_VIEW_DEPARTURES_BUTTON = 0x8C34;
+static const StringID STR_STATION_VIEW_DEPARTURES_TOOLTIP = 0x8C35;
+static const StringID STR_STATION_VIEW_HISTORY_BUTTON = 0x8C36;
+static const StringID STR_STATION_VIEW_HISTORY_TOOLTIP = 0x8C37;
+static const StringID STR_DEPARTURES_CAPTION = 0x8C38;
+static const StringID STR_DEPARTURES_CAPTION_WAYPOINT = 0x8C39;
+static const StringID STR_DEPARTURES_PAX = 0x8C3A;
+static const StringID STR_DEPARTURES_FREIGHT = 0x8C3B;
+static const StringID STR_DEPARTURES_DEPARTURES = 0x8C3C;
+static const StringID STR_DEPARTURES_ARRIVALS = 0x8C3D;
+static const StringID STR_DEPARTURES_VIA_BUTTON = 0x8C3E;
+static const StringID STR_DEPARTURES_PAX_TOOLTIP = 0x8C3F;
+static const StringID STR_DEPARTURES_FREIGHT_TOOLTIP = 0x8C40;
+static const StringID STR_DEPARTURES_DEPARTURES_TOOLTIP = 0x8C41;
+static const StringID STR_DEPARTURES_ARRIVALS_TOOLTIP = 0x8C42;
+static const StringID STR_DEPARTURES_VIA_TOOLTIP = 0x8C43;
+static const StringID STR_DEPARTURES_SHOW_TRAINS_TOOLTIP = 0x8C44;
+static const StringID STR_DEPARTURES_SHOW_ROAD_VEHICLES_TOOLTIP = 0x8C45;
+static const StringID STR_DEPARTURES_SHOW_SHIPS_TOOLTIP = 0x8C46;
+static const StringID STR_DEPARTURES_SHOW_AIRCRAFT_TOOLTIP = 0x8C47;
+static const StringID STR_DEPARTURES_SHOW_TYPE_TOOLTIP_CTRL_SUFFIX = 0x8C48;
+static const StringID STR_DEPARTURES_EMPTY = 0x8C49;
+static const StringID STR_DEPARTURES_NONE_SELECTED = 0x8C4A;
+static const StringID STR_DEPARTURES_TIME = 0x8C4B;
+static const StringID STR_DEPARTURES_TIME_DEP = 0x8C4C;
+static const StringID STR_DEPARTURES_TIME_ARR = 0x8C4D;
+static const StringID STR_DEPARTURES_TIME_BOTH = 0x8C4E;
+static const StringID STR_DEPARTURES_TERMINUS = 0x8C4F;
+static const StringID STR_DEPARTURES_TERMINUS_VIA_STATION = 0x8C50;
+static const StringID STR_DEPARTURES_TERMINUS_VIA = 0x8C51;
+static const StringID STR_DEPARTURES_VIA = 0x8C52;
+static const StringID STR_DEPARTURES_TOC = 0x8C53;
+static const StringID STR_DEPARTURES_GROUP = 0x8C54;
+static const StringID STR_DEPARTURES_VEH = 0x8C55;
+static const StringID STR_DEPARTURES_CALLING_AT = 0x8C56;
+static const StringID STR_DEPARTURES_CALLING_AT_FIRST_STATION = 0x8C57;
+static const StringID STR_DEPARTURES_CALLING_AT_STATION = 0x8C58;
+static const StringID STR_DEPARTURES_CALLING_AT_LAST_STATION = 0x8C59;
+static const StringID STR_DEPARTURES_CALLING_AT_LIST = 0x8C5A;
+static const StringID STR_DEPARTURES_CALLING_AT_LIST_SMART_TERMINUS = 0x8C5B;
+static const StringID STR_DEPARTURES_TINY = 0x8C5C;
+static const StringID STR_DEPARTURES_VIA_DESCRIPTOR = 0x8C5D;
+static const StringID STR_DEPARTURES_VIA_AND = 0x8C5E;
+static const StringID STR_DEPARTURES_TYPE_TRAIN = 0x8C5F;
+static const StringID STR_DEPARTURES_TYPE_TRAIN_SILVER = 0x8C60;
+static const StringID STR_DEPARTURES_TYPE_BUS = 0x8C61;
+static const StringID STR_DEPARTURES_TYPE_BUS_SILVER = 0x8C62;
+static const StringID STR_DEPARTURES_TYPE_LORRY = 0x8C63;
+static const StringID STR_DEPARTURES_TYPE_LORRY_SILVER = 0x8C64;
+static const StringID STR_DEPARTURES_TYPE_PLANE = 0x8C65;
+static const StringID STR_DEPARTURES_TYPE_PLANE_SILVER = 0x8C66;
+static const StringID STR_DEPARTURES_TYPE_SHIP = 0x8C67;
+static const StringID STR_DEPARTURES_TYPE_SHIP_SILVER = 0x8C68;
+static const StringID STR_DEPARTURES_STATION_NONE = 0x8C69;
+static const StringID STR_DEPARTURES_STATION_PORT = 0x8C6A;
+static const StringID STR_DEPARTURES_STATION_AIRPORT = 0x8C6B;
+static const StringID STR_DEPARTURES_STATION_PORTAIRPORT = 0x8C6C;
+static const StringID STR_DEPARTURES_ON_TIME = 0x8C6D;
+static const StringID STR_DEPARTURES_ARRIVED = 0x8C6E;
+static const StringID STR_DEPARTURES_DELAYED = 0x8C6F;
+static const StringID STR_DEPARTURES_EXPECTED = 0x8C70;
+static const StringID STR_DEPARTURES_CANCELLED = 0x8C71;
+static const StringID STR_CONFIG_SETTING_DEPARTUREBOARDS = 0x8C72;
+static const StringID STR_CONFIG_MAX_DEPARTURES = 0x8C73;
+static const StringID STR_CONFIG_MAX_DEPARTURES_HELPTEXT = 0x8C74;
+static const StringID STR_CONFIG_MAX_DEPARTURE_TIME = 0x8C75;
+static const StringID STR_CONFIG_MAX_DEPARTURE_TIME_HELPTEXT = 0x8C76;
+static const StringID STR_CONFIG_DEPARTURE_CALC_FREQUENCY = 0x8C77;
+static const StringID STR_CONFIG_DEPARTURE_CALC_FREQUENCY_HELPTEXT = 0x8C78;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_NAME = 0x8C79;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_NAME_HELPTEXT = 0x8C7A;
+static const StringID STR_CONFIG_DEPARTURE_GROUP_NAME = 0x8C7B;
+static const StringID STR_CONFIG_DEPARTURE_GROUP_NAME_HELPTEXT = 0x8C7C;
+static const StringID STR_CONFIG_DEPARTURE_COMPANY_NAME = 0x8C7D;
+static const StringID STR_CONFIG_DEPARTURE_COMPANY_NAME_HELPTEXT = 0x8C7E;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_TYPE = 0x8C7F;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_TYPE_HELPTEXT = 0x8C80;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_COLOR = 0x8C81;
+static const StringID STR_CONFIG_DEPARTURE_VEHICLE_COLOR_HELPTEXT = 0x8C82;
+static const StringID STR_CONFIG_DEPARTURE_LARGER_FONT = 0x8C83;
+static const StringID STR_CONFIG_DEPARTURE_LARGER_FONT_HELPTEXT = 0x8C84;
+static const StringID STR_CONFIG_DEPARTURE_DESTINATION_TYPE = 0x8C85;
+static const StringID STR_CONFIG_DEPARTURE_DESTINATION_TYPE_HELPTEXT = 0x8C86;
+static const StringID STR_CONFIG_DEPARTURE_SHOW_BOTH = 0x8C87;
+static const StringID STR_CONFIG_DEPARTURE_SHOW_BOTH_HELPTEXT = 0x8C88;
+static const StringID STR_CONFIG_DEPARTURE_ONLY_PASSENGERS = 0x8C89;
+static const StringID STR_CONFIG_DEPARTURE_ONLY_PASSENGERS_HELPTEXT = 0x8C8A;
+static const StringID STR_CONFIG_DEPARTURE_SMART_TERMINUS = 0x8C8B;
+static const StringID STR_CONFIG_DEPARTURE_SMART_TERMINUS_HELPTEXT = 0x8C8C;
+static const StringID STR_CONFIG_DEPARTURE_CONDITIONALS = 0x8C8D;
+static const StringID STR_CONFIG_DEPARTURE_CONDITIONALS_HELPTEXT = 0x8C8E;
+static const StringID STR_CONFIG_DEPARTURE_CONDITIONALS_1 = 0x8C8F;
+static const StringID STR_CONFIG_DEPARTURE_CONDITIONALS_2 = 0x8C90;
+static const StringID STR_CONFIG_DEPARTURE_CONDITIONALS_3 = 0x8C91;
+static const StringID STR_CONFIG_DEPARTURE_SHOW_ALL_STOPS = 0x8C92;
+static const StringID STR_CONFIG_DEPARTURE_SHOW_ALL_STOPS_HELPTEXT = 0x8C93;
+static const StringID STR_CONFIG_DEPARTURE_MERGE_IDENTICAL = 0x8C94;
+static const StringID STR_CONFIG_DEPARTURE_MERGE_IDENTICAL_HELPTEXT = 0x8C95;
+static const StringID STR_WAYPOINT_VIEW_HIDE_VIEWPORT_LABEL = 0x8C96;
+static const StringID STR_FINANCES_BORROW_TOOLTIP_EXTRA = 0x8C97;
+static const StringID STR_FINANCES_REPAY_TOOLTIP_EXTRA = 0x8C98;
+static const StringID STR_FINANCES_BORROW_QUERY_CAPT = 0x8C99;
+static const StringID STR_FINANCES_REPAY_QUERY_CAPT = 0x8C9A;
+static const StringID STR_INDUSTRY_VIEW_TRANSPORTED_TOOLTIP = 0x8C9B;
+static const StringID STR_INDUSTRY_VIEW_TRANSPORTED_TOOLTIP_EXTENSION = 0x8C9C;
+static const StringID STR_TOWN_NAME_TOOLTIP = 0x8C9D;
+static const StringID STR_VEHICLE_LIST_AGE = 0x8C9E;
+static const StringID STR_VEHICLE_LIST_AGE_RED = 0x8C9F;
+static const StringID STR_VEHICLE_LIST_CARGO_LIST = 0x8CA0;
+static const StringID STR_VEHICLE_LIST_RELIABILITY = 0x8CA1;
+static const StringID STR_VEHICLE_LIST_RELIABILITY_RED = 0x8CA2;
+static const StringID STR_VEHICLE_LIST_MAX_SPEED = 0x8CA3;
+static const StringID STR_VEHICLE_LIST_ENGINE_BUILT = 0x8CA4;
+static const StringID STR_VEHICLE_LIST_VALUE = 0x8CA5;
+static const StringID STR_VEHICLE_LIST_LENGTH = 0x8CA6;
+static const StringID STR_VEHICLE_LIST_TIME_TO_LIVE = 0x8CA7;
+static const StringID STR_VEHICLE_LIST_TIME_TO_LIVE_RED = 0x8CA8;
+static const StringID STR_VEHICLE_LIST_TIME_TO_LIVE_OVERDUE = 0x8CA9;
+static const StringID STR_VEHICLE_LIST_TIMETABLE_DELAY_LATE = 0x8CAA;
+static const StringID STR_VEHICLE_LIST_TIMETABLE_DELAY_EARLY = 0x8CAB;
+static const StringID STR_VEHICLE_LIST_TIMETABLE_DELAY_ON_TIME = 0x8CAC;
+static const StringID STR_VEHICLE_LIST_ORDER_OCCUPANCY_AVERAGE = 0x8CAD;
+static const StringID STR_VEHICLE_LIST_PROFIT_THIS_YEAR_LAST_YEAR_LIFETIME = 0x8CAE;
+static const StringID STR_VEHICLE_LIST_CANCEL_DEPOT_SERVICE = 0x8CAF;
+static const StringID STR_VEHICLE_LIST_SEND_TRAIN_TO_DEPOT_SELL = 0x8CB0;
+static const StringID STR_VEHICLE_LIST_SEND_ROAD_VEHICLE_TO_DEPOT_SELL = 0x8CB1;
+static const StringID STR_VEHICLE_LIST_SEND_SHIP_TO_DEPOT_SELL = 0x8CB2;
+static const StringID STR_VEHICLE_LIST_SEND_AIRCRAFT_TO_HANGAR_SELL = 0x8CB3;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_STATION = 0x8CB4;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_WAYPOINT = 0x8CB5;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_TRAIN_DEPOT = 0x8CB6;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_ROAD_VEHICLE_DEPOT = 0x8CB7;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_SHIP_DEPOT = 0x8CB8;
+static const StringID STR_VEHICLE_LIST_CHANGE_ORDER_AIRCRAFT_HANGAR = 0x8CB9;
+static const StringID STR_VEHICLE_LIST_CREATE_GROUP = 0x8CBA;
+static const StringID STR_GROUP_EXPAND_ALL = 0x8CBB;
+static const StringID STR_GROUP_COLLAPSE_ALL = 0x8CBC;
+static const StringID STR_BUY_VEHICLE_TRAIN_LOCOMOTIVES = 0x8CBD;
+static const StringID STR_BUY_VEHICLE_TRAIN_WAGONS = 0x8CBE;
+static const StringID STR_PURCHASE_INFO_DESIGNED = 0x8CBF;
+static const StringID STR_BUY_REFIT_VEHICLE_BUY_VEHICLE_BUTTON = 0x8CC0;
+static const StringID STR_BUY_REFIT_VEHICLE_BUY_VEHICLE_TOOLTIP = 0x8CC1;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_LOCOMOTIVE_BUTTON = 0x8CC2;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_WAGON_BUTTON = 0x8CC3;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_LOCOMOTIVE_BUTTON = 0x8CC4;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_WAGON_BUTTON = 0x8CC5;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_LOCOMOTIVE_TOOLTIP = 0x8CC6;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_WAGON_TOOLTIP = 0x8CC7;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_LOCOMOTIVE_TOOLTIP = 0x8CC8;
+static const StringID STR_BUY_VEHICLE_TRAIN_BUY_REFIT_WAGON_TOOLTIP = 0x8CC9;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_LOCOMOTIVE_BUTTON = 0x8CCA;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_WAGON_BUTTON = 0x8CCB;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_LOCOMOTIVE_TOOLTIP = 0x8CCC;
+static const StringID STR_BUY_VEHICLE_TRAIN_RENAME_WAGON_TOOLTIP = 0x8CCD;
+static const StringID STR_QUERY_RENAME_TRAIN_TYPE_LOCOMOTIVE_CAPTION = 0x8CCE;
+static const StringID STR_QUERY_RENAME_TRAIN_TYPE_WAGON_CAPTION = 0x8CCF;
+static const StringID STR_VEHICLE_VIEW_SEND_TO_DEPOT_TOOLTIP_SHIFT = 0x8CD0;
+static const StringID STR_VEHICLE_VIEW_SEND_TO_DEPOT_MENU = 0x8CD1;
+static const StringID STR_VEHICLE_VIEW_TRAIN_CENTER_TOOLTIP_EXTRA = 0x8CD2;
+static const StringID STR_VEHICLE_STATUS_LOADING_UNLOADING_ADVANCE = 0x8CD3;
+static const StringID STR_VEHICLE_STATUS_BROKEN_DOWN_VEL = 0x8CD4;
+static const StringID STR_VEHICLE_STATUS_BROKEN_DOWN_VEL_SHORT = 0x8CD5;
+static const StringID STR_VEHICLE_STATUS_TRAIN_STUCK_WAIT_RESTRICTION = 0x8CD6;
+static const StringID STR_VEHICLE_STATUS_TRAIN_WAITING_TIMETABLE = 0x8CD7;
+static const StringID STR_VEHICLE_STATUS_TRAIN_REVERSING = 0x8CD8;
+static const StringID STR_VEHICLE_STATUS_TRAIN_MOVING_DEPOT = 0x8CD9;
+static const StringID STR_BREAKDOWN_TYPE_CRITICAL = 0x8CDA;
+static const StringID STR_BREAKDOWN_TYPE_EM_STOP = 0x8CDB;
+static const StringID STR_BREAKDOWN_TYPE_LOW_SPEED = 0x8CDC;
+static const StringID STR_BREAKDOWN_TYPE_LOW_POWER = 0x8CDD;
+static const StringID STR_BREAKDOWN_TYPE_HIT_RV = 0x8CDE;
+static const StringID STR_BREAKDOWN_TYPE_BRAKES_OVERHEATED = 0x8CDF;
+static const StringID STR_BREAKDOWN_TYPE_DEPOT = 0x8CE0;
+static const StringID STR_BREAKDOWN_TYPE_LANDING = 0x8CE1;
+static const StringID STR_ERROR_TRAIN_TOO_HEAVY = 0x8CE2;
+static const StringID STR_VEHICLE_STATUS_HEADING_FOR_DEPOT_SELL_VEL = 0x8CE3;
+static const StringID STR_VEHICLE_LOAD_THROUGH_ABORTED_INSUFFICIENT_TRACK = 0x8CE4;
+static const StringID STR_VEHICLE_LOAD_THROUGH_ABORTED_DEPOT = 0x8CE5;
+static const StringID STR_RUNNING = 0x8CE6;
+static const StringID STR_NEED_REPAIR = 0x8CE7;
+static const StringID STR_CURRENT_STATUS = 0x8CE8;
+static const StringID STR_VEHICLE_INFO_TRAIN_LENGTH = 0x8CE9;
+static const StringID STR_VEHICLE_INFO_WEIGHT_RATIOS = 0x8CEA;
+static const StringID STR_VEHICLE_INFO_POWER_WEIGHT_RATIO = 0x8CEB;
+static const StringID STR_VEHICLE_INFO_TE_WEIGHT_RATIO = 0x8CEC;
+static const StringID STR_VEHICLE_INFO_FULL_WEIGHT_WITH_RATIOS = 0x8CED;
+static const StringID STR_VEHICLE_INFO_MAX_SPEED_LOADED = 0x8CEE;
+static const StringID STR_VEHICLE_INFO_PROFIT_THIS_YEAR_LAST_YEAR_LIFETIME = 0x8CEF;
+static const StringID STR_VEHICLE_INFO_GROUP = 0x8CF0;
+static const StringID STR_VEHICLE_AUTO_GROUP_ROUTE = 0x8CF1;
+static const StringID STR_VEHICLE_AUTO_GROUP_LOCAL_ROUTE = 0x8CF2;
+static const StringID STR_VEHICLE_AUTO_GROUP_CARGO_LIST = 0x8CF3;
+static const StringID STR_VEHICLE_INFO_SPEED_RESTRICTION = 0x8CF4;
+static const StringID STR_VEHICLE_INFO_SPEED_ADAPTATION_EXEMPT = 0x8CF5;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_ENGINE_BUILT_AND_VALUE_AND_SPEED = 0x8CF6;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_WAGON_VALUE_AND_SPEED = 0x8CF7;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_TOTAL_WEIGHT = 0x8CF8;
+static const StringID STR_VEHICLE_DETAILS_TRAIN_MAX_SPEED = 0x8CF9;
+static const StringID STR_ORDERS_TOGGLE_MANAGEMENT_BUTTON_TOOLTIP = 0x8CFA;
+static const StringID STR_ORDER_DROP_CARGO_TYPE_LOAD = 0x8CFB;
+static const StringID STR_ORDER_DROP_CARGO_TYPE_UNLOAD = 0x8CFC;
+static const StringID STR_ORDER_REVERSE = 0x8CFD;
+static const StringID STR_ORDER_REVERSE_TOOLTIP = 0x8CFE;
+static const StringID STR_ORDER_DROP_SELL_DEPOT = 0x8CFF;
+static const StringID STR_ORDER_CONDITIONAL_VEHICLE_IN_SLOT = 0x8D00;
+static const StringID STR_ORDER_CONDITIONAL_REQUIRES_SERVICE_ORDER = 0x8D01;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING_ORDER = 0x8D02;
+static const StringID STR_ORDER_CONDITIONAL_ACCEPTANCE = 0x8D03;
+static const StringID STR_CONDITIONAL_FREE_PLATFORMS = 0x8D04;
+static const StringID STR_CONDITIONAL_PERCENT = 0x8D05;
+static const StringID STR_ORDER_CONDITIONAL_NEXT_STATION = 0x8D06;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_TOOLTIP = 0x8D07;
+static const StringID STR_ORDER_CONDITIONAL_SLOT_TOOLTIP = 0x8D08;
+static const StringID STR_ORDER_CONDITIONAL_COUNTER_TOOLTIP = 0x8D09;
+static const StringID STR_ORDER_CONDITIONAL_TIME_DATE_TOOLTIP = 0x8D0A;
+static const StringID STR_ORDER_CONDITIONAL_TIMETABLE_TOOLTIP = 0x8D0B;
+static const StringID STR_ORDER_CONDITIONAL_SCHED_SELECT_TOOLTIP = 0x8D0C;
+static const StringID STR_ORDER_CONDITIONAL_SCHED_TEST_TOOLTIP = 0x8D0D;
+static const StringID STR_ORDER_CONDITIONAL_VIA = 0x8D0E;
+static const StringID STR_ORDER_CONDITIONAL_VIA_TOOLTIP = 0x8D0F;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_ACCEPTS = 0x8D10;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_DOES_NOT_ACCEPT = 0x8D11;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS = 0x8D12;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS_NO = 0x8D13;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS_LESS_THAN = 0x8D14;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS_LESS_EQUALS = 0x8D15;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS_MORE_THAN = 0x8D16;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_HAS_MORE_EQUALS = 0x8D17;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_FULLY_OCCUPIED = 0x8D18;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_NOT_YET_FULLY_OCCUPIED = 0x8D19;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_TRAIN_IN_SLOT = 0x8D1A;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_TRAIN_NOT_IN_SLOT = 0x8D1B;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_TRAIN_IN_ACQUIRE_SLOT = 0x8D1C;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_TRAIN_NOT_IN_ACQUIRE_SLOT = 0x8D1D;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_VEHICLE_IN_SLOT = 0x8D1E;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_VEHICLE_NOT_IN_SLOT = 0x8D1F;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_VEHICLE_IN_ACQUIRE_SLOT = 0x8D20;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_VEHICLE_NOT_IN_ACQUIRE_SLOT = 0x8D21;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_DISPATCH_SLOT_IS_FIRST = 0x8D22;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_DISPATCH_SLOT_IS_NOT_FIRST = 0x8D23;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_DISPATCH_SLOT_IS_LAST = 0x8D24;
+static const StringID STR_ORDER_CONDITIONAL_COMPARATOR_DISPATCH_SLOT_IS_NOT_LAST = 0x8D25;
+static const StringID STR_ORDERS_MANAGE_LIST = 0x8D26;
+static const StringID STR_ORDERS_MANAGE_LIST_TOOLTIP = 0x8D27;
+static const StringID STR_ORDERS_MANAGE_ORDER = 0x8D28;
+static const StringID STR_ORDERS_MANAGE_ORDER_TOOLTIP = 0x8D29;
+static const StringID STR_ORDER_REVERSE_ORDER_LIST = 0x8D2A;
+static const StringID STR_ORDER_APPEND_REVERSED_ORDER_LIST = 0x8D2B;
+static const StringID STR_ORDER_DUPLICATE_ORDER = 0x8D2C;
+static const StringID STR_ORDER_CHANGE_JUMP_TARGET = 0x8D2D;
+static const StringID STR_ORDER_RELEASE_SLOT_BUTTON = 0x8D2E;
+static const StringID STR_ORDER_CHANGE_COUNTER_BUTTON = 0x8D2F;
+static const StringID STR_ORDER_RELEASE_SLOT_TOOLTIP = 0x8D30;
+static const StringID STR_ORDER_CHANGE_COUNTER_TOOLTIP = 0x8D31;
+static const StringID STR_ORDER_LABEL_TEXT = 0x8D32;
+static const StringID STR_ORDER_LABEL_TEXT_CAPTION = 0x8D33;
+static const StringID STR_ORDER_LABEL_TEXT_BUTTON = 0x8D34;
+static const StringID STR_ORDER_LABEL_TEXT_BUTTON_TOOLTIP = 0x8D35;
+static const StringID STR_ORDER_LABEL_DEPARTURES_VIA_BUTTON = 0x8D36;
+static const StringID STR_ORDER_LABEL_DEPARTURES_VIA = 0x8D37;
+static const StringID STR_ORDER_LABEL_DEPARTURES_SHOW_AS_VIA = 0x8D38;
+static const StringID STR_ORDER_LABEL_DEPARTURES_REMOVE_VIA = 0x8D39;
+static const StringID STR_ORDER_LABEL_DEPARTURES_REMOVE_VIA_SHORT = 0x8D3A;
+static const StringID STR_ORDER_LABEL_DEPARTURES_VIA_TYPE_TOOLTIP = 0x8D3B;
+static const StringID STR_ORDERS_OCCUPANCY_BUTTON = 0x8D3C;
+static const StringID STR_ORDERS_OCCUPANCY_BUTTON_TOOLTIP = 0x8D3D;
+static const StringID STR_ORDERS_OCCUPANCY_LIST_TOOLTIP = 0x8D3E;
+static const StringID STR_ORDERS_OCCUPANCY_PERCENT = 0x8D3F;
+static const StringID STR_ORDERS_NEW_GROUP_TOOLTIP = 0x8D40;
+static const StringID STR_ORDER_GO_TO_WAYPOINT_REVERSE = 0x8D41;
+static const StringID STR_ORDER_GO_NON_STOP_TO_WAYPOINT_REVERSE = 0x8D42;
+static const StringID STR_ORDER_SELL_ORDER = 0x8D43;
+static const StringID STR_ORDER_CARGO_TYPE_LOAD = 0x8D44;
+static const StringID STR_ORDER_UNLOAD_CARGO_TYPE_LOAD = 0x8D45;
+static const StringID STR_ORDER_TRANSFER_CARGO_TYPE_LOAD = 0x8D46;
+static const StringID STR_ORDER_NO_UNLOAD_CARGO_TYPE_LOAD = 0x8D47;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD = 0x8D48;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_FULL_LOAD = 0x8D49;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_FULL_LOAD_ANY = 0x8D4A;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_NO_LOAD = 0x8D4B;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_CARGO_TYPE_LOAD = 0x8D4C;
+static const StringID STR_ORDER_CARGO_TYPE_LOAD_REFIT = 0x8D4D;
+static const StringID STR_ORDER_UNLOAD_CARGO_TYPE_LOAD_REFIT = 0x8D4E;
+static const StringID STR_ORDER_TRANSFER_CARGO_TYPE_LOAD_REFIT = 0x8D4F;
+static const StringID STR_ORDER_NO_UNLOAD_CARGO_TYPE_LOAD_REFIT = 0x8D50;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_REFIT = 0x8D51;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_FULL_LOAD_REFIT = 0x8D52;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_FULL_LOAD_ANY_REFIT = 0x8D53;
+static const StringID STR_ORDER_CARGO_TYPE_UNLOAD_CARGO_TYPE_LOAD_REFIT = 0x8D54;
+static const StringID STR_ORDER_RV_DIR_NE = 0x8D55;
+static const StringID STR_ORDER_RV_DIR_SE = 0x8D56;
+static const StringID STR_ORDER_RV_DIR_SW = 0x8D57;
+static const StringID STR_ORDER_RV_DIR_NW = 0x8D58;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_ACCEPTANCE = 0x8D59;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING_DISPLAY = 0x8D5A;
+static const StringID STR_ORDER_CONDITIONAL_SLOT = 0x8D5B;
+static const StringID STR_ORDER_CONDITIONAL_INVALID_SLOT = 0x8D5C;
+static const StringID STR_ORDER_CONDITIONAL_IN_SLOT = 0x8D5D;
+static const StringID STR_ORDER_CONDITIONAL_IN_INVALID_SLOT = 0x8D5E;
+static const StringID STR_ORDER_CONDITIONAL_LOAD_PERCENTAGE_DISPLAY = 0x8D5F;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING_AMOUNT_DISPLAY = 0x8D60;
+static const StringID STR_ORDER_CONDITIONAL_CARGO_WAITING_AMOUNT_VIA_DISPLAY = 0x8D61;
+static const StringID STR_ORDER_CONDITIONAL_COUNTER = 0x8D62;
+static const StringID STR_ORDER_CONDITIONAL_INVALID_COUNTER = 0x8D63;
+static const StringID STR_ORDER_CONDITIONAL_TIME_HHMM = 0x8D64;
+static const StringID STR_ORDER_CONDITIONAL_TIMETABLE = 0x8D65;
+static const StringID STR_ORDER_CONDITIONAL_DISPATCH_SLOT_DISPLAY = 0x8D66;
+static const StringID STR_ORDER_RELEASE_SLOT = 0x8D67;
+static const StringID STR_TIMETABLE_MINUTES = 0x8D68;
+static const StringID STR_TIMETABLE_HOURS = 0x8D69;
+static const StringID STR_TIMETABLE_HOURS_MINUTES = 0x8D6A;
+static const StringID STR_TIMETABLE_MINUTES_SUFFIX = 0x8D6B;
+static const StringID STR_TIMETABLE_LEFTOVER_TICKS = 0x8D6C;
+static const StringID STR_TIMETABLE_AUTOMATE = 0x8D6D;
+static const StringID STR_TIMETABLE_AUTOMATE_TOOLTIP = 0x8D6E;
+static const StringID STR_TIMETABLE_AUTO_SEPARATION = 0x8D6F;
+static const StringID STR_TIMETABLE_AUTO_SEPARATION_TOOLTIP = 0x8D70;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH = 0x8D71;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH_TOOLTIP = 0x8D72;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH_ORDER = 0x8D73;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH_ORDER_NO_WAIT_TIME = 0x8D74;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH_ORDER_SCHEDULE_INDEX = 0x8D75;
+static const StringID STR_TIMETABLE_SCHEDULED_DISPATCH_ORDER_NAMED_SCHEDULE = 0x8D76;
+static const StringID STR_TIMETABLE_LOCK_ORDER_TIME_TOOLTIP = 0x8D77;
+static const StringID STR_TIMETABLE_LEAVE_EARLY_ORDER = 0x8D78;
+static const StringID STR_TIMETABLE_LEAVE_EARLY_ORDER_FULL_ANY = 0x8D79;
+static const StringID STR_TIMETABLE_LEAVE_EARLY_ORDER_FULL_ALL = 0x8D7A;
+static const StringID STR_TIMETABLE_LEAVE_NORMAL = 0x8D7B;
+static const StringID STR_TIMETABLE_LEAVE_EARLY = 0x8D7C;
+static const StringID STR_TIMETABLE_LEAVE_EARLY_FULL_ANY = 0x8D7D;
+static const StringID STR_TIMETABLE_LEAVE_EARLY_FULL_ALL = 0x8D7E;
+static const StringID STR_TIMETABLE_EXTRA_DROP_DOWN = 0x8D7F;
+static const StringID STR_TIMETABLE_EXTRA_DROP_DOWN_TOOLTIP = 0x8D80;
+static const StringID STR_TIMETABLE_ASSIGN_SCHEDULE_DROP_DOWN = 0x8D81;
+static const StringID STR_TIMETABLE_ASSIGN_SCHEDULE_DROP_DOWN_TOOLTIP = 0x8D82;
+static const StringID STR_TIMETABLE_ASSIGN_SCHEDULE_NONE = 0x8D83;
+static const StringID STR_TIMETABLE_ASSIGN_SCHEDULE_ID = 0x8D84;
+static const StringID STR_TIMETABLE_AUTOSEP_TIMETABLE_INCOMPLETE = 0x8D85;
+static const StringID STR_TIMETABLE_AUTOSEP_OK = 0x8D86;
+static const StringID STR_TIMETABLE_AUTOSEP_SINGLE_VEH = 0x8D87;
+static const StringID STR_TIMETABLE_WARNING_AUTOSEP_CONDITIONAL = 0x8D88;
+static const StringID STR_TIMETABLE_WARNING_AUTOSEP_MISSING_TIMINGS = 0x8D89;
+static const StringID STR_TIMETABLE_WARNING_FULL_LOAD = 0x8D8A;
+static const StringID STR_TIMETABLE_WARNING_AUTOFILL_CONDITIONAL = 0x8D8B;
+static const StringID STR_TIMETABLE_NON_TIMETABLED_BRANCH = 0x8D8C;
+static const StringID STR_TIMETABLE_WARNING_NO_SCHEDULED_DISPATCH_ORDER_ASSIGNED = 0x8D8D;
+static const StringID STR_TIMETABLE_WARNING_SCHEDULED_DISPATCH_ORDER_NO_WAIT_TIME = 0x8D8E;
+static const StringID STR_TIMETABLE_WARNING_SCHEDULE_ID = 0x8D8F;
+static const StringID STR_TIMETABLE_FILL_TIMETABLE_SUGGESTION = 0x8D90;
+static const StringID STR_TIMETABLE_FILL_TIMETABLE_SUGGESTION_2 = 0x8D91;
+static const StringID STR_TIMETABLE_WARNINGS_OMITTED = 0x8D92;
+static const StringID STR_DATE_MINUTES_MINUTE_TOOLTIP = 0x8D93;
+static const StringID STR_DATE_MINUTES_HOUR_TOOLTIP = 0x8D94;
+static const StringID STR_TIME_CAPTION = 0x8D95;
+static const StringID STR_CARGO_TYPE_ORDERS_LOAD_CAPTION = 0x8D96;
+static const StringID STR_CARGO_TYPE_ORDERS_UNLOAD_CAPTION = 0x8D97;
+static const StringID STR_CARGO_TYPE_ORDERS_LOAD_TITLE = 0x8D98;
+static const StringID STR_CARGO_TYPE_ORDERS_UNLOAD_TITLE = 0x8D99;
+static const StringID STR_CARGO_TYPE_ORDERS_CLOSE_BUTTON = 0x8D9A;
+static const StringID STR_CARGO_TYPE_ORDERS_DROP_FULL_LOAD = 0x8D9B;
+static const StringID STR_CARGO_TYPE_LOAD_ORDERS_DROP_TOOLTIP = 0x8D9C;
+static const StringID STR_CARGO_TYPE_UNLOAD_ORDERS_DROP_TOOLTIP = 0x8D9D;
+static const StringID STR_CARGO_TYPE_ORDERS_SET_TO_ALL_LABEL = 0x8D9E;
+static const StringID STR_CARGO_TYPE_ORDERS_SET_TO_ALL_TOOLTIP = 0x8D9F;
+static const StringID STR_SCREENSHOT_WORLD_SCREENSHOT_DEFAULT_ZOOM = 0x8DA0;
+static const StringID STR_SCREENSHOT_WORLD_SCREENSHOT_CURRENT_ZOOM = 0x8DA1;
+static const StringID STR_SCREENSHOT_TOPOGRAPHY_SCREENSHOT = 0x8DA2;
+static const StringID STR_SCREENSHOT_INDUSTRY_SCREENSHOT = 0x8DA3;
+static const StringID STR_PLANS_CAPTION = 0x8DA4;
+static const StringID STR_PLANS_NEW_PLAN = 0x8DA5;
+static const StringID STR_PLANS_NEW_PLAN_TOOLTIP = 0x8DA6;
+static const StringID STR_PLANS_ADD_LINES = 0x8DA7;
+static const StringID STR_PLANS_ADDING_LINES = 0x8DA8;
+static const StringID STR_PLANS_HIDE_ALL = 0x8DA9;
+static const StringID STR_PLANS_HIDE_ALL_TOOLTIP = 0x8DAA;
+static const StringID STR_PLANS_SHOW_ALL = 0x8DAB;
+static const StringID STR_PLANS_SHOW_ALL_TOOLTIP = 0x8DAC;
+static const StringID STR_PLANS_VISIBILITY_PRIVATE = 0x8DAD;
+static const StringID STR_PLANS_VISIBILITY_PUBLIC = 0x8DAE;
+static const StringID STR_PLANS_VISIBILITY_TOOLTIP = 0x8DAF;
+static const StringID STR_PLANS_COLOUR = 0x8DB0;
+static const StringID STR_PLANS_COLOUR_TOOLTIP = 0x8DB1;
+static const StringID STR_PLANS_DELETE = 0x8DB2;
+static const StringID STR_PLANS_DELETE_TOOLTIP = 0x8DB3;
+static const StringID STR_PLANS_LIST_ITEM_PLAN_PRIVATE = 0x8DB4;
+static const StringID STR_PLANS_LIST_ITEM_PLAN = 0x8DB5;
+static const StringID STR_PLANS_LIST_ITEM_NAMED_PLAN = 0x8DB6;
+static const StringID STR_PLANS_LIST_ITEM_LINE = 0x8DB7;
+static const StringID STR_PLANS_LIST_TOOLTIP = 0x8DB8;
+static const StringID STR_PLANS_QUERY_RENAME_PLAN = 0x8DB9;
+static const StringID STR_WARNING_LOADGAME_REMOVED_UNCORRECTABLE_VEHICLES = 0x8DBA;
+static const StringID STR_GAME_SAVELOAD_FROM_VERSION = 0x8DBB;
+static const StringID STR_GAME_SAVELOAD_ERROR_TOO_NEW_FEATURE_VERSION = 0x8DBC;
+static const StringID STR_GAME_SAVELOAD_ERROR_UNKNOWN_FEATURE = 0x8DBD;
+static const StringID STR_GAME_SAVELOAD_ERROR_HUGE_AIRPORTS_PRESENT = 0x8DBE;
+static const StringID STR_GAME_SAVELOAD_ERROR_HELI_OILRIG_BUG = 0x8DBF;
+static const StringID STR_QUERY_CLEAR_AREA_CAPTION = 0x8DC0;
+static const StringID STR_CLEAR_AREA_CONFIRMATION_TEXT = 0x8DC1;
+static const StringID STR_ERROR_CAN_T_BUILD_HOUSE_HERE = 0x8DC2;
+static const StringID STR_ERROR_BUILDING_NOT_ALLOWED_IN_THIS_TOWN_ZONE = 0x8DC3;
+static const StringID STR_ERROR_BUILDING_NOT_ALLOWED_ABOVE_SNOW_LINE = 0x8DC4;
+static const StringID STR_ERROR_BUILDING_NOT_ALLOWED_BELOW_SNOW_LINE = 0x8DC5;
+static const StringID STR_ERROR_TOO_MANY_HOUSE_SETS = 0x8DC6;
+static const StringID STR_ERROR_TOO_MANY_HOUSE_TYPES = 0x8DC7;
+static const StringID STR_ERROR_BUILDING_IS_TOO_OLD = 0x8DC8;
+static const StringID STR_ERROR_BUILDING_IS_TOO_MODERN = 0x8DC9;
+static const StringID STR_ERROR_ONLY_ONE_BUILDING_ALLOWED_PER_TOWN = 0x8DCA;
+static const StringID STR_ERROR_NO_MORE_BUILDINGS_ALLOWED_PER_TOWN = 0x8DCB;
+static const StringID STR_ERROR_BUILDING_NOT_ALLOWED = 0x8DCC;
+static const StringID STR_ERROR_TOO_MANY_DOCKS = 0x8DCD;
+static const StringID STR_ERROR_CAN_T_BUILD_ROAD_WAYPOINT = 0x8DCE;
+static const StringID STR_ERROR_CAN_T_REMOVE_ROAD_WAYPOINT = 0x8DCF;
+static const StringID STR_ERROR_MUST_REMOVE_ROADWAYPOINT_FIRST = 0x8DD0;
+static const StringID STR_ERROR_UNSUITABLE_SIGNAL_TYPE = 0x8DD1;
+static const StringID STR_ERROR_SIGNAL_CHANGES = 0x8DD2;
+static const StringID STR_ERROR_BRIDGE_TOO_LOW_FOR_STATION = 0x8DD3;
+static const StringID STR_ERROR_BRIDGE_PILLARS_OBSTRUCT_STATION = 0x8DD4;
+static const StringID STR_ERROR_CHUNNEL_THROUGH_MAP_BORDER = 0x8DD5;
+static const StringID STR_ERROR_CHUNNEL_RAMP = 0x8DD6;
+static const StringID STR_ERROR_TUNNEL_TOO_MANY = 0x8DD7;
+static const StringID STR_ERROR_NO_DRILLING_ABOVE_CHUNNEL = 0x8DD8;
+static const StringID STR_ERROR_ANOTHER_TUNNEL_IN_THE_WAY_FOR_CHUNNEL = 0x8DD9;
+static const StringID STR_ERROR_CHUNNEL_ONLY_OVER_SEA = 0x8DDA;
+static const StringID STR_ERROR_PURCHASE_LAND_LIMIT_REACHED = 0x8DDB;
+static const StringID STR_ERROR_CANT_PURCHASE_OTHER_COMPANY_DEPOT = 0x8DDC;
+static const StringID STR_ERROR_DEPOT_HAS_WRONG_RAIL_TYPE = 0x8DDD;
+static const StringID STR_ERROR_CANNOT_MODIFY_TRACK_TRAIN_APPROACHING = 0x8DDE;
+static const StringID STR_ERROR_NO_ROAD_WAYPOINT = 0x8DDF;
+static const StringID STR_ERROR_TOO_MANY_PLANS = 0x8DE0;
+static const StringID STR_ERROR_TOO_MANY_NODES = 0x8DE1;
+static const StringID STR_ERROR_NO_MORE_SPACE_FOR_LINES = 0x8DE2;
+static const StringID STR_ERROR_CAN_T_RENAME_PLAN = 0x8DE3;
+static const StringID STR_TRADITIONAL_TRAIN_NAME = 0x8DE4;
+static const StringID STR_TRADITIONAL_ROAD_VEHICLE_NAME = 0x8DE5;
+static const StringID STR_TRADITIONAL_SHIP_NAME = 0x8DE6;
+static const StringID STR_TRADITIONAL_AIRCRAFT_NAME = 0x8DE7;
+static const StringID STR_FORMAT_DATE_MINUTES = 0x8DE8;
+static const StringID STR_FORMAT_DATE_MINUTES_WITH_Y = 0x8DE9;
+static const StringID STR_FORMAT_DATE_MINUTES_WITH_YM = 0x8DEA;
+static const StringID STR_FORMAT_DATE_MINUTES_WITH_YMD = 0x8DEB;
+static const StringID STR_FORMAT_GROUP_VEHICLE_NAME_LONG = 0x8DEC;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP = 0x8DED;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP_STATION = 0x8DEE;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP_WAYPOINT = 0x8DEF;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP_IMPLICIT = 0x8DF0;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP_DEPOT = 0x8DF1;
+static const StringID STR_VIEWPORT_SHOW_VEHICLE_ROUTE_STEP_OVERFLOW = 0x8DF2;
+static const StringID STR_JUST_DECIMAL = 0x8DF3;
+static const StringID STR_JUST_DECIMAL1 = 0x8DF4;
+static const StringID STR_JUST_DATE_WALLCLOCK_TINY = 0x8DF5;
+static const StringID STR_JUST_DATE_WALLCLOCK_SHORT = 0x8DF6;
+static const StringID STR_JUST_DATE_WALLCLOCK_LONG = 0x8DF7;
+static const StringID STR_JUST_DATE_WALLCLOCK_ISO = 0x8DF8;
+static const StringID STR_JUST_TIME_HHMM = 0x8DF9;
+static const StringID STR_JUST_STRING1 = 0x8DFA;
+static const StringID STR_JUST_STRING2 = 0x8DFB;
+static const StringID STR_JUST_STRING3 = 0x8DFC;
+static const StringID STR_JUST_VELOCITY = 0x8DFD;
+static const StringID STR_JUST_TT_TICKS = 0x8DFE;
+static const StringID STR_JUST_TT_TICKS_LONG = 0x8DFF;
+static const StringID STR_BLACK_DECIMAL = 0x8E00;
+static const StringID STR_WHITE_DATE_WALLCLOCK_LONG = 0x8E01;
+static const StringID STR_WHITE_DATE_WALLCLOCK_SHORT = 0x8E02;
+static const StringID STR_BLACK_TIME_HHMM = 0x8E03;
+static const StringID STR_RED_INT = 0x8E04;
+static const StringID STR_BLACK_STRING1 = 0x8E05;
+static const StringID STR_BLACK_PLUS = 0x8E06;
+static const StringID STR_WHITE = 0x8E07;
+static const StringID STR_BLACK = 0x8E08;
+static const StringID STR_DECIMAL1_WITH_SCALE = 0x8E09;
+static const StringID STR_HIERARCHY_SEPARATOR = 0x8E0A;
+static const StringID STR_ZONING_TOOLBAR = 0x8E0B;
+static const StringID STR_ZONING_OUTER = 0x8E0C;
+static const StringID STR_ZONING_INNER = 0x8E0D;
+static const StringID STR_ZONING_OUTER_INFO = 0x8E0E;
+static const StringID STR_ZONING_INNER_INFO = 0x8E0F;
+static const StringID STR_ZONING_NO_ZONING = 0x8E10;
+static const StringID STR_ZONING_AUTHORITY = 0x8E11;
+static const StringID STR_ZONING_CAN_BUILD = 0x8E12;
+static const StringID STR_ZONING_STA_CATCH = 0x8E13;
+static const StringID STR_ZONING_STA_CATCH_OPEN = 0x8E14;
+static const StringID STR_ZONING_BUL_UNSER = 0x8E15;
+static const StringID STR_ZONING_IND_UNSER = 0x8E16;
+static const StringID STR_ZONING_TRACERESTRICT = 0x8E17;
+static const StringID STR_ZONING_2x2_GRID = 0x8E18;
+static const StringID STR_ZONING_3x3_GRID = 0x8E19;
+static const StringID STR_ZONING_ONE_WAY_ROAD = 0x8E1A;
+static const StringID STR_STATION_RATING_TOOLTIP_RATING_DETAILS = 0x8E1B;
+static const StringID STR_STATION_RATING_TOOLTIP_TOTAL_RATING = 0x8E1C;
+static const StringID STR_STATION_RATING_TOOLTIP_USING_CHEAT = 0x8E1D;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_RATING = 0x8E1E;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_RATING_0 = 0x8E1F;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_RATING_1 = 0x8E20;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_SPEED = 0x8E21;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_WAITUNITS = 0x8E22;
+static const StringID STR_STATION_RATING_TOOLTIP_NEWGRF_WAITTIME = 0x8E23;
+static const StringID STR_STATION_RATING_MAX_PERCENTAGE = 0x8E24;
+static const StringID STR_STATION_RATING_MAX_PERCENTAGE_COMMA = 0x8E25;
+static const StringID STR_STATION_RATING_PERCENTAGE_COMMA = 0x8E26;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED = 0x8E27;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED_ZERO = 0x8E28;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED_0 = 0x8E29;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED_1 = 0x8E2A;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED_2 = 0x8E2B;
+static const StringID STR_STATION_RATING_TOOLTIP_SPEED_3 = 0x8E2C;
+static const StringID STR_STATION_RATING_TOOLTIP_AGE = 0x8E2D;
+static const StringID STR_STATION_RATING_TOOLTIP_AGE_0 = 0x8E2E;
+static const StringID STR_STATION_RATING_TOOLTIP_AGE_1 = 0x8E2F;
+static const StringID STR_STATION_RATING_TOOLTIP_AGE_2 = 0x8E30;
+static const StringID STR_STATION_RATING_TOOLTIP_AGE_3 = 0x8E31;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME = 0x8E32;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_SHIP = 0x8E33;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_0 = 0x8E34;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_1 = 0x8E35;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_2 = 0x8E36;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_3 = 0x8E37;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITTIME_4 = 0x8E38;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS = 0x8E39;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_0 = 0x8E3A;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_1 = 0x8E3B;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_2 = 0x8E3C;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_3 = 0x8E3D;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_4 = 0x8E3E;
+static const StringID STR_STATION_RATING_TOOLTIP_WAITUNITS_5 = 0x8E3F;
+static const StringID STR_STATION_RATING_TOOLTIP_STATUE = 0x8E40;
+static const StringID STR_STATION_RATING_TOOLTIP_STATUE_NO = 0x8E41;
+static const StringID STR_STATION_RATING_TOOLTIP_STATUE_YES = 0x8E42;
+static const StringID STR_STATION_RATING_TOOLTIP_TRAIN = 0x8E43;
+static const StringID STR_STATION_RATING_TOOLTIP_ROAD_VEHICLE = 0x8E44;
+static const StringID STR_STATION_RATING_TOOLTIP_SHIP = 0x8E45;
+static const StringID STR_STATION_RATING_TOOLTIP_AIRCRAFT = 0x8E46;
+static const StringID STR_STATION_RATING_TOOLTIP_INVALID = 0x8E47;
+static const StringID STR_TMPL_RPL_TITLE = 0x8E48;
+static const StringID STR_TMPL_TEMPLATE_REPLACEMENT = 0x8E49;
+static const StringID STR_TMPL_TRAINS_IN_GROUP = 0x8E4A;
+static const StringID STR_TMPL_AVAILABLE_TEMPLATES = 0x8E4B;
+static const StringID STR_TMPL_DEFINE_TEMPLATE = 0x8E4C;
+static const StringID STR_TMPL_EDIT_TEMPLATE = 0x8E4D;
+static const StringID STR_TMPL_CREATE_CLONE_VEH = 0x8E4E;
+static const StringID STR_TMPL_DELETE_TEMPLATE = 0x8E4F;
+static const StringID STR_TMPL_RENAME_TEMPLATE = 0x8E50;
+static const StringID STR_TMPL_RPL_ALL_TMPL = 0x8E51;
+static const StringID STR_TMPL_NEW_VEHICLE = 0x8E52;
+static const StringID STR_TMPL_CONFIRM = 0x8E53;
+static const StringID STR_TMPL_CANCEL = 0x8E54;
+static const StringID STR_TMPL_NEW = 0x8E55;
+static const StringID STR_TMPL_REFIT = 0x8E56;
+static const StringID STR_TMPL_GROUP_INFO = 0x8E57;
+static const StringID STR_TMPL_TEMPLATE_INFO = 0x8E58;
+static const StringID STR_TMPL_RPL_START = 0x8E59;
+static const StringID STR_TMPL_RPL_START_TOOLTIP = 0x8E5A;
+static const StringID STR_TMPL_RPL_STOP = 0x8E5B;
+static const StringID STR_TMPL_RPL_STOP_TOOLTIP = 0x8E5C;
+static const StringID STR_TMPL_TEMPLATE_OVR_VALUE = 0x8E5D;
+static const StringID STR_TMPL_TEMPLATE_OVR_VALUE_LTBLUE = 0x8E5E;
+static const StringID STR_TMPL_TEMPLATE_OVR_RUNNING_COST = 0x8E5F;
+static const StringID STR_TMPL_TEMPLATE_OVR_MULTIPLE = 0x8E60;
+static const StringID STR_TMPL_WARNING_FREE_WAGON = 0x8E61;
+static const StringID STR_TMPL_WARNING_VEH_UNAVAILABLE = 0x8E62;
+static const StringID STR_TMPL_WARNING_VEH_NO_COMPATIBLE_RAIL_TYPE = 0x8E63;
+static const StringID STR_TMPL_GROUP_USES_TEMPLATE = 0x8E64;
+static const StringID STR_TMPL_NAME = 0x8E65;
+static const StringID STR_TMP_TEMPLATE_IN_USE = 0x8E66;
+static const StringID STR_TMP_TEMPLATE_FROM_PARENT_GROUP = 0x8E67;
+static const StringID STR_TMPL_GROUP_NUM_TRAINS = 0x8E68;
+static const StringID STR_TMPL_CREATEGUI_TITLE = 0x8E69;
+static const StringID STR_TMPL_MAINGUI_DEFINEDGROUPS = 0x8E6A;
+static const StringID STR_TMPL_TMPLRPL_EX_DIFF_RAILTYPE = 0x8E6B;
+static const StringID STR_TMPL_ADD_LOCOMOTIVE = 0x8E6C;
+static const StringID STR_TMPL_ADD_WAGON = 0x8E6D;
+static const StringID STR_TMPL_ADD_VEHICLE = 0x8E6E;
+static const StringID STR_TMPL_ADD_LOCOMOTIVE_REFIT = 0x8E6F;
+static const StringID STR_TMPL_ADD_WAGON_REFIT = 0x8E70;
+static const StringID STR_TMPL_ADD_VEHICLE_REFIT = 0x8E71;
+static const StringID STR_TMPL_ADD_TOOLTIP = 0x8E72;
+static const StringID STR_TMPL_ADD_REFIT_TOOLTIP = 0x8E73;
+static const StringID STR_TMPL_SET_USEDEPOT = 0x8E74;
+static const StringID STR_TMPL_SET_USEDEPOT_TIP = 0x8E75;
+static const StringID STR_TMPL_SET_KEEPREMAINDERS = 0x8E76;
+static const StringID STR_TMPL_SET_KEEPREMAINDERS_TIP = 0x8E77;
+static const StringID STR_TMPL_SET_REFIT = 0x8E78;
+static const StringID STR_TMPL_SET_REFIT_TIP = 0x8E79;
+static const StringID STR_TMPL_SET_OLD_ONLY = 0x8E7A;
+static const StringID STR_TMPL_SET_OLD_ONLY_TIP = 0x8E7B;
+static const StringID STR_TMPL_CONFIG_USEDEPOT = 0x8E7C;
+static const StringID STR_TMPL_CONFIG_KEEPREMAINDERS = 0x8E7D;
+static const StringID STR_TMPL_CONFIG_REFIT = 0x8E7E;
+static const StringID STR_TMPL_CONFIG_OLD_ONLY = 0x8E7F;
+static const StringID STR_TMPL_NUM_TRAINS_NEED_RPL = 0x8E80;
+static const StringID STR_TMPL_CARGO_SUMMARY = 0x8E81;
+static const StringID STR_TMPL_CARGO_SUMMARY_MULTI = 0x8E82;
+static const StringID STR_TMPL_RPLALLGUI_TITLE = 0x8E83;
+static const StringID STR_TMPL_RPLALLGUI_INSET_TOP = 0x8E84;
+static const StringID STR_TMPL_RPLALLGUI_INSET_TOP_1 = 0x8E85;
+static const StringID STR_TMPL_RPLALLGUI_INSET_TOP_2 = 0x8E86;
+static const StringID STR_TMPL_RPLALLGUI_INSET_BOTTOM = 0x8E87;
+static const StringID STR_TMPL_RPLALLGUI_BUTTON_RPLALL = 0x8E88;
+static const StringID STR_TMPL_RPLALLGUI_BUTTON_APPLY = 0x8E89;
+static const StringID STR_TMPL_RPLALLGUI_BUTTON_CANCEL = 0x8E8A;
+static const StringID STR_TMPL_RPLALLGUI_USE_TIP = 0x8E8B;
+static const StringID STR_TMPL_CANT_CREATE = 0x8E8C;
+static const StringID STR_TMPL_CANT_RENAME = 0x8E8D;
+static const StringID STR_SCHDISPATCH_CAPTION = 0x8E8E;
+static const StringID STR_SCHDISPATCH_ENABLED = 0x8E8F;
+static const StringID STR_SCHDISPATCH_ENABLED_TOOLTIP = 0x8E90;
+static const StringID STR_SCHDISPATCH_ADD = 0x8E91;
+static const StringID STR_SCHDISPATCH_ADD_TOOLTIP = 0x8E92;
+static const StringID STR_SCHDISPATCH_ADD_TOOLTIP_EXTRA = 0x8E93;
+static const StringID STR_SCHDISPATCH_ADD_CAPTION = 0x8E94;
+static const StringID STR_SCHDISPATCH_DURATION = 0x8E95;
+static const StringID STR_SCHDISPATCH_DURATION_TOOLTIP = 0x8E96;
+static const StringID STR_SCHDISPATCH_DURATION_CAPTION_MINUTE = 0x8E97;
+static const StringID STR_SCHDISPATCH_DURATION_CAPTION_DAY = 0x8E98;
+static const StringID STR_SCHDISPATCH_DURATION_CAPTION_TICKS = 0x8E99;
+static const StringID STR_SCHDISPATCH_START = 0x8E9A;
+static const StringID STR_SCHDISPATCH_SET_START = 0x8E9B;
+static const StringID STR_SCHDISPATCH_START_TOOLTIP = 0x8E9C;
+static const StringID STR_SCHDISPATCH_START_CAPTION_MINUTE = 0x8E9D;
+static const StringID STR_SCHDISPATCH_DELAY = 0x8E9E;
+static const StringID STR_SCHDISPATCH_DELAY_TOOLTIP = 0x8E9F;
+static const StringID STR_SCHDISPATCH_DELAY_CAPTION_MINUTE = 0x8EA0;
+static const StringID STR_SCHDISPATCH_DELAY_CAPTION_DAY = 0x8EA1;
+static const StringID STR_SCHDISPATCH_DELAY_CAPTION_TICKS = 0x8EA2;
+static const StringID STR_SCHDISPATCH_ADJUST = 0x8EA3;
+static const StringID STR_SCHDISPATCH_ADJUST_TOOLTIP = 0x8EA4;
+static const StringID STR_SCHDISPATCH_ADJUST_CAPTION_MINUTE = 0x8EA5;
+static const StringID STR_SCHDISPATCH_ADJUST_CAPTION_DAY = 0x8EA6;
+static const StringID STR_SCHDISPATCH_ADJUST_CAPTION_TICKS = 0x8EA7;
+static const StringID STR_SCHDISPATCH_RESET_LAST_DISPATCH = 0x8EA8;
+static const StringID STR_SCHDISPATCH_RESET_LAST_DISPATCH_TOOLTIP = 0x8EA9;
+static const StringID STR_SCHDISPATCH_CLEAR = 0x8EAA;
+static const StringID STR_SCHDISPATCH_CLEAR_TOOLTIP = 0x8EAB;
+static const StringID STR_SCHDISPATCH_MANAGE = 0x8EAC;
+static const StringID STR_SCHDISPATCH_MANAGE_TOOLTIP_SUFFIX = 0x8EAD;
+static const StringID STR_SCHDISPATCH_PREV_SCHEDULE = 0x8EAE;
+static const StringID STR_SCHDISPATCH_PREV_SCHEDULE_TOOLTIP = 0x8EAF;
+static const StringID STR_SCHDISPATCH_NEXT_SCHEDULE = 0x8EB0;
+static const StringID STR_SCHDISPATCH_NEXT_SCHEDULE_TOOLTIP = 0x8EB1;
+static const StringID STR_SCHDISPATCH_ADD_SCHEDULE = 0x8EB2;
+static const StringID STR_SCHDISPATCH_ADD_SCHEDULE_TOOLTIP = 0x8EB3;
+static const StringID STR_SCHDISPATCH_REMOVE_SCHEDULE = 0x8EB4;
+static const StringID STR_SCHDISPATCH_REMOVE_SCHEDULE_TOOLTIP = 0x8EB5;
+static const StringID STR_SCHDISPATCH_DUPLICATE_SCHEDULE = 0x8EB6;
+static const StringID STR_SCHDISPATCH_DUPLICATE_SCHEDULE_TOOLTIP = 0x8EB7;
+static const StringID STR_SCHDISPATCH_APPEND_VEHICLE_SCHEDULES = 0x8EB8;
+static const StringID STR_SCHDISPATCH_APPEND_VEHICLE_SCHEDULES_TOOLTIP = 0x8EB9;
+static const StringID STR_SCHDISPATCH_NO_SCHEDULES = 0x8EBA;
+static const StringID STR_SCHDISPATCH_SCHEDULE_ID = 0x8EBB;
+static const StringID STR_SCHDISPATCH_NAMED_SCHEDULE_ID = 0x8EBC;
+static const StringID STR_SCHDISPATCH_RENAME_SCHEDULE_TOOLTIP = 0x8EBD;
+static const StringID STR_SCHDISPATCH_RENAME_SCHEDULE_CAPTION = 0x8EBE;
+static const StringID STR_ERROR_CAN_T_RENAME_SCHEDULE = 0x8EBF;
+static const StringID STR_SCHDISPATCH_SUMMARY_LAST_DEPARTURE_PAST = 0x8EC0;
+static const StringID STR_SCHDISPATCH_SUMMARY_LAST_DEPARTURE_FUTURE = 0x8EC1;
+static const StringID STR_SCHDISPATCH_SUMMARY_L1 = 0x8EC2;
+static const StringID STR_SCHDISPATCH_SUMMARY_L2 = 0x8EC3;
+static const StringID STR_SCHDISPATCH_SUMMARY_L3 = 0x8EC4;
+static const StringID STR_SCHDISPATCH_SUMMARY_L4 = 0x8EC5;
+static const StringID STR_SCHDISPATCH_SUMMARY_NOT_ENABLED = 0x8EC6;
+static const StringID STR_SCHDISPATCH_SLOT_OUTSIDE_SCHEDULE = 0x8EC7;
+static const StringID STR_SCHDISPATCH_NOT_ASSIGNED_TO_ORDER = 0x8EC8;
+static const StringID STR_SCHDISPATCH_ASSIGNED_TO_ORDER = 0x8EC9;
+static const StringID STR_SCHDISPATCH_ADD_DEPARTURE_SLOTS_START = 0x8ECA;
+static const StringID STR_SCHDISPATCH_ADD_DEPARTURE_SLOTS_STEP = 0x8ECB;
+static const StringID STR_SCHDISPATCH_ADD_DEPARTURE_SLOTS_END = 0x8ECC;
+static const StringID STR_SCHDISPATCH_QUERY_CLEAR_SCHEDULE_CAPTION = 0x8ECD;
+static const StringID STR_SCHDISPATCH_QUERY_CLEAR_SCHEDULE_TEXT = 0x8ECE;
+static const StringID STR_SCHDISPATCH_QUERY_REMOVE_SCHEDULE_CAPTION = 0x8ECF;
+static const StringID STR_SCHDISPATCH_QUERY_REMOVE_SCHEDULE_TEXT = 0x8ED0;
+static const StringID STR_ERROR_SCHDISPATCH_TRIED_TO_ADD_TOO_MANY_SLOTS = 0x8ED1;
+static const StringID STR_ERROR_SCHDISPATCH_ADJUSTMENT_TOO_LARGE = 0x8ED2;
+static const StringID STR_MODIFIER_KEY_TOGGLE_CAPTION = 0x8ED3;
+static const StringID STR_SHIFT_KEY_NAME = 0x8ED4;
+static const StringID STR_CTRL_KEY_NAME = 0x8ED5;
+static const StringID STR_MODIFIER_TOGGLE_SHIFT_TOOLTIP = 0x8ED6;
+static const StringID STR_MODIFIER_TOGGLE_CTRL_TOOLTIP = 0x8ED7;
+static const StringID STR_ERROR_TUNNEL_DISALLOWED_ROAD = 0x8ED8;
+static const StringID STR_REFIT_SHIP_PART_DROPDOWN_TOOLTIP = 0x8ED9;
+static const StringID STR_REFIT_WHOLE_SHIP = 0x8EDA;
+static const StringID STR_REFIT_SHIP_PART = 0x8EDB;
+static const StringID STR_VERY_REDUCED = 0x8EDC;
+static const StringID STR_STATION_VIEW_RENAME_TOOLTIP_EXTRA = 0x8EDD;
+static const StringID STR_ERROR_CAN_T_EXCHANGE_STATION_NAMES = 0x8EDE;
+static const StringID STR_ERROR_STATIONS_NOT_IN_SAME_TOWN = 0x8EDF;
+static const StringID STR_ERROR_STATION_ATTACHED_TO_INDUSTRY = 0x8EE0;
+static const StringID STR_RAIL_TOOLBAR_TOOLTIP_CONVERT_RAIL_EXTRA = 0x8EE1;
+
+static const StringID STR_LAST_STRINGID = 0x8EE1;
+
+static const uint LANGUAGE_PACK_VERSION     = 0x1AB985A1;
+static const uint LANGUAGE_MAX_PLURAL       = 15;
+static const uint LANGUAGE_MAX_PLURAL_FORMS = 5;
+static const uint LANGUAGE_TOTAL_STRINGS    = 6139;
+
+#endif /* TABLE_STRINGS_H */
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/desktop_file"
+  "openttd.desktop"
+  "openttd.desktop.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/desktop_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/media_files"
+  "icons/hicolor/128x128/apps/openttd.png"
+  "icons/hicolor/16x16/apps/openttd.png"
+  "icons/hicolor/256x256/apps/openttd.png"
+  "icons/hicolor/32x32/apps/openttd.png"
+  "icons/hicolor/48x48/apps/openttd.png"
+  "icons/hicolor/64x64/apps/openttd.png"
+  "pixmaps/openttd.32.xpm"
+  "pixmaps/openttd.64.xpm"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/media_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/ai/ai_includes.hpp"
+  "CMakeFiles/script_ai_includes"
+  "ai_includes.hpp.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_ai_includes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/alloc_func.cpp" "src/strgen/CMakeFiles/strgen.dir/__/core/alloc_func.cpp.o" "gcc" "src/strgen/CMakeFiles/strgen.dir/__/core/alloc_func.cpp.o.d"
+  "/root/repo/src/misc/getoptdata.cpp" "src/strgen/CMakeFiles/strgen.dir/__/misc/getoptdata.cpp.o" "gcc" "src/strgen/CMakeFiles/strgen.dir/__/misc/getoptdata.cpp.o.d"
+  "/root/repo/src/string.cpp" "src/strgen/CMakeFiles/strgen.dir/__/string.cpp.o" "gcc" "src/strgen/CMakeFiles/strgen.dir/__/string.cpp.o.d"
+  "/root/repo/src/strgen/strgen.cpp" "src/strgen/CMakeFiles/strgen.dir/strgen.cpp.o" "gcc" "src/strgen/CMakeFiles/strgen.dir/strgen.cpp.o.d"
+  "/root/repo/src/strgen/strgen_base.cpp" "src/strgen/CMakeFiles/strgen.dir/strgen_base.cpp.o" "gcc" "src/strgen/CMakeFiles/strgen.dir/strgen_base.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/strgen.dir/__/core/alloc_func.cpp.o"
+  "CMakeFiles/strgen.dir/__/core/alloc_func.cpp.o.d"
+  "CMakeFiles/strgen.dir/__/misc/getoptdata.cpp.o"
+  "CMakeFiles/strgen.dir/__/misc/getoptdata.cpp.o.d"
+  "CMakeFiles/strgen.dir/__/string.cpp.o"
+  "CMakeFiles/strgen.dir/__/string.cpp.o.d"
+  "CMakeFiles/strgen.dir/strgen.cpp.o"
+  "CMakeFiles/strgen.dir/strgen.cpp.o.d"
+  "CMakeFiles/strgen.dir/strgen_base.cpp.o"
+  "CMakeFiles/strgen.dir/strgen_base.cpp.o.d"
+  "strgen"
+  "strgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/strgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -123,6 +123,11 @@ void sq_setdebughook(HSQUIRRELVM v)
 	}
 }
 
+void sq_setprofilehook(HSQUIRRELVM v,SQPROFILEHOOK hook)
+{
+	v->_profilehook = hook;
+}
+
 void sq_close(HSQUIRRELVM v)
 {
 	SQSharedState *ss = _ss(v);
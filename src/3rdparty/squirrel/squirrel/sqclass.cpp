@@ -32,7 +32,10 @@ SQClass::SQClass(SQSharedState *ss,SQClass *base)
 	ADD_TO_CHAIN(&_sharedstate->_gc_chain, this);
 }
 
+SQUnsignedInteger SQClass::_cache_generation = 1;
+
 void SQClass::Finalize() {
+	_cache_generation++;
 	_attributes = _null_;
 	/* SQInstance's Finalize depends on the size of this sqvector, so instead of
 	 * resizing, all SQObjectPtrs are set to "null" so it holds no references to
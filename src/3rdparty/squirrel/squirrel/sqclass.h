@@ -53,6 +53,10 @@ public:
 	bool SetAttributes(const SQObjectPtr &key,const SQObjectPtr &val);
 	bool GetAttributes(const SQObjectPtr &key,SQObjectPtr &outval);
 	void Lock() { _locked = true; if(_base) _base->Lock(); }
+	/* Bumped whenever a class is finalized or destroyed; invalidates all
+	 * SQMemberCache entries so a reused class address cannot produce a stale
+	 * inline cache hit. */
+	static SQUnsignedInteger _cache_generation;
 	void Release() {
 		if (_hook) { _hook(_typetag,0);}
 		sq_delete_refcounted(this, SQClass);
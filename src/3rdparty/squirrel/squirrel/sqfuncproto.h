@@ -40,6 +40,18 @@ typedef sqvector<SQOuterVar> SQOuterVarVec;
 typedef sqvector<SQLocalVarInfo> SQLocalVarInfoVec;
 typedef sqvector<SQLineInfo> SQLineInfoVec;
 
+struct SQClass;
+
+/* Monomorphic inline cache for one member lookup site with a literal key
+ * (_OP_GETK / _OP_PREPCALLK). An entry is valid while its class pointer
+ * matches and no class has been destroyed since it was filled. */
+struct SQMemberCache
+{
+	SQClass *_klass;               /* class the handle was resolved against, nullptr if empty */
+	SQInteger _handle;             /* raw member handle from the class member table */
+	SQUnsignedInteger _generation; /* SQClass::_cache_generation at fill time */
+};
+
 #define _FUNC_SIZE(ni,nl,nparams,nfuncs,nouters,nlineinf,localinf,defparams) (sizeof(SQFunctionProto) \
 		+((ni-1)*sizeof(SQInstruction))+(nl*sizeof(SQObjectPtr)) \
 		+(nparams*sizeof(SQObjectPtr))+(nfuncs*sizeof(SQObjectPtr)) \
@@ -83,6 +95,7 @@ private:
 		_nlocalvarinfos = nlocalvarinfos;
 		_defaultparams = (SQInteger *)&_localvarinfos[nlocalvarinfos];
 		_ndefaultparams = ndefaultparams;
+		_membercaches = nullptr;
 
 		_CONSTRUCT_VECTOR(SQObjectPtr,_nliterals,_literals);
 		_CONSTRUCT_VECTOR(SQObjectPtr,_nparameters,_parameters);
@@ -103,6 +116,7 @@ public:
 		return f;
 	}
 	void Release(){
+		if (_membercaches != nullptr) SQ_FREE(_membercaches, sizeof(SQMemberCache) * _ninstructions);
 		_DESTRUCT_VECTOR(SQObjectPtr,_nliterals,_literals);
 		_DESTRUCT_VECTOR(SQObjectPtr,_nparameters,_parameters);
 		_DESTRUCT_VECTOR(SQObjectPtr,_nfunctions,_functions);
@@ -112,6 +126,17 @@ public:
 		this->~SQFunctionProto();
 		SQFunctionProto::SQDeallocate(this);
 	}
+	/* Get the member lookup inline cache slot of the given instruction,
+	 * lazily allocating the per-function cache array on first use. */
+	SQMemberCache *GetMemberCacheSlot(const SQInstruction *ip)
+	{
+		if (_membercaches == nullptr) {
+			_membercaches = (SQMemberCache *)SQ_MALLOC(sizeof(SQMemberCache) * _ninstructions);
+			memset(_membercaches, 0, sizeof(SQMemberCache) * _ninstructions);
+		}
+		return &_membercaches[ip - _instructions];
+	}
+
 	const SQChar* GetLocal(SQVM *v,SQUnsignedInteger stackbase,SQUnsignedInteger nseq,SQUnsignedInteger nop);
 	SQInteger GetLine(SQInstruction *curr);
 	bool Save(SQVM *v,SQUserPointer up,SQWRITEFUNC write);
@@ -144,6 +169,8 @@ public:
 	SQInteger _ndefaultparams;
 	SQInteger *_defaultparams;
 
+	SQMemberCache *_membercaches; /* lazily allocated, one per instruction */
+
 	SQInteger _ninstructions;
 	SQInstruction _instructions[1];
 };
@@ -190,6 +190,8 @@ bool SQGenerator::Resume(SQVM *v,SQInteger target)
 	_state=eRunning;
 	if (type(v->_debughook) != OT_NULL && _rawval(v->_debughook) != _rawval(v->ci->_closure))
 		v->CallDebugHook('c');
+	if (v->_profilehook != nullptr)
+		v->CallProfileHook('c');
 
 	return true;
 }
@@ -112,6 +112,7 @@ SQVM::SQVM(SQSharedState *ss)
 	_lasterror = _null_;
 	_errorhandler = _null_;
 	_debughook = _null_;
+	_profilehook = nullptr;
 	_can_suspend = false;
 	_in_stackoverflow = false;
 	_ops_till_suspend = 0;
@@ -332,6 +333,7 @@ bool SQVM::Init(SQVM *friendvm, SQInteger stacksize)
 		_roottable = friendvm->_roottable;
 		_errorhandler = friendvm->_errorhandler;
 		_debughook = friendvm->_debughook;
+		_profilehook = friendvm->_profilehook;
 	}
 
 	sq_base_register(this);
@@ -404,6 +406,8 @@ bool SQVM::StartCall(SQClosure *closure,SQInteger target,SQInteger args,SQIntege
 	_stackbase = stackbase;
 	if (type(_debughook) != OT_NULL && _rawval(_debughook) != _rawval(ci->_closure))
 		CallDebugHook('c');
+	if (_profilehook != nullptr)
+		CallProfileHook('c');
 	return true;
 }
 
@@ -412,6 +416,9 @@ bool SQVM::Return(SQInteger _arg0, SQInteger _arg1, SQObjectPtr &retval)
 	if (type(_debughook) != OT_NULL && _rawval(_debughook) != _rawval(ci->_closure))
 		for(SQInteger i=0;i<ci->_ncalls;i++)
 			CallDebugHook('r');
+	if (_profilehook != nullptr)
+		for(SQInteger i=0;i<ci->_ncalls;i++)
+			CallProfileHook('r');
 
 	SQBool broot = ci->_root;
 	SQInteger last_top = _top;
@@ -572,6 +579,28 @@ bool SQVM::DELEGATE_OP(SQObjectPtr &trg,SQObjectPtr &o1,SQObjectPtr &o2)
 
 #define SQ_THROW() { goto exception_trap; }
 
+/* Threaded bytecode dispatch: on compilers with the labels-as-values extension
+ * every opcode handler jumps straight to the next handler through a per-opcode
+ * dispatch table instead of going back through a single shared switch. The
+ * replicated indirect branches predict considerably better than the shared
+ * one. Define SQ_NO_THREADED_DISPATCH to get the plain switch loop back. */
+#if !defined(SQ_NO_THREADED_DISPATCH) && defined(__GNUC__)
+#define SQ_THREADED_DISPATCH
+#endif
+
+#ifdef SQ_THREADED_DISPATCH
+#define SQ_VM_OP(op) lbl##op
+#define SQ_VM_NEXT { \
+	DecreaseOps(1); \
+	if (ShouldSuspend()) { _suspended = SQTrue; _suspended_traps = traps; return true; } \
+	_i_ptr = ci->_ip++; \
+	goto *sq_dispatch_table[_i_ptr->op]; \
+}
+#else
+#define SQ_VM_OP(op) case op
+#define SQ_VM_NEXT continue
+#endif
+
 bool SQVM::CLOSURE_OP(SQObjectPtr &target, SQFunctionProto *func)
 {
 	SQInteger nouters;
@@ -739,6 +768,31 @@ bool SQVM::Execute(SQObjectPtr &closure, SQInteger target, SQInteger nargs, SQIn
 exception_restore:
 	//
 	{
+#ifdef SQ_THREADED_DISPATCH
+		/* Jump targets for every opcode, in SQOpcode order. */
+		static const void *sq_dispatch_table[] = {
+			&&lbl_OP_LINE, &&lbl_OP_LOAD, &&lbl_OP_LOADINT, &&lbl_OP_LOADFLOAT,
+			&&lbl_OP_DLOAD, &&lbl_OP_TAILCALL, &&lbl_OP_CALL, &&lbl_OP_PREPCALL,
+			&&lbl_OP_PREPCALLK, &&lbl_OP_GETK, &&lbl_OP_MOVE, &&lbl_OP_NEWSLOT,
+			&&lbl_OP_DELETE, &&lbl_OP_SET, &&lbl_OP_GET, &&lbl_OP_EQ,
+			&&lbl_OP_NE, &&lbl_OP_ARITH, &&lbl_OP_BITW, &&lbl_OP_RETURN,
+			&&lbl_OP_LOADNULLS, &&lbl_OP_LOADROOTTABLE, &&lbl_OP_LOADBOOL, &&lbl_OP_DMOVE,
+			&&lbl_OP_JMP, &&lbl_OP_JNZ, &&lbl_OP_JZ, &&lbl_OP_LOADFREEVAR,
+			&&lbl_OP_VARGC, &&lbl_OP_GETVARGV, &&lbl_OP_NEWTABLE, &&lbl_OP_NEWARRAY,
+			&&lbl_OP_APPENDARRAY, &&lbl_OP_GETPARENT, &&lbl_OP_COMPARITH, &&lbl_OP_COMPARITHL,
+			&&lbl_OP_INC, &&lbl_OP_INCL, &&lbl_OP_PINC, &&lbl_OP_PINCL,
+			&&lbl_OP_CMP, &&lbl_OP_EXISTS, &&lbl_OP_INSTANCEOF, &&lbl_OP_AND,
+			&&lbl_OP_OR, &&lbl_OP_NEG, &&lbl_OP_NOT, &&lbl_OP_BWNOT,
+			&&lbl_OP_CLOSURE, &&lbl_OP_YIELD, &&lbl_OP_RESUME, &&lbl_OP_FOREACH,
+			&&lbl_OP_POSTFOREACH, &&lbl_OP_DELEGATE, &&lbl_OP_CLONE, &&lbl_OP_TYPEOF,
+			&&lbl_OP_PUSHTRAP, &&lbl_OP_POPTRAP, &&lbl_OP_THROW, &&lbl_OP_CLASS,
+			&&lbl_OP_NEWSLOTA, &&lbl_OP_SCOPE_END,
+		};
+		static_assert(sizeof(sq_dispatch_table) / sizeof(sq_dispatch_table[0]) == _OP_SCOPE_END + 1);
+		const SQInstruction *_i_ptr;
+#define _i_ (*_i_ptr)
+		SQ_VM_NEXT;
+#else
 		for(;;)
 		{
 			DecreaseOps(1);
@@ -751,15 +805,16 @@ exception_restore:
 #endif
 			switch(_i_.op)
 			{
-			case _OP_LINE:
+#endif
+			SQ_VM_OP(_OP_LINE):
 				if(type(_debughook) != OT_NULL && _rawval(_debughook) != _rawval(ci->_closure))
 					CallDebugHook('l',arg1);
-				continue;
-			case _OP_LOAD: TARGET = ci->_literals[arg1]; continue;
-			case _OP_LOADINT: TARGET = (SQInteger)arg1; continue;
-			case _OP_LOADFLOAT: TARGET = *((const SQFloat *)&arg1); continue;
-			case _OP_DLOAD: TARGET = ci->_literals[arg1]; STK(arg2) = ci->_literals[arg3];continue;
-			case _OP_TAILCALL:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOAD): TARGET = ci->_literals[arg1]; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADINT): TARGET = (SQInteger)arg1; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADFLOAT): TARGET = *((const SQFloat *)&arg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_DLOAD): TARGET = ci->_literals[arg1]; STK(arg2) = ci->_literals[arg3];SQ_VM_NEXT;
+			SQ_VM_OP(_OP_TAILCALL):
 				temp_reg = STK(arg1);
 				if (type(temp_reg) == OT_CLOSURE && !_funcproto(_closure(temp_reg)->_function)->_bgenerator){
 					ct_tailcall = true;
@@ -769,8 +824,10 @@ exception_restore:
 					ct_stackbase = _stackbase;
 					goto common_call;
 				}
+#ifndef SQ_THREADED_DISPATCH
 				FALLTHROUGH;
-			case _OP_CALL: {
+#endif
+			SQ_VM_OP(_OP_CALL): {
 					ct_tailcall = false;
 					ct_target = arg0;
 					temp_reg = STK(arg1);
@@ -790,7 +847,7 @@ common_call:
 						}
 						CLEARSTACK(last_top);
 						}
-						continue;
+						SQ_VM_NEXT;
 					case OT_NATIVECLOSURE: {
 						bool suspend;
 						_suspended_target = ct_target;
@@ -817,7 +874,7 @@ common_call:
 							STK(ct_target) = clo;
 						}
 										   }
-						continue;
+						SQ_VM_NEXT;
 					case OT_CLASS:{
 						SQObjectPtr inst;
 						_GUARD(CreateClassInstance(_class(clo),inst,temp_reg));
@@ -847,18 +904,21 @@ common_call:
 						SQ_THROW();
 					}
 				}
-				  continue;
-			case _OP_PREPCALL:
-			case _OP_PREPCALLK:
+				  SQ_VM_NEXT;
+			SQ_VM_OP(_OP_PREPCALL):
+			SQ_VM_OP(_OP_PREPCALLK):
 				{
 					SQObjectPtr &key = _i_.op == _OP_PREPCALLK?(ci->_literals)[arg1]:STK(arg1);
 					SQObjectPtr &o = STK(arg2);
-					if (!Get(o, key, temp_reg,false,true)) {
+					bool got = _i_.op == _OP_PREPCALLK
+							? GetCached(o, key, temp_reg, _funcproto(_closure(ci->_closure)->_function)->GetMemberCacheSlot(ci->_ip - 1))
+							: Get(o, key, temp_reg, false, true);
+					if (!got) {
 						if(type(o) == OT_CLASS) { //hack?
 							if(_class_ddel->Get(key,temp_reg)) {
 								STK(arg3) = o;
 								TARGET = temp_reg;
-								continue;
+								SQ_VM_NEXT;
 							}
 						}
 						{ Raise_IdxError(key); SQ_THROW();}
@@ -867,8 +927,8 @@ common_call:
 					STK(arg3) = type(o) == OT_CLASS?STK(0):o;
 					TARGET = temp_reg;
 				}
-				continue;
-			case _OP_SCOPE_END:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_SCOPE_END):
 			{
 				SQInteger from = arg0;
 				SQInteger count = arg1 - arg0 + 2;
@@ -878,38 +938,38 @@ common_call:
 				if (_stackbase + count + from <= _top) {
 					while (--count >= 0) _stack._vals[_stackbase + count + from].Null();
 				}
-			} continue;
-			case _OP_GETK:
-				if (!Get(STK(arg2), ci->_literals[arg1], temp_reg, false,true)) { Raise_IdxError(ci->_literals[arg1]); SQ_THROW();}
+			} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_GETK):
+				if (!GetCached(STK(arg2), ci->_literals[arg1], temp_reg, _funcproto(_closure(ci->_closure)->_function)->GetMemberCacheSlot(ci->_ip - 1))) { Raise_IdxError(ci->_literals[arg1]); SQ_THROW();}
 				TARGET = temp_reg;
-				continue;
-			case _OP_MOVE: TARGET = STK(arg1); continue;
-			case _OP_NEWSLOT:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_MOVE): TARGET = STK(arg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NEWSLOT):
 				_GUARD(NewSlot(STK(arg1), STK(arg2), STK(arg3),false));
 				if(arg0 != arg3) TARGET = STK(arg3);
-				continue;
-			case _OP_DELETE: _GUARD(DeleteSlot(STK(arg1), STK(arg2), TARGET)); continue;
-			case _OP_SET:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_DELETE): _GUARD(DeleteSlot(STK(arg1), STK(arg2), TARGET)); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_SET):
 				if (!Set(STK(arg1), STK(arg2), STK(arg3),true)) { Raise_IdxError(STK(arg2)); SQ_THROW(); }
 				if (arg0 != arg3) TARGET = STK(arg3);
-				continue;
-			case _OP_GET:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_GET):
 				if (!Get(STK(arg1), STK(arg2), temp_reg, false,true)) { Raise_IdxError(STK(arg2)); SQ_THROW(); }
 				TARGET = temp_reg;
-				continue;
-			case _OP_EQ:{
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_EQ):{
 				bool res;
 				if(!IsEqual(STK(arg2),COND_LITERAL,res)) { SQ_THROW(); }
 				TARGET = res?_true_:_false_;
-				}continue;
-			case _OP_NE:{
+				}SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NE):{
 				bool res;
 				if(!IsEqual(STK(arg2),COND_LITERAL,res)) { SQ_THROW(); }
 				TARGET = (!res)?_true_:_false_;
-				} continue;
-			case _OP_ARITH: _GUARD(ARITH_OP( arg3 , temp_reg, STK(arg2), STK(arg1))); TARGET = temp_reg; continue;
-			case _OP_BITW:	_GUARD(BW_OP( arg3,TARGET,STK(arg2),STK(arg1))); continue;
-			case _OP_RETURN:
+				} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_ARITH): _GUARD(ARITH_OP( arg3 , temp_reg, STK(arg2), STK(arg1))); TARGET = temp_reg; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_BITW):	_GUARD(BW_OP( arg3,TARGET,STK(arg2),STK(arg1))); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_RETURN):
 				if(ci->_generator) {
 					ci->_generator->Kill();
 				}
@@ -918,65 +978,65 @@ common_call:
 					outres = temp_reg;
 					return true;
 				}
-				continue;
-			case _OP_LOADNULLS:{ for(SQInt32 n=0; n < arg1; n++) STK(arg0+n) = _null_; }continue;
-			case _OP_LOADROOTTABLE:	TARGET = _roottable; continue;
-			case _OP_LOADBOOL: TARGET = arg1?_true_:_false_; continue;
-			case _OP_DMOVE: STK(arg0) = STK(arg1); STK(arg2) = STK(arg3); continue;
-			case _OP_JMP: ci->_ip += (sarg1); continue;
-			case _OP_JNZ: if(!IsFalse(STK(arg0))) ci->_ip+=(sarg1); continue;
-			case _OP_JZ: if(IsFalse(STK(arg0))) ci->_ip+=(sarg1); continue;
-			case _OP_LOADFREEVAR: TARGET = _closure(ci->_closure)->_outervalues[arg1]; continue;
-			case _OP_VARGC: TARGET = SQInteger(ci->_vargs.size); continue;
-			case _OP_GETVARGV:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADNULLS):{ for(SQInt32 n=0; n < arg1; n++) STK(arg0+n) = _null_; }SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADROOTTABLE):	TARGET = _roottable; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADBOOL): TARGET = arg1?_true_:_false_; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_DMOVE): STK(arg0) = STK(arg1); STK(arg2) = STK(arg3); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_JMP): ci->_ip += (sarg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_JNZ): if(!IsFalse(STK(arg0))) ci->_ip+=(sarg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_JZ): if(IsFalse(STK(arg0))) ci->_ip+=(sarg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_LOADFREEVAR): TARGET = _closure(ci->_closure)->_outervalues[arg1]; SQ_VM_NEXT;
+			SQ_VM_OP(_OP_VARGC): TARGET = SQInteger(ci->_vargs.size); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_GETVARGV):
 				if(!GETVARGV_OP(TARGET,STK(arg1),ci)) { SQ_THROW(); }
-				continue;
-			case _OP_NEWTABLE: TARGET = SQTable::Create(_ss(this), arg1); continue;
-			case _OP_NEWARRAY: TARGET = SQArray::Create(_ss(this), 0); _array(TARGET)->Reserve(arg1); continue;
-			case _OP_APPENDARRAY: _array(STK(arg0))->Append(COND_LITERAL);	continue;
-			case _OP_GETPARENT: _GUARD(GETPARENT_OP(STK(arg1),TARGET)); continue;
-			case _OP_COMPARITH: _GUARD(DerefInc(arg3, TARGET, STK((((SQUnsignedInteger)arg1&0xFFFF0000)>>16)), STK(arg2), STK(arg1&0x0000FFFF), false)); continue;
-			case _OP_COMPARITHL: _GUARD(LOCAL_INC(arg3, TARGET, STK(arg1), STK(arg2))); continue;
-			case _OP_INC: {SQObjectPtr o(sarg3); _GUARD(DerefInc('+',TARGET, STK(arg1), STK(arg2), o, false));} continue;
-			case _OP_INCL: {SQObjectPtr o(sarg3); _GUARD(LOCAL_INC('+',TARGET, STK(arg1), o));} continue;
-			case _OP_PINC: {SQObjectPtr o(sarg3); _GUARD(DerefInc('+',TARGET, STK(arg1), STK(arg2), o, true));} continue;
-			case _OP_PINCL:	{SQObjectPtr o(sarg3); _GUARD(PLOCAL_INC('+',TARGET, STK(arg1), o));} continue;
-			case _OP_CMP:	_GUARD(CMP_OP((CmpOP)arg3,STK(arg2),STK(arg1),TARGET))	continue;
-			case _OP_EXISTS: TARGET = Get(STK(arg1), STK(arg2), temp_reg, true,false)?_true_:_false_;continue;
-			case _OP_INSTANCEOF:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NEWTABLE): TARGET = SQTable::Create(_ss(this), arg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NEWARRAY): TARGET = SQArray::Create(_ss(this), 0); _array(TARGET)->Reserve(arg1); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_APPENDARRAY): _array(STK(arg0))->Append(COND_LITERAL);	SQ_VM_NEXT;
+			SQ_VM_OP(_OP_GETPARENT): _GUARD(GETPARENT_OP(STK(arg1),TARGET)); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_COMPARITH): _GUARD(DerefInc(arg3, TARGET, STK((((SQUnsignedInteger)arg1&0xFFFF0000)>>16)), STK(arg2), STK(arg1&0x0000FFFF), false)); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_COMPARITHL): _GUARD(LOCAL_INC(arg3, TARGET, STK(arg1), STK(arg2))); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_INC): {SQObjectPtr o(sarg3); _GUARD(DerefInc('+',TARGET, STK(arg1), STK(arg2), o, false));} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_INCL): {SQObjectPtr o(sarg3); _GUARD(LOCAL_INC('+',TARGET, STK(arg1), o));} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_PINC): {SQObjectPtr o(sarg3); _GUARD(DerefInc('+',TARGET, STK(arg1), STK(arg2), o, true));} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_PINCL):	{SQObjectPtr o(sarg3); _GUARD(PLOCAL_INC('+',TARGET, STK(arg1), o));} SQ_VM_NEXT;
+			SQ_VM_OP(_OP_CMP):	_GUARD(CMP_OP((CmpOP)arg3,STK(arg2),STK(arg1),TARGET))	SQ_VM_NEXT;
+			SQ_VM_OP(_OP_EXISTS): TARGET = Get(STK(arg1), STK(arg2), temp_reg, true,false)?_true_:_false_;SQ_VM_NEXT;
+			SQ_VM_OP(_OP_INSTANCEOF):
 				if(type(STK(arg1)) != OT_CLASS || type(STK(arg2)) != OT_INSTANCE)
 				{Raise_Error("cannot apply instanceof between a %s and a %s",GetTypeName(STK(arg1)),GetTypeName(STK(arg2))); SQ_THROW();}
 				TARGET = _instance(STK(arg2))->InstanceOf(_class(STK(arg1)))?_true_:_false_;
-				continue;
-			case _OP_AND:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_AND):
 				if(IsFalse(STK(arg2))) {
 					TARGET = STK(arg2);
 					ci->_ip += (sarg1);
 				}
-				continue;
-			case _OP_OR:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_OR):
 				if(!IsFalse(STK(arg2))) {
 					TARGET = STK(arg2);
 					ci->_ip += (sarg1);
 				}
-				continue;
-			case _OP_NEG: _GUARD(NEG_OP(TARGET,STK(arg1))); continue;
-			case _OP_NOT: TARGET = (IsFalse(STK(arg1))?_true_:_false_); continue;
-			case _OP_BWNOT:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NEG): _GUARD(NEG_OP(TARGET,STK(arg1))); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NOT): TARGET = (IsFalse(STK(arg1))?_true_:_false_); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_BWNOT):
 				if(type(STK(arg1)) == OT_INTEGER) {
 					SQInteger t = _integer(STK(arg1));
 					TARGET = SQInteger(~t);
-					continue;
+					SQ_VM_NEXT;
 				}
 				Raise_Error("attempt to perform a bitwise op on a %s", GetTypeName(STK(arg1)));
 				SQ_THROW();
-			case _OP_CLOSURE: {
+			SQ_VM_OP(_OP_CLOSURE): {
 				SQClosure *c = ci->_closure._unVal.pClosure;
 				SQFunctionProto *fp = c->_function._unVal.pFunctionProto;
 				if(!CLOSURE_OP(TARGET,fp->_functions[arg1]._unVal.pFunctionProto)) { SQ_THROW(); }
-				continue;
+				SQ_VM_NEXT;
 			}
-			case _OP_YIELD:{
+			SQ_VM_OP(_OP_YIELD):{
 				if(ci->_generator) {
 					if(sarg1 != MAX_FUNC_STACKSIZE) temp_reg = STK(arg1);
 					_GUARD(ci->_generator->Yield(this));
@@ -991,43 +1051,43 @@ common_call:
 				}
 
 				}
-				continue;
-			case _OP_RESUME:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_RESUME):
 				if(type(STK(arg1)) != OT_GENERATOR){ Raise_Error("trying to resume a '%s',only genenerator can be resumed", GetTypeName(STK(arg1))); SQ_THROW();}
 				_GUARD(_generator(STK(arg1))->Resume(this, arg0));
 				traps += ci->_etraps;
-                continue;
-			case _OP_FOREACH:{ int tojump;
+                SQ_VM_NEXT;
+			SQ_VM_OP(_OP_FOREACH):{ int tojump;
 				_GUARD(FOREACH_OP(STK(arg0),STK(arg2),STK(arg2+1),STK(arg2+2),arg2,sarg1,tojump));
 				ci->_ip += tojump; }
-				continue;
-			case _OP_POSTFOREACH:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_POSTFOREACH):
 				assert(type(STK(arg0)) == OT_GENERATOR);
 				if(_generator(STK(arg0))->_state == SQGenerator::eDead)
 					ci->_ip += (sarg1 - 1);
-				continue;
-			case _OP_DELEGATE: _GUARD(DELEGATE_OP(TARGET,STK(arg1),STK(arg2))); continue;
-			case _OP_CLONE:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_DELEGATE): _GUARD(DELEGATE_OP(TARGET,STK(arg1),STK(arg2))); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_CLONE):
 				if(!Clone(STK(arg1), TARGET))
 				{ Raise_Error("cloning a %s", GetTypeName(STK(arg1))); SQ_THROW();}
-				continue;
-			case _OP_TYPEOF: TypeOf(STK(arg1), TARGET); continue;
-			case _OP_PUSHTRAP:{
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_TYPEOF): TypeOf(STK(arg1), TARGET); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_PUSHTRAP):{
 				SQInstruction *_iv = _funcproto(_closure(ci->_closure)->_function)->_instructions;
 				_etraps.push_back(SQExceptionTrap(_top,_stackbase, &_iv[(ci->_ip-_iv)+arg1], arg0)); traps++;
 				ci->_etraps++;
 							  }
-				continue;
-			case _OP_POPTRAP: {
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_POPTRAP): {
 				for(SQInteger i = 0; i < arg0; i++) {
 					_etraps.pop_back(); traps--;
 					ci->_etraps--;
 				}
 							  }
-				continue;
-			case _OP_THROW:	Raise_Error(TARGET); SQ_THROW();
-			case _OP_CLASS: _GUARD(CLASS_OP(TARGET,arg1,arg2)); continue;
-			case _OP_NEWSLOTA:
+				SQ_VM_NEXT;
+			SQ_VM_OP(_OP_THROW):	Raise_Error(TARGET); SQ_THROW();
+			SQ_VM_OP(_OP_CLASS): _GUARD(CLASS_OP(TARGET,arg1,arg2)); SQ_VM_NEXT;
+			SQ_VM_OP(_OP_NEWSLOTA): {
 				bool bstatic = (arg0&NEW_SLOT_STATIC_FLAG) != 0;
 				if(type(STK(arg1)) == OT_CLASS) {
 					if(type(_class(STK(arg1))->_metamethods[MT_NEWMEMBER]) != OT_NULL ) {
@@ -1037,7 +1097,7 @@ common_call:
 						int nparams = 5;
 						if(Call(_class(STK(arg1))->_metamethods[MT_NEWMEMBER], nparams, _top - nparams, temp_reg,SQFalse,SQFalse)) {
 							Pop(nparams);
-							continue;
+							SQ_VM_NEXT;
 						}
 					}
 				}
@@ -1045,10 +1105,13 @@ common_call:
 				if((arg0&NEW_SLOT_ATTRIBUTES_FLAG)) {
 					_class(STK(arg1))->SetAttributes(STK(arg2),STK(arg2-1));
 				}
-				continue;
+				SQ_VM_NEXT;
+			}
+#ifndef SQ_THREADED_DISPATCH
 			}
 
 		}
+#endif
 	}
 exception_trap:
 	{
@@ -1135,6 +1198,14 @@ void SQVM::CallDebugHook(SQInteger type,SQInteger forcedline)
 	Pop(nparams);
 }
 
+void SQVM::CallProfileHook(SQInteger event_type)
+{
+	SQFunctionProto *func=_funcproto(_closure(ci->_closure)->_function);
+	_profilehook(this,event_type,
+		type(func->_sourcename) == OT_STRING ? _stringval(func->_sourcename) : nullptr,
+		type(func->_name) == OT_STRING ? _stringval(func->_name) : nullptr);
+}
+
 bool SQVM::CallNative(SQNativeClosure *nclosure,SQInteger nargs,SQInteger stackbase,SQObjectPtr &retval,bool &suspend)
 {
 	if (_nnativecalls + 1 > MAX_NATIVE_CALLS) { Raise_Error("Native stack overflow"); return false; }
@@ -1225,6 +1296,45 @@ bool SQVM::CallNative(SQNativeClosure *nclosure,SQInteger nargs,SQInteger stackb
 	return true;
 }
 
+/* Variant of Get for lookup sites with a literal key, backed by a monomorphic
+ * inline cache. Member handles of a locked class never change and lookups on
+ * instances always go through a locked class, so a cache entry stays valid for
+ * the lifetime of its class; SQClass::_cache_generation catches a destroyed
+ * class' address being reused. Anything the cache cannot serve falls back to
+ * the generic Get. */
+bool SQVM::GetCached(const SQObjectPtr &self,const SQObjectPtr &key,SQObjectPtr &dest,SQMemberCache *cache)
+{
+	SQClass *klass;
+	switch(type(self)){
+	case OT_INSTANCE: klass = _instance(self)->_class; break;
+	case OT_CLASS: klass = _class(self); break;
+	default: klass = nullptr; break;
+	}
+	if(klass != nullptr && klass->_locked) {
+		SQInteger handle;
+		if(cache->_klass == klass && cache->_generation == SQClass::_cache_generation) {
+			handle = cache->_handle;
+		}
+		else {
+			SQObjectPtr memberval;
+			if(!klass->_members->Get(key,memberval)) return Get(self,key,dest,false,true);
+			handle = _integer(memberval);
+			cache->_klass = klass;
+			cache->_handle = handle;
+			cache->_generation = SQClass::_cache_generation;
+		}
+		if(handle & MEMBER_TYPE_FIELD) {
+			SQObjectPtr &o = type(self) == OT_INSTANCE ? _instance(self)->_values[handle & 0x00FFFFFF] : klass->_defaultvalues[handle & 0x00FFFFFF].val;
+			dest = _realval(o);
+		}
+		else {
+			dest = klass->_methods[handle & 0x00FFFFFF].val;
+		}
+		return true;
+	}
+	return Get(self,key,dest,false,true);
+}
+
 bool SQVM::Get(const SQObjectPtr &self,const SQObjectPtr &key,SQObjectPtr &dest,bool raw, bool fetchroot)
 {
 	switch(type(self)){
@@ -11,6 +11,8 @@
 //base lib
 void sq_base_register(HSQUIRRELVM v);
 
+struct SQMemberCache;
+
 struct SQExceptionTrap{
 	SQExceptionTrap(SQInteger ss, SQInteger stackbase,SQInstruction *ip, SQInteger ex_target)
 		: _stackbase(stackbase), _stacksize(ss), _ip(ip), _extarget(ex_target) {}
@@ -66,8 +68,10 @@ public:
 	SQRESULT Suspend();
 
 	void CallDebugHook(SQInteger type,SQInteger forcedline=0);
+	void CallProfileHook(SQInteger event_type);
 	void CallErrorHandler(SQObjectPtr &e);
 	bool Get(const SQObjectPtr &self, const SQObjectPtr &key, SQObjectPtr &dest, bool raw, bool fetchroot);
+	bool GetCached(const SQObjectPtr &self, const SQObjectPtr &key, SQObjectPtr &dest, SQMemberCache *cache);
 	bool FallBackGet(const SQObjectPtr &self,const SQObjectPtr &key,SQObjectPtr &dest,bool raw);
 	bool Set(const SQObjectPtr &self, const SQObjectPtr &key, const SQObjectPtr &val, bool fetchroot);
 	bool NewSlot(const SQObjectPtr &self, const SQObjectPtr &key, const SQObjectPtr &val,bool bstatic);
@@ -144,6 +148,7 @@ public:
 	SQObjectPtr _lasterror;
 	SQObjectPtr _errorhandler;
 	SQObjectPtr _debughook;
+	SQPROFILEHOOK _profilehook;
 
 	SQObjectPtr temp_reg;
 
@@ -76,18 +76,23 @@
 	/* The speed with which AIs go, is limited by the 'competitor_speed' */
 	AI::frame_counter++;
 	assert(_settings_game.difficulty.competitor_speed <= 4);
-	if ((AI::frame_counter & ((1 << (4 - _settings_game.difficulty.competitor_speed)) - 1)) != 0) return;
+	const uint32 interval_mask = (1 << (4 - _settings_game.difficulty.competitor_speed)) - 1;
 
 	Backup<CompanyID> cur_company(_current_company, FILE_LINE);
 	for (const Company *c : Company::Iterate()) {
 		if (c->is_ai) {
+			/* Stagger the AIs across the frames of the interval, so that their
+			 * script execution is spread out instead of all of it landing in
+			 * the same frame. Each AI still runs once per interval. */
+			if (((AI::frame_counter + c->index) & interval_mask) != 0) continue;
+
 			SCOPE_INFO_FMT([&], "AI::GameLoop: %i: %s (v%d)\n", (int)c->index, c->ai_info->GetName(), c->ai_info->GetVersion());
 			PerformanceMeasurer framerate((PerformanceElement)(PFE_AI0 + c->index));
 			cur_company.Change(c->index);
 			c->ai_instance->GameLoop();
 			/* Occasionally collect garbage; every 255 ticks do one company.
 			 * Effectively collecting garbage once every two months per AI. */
-			if ((AI::frame_counter & 255) == 0 && (CompanyID)GB(AI::frame_counter, 8, 4) == c->index) {
+			if (((AI::frame_counter + c->index) & 255) == 0 && (CompanyID)GB(AI::frame_counter + c->index, 8, 4) == c->index) {
 				c->ai_instance->CollectGarbage();
 			}
 		} else {
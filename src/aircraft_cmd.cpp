@@ -1478,6 +1478,7 @@ static void MaybeCrashAirplane(Aircraft *v)
 	/* Crash the airplane. Remove all goods stored at the station. */
 	for (CargoID i = 0; i < NUM_CARGO; i++) {
 		st->goods[i].rating = 1;
+		SetBit(st->goods_rating_pending, i);
 		st->goods[i].cargo.Truncate();
 	}
 
@@ -1920,28 +1921,16 @@ static bool AirportMove(Aircraft *v, const AirportFTAClass *apc)
 
 	v->previous_pos = v->pos; // save previous location
 
-	/* there is only one choice to move to */
-	if (current->next == nullptr) {
-		if (AirportSetBlocks(v, current, apc)) {
-			v->pos = current->next_position;
+	/* take the precomputed transition that matches our heading */
+	const AirportFTA *transition = apc->GetTransition(v->pos, v->state);
+	if (transition != nullptr) {
+		if (AirportSetBlocks(v, transition, apc)) {
+			v->pos = transition->next_position;
 			UpdateAircraftCache(v);
 		} // move to next position
 		return false;
 	}
 
-	/* there are more choices to choose from, choose the one that
-	 * matches our heading */
-	do {
-		if (v->state == current->heading || current->heading == TO_ALL) {
-			if (AirportSetBlocks(v, current, apc)) {
-				v->pos = current->next_position;
-				UpdateAircraftCache(v);
-			} // move to next position
-			return false;
-		}
-		current = current->next;
-	} while (current != nullptr);
-
 	DEBUG(misc, 0, "[Ap] cannot move further on Airport! (pos %d state %d) for vehicle %d", v->pos, v->state, v->index);
 	NOT_REACHED();
 }
@@ -2230,7 +2219,7 @@ static bool AircraftEventHandler(Aircraft *v, int loop)
 bool Aircraft::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("Aircraft::Tick: v: %u, x: %d, y: %d", this->index, this->x_pos, this->y_pos);
-	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos);
+	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos, SCA_VEHICLES);
 	if (!this->IsNormalAircraft()) return true;
 
 	this->tick_counter++;
@@ -67,6 +67,7 @@ AIRPORT_GENERIC(dummy, nullptr, 0, AirportFTAClass::ALL, 0)
 
 static uint16 AirportGetNofElements(const AirportFTAbuildup *apFA);
 static AirportFTA *AirportBuildAutomata(uint nofelements, const AirportFTAbuildup *apFA);
+static const AirportFTA **AirportBuildTransitionTable(uint nofelements, const AirportFTA *layout);
 
 
 /**
@@ -127,6 +128,7 @@ AirportFTAClass::AirportFTAClass(
 {
 	/* Build the state machine itself */
 	this->layout = AirportBuildAutomata(this->nofelements, apFA);
+	this->transitions = AirportBuildTransitionTable(this->nofelements, this->layout);
 }
 
 AirportFTAClass::~AirportFTAClass()
@@ -140,6 +142,7 @@ AirportFTAClass::~AirportFTAClass()
 		}
 	}
 	free(layout);
+	free(transitions);
 }
 
 /**
@@ -199,6 +202,43 @@ static AirportFTA *AirportBuildAutomata(uint nofelements, const AirportFTAbuildu
 	return FAutomata;
 }
 
+/**
+ * Build the dense (position, heading) transition table of an FTA.
+ * For each position and each possible heading this records the movement
+ * choice that walking the linked list of choices at that position would
+ * select, so that the per-movement-step list search becomes an array lookup.
+ * @param nofelements The number of elements in the FTA.
+ * @param layout The constructed FTA layout.
+ * @return The transition table, with #MAX_HEADINGS + 1 entries per position.
+ */
+static const AirportFTA **AirportBuildTransitionTable(uint nofelements, const AirportFTA *layout)
+{
+	const AirportFTA **table = CallocT<const AirportFTA *>(nofelements * (MAX_HEADINGS + 1));
+
+	for (uint i = 0; i < nofelements; i++) {
+		const AirportFTA **row = &table[i * (MAX_HEADINGS + 1)];
+		const AirportFTA *head = &layout[i];
+
+		if (head->next == nullptr) {
+			/* There is only one choice to move to; it is taken regardless of the heading. */
+			for (uint heading = 0; heading <= MAX_HEADINGS; heading++) row[heading] = head;
+			continue;
+		}
+
+		/* The first element in the list matching the heading (or TO_ALL) wins. */
+		for (const AirportFTA *current = head; current != nullptr; current = current->next) {
+			if (current->heading == TO_ALL) {
+				for (uint heading = 0; heading <= MAX_HEADINGS; heading++) {
+					if (row[heading] == nullptr) row[heading] = current;
+				}
+			} else if (row[current->heading] == nullptr) {
+				row[current->heading] = current;
+			}
+		}
+	}
+	return table;
+}
+
 /**
  * Get the finite state machine of an airport type.
  * @param airport_type %Airport type to query FTA from. @see AirportTypes
@@ -173,8 +173,23 @@ public:
 		return &moving_data[position];
 	}
 
+	/**
+	 * Get the transition to take from a position for a given heading.
+	 * This is the same choice the movement choice linked list at \a position
+	 * would yield, precomputed at construction time for O(1) lookup.
+	 * @param position Element number to leave from.
+	 * @param heading Heading (current orders) of the aircraft.
+	 * @return The transition to take, or \c nullptr if no transition matches.
+	 */
+	const struct AirportFTA *GetTransition(byte position, byte heading) const
+	{
+		assert(position < nofelements && heading <= MAX_HEADINGS);
+		return transitions[position * (MAX_HEADINGS + 1) + heading];
+	}
+
 	const AirportMovingData *moving_data; ///< Movement data.
 	struct AirportFTA *layout;            ///< state machine for airport
+	const struct AirportFTA **transitions; ///< transition for each (position, heading) pair, #MAX_HEADINGS + 1 entries per position
 	const byte *terminals;                ///< %Array with the number of terminal groups, followed by the number of terminals in each group.
 	const byte num_helipads;              ///< Number of helipads on this airport. When 0 helicopters will go to normal terminals.
 	Flags flags;                          ///< Flags for this airport type.
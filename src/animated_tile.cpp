@@ -22,6 +22,45 @@
 /** The table/list with animated tiles. */
 btree::btree_map<TileIndex, AnimatedTileInfo> _animated_tiles;
 
+/** Tile types which can carry animated tiles, used to group handler dispatch. */
+enum AnimatedTileGroup {
+	ATG_HOUSE,    ///< Tiles animated by AnimateTile_Town
+	ATG_STATION,  ///< Tiles animated by AnimateTile_Station
+	ATG_INDUSTRY, ///< Tiles animated by AnimateTile_Industry
+	ATG_OBJECT,   ///< Tiles animated by AnimateTile_Object
+	ATG_END,
+};
+
+/** Tiles of one animation speed class, grouped by tile type. */
+struct AnimatedTileBucket {
+	std::vector<TileIndex> tiles[ATG_END];
+};
+
+/**
+ * Animated tiles bucketed by their animation speed (period exponent), so a
+ * tick only needs to visit the buckets which are actually due that tick.
+ * A tile with speed s is due when s <= FindFirstBit(tick counter), so speeds
+ * above 32 can never fire and such tiles are simply not bucketed.
+ */
+static AnimatedTileBucket _animated_tile_buckets[33];
+
+/** Generation of the animated tile table the buckets were last rebuilt from. */
+static uint64 _animated_tile_bucket_generation = UINT64_MAX;
+
+/**
+ * Generation counter of the animated tile table, incremented whenever the
+ * table changes in a way that affects the saved ANIT chunk. Mutations done
+ * directly by the savegame loaders are covered by the increment in
+ * InitializeAnimatedTiles, which precedes any load.
+ */
+static uint64 _animated_tile_generation = 0;
+
+/** Get the current generation counter of the animated tile table. */
+uint64 GetAnimatedTileGeneration()
+{
+	return _animated_tile_generation;
+}
+
 /**
  * Removes the given tile from the animated tile table.
  * @param tile the tile to remove
@@ -31,6 +70,7 @@ void DeleteAnimatedTile(TileIndex tile)
 	auto to_remove = _animated_tiles.find(tile);
 	if (to_remove != _animated_tiles.end() && !to_remove->second.pending_deletion) {
 		to_remove->second.pending_deletion = true;
+		_animated_tile_generation++;
 		MarkTileDirtyByTile(tile, VMDF_NOT_MAP_MODE);
 	}
 }
@@ -76,6 +116,7 @@ void AddAnimatedTile(TileIndex tile, bool mark_dirty)
 	AnimatedTileInfo &info = _animated_tiles[tile];
 	UpdateAnimatedTileSpeed(tile, info);
 	info.pending_deletion = false;
+	_animated_tile_generation++;
 }
 
 int GetAnimatedTileSpeed(TileIndex tile)
@@ -87,20 +128,28 @@ int GetAnimatedTileSpeed(TileIndex tile)
 	return -1;
 }
 
+/** Get the handler dispatch group for an animated tile. */
+static AnimatedTileGroup GetAnimatedTileGroup(TileIndex tile)
+{
+	switch (GetTileType(tile)) {
+		case MP_HOUSE:    return ATG_HOUSE;
+		case MP_STATION:  return ATG_STATION;
+		case MP_INDUSTRY: return ATG_INDUSTRY;
+		case MP_OBJECT:   return ATG_OBJECT;
+		default:          NOT_REACHED();
+	}
+}
+
 /**
- * Animate all tiles in the animated tile list, i.e.\ call AnimateTile on them.
+ * Rebuild the animation speed buckets from the animated tile table.
+ * Entries pending deletion are erased from the table here, as the old
+ * per-tick scan used to do.
  */
-void AnimateAnimatedTiles()
+static void RebuildAnimatedTileBuckets()
 {
-	extern void AnimateTile_Town(TileIndex tile);
-	extern void AnimateTile_Station(TileIndex tile);
-	extern void AnimateTile_Industry(TileIndex tile);
-	extern void AnimateTile_Object(TileIndex tile);
-
-	PerformanceAccumulator framerate(PFE_GL_LANDSCAPE);
-
-	const uint32 ticks = (uint) _scaled_tick_counter;
-	const uint8 max_speed = (ticks == 0) ? 32 : FindFirstBit(ticks);
+	for (AnimatedTileBucket &bucket : _animated_tile_buckets) {
+		for (std::vector<TileIndex> &tiles : bucket.tiles) tiles.clear();
+	}
 
 	auto iter = _animated_tiles.begin();
 	while (iter != _animated_tiles.end()) {
@@ -109,35 +158,63 @@ void AnimateAnimatedTiles()
 			continue;
 		}
 
-		if (iter->second.speed <= max_speed) {
-			const TileIndex curr = iter->first;
-			switch (GetTileType(curr)) {
-				case MP_HOUSE:
-					AnimateTile_Town(curr);
-					break;
+		if (iter->second.speed < lengthof(_animated_tile_buckets)) {
+			_animated_tile_buckets[iter->second.speed].tiles[GetAnimatedTileGroup(iter->first)].push_back(iter->first);
+		}
+		++iter;
+	}
+
+	_animated_tile_bucket_generation = _animated_tile_generation;
+}
+
+/**
+ * Animate all due tiles in the animated tile list, i.e.\ call AnimateTile on them.
+ */
+void AnimateAnimatedTiles()
+{
+	extern void AnimateTile_Town(TileIndex tile);
+	extern void AnimateTile_Station(TileIndex tile);
+	extern void AnimateTile_Industry(TileIndex tile);
+	extern void AnimateTile_Object(TileIndex tile);
 
-				case MP_STATION:
-					AnimateTile_Station(curr);
-					break;
+	static void (* const animate_handlers[ATG_END])(TileIndex) = {
+		AnimateTile_Town,     // ATG_HOUSE
+		AnimateTile_Station,  // ATG_STATION
+		AnimateTile_Industry, // ATG_INDUSTRY
+		AnimateTile_Object,   // ATG_OBJECT
+	};
 
-				case MP_INDUSTRY:
-					AnimateTile_Industry(curr);
-					break;
+	PerformanceAccumulator framerate(PFE_GL_LANDSCAPE);
 
-				case MP_OBJECT:
-					AnimateTile_Object(curr);
-					break;
+	if (_animated_tile_bucket_generation != _animated_tile_generation) RebuildAnimatedTileBuckets();
 
-				default:
-					NOT_REACHED();
+	const uint32 ticks = (uint) _scaled_tick_counter;
+	const uint8 max_speed = (ticks == 0) ? 32 : FindFirstBit(ticks);
+	const uint8 last_bucket = std::min<uint8>(max_speed, lengthof(_animated_tile_buckets) - 1);
+
+	const uint64 gen = _animated_tile_generation;
+	for (uint8 speed = 0; speed <= last_bucket; speed++) {
+		AnimatedTileBucket &bucket = _animated_tile_buckets[speed];
+		for (uint group = 0; group < ATG_END; group++) {
+			void (* const handler)(TileIndex) = animate_handlers[group];
+			for (TileIndex tile : bucket.tiles[group]) {
+				if (_animated_tile_generation != gen) {
+					/* A handler changed the animated tile table during this tick,
+					 * the buckets are stale: verify each remaining tile against
+					 * the table before animating it. */
+					auto iter = _animated_tiles.find(tile);
+					if (iter == _animated_tiles.end() || iter->second.pending_deletion) continue;
+					if (GetAnimatedTileGroup(tile) != (AnimatedTileGroup)group) continue;
+				}
+				handler(tile);
 			}
 		}
-		++iter;
 	}
 }
 
 void UpdateAllAnimatedTileSpeeds()
 {
+	_animated_tile_generation++;
 	auto iter = _animated_tiles.begin();
 	while (iter != _animated_tiles.end()) {
 		if (iter->second.pending_deletion) {
@@ -155,4 +232,5 @@ void UpdateAllAnimatedTileSpeeds()
 void InitializeAnimatedTiles()
 {
 	_animated_tiles.clear();
+	_animated_tile_generation++;
 }
@@ -17,5 +17,6 @@ void DeleteAnimatedTile(TileIndex tile);
 void AnimateAnimatedTiles();
 void UpdateAllAnimatedTileSpeeds();
 void InitializeAnimatedTiles();
+uint64 GetAnimatedTileGeneration();
 
 #endif /* ANIMATED_TILE_FUNC_H */
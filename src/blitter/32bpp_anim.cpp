@@ -23,6 +23,7 @@ static FBlitter_32bppAnim iFBlitter_32bppAnim;
 Blitter_32bppAnim::~Blitter_32bppAnim()
 {
 	free(this->anim_alloc);
+	free(this->anim_row_dirty);
 }
 
 template <BlitterMode mode, bool fast_path>
@@ -42,6 +43,11 @@ inline void Blitter_32bppAnim::Draw(const Blitter::BlitterParams *bp, ZoomLevel
 	Colour *dst = (Colour *)bp->dst + bp->top * bp->pitch + bp->left;
 	uint16 *anim = this->anim_buf + this->ScreenToAnimOffset((uint32 *)bp->dst) + bp->top * this->anim_buf_pitch + bp->left;
 
+	if (mode != BM_TRANSPARENT && mode != BM_BLACK_REMAP && !fast_path) {
+		/* This sprite may store animated palette indices in the anim buffer. */
+		this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)bp->dst) / this->anim_buf_pitch + bp->top, bp->height);
+	}
+
 	const byte *remap = bp->remap; // store so we don't have to access it via bp every time
 	const int width = bp->width;
 	const int pitch = bp->pitch;
@@ -397,6 +403,7 @@ void Blitter_32bppAnim::SetPixel(void *video, int x, int y, uint8 colour)
 	/* Set the colour in the anim-buffer too, if we are rendering to the screen */
 	if (_screen_disable_anim) return;
 	this->anim_buf[this->ScreenToAnimOffset((uint32 *)video) + x + y * this->anim_buf_pitch] = colour | (DEFAULT_BRIGHTNESS << 8);
+	this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)video) / this->anim_buf_pitch + y, 1);
 }
 
 void Blitter_32bppAnim::SetPixel32(void *video, int x, int y, uint8 colour, uint32 colour32)
@@ -419,6 +426,8 @@ void Blitter_32bppAnim::DrawLine(void *video, int x, int y, int x2, int y2, int
 	} else {
 		uint16 * const offset_anim_buf = this->anim_buf + this->ScreenToAnimOffset((uint32 *)video);
 		const uint16 anim_colour = colour | (DEFAULT_BRIGHTNESS << 8);
+		/* Over-estimate the vertical extent of the line by its width; rows outside the buffer are ignored. */
+		this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)video) / this->anim_buf_pitch + std::min(y, y2) - width, Delta(y, y2) + 2 * width + 1);
 		this->DrawLineGeneric(x, y, x2, y2, screen_width, screen_height, width, dash, [&](int x, int y) {
 			*((Colour *)video + x + y * _screen.pitch) = c;
 			offset_anim_buf[x + y * this->anim_buf_pitch] = anim_colour;
@@ -443,6 +452,7 @@ void Blitter_32bppAnim::SetRect(void *video, int x, int y, const uint8 *colours,
 		} while (--lines);
 	} else {
 		uint16 *dstanim = (uint16 *)(&this->anim_buf[this->ScreenToAnimOffset((uint32 *)video) + x + y * this->anim_buf_pitch]);
+		this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)video) / this->anim_buf_pitch + y, lines);
 		do {
 			uint w = width;
 			do {
@@ -491,6 +501,7 @@ void Blitter_32bppAnim::DrawRect(void *video, int width, int height, uint8 colou
 
 	Colour colour32 = LookupColourInPalette(colour);
 	uint16 *anim_line = this->ScreenToAnimOffset((uint32 *)video) + this->anim_buf;
+	this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)video) / this->anim_buf_pitch, height);
 
 	do {
 		Colour *dst = (Colour *)video;
@@ -521,6 +532,9 @@ void Blitter_32bppAnim::CopyFromBuffer(void *video, const void *src, int width,
 	const uint32 *usrc = (const uint32 *)src;
 	uint16 *anim_line = this->ScreenToAnimOffset((uint32 *)video) + this->anim_buf;
 
+	/* The buffer may hold animated palette indices for the restored area. */
+	this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)video) / this->anim_buf_pitch, height);
+
 	for (; height > 0; height--) {
 		/* We need to keep those for palette animation. */
 		Colour *dst_pal = dst;
@@ -581,6 +595,9 @@ void Blitter_32bppAnim::ScrollBuffer(void *video, int left, int top, int width,
 	assert(video >= _screen.dst_ptr && video <= (uint32 *)_screen.dst_ptr + _screen.width + _screen.height * _screen.pitch);
 	uint16 *dst, *src;
 
+	/* Scrolling may move animated pixels into rows that were clean before. */
+	this->MarkAnimRowsDirty(top, height);
+
 	/* We need to scroll the anim-buffer too */
 	if (scroll_y > 0) {
 		dst = this->anim_buf + left + (top + height - 1) * this->anim_buf_pitch;
@@ -644,27 +661,45 @@ void Blitter_32bppAnim::PaletteAnimate(const Palette &palette)
 	const uint16 *anim = this->anim_buf;
 	Colour *dst = (Colour *)_screen.dst_ptr;
 
+	int dirty_top = -1;
+	int dirty_bottom = -1;
+
 	/* Let's walk the anim buffer and try to find the pixels */
 	const int width = this->anim_buf_width;
-	const int pitch_offset = _screen.pitch - width;
-	const int anim_pitch_offset = this->anim_buf_pitch - width;
-	for (int y = this->anim_buf_height; y != 0 ; y--) {
-		for (int x = width; x != 0 ; x--) {
-			uint16 value = *anim;
-			uint8 colour = GB(value, 0, 8);
-			if (colour >= PALETTE_ANIM_START) {
-				/* Update this pixel */
-				*dst = this->AdjustBrightness(LookupColourInPalette(colour), GB(value, 8, 8));
+	const int screen_pitch = _screen.pitch;
+	const int anim_pitch = this->anim_buf_pitch;
+	for (int y = 0; y < this->anim_buf_height; y++) {
+		Colour *next_dst_ln = dst + screen_pitch;
+		const uint16 *next_anim_ln = anim + anim_pitch;
+		if (this->anim_row_dirty[y]) {
+			bool row_dirty = false;
+			for (int x = width; x != 0 ; x--) {
+				uint16 value = *anim;
+				uint8 colour = GB(value, 0, 8);
+				if (colour >= PALETTE_ANIM_START) {
+					/* Update this pixel */
+					*dst = this->AdjustBrightness(LookupColourInPalette(colour), GB(value, 8, 8));
+					row_dirty = true;
+				}
+				dst++;
+				anim++;
+			}
+			if (row_dirty) {
+				if (dirty_top < 0) dirty_top = y;
+				dirty_bottom = y;
+			} else {
+				/* No animated pixels were left in this row; skip it until a blitting operation touches it again. */
+				this->anim_row_dirty[y] = 0;
 			}
-			dst++;
-			anim++;
 		}
-		dst += pitch_offset;
-		anim += anim_pitch_offset;
+		dst = next_dst_ln;
+		anim = next_anim_ln;
 	}
 
-	/* Make sure the backend redraws the whole screen */
-	VideoDriver::GetInstance()->MakeDirty(0, 0, _screen.width, _screen.height);
+	if (dirty_top >= 0) {
+		/* Make sure the backend redraws the rows containing animated pixels */
+		VideoDriver::GetInstance()->MakeDirty(0, dirty_top, _screen.width, dirty_bottom - dirty_top + 1);
+	}
 }
 
 Blitter::PaletteAnimation Blitter_32bppAnim::UsePaletteAnimation()
@@ -677,10 +712,13 @@ void Blitter_32bppAnim::PostResize()
 	if (_screen.width != this->anim_buf_width || _screen.height != this->anim_buf_height) {
 		/* The size of the screen changed; we can assume we can wipe all data from our buffer */
 		free(this->anim_alloc);
+		free(this->anim_row_dirty);
 		this->anim_buf_width = _screen.width;
 		this->anim_buf_height = _screen.height;
 		this->anim_buf_pitch = (_screen.width + 7) & ~7;
 		this->anim_alloc = CallocT<uint16>(this->anim_buf_pitch * this->anim_buf_height + 8);
+		/* The buffer is zeroed, so no row contains animated pixels yet. */
+		this->anim_row_dirty = CallocT<uint8>(this->anim_buf_height);
 
 		/* align buffer to next 16 byte boundary */
 		this->anim_buf = reinterpret_cast<uint16 *>((reinterpret_cast<uintptr_t>(this->anim_alloc) + 0xF) & (~0xF));
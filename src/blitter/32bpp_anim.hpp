@@ -15,17 +15,19 @@
 /** The optimised 32 bpp blitter with palette animation. */
 class Blitter_32bppAnim : public Blitter_32bppOptimized {
 protected:
-	uint16 *anim_buf;    ///< In this buffer we keep track of the 8bpp indexes so we can do palette animation
-	void *anim_alloc;    ///< The raw allocated buffer, not necessarily aligned correctly
-	int anim_buf_width;  ///< The width of the animation buffer.
-	int anim_buf_pitch;  ///< The pitch of the animation buffer (width rounded up to 16 byte boundary).
-	int anim_buf_height; ///< The height of the animation buffer.
-	Palette palette;     ///< The current palette.
+	uint16 *anim_buf;      ///< In this buffer we keep track of the 8bpp indexes so we can do palette animation
+	void *anim_alloc;      ///< The raw allocated buffer, not necessarily aligned correctly
+	uint8 *anim_row_dirty; ///< Per-row occupancy flags for \c anim_buf; a zero entry means the row contains no animated pixels and palette animation may skip it.
+	int anim_buf_width;    ///< The width of the animation buffer.
+	int anim_buf_pitch;    ///< The pitch of the animation buffer (width rounded up to 16 byte boundary).
+	int anim_buf_height;   ///< The height of the animation buffer.
+	Palette palette;       ///< The current palette.
 
 public:
 	Blitter_32bppAnim() :
 		anim_buf(nullptr),
 		anim_alloc(nullptr),
+		anim_row_dirty(nullptr),
 		anim_buf_width(0),
 		anim_buf_pitch(0),
 		anim_buf_height(0)
@@ -72,6 +74,22 @@ public:
 		return across + (lines * this->anim_buf_pitch);
 	}
 
+	/**
+	 * Mark a range of rows of the animation buffer as possibly containing
+	 * animated palette indices, so that the next palette animation pass
+	 * rescans them. Rows outside the buffer are silently ignored, so
+	 * callers may over-estimate the touched area.
+	 * @param first_row The first touched row of the animation buffer.
+	 * @param rows      The number of touched rows.
+	 */
+	inline void MarkAnimRowsDirty(int first_row, int rows)
+	{
+		int last_row = std::min(first_row + rows, this->anim_buf_height);
+		first_row = std::max(first_row, 0);
+		if (first_row >= last_row) return;
+		memset(this->anim_row_dirty + first_row, 1, last_row - first_row);
+	}
+
 	template <BlitterMode mode, bool no_anim_translucent> void Draw(const Blitter::BlitterParams *bp, ZoomLevel zoom);
 };
 
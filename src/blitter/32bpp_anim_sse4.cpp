@@ -37,6 +37,11 @@ inline void Blitter_32bppSSE4_Anim::Draw(const Blitter::BlitterParams *bp, ZoomL
 	uint16 *anim_line = this->anim_buf + this->ScreenToAnimOffset((uint32 *)bp->dst) + bp->top * this->anim_buf_pitch + bp->left;
 	int effective_width = bp->width;
 
+	if (animated && mode != BM_TRANSPARENT && mode != BM_BLACK_REMAP) {
+		/* This sprite may store animated palette indices in the anim buffer. */
+		this->MarkAnimRowsDirty(this->ScreenToAnimOffset((uint32 *)bp->dst) / this->anim_buf_pitch + bp->top, bp->height);
+	}
+
 	/* Find where to start reading in the source sprite. */
 	const Blitter_32bppSSE_Base::SpriteData * const sd = (const Blitter_32bppSSE_Base::SpriteData *) bp->sprite;
 	const SpriteInfo * const si = &sd->infos[zoom];
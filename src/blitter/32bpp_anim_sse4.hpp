@@ -42,6 +42,9 @@ public:
 	Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator) override {
 		return Blitter_32bppSSE_Base::Encode(sprite, allocator);
 	}
+	void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max) override {
+		Blitter_32bppSSE_Base::GetEncodeZoomRange(zoom_min, zoom_max);
+	}
 	const char *GetName() override { return "32bpp-sse4-anim"; }
 	using Blitter_32bppSSE2_Anim::LookupColourInPalette;
 };
@@ -465,3 +465,11 @@ Sprite *Blitter_32bppOptimized::Encode(const SpriteLoader::Sprite *sprite, Alloc
 {
 	return this->EncodeInternal<true>(sprite, allocator);
 }
+
+void Blitter_32bppOptimized::GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max)
+{
+	/* Keep this in sync with the zoom level selection in EncodeInternal(). */
+	zoom_min = _settings_client.gui.zoom_min;
+	zoom_max = (ZoomLevel) std::min(_settings_client.gui.zoom_max, ZOOM_LVL_DRAW_SPR);
+	if (zoom_max == zoom_min) zoom_max = ZOOM_LVL_DRAW_SPR;
+}
@@ -24,6 +24,7 @@ public:
 
 	void Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom) override;
 	Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator) override;
+	void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max) override;
 
 	const char *GetName() override { return "32bpp-optimized"; }
 
@@ -28,6 +28,13 @@ public:
 	void DrawColourMappingRect(void *dst, int width, int height, PaletteID pal) override;
 	Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator) override;
 
+	void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max) override
+	{
+		/* Only the normal zoom level is encoded; Draw() scales from it. */
+		zoom_min = ZOOM_LVL_NORMAL;
+		zoom_max = ZOOM_LVL_NORMAL;
+	}
+
 	const char *GetName() override { return "32bpp-simple"; }
 };
 
@@ -20,6 +20,14 @@
 /** Instantiation of the SSE2 32bpp blitter factory. */
 static FBlitter_32bppSSE2 iFBlitter_32bppSSE2;
 
+/* static */ void Blitter_32bppSSE_Base::GetEncodeZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max)
+{
+	/* Keep this in sync with the zoom level selection in Encode(). */
+	zoom_min = _settings_client.gui.zoom_min;
+	zoom_max = _settings_client.gui.zoom_max;
+	if (zoom_max == zoom_min) zoom_max = ZOOM_LVL_MAX;
+}
+
 Sprite *Blitter_32bppSSE_Base::Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator)
 {
 	/* First uint32 of a line = the number of transparent pixels from the left.
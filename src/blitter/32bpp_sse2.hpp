@@ -65,6 +65,7 @@ public:
 	};
 
 	Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator);
+	static void GetEncodeZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max);
 };
 
 /** The SSE2 32 bpp blitter (without palette animation). */
@@ -78,6 +79,10 @@ public:
 		return Blitter_32bppSSE_Base::Encode(sprite, allocator);
 	}
 
+	void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max) override {
+		Blitter_32bppSSE_Base::GetEncodeZoomRange(zoom_min, zoom_max);
+	}
+
 	const char *GetName() override { return "32bpp-sse2"; }
 };
 
@@ -109,6 +109,61 @@ static inline __m128i DarkenTwoPixels(__m128i src, __m128i dst, const __m128i &d
 	return _mm_packus_epi16(dstAB, dstAB);
 }
 
+#if (SSE_VERSION >= 5)
+/**
+ * Blend 2 pairs of 16 bit expanded pixels per 128 bit lane.
+ * Same dataflow as the core of AlphaBlendTwoPixels(), just twice as wide.
+ */
+GNU_TARGET(SSE_TARGET)
+static inline __m256i AlphaBlendPixelPairs(__m256i srcAB, __m256i dstAB, const __m256i &distribution_mask, const __m256i &alpha_mask)
+{
+	__m256i alphaMaskAB = _mm256_cmpgt_epi16(srcAB, _mm256_setzero_si256()); // VPCMPGTW (alpha > 0) ? 0xFFFF : 0
+	__m256i alphaAB = _mm256_sub_epi16(srcAB, alphaMaskAB);                  // if (alpha > 0) a++;
+	alphaAB = _mm256_shuffle_epi8(alphaAB, distribution_mask);               // VPSHUFB works per 128 bit lane.
+
+	srcAB = _mm256_sub_epi16(srcAB, dstAB);     // VPSUBW,    (r - Cr)
+	srcAB = _mm256_mullo_epi16(srcAB, alphaAB); // VPMULLW, a*(r - Cr)
+	srcAB = _mm256_srli_epi16(srcAB, 8);        // VPSRLW,  a*(r - Cr)/256
+	srcAB = _mm256_add_epi16(srcAB, dstAB);     // VPADDW,  a*(r - Cr)/256 + Cr
+
+	alphaMaskAB = _mm256_and_si256(alphaMaskAB, alpha_mask); // VPAND, set non alpha fields to 0
+	return _mm256_or_si256(srcAB, alphaMaskAB);              // VPOR, set alpha fields to 0xFFFF if src alpha was > 0
+}
+
+/** Blend 8 pixels at once, the 32 byte counterpart of AlphaBlendTwoPixels(). */
+GNU_TARGET(SSE_TARGET)
+static inline __m256i AlphaBlendEightPixels(__m256i src, __m256i dst, const __m256i &distribution_mask, const __m256i &pack_mask, const __m256i &alpha_mask)
+{
+	__m256i srcAB = _mm256_unpacklo_epi8(src, _mm256_setzero_si256()); // VPUNPCKLBW, expand each uint8 into uint16
+	__m256i dstAB = _mm256_unpacklo_epi8(dst, _mm256_setzero_si256());
+	__m256i srcCD = _mm256_unpackhi_epi8(src, _mm256_setzero_si256());
+	__m256i dstCD = _mm256_unpackhi_epi8(dst, _mm256_setzero_si256());
+	srcAB = AlphaBlendPixelPairs(srcAB, dstAB, distribution_mask, alpha_mask);
+	srcCD = AlphaBlendPixelPairs(srcCD, dstCD, distribution_mask, alpha_mask);
+
+	/* Keep only the low byte of each word before packing: VPACKUSWB saturates,
+	 * but we need the unsaturated modulo behaviour of PackUnsaturated(). */
+	srcAB = _mm256_and_si256(srcAB, pack_mask);
+	srcCD = _mm256_and_si256(srcCD, pack_mask);
+	return _mm256_packus_epi16(srcAB, srcCD); // Per lane pack restores the original pixel order.
+}
+
+/** Darken 8 pixels at once, the 32 byte counterpart of DarkenTwoPixels(). */
+GNU_TARGET(SSE_TARGET)
+static inline __m256i DarkenEightPixels(__m256i src, __m256i dst, const __m256i &distribution_mask, const __m256i &tr_nom_base)
+{
+	__m256i srcAB = _mm256_unpacklo_epi8(src, _mm256_setzero_si256());
+	__m256i dstAB = _mm256_unpacklo_epi8(dst, _mm256_setzero_si256());
+	__m256i srcCD = _mm256_unpackhi_epi8(src, _mm256_setzero_si256());
+	__m256i dstCD = _mm256_unpackhi_epi8(dst, _mm256_setzero_si256());
+	__m256i alphaAB = _mm256_srli_epi16(_mm256_shuffle_epi8(srcAB, distribution_mask), 2);
+	__m256i alphaCD = _mm256_srli_epi16(_mm256_shuffle_epi8(srcCD, distribution_mask), 2);
+	dstAB = _mm256_srli_epi16(_mm256_mullo_epi16(dstAB, _mm256_sub_epi16(tr_nom_base, alphaAB)), 8);
+	dstCD = _mm256_srli_epi16(_mm256_mullo_epi16(dstCD, _mm256_sub_epi16(tr_nom_base, alphaCD)), 8);
+	return _mm256_packus_epi16(dstAB, dstCD);
+}
+#endif /* SSE_VERSION >= 5 */
+
 IGNORE_UNINITIALIZED_WARNING_START
 GNU_TARGET(SSE_TARGET)
 static Colour ReallyAdjustBrightness(Colour colour, uint8 brightness)
@@ -212,6 +267,8 @@ inline void Blitter_32bppSSE2::Draw(const Blitter::BlitterParams *bp, ZoomLevel
 inline void Blitter_32bppSSSE3::Draw(const Blitter::BlitterParams *bp, ZoomLevel zoom)
 #elif (SSE_VERSION == 4)
 inline void Blitter_32bppSSE4::Draw(const Blitter::BlitterParams *bp, ZoomLevel zoom)
+#elif (SSE_VERSION == 5)
+inline void Blitter_32bppAVX2::Draw(const Blitter::BlitterParams *bp, ZoomLevel zoom)
 #endif
 {
 	const byte * const remap = bp->remap;
@@ -254,6 +311,14 @@ inline void Blitter_32bppSSE4::Draw(const Blitter::BlitterParams *bp, ZoomLevel
 	#define DARKEN_PARAM_2      tr_nom_base
 #endif
 	const __m128i tr_nom_base = TRANSPARENT_NOM_BASE;
+#if (SSE_VERSION >= 5)
+	/* 256 bit copies of the masks above; VPSHUFB shuffles per 128 bit lane, so broadcasting works. */
+	const __m256i wide_a_cm        = _mm256_broadcastsi128_si256(a_cm);
+	const __m256i wide_alpha_and   = _mm256_broadcastsi128_si256(alpha_and);
+	const __m256i wide_tr_nom_base = _mm256_broadcastsi128_si256(tr_nom_base);
+	const __m256i wide_pack_low    = _mm256_set1_epi16(0x00FF);
+	const __m256i wide_alpha_field = _mm256_set1_epi32((int) 0xFF000000);
+#endif
 
 	for (int y = bp->height; y != 0; y--) {
 		Colour *dst = dst_line;
@@ -276,7 +341,19 @@ inline void Blitter_32bppSSE4::Draw(const Blitter::BlitterParams *bp, ZoomLevel
 		switch (mode) {
 			default:
 				if (!translucent) {
-					for (uint x = (uint) effective_width; x > 0; x--) {
+					uint x = (uint) effective_width;
+#if (SSE_VERSION >= 5)
+					for (; x >= 8; x -= 8) {
+						__m256i srcABCD = _mm256_loadu_si256((const __m256i*) src);
+						__m256i dstABCD = _mm256_loadu_si256((__m256i*) dst);
+						/* Keep dst where the src alpha byte is 0; sprites without BSF_TRANSLUCENT only contain alpha 0 or 255. */
+						__m256i transparent = _mm256_cmpeq_epi32(_mm256_and_si256(srcABCD, wide_alpha_field), _mm256_setzero_si256());
+						_mm256_storeu_si256((__m256i*) dst, _mm256_blendv_epi8(srcABCD, dstABCD, transparent));
+						src += 8;
+						dst += 8;
+					}
+#endif
+					for (; x > 0; x--) {
 						if (src->a) *dst = *src;
 						src++;
 						dst++;
@@ -284,7 +361,19 @@ inline void Blitter_32bppSSE4::Draw(const Blitter::BlitterParams *bp, ZoomLevel
 					break;
 				}
 
+#if (SSE_VERSION >= 5)
+				for (uint x = (uint) effective_width / 8; x > 0; x--) {
+					__m256i srcABCD = _mm256_loadu_si256((const __m256i*) src);
+					__m256i dstABCD = _mm256_loadu_si256((__m256i*) dst);
+					_mm256_storeu_si256((__m256i*) dst, AlphaBlendEightPixels(srcABCD, dstABCD, wide_a_cm, wide_pack_low, wide_alpha_and));
+					src += 8;
+					dst += 8;
+				}
+
+				for (uint x = ((uint) effective_width % 8) / 2; x > 0; x--) {
+#else
 				for (uint x = (uint) effective_width / 2; x > 0; x--) {
+#endif
 					__m128i srcABCD = _mm_loadl_epi64((const __m128i*) src);
 					__m128i dstABCD = _mm_loadl_epi64((__m128i*) dst);
 					_mm_storel_epi64((__m128i*) dst, AlphaBlendTwoPixels(srcABCD, dstABCD, ALPHA_BLEND_PARAM_1, ALPHA_BLEND_PARAM_2, ALPHA_BLEND_PARAM_3));
@@ -383,7 +472,19 @@ bmcr_alpha_blend_single:
 
 			case BM_TRANSPARENT:
 				/* Make the current colour a bit more black, so it looks like this image is transparent. */
+#if (SSE_VERSION >= 5)
+				for (uint x = (uint) bp->width / 8; x > 0; x--) {
+					__m256i srcABCD = _mm256_loadu_si256((const __m256i*) src);
+					__m256i dstABCD = _mm256_loadu_si256((__m256i*) dst);
+					_mm256_storeu_si256((__m256i*) dst, DarkenEightPixels(srcABCD, dstABCD, wide_a_cm, wide_tr_nom_base));
+					src += 8;
+					dst += 8;
+				}
+
+				for (uint x = ((uint) bp->width % 8) / 2; x > 0; x--) {
+#else
 				for (uint x = (uint) bp->width / 2; x > 0; x--) {
+#endif
 					__m128i srcABCD = _mm_loadl_epi64((const __m128i*) src);
 					__m128i dstABCD = _mm_loadl_epi64((__m128i*) dst);
 					_mm_storel_epi64((__m128i *) dst, DarkenTwoPixels(srcABCD, dstABCD, DARKEN_PARAM_1, DARKEN_PARAM_2));
@@ -503,6 +604,8 @@ void Blitter_32bppSSE2::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomL
 void Blitter_32bppSSSE3::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom)
 #elif (SSE_VERSION == 4)
 void Blitter_32bppSSE4::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom)
+#elif (SSE_VERSION == 5)
+void Blitter_32bppAVX2::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom)
 #endif
 {
 	switch (mode) {
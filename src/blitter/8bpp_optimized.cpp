@@ -120,6 +120,14 @@ void Blitter_8bppOptimized::Draw(Blitter::BlitterParams *bp, BlitterMode mode, Z
 	}
 }
 
+void Blitter_8bppOptimized::GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max)
+{
+	/* Keep this in sync with the zoom level selection in Encode(). */
+	zoom_min = _settings_client.gui.zoom_min;
+	zoom_max = (ZoomLevel) std::min(_settings_client.gui.zoom_max, ZOOM_LVL_DRAW_SPR);
+	if (zoom_max == zoom_min) zoom_max = ZOOM_LVL_DRAW_SPR;
+}
+
 Sprite *Blitter_8bppOptimized::Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator)
 {
 	/* Make memory for all zoom-levels */
@@ -19,6 +19,14 @@ public:
 	void Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom) override {};
 	void DrawColourMappingRect(void *dst, int width, int height, PaletteID pal) override {};
 	Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator) override;
+
+	void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max) override
+	{
+		/* Only the metadata of the normal zoom level is encoded. */
+		zoom_min = ZOOM_LVL_NORMAL;
+		zoom_max = ZOOM_LVL_NORMAL;
+	}
+
 	void *MoveTo(void *video, int x, int y) override { return nullptr; };
 	void SetPixel(void *video, int x, int y, uint8 colour) override {};
 	void SetPixel32(void *video, int x, int y, uint8 colour, uint32 colour32) override {};
@@ -80,7 +80,7 @@ int GetBridgeHeight(TileIndex t)
 	return h + 1 + ApplyFoundationToSlope(f, &tileh);
 }
 
-std::unordered_map<TileIndex, LongBridgeSignalStorage> _long_bridge_signal_sim_map;
+HashMap<TileIndex, LongBridgeSignalStorage> _long_bridge_signal_sim_map;
 
 SignalState GetBridgeEntranceSimulatedSignalStateExtended(TileIndex t, uint16 signal)
 {
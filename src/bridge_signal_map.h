@@ -14,16 +14,16 @@
 #include "map_func.h"
 #include "signal_type.h"
 #include "core/bitmath_func.hpp"
+#include "core/hashtable_map_type.hpp"
 #include "3rdparty/cpp-btree/btree_set.h"
 
 #include <vector>
-#include <unordered_map>
 
 struct LongBridgeSignalStorage {
 	std::vector<uint64> signal_red_bits;
 };
 
-extern std::unordered_map<TileIndex, LongBridgeSignalStorage> _long_bridge_signal_sim_map;
+extern HashMap<TileIndex, LongBridgeSignalStorage> _long_bridge_signal_sim_map;
 
 extern btree::btree_set<uint32> _bridge_signal_style_map;
 
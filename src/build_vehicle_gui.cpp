@@ -29,6 +29,7 @@
 #include "engine_gui.h"
 #include "cargotype.h"
 #include "core/geometry_func.hpp"
+#include "core/hashtable_map_type.hpp"
 #include "autoreplace_func.h"
 #include "train.h"
 #include "error.h"
@@ -259,6 +260,33 @@ static bool EngineVehicleCountSorter(const GUIEngineListItem &a, const GUIEngine
 /* cached values for EngineNameSorter to spare many GetString() calls */
 static EngineID _last_engine[2] = { INVALID_ENGINE, INVALID_ENGINE };
 
+/* Cached total capacities for the capacity sorters: resolving the NewGRF
+ * callbacks of every articulated part is too slow to redo O(n log n) times
+ * per sort of a large engine list. Shared by all engine list windows. */
+static HashMap<EngineID, uint> _engine_sort_capacity_cache;
+static Date _engine_sort_capacity_cache_date = INVALID_DATE;
+
+/** Clear the capacity cache, to be called when the engine pool is rebuilt. */
+void ClearEngineSortCapacityCache()
+{
+	_engine_sort_capacity_cache.clear();
+	_engine_sort_capacity_cache_date = INVALID_DATE;
+}
+
+/** Cached version of GetTotalCapacityOfArticulatedParts(), for the engine list sorters. */
+static uint GetSortTotalCapacityOfArticulatedParts(EngineID engine)
+{
+	/* Callback results may be date dependent, don't cache across date changes. */
+	if (_engine_sort_capacity_cache_date != _date) {
+		_engine_sort_capacity_cache.clear();
+		_engine_sort_capacity_cache_date = _date;
+	}
+
+	auto res = _engine_sort_capacity_cache.try_emplace(engine, 0);
+	if (res.second) res.first->second = GetTotalCapacityOfArticulatedParts(engine);
+	return res.first->second;
+}
+
 /**
  * Determines order of engines by name
  * @param a first engine to compare
@@ -447,8 +475,8 @@ static bool TrainEngineCapacitySorter(const GUIEngineListItem &a, const GUIEngin
 	const RailVehicleInfo *rvi_a = RailVehInfo(a.engine_id);
 	const RailVehicleInfo *rvi_b = RailVehInfo(b.engine_id);
 
-	int va = GetTotalCapacityOfArticulatedParts(a.engine_id) * (rvi_a->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
-	int vb = GetTotalCapacityOfArticulatedParts(b.engine_id) * (rvi_b->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
+	int va = GetSortTotalCapacityOfArticulatedParts(a.engine_id) * (rvi_a->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
+	int vb = GetSortTotalCapacityOfArticulatedParts(b.engine_id) * (rvi_b->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
 	int r = va - vb;
 
 	/* Use EngineID to sort instead since we want consistent sorting */
@@ -467,8 +495,8 @@ static bool TrainEngineCapacityVsRunningCostSorter(const GUIEngineListItem &a, c
 	const RailVehicleInfo *rvi_a = RailVehInfo(a.engine_id);
 	const RailVehicleInfo *rvi_b = RailVehInfo(b.engine_id);
 
-	uint va = GetTotalCapacityOfArticulatedParts(a.engine_id) * (rvi_a->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
-	uint vb = GetTotalCapacityOfArticulatedParts(b.engine_id) * (rvi_b->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
+	uint va = GetSortTotalCapacityOfArticulatedParts(a.engine_id) * (rvi_a->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
+	uint vb = GetSortTotalCapacityOfArticulatedParts(b.engine_id) * (rvi_b->railveh_type == RAILVEH_MULTIHEAD ? 2 : 1);
 
 	return GenericEngineValueVsRunningCostSorter(a, va, b, vb);
 }
@@ -500,8 +528,8 @@ static bool TrainEnginesThenWagonsSorter(const GUIEngineListItem &a, const GUIEn
  */
 static bool RoadVehEngineCapacitySorter(const GUIEngineListItem &a, const GUIEngineListItem &b)
 {
-	int va = GetTotalCapacityOfArticulatedParts(a.engine_id);
-	int vb = GetTotalCapacityOfArticulatedParts(b.engine_id);
+	int va = GetSortTotalCapacityOfArticulatedParts(a.engine_id);
+	int vb = GetSortTotalCapacityOfArticulatedParts(b.engine_id);
 	int r = va - vb;
 
 	/* Use EngineID to sort instead since we want consistent sorting */
@@ -517,7 +545,7 @@ static bool RoadVehEngineCapacitySorter(const GUIEngineListItem &a, const GUIEng
  */
 static bool RoadVehEngineCapacityVsRunningCostSorter(const GUIEngineListItem &a, const GUIEngineListItem &b)
 {
-	return GenericEngineValueVsRunningCostSorter(a, GetTotalCapacityOfArticulatedParts(a.engine_id), b, GetTotalCapacityOfArticulatedParts(b.engine_id));
+	return GenericEngineValueVsRunningCostSorter(a, GetSortTotalCapacityOfArticulatedParts(a.engine_id), b, GetSortTotalCapacityOfArticulatedParts(b.engine_id));
 }
 
 /* Ship vehicle sorting functions */
@@ -121,11 +121,14 @@ public:
 	template <typename T>
 	inline const T GetSum() const
 	{
-		T ret = 0;
+		/* NUM_CARGO uint values can never overflow a uint64, so there is no
+		 * need to pay for overflow checks per addition when T is an
+		 * overflow safe type; a single conversion at the end suffices. */
+		uint64 ret = 0;
 		for (size_t i = 0; i < lengthof(this->amount); i++) {
 			ret += this->amount[i];
 		}
-		return ret;
+		return (T)ret;
 	}
 
 	/**
@@ -15,7 +15,7 @@
 #include "industry.h"
 #include "town.h"
 #include "core/overflowsafe_type.hpp"
-#include "3rdparty/cpp-btree/btree_map.h"
+#include "core/hashtable_map_type.hpp"
 struct Station;
 
 /**
@@ -28,8 +28,12 @@ struct Station;
  */
 typedef uint32 CargoMonitorID; ///< Type of the cargo monitor number.
 
-/** Map type for storing and updating active cargo monitor numbers and their amounts. */
-typedef btree::btree_map<CargoMonitorID, OverflowSafeInt32> CargoMonitorMap;
+/**
+ * Map type for storing and updating active cargo monitor numbers and their amounts.
+ * This is looked up several times per delivery, so it is a flat hash map; its
+ * iteration order is unspecified, the save code sorts the entries itself.
+ */
+typedef HashMap<CargoMonitorID, OverflowSafeInt32> CargoMonitorMap;
 
 extern CargoMonitorMap _cargo_pickups;
 extern CargoMonitorMap _cargo_deliveries;
@@ -119,9 +119,9 @@ CargoPacket::CargoPacket()
 CargoPacket::CargoPacket(StationID source, TileIndex source_xy, uint16 count, SourceType source_type, SourceID source_id) :
 	feeder_share(0),
 	count(count),
-	days_in_transit(0),
 	source_id(source_id),
 	source(source),
+	days_in_transit(0),
 	source_xy(source_xy),
 	loaded_at_xy(0)
 {
@@ -143,12 +143,12 @@ CargoPacket::CargoPacket(StationID source, TileIndex source_xy, uint16 count, So
  * @note We have to zero memory ourselves here because we are using a 'new'
  * that, in contrary to all other pools, does not memset to 0.
  */
-CargoPacket::CargoPacket(uint16 count, uint16 days_in_transit, StationID source, TileIndex source_xy, TileIndex loaded_at_xy, Money feeder_share, SourceType source_type, SourceID source_id) :
+CargoPacket::CargoPacket(uint16 count, int32 days_in_transit, StationID source, TileIndex source_xy, TileIndex loaded_at_xy, Money feeder_share, SourceType source_type, SourceID source_id) :
 		feeder_share(feeder_share),
 		count(count),
-		days_in_transit(days_in_transit),
 		source_id(source_id),
 		source(source),
+		days_in_transit(days_in_transit),
 		source_xy(source_xy),
 		loaded_at_xy(loaded_at_xy)
 {
@@ -337,7 +337,7 @@ void CargoList<Tinst, Tcont>::RemoveFromCache(const CargoPacket *cp, uint count)
 {
 	dbg_assert(count <= cp->count);
 	this->count                 -= count;
-	this->cargo_days_in_transit -= cp->days_in_transit * count;
+	this->cargo_days_in_transit -= (uint64)((int64)cp->days_in_transit * count);
 }
 
 /**
@@ -349,7 +349,7 @@ template <class Tinst, class Tcont>
 void CargoList<Tinst, Tcont>::AddToCache(const CargoPacket *cp)
 {
 	this->count                 += cp->count;
-	this->cargo_days_in_transit += cp->days_in_transit * cp->count;
+	this->cargo_days_in_transit += (uint64)((int64)cp->days_in_transit * cp->count);
 }
 
 /** Invalidates the cached data and rebuilds it. */
@@ -398,7 +398,7 @@ template <class Tinst, class Tcont>
  * ones.
  * @warning After appending this packet may not exist anymore!
  * @note Do not use the cargo packet anymore after it has been appended to this CargoList!
- * @param cp Cargo packet to add.
+ * @param cp Cargo packet to add; its days_in_transit must be absolute, it is rebased here.
  * @param action Either MTA_KEEP if you want to add the packet directly or MTA_LOAD
  * if you want to reserve it first.
  * @pre cp != nullptr
@@ -409,6 +409,7 @@ void VehicleCargoList::Append(CargoPacket *cp, MoveToAction action)
 	dbg_assert(cp != nullptr);
 	dbg_assert(action == MTA_LOAD ||
 			(action == MTA_KEEP && this->action_counts[MTA_LOAD] == 0));
+	this->ImportDaysInTransit(cp);
 	this->AddToMeta(cp, action);
 
 	if (this->count == cp->count) {
@@ -519,6 +520,7 @@ void VehicleCargoList::PopCargo(Taction action)
 void VehicleCargoList::RemoveFromCache(const CargoPacket *cp, uint count)
 {
 	this->feeder_share -= cp->FeederShare(count);
+	this->cargo_days_in_transit -= (uint64)this->age_level * count;
 	this->Parent::RemoveFromCache(cp, count);
 }
 
@@ -530,6 +532,7 @@ void VehicleCargoList::RemoveFromCache(const CargoPacket *cp, uint count)
 void VehicleCargoList::AddToCache(const CargoPacket *cp)
 {
 	this->feeder_share += cp->feeder_share;
+	this->cargo_days_in_transit += (uint64)this->age_level * cp->count;
 	this->Parent::AddToCache(cp);
 }
 
@@ -563,17 +566,33 @@ void VehicleCargoList::AddToMeta(const CargoPacket *cp, MoveToAction action)
 
 /**
  * Ages the all cargo in this list.
+ * Instead of touching every packet, the age level of the whole list is
+ * increased by one; the packets store their transit time relative to it.
  */
 void VehicleCargoList::AgeCargo()
 {
-	for (ConstIterator it(this->packets.begin()); it != this->packets.end(); it++) {
-		CargoPacket *cp = *it;
-		/* If we're at the maximum, then we can't increase no more. */
-		if (cp->days_in_transit == UINT16_MAX) continue;
+	this->age_level++;
+	this->cargo_days_in_transit += this->count;
+}
+
+/**
+ * Folds the age level of this list back into the individual packets, so that
+ * their days_in_transit become absolute again. This is done before saving as
+ * the age level itself is not saved.
+ */
+void VehicleCargoList::FlattenDaysInTransit()
+{
+	if (this->age_level == 0) return;
 
-		cp->days_in_transit++;
-		this->cargo_days_in_transit += cp->count;
+	for (CargoPacket *cp : this->packets) {
+		int64 days = cp->days_in_transit + (int64)this->age_level;
+		if (days > UINT16_MAX) {
+			this->cargo_days_in_transit -= (uint64)(days - UINT16_MAX) * cp->count;
+			days = UINT16_MAX;
+		}
+		cp->days_in_transit = (int32)days;
 	}
+	this->age_level = 0;
 }
 
 /**
@@ -705,7 +724,7 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 			case MTA_TRANSFER:
 				transfer_deliver.push_front(cp);
 				/* Add feeder share here to allow reusing field for next station. */
-				share = payment->PayTransfer(cp, cp->count);
+				share = payment->PayTransfer(cp, cp->count, this->PacketDaysInTransit(cp));
 				cp->AddFeederShare(share);
 				this->feeder_share += share;
 				cp->next_station = cargo_next;
@@ -26,7 +26,7 @@ typedef uint32 CargoPacketID;
 struct CargoPacket;
 
 /** Type of the pool for cargo packets for a little over 16 million packets. */
-typedef Pool<CargoPacket, CargoPacketID, 1024, 0xFFF000, PT_NORMAL, true, false> CargoPacketPool;
+typedef Pool<CargoPacket, CargoPacketID, 1024, 0xFFF000, PT_NORMAL, true, false, 1024> CargoPacketPool;
 /** The actual pool with cargo packets. */
 extern CargoPacketPool _cargopacket_pool;
 
@@ -54,10 +54,10 @@ struct CargoPacket : CargoPacketPool::PoolItem<&_cargopacket_pool> {
 private:
 	Money feeder_share;     ///< Value of feeder pickup to be paid for on delivery of cargo.
 	uint16 count;           ///< The amount of cargo in this packet.
-	uint16 days_in_transit; ///< Amount of days this packet has been in transit.
 	SourceType source_type; ///< Type of \c source_id.
 	SourceID source_id;     ///< Index of source, INVALID_SOURCE if unknown/invalid.
 	StationID source;       ///< The station where the cargo came from first.
+	int32 days_in_transit;  ///< Amount of days this packet has been in transit, relative to the age level of the holding VehicleCargoList, if any.
 	TileIndex source_xy;    ///< The origin of the cargo (first station in feeder chain).
 	union {
 		TileOrStationID loaded_at_xy; ///< Location where this cargo has been loaded into the vehicle.
@@ -84,7 +84,7 @@ public:
 
 	CargoPacket();
 	CargoPacket(StationID source, TileIndex source_xy, uint16 count, SourceType source_type, SourceID source_id);
-	CargoPacket(uint16 count, uint16 days_in_transit, StationID source, TileIndex source_xy, TileIndex loaded_at_xy, Money feeder_share = 0, SourceType source_type = ST_INDUSTRY, SourceID source_id = INVALID_SOURCE);
+	CargoPacket(uint16 count, int32 days_in_transit, StationID source, TileIndex source_xy, TileIndex loaded_at_xy, Money feeder_share = 0, SourceType source_type = ST_INDUSTRY, SourceID source_id = INVALID_SOURCE);
 	~CargoPacket();
 
 	CargoPacket *Split(uint new_size);
@@ -144,11 +144,13 @@ public:
 
 	/**
 	 * Gets the number of days this cargo has been in transit.
-	 * This number isn't really in days, but in 2.5 days (CARGO_AGING_TICKS = 185 ticks) and
-	 * it is capped at UINT16_MAX.
+	 * This number isn't really in days, but in 2.5 days (CARGO_AGING_TICKS = 185 ticks).
+	 * While the packet is in a vehicle this value is relative to the age level of the
+	 * holding VehicleCargoList and may be negative; use
+	 * VehicleCargoList::PacketDaysInTransit() to get the absolute transit time then.
 	 * @return Length this cargo has been in transit.
 	 */
-	inline uint16 DaysInTransit() const
+	inline int32 DaysInTransit() const
 	{
 		return this->days_in_transit;
 	}
@@ -307,6 +309,7 @@ protected:
 	typedef CargoList<VehicleCargoList, CargoPacketList> Parent;
 
 	Money feeder_share;                     ///< Cache for the feeder share.
+	uint32 age_level;                       ///< NOSAVE: age offset of all packets in this list; added to their days_in_transit, increased by one for each aging step.
 	uint action_counts[NUM_MOVE_TO_ACTION]; ///< Counts of cargo to be transferred, delivered, kept and loaded.
 
 	template<class Taction>
@@ -355,6 +358,26 @@ protected:
 	void AddToMeta(const CargoPacket *cp, MoveToAction action);
 	void RemoveFromMeta(const CargoPacket *cp, MoveToAction action, uint count);
 
+	/**
+	 * Rebases the packet's absolute transit time against the age level of this
+	 * list. To be called when the packet enters this list.
+	 * @param cp Packet to be rebased.
+	 */
+	inline void ImportDaysInTransit(CargoPacket *cp) const
+	{
+		cp->days_in_transit -= (int32)this->age_level;
+	}
+
+	/**
+	 * Converts the packet's transit time back to an absolute value. To be
+	 * called when the packet leaves this list.
+	 * @param cp Packet to be updated. Must still be rebased against this list.
+	 */
+	inline void ExportDaysInTransit(CargoPacket *cp) const
+	{
+		cp->days_in_transit = this->PacketDaysInTransit(cp);
+	}
+
 	static MoveToAction ChooseAction(const CargoPacket *cp, StationID cargo_next,
 			StationID current_station, bool accepted, StationIDStack next_station);
 
@@ -444,6 +467,19 @@ public:
 
 	void AgeCargo();
 
+	void FlattenDaysInTransit();
+
+	/**
+	 * Gets the absolute number of days the given packet has been in transit,
+	 * including the age level of this list.
+	 * @param cp Packet to get the transit time of. Must be in this list.
+	 * @return Length this cargo has been in transit, capped at UINT16_MAX.
+	 */
+	inline uint16 PacketDaysInTransit(const CargoPacket *cp) const
+	{
+		return (uint16)std::min<int64>(cp->days_in_transit + (int64)this->age_level, UINT16_MAX);
+	}
+
 	void InvalidateCache();
 
 	void SetTransferLoadPlace(TileIndex xy);
@@ -42,6 +42,7 @@
 #include "safeguards.h"
 
 CommandProc CmdBuildRailroadTrack;
+CommandProc CmdBuildRailGrid;
 CommandProc CmdRemoveRailroadTrack;
 CommandProc CmdBuildSingleRail;
 CommandProc CmdRemoveSingleRail;
@@ -79,6 +80,7 @@ CommandProcEx CmdBuildRoadStop;
 CommandProc CmdRemoveRoadStop;
 
 CommandProc CmdBuildLongRoad;
+CommandProc CmdBuildRoadGrid;
 CommandProc CmdRemoveLongRoad;
 CommandProc CmdBuildRoad;
 
@@ -569,6 +571,9 @@ static const Command _command_proc_table[] = {
 	DEF_CMD(CmdRenamePlan,                           CMD_NO_TEST, CMDT_OTHER_MANAGEMENT      ), // CMD_RENAME_PLAN
 
 	DEF_CMD(CmdDesyncCheck,                           CMD_SERVER, CMDT_SERVER_SETTING        ), // CMD_DESYNC_CHECK
+
+	DEF_CMD(CmdBuildRailGrid,            CMD_NO_WATER | CMD_AUTO | CMD_P1_TILE, CMDT_LANDSCAPE_CONSTRUCTION), // CMD_BUILD_RAIL_GRID
+	DEF_CMD(CmdBuildRoadGrid,            CMD_NO_WATER | CMD_AUTO | CMD_P1_TILE, CMDT_LANDSCAPE_CONSTRUCTION), // CMD_BUILD_ROAD_GRID
 };
 
 ClientID _cmd_client_id = INVALID_CLIENT_ID;
@@ -532,6 +532,9 @@ enum Commands {
 
 	CMD_DESYNC_CHECK,                 ///< Force desync checks to be run
 
+	CMD_BUILD_RAIL_GRID,              ///< build (or remove) an area of parallel rail tracks
+	CMD_BUILD_ROAD_GRID,              ///< build an area of parallel road stretches
+
 	CMD_END,                          ///< Must ALWAYS be on the end of this list!! (period)
 };
 
@@ -199,16 +199,31 @@ static bool IsValidCompanyManagerFace(CompanyManagerFace cmf)
 	return true;
 }
 
+static uint16 _dirty_company_finances; ///< Bitmask of companies whose finance-related windows are pending a repaint.
+
 /**
  * Refresh all windows owned by a company.
+ *
+ * The windows are not marked dirty immediately, but at the next redraw cycle
+ * (see FlushDirtyCompanyWindows()): money typically moves many times per game
+ * tick and the windows only need to be repainted once per frame.
  * @param company Company that changed, and needs its windows refreshed.
  */
 void InvalidateCompanyWindows(const Company *company)
 {
-	CompanyID cid = company->index;
+	SetBit(_dirty_company_finances, company->index);
+}
+
+/** Mark the windows of companies flagged by InvalidateCompanyWindows() as dirty, and clear the flags. */
+void FlushDirtyCompanyWindows()
+{
+	if (_dirty_company_finances == 0) return;
 
-	if (cid == _local_company) SetWindowWidgetDirty(WC_STATUS_BAR, 0, WID_S_RIGHT);
-	SetWindowDirty(WC_FINANCES, cid);
+	for (uint cid : SetBitIterator(_dirty_company_finances)) {
+		if (cid == _local_company) SetWindowWidgetDirty(WC_STATUS_BAR, 0, WID_S_RIGHT);
+		SetWindowDirty(WC_FINANCES, cid);
+	}
+	_dirty_company_finances = 0;
 }
 
 /**
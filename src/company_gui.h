@@ -23,6 +23,7 @@ void ShowCompanyFinances(CompanyID company);
 void ShowCompany(CompanyID company);
 
 void InvalidateCompanyWindows(const Company *c);
+void FlushDirtyCompanyWindows();
 void DeleteCompanyWindows(CompanyID company);
 void DirtyCompanyInfrastructureWindows(CompanyID company);
 void DirtyAllCompanyInfrastructureWindows();
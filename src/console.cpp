@@ -115,8 +115,11 @@ void IConsolePrint(TextColour colour_code, const char *string)
 
 	if (_network_dedicated) {
 		NetworkAdminConsole("console", str);
-		fprintf(stdout, "%s%s\n", GetLogPrefix(), str);
-		fflush(stdout);
+		/* Route the write through the background output writer, so that a
+		 * command producing lots of output does not stall the game loop. */
+		char line[ICON_MAX_STREAMSIZE + 32];
+		seprintf(line, lastof(line), "%s%s\n", GetLogPrefix(), str);
+		AsyncWriteLine(stdout, line);
 		IConsoleWriteToLogFile(str);
 		free(str); // free duplicated string since it's not used anymore
 		return;
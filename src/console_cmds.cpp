@@ -35,6 +35,10 @@
 #include "gamelog.h"
 #include "ai/ai.hpp"
 #include "ai/ai_config.hpp"
+#include "ai/ai_instance.hpp"
+#include "game/game_instance.hpp"
+#include "script/squirrel.hpp"
+#include "company_base.h"
 #include "newgrf.h"
 #include "newgrf_profiling.h"
 #include "console_func.h"
@@ -61,7 +65,14 @@
 #include "event_logs.h"
 #include "tile_cmd.h"
 #include "object_base.h"
+#include "train.h"
+#include "rail_map.h"
+#include "signal_func.h"
+#include "gfx_func.h"
+#include "pathfinder/yapf/yapf.h"
+#include "saveload/saveload_filter.h"
 #include <time.h>
+#include <chrono>
 
 #include <set>
 
@@ -1201,6 +1212,8 @@ DEF_CONSOLE_CMD(ConReturn)
 extern bool CloseConsoleLogIfActive();
 extern const std::vector<GRFFile *> &GetAllGRFFiles();
 extern void ConPrintFramerate(); // framerate_gui.cpp
+extern void ConPrintFramerateHistogram(); // framerate_gui.cpp
+extern void ConResetFramerateHistogram(); // framerate_gui.cpp
 extern void ShowFramerateWindow();
 
 DEF_CONSOLE_CMD(ConScript)
@@ -1522,6 +1535,75 @@ DEF_CONSOLE_CMD(ConStopAI)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConScriptProfile)
+{
+	if (argc != 3) {
+		IConsoleHelp("Control the execution profiler of a running script. Usage: 'script_profile <company-id|gs> <start|stop|dump>'");
+		IConsoleHelp("Profiles the AI of the given company id, or the game script when 'gs' is given.");
+		IConsoleHelp("'start' begins collecting data, 'dump' prints the data collected so far, 'stop' stops collecting and discards the data.");
+		return true;
+	}
+
+	if (_game_mode != GM_NORMAL) {
+		IConsoleWarning("Scripts can only be profiled in a game.");
+		return true;
+	}
+
+	if (_networking && !_network_server) {
+		IConsoleWarning("Only the server can profile a script.");
+		return true;
+	}
+
+	ScriptInstance *instance;
+	if (strcmp(argv[1], "gs") == 0) {
+		instance = Game::GetGameInstance();
+		if (instance == nullptr) {
+			IConsoleWarning("No game script is running.");
+			return true;
+		}
+	} else {
+		CompanyID company_id = (CompanyID)(atoi(argv[1]) - 1);
+		if (!Company::IsValidID(company_id)) {
+			IConsolePrintF(CC_DEFAULT, "Unknown company. Company range is between 1 and %d.", MAX_COMPANIES);
+			return true;
+		}
+		Company *c = Company::Get(company_id);
+		if (!c->is_ai || c->ai_instance == nullptr) {
+			IConsoleWarning("Company is not controlled by an AI.");
+			return true;
+		}
+		instance = c->ai_instance;
+	}
+
+	if (strcmp(argv[2], "start") == 0) {
+		instance->SetProfilingEnabled(true);
+		IConsolePrint(CC_DEFAULT, "Script profiler started.");
+	} else if (strcmp(argv[2], "stop") == 0) {
+		instance->SetProfilingEnabled(false);
+		IConsolePrint(CC_DEFAULT, "Script profiler stopped, collected data discarded.");
+	} else if (strcmp(argv[2], "dump") == 0) {
+		if (!instance->IsProfilingEnabled()) {
+			IConsoleWarning("The profiler of this script is not started.");
+			return true;
+		}
+		static const uint MAX_DUMP_LINES = 40;
+		std::vector<ScriptProfileLine> lines = instance->GetProfileData();
+		uint printed = 0;
+		for (const ScriptProfileLine &line : lines) {
+			if (printed++ == MAX_DUMP_LINES) {
+				IConsolePrintF(CC_DEFAULT, "... and %u more functions", (uint)(lines.size() - MAX_DUMP_LINES));
+				break;
+			}
+			IConsolePrintF(CC_DEFAULT, OTTD_PRINTF64U " us in " OTTD_PRINTF64U " calls: %s", line.time_us, line.calls, line.function.c_str());
+		}
+		if (lines.empty()) IConsolePrint(CC_DEFAULT, "No data collected yet.");
+	} else {
+		IConsoleError("Invalid profiler command.");
+	}
+
+	return true;
+}
+
 DEF_CONSOLE_CMD(ConRescanAI)
 {
 	if (argc == 0) {
@@ -2616,6 +2698,56 @@ DEF_CONSOLE_CMD(ConDumpCpdpStats)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConDumpSpriteCacheStats)
+{
+	if (argc == 0) {
+		IConsoleHelp("Dump sprite cache usage and hit/miss/eviction stats.");
+		return true;
+	}
+
+	extern void DumpSpriteCacheStats(char *buffer, const char *last);
+	char buffer[4096];
+	DumpSpriteCacheStats(buffer, lastof(buffer));
+	PrintLineByLine(buffer);
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConDumpPoolStats)
+{
+	if (argc == 0) {
+		IConsoleHelp("Dump per-pool occupancy and fragmentation stats.");
+		return true;
+	}
+
+	extern void DumpPoolUsageStats(char *buffer, const char *last);
+	char buffer[32768];
+	DumpPoolUsageStats(buffer, lastof(buffer));
+	PrintLineByLine(buffer);
+	return true;
+}
+
+#ifdef POOL_ALLOC_STATS
+DEF_CONSOLE_CMD(ConDumpPoolAllocStats)
+{
+	if (argc == 0) {
+		IConsoleHelp("Dump per-pool and per-tag allocation stats. Usage: 'dump_pool_alloc_stats [reset]'");
+		return true;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+		extern void ResetPoolAllocStats();
+		ResetPoolAllocStats();
+		return true;
+	}
+
+	extern void DumpPoolAllocStats(char *buffer, const char *last);
+	char buffer[32768];
+	DumpPoolAllocStats(buffer, lastof(buffer));
+	PrintLineByLine(buffer);
+	return true;
+}
+#endif /* POOL_ALLOC_STATS */
+
 DEF_CONSOLE_CMD(ConVehicleStats)
 {
 	if (argc == 0) {
@@ -3606,6 +3738,23 @@ DEF_CONSOLE_CMD(ConFramerate)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConFramerateHistogram)
+{
+	if (argc == 0) {
+		IConsoleHelp("Show or reset long-run per-subsystem tick duration percentiles. Usage: 'fps_histogram [reset]'");
+		IConsoleHelp("Percentiles are taken over every measurement since the start of the game or the last reset, not a short sample window.");
+		return true;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+		ConResetFramerateHistogram();
+		return true;
+	}
+
+	ConPrintFramerateHistogram();
+	return true;
+}
+
 DEF_CONSOLE_CMD(ConFramerateWindow)
 {
 	if (argc == 0) {
@@ -3622,6 +3771,132 @@ DEF_CONSOLE_CMD(ConFramerateWindow)
 	return true;
 }
 
+/** Total number of bytes written through #ByteCountSaveFilter instances, see ConBench. */
+static size_t _bench_save_bytes;
+
+/** Save filter that only counts the bytes written into it, used for benchmarking savegame serialisation. */
+struct ByteCountSaveFilter : SaveFilter {
+	ByteCountSaveFilter() : SaveFilter(nullptr) {}
+
+	void Write(byte *buf, size_t len) override
+	{
+		_bench_save_bytes += len;
+	}
+};
+
+/** Print the result of a benchmark run in machine-readable form. */
+static void PrintBenchResult(const char *name, uint iterations, uint64 items, uint64 total_ns)
+{
+	IConsolePrintF(CC_DEFAULT, "bench %s: iterations=%u items=" OTTD_PRINTF64U " total_ns=" OTTD_PRINTF64U " ns_per_op=" OTTD_PRINTF64U,
+			name, iterations, items, total_ns, items == 0 ? 0 : total_ns / items);
+}
+
+DEF_CONSOLE_CMD(ConBench)
+{
+	if (argc == 0) {
+		IConsoleHelp("Run a reproducible microbenchmark on the current game. Usage: 'bench <string|yapf|signals|save> [iterations]'");
+		IConsoleHelp("string: FormatString throughput, yapf: a depot search per train, signals: a signal block update per signal, save: savegame serialisation.");
+		IConsoleHelp("Results are printed as one machine-readable line per run. Load the same savegame to compare between builds.");
+		return true;
+	}
+
+	if (argc < 2 || argc > 3) return false;
+
+	uint iterations = (argc == 3) ? atoi(argv[2]) : 0;
+
+	using namespace std::chrono;
+
+	if (strcmp(argv[1], "string") == 0) {
+		if (iterations == 0) iterations = 100000;
+		char buffer[DRAW_STRING_BUFFER];
+		auto start = steady_clock::now();
+		for (uint i = 0; i < iterations; i++) {
+			SetDParam(0, (uint64)i * 12345);
+			GetString(buffer, STR_JUST_COMMA, lastof(buffer));
+			SetDParam(0, i);
+			GetString(buffer, STR_JUST_DATE_LONG, lastof(buffer));
+			SetDParam(0, (uint64)i * 6789);
+			GetString(buffer, STR_JUST_CURRENCY_LONG, lastof(buffer));
+		}
+		uint64 total_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+		PrintBenchResult("string", iterations, (uint64)iterations * 3, total_ns);
+		return true;
+	}
+
+	if (_game_mode != GM_NORMAL) {
+		IConsoleError("This benchmark can only be run in-game");
+		return false;
+	}
+
+	if (strcmp(argv[1], "yapf") == 0) {
+		if (iterations == 0) iterations = 10;
+		uint64 items = 0;
+		auto start = steady_clock::now();
+		for (uint i = 0; i < iterations; i++) {
+			for (const Train *t : Train::Iterate()) {
+				if (!t->IsFrontEngine()) continue;
+				if (HasBit(t->subtype, GVSF_VIRTUAL)) continue;
+				if (t->vehstatus & VS_CRASHED) continue;
+				YapfTrainFindNearestDepot(t, 0);
+				items++;
+			}
+		}
+		uint64 total_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+		PrintBenchResult("yapf", iterations, items, total_ns);
+		return true;
+	}
+
+	if (strcmp(argv[1], "signals") == 0) {
+		/* Recomputes the signal state of the whole map in place. The result is
+		 * identical to the incrementally maintained state, but don't permit
+		 * this while clients are connected. */
+		if (_networking) {
+			IConsoleError("This benchmark can not be run while in a network game");
+			return false;
+		}
+		if (iterations == 0) iterations = 1;
+		uint64 items = 0;
+		auto start = steady_clock::now();
+		for (uint i = 0; i < iterations; i++) {
+			for (TileIndex tile = 0; tile < MapSize(); tile++) {
+				if (!IsPlainRailTile(tile) || !HasSignals(tile)) continue;
+				TrackBits bits = GetTrackBits(tile);
+				for (Track track = TRACK_BEGIN; track < TRACK_END; track++) {
+					if (!HasBit(bits, track) || !HasSignalOnTrack(tile, track)) continue;
+					AddTrackToSignalBuffer(tile, track, GetTileOwner(tile));
+					UpdateSignalsInBuffer();
+					items++;
+				}
+			}
+		}
+		uint64 total_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+		PrintBenchResult("signals", iterations, items, total_ns);
+		return true;
+	}
+
+	if (strcmp(argv[1], "save") == 0) {
+		if (IsSaveInProgress()) {
+			IConsoleError("Cannot benchmark saving while a save is already in progress");
+			return false;
+		}
+		if (iterations == 0) iterations = 3;
+		_bench_save_bytes = 0;
+		auto start = steady_clock::now();
+		for (uint i = 0; i < iterations; i++) {
+			if (SaveWithFilter(new ByteCountSaveFilter(), false, SMF_NONE) != SL_OK) {
+				IConsoleError("Savegame serialisation failed");
+				return false;
+			}
+		}
+		uint64 total_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+		PrintBenchResult("save", iterations, iterations, total_ns);
+		IConsolePrintF(CC_DEFAULT, "bench save: bytes_per_op=" OTTD_PRINTF64U, (uint64)(_bench_save_bytes / iterations));
+		return true;
+	}
+
+	return false;
+}
+
 DEF_CONSOLE_CMD(ConFindNonRealisticBrakingSignal)
 {
 	if (argc == 0) {
@@ -3744,6 +4019,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("rescan_ai",               ConRescanAI);
 	IConsole::CmdRegister("start_ai",                ConStartAI);
 	IConsole::CmdRegister("stop_ai",                 ConStopAI);
+	IConsole::CmdRegister("script_profile",          ConScriptProfile);
 
 	IConsole::CmdRegister("list_game",               ConListGame);
 	IConsole::CmdRegister("list_game_libs",          ConListGameLibs);
@@ -3831,7 +4107,9 @@ void IConsoleStdLibRegister()
 #ifdef _DEBUG
 	IConsoleDebugLibRegister();
 #endif
+	IConsole::CmdRegister("bench",                   ConBench);
 	IConsole::CmdRegister("fps",                     ConFramerate);
+	IConsole::CmdRegister("fps_histogram",           ConFramerateHistogram);
 	IConsole::CmdRegister("fps_wnd",                 ConFramerateWindow);
 
 	IConsole::CmdRegister("find_non_realistic_braking_signal", ConFindNonRealisticBrakingSignal);
@@ -3842,6 +4120,11 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("dump_desync_msgs",        ConDumpDesyncMsgLog, nullptr, true);
 	IConsole::CmdRegister("dump_inflation",          ConDumpInflation,    nullptr, true);
 	IConsole::CmdRegister("dump_cpdp_stats",         ConDumpCpdpStats,    nullptr, true);
+	IConsole::CmdRegister("dump_pool_stats",         ConDumpPoolStats,    nullptr, true);
+	IConsole::CmdRegister("dump_sprite_cache_stats", ConDumpSpriteCacheStats, nullptr, true);
+#ifdef POOL_ALLOC_STATS
+	IConsole::CmdRegister("dump_pool_alloc_stats",   ConDumpPoolAllocStats, nullptr, true);
+#endif
 	IConsole::CmdRegister("dump_veh_stats",          ConVehicleStats,     nullptr, true);
 	IConsole::CmdRegister("dump_map_stats",          ConMapStats,         nullptr, true);
 	IConsole::CmdRegister("dump_st_flow_stats",      ConStFlowStats,      nullptr, true);
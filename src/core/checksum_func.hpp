@@ -31,11 +31,37 @@ struct SimpleChecksum64 {
 	}
 };
 
+/**
+ * Subsystems for which a separate per-frame state checksum is maintained,
+ * so that a state checksum mismatch can be localised to a subsystem.
+ */
+enum StateChecksumArea : uint8 {
+	SCA_VEHICLES, ///< Vehicle movement and pathfinding results.
+	SCA_TOWNS,    ///< Town growth.
+	SCA_ECONOMY,  ///< Company money and infrastructure totals.
+
+	SCA_END
+};
+
 extern SimpleChecksum64 _state_checksum;
+extern SimpleChecksum64 _subsystem_state_checksums[SCA_END];
 
-inline void UpdateStateChecksum(uint64 input)
+inline void UpdateStateChecksum(uint64 input, StateChecksumArea area)
+{
+	if (!_networking) return;
+	_state_checksum.Update(input);
+	_subsystem_state_checksums[area].Update(input);
+}
+
+/**
+ * Reset the per-subsystem state checksums. This is done at the start of each
+ * state frame on server and clients alike, so unlike the cumulative
+ * _state_checksum the per-subsystem digests cover exactly one frame and are
+ * identical on all peers regardless of when they joined.
+ */
+inline void ResetSubsystemStateChecksums()
 {
-	if (_networking) _state_checksum.Update(input);
+	for (SimpleChecksum64 &csum : _subsystem_state_checksums) csum.state = 0;
 }
 
 #ifdef RANDOM_DEBUG
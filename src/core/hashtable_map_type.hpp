@@ -0,0 +1,43 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file hashtable_map_type.hpp Default hash-based keyed container types. */
+
+#ifndef HASHTABLE_MAP_TYPE_HPP
+#define HASHTABLE_MAP_TYPE_HPP
+
+#include "../3rdparty/robin_hood/robin_hood.h"
+
+/*
+ * Default policy for keyed containers:
+ *
+ * - HashMap/HashSet are open-addressing robin-hood tables and should be the
+ *   default for hot lookup tables keyed by integer-like values (TileIndex,
+ *   IDs, packed keys). Elements are stored inline, so they must be movable
+ *   and are relocated on rehash; references and iterators are invalidated
+ *   by insertion.
+ * - NodeHashMap/NodeHashSet store elements in separately allocated nodes
+ *   with stable references, for values which are large or must not move.
+ * - Iteration order of all of these is unspecified. Do not iterate them in
+ *   code which affects game state, use btree_map/btree_set (deterministic
+ *   order) there instead. SmallMap remains appropriate only for tiny tables
+ *   which are scanned linearly anyway.
+ */
+
+template <typename Tkey, typename Tvalue, typename Thash = robin_hood::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+using HashMap = robin_hood::unordered_flat_map<Tkey, Tvalue, Thash, Tequal>;
+
+template <typename Tkey, typename Thash = robin_hood::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+using HashSet = robin_hood::unordered_flat_set<Tkey, Thash, Tequal>;
+
+template <typename Tkey, typename Tvalue, typename Thash = robin_hood::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+using NodeHashMap = robin_hood::unordered_node_map<Tkey, Tvalue, Thash, Tequal>;
+
+template <typename Tkey, typename Thash = robin_hood::hash<Tkey>, typename Tequal = std::equal_to<Tkey>>
+using NodeHashSet = robin_hood::unordered_node_set<Tkey, Thash, Tequal>;
+
+#endif /* HASHTABLE_MAP_TYPE_HPP */
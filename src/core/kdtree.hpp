@@ -97,6 +97,53 @@ class Kdtree {
 		}
 	}
 
+	/** One pending element range during breadth-first tree construction */
+	template <typename It>
+	struct build_range {
+		It begin;       ///< First element of the range
+		It end;         ///< One past last element of the range
+		size_t parent;  ///< Index of the parent node, INVALID_NODE for the root range
+		bool right;     ///< Whether to attach the resulting node as right child of the parent
+		int level;      ///< Depth of the resulting node in the tree
+	};
+
+	/**
+	 * Construct the tree from elements between begin and end iterators,
+	 * laying nodes out in breadth-first order. Every level of the tree is then
+	 * contiguous in the node pool, so the hot top levels of all descents share
+	 * a handful of cache lines regardless of tree size.
+	 */
+	template <typename It>
+	void BuildBreadthFirst(It begin, It end)
+	{
+		std::vector<build_range<It>> queue;
+		queue.push_back({ begin, end, INVALID_NODE, false, 0 });
+
+		for (size_t i = 0; i < queue.size(); i++) {
+			/* Take a copy, the queue vector may be reallocated by the push_backs below */
+			build_range<It> r = queue[i];
+
+			size_t newidx;
+			if (r.end - r.begin == 1) {
+				newidx = this->AddNode(*r.begin);
+			} else {
+				CoordT split_coord = SelectSplitCoord(r.begin, r.end, r.level);
+				It split = std::partition(r.begin, r.end, [&](T v) { return this->xyfunc(v, r.level % 2) < split_coord; });
+				newidx = this->AddNode(*split);
+				if (split - r.begin > 0) queue.push_back({ r.begin, split, newidx, false, r.level + 1 });
+				if (r.end - (split + 1) > 0) queue.push_back({ split + 1, r.end, newidx, true, r.level + 1 });
+			}
+
+			if (r.parent == INVALID_NODE) {
+				this->root = newidx;
+			} else if (r.right) {
+				this->nodes[r.parent].right = newidx;
+			} else {
+				this->nodes[r.parent].left = newidx;
+			}
+		}
+	}
+
 	/** Rebuild the tree with all existing elements, optionally adding or removing one more */
 	bool Rebuild(const T *include_element, const T *exclude_element)
 	{
@@ -273,6 +320,66 @@ class Kdtree {
 		return best;
 	}
 
+	/** Strict ordering for node_distance objects: by distance, elements with equal distance are ordered by less-than comparison */
+	static bool NodeDistanceOrder(const node_distance &a, const node_distance &b)
+	{
+		if (a.second != b.second) return a.second < b.second;
+		return a.first < b.first;
+	}
+
+	/** Search a sub-tree for the n elements nearest to a given point, maintaining a sorted candidate list */
+	void FindNearestNRecursive(CoordT xy[2], size_t node_idx, int level, size_t n, std::vector<node_distance> &best) const
+	{
+		/* Dimension index of current level */
+		int dim = level % 2;
+		/* Node reference */
+		const node &nd = this->nodes[node_idx];
+
+		/* Coordinate of element splitting at this node */
+		CoordT c = this->xyfunc(nd.element, dim);
+
+		node_distance candidate = std::make_pair(nd.element, ManhattanDistance(nd.element, xy[0], xy[1]));
+		if (best.size() < n) {
+			best.insert(std::lower_bound(best.begin(), best.end(), candidate, NodeDistanceOrder), candidate);
+		} else if (NodeDistanceOrder(candidate, best.back())) {
+			best.pop_back();
+			best.insert(std::lower_bound(best.begin(), best.end(), candidate, NodeDistanceOrder), candidate);
+		}
+
+		/* Next node to visit */
+		size_t next = (xy[dim] < c) ? nd.left : nd.right;
+		if (next != INVALID_NODE) this->FindNearestNRecursive(xy, next, level + 1, n, best);
+
+		/* Only cross the split if the candidate list is still incomplete, or the worst
+		 * candidate is at least as far away as the splitting line. */
+		size_t opposite = (xy[dim] >= c) ? nd.left : nd.right; // reverse of above
+		if (opposite != INVALID_NODE && (best.size() < n || best.back().second >= abs((int)xy[dim] - (int)c))) {
+			this->FindNearestNRecursive(xy, opposite, level + 1, n, best);
+		}
+	}
+
+	template <typename Outputter>
+	void FindWithinRadiusRecursive(CoordT xy[2], DistT radius, size_t node_idx, int level, const Outputter &outputter) const
+	{
+		/* Dimension index of current level */
+		int dim = level % 2;
+		/* Node reference */
+		const node &n = this->nodes[node_idx];
+
+		/* Coordinate of element splitting at this node */
+		CoordT c = this->xyfunc(n.element, dim);
+
+		if (ManhattanDistance(n.element, xy[0], xy[1]) <= radius) outputter(n.element);
+
+		/* Recurse into a side if any part of the search ball may lie on that side of the split */
+		if (n.left != INVALID_NODE && (xy[dim] < c || (DistT)(xy[dim] - c) <= radius)) {
+			this->FindWithinRadiusRecursive(xy, radius, n.left, level + 1, outputter);
+		}
+		if (n.right != INVALID_NODE && (xy[dim] >= c || (DistT)(c - xy[dim]) <= radius)) {
+			this->FindWithinRadiusRecursive(xy, radius, n.right, level + 1, outputter);
+		}
+	}
+
 	template <typename Outputter>
 	void FindContainedRecursive(CoordT p1[2], CoordT p2[2], size_t node_idx, int level, const Outputter &outputter) const
 	{
@@ -355,7 +462,9 @@ public:
 	Kdtree(TxyFunc xyfunc) : root(INVALID_NODE), xyfunc(xyfunc), unbalanced(0) { }
 
 	/**
-	 * Clear and rebuild the tree from a new sequence of elements,
+	 * Clear and rebuild the tree from a new sequence of elements.
+	 * Nodes are laid out in breadth-first order for cache locality of lookups,
+	 * see BuildBreadthFirst. The sequence is reordered in place.
 	 * @tparam It    Iterator type for element sequence.
 	 * @param  begin First element in sequence.
 	 * @param  end   One past last element in sequence.
@@ -369,7 +478,7 @@ public:
 		if (begin == end) return;
 		this->nodes.reserve(end - begin);
 
-		this->root = this->BuildSubtree(begin, end, 0);
+		this->BuildBreadthFirst(begin, end);
 		CheckInvariant();
 	}
 
@@ -448,6 +557,55 @@ public:
 		return this->FindNearestRecursive(xy, this->root, 0).first;
 	}
 
+	/**
+	 * Find up to n elements nearest to the given coordinate, in Manhattan distance.
+	 * Results are ordered by increasing distance; among elements at equal distance
+	 * the ones comparing smaller with a less-than comparison are preferred, as in FindNearest.
+	 * @param x First coordinate of the search point.
+	 * @param y Second coordinate of the search point.
+	 * @param n Maximum number of elements to return.
+	 */
+	std::vector<T> FindNearestN(CoordT x, CoordT y, size_t n) const
+	{
+		std::vector<T> result;
+		if (n == 0 || this->Count() == 0) return result;
+
+		CoordT xy[2] = { x, y };
+		std::vector<node_distance> best;
+		best.reserve(std::min(n, this->Count()));
+		this->FindNearestNRecursive(xy, this->root, 0, n, best);
+
+		result.reserve(best.size());
+		for (const node_distance &nd : best) result.push_back(nd.first);
+		return result;
+	}
+
+	/**
+	 * Find all elements within the given Manhattan distance of the given coordinate.
+	 * @param x         First coordinate of the search point.
+	 * @param y         Second coordinate of the search point.
+	 * @param radius    Maximum (inclusive) Manhattan distance of returned elements.
+	 * @param outputter Callback used to return values from the search.
+	 */
+	template <typename Outputter>
+	void FindWithinRadius(CoordT x, CoordT y, DistT radius, const Outputter &outputter) const
+	{
+		if (this->Count() == 0) return;
+
+		CoordT xy[2] = { x, y };
+		this->FindWithinRadiusRecursive(xy, radius, this->root, 0, outputter);
+	}
+
+	/**
+	 * Find all elements within the given Manhattan distance of the given coordinate.
+	 */
+	std::vector<T> FindWithinRadius(CoordT x, CoordT y, DistT radius) const
+	{
+		std::vector<T> result;
+		this->FindWithinRadius(x, y, radius, [&result](T e) { result.push_back(e); });
+		return result;
+	}
+
 	/**
 	* Find all items contained within the given rectangle.
 	* @note Start coordinates are inclusive, end coordinates are exclusive. x1<x2 && y1<y2 is a precondition.
@@ -203,6 +203,60 @@ template <class T> inline constexpr OverflowSafeInt<T> operator - (const byte  a
 template <class T> inline constexpr OverflowSafeInt<T> operator * (const byte  a, const OverflowSafeInt<T> b) { return b * (uint)a; }
 template <class T> inline constexpr OverflowSafeInt<T> operator / (const byte  a, const OverflowSafeInt<T> b) { return (OverflowSafeInt<T>)a / (int)b; }
 
+/**
+ * Accumulator to sum a span of values with a single overflow check at the end.
+ *
+ * OverflowSafeInt pays a clamping branch on every addition, which adds up in hot
+ * loops that accumulate many values (e.g. company economy recalculation). This
+ * accumulator instead keeps an exact double-width running sum using portable
+ * unsigned arithmetic, and clamps once when the result is read. As the
+ * intermediate sum is exact and no compiler-specific wide types are involved,
+ * the result is identical on all platforms, as required for multiplayer.
+ *
+ * The result only differs from per-addition clamping when an intermediate sum
+ * would overflow T but the total does not; in that case the exact total is
+ * returned rather than a saturated value.
+ * @param T the type the summed values are stored with.
+ */
+template <class T>
+class OverflowSafeAccumulator
+{
+private:
+	static constexpr T T_MAX = std::numeric_limits<T>::max();
+	static constexpr T T_MIN = std::numeric_limits<T>::min();
+
+	typedef typename std::make_unsigned<T>::type T_unsigned;
+
+	T_unsigned lo; ///< Low word of the running sum.
+	T hi;          ///< High word of the running sum, including the sign.
+
+public:
+	constexpr OverflowSafeAccumulator() : lo(0), hi(0) { }
+
+	/**
+	 * Add a value to the running sum, without any clamping. The accumulator
+	 * itself cannot overflow unless more than 2^(bit width of T) values are added.
+	 * @param value the amount to add.
+	 */
+	inline constexpr void Add(const T value)
+	{
+		T_unsigned prev = this->lo;
+		this->lo += (T_unsigned)value;
+		this->hi += (value < 0 ? -1 : 0) + (this->lo < prev ? 1 : 0);
+	}
+
+	/**
+	 * Get the accumulated sum.
+	 * @return the exact sum when it fits in T, otherwise T_MAX (respectively T_MIN).
+	 */
+	inline constexpr OverflowSafeInt<T> Result() const
+	{
+		if (this->hi == 0 && this->lo <= (T_unsigned)T_MAX) return (T)this->lo;
+		if (this->hi == -1 && this->lo >= (T_unsigned)T_MIN) return (T)this->lo;
+		return this->hi < 0 ? T_MIN : T_MAX;
+	}
+};
+
 typedef OverflowSafeInt<int64> OverflowSafeInt64;
 typedef OverflowSafeInt<int32> OverflowSafeInt32;
 
@@ -9,6 +9,11 @@
 
 #include "../stdafx.h"
 #include "pool_type.hpp"
+#include "../string_func.h"
+
+#ifdef POOL_ALLOC_STATS
+#include <map>
+#endif
 
 #include "../safeguards.h"
 
@@ -33,3 +38,78 @@
 		if (pool->type & pt) pool->CleanPool();
 	}
 }
+
+/**
+ * Dump per-pool occupancy and fragmentation statistics.
+ *
+ * Holes are freed indexes below the pool's first_unused high-water mark;
+ * they are what the free-bitmap scan in Pool::GetNew() has to skip over
+ * before the pool can grow again.
+ * @param buffer The buffer to write the text to.
+ * @param last The last element of the buffer.
+ */
+void DumpPoolUsageStats(char *buffer, const char *last)
+{
+	for (const PoolBase *pool : *PoolBase::GetPools()) {
+		PoolUsageStats stats;
+		pool->GetUsageStats(stats);
+		if (stats.capacity == 0) continue;
+		size_t holes = stats.first_unused - stats.items;
+		uint frag_permille = (stats.first_unused == 0) ? 0 : (uint)((holes * 1000) / stats.first_unused);
+		buffer += seprintf(buffer, last, "pool %s: live " PRINTF_SIZE ", span " PRINTF_SIZE ", holes " PRINTF_SIZE " (%u.%u%%), capacity " PRINTF_SIZE ", limit " PRINTF_SIZE "\n",
+				pool->GetName(), stats.items, stats.first_unused, holes, frag_permille / 10, frag_permille % 10, stats.capacity, stats.max_size);
+	}
+}
+
+#ifdef POOL_ALLOC_STATS
+
+/* static */ PoolAllocTag *PoolAllocTag::current = nullptr;
+
+/** Per-tag allocation totals, see PoolAllocTag. */
+struct PoolAllocTagStats {
+	uint64 allocs = 0; ///< Number of item allocations accounted to this tag.
+	uint64 bytes = 0;  ///< Number of bytes accounted to this tag.
+};
+static std::map<std::string, PoolAllocTagStats> _pool_alloc_tag_stats;
+
+/**
+ * Account a pool item allocation to the innermost active tag, if any.
+ * @param bytes size of the allocated item.
+ */
+/* static */ void PoolAllocTag::Account(size_t bytes)
+{
+	if (PoolAllocTag::current == nullptr) return;
+	PoolAllocTagStats &stats = _pool_alloc_tag_stats[PoolAllocTag::current->name];
+	stats.allocs++;
+	stats.bytes += bytes;
+}
+
+/**
+ * Dump per-pool and per-tag allocation statistics.
+ * @param buffer The buffer to write the text to.
+ * @param last The last element of the buffer.
+ */
+void DumpPoolAllocStats(char *buffer, const char *last)
+{
+	for (const PoolBase *pool : *PoolBase::GetPools()) {
+		buffer += seprintf(buffer, last, "pool %s: live " PRINTF_SIZE ", peak " PRINTF_SIZE ", allocs " OTTD_PRINTF64U ", bytes " OTTD_PRINTF64U "\n",
+				pool->GetName(), pool->GetNumItems(), pool->stat_peak_items, pool->stat_allocs, pool->stat_bytes);
+	}
+	for (const auto &it : _pool_alloc_tag_stats) {
+		buffer += seprintf(buffer, last, "tag %s: allocs " OTTD_PRINTF64U ", bytes " OTTD_PRINTF64U "\n",
+				it.first.c_str(), it.second.allocs, it.second.bytes);
+	}
+}
+
+/** Reset all pool and tag allocation statistics. */
+void ResetPoolAllocStats()
+{
+	for (PoolBase *pool : *PoolBase::GetPools()) {
+		pool->stat_peak_items = pool->GetNumItems();
+		pool->stat_allocs = 0;
+		pool->stat_bytes = 0;
+	}
+	_pool_alloc_tag_stats.clear();
+}
+
+#endif /* POOL_ALLOC_STATS */
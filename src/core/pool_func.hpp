@@ -21,8 +21,8 @@
  * @param type The return type of the method.
  */
 #define DEFINE_POOL_METHOD(type) \
-	template <class Titem, typename Tindex, size_t Tgrowth_step, size_t Tmax_size, PoolType Tpool_type, bool Tcache, bool Tzero> \
-	type Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero>
+	template <class Titem, typename Tindex, size_t Tgrowth_step, size_t Tmax_size, PoolType Tpool_type, bool Tcache, bool Tzero, size_t Tslab> \
+	type Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero, Tslab>
 
 /**
  * Create a clean pool.
@@ -35,6 +35,7 @@ DEFINE_POOL_METHOD(inline)::Pool(const char *name) :
 		first_free(0),
 		first_unused(0),
 		items(0),
+		generation(0),
 #ifdef WITH_FULL_dbg_assertS
 		checked(0),
 #endif /* WITH_FULL_dbg_assertS */
@@ -113,6 +114,26 @@ DEFINE_POOL_METHOD(inline void *)::AllocateItem(size_t size, size_t index)
 
 	this->first_unused = std::max(this->first_unused, index + 1);
 	this->items++;
+	this->generation++;
+
+#ifdef POOL_ALLOC_STATS
+	this->stat_allocs++;
+	this->stat_bytes += size;
+	if (this->items > this->stat_peak_items) this->stat_peak_items = this->items;
+	PoolAllocTag::Account(size);
+#endif /* POOL_ALLOC_STATS */
+
+	if (Tcache && Tslab > 1 && this->alloc_cache == nullptr) {
+		/* Allocate a whole slab of items at once and chain them into the cache. */
+		dbg_assert(sizeof(Titem) == size);
+		byte *slab = MallocT<byte>(size * Tslab);
+		this->alloc_slabs.push_back(slab);
+		for (size_t i = Tslab; i > 0; i--) {
+			AllocCache *ac = (AllocCache *)(slab + (i - 1) * size);
+			ac->next = this->alloc_cache;
+			this->alloc_cache = ac;
+		}
+	}
 
 	Titem *item;
 	if (Tcache && this->alloc_cache != nullptr) {
@@ -202,6 +223,7 @@ DEFINE_POOL_METHOD(void)::FreeItem(size_t index)
 	ClrBit(this->free_bitmap[index / 64], index % 64);
 	this->first_free = std::min(this->first_free, index);
 	this->items--;
+	this->generation++;
 	if (!this->cleaning) Titem::PostDestructor(index);
 }
 
@@ -222,10 +244,18 @@ DEFINE_POOL_METHOD(void)::CleanPool()
 	this->cleaning = false;
 
 	if (Tcache) {
-		while (this->alloc_cache != nullptr) {
-			AllocCache *ac = this->alloc_cache;
-			this->alloc_cache = ac->next;
-			free(ac);
+		if (Tslab > 1) {
+			/* The cached items all live inside the slabs; free those instead. */
+			this->alloc_cache = nullptr;
+			for (void *slab : this->alloc_slabs) free(slab);
+			this->alloc_slabs.clear();
+			this->alloc_slabs.shrink_to_fit();
+		} else {
+			while (this->alloc_cache != nullptr) {
+				AllocCache *ac = this->alloc_cache;
+				this->alloc_cache = ac->next;
+				free(ac);
+			}
 		}
 	}
 }
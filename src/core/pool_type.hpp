@@ -13,6 +13,14 @@
 #include "smallvec_type.hpp"
 #include "enum_type.hpp"
 
+/*
+ * Enable this to track per-pool allocation statistics (live/peak item counts,
+ * allocation and byte totals) and scoped allocation tags, readable via the
+ * 'dump_pool_alloc_stats' console command. This adds a few counter updates to
+ * every pool item allocation, hence it is off by default.
+ */
+// #define POOL_ALLOC_STATS
+
 /** Various types of a pool. */
 enum PoolType {
 	PT_NONE    = 0x00, ///< No pool is selected.
@@ -26,6 +34,14 @@ DECLARE_ENUM_AS_BIT_SET(PoolType)
 
 typedef std::vector<struct PoolBase *> PoolVector; ///< Vector of pointers to PoolBase
 
+/** Occupancy summary of one pool, see PoolBase::GetUsageStats(). */
+struct PoolUsageStats {
+	size_t items;        ///< Number of used indexes.
+	size_t first_unused; ///< This and all higher indexes are free.
+	size_t capacity;     ///< Current size of the index table.
+	size_t max_size;     ///< Maximum size of the index table.
+};
+
 /** Base class for base of all pools. */
 struct PoolBase {
 	const PoolType type; ///< Type of this pool.
@@ -58,6 +74,27 @@ struct PoolBase {
 	 */
 	virtual void CleanPool() = 0;
 
+	/**
+	 * Virtual method that returns the name of the pool.
+	 */
+	virtual const char *GetName() const = 0;
+
+	/**
+	 * Virtual method that returns the number of used items in the pool.
+	 */
+	virtual size_t GetNumItems() const = 0;
+
+	/**
+	 * Virtual method that fills in the occupancy summary of the pool.
+	 */
+	virtual void GetUsageStats(PoolUsageStats &stats) const = 0;
+
+#ifdef POOL_ALLOC_STATS
+	size_t stat_peak_items = 0; ///< Highest number of simultaneously used items since the last statistics reset.
+	uint64 stat_allocs = 0;     ///< Number of item allocations since the last statistics reset.
+	uint64 stat_bytes = 0;      ///< Number of bytes requested by item allocations since the last statistics reset.
+#endif /* POOL_ALLOC_STATS */
+
 private:
 	/**
 	 * Dummy private copy constructor to prevent compilers from
@@ -66,6 +103,37 @@ private:
 	PoolBase(const PoolBase &other);
 };
 
+#ifdef POOL_ALLOC_STATS
+/**
+ * Scoped tag which accounts pool item allocations to a named subsystem.
+ *
+ * While an instance is alive, every pool item allocation is additionally
+ * accounted against the innermost active tag. This allows hot paths, e.g.
+ * the viewport drawer, to report how many pool bytes they allocate; the
+ * totals are shown by the 'dump_pool_alloc_stats' console command.
+ * Tags may nest; only the innermost tag is charged.
+ */
+class PoolAllocTag {
+	const char * const name;   ///< Name of this tag.
+	PoolAllocTag * const prev; ///< Tag that was active when this one was opened, restored on destruction.
+
+	static PoolAllocTag *current; ///< Innermost active tag, or nullptr.
+
+public:
+	PoolAllocTag(const char *name) : name(name), prev(PoolAllocTag::current)
+	{
+		PoolAllocTag::current = this;
+	}
+
+	~PoolAllocTag()
+	{
+		PoolAllocTag::current = this->prev;
+	}
+
+	static void Account(size_t bytes);
+};
+#endif /* POOL_ALLOC_STATS */
+
 /**
  * Base class for all pools.
  * @tparam Titem        Type of the class/struct that is going to be pooled
@@ -75,9 +143,10 @@ private:
  * @tparam Tpool_type   Type of this pool
  * @tparam Tcache       Whether to perform 'alloc' caching, i.e. don't actually free/malloc just reuse the memory
  * @tparam Tzero        Whether to zero the memory
+ * @tparam Tslab        Number of items to allocate per slab when the alloc cache is empty; requires Tcache
  * @warning when Tcache is enabled *all* instances of this pool's item must be of the same size.
  */
-template <class Titem, typename Tindex, size_t Tgrowth_step, size_t Tmax_size, PoolType Tpool_type = PT_NORMAL, bool Tcache = false, bool Tzero = true>
+template <class Titem, typename Tindex, size_t Tgrowth_step, size_t Tmax_size, PoolType Tpool_type = PT_NORMAL, bool Tcache = false, bool Tzero = true, size_t Tslab = 1>
 struct Pool : PoolBase {
 	/* Ensure Tmax_size is within the bounds of Tindex. */
 	static_assert((uint64)(Tmax_size - 1) >> 8 * sizeof(Tindex) == 0);
@@ -90,6 +159,7 @@ struct Pool : PoolBase {
 	size_t first_free;   ///< No item with index lower than this is free (doesn't say anything about this one!)
 	size_t first_unused; ///< This and all higher indexes are free (doesn't say anything about first_unused-1 !)
 	size_t items;        ///< Number of used indexes (non-nullptr)
+	uint64 generation;   ///< Incremented whenever an item is allocated or freed, for dirty tracking (e.g. by the save chunk cache)
 #ifdef WITH_ASSERT
 	size_t checked;      ///< Number of items we checked for
 #endif /* WITH_ASSERT */
@@ -101,6 +171,17 @@ struct Pool : PoolBase {
 	Pool(const char *name);
 	virtual void CleanPool();
 
+	virtual const char *GetName() const { return this->name; }
+	virtual size_t GetNumItems() const { return this->items; }
+
+	virtual void GetUsageStats(PoolUsageStats &stats) const
+	{
+		stats.items = this->items;
+		stats.first_unused = this->first_unused;
+		stats.capacity = this->size;
+		stats.max_size = Tmax_size;
+	}
+
 	/**
 	 * Returns Titem with given index
 	 * @param index of item to get
@@ -231,12 +312,12 @@ struct Pool : PoolBase {
 	 * Base class for all PoolItems
 	 * @tparam Tpool The pool this item is going to be part of
 	 */
-	template <struct Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero> *Tpool>
+	template <struct Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero, Tslab> *Tpool>
 	struct PoolItem {
 		Tindex index; ///< Index of this pool item
 
 		/** Type of the pool this item is going to be part of */
-		typedef struct Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero> Pool;
+		typedef struct Pool<Titem, Tindex, Tgrowth_step, Tmax_size, Tpool_type, Tcache, Tzero, Tslab> Pool;
 
 		/**
 		 * Allocates space for new Titem
@@ -409,6 +490,9 @@ private:
 	/** Cache of freed pointers */
 	AllocCache *alloc_cache;
 
+	/** Slab allocations backing the alloc cache, when Tslab > 1 */
+	std::vector<void *> alloc_slabs;
+
 	void *AllocateItem(size_t size, size_t index);
 	void ResizeFor(size_t index);
 	size_t FindFirstFree();
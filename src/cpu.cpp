@@ -144,13 +144,15 @@ void ottd_cpuid(int info[4], int type)
 			/* It is safe to write "=r" for (info[1]) as in case that PIC is enabled for i386,
 			 * the compiler will not choose EBX as target register (but something else).
 			 */
-			: "a" (type)
+			/* Clear ecx: some leaves (e.g. leaf 7) read it as the sub-leaf index. */
+			: "a" (type), "2" (0)
 	);
 #else
 	__asm__ __volatile__ (
 			"cpuid           \n\t"
 			: "=a" (info[0]), "=b" (info[1]), "=c" (info[2]), "=d" (info[3])
-			: "a" (type)
+			/* Clear ecx: some leaves (e.g. leaf 7) read it as the sub-leaf index. */
+			: "a" (type), "2" (0)
 	);
 #endif /* i386 PIC */
 }
@@ -232,7 +232,7 @@ char *CrashLog::LogConfiguration(char *buffer, const char *last) const
 			FontCache::Get(FS_MONO)->GetFontName()
 	);
 
-	buffer += seprintf(buffer, last, "Map size: 0x%X (%u x %u)%s\n\n", MapSize(), MapSizeX(), MapSizeY(), (!_m || !_me) ? ", NO MAP ALLOCATED" : "");
+	buffer += seprintf(buffer, last, "Map size: 0x%X (%u x %u)%s\n\n", MapSize(), MapSizeX(), MapSizeY(), !_m.IsAllocated() ? ", NO MAP ALLOCATED" : "");
 
 	if (_settings_game.debug.chicken_bits != 0) {
 		buffer += seprintf(buffer, last, "Chicken bits: 0x%08X\n\n", _settings_game.debug.chicken_bits);
@@ -733,7 +733,7 @@ void CrashLog::FlushCrashLogBuffer()
 {
 	/* If the map array doesn't exist, saving will fail too. If the map got
 	 * initialised, there is a big chance the rest is initialised too. */
-	if (_m == nullptr) return false;
+	if (!_m.IsAllocated()) return false;
 
 	try {
 		GamelogEmergency();
@@ -759,7 +759,7 @@ void CrashLog::FlushCrashLogBuffer()
 {
 	/* If the map array doesn't exist, saving will fail too. If the map got
 	 * initialised, there is a big chance the rest is initialised too. */
-	if (_m == nullptr) return false;
+	if (!_m.IsAllocated()) return false;
 
 	try {
 		seprintf(filename, filename_last, "%s%s.sav", _personal_dir.c_str(), name);
@@ -1108,10 +1108,10 @@ bool CrashLog::MakeCrashSavegameAndScreenshot() const
 sym_info_bfd::sym_info_bfd(bfd_vma addr_) : addr(addr_), abfd(nullptr), syms(nullptr), sym_count(0),
 		file_name(nullptr), function_name(nullptr), function_addr(0), line(0), found(false) {}
 
-sym_info_bfd::~sym_info_bfd()
+sym_bfd_obj::~sym_bfd_obj()
 {
-	free(syms);
-	if (abfd != nullptr) bfd_close(abfd);
+	free(this->syms);
+	if (this->abfd != nullptr) bfd_close(this->abfd);
 }
 
 static void find_address_in_section(bfd *abfd, asection *section, void *data)
@@ -1154,20 +1154,32 @@ static void find_address_in_section(bfd *abfd, asection *section, void *data)
 	}
 }
 
-void lookup_addr_bfd(const char *obj_file_name, sym_info_bfd &info)
+void lookup_addr_bfd(const char *obj_file_name, sym_bfd_obj_cache &bfdc, sym_info_bfd &info)
 {
-	info.abfd = bfd_openr(obj_file_name, nullptr);
+	auto res = bfdc.cache.try_emplace(obj_file_name);
+	sym_bfd_obj &obj = res.first->second;
+	if (res.second) {
+		/* New cache entry: open the object file and read its symbol table once. */
+		obj.abfd = bfd_openr(obj_file_name, nullptr);
 
-	if (info.abfd == nullptr) return;
+		if (obj.abfd == nullptr) return;
 
-	if (!bfd_check_format(info.abfd, bfd_object) || (bfd_get_file_flags(info.abfd) & HAS_SYMS) == 0) return;
+		if (!bfd_check_format(obj.abfd, bfd_object) || (bfd_get_file_flags(obj.abfd) & HAS_SYMS) == 0) return;
 
-	unsigned int size;
-	info.sym_count = bfd_read_minisymbols(info.abfd, false, (void**) &(info.syms), &size);
-	if (info.sym_count <= 0) {
-		info.sym_count = bfd_read_minisymbols(info.abfd, true, (void**) &(info.syms), &size);
+		unsigned int size;
+		obj.sym_count = bfd_read_minisymbols(obj.abfd, false, (void**) &(obj.syms), &size);
+		if (obj.sym_count <= 0) {
+			obj.sym_count = bfd_read_minisymbols(obj.abfd, true, (void**) &(obj.syms), &size);
+		}
+		if (obj.sym_count <= 0) return;
+
+		obj.usable = true;
 	}
-	if (info.sym_count <= 0) return;
+	if (!obj.usable) return;
+
+	info.abfd = obj.abfd;
+	info.syms = obj.syms;
+	info.sym_count = obj.sym_count;
 
 	bfd_map_over_sections(info.abfd, find_address_in_section, &info);
 }
@@ -30,13 +30,36 @@
 #endif
 
 #if defined(WITH_BFD)
+
+#include <map>
+#include <string>
+
 struct sym_info_bfd;
-void lookup_addr_bfd(const char *obj_file_name, sym_info_bfd &info);
+struct sym_bfd_obj_cache;
+void lookup_addr_bfd(const char *obj_file_name, sym_bfd_obj_cache &bfdc, sym_info_bfd &info);
+
+/** An opened object file together with its symbol table. */
+struct sym_bfd_obj {
+	bfd *abfd = nullptr;
+	asymbol **syms = nullptr;
+	long sym_count = 0;
+	bool usable = false;
+
+	~sym_bfd_obj();
+};
+
+/**
+ * Cache of opened object files, so that each object file is only opened and
+ * its symbol table only read once per crash log, not once per stack frame.
+ */
+struct sym_bfd_obj_cache {
+	std::map<std::string, sym_bfd_obj> cache;
+};
 
 struct sym_info_bfd {
 	bfd_vma addr;
-	bfd *abfd;
-	asymbol **syms;
+	bfd *abfd;        ///< Borrowed from the object cache entry, not owned.
+	asymbol **syms;   ///< Borrowed from the object cache entry, not owned.
 	long sym_count;
 	const char *file_name;
 	const char *function_name;
@@ -45,7 +68,6 @@ struct sym_info_bfd {
 	bool found;
 
 	sym_info_bfd(bfd_vma addr_);
-	~sym_info_bfd();
 };
 
 #endif
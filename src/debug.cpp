@@ -17,9 +17,13 @@
 #include "date_func.h"
 #include "thread.h"
 #include <array>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #if defined(__MINGW32__)
+#include "3rdparty/mingw-std-threads/mingw.condition_variable.h"
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
+#include "3rdparty/mingw-std-threads/mingw.thread.h"
 #endif
 
 #if defined(_WIN32)
@@ -47,6 +51,22 @@ std::mutex _debug_remote_console_mutex; ///< Mutex to guard the queue of debug m
 std::vector<QueuedDebugItem> _debug_remote_console_queue; ///< Queue for debug messages to be passed to NetworkAdminConsole or IConsolePrint.
 std::vector<QueuedDebugItem> _debug_remote_console_queue_spare; ///< Spare queue to swap with _debug_remote_console_queue.
 
+/** A formatted line waiting to be written by the output writer thread. */
+struct QueuedOutputLine {
+	std::string line; ///< The formatted line, including the trailing newline.
+	FILE *stream;     ///< The stream to write the line to.
+};
+
+static const size_t OUTPUT_QUEUE_LIMIT = 4096; ///< Bound on queued lines; beyond this new lines are dropped instead of buffered.
+
+static std::mutex _debug_output_mutex; ///< Mutex to guard the state of the debug output writer thread.
+static std::condition_variable _debug_output_cv; ///< Signalled when there is output queued for the writer thread.
+static std::vector<QueuedOutputLine> _debug_output_queue; ///< Formatted lines waiting to be written by the writer thread.
+static uint _debug_output_dropped = 0; ///< Lines dropped because the queue was full, guarded by _debug_output_mutex.
+static std::thread _debug_output_thread; ///< The writer thread, see StartDebugOutputThread().
+static bool _debug_output_thread_active = false; ///< Whether debug_print may hand output to the writer thread, guarded by _debug_output_mutex.
+static bool _debug_output_thread_exit = false; ///< Tell the writer thread to drain its queue and exit, guarded by _debug_output_mutex.
+
 int _debug_driver_level;
 int _debug_grf_level;
 int _debug_map_level;
@@ -134,6 +154,43 @@ char *DumpDebugFacilityNames(char *buf, char *last)
 	return buf;
 }
 
+/**
+ * Write a formatted line of output; via the writer thread when it is running,
+ * so that the calling thread does not block on the write syscall. When the
+ * queue of the writer thread is over its bound the line is dropped rather
+ * than buffered further or written synchronously; the number of dropped
+ * lines is reported once the writer catches up again.
+ * @param stream The stream to write the line to.
+ * @param buffer The formatted line, including the trailing newline.
+ */
+void AsyncWriteLine(FILE *stream, const char *buffer)
+{
+	{
+		std::lock_guard<std::mutex> lock(_debug_output_mutex);
+		if (_debug_output_thread_active) {
+			if (_debug_output_queue.size() >= OUTPUT_QUEUE_LIMIT) {
+				_debug_output_dropped++;
+				return;
+			}
+			_debug_output_queue.push_back({ buffer, stream });
+			_debug_output_cv.notify_one();
+			return;
+		}
+	}
+	fputs(buffer, stream);
+	if (stream != stderr) fflush(stream);
+}
+
+/**
+ * Write a formatted debug line to the console, via the writer thread when it
+ * is running.
+ * @param buffer The formatted line, including the trailing newline.
+ */
+static void DebugWriteLine(const char *buffer)
+{
+	AsyncWriteLine(stderr, buffer);
+}
+
 /**
  * Internal function for outputting the debug line.
  * @param dbg Debug category.
@@ -204,10 +261,10 @@ void debug_print(const char *dbg, const char *buf)
 	 * crashing, and NetworkTextMessage includes these */
 #if defined(_WIN32)
 	if (strcmp(dbg, "desync") != 0) {
-		fputs(buffer, stderr);
+		DebugWriteLine(buffer);
 	}
 #else
-	fputs(buffer, stderr);
+	DebugWriteLine(buffer);
 #endif
 
 	if (_debug_remote_console.load()) {
@@ -466,6 +523,66 @@ void DebugSendRemoteMessages()
 	_debug_remote_console_queue_spare.clear();
 }
 
+/** Body of the debug output writer thread: drain queued lines to their streams. */
+static void DebugOutputThreadBody()
+{
+	std::vector<QueuedOutputLine> pending;
+	std::unique_lock<std::mutex> lock(_debug_output_mutex);
+	for (;;) {
+		_debug_output_cv.wait(lock, []() { return _debug_output_thread_exit || !_debug_output_queue.empty(); });
+		const bool exit = _debug_output_thread_exit && _debug_output_queue.empty();
+		std::swap(pending, _debug_output_queue);
+		uint dropped = _debug_output_dropped;
+		_debug_output_dropped = 0;
+		lock.unlock();
+
+		bool flush_stdout = false;
+		for (const QueuedOutputLine &item : pending) {
+			fputs(item.line.c_str(), item.stream);
+			if (item.stream == stdout) flush_stdout = true;
+		}
+		pending.clear();
+		if (flush_stdout) fflush(stdout);
+		if (dropped != 0) fprintf(stderr, "%u line(s) of output dropped, output was generated faster than it could be written\n", dropped);
+
+		if (exit) return;
+		lock.lock();
+	}
+}
+
+/**
+ * Start the thread which writes debug output in the background, so that
+ * enabling verbose debug categories does not stall the game loop on console
+ * write syscalls. Until this is called, and again after
+ * StopDebugOutputThread(), output is written synchronously.
+ */
+void StartDebugOutputThread()
+{
+	if (_debug_output_thread_active) return;
+	_debug_output_thread_exit = false;
+	if (!StartNewThread(&_debug_output_thread, "ottd:debug-out", &DebugOutputThreadBody)) return;
+
+	std::lock_guard<std::mutex> lock(_debug_output_mutex);
+	_debug_output_thread_active = true;
+}
+
+/**
+ * Flush and stop the debug output writer thread; subsequent output is again
+ * written synchronously on the calling thread.
+ */
+void StopDebugOutputThread()
+{
+	if (!_debug_output_thread_active) return;
+
+	{
+		std::lock_guard<std::mutex> lock(_debug_output_mutex);
+		_debug_output_thread_active = false;
+		_debug_output_thread_exit = true;
+	}
+	_debug_output_cv.notify_one();
+	_debug_output_thread.join();
+}
+
 /**
  * Reconsider whether we need to send debug messages to either NetworkAdminConsole
  * or IConsolePrint. The former is when they have enabled console handling whereas
@@ -139,4 +139,8 @@ char *DumpDesyncMsgLog(char *buffer, const char *last);
 void DebugSendRemoteMessages();
 void DebugReconsiderSendRemoteMessages();
 
+void StartDebugOutputThread();
+void StopDebugOutputThread();
+void AsyncWriteLine(FILE *stream, const char *buffer);
+
 #endif /* DEBUG_H */
@@ -33,6 +33,7 @@
 #include "cargo_type.h"
 #include "departures_func.h"
 #include "departures_type.h"
+#include "core/hash_func.hpp"
 #include "tracerestrict.h"
 #include "3rdparty/cpp-btree/btree_set.h"
 
@@ -211,6 +212,55 @@ static void ScheduledDispatchDepartureLocalFix(DepartureList *departure_list)
 	});
 }
 
+/**
+ * Compute a checksum over the journey state that departure projections depend on.
+ *
+ * The projections produced by MakeDepartureList() are absolute times derived
+ * from each vehicle's timetable and its progress along it. While a vehicle is
+ * merely travelling, its current order time advances in lockstep with the
+ * date, so the projected times do not move; they only change when a vehicle
+ * advances to another order, its lateness changes, it starts or finishes
+ * loading, a dispatch slot is consumed, or the departure horizon reaches the
+ * next day. A departure board may therefore reuse its current list as long as
+ * this checksum is unchanged. Timetable, order and vehicle list modifications
+ * invalidate departure boards directly via their window data.
+ * @param vehicles set of all the vehicles stopping at this station, as passed to MakeDepartureList()
+ * @return checksum of the state the departure projections depend on
+ */
+uint64 GetDepartureListStateChecksum(const std::vector<const Vehicle *> &vehicles)
+{
+	uint64 hash = vehicles.size();
+	auto add = [&](uint32 value) {
+		hash = ((hash << 13) | (hash >> 51)) ^ SimpleHash32(value);
+	};
+
+	/* The departure horizon is measured in days from now. */
+	add(_date);
+
+	for (const Vehicle *v : vehicles) {
+		add(v->index);
+		add(v->GetNumOrders());
+		add(v->cur_implicit_order_index | (uint32)(v->cur_real_order_index << 16));
+		add(v->cur_timetable_order_index);
+		add((uint32)v->lateness_counter);
+
+		uint32 flags = v->current_order.GetType();
+		if (v->current_order.IsType(OT_GOTO_DEPOT)) flags |= ((uint32)v->current_order.GetDepotActionType() << 8);
+		if (v->IsStoppedInDepot()) SetBit(flags, 16);
+		if (HasBit(v->vehicle_flags, VF_SCHEDULED_DISPATCH)) {
+			SetBit(flags, 17);
+			for (uint i = 0; i < v->orders->GetScheduledDispatchScheduleCount(); i++) {
+				const DispatchSchedule &ds = v->orders->GetDispatchScheduleByIndex(i);
+				add((uint32)ds.GetScheduledDispatchStartTick());
+				add((uint32)ds.GetScheduledDispatchLastDispatch());
+			}
+		}
+		add(flags);
+	}
+
+	return hash;
+}
+
 /**
  * Compute an up-to-date list of departures for a station.
  * @param station the station to compute the departures of
@@ -21,4 +21,6 @@
 DepartureList* MakeDepartureList(StationID station, const std::vector<const Vehicle *> &vehicles, DepartureType type = D_DEPARTURE,
 		bool show_vehicles_via = false, bool show_pax = true, bool show_freight = true);
 
+uint64 GetDepartureListStateChecksum(const std::vector<const Vehicle *> &vehicles);
+
 #endif /* DEPARTURES_FUNC_H */
@@ -98,6 +98,7 @@ protected:
 	uint entry_height;         ///< The height of an entry in the departures list.
 	uint64 elapsed_ms;         ///< The number of milliseconds that have elapsed since the window was created. Used for scrolling text.
 	int calc_tick_countdown;   ///< The number of ticks to wait until recomputing the departure list. Signed in case it goes below zero.
+	uint64 departures_checksum;///< Checksum of the journey state the current departures and arrivals lists were computed from.
 	bool show_types[4];        ///< The vehicle types to show in the departure list.
 	bool departure_types[3];   ///< The types of departure to show in the departure list.
 	bool departure_types_both; ///< Arrivals and departures buttons disabled (shown combined as single entry)
@@ -122,6 +123,7 @@ protected:
 		flag = !flag;
 		this->SetWidgetLoweredState(widget, flag);
 		/* We need to recompute the departures list. */
+		this->departures_invalid = true;
 		this->calc_tick_countdown = 0;
 		/* We need to redraw the button that was pressed. */
 		this->SetWidgetDirty(widget);
@@ -241,6 +243,7 @@ public:
 		vehicles_invalid(true),
 		elapsed_ms(0),
 		calc_tick_countdown(0),
+		departures_checksum(0),
 		min_width(400)
 	{
 		this->SetupValues();
@@ -393,6 +396,7 @@ public:
 				}
 
 				/* We need to recompute the departures list. */
+				this->departures_invalid = true;
 				this->calc_tick_countdown = 0;
 				/* We need to redraw the button that was pressed. */
 				this->SetWidgetDirty(widget);
@@ -492,14 +496,20 @@ public:
 		/* Recompute the list of departures if we're due to. */
 		if (this->calc_tick_countdown <= 0) {
 			this->calc_tick_countdown = _settings_client.gui.departure_calc_frequency;
-			this->DeleteDeparturesList(this->departures);
-			this->DeleteDeparturesList(this->arrivals);
-			bool show_pax = _settings_client.gui.departure_only_passengers ? true : this->show_pax;
-			bool show_freight = _settings_client.gui.departure_only_passengers ? false : this->show_freight;
-			this->departures = (this->departure_types[0] || _settings_client.gui.departure_show_both ? MakeDepartureList(this->station, this->vehicles, D_DEPARTURE, Twaypoint || this->departure_types[2], show_pax, show_freight) : new DepartureList());
-			this->arrivals   = (this->departure_types[1] && !_settings_client.gui.departure_show_both ? MakeDepartureList(this->station, this->vehicles, D_ARRIVAL, false, show_pax, show_freight) : new DepartureList());
-			this->departures_invalid = false;
-			this->SetWidgetDirty(WID_DB_LIST);
+
+			/* Skip the recomputation when no journey state the projections depend on has changed since last time. */
+			uint64 checksum = GetDepartureListStateChecksum(this->vehicles);
+			if (this->departures_invalid || checksum != this->departures_checksum) {
+				this->departures_checksum = checksum;
+				this->DeleteDeparturesList(this->departures);
+				this->DeleteDeparturesList(this->arrivals);
+				bool show_pax = _settings_client.gui.departure_only_passengers ? true : this->show_pax;
+				bool show_freight = _settings_client.gui.departure_only_passengers ? false : this->show_freight;
+				this->departures = (this->departure_types[0] || _settings_client.gui.departure_show_both ? MakeDepartureList(this->station, this->vehicles, D_DEPARTURE, Twaypoint || this->departure_types[2], show_pax, show_freight) : new DepartureList());
+				this->arrivals   = (this->departure_types[1] && !_settings_client.gui.departure_show_both ? MakeDepartureList(this->station, this->vehicles, D_ARRIVAL, false, show_pax, show_freight) : new DepartureList());
+				this->departures_invalid = false;
+				this->SetWidgetDirty(WID_DB_LIST);
+			}
 		}
 
 		uint new_width = this->GetMinWidth();
@@ -51,6 +51,7 @@
 #include "story_base.h"
 #include "linkgraph/refresh.h"
 #include "tracerestrict.h"
+#include "widgets/station_widget.h"
 #include "tbtr_template_vehicle.h"
 #include "tbtr_template_vehicle_func.h"
 #include "scope_info.h"
@@ -144,6 +145,10 @@ Money CalculateCompanyValueExcludingShares(const Company *c, bool including_loan
 
 	Money value = num * _price[PR_STATION_VALUE] * 25;
 
+	/* Sum the vehicle values with a single overflow check at the end; this
+	 * loop visits every vehicle and the per-addition clamping of Money is
+	 * measurable on large games. */
+	OverflowSafeAccumulator<int64> vehicle_value;
 	for (const Vehicle *v : Vehicle::Iterate()) {
 		if (v->owner != owner) continue;
 		if (HasBit(v->subtype, GVSF_VIRTUAL)) continue;
@@ -152,9 +157,10 @@ Money CalculateCompanyValueExcludingShares(const Company *c, bool including_loan
 				v->type == VEH_ROAD ||
 				(v->type == VEH_AIRCRAFT && Aircraft::From(v)->IsNormalAircraft()) ||
 				v->type == VEH_SHIP) {
-			value += v->value * 3 >> 1;
+			vehicle_value.Add(v->value * 3 >> 1);
 		}
 	}
+	value += vehicle_value.Result();
 
 	/* Add real money value */
 	if (including_loan) value -= c->current_loan;
@@ -1410,15 +1416,16 @@ CargoPayment::~CargoPayment()
  * Handle payment for final delivery of the given cargo packet.
  * @param cp The cargo packet to pay for.
  * @param count The number of packets to pay for.
+ * @param days_in_transit The absolute number of days the cargo has been in transit.
  */
-void CargoPayment::PayFinalDelivery(CargoPacket *cp, uint count)
+void CargoPayment::PayFinalDelivery(CargoPacket *cp, uint count, uint16 days_in_transit)
 {
 	if (this->owner == nullptr) {
 		this->owner = Company::Get(this->front->owner);
 	}
 
 	/* Handle end of route payment */
-	Money profit = DeliverGoods(count, this->ct, this->current_station, cp->SourceStationXY(), cp->DaysInTransit(), this->owner, cp->SourceSubsidyType(), cp->SourceSubsidyID());
+	Money profit = DeliverGoods(count, this->ct, this->current_station, cp->SourceStationXY(), days_in_transit, this->owner, cp->SourceSubsidyType(), cp->SourceSubsidyID());
 
 	profit -= cp->FeederShare(count);
 
@@ -1434,16 +1441,17 @@ void CargoPayment::PayFinalDelivery(CargoPacket *cp, uint count)
  * Handle payment for transfer of the given cargo packet.
  * @param cp The cargo packet to pay for; actual payment won't be made!.
  * @param count The number of packets to pay for.
+ * @param days_in_transit The absolute number of days the cargo has been in transit.
  * @return The amount of money paid for the transfer.
  */
-Money CargoPayment::PayTransfer(CargoPacket *cp, uint count)
+Money CargoPayment::PayTransfer(CargoPacket *cp, uint count, uint16 days_in_transit)
 {
 	Money profit = -cp->FeederShare(count) + GetTransportedGoodsIncome(
 			count,
 			/* pay transfer vehicle the difference between the payment for the journey from
 			 * the source to the current point, and the sum of the previous transfer payments */
 			DistanceManhattan(cp->SourceStationXY(), Station::Get(this->current_station)->xy),
-			cp->DaysInTransit(),
+			days_in_transit,
 			this->ct);
 
 	profit = profit * _settings_game.economy.feeder_payment_share / 100;
@@ -1487,6 +1495,7 @@ void PrepareUnload(Vehicle *front_v)
 {
 	Station *curr_station = Station::Get(front_v->last_station_visited);
 	curr_station->loading_vehicles.push_back(front_v);
+	_stations_with_loading_vehicles.insert(curr_station->index);
 
 	/* At this moment loading cannot be finished */
 	ClrBit(front_v->vehicle_flags, VF_LOADING_FINISHED);
@@ -2072,6 +2081,7 @@ static void LoadUnloadVehicle(Vehicle *front)
 					 * first unload to prevent the cargo from quickly decaying after the initial drop. */
 					ge->time_since_pickup = 0;
 					SetBit(ge->status, GoodsEntry::GES_RATING);
+					SetBit(st->goods_rating_pending, v->cargo_type);
 				}
 			}
 
@@ -2344,7 +2354,9 @@ static void LoadUnloadVehicle(Vehicle *front)
 	}
 	if (dirty_station) {
 		st->MarkTilesDirty(true);
-		SetWindowDirty(WC_STATION_VIEW, last_visited);
+		/* Only the waiting cargo list changes while loading/unloading, not the whole window. */
+		SetWindowWidgetDirty(WC_STATION_VIEW, last_visited, WID_SV_WAITING);
+		SetWindowWidgetDirty(WC_STATION_VIEW, last_visited, WID_SV_SCROLLBAR);
 		InvalidateWindowData(WC_STATION_LIST, last_visited);
 	}
 }
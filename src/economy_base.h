@@ -37,8 +37,8 @@ struct CargoPayment : CargoPaymentPool::PoolItem<&_cargo_payment_pool> {
 	CargoPayment(Vehicle *front);
 	~CargoPayment();
 
-	Money PayTransfer(CargoPacket *cp, uint count);
-	void PayFinalDelivery(CargoPacket *cp, uint count);
+	Money PayTransfer(CargoPacket *cp, uint count, uint16 days_in_transit);
+	void PayFinalDelivery(CargoPacket *cp, uint count, uint16 days_in_transit);
 
 	/**
 	 * Sets the currently handled cargo type.
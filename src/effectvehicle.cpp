@@ -17,7 +17,6 @@
 #include "effectvehicle_func.h"
 #include "effectvehicle_base.h"
 #include "core/checksum_func.hpp"
-#include "core/container_func.hpp"
 
 #include <algorithm>
 
@@ -673,7 +672,7 @@ EffectVehicle *CreateEffectVehicleRel(const Vehicle *v, int x, int y, int z, Eff
 bool EffectVehicle::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("EffectVehicle::Tick: v: %u, x: %d, y: %d", this->index, this->x_pos, this->y_pos);
-	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos);
+	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos, SCA_VEHICLES);
 	return _effect_tick_procs[this->subtype](this);
 }
 
@@ -695,19 +694,22 @@ TransparencyOption EffectVehicle::GetTransparencyOption() const
 	return _effect_transparency_options[this->subtype];
 }
 
-extern std::vector<VehicleID> _remove_from_tick_effect_veh_cache;
-extern btree::btree_set<VehicleID> _tick_effect_veh_cache;
+extern std::vector<VehicleID> _tick_effect_veh_cache;
 extern bool _tick_caches_valid;
 
 void EffectVehicle::AddEffectVehicleToTickCache()
 {
 	if (!_tick_caches_valid) return;
-	if (container_unordered_remove(_remove_from_tick_effect_veh_cache, this->index) > 0) return;
-	_tick_effect_veh_cache.insert(this->index);
+	/* Keep the cache sorted by id: tick order is sync-relevant (effect ticks
+	 * consume the shared Random() stream), so it must match the pool-index
+	 * order a rebuild after save/load or client join produces. */
+	auto it = std::lower_bound(_tick_effect_veh_cache.begin(), _tick_effect_veh_cache.end(), this->index);
+	_tick_effect_veh_cache.insert(it, this->index);
 }
 
 void EffectVehicle::RemoveEffectVehicleFromTickCache()
 {
 	if (!_tick_caches_valid) return;
-	_remove_from_tick_effect_veh_cache.push_back(this->index);
+	auto it = std::lower_bound(_tick_effect_veh_cache.begin(), _tick_effect_veh_cache.end(), this->index);
+	if (it != _tick_effect_veh_cache.end() && *it == this->index) _tick_effect_veh_cache.erase(it);
 }
@@ -345,6 +345,15 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 
 	AdjustTileh(ti->tile, &tileh[TS_HOME]);
 
+	/* Find the bridge above only once; it is needed for the PCP override check
+	 * of each tile edge and for the wire check further down. */
+	int bridge_above_height = 0;
+	Track bridge_above_track = INVALID_TRACK;
+	if (IsBridgeAbove(ti->tile)) {
+		bridge_above_height = GetBridgeHeight(GetNorthernBridgeEnd(ti->tile));
+		bridge_above_track = GetBridgeAxis(ti->tile) == AXIS_X ? TRACK_X : TRACK_Y;
+	}
+
 	SpriteID pylon_normal = 0;
 	SpriteID pylon_halftile = 0;
 	SpriteID pylon_normal_secondary = 0;
@@ -481,12 +490,9 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 		 * Remove those (simply by ANDing with allowed, since these markers are never allowed) */
 		if ((PPPallowed[i] & PPPpreferred[i]) != 0) PPPallowed[i] &= PPPpreferred[i];
 
-		if (IsBridgeAbove(ti->tile)) {
-			Track bridgetrack = GetBridgeAxis(ti->tile) == AXIS_X ? TRACK_X : TRACK_Y;
-			int height = GetBridgeHeight(GetNorthernBridgeEnd(ti->tile));
-
-			if ((height <= GetTileMaxZ(ti->tile) + 1) &&
-					(i == PCPpositions[bridgetrack][0] || i == PCPpositions[bridgetrack][1])) {
+		if (bridge_above_track != INVALID_TRACK) {
+			if ((bridge_above_height <= GetTileMaxZ(ti->tile) + 1) &&
+					(i == PCPpositions[bridge_above_track][0] || i == PCPpositions[bridge_above_track][1])) {
 				SetBit(OverridePCP, i);
 			}
 		}
@@ -494,7 +500,7 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 		if (PPPallowed[i] != 0 && HasBit(PCPstatus, i) && !HasBit(OverridePCP, i) &&
 				(!IsRailStationTile(ti->tile) || CanStationTileHavePylons(ti->tile))) {
 			for (Direction k = DIR_BEGIN; k < DIR_END; k++) {
-				byte temp = PPPorder[i][GetTLG(ti->tile)][k];
+				byte temp = PPPorder[i][tlg][k];
 
 				if (HasBit(PPPallowed[i], temp)) {
 					uint x  = ti->x + x_pcp_offsets[i] + x_ppp_offsets[temp];
@@ -520,10 +526,8 @@ static void DrawRailCatenaryRailway(const TileInfo *ti)
 	if (IsTunnelTile(ti->tile)) return;
 
 	/* Don't draw a wire under a low bridge */
-	if (IsBridgeAbove(ti->tile) && !IsTransparencySet(TO_BRIDGES)) {
-		int height = GetBridgeHeight(GetNorthernBridgeEnd(ti->tile));
-
-		if (height <= GetTileMaxZ(ti->tile) + 1) return;
+	if (bridge_above_track != INVALID_TRACK && !IsTransparencySet(TO_BRIDGES)) {
+		if (bridge_above_height <= GetTileMaxZ(ti->tile) + 1) return;
 	}
 
 	/* Don't draw a wire if the station tile does not want any */
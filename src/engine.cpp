@@ -587,6 +587,10 @@ void SetupEngines()
 	DeleteWindowByClass(WC_ENGINE_PREVIEW);
 	_engine_pool.CleanPool();
 
+	/* The engine IDs are about to mean something else. */
+	extern void ClearEngineSortCapacityCache();
+	ClearEngineSortCapacityCache();
+
 	assert(_engine_mngr.size() >= _engine_mngr.NUM_DEFAULT_ENGINES);
 	[[maybe_unused]] uint index = 0;
 	for (const EngineIDMapping &eid : _engine_mngr) {
@@ -410,6 +410,158 @@ static void SimplifyFileName(char *name)
 #endif
 }
 
+/**
+ * Persisted index of tar archive contents, so an unchanged tar does not have
+ * to be re-read on every startup. Entries are keyed on the tar's path and
+ * validated against its size and modification time before use; a stale or
+ * missing entry simply falls back to the normal scan, which then refreshes
+ * the index.
+ */
+struct TarScanIndexEntry {
+	uint64 size = 0;     ///< Size of the tar file when it was scanned.
+	int64 mtime = 0;     ///< Modification time of the tar file when it was scanned.
+	std::string dirname; ///< First directory found in the tar, for #_tar_list.
+	std::vector<std::pair<std::string, TarFileListEntry>> files; ///< Files found in the tar.
+	std::vector<std::pair<std::string, std::string>> links;      ///< Links found in the tar, as passed to TarAddLink().
+	bool used = false;   ///< Whether this entry was hit or refreshed this session.
+};
+
+static const uint32 TAR_SCAN_INDEX_MAGIC = 'T' | ('S' << 8) | ('I' << 16) | ('X' << 24);
+static const uint32 TAR_SCAN_INDEX_VERSION = 1;
+
+static std::map<std::string, TarScanIndexEntry> _tar_scan_index;
+static bool _tar_scan_index_loaded = false;
+static bool _tar_scan_index_dirty = false;
+
+static std::string GetTarScanIndexPath()
+{
+	return _personal_dir + "tar-scan.dat";
+}
+
+static void EnsureTarScanIndexLoaded()
+{
+	if (_tar_scan_index_loaded) return;
+	_tar_scan_index_loaded = true;
+	if (_personal_dir.empty()) return;
+
+	std::string path = GetTarScanIndexPath();
+	FILE *f = fopen(path.c_str(), "rb");
+	if (f == nullptr) return;
+
+	auto fail = [&]() {
+		DEBUG(misc, 1, "Discarding unusable tar scan index: %s", path.c_str());
+		_tar_scan_index.clear();
+		fclose(f);
+	};
+
+	auto read_string = [&](std::string &str) -> bool {
+		uint16 len;
+		if (fread(&len, sizeof(len), 1, f) != 1) return false;
+		str.resize(len);
+		return len == 0 || fread(&str[0], len, 1, f) == 1;
+	};
+
+	uint32 header[2];
+	uint32 count;
+	if (fread(header, sizeof(header), 1, f) != 1 ||
+			header[0] != TAR_SCAN_INDEX_MAGIC || header[1] != TAR_SCAN_INDEX_VERSION) return fail();
+	if (fread(&count, sizeof(count), 1, f) != 1 || count > 1024 * 1024) return fail();
+
+	for (uint32 i = 0; i < count; i++) {
+		std::string tar_filename;
+		TarScanIndexEntry entry;
+		uint32 num_files, num_links;
+		if (!read_string(tar_filename) ||
+				fread(&entry.size, sizeof(entry.size), 1, f) != 1 ||
+				fread(&entry.mtime, sizeof(entry.mtime), 1, f) != 1 ||
+				!read_string(entry.dirname) ||
+				fread(&num_files, sizeof(num_files), 1, f) != 1 || num_files > 1024 * 1024 ||
+				fread(&num_links, sizeof(num_links), 1, f) != 1 || num_links > 1024 * 1024) return fail();
+		entry.files.resize(num_files);
+		for (auto &file : entry.files) {
+			uint64 file_size, position;
+			if (!read_string(file.first) ||
+					fread(&file_size, sizeof(file_size), 1, f) != 1 ||
+					fread(&position, sizeof(position), 1, f) != 1) return fail();
+			file.second.tar_filename = tar_filename;
+			file.second.size = (size_t)file_size;
+			file.second.position = (size_t)position;
+		}
+		entry.links.resize(num_links);
+		for (auto &link : entry.links) {
+			if (!read_string(link.first) || !read_string(link.second)) return fail();
+		}
+		_tar_scan_index[std::move(tar_filename)] = std::move(entry);
+	}
+	fclose(f);
+	DEBUG(misc, 2, "Read tar scan index: %s, %u tars", path.c_str(), count);
+}
+
+/** Write the tar scan index back to its file, if anything changed. */
+static void SaveTarScanIndex()
+{
+	if (!_tar_scan_index_dirty || _personal_dir.empty()) return;
+	_tar_scan_index_dirty = false;
+
+	std::string path = GetTarScanIndexPath();
+	std::string tmp_path = path + ".tmp";
+	FILE *f = fopen(tmp_path.c_str(), "wb");
+	if (f == nullptr) {
+		DEBUG(misc, 0, "Failed to write tar scan index: %s", tmp_path.c_str());
+		return;
+	}
+
+	bool ok = true;
+	auto write_string = [&](const std::string &str) {
+		uint16 len = (uint16)std::min<size_t>(str.size(), UINT16_MAX);
+		ok = ok && fwrite(&len, sizeof(len), 1, f) == 1;
+		ok = ok && (len == 0 || fwrite(str.data(), len, 1, f) == 1);
+	};
+
+	/* Entries which were neither hit nor refreshed belong to subdirectories
+	 * not covered by this scan; keep them, but let entries of deleted tars go. */
+	std::vector<const std::pair<const std::string, TarScanIndexEntry> *> keep;
+	for (const auto &it : _tar_scan_index) {
+		if (!it.second.used && !FileExists(it.first)) continue;
+		keep.push_back(&it);
+	}
+
+	uint32 header[2] = { TAR_SCAN_INDEX_MAGIC, TAR_SCAN_INDEX_VERSION };
+	uint32 count = (uint32)keep.size();
+	ok = ok && fwrite(header, sizeof(header), 1, f) == 1;
+	ok = ok && fwrite(&count, sizeof(count), 1, f) == 1;
+	for (const auto *it : keep) {
+		const TarScanIndexEntry &entry = it->second;
+		write_string(it->first);
+		ok = ok && fwrite(&entry.size, sizeof(entry.size), 1, f) == 1;
+		ok = ok && fwrite(&entry.mtime, sizeof(entry.mtime), 1, f) == 1;
+		write_string(entry.dirname);
+		uint32 num_files = (uint32)entry.files.size();
+		uint32 num_links = (uint32)entry.links.size();
+		ok = ok && fwrite(&num_files, sizeof(num_files), 1, f) == 1;
+		ok = ok && fwrite(&num_links, sizeof(num_links), 1, f) == 1;
+		for (const auto &file : entry.files) {
+			write_string(file.first);
+			uint64 file_size = file.second.size;
+			uint64 position = file.second.position;
+			ok = ok && fwrite(&file_size, sizeof(file_size), 1, f) == 1;
+			ok = ok && fwrite(&position, sizeof(position), 1, f) == 1;
+		}
+		for (const auto &link : entry.links) {
+			write_string(link.first);
+			write_string(link.second);
+		}
+	}
+	fclose(f);
+
+	if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+		DEBUG(misc, 0, "Failed to write tar scan index: %s", path.c_str());
+		unlink(tmp_path.c_str());
+		return;
+	}
+	DEBUG(misc, 2, "Wrote tar scan index: %s, %u tars", path.c_str(), count);
+}
+
 /**
  * Perform the scanning of a particular subdirectory.
  * @param sd The subdirectory to scan.
@@ -448,6 +600,7 @@ uint TarScanner::DoScan(Subdirectory sd)
 		num += fs.DoScan(HEIGHTMAP_DIR);
 	}
 	DEBUG(misc, 2, "Scan complete, found %d files", num);
+	SaveTarScanIndex();
 	return num;
 }
 
@@ -494,6 +647,30 @@ bool TarScanner::AddFile(const std::string &filename, size_t basepath_length, co
 	TarList::iterator it = _tar_list[this->subdir].find(filename);
 	if (it != _tar_list[this->subdir].end()) return false;
 
+	EnsureTarScanIndexLoaded();
+
+	struct stat sb;
+	bool have_stat = stat(filename.c_str(), &sb) == 0;
+	if (have_stat) {
+		auto index_it = _tar_scan_index.find(filename);
+		if (index_it != _tar_scan_index.end() &&
+				index_it->second.size == (uint64)sb.st_size && index_it->second.mtime == (int64)sb.st_mtime) {
+			/* The tar has not changed since it was last scanned,
+			 * replay the indexed scan result instead of reading it. */
+			TarScanIndexEntry &entry = index_it->second;
+			entry.used = true;
+			_tar_list[this->subdir][filename] = entry.dirname;
+			for (const auto &file : entry.files) {
+				_tar_filelist[this->subdir].insert(TarFileList::value_type(file.first, file.second));
+			}
+			for (const auto &link : entry.links) {
+				TarAddLink(link.first, link.second, this->subdir);
+			}
+			DEBUG(misc, 4, "Restored tar '%s' with " PRINTF_SIZE " files from the scan index", filename.c_str(), entry.files.size());
+			return true;
+		}
+	}
+
 	FILE *f = fopen(filename.c_str(), "rb");
 	/* Although the file has been found there can be
 	 * a number of reasons we cannot open the file.
@@ -504,6 +681,7 @@ bool TarScanner::AddFile(const std::string &filename, size_t basepath_length, co
 	_tar_list[this->subdir][filename] = std::string{};
 
 	TarLinkList links; ///< Temporary list to collect links
+	TarScanIndexEntry index_entry; ///< Scan result, to remember in the scan index
 
 	TarHeader th;
 	char buf[sizeof(th.name) + 1], *end;
@@ -562,6 +740,7 @@ bool TarScanner::AddFile(const std::string &filename, size_t basepath_length, co
 
 				DEBUG(misc, 6, "Found file in tar: %s (" PRINTF_SIZE " bytes, " PRINTF_SIZE " offset)", name, skip, pos);
 				if (_tar_filelist[this->subdir].insert(TarFileList::value_type(name, entry)).second) num++;
+				index_entry.files.push_back({ name, entry });
 
 				break;
 			}
@@ -678,6 +857,17 @@ bool TarScanner::AddFile(const std::string &filename, size_t basepath_length, co
 		TarAddLink(src, dest, this->subdir);
 	}
 
+	if (have_stat) {
+		/* Remember the scan result, so the next startup does not need to read the tar. */
+		index_entry.size = (uint64)sb.st_size;
+		index_entry.mtime = (int64)sb.st_mtime;
+		index_entry.dirname = _tar_list[this->subdir][filename];
+		index_entry.links.assign(links.begin(), links.end());
+		index_entry.used = true;
+		_tar_scan_index[filename] = std::move(index_entry);
+		_tar_scan_index_dirty = true;
+	}
+
 	return true;
 }
 
@@ -27,6 +27,7 @@
 #include "widgets/framerate_widget.h"
 
 #include <atomic>
+#include <cmath>
 #include <mutex>
 #if defined(__MINGW32__)
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
@@ -48,6 +49,10 @@ namespace {
 	const int NUM_FRAMERATE_POINTS = 512;
 	/** %Units a second is divided into in performance measurements */
 	const TimingMeasurement TIMESTAMP_PRECISION = 1000000;
+	/** Number of linear sub-buckets per power of two in duration histograms, as a bit count */
+	const uint HISTOGRAM_SUB_BUCKET_BITS = 2;
+	/** Number of buckets in duration histograms, last bucket takes all longer durations */
+	const uint NUM_HISTOGRAM_BUCKETS = 96;
 
 	struct PerformanceData {
 		/** Duration value indicating the value is not valid should be considered a gap in measurements */
@@ -71,13 +76,81 @@ namespace {
 		/** Start time for current accumulation cycle */
 		TimingMeasurement acc_timestamp;
 
+		/** Number of completed measurements per duration bucket, see DurationBucket(). Unlike the ring buffers this is never overwritten. */
+		uint64 hist_count[NUM_HISTOGRAM_BUCKETS];
+		/** Total number of measurements recorded in \c hist_count */
+		uint64 hist_samples;
+		/** Sum of all measured durations recorded in \c hist_count */
+		TimingMeasurement hist_sum;
+		/** Largest duration recorded in \c hist_count */
+		TimingMeasurement hist_max;
+
 		/**
 		 * Initialize a data element with an expected collection rate
 		 * @param expected_rate
 		 * Expected number of cycles per second of the performance element. Use 1 if unknown or not relevant.
 		 * The rate is used for highlighting slow-running elements in the GUI.
 		 */
-		explicit PerformanceData(double expected_rate) : expected_rate(expected_rate), next_index(0), prev_index(0), num_valid(0) { }
+		explicit PerformanceData(double expected_rate) : expected_rate(expected_rate), next_index(0), prev_index(0), num_valid(0),
+				acc_duration(0), acc_timestamp(0), hist_count(), hist_samples(0), hist_sum(0), hist_max(0) { }
+
+		/**
+		 * Get the histogram bucket for a measured duration.
+		 * Buckets are logarithmic with four linear sub-buckets per power of two,
+		 * bounding the quantisation error at 25% over the whole range.
+		 */
+		static uint DurationBucket(TimingMeasurement duration)
+		{
+			if (duration < (1 << HISTOGRAM_SUB_BUCKET_BITS)) return (uint)duration;
+			uint log = FindLastBit(duration);
+			uint index = ((log - HISTOGRAM_SUB_BUCKET_BITS + 1) << HISTOGRAM_SUB_BUCKET_BITS) |
+					((uint)(duration >> (log - HISTOGRAM_SUB_BUCKET_BITS)) & ((1 << HISTOGRAM_SUB_BUCKET_BITS) - 1));
+			return std::min(index, NUM_HISTOGRAM_BUCKETS - 1);
+		}
+
+		/** Get the lower bound of a histogram bucket, in the units durations are measured in */
+		static TimingMeasurement BucketLowerBound(uint index)
+		{
+			if (index < (1 << HISTOGRAM_SUB_BUCKET_BITS)) return index;
+			uint major = index >> HISTOGRAM_SUB_BUCKET_BITS;
+			uint sub = index & ((1 << HISTOGRAM_SUB_BUCKET_BITS) - 1);
+			return (TimingMeasurement)((1 << HISTOGRAM_SUB_BUCKET_BITS) + sub) << (major - 1);
+		}
+
+		/** Record a completed measurement in the duration histogram */
+		void AddHistogram(TimingMeasurement duration)
+		{
+			this->hist_count[DurationBucket(duration)]++;
+			this->hist_samples++;
+			this->hist_sum += duration;
+			if (duration > this->hist_max) this->hist_max = duration;
+		}
+
+		/** Forget all measurements recorded in the duration histogram */
+		void ResetHistogram()
+		{
+			memset(this->hist_count, 0, sizeof(this->hist_count));
+			this->hist_samples = 0;
+			this->hist_sum = 0;
+			this->hist_max = 0;
+		}
+
+		/**
+		 * Get an upper bound for the duration at a given percentile, from the histogram.
+		 * @param percentile the percentile to look up, as a fraction (e.g. 0.99).
+		 * @return upper bound of the bucket the percentile falls in, clamped to the largest seen duration.
+		 */
+		TimingMeasurement GetDurationPercentile(double percentile) const
+		{
+			uint64 rank = (uint64)std::ceil(this->hist_samples * percentile);
+			if (rank == 0) return 0;
+			uint64 seen = 0;
+			for (uint i = 0; i < NUM_HISTOGRAM_BUCKETS; i++) {
+				seen += this->hist_count[i];
+				if (seen >= rank) return std::min<TimingMeasurement>(BucketLowerBound(i + 1), this->hist_max);
+			}
+			return this->hist_max;
+		}
 
 		/** Collect a complete measurement, given start and ending times for a processing block */
 		void Add(TimingMeasurement start_time, TimingMeasurement end_time)
@@ -88,6 +161,7 @@ namespace {
 			this->next_index += 1;
 			if (this->next_index >= NUM_FRAMERATE_POINTS) this->next_index = 0;
 			this->num_valid = std::min(NUM_FRAMERATE_POINTS, this->num_valid + 1);
+			this->AddHistogram(end_time - start_time);
 		}
 
 		/** Begin an accumulation of multiple measurements into a single value, from a given start time */
@@ -99,6 +173,7 @@ namespace {
 			this->next_index += 1;
 			if (this->next_index >= NUM_FRAMERATE_POINTS) this->next_index = 0;
 			this->num_valid = std::min(NUM_FRAMERATE_POINTS, this->num_valid + 1);
+			this->AddHistogram(this->acc_duration);
 
 			this->acc_duration = 0;
 			this->acc_timestamp = start_time;
@@ -1021,6 +1096,16 @@ static WindowDesc _frametime_graph_window_desc(
 
 
 
+/**
+ * Get the average duration of recent game loop ticks.
+ * @param count Number of recent ticks to average over.
+ * @return Average game loop duration in milliseconds.
+ */
+double GetAverageGameLoopDurationMilliseconds(int count)
+{
+	return _pf_data[PFE_GAMELOOP].GetAverageDurationMilliseconds(count);
+}
+
 /** Open the general framerate window */
 void ShowFramerateWindow()
 {
@@ -1034,6 +1119,24 @@ void ShowFrametimeGraphWindow(PerformanceElement elem)
 	AllocateWindowDescFront<FrametimeGraphWindow>(&_frametime_graph_window_desc, elem, true);
 }
 
+/** Console names of the performance elements, in #PerformanceElement order up to the AI slots */
+static const char *MEASUREMENT_NAMES[PFE_MAX] = {
+	"Game loop",
+	"  GL station ticks",
+	"  GL train ticks",
+	"  GL road vehicle ticks",
+	"  GL ship ticks",
+	"  GL aircraft ticks",
+	"  GL landscape ticks",
+	"  GL link graph delays",
+	"Drawing",
+	"  Viewport drawing",
+	"Video output",
+	"Sound mixing",
+	"AI/GS scripts total",
+	"Game script",
+};
+
 /** Print performance statistics to game console */
 void ConPrintFramerate()
 {
@@ -1043,22 +1146,6 @@ void ConPrintFramerate()
 
 	IConsolePrintF(TC_SILVER, "Based on num. data points: %d %d %d", count1, count2, count3);
 
-	static const char *MEASUREMENT_NAMES[PFE_MAX] = {
-		"Game loop",
-		"  GL station ticks",
-		"  GL train ticks",
-		"  GL road vehicle ticks",
-		"  GL ship ticks",
-		"  GL aircraft ticks",
-		"  GL landscape ticks",
-		"  GL link graph delays",
-		"Drawing",
-		"  Viewport drawing",
-		"Video output",
-		"Sound mixing",
-		"AI/GS scripts total",
-		"Game script",
-	};
 	char ai_name_buf[128];
 
 	static const PerformanceElement rate_elements[] = { PFE_GAMELOOP, PFE_DRAWING, PFE_VIDEO };
@@ -1098,6 +1185,53 @@ void ConPrintFramerate()
 	}
 }
 
+/**
+ * Print the long-run duration histograms to the game console, one line of
+ * percentiles per performance element. Unlike 'fps' this is based on every
+ * measurement taken since the last reset, not a short sample ring, so it is
+ * suitable for judging p99 tick times over hours of running.
+ */
+void ConPrintFramerateHistogram()
+{
+	char ai_name_buf[128];
+
+	bool printed_anything = false;
+
+	for (PerformanceElement e = PFE_FIRST; e < PFE_MAX; e++) {
+		auto &pf = _pf_data[e];
+		if (pf.hist_samples == 0) continue;
+		const char *name;
+		if (e < PFE_AI0) {
+			name = MEASUREMENT_NAMES[e];
+		} else {
+			seprintf(ai_name_buf, lastof(ai_name_buf), "AI %d %s", e - PFE_AI0 + 1, GetAIName(e - PFE_AI0)),
+			name = ai_name_buf;
+		}
+		IConsolePrintF(TC_LIGHT_BLUE, "%s: " OTTD_PRINTF64U " samples, mean %.2fms, p50 %.2fms, p95 %.2fms, p99 %.2fms, p99.9 %.2fms, max %.2fms",
+			name,
+			pf.hist_samples,
+			(double)pf.hist_sum / pf.hist_samples * 1000 / TIMESTAMP_PRECISION,
+			(double)pf.GetDurationPercentile(0.50) * 1000 / TIMESTAMP_PRECISION,
+			(double)pf.GetDurationPercentile(0.95) * 1000 / TIMESTAMP_PRECISION,
+			(double)pf.GetDurationPercentile(0.99) * 1000 / TIMESTAMP_PRECISION,
+			(double)pf.GetDurationPercentile(0.999) * 1000 / TIMESTAMP_PRECISION,
+			(double)pf.hist_max * 1000 / TIMESTAMP_PRECISION);
+		printed_anything = true;
+	}
+
+	if (!printed_anything) {
+		IConsoleWarning("No performance measurements have been taken yet");
+	}
+}
+
+/** Forget all measurements in the long-run duration histograms */
+void ConResetFramerateHistogram()
+{
+	for (PerformanceElement e = PFE_FIRST; e < PFE_MAX; e++) {
+		_pf_data[e].ResetHistogram();
+	}
+}
+
 void ProcessPendingPerformanceMeasurements()
 {
 	if (_sound_perf_pending.load(std::memory_order_acquire)) {
@@ -122,5 +122,6 @@ public:
 
 void ShowFramerateWindow();
 void ProcessPendingPerformanceMeasurements();
+double GetAverageGameLoopDurationMilliseconds(int count);
 
 #endif /* FRAMERATE_TYPE_H */
@@ -614,6 +614,33 @@ static int DrawLayoutLine(const ParagraphLayouter::Line &line, int y, int left,
 
 		draw_shadow = fc->GetDrawGlyphShadow() && (colour & TC_NO_SHADE) == 0 && (colour & ~TC_FORCED) != TC_BLACK;
 
+		/* Draw the glyphs of the run in two passes, shadows first, so the
+		 * colour remap is set up twice per run instead of per glyph, and a
+		 * glyph is never overdrawn by the shadow of its neighbour. */
+		if (draw_shadow) {
+			ctx.SetColourRemap(TC_BLACK);
+			for (int i = 0; i < run.GetGlyphCount(); i++) {
+				GlyphID glyph = run.GetGlyphs()[i];
+
+				/* Not a valid glyph (empty) */
+				if (glyph == 0xFFFF || (glyph & SPRITE_GLYPH) != 0) continue;
+
+				int begin_x = (int)run.GetPositions()[i * 2]     + left - offset_x;
+				int end_x   = (int)run.GetPositions()[i * 2 + 2] + left - offset_x  - 1;
+				int top     = (int)run.GetPositions()[i * 2 + 1] + y;
+
+				/* Truncated away. */
+				if (truncation && (begin_x < min_x || end_x > max_x)) continue;
+
+				const Sprite *sprite = fc->GetGlyph(glyph);
+				/* Check clipping (the "+ 1" is for the shadow). */
+				if (begin_x + sprite->x_offs > dpi_right || begin_x + sprite->x_offs + sprite->width /* - 1 + 1 */ < dpi_left) continue;
+
+				GfxMainBlitter(ctx, sprite, begin_x + shadow_offset, top + shadow_offset, BM_COLOUR_REMAP);
+			}
+			ctx.SetColourRemap(colour);
+		}
+
 		for (int i = 0; i < run.GetGlyphCount(); i++) {
 			GlyphID glyph = run.GetGlyphs()[i];
 
@@ -631,11 +658,6 @@ static int DrawLayoutLine(const ParagraphLayouter::Line &line, int y, int left,
 			/* Check clipping (the "+ 1" is for the shadow). */
 			if (begin_x + sprite->x_offs > dpi_right || begin_x + sprite->x_offs + sprite->width /* - 1 + 1 */ < dpi_left) continue;
 
-			if (draw_shadow && (glyph & SPRITE_GLYPH) == 0) {
-				ctx.SetColourRemap(TC_BLACK);
-				GfxMainBlitter(ctx, sprite, begin_x + shadow_offset, top + shadow_offset, BM_COLOUR_REMAP);
-				ctx.SetColourRemap(colour);
-			}
 			GfxMainBlitter(ctx, sprite, begin_x, top, BM_COLOUR_REMAP);
 		}
 	}
@@ -2008,6 +2030,25 @@ static void AddDirtyBlocks(uint start, int left, int top, int right, int bottom)
 				start--;
 				continue;
 			}
+			if (top == r.top && bottom == r.bottom) {
+				/* Same vertical span, so the union is an exact rectangle: merge instead of splitting.
+				 * The merged rect may overlap or touch earlier rects, so re-add it from the start. */
+				int merged_left = std::min(left, r.left);
+				int merged_right = std::max(right, r.right);
+				r = _dirty_blocks.back();
+				_dirty_blocks.pop_back();
+				AddDirtyBlocks(0, merged_left, top, merged_right, bottom);
+				return;
+			}
+			if (left == r.left && right == r.right) {
+				/* Same horizontal span, as above but vertically. */
+				int merged_top = std::min(top, r.top);
+				int merged_bottom = std::max(bottom, r.bottom);
+				r = _dirty_blocks.back();
+				_dirty_blocks.pop_back();
+				AddDirtyBlocks(0, left, merged_top, right, merged_bottom);
+				return;
+			}
 			if (left < r.left && right > r.left) {
 				int middle = r.left;
 				AddDirtyBlocks(start, left, top, middle, bottom);
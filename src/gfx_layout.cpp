@@ -34,6 +34,9 @@
 /** Cache of ParagraphLayout lines. */
 Layouter::LineCache *Layouter::linecache;
 
+/** Current use tick of the line cache, for least recently used eviction in Layouter::ReduceLineCache. */
+static size_t _linecache_tick = 0;
+
 /** Cache of Font instances. */
 Layouter::FontColourMap Layouter::fonts[FS_END];
 
@@ -610,13 +613,16 @@ static inline void GetLayouter(Layouter::LineCacheItem &line, const char *&str,
 {
 	if (line.buffer != nullptr) free(line.buffer);
 
-	typename T::CharType *buff_begin = MallocT<typename T::CharType>(DRAW_STRING_BUFFER);
+	/* Convert into a reusable scratch buffer first, so that the copy which is
+	 * kept alive in the line cache can be sized to the converted length
+	 * instead of always being DRAW_STRING_BUFFER chars. */
+	static typename T::CharType scratch_buffer[DRAW_STRING_BUFFER];
+	typename T::CharType *buff_begin = scratch_buffer;
 	const typename T::CharType *buffer_last = buff_begin + DRAW_STRING_BUFFER;
 	typename T::CharType *buff = buff_begin;
 	FontMap &fontMapping = line.runs;
 	Font *f = Layouter::GetFont(state.fontsize, state.cur_colour);
 
-	line.buffer = buff_begin;
 	fontMapping.clear();
 
 	/*
@@ -659,7 +665,14 @@ static inline void GetLayouter(Layouter::LineCacheItem &line, const char *&str,
 	if (!fontMapping.Contains(buff - buff_begin)) {
 		fontMapping.Insert(buff - buff_begin, f);
 	}
-	line.layout = T::GetParagraphLayout(buff_begin, buff, fontMapping);
+
+	/* The paragraph layout keeps pointers into the buffer, so the cache item
+	 * needs its own right-sized copy of the converted characters. */
+	size_t buff_size = buff - buff_begin + 1;
+	typename T::CharType *cache_buff = MallocT<typename T::CharType>(buff_size);
+	memcpy(cache_buff, buff_begin, buff_size * sizeof(typename T::CharType));
+	line.buffer = cache_buff;
+	line.layout = T::GetParagraphLayout(cache_buff, cache_buff + (buff - buff_begin), fontMapping);
 	line.state_after = state;
 }
 
@@ -689,6 +702,13 @@ Layouter::Layouter(const char *str, int maxw, TextColour colour, FontSize fontsi
 			/* Line is in cache */
 			str = lineend + 1;
 			state = line.state_after;
+
+			if (line.cached_width == maxw && !line.cached_lines.empty()) {
+				/* This line was layouted at this width before, reuse the lines. */
+				for (const auto &l : line.cached_lines) this->push_back(l);
+				continue;
+			}
+
 			line.layout->Reflow();
 		} else {
 			/* Line is new, layout it */
@@ -736,11 +756,16 @@ Layouter::Layouter(const char *str, int maxw, TextColour colour, FontSize fontsi
 			}
 		}
 
-		/* Move all lines into a local cache so we can reuse them later on more easily. */
+		/* Move all lines into a local cache so we can reuse them later on more easily,
+		 * and remember them in the line cache so the next layout pass at this width
+		 * does not need to produce them again. */
+		line.cached_lines.clear();
+		line.cached_width = maxw;
 		for (;;) {
 			auto l = line.layout->NextLine(maxw);
 			if (l == nullptr) break;
 			this->push_back(std::move(l));
+			line.cached_lines.push_back(this->back());
 		}
 	} while (c != '\0');
 }
@@ -896,6 +921,7 @@ Layouter::LineCacheItem &Layouter::GetCachedParagraphLayout(const char *str, siz
 
 	if (auto match = linecache->find(LineCacheQuery{state, std::string_view{str, len}});
 		match != linecache->end()) {
+		match->second.last_use = _linecache_tick;
 		return match->second;
 	}
 
@@ -903,7 +929,9 @@ Layouter::LineCacheItem &Layouter::GetCachedParagraphLayout(const char *str, siz
 	LineCacheKey key;
 	key.state_before = state;
 	key.str.assign(str, len);
-	return (*linecache)[key];
+	LineCacheItem &item = (*linecache)[key];
+	item.last_use = _linecache_tick;
+	return item;
 }
 
 /**
@@ -920,7 +948,18 @@ void Layouter::ResetLineCache()
 void Layouter::ReduceLineCache()
 {
 	if (linecache != nullptr) {
-		/* TODO LRU cache would be fancy, but not exactly necessary */
-		if (linecache->size() > 4096) ResetLineCache();
+		if (linecache->size() > 4096) {
+			/* Evict the least recently used entries: everything not touched since the
+			 * previous reduction pass. Resetting the whole cache would also throw away
+			 * the strings which are layouted every frame. */
+			for (auto it = linecache->begin(); it != linecache->end();) {
+				if (it->second.last_use < _linecache_tick) {
+					it = linecache->erase(it);
+				} else {
+					++it;
+				}
+			}
+		}
+		_linecache_tick++;
 	}
 }
@@ -15,6 +15,7 @@
 #include "core/smallmap_type.hpp"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <stack>
 #include <string_view>
@@ -150,7 +151,7 @@ public:
  *
  * It also accounts for the memory allocations and frees.
  */
-class Layouter : public std::vector<std::unique_ptr<const ParagraphLayouter::Line>> {
+class Layouter : public std::vector<std::shared_ptr<const ParagraphLayouter::Line>> {
 	const char *string; ///< Pointer to the original string.
 
 	/** Key into the linecache */
@@ -188,7 +189,12 @@ public:
 		FontState state_after;     ///< Font state after the line.
 		ParagraphLayouter *layout; ///< Layout of the line.
 
-		LineCacheItem() : buffer(nullptr), layout(nullptr) {}
+		int cached_width;          ///< Width the cached lines were layouted at.
+		std::vector<std::shared_ptr<const ParagraphLayouter::Line>> cached_lines; ///< Lines produced by the last layout pass at #cached_width.
+
+		size_t last_use;           ///< Last use tick of this item, for least recently used eviction in ReduceLineCache.
+
+		LineCacheItem() : buffer(nullptr), layout(nullptr), cached_width(0), last_use(0) {}
 		~LineCacheItem() { delete layout; free(buffer); }
 	};
 private:
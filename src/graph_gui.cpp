@@ -563,7 +563,21 @@ public:
 	void OnInvalidateData(int data = 0, bool gui_scope = true) override
 	{
 		if (!gui_scope) return;
-		this->UpdateStatistics(true);
+		this->UpdateStatistics(false);
+	}
+
+	/**
+	 * Fill the cached series of one company from its economy history.
+	 * @param c the company to take the data from
+	 * @param dataset index of the series to fill
+	 */
+	void UpdateCompanyStatistics(const Company *c, int dataset)
+	{
+		this->colours[dataset] = _colour_gradient[c->colour][6];
+		for (int j = this->num_on_x_axis, i = 0; --j >= 0;) {
+			this->cost[dataset][i] = (j >= c->num_valid_stat_ent) ? INVALID_DATAPOINT : GetGraphData(c, j);
+			i++;
+		}
 	}
 
 	/**
@@ -591,9 +605,48 @@ public:
 			mo += 12;
 		}
 
+		if (!initialize && this->num_on_x_axis == nums && this->year == yr && this->month == mo) {
+			/* The series data is still current, but refresh the colours: a
+			 * company colour change invalidates the window without changing
+			 * the data. */
+			for (CompanyID k = COMPANY_FIRST; k < MAX_COMPANIES; k++) {
+				const Company *c = Company::GetIfValid(k);
+				if (c != nullptr) this->colours[k] = _colour_gradient[c->colour][6];
+			}
+
+			if (this->excluded_data == excluded_companies) {
+				/* There's no reason to get new stats */
+				return;
+			}
+
+			/* Only the set of visible series changed; the cached series are
+			 * still valid, so refresh just those which were excluded before. */
+			uint64 old_excluded_data = this->excluded_data;
+			this->excluded_data = excluded_companies;
+			for (CompanyID k = COMPANY_FIRST; k < MAX_COMPANIES; k++) {
+				if (HasBit(old_excluded_data, k) && !HasBit(excluded_companies, k)) {
+					this->UpdateCompanyStatistics(Company::Get(k), k);
+				}
+			}
+			return;
+		}
+
 		if (!initialize && this->excluded_data == excluded_companies && this->num_on_x_axis == nums &&
-				this->year == yr && this->month == mo) {
-			/* There's no reason to get new stats */
+				nums > 0 && yr * 12 + mo == this->year * 12 + this->month + 3) {
+			/* A quarter rolled over: every company's economy history shifted
+			 * along by one entry, so shift the cached series the same way and
+			 * only fetch the newest datapoint of each. */
+			this->year = yr;
+			this->month = mo;
+			for (CompanyID k = COMPANY_FIRST; k < MAX_COMPANIES; k++) {
+				const Company *c = Company::GetIfValid(k);
+				if (c == nullptr) continue;
+				this->colours[k] = _colour_gradient[c->colour][6];
+				for (int i = 0; i < nums - 1; i++) {
+					this->cost[k][i] = this->cost[k][i + 1];
+				}
+				this->cost[k][nums - 1] = (c->num_valid_stat_ent == 0) ? INVALID_DATAPOINT : GetGraphData(c, 0);
+			}
 			return;
 		}
 
@@ -605,13 +658,7 @@ public:
 		int numd = 0;
 		for (CompanyID k = COMPANY_FIRST; k < MAX_COMPANIES; k++) {
 			const Company *c = Company::GetIfValid(k);
-			if (c != nullptr) {
-				this->colours[numd] = _colour_gradient[c->colour][6];
-				for (int j = this->num_on_x_axis, i = 0; --j >= 0;) {
-					this->cost[numd][i] = (j >= c->num_valid_stat_ent) ? INVALID_DATAPOINT : GetGraphData(c, j);
-					i++;
-				}
-			}
+			if (c != nullptr) this->UpdateCompanyStatistics(c, numd);
 			numd++;
 		}
 
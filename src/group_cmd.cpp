@@ -22,13 +22,13 @@
 #include "order_backup.h"
 #include "tbtr_template_vehicle.h"
 #include "tracerestrict.h"
+#include "strings_func.h"
+#include "town.h"
+#include "townname_func.h"
 
 #include "table/strings.h"
 
 #include "safeguards.h"
-#include "strings_func.h"
-#include "town.h"
-#include "townname_func.h"
 
 GroupID _new_group_id;
 
@@ -287,25 +287,46 @@ const Livery *GetParentLivery(const Group *g)
 	return &pg->livery;
 }
 
-static inline bool IsGroupDescendantOfGroup(const Group *g, const Group *top)
+/**
+ * Index of the child groups of each group, indexed by parent GroupID.
+ * Maintained lazily: any change to the group hierarchy (group creation,
+ * deletion or reparenting) just invalidates it, the next descendant
+ * iteration rebuilds it. This keeps rollup queries proportional to the
+ * subtree size instead of scanning the whole group pool per query.
+ */
+static std::vector<std::vector<GroupID>> _group_children_index;
+static bool _group_children_index_valid = false; ///< Whether #_group_children_index is up to date.
+
+/** Invalidate the child group index, it is rebuilt on the next descendant iteration. */
+static void InvalidateGroupChildrenIndex()
 {
-	if (g->owner != top->owner) return false;
+	_group_children_index_valid = false;
+}
 
-	while (true) {
-		if (g->parent == INVALID_GROUP) return false;
-		if (g->parent == top->index) return true;
-		g = Group::Get(g->parent);
+/** Rebuild the child group index from the parent links. */
+static void RebuildGroupChildrenIndex()
+{
+	_group_children_index.clear();
+	_group_children_index.resize(Group::GetPoolSize());
+	for (const Group *g : Group::Iterate()) {
+		if (g->parent != INVALID_GROUP) _group_children_index[g->parent].push_back(g->index);
 	}
-
-	NOT_REACHED();
+	_group_children_index_valid = true;
 }
 
 template <typename F>
 void IterateDescendantsOfGroup(const Group *top, F func)
 {
-	for (Group *cg : Group::Iterate()) {
-		if (IsGroupDescendantOfGroup(cg, top)) {
-			func(cg);
+	if (!_group_children_index_valid) RebuildGroupChildrenIndex();
+
+	std::vector<GroupID> stack;
+	stack.push_back(top->index);
+	while (!stack.empty()) {
+		GroupID id = stack.back();
+		stack.pop_back();
+		for (GroupID child : _group_children_index[id]) {
+			func(Group::Get(child));
+			stack.push_back(child);
 		}
 	}
 }
@@ -345,6 +366,12 @@ Group::Group(Owner owner)
 {
 	this->owner = owner;
 	this->folded = false;
+	InvalidateGroupChildrenIndex();
+}
+
+Group::~Group()
+{
+	InvalidateGroupChildrenIndex();
 }
 
 
@@ -506,6 +533,7 @@ CommandCost CmdAlterGroup(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 
 		if (flags & DC_EXEC) {
 			g->parent = (pg == nullptr) ? INVALID_GROUP : pg->index;
+			InvalidateGroupChildrenIndex();
 			GroupStatistics::UpdateAutoreplace(g->owner);
 			if (g->vehicle_type == VEH_TRAIN) ReindexTemplateReplacementsRecursive();
 
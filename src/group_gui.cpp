@@ -524,7 +524,7 @@ public:
 			/* This needs to be done in command-scope to enforce rebuilding before resorting invalid data */
 			this->vehgroups.ForceRebuild();
 			this->groups.ForceRebuild();
-		} else {
+		} else if (!this->HandleVehicleDirtyInvalidation(data)) {
 			this->vehgroups.ForceResort();
 			this->groups.ForceResort();
 		}
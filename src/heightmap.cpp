@@ -17,6 +17,8 @@
 #include "gfx_func.h"
 #include "fios.h"
 #include "fileio_func.h"
+#include "genworld.h"
+#include "worker_thread.h"
 
 #include "table/strings.h"
 
@@ -67,6 +69,31 @@ static inline byte RGBToGrayscale(byte red, byte green, byte blue)
 	return ((red * 19595) + (green * 38470) + (blue * 7471)) / 65536;
 }
 
+/**
+ * Run proc(row_begin, row_end) over all rows [0, height), splitting the rows
+ * into ranges executed on the general worker pool when it is running.
+ * The callback must only write data owned by its own rows.
+ * @param height the total number of rows
+ * @param proc   the callback processing one range of rows
+ */
+template <typename F>
+static void ForEachRowRangeParallel(uint height, F proc)
+{
+	const uint ROW_RANGE_SIZE = 64;
+	if (height > ROW_RANGE_SIZE && _general_worker_pool.HasWorkers()) {
+		WorkerJobGroup group;
+		for (uint start = ROW_RANGE_SIZE; start < height; start += ROW_RANGE_SIZE) {
+			_general_worker_pool.EnqueueJob([](void *data1, void *data2, void *data3) {
+				(*static_cast<F *>(data1))((uint)(uintptr_t)data2, (uint)(uintptr_t)data3);
+			}, &proc, (void *)(uintptr_t)start, (void *)(uintptr_t)std::min(start + ROW_RANGE_SIZE, height), &group);
+		}
+		proc(0, ROW_RANGE_SIZE);
+		group.WaitForCompletion();
+	} else {
+		proc(0, height);
+	}
+}
+
 
 #ifdef WITH_PNG
 
@@ -77,7 +104,6 @@ static inline byte RGBToGrayscale(byte red, byte green, byte blue)
  */
 static void ReadHeightmapPNGImageData(byte *map, png_structp png_ptr, png_infop info_ptr)
 {
-	uint x, y;
 	byte gray_palette[256];
 	png_bytep *row_pointers = nullptr;
 	bool has_palette = png_get_color_type(png_ptr, info_ptr) == PNG_COLOR_TYPE_PALETTE;
@@ -111,22 +137,31 @@ static void ReadHeightmapPNGImageData(byte *map, png_structp png_ptr, png_infop
 
 	row_pointers = png_get_rows(png_ptr, info_ptr);
 
-	/* Read the raw image data and convert in 8-bit grayscale */
-	for (x = 0; x < png_get_image_width(png_ptr, info_ptr); x++) {
-		for (y = 0; y < png_get_image_height(png_ptr, info_ptr); y++) {
-			byte *pixel = &map[y * png_get_image_width(png_ptr, info_ptr) + x];
-			uint x_offset = x * channels;
+	uint width = png_get_image_width(png_ptr, info_ptr);
+	uint height = png_get_image_height(png_ptr, info_ptr);
+
+	/* Read the raw image data and convert in 8-bit grayscale, walking the
+	 * rows in storage order. Each row only writes its own span of the
+	 * output, so row ranges convert in parallel on the worker pool. */
+	ForEachRowRangeParallel(height, [&](uint row_begin, uint row_end) {
+		for (uint y = row_begin; y < row_end; y++) {
+			const byte *row = row_pointers[y];
+			byte *pixel = &map[(size_t)y * width];
 
 			if (has_palette) {
-				*pixel = gray_palette[row_pointers[y][x_offset]];
+				for (uint x = 0; x < width; x++) {
+					*pixel++ = gray_palette[row[x]];
+				}
 			} else if (channels == 3) {
-				*pixel = RGBToGrayscale(row_pointers[y][x_offset + 0],
-						row_pointers[y][x_offset + 1], row_pointers[y][x_offset + 2]);
+				for (uint x = 0; x < width; x++) {
+					*pixel++ = RGBToGrayscale(row[0], row[1], row[2]);
+					row += 3;
+				}
 			} else {
-				*pixel = row_pointers[y][x_offset];
+				memcpy(pixel, row, width);
 			}
 		}
-	}
+	});
 }
 
 /**
@@ -208,7 +243,6 @@ static bool ReadHeightmapPNG(const char *filename, uint *x, uint *y, byte **map)
  */
 static void ReadHeightmapBMPImageData(byte *map, BmpInfo *info, BmpData *data)
 {
-	uint x, y;
 	byte gray_palette[256];
 
 	if (data->palette != nullptr) {
@@ -242,20 +276,23 @@ static void ReadHeightmapBMPImageData(byte *map, BmpInfo *info, BmpData *data)
 		}
 	}
 
-	/* Read the raw image data and convert in 8-bit grayscale */
-	for (y = 0; y < info->height; y++) {
-		byte *pixel = &map[y * info->width];
-		byte *bitmap = &data->bitmap[y * info->width * (info->bpp == 24 ? 3 : 1)];
-
-		for (x = 0; x < info->width; x++) {
-			if (info->bpp != 24) {
-				*pixel++ = gray_palette[*bitmap++];
-			} else {
-				*pixel++ = RGBToGrayscale(*bitmap, *(bitmap + 1), *(bitmap + 2));
-				bitmap += 3;
+	/* Read the raw image data and convert in 8-bit grayscale; row ranges
+	 * write disjoint spans of the output, so they convert in parallel. */
+	ForEachRowRangeParallel(info->height, [&](uint row_begin, uint row_end) {
+		for (uint y = row_begin; y < row_end; y++) {
+			byte *pixel = &map[(size_t)y * info->width];
+			const byte *bitmap = &data->bitmap[(size_t)y * info->width * (info->bpp == 24 ? 3 : 1)];
+
+			for (uint x = 0; x < info->width; x++) {
+				if (info->bpp != 24) {
+					*pixel++ = gray_palette[*bitmap++];
+				} else {
+					*pixel++ = RGBToGrayscale(*bitmap, *(bitmap + 1), *(bitmap + 2));
+					bitmap += 3;
+				}
 			}
 		}
-	}
+	});
 }
 
 /**
@@ -331,11 +368,8 @@ static void GrayscaleToMapHeights(uint img_width, uint img_height, byte *map)
 	static_assert(num_div <= std::numeric_limits<uint>::max() / MAX_HEIGHTMAP_SIDE_LENGTH_IN_PIXELS);
 
 	uint width, height;
-	uint row, col;
 	uint row_pad = 0, col_pad = 0;
 	uint img_scale;
-	uint img_row, img_col;
-	TileIndex tile;
 
 	/* Get map size and calculate scale and padding values */
 	switch (_settings_game.game_creation.heightmap_rotation) {
@@ -365,54 +399,59 @@ static void GrayscaleToMapHeights(uint img_width, uint img_height, byte *map)
 		for (uint y = 0; y < MapSizeY(); y++) MakeVoid(TileXY(0, y));
 	}
 
-	/* Form the landscape */
-	for (row = 0; row < height; row++) {
-		for (col = 0; col < width; col++) {
-			switch (_settings_game.game_creation.heightmap_rotation) {
-				default: NOT_REACHED();
-				case HM_COUNTER_CLOCKWISE: tile = TileXY(col, row); break;
-				case HM_CLOCKWISE:         tile = TileXY(row, col); break;
-			}
-
-			/* Check if current tile is within the 1-pixel map edge or padding regions */
-			if ((!_settings_game.construction.freeform_edges && DistanceFromEdge(tile) <= 1) ||
-					(row < row_pad) || (row >= (height - row_pad - (_settings_game.construction.freeform_edges ? 0 : 1))) ||
-					(col < col_pad) || (col >= (width  - col_pad - (_settings_game.construction.freeform_edges ? 0 : 1)))) {
-				SetTileHeight(tile, 0);
-			} else {
-				/* Use nearest neighbour resizing to scale map data.
-				 *  We rotate the map 45 degrees (counter)clockwise */
-				img_row = (((row - row_pad) * num_div) / img_scale);
+	/* Form the landscape. Each row only writes its own tiles, so row ranges
+	 * are scaled in parallel on the worker pool. */
+	ForEachRowRangeParallel(height, [&](uint row_begin, uint row_end) {
+		for (uint row = row_begin; row < row_end; row++) {
+			for (uint col = 0; col < width; col++) {
+				TileIndex tile;
 				switch (_settings_game.game_creation.heightmap_rotation) {
 					default: NOT_REACHED();
-					case HM_COUNTER_CLOCKWISE:
-						img_col = (((width - 1 - col - col_pad) * num_div) / img_scale);
-						break;
-					case HM_CLOCKWISE:
-						img_col = (((col - col_pad) * num_div) / img_scale);
-						break;
+					case HM_COUNTER_CLOCKWISE: tile = TileXY(col, row); break;
+					case HM_CLOCKWISE:         tile = TileXY(row, col); break;
 				}
 
-				assert(img_row < img_height);
-				assert(img_col < img_width);
-
-				uint heightmap_height = map[img_row * img_width + img_col];
-
-				if (heightmap_height > 0) {
-					/* 0 is sea level.
-					 * Other grey scales are scaled evenly to the available height levels > 0.
-					 * (The coastline is independent from the number of height levels) */
-					heightmap_height = 1 + (heightmap_height - 1) * _settings_game.game_creation.heightmap_height / 255;
+				/* Check if current tile is within the 1-pixel map edge or padding regions */
+				if ((!_settings_game.construction.freeform_edges && DistanceFromEdge(tile) <= 1) ||
+						(row < row_pad) || (row >= (height - row_pad - (_settings_game.construction.freeform_edges ? 0 : 1))) ||
+						(col < col_pad) || (col >= (width  - col_pad - (_settings_game.construction.freeform_edges ? 0 : 1)))) {
+					SetTileHeight(tile, 0);
+				} else {
+					/* Use nearest neighbour resizing to scale map data.
+					 *  We rotate the map 45 degrees (counter)clockwise */
+					uint img_row = (((row - row_pad) * num_div) / img_scale);
+					uint img_col;
+					switch (_settings_game.game_creation.heightmap_rotation) {
+						default: NOT_REACHED();
+						case HM_COUNTER_CLOCKWISE:
+							img_col = (((width - 1 - col - col_pad) * num_div) / img_scale);
+							break;
+						case HM_CLOCKWISE:
+							img_col = (((col - col_pad) * num_div) / img_scale);
+							break;
+					}
+
+					assert(img_row < img_height);
+					assert(img_col < img_width);
+
+					uint heightmap_height = map[img_row * img_width + img_col];
+
+					if (heightmap_height > 0) {
+						/* 0 is sea level.
+						 * Other grey scales are scaled evenly to the available height levels > 0.
+						 * (The coastline is independent from the number of height levels) */
+						heightmap_height = 1 + (heightmap_height - 1) * _settings_game.game_creation.heightmap_height / 255;
+					}
+
+					SetTileHeight(tile, heightmap_height);
+				}
+				/* Only clear the tiles within the map area. */
+				if (IsInnerTile(tile)) {
+					MakeClear(tile, CLEAR_GRASS, 3);
 				}
-
-				SetTileHeight(tile, heightmap_height);
-			}
-			/* Only clear the tiles within the map area. */
-			if (IsInnerTile(tile)) {
-				MakeClear(tile, CLEAR_GRASS, 3);
 			}
 		}
-	}
+	});
 }
 
 /**
@@ -530,9 +569,15 @@ void LoadHeightmap(DetailedFileType dft, const char *filename)
 		return;
 	}
 
+	/* GLS_HEIGHTMAP allots three progress steps: decoding the image, scaling
+	 * it onto the map, and the slope fixup (counted by our caller). */
+	IncreaseGeneratingWorldProgress(GWP_LANDSCAPE);
+
 	GrayscaleToMapHeights(x, y, map);
 	free(map);
 
+	IncreaseGeneratingWorldProgress(GWP_LANDSCAPE);
+
 	FixSlopes();
 	MarkWholeScreenDirty();
 }
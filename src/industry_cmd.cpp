@@ -1206,10 +1206,9 @@ static uint _scaled_production_ticks;
 
 static void ProduceIndustryGoods(Industry *i)
 {
-	const IndustrySpec *indsp = GetIndustrySpec(i->type);
-
 	/* play a sound? */
 	if ((i->counter & 0x3F) == 0) {
+		const IndustrySpec *indsp = GetIndustrySpec(i->type);
 		uint32 r;
 		if (Chance16R(1, 14, r) && indsp->number_of_sounds != 0 && _settings_client.sound.ambient) {
 			for (size_t j = 0; j < lengthof(i->last_month_production); j++) {
@@ -1226,16 +1225,21 @@ static void ProduceIndustryGoods(Industry *i)
 
 	i->counter--;
 
+	/* On most ticks there is nothing to produce, don't even fetch the spec then */
+	const bool scaled_tick = (_settings_game.economy.industry_cargo_scale_factor != 0) && (i->counter % _scaled_production_ticks) == 0;
+	const bool produce_tick = (i->counter % INDUSTRY_PRODUCE_TICKS) == 0;
+	if (!scaled_tick && !produce_tick) return;
+
+	const IndustrySpec *indsp = GetIndustrySpec(i->type);
+
 	const bool scale_ticks = (_settings_game.economy.industry_cargo_scale_factor != 0) && HasBit(indsp->callback_mask, CBM_IND_PRODUCTION_256_TICKS);
-	if (scale_ticks) {
-		if ((i->counter % _scaled_production_ticks) == 0) {
-			if (HasBit(indsp->callback_mask, CBM_IND_PRODUCTION_256_TICKS)) IndustryProductionCallback(i, 1);
-			ProduceIndustryGoodsFromRate(i, false);
-		}
+	if (scale_ticks && scaled_tick) {
+		if (HasBit(indsp->callback_mask, CBM_IND_PRODUCTION_256_TICKS)) IndustryProductionCallback(i, 1);
+		ProduceIndustryGoodsFromRate(i, false);
 	}
 
 	/* produce some cargo */
-	if ((i->counter % INDUSTRY_PRODUCE_TICKS) == 0) {
+	if (produce_tick) {
 		if (!scale_ticks) {
 			if (HasBit(indsp->callback_mask, CBM_IND_PRODUCTION_256_TICKS)) IndustryProductionCallback(i, 1);
 			ProduceIndustryGoodsFromRate(i, true);
@@ -2367,6 +2371,197 @@ static uint GetNumberOfIndustries()
 	return std::min<uint>(IndustryPool::MAX_SIZE, ScaleByMapSize(numof_industry_table[difficulty]));
 }
 
+/**
+ * Coarse candidate site index for random industry placement.
+ *
+ * The map is divided into square blocks which lazily cache a few cheap
+ * per-block facts: height range, presence of clear land, water and tropic
+ * zones. Random placement then draws most of its probe tiles from blocks
+ * which are at least plausible for the industry type being built, instead of
+ * rejecting probe after probe against per-type checks on a built-up map.
+ *
+ * The index is approximate in both directions: an implausible block that
+ * slipped through only wastes a probe, and sites the index missed stay
+ * reachable because a share of the probes remains fully random. Block data
+ * is rescanned on the next placement attempt after a call to
+ * NotifyIndustryPlacementChange().
+ */
+static const uint INDUSTRY_SITE_BLOCK_EDGE = 16;
+
+/** Lazily maintained placement summary of one block of the map. */
+struct IndustrySiteBlock {
+	uint32 generation = 0; ///< Data below is current iff this matches _industry_site_generation.
+	uint8 min_height;      ///< Lowest tile height in the block.
+	uint8 max_height;      ///< Highest tile height in the block.
+	bool has_clear;        ///< Whether the block contains any clear land or tree tile.
+	bool has_water;        ///< Whether the block contains any water tile.
+	bool has_desert;       ///< Whether the block contains any desert tile.
+	bool has_non_desert;   ///< Whether the block contains any non-desert tile.
+	bool has_rainforest;   ///< Whether the block contains any rainforest tile.
+};
+
+static std::vector<IndustrySiteBlock> _industry_site_blocks;
+static uint32 _industry_site_generation = 1;
+static uint _industry_site_cols = 0;
+static uint _industry_site_rows = 0;
+
+/** Cached candidate block lists per industry type, valid for the stamped generation. */
+static std::vector<uint32> _industry_site_candidates[NUM_INDUSTRYTYPES];
+static uint32 _industry_site_candidates_generation[NUM_INDUSTRYTYPES];
+
+/**
+ * To be called when a map change may create industry sites where the coarse
+ * placement index saw none, such as terraforming. Blocks are rescanned on
+ * the next random placement attempt. Stale entries in the other direction
+ * only cost a wasted probe and need no notification.
+ */
+void NotifyIndustryPlacementChange()
+{
+	_industry_site_generation++;
+}
+
+/** Throw away all industry placement index state, e.g. before loading or generating a map. */
+static void ResetIndustrySiteIndex()
+{
+	_industry_site_blocks.clear();
+	_industry_site_cols = 0;
+	_industry_site_rows = 0;
+	_industry_site_generation = 1;
+	for (IndustryType it = 0; it < NUM_INDUSTRYTYPES; it++) {
+		_industry_site_candidates[it].clear();
+		_industry_site_candidates_generation[it] = 0;
+	}
+}
+
+static void EnsureIndustrySiteBlocksAllocated()
+{
+	uint cols = MapSizeX() / INDUSTRY_SITE_BLOCK_EDGE;
+	uint rows = MapSizeY() / INDUSTRY_SITE_BLOCK_EDGE;
+	if (cols == _industry_site_cols && rows == _industry_site_rows) return;
+
+	_industry_site_cols = cols;
+	_industry_site_rows = rows;
+	_industry_site_blocks.clear();
+	_industry_site_blocks.resize(cols * rows);
+}
+
+/** Rescan the cheap placement facts of one block of the map. */
+static void ScanIndustrySiteBlock(uint32 index)
+{
+	IndustrySiteBlock &b = _industry_site_blocks[index];
+	b.generation = _industry_site_generation;
+	b.min_height = UINT8_MAX;
+	b.max_height = 0;
+	b.has_clear = false;
+	b.has_water = false;
+	b.has_desert = false;
+	b.has_non_desert = false;
+	b.has_rainforest = false;
+
+	uint base_x = (index % _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE;
+	uint base_y = (index / _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE;
+	for (uint y = 0; y < INDUSTRY_SITE_BLOCK_EDGE; y++) {
+		for (uint x = 0; x < INDUSTRY_SITE_BLOCK_EDGE; x++) {
+			TileIndex tile = TileXY(base_x + x, base_y + y);
+			uint h = TileHeight(tile);
+			if (h < b.min_height) b.min_height = (uint8)h;
+			if (h > b.max_height) b.max_height = (uint8)h;
+			if (IsTileType(tile, MP_CLEAR) || IsTileType(tile, MP_TREES)) b.has_clear = true;
+			if (IsTileType(tile, MP_WATER)) b.has_water = true;
+			switch (GetTropicZone(tile)) {
+				case TROPICZONE_DESERT:     b.has_desert = true; break;
+				case TROPICZONE_RAINFOREST: b.has_rainforest = true; b.has_non_desert = true; break;
+				default:                    b.has_non_desert = true; break;
+			}
+		}
+	}
+}
+
+/** Whether any tile of the block can pass #CheckScaledDistanceFromEdge as used by refineries and oil rigs. */
+static bool IsIndustrySiteBlockNearMapEdge(uint32 index)
+{
+	uint base_x = (index % _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE;
+	uint base_y = (index / _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE;
+
+	/* The minimum of each directional edge distance over the block is attained
+	 * at one of its corners, so testing the (shifted, clamped) corners is
+	 * conservative for every tile in the block. */
+	uint x1 = std::min<uint>(base_x + 1, MapMaxX());
+	uint y1 = std::min<uint>(base_y + 1, MapMaxY());
+	uint x2 = std::min<uint>(base_x + INDUSTRY_SITE_BLOCK_EDGE, MapMaxX());
+	uint y2 = std::min<uint>(base_y + INDUSTRY_SITE_BLOCK_EDGE, MapMaxY());
+	uint maxdist = _settings_game.game_creation.oil_refinery_limit;
+	return CheckScaledDistanceFromEdge(TileXY(x1, y1), maxdist) || CheckScaledDistanceFromEdge(TileXY(x2, y1), maxdist) ||
+			CheckScaledDistanceFromEdge(TileXY(x1, y2), maxdist) || CheckScaledDistanceFromEdge(TileXY(x2, y2), maxdist);
+}
+
+/**
+ * Whether a block might contain a valid site for an industry type.
+ * Must err on the side of plausibility: the actual checks are run in full on
+ * every probe tile; this merely decides where probes are worth aiming.
+ */
+static bool IsIndustrySiteBlockPlausible(uint32 index, const IndustrySpec *indspec)
+{
+	const IndustrySiteBlock &b = _industry_site_blocks[index];
+	if (indspec->behaviour & INDUSTRYBEH_BUILT_ONWATER) {
+		if (!b.has_water) return false;
+	} else {
+		if (!b.has_clear) return false;
+	}
+
+	/* Block heights are north-corner tile heights; GetTileZ() as used by the
+	 * real checks can differ from those by up to two units, hence the slack
+	 * in the minimum-height comparisons below. */
+	switch (indspec->check_proc) {
+		case CHECK_FOREST:
+			if (_settings_game.game_creation.landscape == LT_ARCTIC && b.max_height < HighestSnowLine() + 2) return false;
+			break;
+
+		case CHECK_FARM:
+			if (_settings_game.game_creation.landscape == LT_ARCTIC && b.min_height >= HighestSnowLine()) return false;
+			break;
+
+		case CHECK_REFINERY:
+			if (_game_mode != GM_EDITOR && !IsIndustrySiteBlockNearMapEdge(index)) return false;
+			break;
+
+		case CHECK_OIL_RIG:
+			if (_game_mode != GM_EDITOR && (b.min_height != 0 || !IsIndustrySiteBlockNearMapEdge(index))) return false;
+			break;
+
+		case CHECK_PLANTATION: if (!b.has_non_desert) return false; break;
+		case CHECK_WATER:      if (!b.has_desert) return false; break;
+		case CHECK_LUMBERMILL: if (!b.has_rainforest) return false; break;
+		case CHECK_BUBBLEGEN:  if (b.min_height > 4 + 2) return false; break;
+
+		default: break;
+	}
+	return true;
+}
+
+/**
+ * Get the list of plausible blocks for placing an industry of the given type,
+ * rebuilding it if the index was invalidated since it was last computed.
+ * @param type Industry type to get the candidate blocks of.
+ * @return List of block indices worth probing; may be empty.
+ */
+static const std::vector<uint32> &GetIndustrySiteCandidates(IndustryType type)
+{
+	EnsureIndustrySiteBlocksAllocated();
+
+	std::vector<uint32> &candidates = _industry_site_candidates[type];
+	if (_industry_site_candidates_generation[type] == _industry_site_generation) return candidates;
+
+	const IndustrySpec *indspec = GetIndustrySpec(type);
+	candidates.clear();
+	for (uint32 index = 0; index < (uint32)_industry_site_blocks.size(); index++) {
+		if (_industry_site_blocks[index].generation != _industry_site_generation) ScanIndustrySiteBlock(index);
+		if (IsIndustrySiteBlockPlausible(index, indspec)) candidates.push_back(index);
+	}
+	_industry_site_candidates_generation[type] = _industry_site_generation;
+	return candidates;
+}
+
 /**
  * Try to place the industry in the game.
  * Since there is no feedback why placement fails, there is no other option
@@ -2377,9 +2572,21 @@ static uint GetNumberOfIndustries()
  */
 static Industry *PlaceIndustry(IndustryType type, IndustryAvailabilityCallType creation_type, bool try_hard)
 {
+	const std::vector<uint32> &candidates = GetIndustrySiteCandidates(type);
+
 	uint tries = try_hard ? 10000u : 2000u;
 	for (; tries > 0; tries--) {
-		Industry *ind = CreateNewIndustry(RandomTile(), type, creation_type);
+		TileIndex tile;
+		if (candidates.empty() || (tries % 4) == 0) {
+			/* Keep a share of fully random probes so that sites the coarse index missed remain reachable. */
+			tile = RandomTile();
+		} else {
+			uint32 index = candidates[RandomRange((uint32)candidates.size())];
+			uint32 r = Random();
+			tile = TileXY((index % _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE + r % INDUSTRY_SITE_BLOCK_EDGE,
+					(index / _industry_site_cols) * INDUSTRY_SITE_BLOCK_EDGE + (r >> 8) % INDUSTRY_SITE_BLOCK_EDGE);
+		}
+		Industry *ind = CreateNewIndustry(tile, type, creation_type);
 		if (ind != nullptr) return ind;
 	}
 	return nullptr;
@@ -3074,6 +3281,9 @@ void IndustryDailyLoop()
 
 void IndustryMonthlyLoop()
 {
+	/* Pick up ordinary construction churn in the placement index at most once a month. */
+	NotifyIndustryPlacementChange();
+
 	Backup<CompanyID> cur_company(_current_company, OWNER_NONE, FILE_LINE);
 
 	_industry_builder.MonthlyLoop();
@@ -3101,6 +3311,7 @@ void InitializeIndustries()
 	_industry_sound_tile = 0;
 
 	_industry_builder.Reset();
+	ResetIndustrySiteIndex();
 }
 
 /** Verify whether the generated industries are complete, and warn the user if not. */
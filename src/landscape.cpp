@@ -40,6 +40,8 @@
 #include <set>
 #include <deque>
 
+#include INCLUDE_FOR_PREFETCH_NTA
+
 #include "table/strings.h"
 #include "table/sprites.h"
 
@@ -818,6 +820,15 @@ static uint32 GetTileLoopFeedback()
 	return feedbacks[MapLogX() + MapLogY() - 2 * MIN_MAP_SIZE_BITS];
 }
 
+/**
+ * Number of LFSR steps to prefetch tile data ahead of the tile loop.
+ *
+ * The pseudorandom visit order touches a different cache line on almost every
+ * tile, but the LFSR sequence is fully determined by its current state, so the
+ * tiles about to be visited are known in advance and can be prefetched.
+ */
+static const uint TILELOOP_PREFETCH_LOOKAHEAD = 8;
+
 /**
  * Gradually iterate over all tiles on the map, calling their TileLoopProcs once every 256 ticks.
  */
@@ -836,13 +847,26 @@ void RunTileLoop()
 
 	SCOPE_INFO_FMT([&], "RunTileLoop: tile: %dx%d", TileX(tile), TileY(tile));
 
+	/* Batch town cargo production for the duration of this tick's tile loop slice. */
+	StartTownCargoBatching();
+
 	/* Manually update tile 0 every 256 ticks - the LFSR never iterates over it itself.  */
 	if (_tick_counter % 256 == 0) {
 		_tile_type_procs[GetTileType(0)]->tile_loop_proc(0);
 		count--;
 	}
 
+	/* Run the prefetch stream TILELOOP_PREFETCH_LOOKAHEAD LFSR steps ahead of the processing. */
+	TileIndex prefetch_tile = tile;
+	for (uint i = 0; i < TILELOOP_PREFETCH_LOOKAHEAD; i++) {
+		PREFETCH_NTA(_m.PrefetchPtr(prefetch_tile));
+		prefetch_tile = (prefetch_tile >> 1) ^ (-(int32)(prefetch_tile & 1) & feedback);
+	}
+
 	while (count--) {
+		PREFETCH_NTA(_m.PrefetchPtr(prefetch_tile));
+		prefetch_tile = (prefetch_tile >> 1) ^ (-(int32)(prefetch_tile & 1) & feedback);
+
 		_tile_type_procs[GetTileType(tile)]->tile_loop_proc(tile);
 
 		/* Get the next tile in sequence using a Galois LFSR. */
@@ -850,6 +874,8 @@ void RunTileLoop()
 	}
 
 	_cur_tileloop_tile = tile;
+
+	FlushTownCargoBatching();
 }
 
 void RunAuxiliaryTileLoop()
@@ -863,7 +889,17 @@ void RunAuxiliaryTileLoop()
 	uint count = 1 << (MapLogX() + MapLogY() - 8);
 	TileIndex tile = _aux_tileloop_tile;
 
+	/* Run the prefetch stream TILELOOP_PREFETCH_LOOKAHEAD LFSR steps ahead of the processing. */
+	TileIndex prefetch_tile = tile;
+	for (uint i = 0; i < TILELOOP_PREFETCH_LOOKAHEAD; i++) {
+		PREFETCH_NTA(_m.PrefetchPtr(prefetch_tile));
+		prefetch_tile = (prefetch_tile >> 1) ^ (-(int32)(prefetch_tile & 1) & feedback);
+	}
+
 	while (count--) {
+		PREFETCH_NTA(_m.PrefetchPtr(prefetch_tile));
+		prefetch_tile = (prefetch_tile >> 1) ^ (-(int32)(prefetch_tile & 1) & feedback);
+
 		if (!IsNonFloodingWaterTile(tile)) {
 			FloodingBehaviour fb = GetFloodingBehaviour(tile);
 			if (fb != FLOOD_NONE) TileLoopWaterFlooding(fb, tile);
@@ -1179,6 +1215,25 @@ static bool MakeLake(TileIndex tile, void *user_data)
 	return false;
 }
 
+/**
+ * Check whether a river flowing from a tile with the given slope and height could (logically) continue at end.
+ * @param slopeBegin The slope of the origin of the flow.
+ * @param heightBegin The height of the origin of the flow.
+ * @param end The destination of the flow.
+ * @return True iff the water can be flowing down.
+ */
+static bool FlowsDownFrom(Slope slopeBegin, int heightBegin, TileIndex end)
+{
+	int heightEnd;
+	Slope slopeEnd = GetTileSlope(end, &heightEnd);
+
+	return heightEnd <= heightBegin &&
+			/* Slope either is inclined or flat; rivers don't support other slopes. */
+			(slopeEnd == SLOPE_FLAT || IsInclinedSlope(slopeEnd)) &&
+			/* Slope continues, then it must be lower... or either end must be flat. */
+			((slopeEnd == slopeBegin && heightEnd < heightBegin) || slopeEnd == SLOPE_FLAT || slopeBegin == SLOPE_FLAT);
+}
+
 /**
  * Check whether a river at begin could (logically) flow down to end.
  * @param begin The origin of the flow.
@@ -1190,15 +1245,9 @@ static bool FlowsDown(TileIndex begin, TileIndex end)
 	dbg_assert(DistanceManhattan(begin, end) == 1);
 
 	int heightBegin;
-	int heightEnd;
 	Slope slopeBegin = GetTileSlope(begin, &heightBegin);
-	Slope slopeEnd   = GetTileSlope(end, &heightEnd);
 
-	return heightEnd <= heightBegin &&
-			/* Slope either is inclined or flat; rivers don't support other slopes. */
-			(slopeEnd == SLOPE_FLAT || IsInclinedSlope(slopeEnd)) &&
-			/* Slope continues, then it must be lower... or either end must be flat. */
-			((slopeEnd == slopeBegin && heightEnd < heightBegin) || slopeEnd == SLOPE_FLAT || slopeBegin == SLOPE_FLAT);
+	return FlowsDownFrom(slopeBegin, heightBegin, end);
 }
 
 /* AyStar callback for checking whether we reached our destination. */
@@ -1223,11 +1272,13 @@ static int32 River_CalculateH(AyStar *aystar, AyStarNode *current, OpenListNode
 static void River_GetNeighbours(AyStar *aystar, OpenListNode *current)
 {
 	TileIndex tile = current->path.node.tile;
+	int height;
+	Slope slope = GetTileSlope(tile, &height);
 
 	aystar->num_neighbours = 0;
 	for (DiagDirection d = DIAGDIR_BEGIN; d < DIAGDIR_END; d++) {
 		TileIndex t2 = tile + TileOffsByDiagDir(d);
-		if (IsValidTile(t2) && FlowsDown(tile, t2)) {
+		if (IsValidTile(t2) && FlowsDownFrom(slope, height, t2)) {
 			aystar->neighbours[aystar->num_neighbours].tile = t2;
 			aystar->neighbours[aystar->num_neighbours].direction = INVALID_TRACKDIR;
 			aystar->num_neighbours++;
@@ -1278,37 +1329,30 @@ static const uint RIVER_HASH_SIZE = 8; ///< The number of bits the hash for rive
 
 /**
  * Actually build the river between the begin and end tiles using AyStar.
+ * @param finder The initialised AyStar instance to search with; reused between calls.
  * @param begin The begin of the river.
  * @param end The end of the river.
  */
-static void BuildRiver(TileIndex begin, TileIndex end)
+static void BuildRiver(AyStar &finder, TileIndex begin, TileIndex end)
 {
-	AyStar finder = {};
-	finder.CalculateG = River_CalculateG;
-	finder.CalculateH = River_CalculateH;
-	finder.GetNeighbours = River_GetNeighbours;
-	finder.EndNodeCheck = River_EndNodeCheck;
-	finder.FoundEndNode = River_FoundEndNode;
 	finder.user_target = &end;
 
-	finder.Init(1 << RIVER_HASH_SIZE);
-
 	AyStarNode start;
 	start.tile = begin;
 	start.direction = INVALID_TRACKDIR;
 	finder.AddStartNode(&start, 0);
 	finder.Main();
-	finder.Free();
 }
 
 /**
  * Try to flow the river down from a given begin.
+ * @param finder The initialised AyStar instance to build river segments with.
  * @param spring The springing point of the river.
  * @param begin  The begin point we are looking from; somewhere down hill from the spring.
  * @param min_river_length The minimum length for the river.
  * @return True iff a river could/has been built, otherwise false.
  */
-static bool FlowRiver(TileIndex spring, TileIndex begin, uint min_river_length)
+static bool FlowRiver(AyStar &finder, TileIndex spring, TileIndex begin, uint min_river_length)
 {
 #	define SET_MARK(x) marks.insert(x)
 #	define IS_MARKED(x) (marks.find(x) != marks.end())
@@ -1344,9 +1388,11 @@ static bool FlowRiver(TileIndex spring, TileIndex begin, uint min_river_length)
 			break;
 		}
 
+		int heightFlow;
+		Slope slopeFlow = GetTileSlope(end, &heightFlow);
 		for (DiagDirection d = DIAGDIR_BEGIN; d < DIAGDIR_END; d++) {
 			TileIndex t2 = end + TileOffsByDiagDir(d);
-			if (IsValidTile(t2) && !IS_MARKED(t2) && FlowsDown(end, t2)) {
+			if (IsValidTile(t2) && !IS_MARKED(t2) && FlowsDownFrom(slopeFlow, heightFlow, t2)) {
 				SET_MARK(t2);
 				count++;
 				queue.push_back(t2);
@@ -1356,7 +1402,7 @@ static bool FlowRiver(TileIndex spring, TileIndex begin, uint min_river_length)
 
 	if (found) {
 		/* Flow further down hill. */
-		found = FlowRiver(spring, end, min_river_length);
+		found = FlowRiver(finder, spring, end, min_river_length);
 	} else if (count > 32 && _settings_game.game_creation.lake_size != 0) {
 		/* Maybe we can make a lake. Find the Nth of the considered tiles. */
 		TileIndex lakeCenter = 0;
@@ -1410,7 +1456,7 @@ static bool FlowRiver(TileIndex spring, TileIndex begin, uint min_river_length)
 	}
 
 	marks.clear();
-	if (found) BuildRiver(begin, end);
+	if (found) BuildRiver(finder, begin, end);
 	return found;
 }
 
@@ -1426,6 +1472,16 @@ static void CreateRivers()
 	const uint num_short_rivers = wells - std::max(1u, wells / 10);
 	SetGeneratingWorldProgress(GWP_RIVER, wells + 256 / 64); // Include the tile loop calls below.
 
+	/* One river is built from many AyStar segments; share one finder so its open
+	 * queue and hash storage are set up once instead of per segment. */
+	AyStar finder = {};
+	finder.CalculateG = River_CalculateG;
+	finder.CalculateH = River_CalculateH;
+	finder.GetNeighbours = River_GetNeighbours;
+	finder.EndNodeCheck = River_EndNodeCheck;
+	finder.FoundEndNode = River_FoundEndNode;
+	finder.Init(1 << RIVER_HASH_SIZE);
+
 	for (; wells > num_short_rivers; wells--) {
 		IncreaseGeneratingWorldProgress(GWP_RIVER);
 		for (int tries = 0; tries < 128; tries++) {
@@ -1433,7 +1489,7 @@ static void CreateRivers()
 			if (!CircularTileSearch(&t, 8, FindSpring, nullptr)) continue;
 			_current_spring = t;
 			_is_main_river = false;
-			if (FlowRiver(t, t, _settings_game.game_creation.min_river_length * 4)) break;
+			if (FlowRiver(finder, t, t, _settings_game.game_creation.min_river_length * 4)) break;
 		}
 	}
 
@@ -1444,10 +1500,12 @@ static void CreateRivers()
 			if (!CircularTileSearch(&t, 8, FindSpring, nullptr)) continue;
 			_current_spring = t;
 			_is_main_river = false;
-			if (FlowRiver(t, t, _settings_game.game_creation.min_river_length)) break;
+			if (FlowRiver(finder, t, t, _settings_game.game_creation.min_river_length)) break;
 		}
 	}
 
+	finder.Free();
+
 	/* Widening rivers may have left some tiles requiring to be watered. */
 	ConvertGroundTilesIntoWaterTiles();
 
@@ -2,6 +2,7 @@
 
 #include "../stdafx.h"
 #include "demands.h"
+#include "../worker_thread.h"
 #include <queue>
 #include <algorithm>
 #include <tuple>
@@ -245,7 +246,7 @@ void AsymmetricScalerEq::SetDemands(LinkGraphJob &job, NodeID from_id, NodeID to
 inline void Scaler::SetDemands(LinkGraphJob &job, NodeID from_id, NodeID to_id, uint demand_forw)
 {
 	job[from_id].DeliverSupply(demand_forw);
-	job.demand_map[std::make_pair(from_id, to_id)] += demand_forw;
+	job.demand_accumulator.push_back({ from_id, to_id, demand_forw });
 }
 
 /**
@@ -380,14 +381,52 @@ void DemandCalculator::CalcMinimisedDistanceDemand(LinkGraphJob &job, const std:
 		NodeID to_id;
 		uint distance;
 	};
-	std::vector<EdgeCandidate> candidates;
-	candidates.reserve(supplies.size() * demands.size() - std::min(supplies.size(), demands.size()));
-	for (NodeID from_id : supplies) {
-		for (NodeID to_id : demands) {
-			if (from_id != to_id) {
-				candidates.push_back({ from_id, to_id, DistanceMaxPlusManhattan(job[from_id].XY(), job[to_id].XY()) });
+
+	/* Generate the supply x demand candidate matrix striped over the worker
+	 * pool. Each supply node's row has a known size and a precomputed offset,
+	 * so the ranges written are disjoint and the contents do not depend on the
+	 * number of worker threads; the sort below then makes the final order
+	 * thread-count independent too, which is required for network safety. */
+	std::vector<size_t> row_offsets(supplies.size() + 1);
+	row_offsets[0] = 0;
+	for (size_t i = 0; i < supplies.size(); i++) {
+		size_t row_size = demands.size();
+		if (std::binary_search(demands.begin(), demands.end(), supplies[i])) row_size--;
+		row_offsets[i + 1] = row_offsets[i] + row_size;
+	}
+	std::vector<EdgeCandidate> candidates(row_offsets.back());
+
+	struct CandidateGenContext {
+		LinkGraphJob &job;
+		const std::vector<NodeID> &supplies;
+		const std::vector<NodeID> &demands;
+		const std::vector<size_t> &row_offsets;
+		std::vector<EdgeCandidate> &candidates;
+	};
+	CandidateGenContext ctx { job, supplies, demands, row_offsets, candidates };
+
+	auto gen_rows = [](void *data1, void *data2, void *data3) {
+		CandidateGenContext *ctx = static_cast<CandidateGenContext *>(data1);
+		for (size_t i = (size_t)(uintptr_t)data2; i != (size_t)(uintptr_t)data3; i++) {
+			const NodeID from_id = ctx->supplies[i];
+			size_t idx = ctx->row_offsets[i];
+			for (NodeID to_id : ctx->demands) {
+				if (from_id == to_id) continue;
+				ctx->candidates[idx++] = { from_id, to_id, DistanceMaxPlusManhattan(ctx->job[from_id].XY(), ctx->job[to_id].XY()) };
 			}
 		}
+	};
+
+	const size_t GEN_RANGE_SIZE = 64;
+	if (supplies.size() > GEN_RANGE_SIZE && _general_worker_pool.HasWorkers()) {
+		WorkerJobGroup group;
+		for (size_t start = GEN_RANGE_SIZE; start < supplies.size(); start += GEN_RANGE_SIZE) {
+			_general_worker_pool.EnqueueJob(gen_rows, &ctx, (void *)(uintptr_t)start, (void *)(uintptr_t)std::min(start + GEN_RANGE_SIZE, supplies.size()), &group);
+		}
+		gen_rows(&ctx, (void *)(uintptr_t)0, (void *)(uintptr_t)GEN_RANGE_SIZE);
+		group.WaitForCompletion();
+	} else {
+		gen_rows(&ctx, (void *)(uintptr_t)0, (void *)(uintptr_t)supplies.size());
 	}
 	std::sort(candidates.begin(), candidates.end(), [](const EdgeCandidate &a, const EdgeCandidate &b) {
 		return std::tie(a.distance, a.from_id, a.to_id) < std::tie(b.distance, b.from_id, b.to_id);
@@ -480,24 +519,43 @@ DemandCalculator::DemandCalculator(LinkGraphJob &job) :
 		}
 	} while (first_unseen < size);
 
-	if (job.demand_map.size() > 0) {
-		job.demand_annotation_store.resize(job.demand_map.size());
+	if (!job.demand_accumulator.empty()) {
+		/* Merge the unordered per-pair contributions: sort by (from, to), then sum
+		 * runs of identical pairs in place. The result is grouped by from node, as
+		 * required for the per-node demand annotation spans below. */
+		std::sort(job.demand_accumulator.begin(), job.demand_accumulator.end(), [](const LinkGraphJob::DemandPair &a, const LinkGraphJob::DemandPair &b) {
+			return std::tie(a.from, a.to) < std::tie(b.from, b.to);
+		});
+		size_t merged = 0;
+		for (size_t i = 0; i < job.demand_accumulator.size();) {
+			LinkGraphJob::DemandPair pair = job.demand_accumulator[i];
+			for (i++; i < job.demand_accumulator.size(); i++) {
+				const LinkGraphJob::DemandPair &next = job.demand_accumulator[i];
+				if (next.from != pair.from || next.to != pair.to) break;
+				pair.demand += next.demand;
+			}
+			job.demand_accumulator[merged++] = pair;
+		}
+
+		job.demand_annotation_store.resize(merged);
 		size_t start_idx = 0;
 		size_t idx = 0;
-		NodeID last_from = job.demand_map.begin()->first.first;
+		NodeID last_from = job.demand_accumulator.front().from;
 		auto flush = [&]() {
 			job[last_from].SetDemandAnnotations({ job.demand_annotation_store.data() + start_idx, idx - start_idx });
 		};
-		for (auto &iter : job.demand_map) {
-			if (iter.first.first != last_from) {
+		for (size_t i = 0; i < merged; i++) {
+			const LinkGraphJob::DemandPair &pair = job.demand_accumulator[i];
+			if (pair.from != last_from) {
 				flush();
-				last_from = iter.first.first;
+				last_from = pair.from;
 				start_idx = idx;
 			}
-			job.demand_annotation_store[idx] = { iter.first.second, iter.second, iter.second };
+			job.demand_annotation_store[idx] = { pair.to, pair.demand, pair.demand };
 			idx++;
 		}
 		flush();
-		job.demand_map.clear();
+		job.demand_accumulator.clear();
+		job.demand_accumulator.shrink_to_fit();
 	}
 }
@@ -62,4 +62,11 @@ void FlowMapper::Run(LinkGraphJob &job) const
 		node.Paths().clear();
 	}
 	job.path_allocator.ResetArena();
+
+	/* The MCF passes free paths into path_allocator's free list regardless of which
+	 * arena they were allocated from, so the auxiliary arenas must be reset at the
+	 * same time as the main one. */
+	for (auto &alloc : job.aux_path_allocators) {
+		alloc->ResetArena();
+	}
 }
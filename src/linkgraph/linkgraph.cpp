@@ -40,6 +40,7 @@ inline void LinkGraph::BaseNode::Init(TileIndex xy, StationID st, uint demand)
 void LinkGraph::ShiftDates(int interval)
 {
 	this->last_compression += interval;
+	if (this->last_solved != 0) this->last_solved = std::max<Date>(0, this->last_solved + interval);
 	for (NodeID node1 = 0; node1 < this->Size(); ++node1) {
 		BaseNode &source = this->nodes[node1];
 		if (source.last_update != INVALID_DATE) source.last_update += interval;
@@ -55,6 +56,7 @@ void LinkGraph::ShiftDates(int interval)
 void LinkGraph::Compress()
 {
 	this->last_compression = (_date + this->last_compression) / 2;
+	this->last_solved = 0; // scaled capacities and supplies require a fresh solve
 	for (NodeID node1 = 0; node1 < this->Size(); ++node1) {
 		this->nodes[node1].supply /= 2;
 	}
@@ -81,6 +83,7 @@ void LinkGraph::Merge(LinkGraph *other)
 {
 	Date age = _date - this->last_compression + 1;
 	Date other_age = _date - other->last_compression + 1;
+	this->last_solved = 0;
 	NodeID first = this->Size();
 	this->nodes.reserve(first + other->Size());
 	for (NodeID node1 = 0; node1 < other->Size(); ++node1) {
@@ -111,6 +114,8 @@ void LinkGraph::RemoveNode(NodeID id)
 {
 	assert(id < this->Size());
 
+	this->last_solved = 0; // removals leave no timestamp behind, force a fresh solve
+
 	std::vector<std::pair<std::pair<NodeID, NodeID>, BaseEdge>> saved_nodes;
 
 	NodeID last_node = this->Size() - 1;
@@ -206,7 +211,30 @@ void LinkGraph::UpdateEdge(NodeID from, NodeID to, uint capacity, uint usage, ui
 void LinkGraph::RemoveEdge(NodeID from, NodeID to)
 {
 	if (from == to) return;
-	this->edges.erase(std::make_pair(from, to));
+	if (this->edges.erase(std::make_pair(from, to)) != 0) {
+		this->last_solved = 0; // removals leave no timestamp behind, force a fresh solve
+	}
+}
+
+/**
+ * Check whether the content of this component (supplies, demands or link
+ * capacities) has been updated since the given date. Node and edge removals
+ * are not covered by the timestamps; they reset last_solved instead.
+ * @param date Date to compare the update timestamps against.
+ * @return True if anything changed since the given date.
+ */
+bool LinkGraph::ContentChangedSince(Date date) const
+{
+	for (const BaseNode &node : this->nodes) {
+		if (node.last_update >= date) return true;
+	}
+	for (const auto &it : this->edges) {
+		const BaseEdge &edge = it.second;
+		if (edge.last_unrestricted_update >= date) return true;
+		if (edge.last_restricted_update >= date) return true;
+		if (edge.last_aircraft_update >= date) return true;
+	}
+	return false;
 }
 
 /**
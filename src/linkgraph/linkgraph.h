@@ -274,11 +274,13 @@ public:
 		}
 
 		/**
-		 * Set the node's demand.
+		 * Set the node's demand and, if it changed, set last_update to the
+		 * current date so that the change is visible to ContentChangedSince().
 		 * @param demand New demand for the node.
 		 */
 		void SetDemand(uint demand)
 		{
+			if (this->node.demand != demand) this->node.last_update = _date;
 			this->node.demand = demand;
 		}
 	};
@@ -306,12 +308,12 @@ public:
 	}
 
 	/** Bare constructor, only for save/load. */
-	LinkGraph() : cargo(INVALID_CARGO), last_compression(0) {}
+	LinkGraph() : cargo(INVALID_CARGO), last_compression(0), last_solved(0) {}
 	/**
 	 * Real constructor.
 	 * @param cargo Cargo the link graph is about.
 	 */
-	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(_date) {}
+	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(_date), last_solved(0) {}
 
 	void Init(uint size);
 	void ShiftDates(int interval);
@@ -352,6 +354,18 @@ public:
 	 */
 	inline Date LastCompression() const { return this->last_compression; }
 
+	/**
+	 * Get the date a calculation job was last spawned for this component,
+	 * or 0 if it was never solved or a structural change forces a re-solve.
+	 * @return Date of last solve.
+	 */
+	inline Date LastSolved() const { return this->last_solved; }
+
+	/** Record that a calculation job has been spawned for this component. */
+	inline void SetLastSolved(Date date) { this->last_solved = date; }
+
+	bool ContentChangedSince(Date date) const;
+
 	/**
 	 * Get the cargo ID this component's link graph refers to.
 	 * @return Cargo ID.
@@ -394,6 +408,7 @@ protected:
 
 	CargoID cargo;         ///< Cargo of this component's link graph.
 	Date last_compression; ///< Last time the capacities and supplies were compressed.
+	Date last_solved;      ///< Last time a calculation job was spawned, 0 if a re-solve is forced.
 	NodeVector nodes;      ///< Nodes in the component.
 	EdgeMatrix edges;      ///< Edges in the component.
 
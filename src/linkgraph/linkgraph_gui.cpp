@@ -111,10 +111,26 @@ void LinkGraphOverlay::MarkStationViewportLinksDirty(const Station *st)
  */
 void LinkGraphOverlay::RebuildCache(bool incremental)
 {
-	if (!incremental) {
+	this->BuildCache(incremental);
+	this->SwapCache();
+}
+
+/**
+ * Recalculate which links and stations are to be shown, into the staging
+ * buffers. This is the expensive part of a cache rebuild. It only reads game
+ * state and the previously published cache, so it may run on a worker thread
+ * during a draw pass; the results become visible once SwapCache() is called.
+ * @param incremental Add only the entries missing from the current cache.
+ */
+void LinkGraphOverlay::BuildCache(bool incremental)
+{
+	if (incremental) {
+		this->rebuild_links = this->cached_links;
+		this->rebuild_stations = this->cached_stations;
+	} else {
 		this->dirty = false;
-		this->cached_links.clear();
-		this->cached_stations.clear();
+		this->rebuild_links.clear();
+		this->rebuild_stations.clear();
 		this->last_update_number = GetWindowUpdateNumber();
 	}
 	if (this->company_mask == 0) return;
@@ -143,12 +159,12 @@ void LinkGraphOverlay::RebuildCache(bool incremental)
 	std::vector<std::pair<StationID, StationID>> incremental_link_exclude;
 
 	if (incremental) {
-		incremental_station_exclude.reserve(this->cached_stations.size());
-		for (StationSupplyList::iterator i(this->cached_stations.begin()); i != this->cached_stations.end(); ++i) {
+		incremental_station_exclude.reserve(this->rebuild_stations.size());
+		for (StationSupplyList::iterator i(this->rebuild_stations.begin()); i != this->rebuild_stations.end(); ++i) {
 			incremental_station_exclude.push_back(i->id);
 		}
-		incremental_link_exclude.reserve(this->cached_links.size());
-		for (LinkList::iterator i(this->cached_links.begin()); i != this->cached_links.end(); ++i) {
+		incremental_link_exclude.reserve(this->rebuild_links.size());
+		for (LinkList::iterator i(this->rebuild_links.begin()); i != this->rebuild_links.end(); ++i) {
 			incremental_link_exclude.push_back(std::make_pair(i->from_id, i->to_id));
 		}
 	}
@@ -180,7 +196,7 @@ void LinkGraphOverlay::RebuildCache(bool incremental)
 		}
 	};
 
-	const size_t previous_cached_stations_count = this->cached_stations.size();
+	const size_t previous_cached_stations_count = this->rebuild_stations.size();
 	for (const Station *sta : Station::Iterate()) {
 		if (sta->rect.IsEmpty()) continue;
 
@@ -227,30 +243,68 @@ void LinkGraphOverlay::RebuildCache(bool incremental)
 			});
 		}
 		if (cache_all || this->IsPointVisible(pta, &dpi)) {
-			this->cached_stations.push_back({ from, supply, pta });
+			this->rebuild_stations.push_back({ from, supply, pta });
 		}
 	}
 
-	const size_t previous_cached_links_count = this->cached_links.size();
-	this->cached_links.reserve(this->cached_links.size() + link_cache_map.size());
+	const size_t previous_cached_links_count = this->rebuild_links.size();
+	this->rebuild_links.reserve(this->rebuild_links.size() + link_cache_map.size());
 	for (auto &iter : link_cache_map) {
-		this->cached_links.push_back({ iter.first.first, iter.first.second, iter.second.from_pt, iter.second.to_pt, iter.second.prop });
+		this->rebuild_links.push_back({ iter.first.first, iter.first.second, iter.second.from_pt, iter.second.to_pt, iter.second.prop });
 	}
 
 	if (previous_cached_stations_count > 0) {
-		std::inplace_merge(this->cached_stations.begin(), this->cached_stations.begin() + previous_cached_stations_count, this->cached_stations.end(),
+		std::inplace_merge(this->rebuild_stations.begin(), this->rebuild_stations.begin() + previous_cached_stations_count, this->rebuild_stations.end(),
 				[](const StationSupplyInfo &a, const StationSupplyInfo &b) {
 					return a.id < b.id;
 				});
 	}
 	if (previous_cached_links_count > 0) {
-		std::inplace_merge(this->cached_links.begin(), this->cached_links.begin() + previous_cached_links_count, this->cached_links.end(),
+		std::inplace_merge(this->rebuild_links.begin(), this->rebuild_links.begin() + previous_cached_links_count, this->rebuild_links.end(),
 				[](const LinkInfo &a, const LinkInfo &b) {
 					return std::make_pair(a.from_id, a.to_id) < std::make_pair(b.from_id, b.to_id);
 				});
 	}
 }
 
+/** Publish the staging buffers filled by BuildCache() as the new cache. */
+void LinkGraphOverlay::SwapCache()
+{
+	this->cached_links = std::move(this->rebuild_links);
+	this->cached_stations = std::move(this->rebuild_stations);
+	this->rebuild_links.clear();
+	this->rebuild_stations.clear();
+}
+
+/**
+ * Queue a full cache rebuild on the worker pool if one is due. Call this at
+ * the start of a draw pass so the rebuild overlaps with the rest of the
+ * drawing work; JoinRebuildCacheJob() publishes the results before the
+ * overlay is drawn or its cache is otherwise read.
+ */
+void LinkGraphOverlay::QueueRebuildCacheJob()
+{
+	if (this->rebuild_job_queued || !this->dirty) return;
+
+	this->rebuild_job_queued = true;
+	_general_worker_pool.EnqueueJob([](void *data1, void *data2, void *data3) {
+		static_cast<LinkGraphOverlay *>(data1)->BuildCache();
+	}, this, nullptr, nullptr, &this->rebuild_job_group);
+}
+
+/**
+ * Wait for a rebuild job queued by QueueRebuildCacheJob() and publish its
+ * results. Safe to call from within a worker job.
+ */
+void LinkGraphOverlay::JoinRebuildCacheJob()
+{
+	if (!this->rebuild_job_queued) return;
+
+	_general_worker_pool.WaitForGroupCompletion(&this->rebuild_job_group);
+	this->rebuild_job_queued = false;
+	this->SwapCache();
+}
+
 /**
  * Determine if a certain point is inside the given DPI, with some lee way.
  * @param pt Point we are looking for.
@@ -386,6 +440,7 @@ void LinkGraphOverlay::RefreshDrawCache()
  */
 void LinkGraphOverlay::PrepareDraw()
 {
+	this->JoinRebuildCacheJob();
 	if (this->dirty) {
 		this->RebuildCache();
 	}
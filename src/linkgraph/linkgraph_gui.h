@@ -14,6 +14,7 @@
 #include "../station_base.h"
 #include "../widget_type.h"
 #include "../window_gui.h"
+#include "../worker_thread.h"
 #include "linkgraph_base.h"
 #include <map>
 #include <vector>
@@ -74,6 +75,8 @@ public:
 	{}
 
 	void RebuildCache(bool incremental = false);
+	void QueueRebuildCacheJob();
+	void JoinRebuildCacheJob();
 	bool CacheStillValid() const;
 	void MarkStationViewportLinksDirty(const Station *st);
 	void PrepareDraw();
@@ -99,13 +102,19 @@ protected:
 	CompanyMask company_mask;          ///< Bitmask of companies to be displayed.
 	LinkList cached_links;             ///< Cache for links to reduce recalculation.
 	StationSupplyList cached_stations; ///< Cache for stations to be drawn.
+	LinkList rebuild_links;             ///< Staging buffer for links, written by BuildCache().
+	StationSupplyList rebuild_stations; ///< Staging buffer for stations, written by BuildCache().
 	Rect cached_region;                ///< Region covered by cached_links and cached_stations.
 	uint scale;                        ///< Width of link lines.
 	bool dirty;                        ///< Set if overlay should be rebuilt.
+	bool rebuild_job_queued = false;   ///< Set if a cache rebuild job is queued or in flight on the worker pool.
 	uint64 last_update_number = 0;     ///< Last window update number
+	WorkerJobGroup rebuild_job_group;  ///< Tracks completion of the queued cache rebuild job.
 
 	Point GetStationMiddle(const Station *st) const;
 
+	void BuildCache(bool incremental = false);
+	void SwapCache();
 	void RefreshDrawCache();
 	void DrawLinks(const DrawPixelInfo *dpi) const;
 	void DrawStationDots(const DrawPixelInfo *dpi) const;
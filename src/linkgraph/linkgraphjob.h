@@ -152,10 +152,31 @@ protected:
 
 public:
 
-	btree::btree_map<std::pair<NodeID, NodeID>, uint> demand_map; ///< Demand map.
-	std::vector<DemandAnnotation> demand_annotation_store;        ///< Demand annotation store.
+	/** A single demand contribution between two nodes, merged with the other contributions for the same pair at the end of demand calculation. */
+	struct DemandPair {
+		NodeID from; ///< Supplying node.
+		NodeID to;   ///< Receiving node.
+		uint demand; ///< Demand contribution between the nodes.
+	};
+
+	std::vector<DemandPair> demand_accumulator;            ///< Unmerged per-pair demand contributions, flattened into demand_annotation_store at the end of demand calculation.
+	std::vector<DemandAnnotation> demand_annotation_store; ///< Demand annotation store.
 
 	DynUniformArenaAllocator path_allocator; ///< Arena allocator used for paths
+	std::vector<std::unique_ptr<DynUniformArenaAllocator>> aux_path_allocators; ///< Extra path arenas used by parallel Dijkstra batches, reset together with path_allocator
+
+	/**
+	 * Get the auxiliary path arena for the given parallel batch slot, creating it if required.
+	 * @param slot Batch slot index (0-based, slot 0 of a batch uses path_allocator instead).
+	 * @return The arena allocator for that slot.
+	 */
+	inline DynUniformArenaAllocator &GetAuxPathAllocator(uint slot)
+	{
+		while (slot >= this->aux_path_allocators.size()) {
+			this->aux_path_allocators.push_back(std::make_unique<DynUniformArenaAllocator>());
+		}
+		return *this->aux_path_allocators[slot];
+	}
 
 	/**
 	 * Link graph job node. Wraps a constant link graph node and a modifiable
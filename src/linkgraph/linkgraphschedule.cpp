@@ -16,6 +16,7 @@
 #include "../framerate_type.h"
 #include "../command_func.h"
 #include "../network/network.h"
+#include "../worker_thread.h"
 #include <algorithm>
 
 #include "../safeguards.h"
@@ -56,7 +57,7 @@ void LinkGraphSchedule::SpawnNext()
 		++iter;
 		const LinkGraph *lg = *current;
 
-		if (lg->Size() < 2) {
+		if (lg->Size() < 2 || CanSkipCalculation(lg)) {
 			schedule_to_back.splice(schedule_to_back.end(), this->schedule, current);
 		} else {
 			total_cost += lg->CalculateCostEstimate();
@@ -78,6 +79,7 @@ void LinkGraphSchedule::SpawnNext()
 		uint64 cost = lg->CalculateCostEstimate();
 		used_budget += cost;
 		if (LinkGraphJob::CanAllocateItem()) {
+			lg->SetLastSolved(_date);
 			uint duration_multiplier = CeilDivT<uint64_t>(lg->Size(), 75);
 			std::unique_ptr<LinkGraphJob> job(new LinkGraphJob(*lg, duration_multiplier));
 			jobs_to_execute.emplace_back(job.get(), cost);
@@ -107,6 +109,26 @@ void LinkGraphSchedule::SpawnNext()
 			total_cost, cost_budget, scaling, this->schedule.size(), this->running.size());
 }
 
+/**
+ * Check whether the scheduled calculation of the given link graph can be
+ * skipped because its content is unchanged since its last calculation.
+ * The result would be identical to the flows already in place, so re-solving
+ * it would only burn background CPU. A full solve is forced periodically in
+ * case a change slipped past the update timestamps.
+ * @param lg Link graph due for calculation.
+ * @return True if the calculation can be skipped this round.
+ */
+/* static */ bool LinkGraphSchedule::CanSkipCalculation(const LinkGraph *lg)
+{
+	if (!_settings_game.linkgraph.recalc_only_changed) return false;
+	if (lg->LastSolved() == 0) return false;
+	if (_date - lg->LastSolved() >= (Date)_settings_game.linkgraph.recalc_interval * 8) return false;
+	if (lg->ContentChangedSince(lg->LastSolved())) return false;
+	DEBUG(linkgraph, 3, "LinkGraphSchedule::CanSkipCalculation(): Skipping unchanged graph: id: %u, nodes: %u, last solved: %d",
+			lg->index, lg->Size(), lg->LastSolved());
+	return true;
+}
+
 /**
  * Join the next finished job, if available.
  */
@@ -236,7 +258,10 @@ void LinkGraphJobGroup::SpawnThread()
 	 * Spawn a thread if possible and run the link graph job in the thread. If
 	 * that's not possible run the job right now in the current thread.
 	 */
-	if (StartNewThread(&this->thread, "ottd:linkgraph", &(LinkGraphJobGroup::Run), this)) {
+	if (StartNewThread(&this->thread, "ottd:linkgraph", [](LinkGraphJobGroup *group) {
+				SetCurrentThreadAffinity(ParseCpuAffinityMask(_linkgraph_thread_affinity));
+				LinkGraphJobGroup::Run(group);
+			}, this)) {
 		for (auto &it : this->jobs) {
 			it->SetJobGroup(this->shared_from_this());
 		}
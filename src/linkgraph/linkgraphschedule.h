@@ -60,6 +60,7 @@ public:
 
 	static void Run(LinkGraphJob *job);
 	static void Clear();
+	static bool CanSkipCalculation(const LinkGraph *lg);
 
 	void SpawnNext();
 	bool IsJoinWithUnfinishedJobDue() const;
@@ -1,8 +1,10 @@
 /** @file mcf.cpp Definition of Multi-Commodity-Flow solver. */
 
 #include "../stdafx.h"
+#include "../debug.h"
 #include "../core/math_func.hpp"
 #include "mcf.h"
+#include "../worker_thread.h"
 #include "../3rdparty/cpp-btree/btree_map.h"
 #include <set>
 
@@ -288,9 +290,10 @@ bool CapacityAnnotation::IsBetter(const CapacityAnnotation *base, uint cap,
  * @tparam Tedge_iterator Iterator to be used for getting outgoing edges.
  * @param source_node Node where the algorithm starts.
  * @param paths Container for the paths to be calculated.
+ * @param allocator Arena to allocate the paths from.
  */
 template<class Tannotation, class Tedge_iterator>
-void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
+void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths, DynUniformArenaAllocator &allocator)
 {
 	typedef btree::btree_set<AnnoSetItem<Tannotation>, typename Tannotation::Comparator> AnnoSet;
 	AnnoSet annos = AnnoSet(typename Tannotation::Comparator());
@@ -298,10 +301,10 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 	uint size = this->job.Size();
 	paths.resize(size, nullptr);
 
-	this->job.path_allocator.SetParameters(sizeof(Tannotation), (8192 - 32) / sizeof(Tannotation));
+	allocator.SetParameters(sizeof(Tannotation), (8192 - 32) / sizeof(Tannotation));
 
 	for (NodeID node = 0; node < size; ++node) {
-		Tannotation *anno = new (this->job.path_allocator.Allocate()) Tannotation(node, node == source_node);
+		Tannotation *anno = new (allocator.Allocate()) Tannotation(node, node == source_node);
 		anno->UpdateAnnotation();
 		if (node == source_node) {
 			annos.insert(AnnoSetItem<Tannotation>(anno));
@@ -337,6 +340,48 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 	}
 }
 
+/**
+ * Worker pool trampoline for one slot of a Dijkstra batch.
+ * @param data1 MultiCommodityFlow being run.
+ * @param data2 DijkstraBatchSlot to compute.
+ */
+template<class Tannotation, class Tedge_iterator>
+/* static */ void MultiCommodityFlow::RunDijkstraJob(void *data1, void *data2, void *data3)
+{
+	MultiCommodityFlow *mcf = static_cast<MultiCommodityFlow *>(data1);
+	DijkstraBatchSlot *slot = static_cast<DijkstraBatchSlot *>(data2);
+	mcf->Dijkstra<Tannotation, Tedge_iterator>(slot->source, slot->paths, *slot->allocator);
+}
+
+/**
+ * Compute the path trees for a batch of source nodes in parallel.
+ *
+ * All slots are computed against the same frozen flow state: Dijkstra only
+ * reads the job's edges and flows, which are mutated exclusively by the
+ * sequential PushFlow phase that follows the batch. Each slot allocates from
+ * its own arena, and slot 0 runs on the calling thread using path_allocator.
+ * The results are therefore independent of the number of worker threads,
+ * which is required for network safety.
+ * @param batch Slots to compute, each with its source already set.
+ */
+template<class Tannotation, class Tedge_iterator>
+void MultiCommodityFlow::DijkstraBatch(std::vector<DijkstraBatchSlot> &batch)
+{
+	batch[0].allocator = &this->job.path_allocator;
+	if (batch.size() == 1) {
+		this->Dijkstra<Tannotation, Tedge_iterator>(batch[0].source, batch[0].paths, *batch[0].allocator);
+		return;
+	}
+
+	WorkerJobGroup group;
+	for (uint i = 1; i < (uint)batch.size(); i++) {
+		batch[i].allocator = &this->job.GetAuxPathAllocator(i - 1);
+		_general_worker_pool.EnqueueJob(&MultiCommodityFlow::RunDijkstraJob<Tannotation, Tedge_iterator>, this, &batch[i], nullptr, &group);
+	}
+	this->Dijkstra<Tannotation, Tedge_iterator>(batch[0].source, batch[0].paths, *batch[0].allocator);
+	group.WaitForCompletion();
+}
+
 /**
  * Clean up paths that lead nowhere and the root path.
  * @param source_id ID of the root node.
@@ -535,7 +580,6 @@ bool MCF1stPass::EliminateCycles()
  */
 MCF1stPass::MCF1stPass(LinkGraphJob &job) : MultiCommodityFlow(job)
 {
-	PathVector paths;
 	uint16 size = job.Size();
 	uint accuracy = job.Settings().accuracy;
 	bool more_loops;
@@ -560,37 +604,62 @@ MCF1stPass::MCF1stPass(LinkGraphJob &job) : MultiCommodityFlow(job)
 		accuracy = Clamp(IntSqrt((4 * accuracy * accuracy * size) / demand_count), CeilDiv(accuracy, 4), accuracy);
 	}
 
+	/* Bound the number of refinement loops so that the worst-case solve time of
+	 * a pathological component stays finite. Each loop assigns at least
+	 * demand / accuracy flow to every reachable annotation, so loops beyond the
+	 * accuracy only shuffle marginal amounts; whatever demand is left when the
+	 * limit strikes is assigned along existing paths by MCF2ndPass. The limit
+	 * only depends on game state, so all network clients cut off identically. */
+	uint loops_remaining = 16 + accuracy * 2;
+
+	std::vector<DijkstraBatchSlot> batch;
+	batch.reserve(DIJKSTRA_BATCH_SIZE);
+
 	do {
 		more_loops = false;
-		for (NodeID source = 0; source < size; ++source) {
-			if (finished_sources[source]) continue;
+		for (NodeID source = 0; source < size;) {
+			batch.clear();
+			for (; source < size && batch.size() < DIJKSTRA_BATCH_SIZE; ++source) {
+				if (finished_sources[source]) continue;
+				batch.emplace_back().source = source;
+			}
+			if (batch.empty()) break;
 
 			/* First saturate the shortest paths. */
-			this->Dijkstra<DistanceAnnotation, GraphEdgeIterator>(source, paths);
-
-			bool source_demand_left = false;
-			for (DemandAnnotation &anno : job[source].GetDemandAnnotations()) {
-				NodeID dest = anno.dest;
-				if (anno.unsatisfied_demand > 0) {
-					Path *path = paths[dest];
-					assert(path != nullptr);
-					/* Generally only allow paths that don't exceed the
-					 * available capacity. But if no demand has been assigned
-					 * yet, make an exception and allow any valid path *once*. */
-					if (path->GetFreeCapacity() > 0 && this->PushFlow(anno, path,
-							min_step_size, accuracy, this->max_saturation) > 0) {
-						/* If a path has been found there is a chance we can
-						 * find more. */
-						more_loops = more_loops || (anno.unsatisfied_demand > 0);
-					} else if (anno.unsatisfied_demand == anno.demand &&
-							path->GetFreeCapacity() > INT_MIN) {
-						this->PushFlow(anno, path, min_step_size, accuracy, UINT_MAX);
+			this->DijkstraBatch<DistanceAnnotation, GraphEdgeIterator>(batch);
+
+			/* Then apply the demands sequentially in batch order, so that the
+			 * results do not depend on the number of worker threads. */
+			for (DijkstraBatchSlot &slot : batch) {
+				bool source_demand_left = false;
+				for (DemandAnnotation &anno : job[slot.source].GetDemandAnnotations()) {
+					NodeID dest = anno.dest;
+					if (anno.unsatisfied_demand > 0) {
+						Path *path = slot.paths[dest];
+						assert(path != nullptr);
+						/* Generally only allow paths that don't exceed the
+						 * available capacity. But if no demand has been assigned
+						 * yet, make an exception and allow any valid path *once*. */
+						if (path->GetFreeCapacity() > 0 && this->PushFlow(anno, path,
+								min_step_size, accuracy, this->max_saturation) > 0) {
+							/* If a path has been found there is a chance we can
+							 * find more. */
+							more_loops = more_loops || (anno.unsatisfied_demand > 0);
+						} else if (anno.unsatisfied_demand == anno.demand &&
+								path->GetFreeCapacity() > INT_MIN) {
+							this->PushFlow(anno, path, min_step_size, accuracy, UINT_MAX);
+						}
+						if (anno.unsatisfied_demand > 0) source_demand_left = true;
 					}
-					if (anno.unsatisfied_demand > 0) source_demand_left = true;
 				}
+				if (!source_demand_left) finished_sources[slot.source] = true;
+				this->CleanupPaths(slot.source, slot.paths);
 			}
-			if (!source_demand_left) finished_sources[source] = true;
-			this->CleanupPaths(source, paths);
+		}
+		if (--loops_remaining == 0) {
+			DEBUG(linkgraph, 1, "MCF1stPass: refinement loop limit hit: id: %u, nodes: %u, accuracy: %u",
+					job.LinkGraphIndex(), size, accuracy);
+			break;
 		}
 	} while ((more_loops || this->EliminateCycles()) && !job.IsJobAborted());
 }
@@ -603,32 +672,42 @@ MCF1stPass::MCF1stPass(LinkGraphJob &job) : MultiCommodityFlow(job)
 MCF2ndPass::MCF2ndPass(LinkGraphJob &job) : MultiCommodityFlow(job)
 {
 	this->max_saturation = UINT_MAX; // disable artificial cap on saturation
-	PathVector paths;
 	uint16 size = job.Size();
 	uint accuracy = job.Settings().accuracy;
 	bool demand_left = true;
 	std::vector<bool> finished_sources(size);
-	while (demand_left && !job.IsJobAborted()) {
-		demand_left = false;
-		for (NodeID source = 0; source < size; ++source) {
-			if (finished_sources[source]) continue;
 
-			this->Dijkstra<CapacityAnnotation, FlowEdgeIterator>(source, paths);
+	std::vector<DijkstraBatchSlot> batch;
+	batch.reserve(DIJKSTRA_BATCH_SIZE);
 
-			bool source_demand_left = false;
-			for (DemandAnnotation &anno : this->job[source].GetDemandAnnotations()) {
-				if (anno.unsatisfied_demand == 0) continue;
-				Path *path = paths[anno.dest];
-				if (path->GetFreeCapacity() > INT_MIN) {
-					this->PushFlow(anno, path, 1, accuracy, UINT_MAX);
-					if (anno.unsatisfied_demand > 0) {
-						demand_left = true;
-						source_demand_left = true;
+	while (demand_left && !job.IsJobAborted()) {
+		demand_left = false;
+		for (NodeID source = 0; source < size;) {
+			batch.clear();
+			for (; source < size && batch.size() < DIJKSTRA_BATCH_SIZE; ++source) {
+				if (finished_sources[source]) continue;
+				batch.emplace_back().source = source;
+			}
+			if (batch.empty()) break;
+
+			this->DijkstraBatch<CapacityAnnotation, FlowEdgeIterator>(batch);
+
+			for (DijkstraBatchSlot &slot : batch) {
+				bool source_demand_left = false;
+				for (DemandAnnotation &anno : this->job[slot.source].GetDemandAnnotations()) {
+					if (anno.unsatisfied_demand == 0) continue;
+					Path *path = slot.paths[anno.dest];
+					if (path->GetFreeCapacity() > INT_MIN) {
+						this->PushFlow(anno, path, 1, accuracy, UINT_MAX);
+						if (anno.unsatisfied_demand > 0) {
+							demand_left = true;
+							source_demand_left = true;
+						}
 					}
 				}
+				if (!source_demand_left) finished_sources[slot.source] = true;
+				this->CleanupPaths(slot.source, slot.paths);
 			}
-			if (!source_demand_left) finished_sources[source] = true;
-			this->CleanupPaths(source, paths);
 		}
 	}
 }
@@ -6,6 +6,8 @@
 #include "linkgraphjob_base.h"
 #include <vector>
 
+class DynUniformArenaAllocator;
+
 typedef std::vector<Path *> PathVector;
 
 /**
@@ -13,6 +15,16 @@ typedef std::vector<Path *> PathVector;
  */
 class MultiCommodityFlow {
 protected:
+	/** Number of source nodes whose shortest path trees are computed in one parallel batch. */
+	static const uint DIJKSTRA_BATCH_SIZE = 16;
+
+	/** One source node's slot in a parallel Dijkstra batch. */
+	struct DijkstraBatchSlot {
+		NodeID source;                       ///< Source node to compute the path tree from.
+		PathVector paths;                    ///< Resulting path tree.
+		DynUniformArenaAllocator *allocator; ///< Arena the paths were allocated from.
+	};
+
 	/**
 	 * Constructor.
 	 * @param job Link graph job being executed.
@@ -22,7 +34,13 @@ protected:
 	{}
 
 	template<class Tannotation, class Tedge_iterator>
-	void Dijkstra(NodeID from, PathVector &paths);
+	void Dijkstra(NodeID from, PathVector &paths, DynUniformArenaAllocator &allocator);
+
+	template<class Tannotation, class Tedge_iterator>
+	static void RunDijkstraJob(void *data1, void *data2, void *data3);
+
+	template<class Tannotation, class Tedge_iterator>
+	void DijkstraBatch(std::vector<DijkstraBatchSlot> &batch);
 
 	uint PushFlow(DemandAnnotation &anno, Path *path, uint min_step_size, uint accuracy, uint max_saturation);
 
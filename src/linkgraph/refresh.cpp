@@ -12,11 +12,48 @@
 #include "../station_func.h"
 #include "../engine_base.h"
 #include "../vehicle_func.h"
+#include "../date_func.h"
 #include "refresh.h"
 #include "linkgraph.h"
 
 #include "../safeguards.h"
 
+/**
+ * Compute a signature covering everything a refresh walk depends on besides
+ * the (shared) order list itself, or 0 if the walk cannot be deduplicated
+ * across the shared order group.
+ * @param v Vehicle the refresh walk would start from.
+ * @param cargo_mask Mask of cargoes the walk would refresh.
+ * @param have_cargo_mask Mask of cargoes the consist may leave its last loading station with.
+ * @return Signature of the walk, or 0 if deduplication is not possible.
+ */
+static uint64 GetRefreshSignature(const Vehicle *v, CargoTypes cargo_mask, CargoTypes have_cargo_mask)
+{
+	/* With conditional orders the walk depends on the vehicle's current
+	 * position in the order list, so vehicles cannot share a result. */
+	for (const Order *o = v->orders->GetFirstOrder(); o != nullptr; o = o->next) {
+		if (o->IsType(OT_CONDITIONAL)) return 0;
+	}
+
+	auto mix = [](uint64 &sig, uint64 value) {
+		sig = (sig ^ value) * 0x9E3779B97F4A7C15ULL;
+		sig ^= sig >> 29;
+	};
+
+	uint64 sig = 1;
+	mix(sig, cargo_mask);
+	mix(sig, have_cargo_mask & cargo_mask);
+	mix(sig, v->type);
+	mix(sig, v->GetDisplayMaxSpeed());
+	for (const Vehicle *u = v; u != nullptr; u = u->Next()) {
+		mix(sig, u->engine_type);
+		mix(sig, u->cargo_type | (uint(u->cargo_subtype) << 8));
+		mix(sig, u->cargo_cap | (uint32(u->refit_cap) << 16));
+	}
+	if (sig == 0) sig = 1;
+	return sig;
+}
+
 /**
  * Refresh all links the given vehicle will visit.
  * @param v Vehicle to refresh links for.
@@ -31,6 +68,18 @@
 
 	CargoTypes have_cargo_mask = v->GetLastLoadingStationValidCargoMask();
 
+	/* Vehicles sharing orders with an identical consist produce identical
+	 * refresh walks, so the result of the first walk of the day can stand in
+	 * for the whole group. Vehicles deviating from the group (e.g. different
+	 * refits) hash to a different signature and are still walked individually.
+	 * The full-loading variant is additive rather than idempotent and is
+	 * therefore never deduplicated. */
+	uint64 refresh_signature = 0;
+	if (!is_full_loading && allow_merge && v->orders->GetNumVehicles() > 1) {
+		refresh_signature = GetRefreshSignature(v, cargo_mask, have_cargo_mask);
+		if (refresh_signature != 0 && v->orders->IsFullRefreshCurrent(_date, refresh_signature)) return;
+	}
+
 	/* Scan orders for cargo-specific load/unload, and run LinkRefresher separately for each set of cargoes where they differ. */
 	while (cargo_mask != 0) {
 		CargoTypes iter_cargo_mask = cargo_mask;
@@ -63,6 +112,8 @@
 
 		cargo_mask &= ~iter_cargo_mask;
 	}
+
+	if (refresh_signature != 0) v->orders->SetLastFullRefresh(_date, refresh_signature);
 }
 
 /**
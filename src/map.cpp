@@ -32,8 +32,15 @@ uint _map_size_y;    ///< Size of the map along the Y
 uint _map_size;      ///< The number of tiles on the map
 uint _map_tile_mask; ///< _map_size - 1 (to mask the mapsize)
 
-Tile *_m = nullptr;          ///< Tiles of the map
-TileExtended *_me = nullptr; ///< Extended Tiles of the map
+byte *_map_storage = nullptr;     ///< Backing storage of the base tile fields, layout depends on _map_storage_mode.
+byte *_map_ext_storage = nullptr; ///< Backing storage of the extended tile fields, layout depends on _map_storage_mode.
+
+MapTileColumns _map_cols;                           ///< Per-field locations within the tile storage.
+MapStorageMode _map_storage_mode = MSM_INTERLEAVED; ///< Storage layout of the currently allocated map.
+byte _map_storage_mode_select = MSM_INTERLEAVED;    ///< Storage layout to use for the next AllocateMap(); bound to the map_storage_mode setting.
+
+MapTileArray _m;           ///< Tiles of the map
+MapTileExtendedArray _me;  ///< Extended Tiles of the map
 
 /**
  * Validates whether a map with the given dimension is valid
@@ -76,11 +83,44 @@ void AllocateMap(uint size_x, uint size_y)
 	_map_size = size_x * size_y;
 	_map_tile_mask = _map_size - 1;
 
-	free(_m);
-	free(_me);
-
-	_m = CallocT<Tile>(_map_size);
-	_me = CallocT<TileExtended>(_map_size);
+	free(_map_storage);
+	free(_map_ext_storage);
+
+	_map_storage = CallocT<byte>((size_t)_map_size * sizeof(Tile));
+	_map_ext_storage = CallocT<byte>((size_t)_map_size * sizeof(TileExtended));
+
+	_map_storage_mode = (MapStorageMode)_map_storage_mode_select;
+	if (_map_storage_mode == MSM_COLUMNAR) {
+		/* One contiguous array per field; the uint16 fields go first so that
+		 * every column is suitably aligned. */
+		byte *b = _map_storage;
+		_map_cols.m2     = { b,                 1 };
+		_map_cols.type   = { b + 2 * (size_t)_map_size, 0 };
+		_map_cols.height = { b + 3 * (size_t)_map_size, 0 };
+		_map_cols.m1     = { b + 4 * (size_t)_map_size, 0 };
+		_map_cols.m3     = { b + 5 * (size_t)_map_size, 0 };
+		_map_cols.m4     = { b + 6 * (size_t)_map_size, 0 };
+		_map_cols.m5     = { b + 7 * (size_t)_map_size, 0 };
+		byte *e = _map_ext_storage;
+		_map_cols.m8     = { e,                 1 };
+		_map_cols.m6     = { e + 2 * (size_t)_map_size, 0 };
+		_map_cols.m7     = { e + 3 * (size_t)_map_size, 0 };
+	} else {
+		static const uint8 shift = FindFirstBit(sizeof(Tile));
+		byte *b = _map_storage;
+		_map_cols.type   = { b + offsetof(Tile, type),   shift };
+		_map_cols.height = { b + offsetof(Tile, height), shift };
+		_map_cols.m2     = { b + offsetof(Tile, m2),     shift };
+		_map_cols.m1     = { b + offsetof(Tile, m1),     shift };
+		_map_cols.m3     = { b + offsetof(Tile, m3),     shift };
+		_map_cols.m4     = { b + offsetof(Tile, m4),     shift };
+		_map_cols.m5     = { b + offsetof(Tile, m5),     shift };
+		static const uint8 ext_shift = FindFirstBit(sizeof(TileExtended));
+		byte *e = _map_ext_storage;
+		_map_cols.m6     = { e + offsetof(TileExtended, m6), ext_shift };
+		_map_cols.m7     = { e + offsetof(TileExtended, m7), ext_shift };
+		_map_cols.m8     = { e + offsetof(TileExtended, m8), ext_shift };
+	}
 }
 
 
@@ -504,7 +544,7 @@ char *DumpTileInfo(char *b, const char *last, TileIndex tile)
 	} else {
 		b += seprintf(b, last, "tile: %X (%u x %u)", tile, TileX(tile), TileY(tile));
 	}
-	if (!_m || !_me) {
+	if (!_m.IsAllocated()) {
 		b += seprintf(b, last, ", NO MAP ALLOCATED");
 	} else {
 		if (tile >= MapSize()) {
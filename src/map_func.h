@@ -26,20 +26,111 @@ extern uint _map_tile_mask;
 #define TILE_MASK(x) ((x) & _map_tile_mask)
 
 /**
- * Pointer to the tile-array.
+ * Location of one tile field within the tile storage.
  *
- * This variable points to the tile-array which contains the tiles of
- * the map.
- */
-extern Tile *_m;
+ * In the interleaved layout the base points at the field of tile 0 inside
+ * the array of #Tile / #TileExtended and the shift is log2(sizeof(Tile)); in
+ * the columnar layout the base points at a dedicated per-field array and the
+ * shift is log2 of the field size.
+ */
+struct MapTileColumn {
+	byte *base;  ///< Address of tile 0's copy of the field.
+	uint8 shift; ///< Log2 of the byte stride between consecutive tiles.
+};
+
+/** Per-field locations of the tile storage, valid for either storage layout. */
+struct MapTileColumns {
+	MapTileColumn type;   ///< Tile::type
+	MapTileColumn height; ///< Tile::height
+	MapTileColumn m2;     ///< Tile::m2
+	MapTileColumn m1;     ///< Tile::m1
+	MapTileColumn m3;     ///< Tile::m3
+	MapTileColumn m4;     ///< Tile::m4
+	MapTileColumn m5;     ///< Tile::m5
+	MapTileColumn m6;     ///< TileExtended::m6
+	MapTileColumn m7;     ///< TileExtended::m7
+	MapTileColumn m8;     ///< TileExtended::m8
+};
+
+extern MapTileColumns _map_cols;
+extern MapStorageMode _map_storage_mode;
+
+/**
+ * Get a reference to a tile field, independent of the storage layout.
+ * @tparam T the type of the field
+ * @param col the column of the field
+ * @param tile the tile to get the field of
+ * @return reference to the field
+ */
+template <typename T>
+static inline T &MapTileField(const MapTileColumn &col, TileIndex tile)
+{
+	return *reinterpret_cast<T *>(col.base + ((size_t)tile << col.shift));
+}
 
 /**
- * Pointer to the extended tile-array.
+ * Reference to the base fields of a single tile.
  *
- * This variable points to the extended tile-array which contains the tiles
- * of the map.
+ * This provides the same field names as #Tile, so that existing
+ * <tt>_m[tile].field</tt> accesses work with either storage layout.
+ */
+struct TileBaseRef {
+	byte &type;    ///< See Tile::type.
+	byte &height;  ///< See Tile::height.
+	uint16 &m2;    ///< See Tile::m2.
+	byte &m1;      ///< See Tile::m1.
+	byte &m3;      ///< See Tile::m3.
+	byte &m4;      ///< See Tile::m4.
+	byte &m5;      ///< See Tile::m5.
+
+	inline TileBaseRef(TileIndex tile) :
+		type(MapTileField<byte>(_map_cols.type, tile)),
+		height(MapTileField<byte>(_map_cols.height, tile)),
+		m2(MapTileField<uint16>(_map_cols.m2, tile)),
+		m1(MapTileField<byte>(_map_cols.m1, tile)),
+		m3(MapTileField<byte>(_map_cols.m3, tile)),
+		m4(MapTileField<byte>(_map_cols.m4, tile)),
+		m5(MapTileField<byte>(_map_cols.m5, tile)) {}
+};
+
+/** Reference to the extended fields of a single tile, see #TileBaseRef. */
+struct TileExtendedRef {
+	byte &m6;   ///< See TileExtended::m6.
+	byte &m7;   ///< See TileExtended::m7.
+	uint16 &m8; ///< See TileExtended::m8.
+
+	inline TileExtendedRef(TileIndex tile) :
+		m6(MapTileField<byte>(_map_cols.m6, tile)),
+		m7(MapTileField<byte>(_map_cols.m7, tile)),
+		m8(MapTileField<uint16>(_map_cols.m8, tile)) {}
+};
+
+/**
+ * Accessor for the tile-array.
+ *
+ * This provides access to the base fields of all tiles of the map,
+ * regardless of the storage layout selected in AllocateMap().
  */
-extern TileExtended *_me;
+struct MapTileArray {
+	inline TileBaseRef operator[](TileIndex tile) const { return TileBaseRef(tile); }
+
+	/** Is the map allocated at all? */
+	inline bool IsAllocated() const { return _map_cols.type.base != nullptr; }
+
+	/** Get an address suitable for prefetching the given tile's base fields. */
+	inline const byte *PrefetchPtr(TileIndex tile) const
+	{
+		return _map_cols.type.base + ((size_t)tile << _map_cols.type.shift);
+	}
+};
+
+/** Accessor for the extended tile-array, see #MapTileArray. */
+struct MapTileExtendedArray {
+	inline TileExtendedRef operator[](TileIndex tile) const { return TileExtendedRef(tile); }
+};
+
+extern MapTileArray _m;
+extern MapTileExtendedArray _me;
 
 bool ValidateMapSize(uint size_x, uint size_y);
 void AllocateMap(uint size_x, uint size_y);
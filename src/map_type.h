@@ -36,6 +36,19 @@ struct TileExtended {
 	uint16 m8; ///< General purpose
 };
 
+/**
+ * Storage layout of the tile arrays, selected when the map is allocated.
+ *
+ * The interleaved layout keeps all fields of a tile together (one #Tile and
+ * one #TileExtended per tile); the columnar layout stores each field in its
+ * own contiguous array so field-selective sweeps only stream the bytes they
+ * actually read.
+ */
+enum MapStorageMode : byte {
+	MSM_INTERLEAVED, ///< Classic array-of-struct layout.
+	MSM_COLUMNAR,    ///< Structure-of-arrays layout: one array per tile field.
+};
+
 /**
  * An offset value between two tiles.
  *
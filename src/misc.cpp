@@ -36,6 +36,7 @@
 #include "bridge_signal_map.h"
 #include "command_func.h"
 #include "zoning.h"
+#include "pathfinder/water_regions.h"
 #include "cargopacket.h"
 #include "tbtr_template_vehicle_func.h"
 #include "event_logs.h"
@@ -131,6 +132,7 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 	RebuildStationKdtree();
 	RebuildTownKdtree();
 	RebuildViewportKdtree();
+	RebuildStationsWithLoadingVehiclesSet();
 
 	FreeSignalPrograms();
 	FreeSignalDependencies();
@@ -138,6 +140,7 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 	ClearAllSignalSpeedRestrictions();
 
 	ClearZoningCaches();
+	InitializeWaterRegions();
 	IntialiseOrderDestinationRefcountMap();
 
 	ResetPersistentNewGRFData();
@@ -0,0 +1,300 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file dary_heap.hpp D-ary heap implementation with inline sort keys. */
+
+#ifndef DARY_HEAP_HPP
+#define DARY_HEAP_HPP
+
+#include "../core/alloc_func.hpp"
+
+/** Enable it if you suspect the d-ary heap doesn't work well */
+#define DARYHEAP_CHECK 0
+
+#if DARYHEAP_CHECK
+	/** Check for consistency. */
+#	define DARYHEAP_CHECK_CONSISTY() this->CheckConsistency()
+#else
+	/** Don't check for consistency. */
+#	define DARYHEAP_CHECK_CONSISTY() ;
+#endif
+
+/**
+ * D-ary min-heap as C++ template.
+ *  Works like CBinaryHeapT, but each entry stores its sort key inline next
+ *  to the item pointer, so sift operations compare keys without
+ *  dereferencing the items. Together with the wider fan-out this keeps the
+ *  hot part of large priority queues in far fewer cache lines, which
+ *  matters for the A-star open list where items live scattered in a big
+ *  node array.
+ *
+ * @par Implementation notes:
+ * Internally the first entry is never used, as in CBinaryHeapT.
+ * The key of an entry is fixed at insertion time; callers that change an
+ * item's key must remove and re-insert it.
+ *
+ * @tparam T      Type of the items stored in the heap
+ * @tparam Tarity Number of children per heap entry
+ */
+template <class T, uint Tarity = 4>
+class CDaryHeapT {
+	static_assert(Tarity >= 2);
+
+	/** One heap entry: the sort key and the item it belongs to. */
+	struct Entry {
+		int  key;  ///< sort key of the item, smaller is better
+		T   *item; ///< the item itself
+	};
+
+	uint items;    ///< Number of items in the heap
+	uint capacity; ///< Maximum number of items the heap can hold
+	Entry *data;   ///< The pointer to the heap entries
+
+public:
+	/**
+	 * Create a d-ary heap.
+	 * @param max_items The limit of the heap
+	 */
+	explicit CDaryHeapT(uint max_items)
+		: items(0)
+		, capacity(max_items)
+	{
+		this->data = MallocT<Entry>(max_items + 1);
+	}
+
+	~CDaryHeapT()
+	{
+		this->Clear();
+		free(this->data);
+		this->data = nullptr;
+	}
+
+protected:
+	/** Get the heap position of the first child of the given position. */
+	static inline uint FirstChild(uint gap)
+	{
+		return Tarity * (gap - 1) + 2;
+	}
+
+	/** Get the heap position of the parent of the given position. */
+	static inline uint Parent(uint child)
+	{
+		return (child - 2) / Tarity + 1;
+	}
+
+	/**
+	 * Get position for fixing a gap (downwards).
+	 *  The gap is moved downwards in the heap until it is in order again.
+	 *
+	 * @param gap The position of the gap
+	 * @param key The key of the proposed entry for filling the gap
+	 * @return The (gap)position where the entry fits
+	 */
+	inline uint HeapifyDown(uint gap, int key)
+	{
+		assert(gap != 0);
+
+		uint child = FirstChild(gap);
+
+		/* while children are valid */
+		while (child <= this->items) {
+			/* choose the smallest child */
+			uint last_child = std::min(child + Tarity - 1, this->items);
+			uint best = child;
+			for (child++; child <= last_child; child++) {
+				if (this->data[child].key < this->data[best].key) best = child;
+			}
+			/* is it smaller than our parent? */
+			if (this->data[best].key >= key) {
+				/* the smallest child is still bigger or same as parent => we are done */
+				break;
+			}
+			/* if smallest child is smaller than parent, it will become new parent */
+			this->data[gap] = this->data[best];
+			gap = best;
+			/* where do we have our new children? */
+			child = FirstChild(gap);
+		}
+		return gap;
+	}
+
+	/**
+	 * Get position for fixing a gap (upwards).
+	 *  The gap is moved upwards in the heap until it is in order again.
+	 *
+	 * @param gap The position of the gap
+	 * @param key The key of the proposed entry for filling the gap
+	 * @return The (gap)position where the entry fits
+	 */
+	inline uint HeapifyUp(uint gap, int key)
+	{
+		assert(gap != 0);
+
+		while (gap > 1) {
+			/* compare [gap] with its parent */
+			uint parent = Parent(gap);
+			if (key >= this->data[parent].key) {
+				/* we don't need to continue upstairs */
+				break;
+			}
+			this->data[gap] = this->data[parent];
+			gap = parent;
+		}
+		return gap;
+	}
+
+#if DARYHEAP_CHECK
+	/** Verify the heap consistency */
+	inline void CheckConsistency()
+	{
+		for (uint child = 2; child <= this->items; child++) {
+			assert(this->data[child].key >= this->data[Parent(child)].key);
+		}
+	}
+#endif
+
+public:
+	/**
+	 * Get the number of items stored in the priority queue.
+	 *
+	 *  @return The number of items in the queue
+	 */
+	inline uint Length() const
+	{
+		return this->items;
+	}
+
+	/**
+	 * Test if the priority queue is empty.
+	 *
+	 * @return True if empty
+	 */
+	inline bool IsEmpty() const
+	{
+		return this->items == 0;
+	}
+
+	/**
+	 * Test if the priority queue is full.
+	 *
+	 * @return True if full.
+	 */
+	inline bool IsFull() const
+	{
+		return this->items >= this->capacity;
+	}
+
+	/**
+	 * Get the smallest item in the heap.
+	 *
+	 * @return The smallest item, or throw assert if empty.
+	 */
+	inline T *Begin()
+	{
+		assert(!this->IsEmpty());
+		return this->data[1].item;
+	}
+
+	/**
+	 * Insert new item into the priority queue, maintaining heap order.
+	 *
+	 * @param new_item The pointer to the new item
+	 * @param key      The sort key of the new item
+	 */
+	inline void Include(T *new_item, int key)
+	{
+		if (this->IsFull()) {
+			assert(this->capacity < UINT_MAX / 2);
+
+			this->capacity *= 2;
+			this->data = ReallocT<Entry>(this->data, this->capacity + 1);
+		}
+
+		/* Make place for new item. A gap is now at the end of the heap. */
+		uint gap = this->HeapifyUp(++items, key);
+		this->data[gap] = { key, new_item };
+		DARYHEAP_CHECK_CONSISTY();
+	}
+
+	/**
+	 * Remove and return the smallest (and also first) item
+	 *  from the priority queue.
+	 *
+	 * @return The pointer to the removed item
+	 */
+	inline T *Shift()
+	{
+		assert(!this->IsEmpty());
+
+		T *first = this->Begin();
+
+		this->items--;
+		/* at index 1 we have a gap now */
+		Entry last = this->data[1 + this->items];
+		uint gap = this->HeapifyDown(1, last.key);
+		/* move last entry to the proper place */
+		if (!this->IsEmpty()) this->data[gap] = last;
+
+		DARYHEAP_CHECK_CONSISTY();
+		return first;
+	}
+
+	/**
+	 * Remove item at given index from the priority queue.
+	 *
+	 * @param index The position of the item in the heap
+	 */
+	inline void Remove(uint index)
+	{
+		if (index < this->items) {
+			assert(index != 0);
+			this->items--;
+			/* at position index we have a gap now */
+
+			Entry last = this->data[1 + this->items];
+			/* Fix heap up and downwards */
+			uint gap = this->HeapifyUp(index, last.key);
+			gap = this->HeapifyDown(gap, last.key);
+			/* move last entry to the proper place */
+			if (!this->IsEmpty()) this->data[gap] = last;
+		} else {
+			assert(index == this->items);
+			this->items--;
+		}
+		DARYHEAP_CHECK_CONSISTY();
+	}
+
+	/**
+	 * Search for an item in the priority queue.
+	 *  Matching is done by comparing address of the
+	 *  item.
+	 *
+	 * @param item The reference to the item
+	 * @return The index of the item or zero if not found
+	 */
+	inline uint FindIndex(const T &item) const
+	{
+		if (this->IsEmpty()) return 0;
+		for (const Entry *pE = this->data + 1, *pLast = pE + this->items; pE <= pLast; pE++) {
+			if (pE->item == &item) {
+				return (uint)(pE - this->data);
+			}
+		}
+		return 0;
+	}
+
+	/**
+	 * Make the priority queue empty.
+	 * All remaining items will remain untouched.
+	 */
+	inline void Clear()
+	{
+		this->items = 0;
+	}
+};
+
+#endif /* DARY_HEAP_HPP */
@@ -40,6 +40,15 @@ struct MixerChannel {
 	bool is16bit;
 };
 
+/**
+ * Bitmask of channels in use, and the lock-free handoff between the game and
+ * audio threads: the game thread picks a free channel (MxAllocateChannel reads
+ * with acquire semantics), fills in the channel state and only then publishes
+ * it with a release store in MxActivateChannel; the audio callback acquires
+ * the mask in MxMixSamples, so it never observes a half-initialised channel.
+ * Only the music stream callback pointer still needs a mutex, as the callback
+ * must not be torn down while the audio thread is inside it.
+ */
 static std::atomic<uint8> _active_channels;
 static MixerChannel _channels[8];
 static uint32 _play_rate = 11025;
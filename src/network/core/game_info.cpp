@@ -37,6 +37,8 @@ static const uint GITHASH_SUFFIX_LEN = 12;
 
 NetworkServerGameInfo _network_game_info; ///< Information about our game.
 
+static uint32 _network_game_info_generation = 1; ///< Bumped whenever the static part of #_network_game_info is (re-)filled.
+
 /**
  * Get the network version string used by this build.
  * The returned string is guaranteed to be at most NETWORK_REVISON_LENGTH bytes.
@@ -142,6 +144,8 @@ void FillStaticNetworkServerGameInfo()
 
 	_network_game_info.server_name = _settings_client.network.server_name;
 	_network_game_info.server_revision = GetNetworkRevisionString();
+
+	_network_game_info_generation++;
 }
 
 /**
@@ -161,6 +165,18 @@ const NetworkServerGameInfo *GetCurrentNetworkServerGameInfo()
 	return &_network_game_info;
 }
 
+/**
+ * Get the generation number of the static part of the server's game info,
+ * which changes whenever FillStaticNetworkServerGameInfo is called. Together
+ * with the dynamic fields of NetworkServerGameInfo this can be used to detect
+ * whether a serialised form of the game info is still up to date.
+ * @return The current generation number.
+ */
+uint32 GetNetworkServerGameInfoGeneration()
+{
+	return _network_game_info_generation;
+}
+
 /**
  * Function that is called for every GRFConfig that is read when receiving
  * a NetworkGameInfo. Only grfid and md5sum are set, the rest is zero. This
@@ -138,6 +138,7 @@ void CheckGameCompatibility(NetworkGameInfo &ngi, bool extended = false);
 
 void FillStaticNetworkServerGameInfo();
 const NetworkServerGameInfo *GetCurrentNetworkServerGameInfo();
+uint32 GetNetworkServerGameInfoGeneration();
 
 void DeserializeGRFIdentifier(Packet *p, GRFIdentifier *grf);
 void DeserializeGRFIdentifierWithName(Packet *p, NamedGRFIdentifier *grf);
@@ -56,11 +56,32 @@ void Packet::ResetState(PacketType type)
 	this->cs = nullptr;
 	this->buffer.clear();
 
+	/* Reserve a bit of space up front so typical small packets serialise without reallocating. */
+	if (this->buffer.capacity() < 32) this->buffer.reserve(32);
+
 	/* Allocate space for the the size so we can write that in just before sending the packet. */
 	this->Send_uint16(0);
 	this->Send_uint8(type);
 }
 
+/**
+ * Reset a previously used packet so it can be reused to read from a network socket,
+ * keeping the buffer storage that was already allocated for it.
+ * @param cs                The socket handler associated with the socket we are reading from.
+ * @param limit             The maximum size of packets to accept.
+ * @param initial_read_size The initial amount of data to transfer from the socket into the
+ *                          packet; see the receive constructor for details.
+ */
+void Packet::ResetReadState(NetworkSocketHandler *cs, size_t limit, size_t initial_read_size)
+{
+	assert(cs != nullptr);
+
+	this->cs = cs;
+	this->limit = limit;
+	this->pos = 0;
+	this->buffer.resize(initial_read_size);
+}
+
 /**
  * Writes the packet size from the raw packet from packet->size
  */
@@ -72,7 +93,6 @@ void Packet::PrepareToSend()
 	this->buffer[1] = GB(this->Size(), 8, 8);
 
 	this->pos  = 0; // We start reading from here
-	this->buffer.shrink_to_fit();
 }
 
 /**
@@ -92,6 +112,20 @@ void Packet::WriteAtOffset_uint16(size_t offset, uint16 data)
 	this->buffer[offset + 1] = GB(data, 8, 8);
 }
 
+/**
+ * Make a copy of this to-be-sent packet, e.g. so the same payload can be
+ * queued to more than one client. The copy still needs to go through
+ * PrepareToSend (via SendPacket) before it can be transferred.
+ * @return The copy of this packet.
+ */
+std::unique_ptr<Packet> Packet::Clone() const
+{
+	std::unique_ptr<Packet> p(new Packet(this->GetPacketType(), this->limit));
+	p->buffer = this->buffer;
+	p->pos = 0;
+	return p;
+}
+
 
 
 /*
@@ -20,6 +20,7 @@
 #include <string>
 #include <functional>
 #include <limits>
+#include <memory>
 
 typedef uint16 PacketSize; ///< Size of the whole packet.
 typedef uint8  PacketType; ///< Identifier for the packet
@@ -60,6 +61,7 @@ public:
 	Packet(PacketType type, size_t limit = COMPAT_MTU);
 
 	void ResetState(PacketType type);
+	void ResetReadState(NetworkSocketHandler *cs, size_t limit, size_t initial_read_size = sizeof(PacketSize));
 
 	/* Sending/writing of packets */
 	void PrepareToSend();
@@ -76,6 +78,8 @@ public:
 
 	void WriteAtOffset_uint16(size_t offset, uint16);
 
+	std::unique_ptr<Packet> Clone() const;
+
 	/* Reading/receiving of packets */
 	size_t ReadRawPacketSize() const;
 	bool HasPacketSizeData() const;
@@ -92,6 +96,16 @@ public:
 	PacketSize GetRawPos() const { return this->pos; }
 	void ReserveBuffer(size_t size) { this->buffer.reserve(size); }
 
+	/**
+	 * Advance the transfer position by the given number of bytes, which were
+	 * transferred externally (e.g. by a vectored send covering several packets).
+	 */
+	void AdvanceTransferPosition(size_t bytes)
+	{
+		assert(bytes <= this->RemainingBytesToTransfer());
+		this->pos += (PacketSize)bytes;
+	}
+
 	/**
 	 * Transfer data from the packet to the given function. It starts reading at the
 	 * position the last transfer stopped.
@@ -14,6 +14,10 @@
 
 #include "tcp.h"
 
+#if !defined(_WIN32)
+#	include <sys/uio.h>
+#endif
+
 #include "../../safeguards.h"
 
 /**
@@ -39,6 +43,7 @@ void NetworkTCPSocketHandler::EmptyPacketQueue()
 {
 	this->packet_queue.clear();
 	this->packet_recv.reset();
+	this->packet_spare.reset();
 }
 
 /**
@@ -133,6 +138,58 @@ SendPacketsState NetworkTCPSocketHandler::SendPackets(bool closing_down)
 	if (!this->IsConnected()) return SPS_CLOSED;
 
 	while (!this->packet_queue.empty()) {
+#if !defined(_WIN32)
+		if (this->packet_queue.size() > 1) {
+			/* Several packets are queued, gather them into a single syscall.
+			 * The packets are sent directly from their own buffers, no copying is involved. */
+			static const size_t MAX_IOVS = 32;
+			struct iovec iovs[MAX_IOVS];
+			size_t n = 0;
+			size_t total = 0;
+			for (const auto &qp : this->packet_queue) {
+				iovs[n].iov_base = const_cast<byte *>(qp->GetBufferData() + qp->GetRawPos());
+				iovs[n].iov_len = qp->RemainingBytesToTransfer();
+				total += iovs[n].iov_len;
+				if (++n == MAX_IOVS) break;
+			}
+			res = writev(this->sock, iovs, (int)n);
+			if (res == -1) {
+				NetworkError err = NetworkError::GetLast();
+				if (!err.WouldBlock()) {
+					/* Something went wrong.. close client! */
+					if (!closing_down) {
+						DEBUG(net, 0, "Send failed: %s", err.AsString());
+						this->CloseConnection();
+					}
+					return SPS_CLOSED;
+				}
+				return SPS_PARTLY_SENT;
+			}
+			if (res == 0) {
+				/* Client/server has left us :( */
+				if (!closing_down) this->CloseConnection();
+				return SPS_CLOSED;
+			}
+
+			/* Advance/pop the packets covered by the write */
+			size_t sent = (size_t)res;
+			while (sent > 0) {
+				Packet *qp = this->packet_queue.front().get();
+				size_t remaining = qp->RemainingBytesToTransfer();
+				if (sent < remaining) {
+					qp->AdvanceTransferPosition(sent);
+					break;
+				}
+				qp->AdvanceTransferPosition(remaining);
+				sent -= remaining;
+				if (_debug_net_level >= 5) this->LogSentPacket(*qp);
+				this->packet_queue.pop_front();
+			}
+			/* A short write means the OS buffer is full, don't try again now */
+			if ((size_t)res < total) return SPS_PARTLY_SENT;
+			continue;
+		}
+#endif
 		Packet *p = this->packet_queue.front().get();
 		res = p->TransferOut<int>(send, this->sock, 0);
 		if (res == -1) {
@@ -177,7 +234,13 @@ std::unique_ptr<Packet> NetworkTCPSocketHandler::ReceivePacket()
 	if (!this->IsConnected()) return nullptr;
 
 	if (this->packet_recv == nullptr) {
-		this->packet_recv.reset(new Packet(this, SHRT_MAX));
+		if (this->packet_spare != nullptr) {
+			/* Reuse a recycled packet object instead of allocating a new one. */
+			this->packet_spare->ResetReadState(this, SHRT_MAX);
+			this->packet_recv = std::move(this->packet_spare);
+		} else {
+			this->packet_recv.reset(new Packet(this, SHRT_MAX));
+		}
 	}
 
 	Packet *p = this->packet_recv.get();
@@ -240,6 +303,17 @@ std::unique_ptr<Packet> NetworkTCPSocketHandler::ReceivePacket()
 	return std::move(this->packet_recv);
 }
 
+/**
+ * Hand a received packet back to this socket handler for reuse by a later
+ * ReceivePacket call. As the buffer storage of the packet is kept, this makes
+ * steady-state packet reception free of allocations.
+ * @param packet The packet to recycle, may be nullptr.
+ */
+void NetworkTCPSocketHandler::ReturnReceivedPacket(std::unique_ptr<Packet> packet)
+{
+	this->packet_spare = std::move(packet);
+}
+
 void NetworkTCPSocketHandler::LogSentPacket(const Packet &pkt) {}
 
 /**
@@ -38,6 +38,7 @@ class NetworkTCPSocketHandler : public NetworkSocketHandler {
 private:
 	std::deque<std::unique_ptr<Packet>> packet_queue; ///< Packets that are awaiting delivery
 	std::unique_ptr<Packet> packet_recv;              ///< Partially received packet
+	std::unique_ptr<Packet> packet_spare;             ///< Spare packet object for reuse by the receive path
 
 	void EmptyPacketQueue();
 public:
@@ -64,6 +65,7 @@ public:
 	SendPacketsState SendPackets(bool closing_down = false);
 
 	virtual std::unique_ptr<Packet> ReceivePacket();
+	void ReturnReceivedPacket(std::unique_ptr<Packet> packet);
 	virtual void LogSentPacket(const Packet &pkt);
 
 	bool CanSendReceive();
@@ -74,6 +76,9 @@ public:
 	 */
 	bool HasSendQueue() { return !this->packet_queue.empty(); }
 
+	/** Get the number of packets still awaiting delivery. */
+	size_t GetSendQueueLength() const { return this->packet_queue.size(); }
+
 	NetworkTCPSocketHandler(SOCKET s = INVALID_SOCKET);
 	~NetworkTCPSocketHandler();
 };
@@ -85,6 +85,7 @@ NetworkRecvStatus NetworkAdminSocketHandler::HandlePacket(Packet *p)
 		case ADMIN_PACKET_SERVER_CMD_LOGGING:     return this->Receive_SERVER_CMD_LOGGING(p);
 		case ADMIN_PACKET_SERVER_RCON_END:        return this->Receive_SERVER_RCON_END(p);
 		case ADMIN_PACKET_SERVER_PONG:            return this->Receive_SERVER_PONG(p);
+		case ADMIN_PACKET_SERVER_TELEMETRY:       return this->Receive_SERVER_TELEMETRY(p);
 
 		default:
 			if (this->HasClientQuit()) {
@@ -111,6 +112,7 @@ NetworkRecvStatus NetworkAdminSocketHandler::ReceivePackets()
 	while ((p = this->ReceivePacket()) != nullptr) {
 		NetworkRecvStatus res = this->HandlePacket(p.get());
 		if (res != NETWORK_RECV_STATUS_OKAY) return res;
+		this->ReturnReceivedPacket(std::move(p));
 	}
 
 	return NETWORK_RECV_STATUS_OKAY;
@@ -164,3 +166,4 @@ NetworkRecvStatus NetworkAdminSocketHandler::Receive_SERVER_CMD_NAMES(Packet *p)
 NetworkRecvStatus NetworkAdminSocketHandler::Receive_SERVER_CMD_LOGGING(Packet *p) { return this->ReceiveInvalidPacket(ADMIN_PACKET_SERVER_CMD_LOGGING); }
 NetworkRecvStatus NetworkAdminSocketHandler::Receive_SERVER_RCON_END(Packet *p) { return this->ReceiveInvalidPacket(ADMIN_PACKET_SERVER_RCON_END); }
 NetworkRecvStatus NetworkAdminSocketHandler::Receive_SERVER_PONG(Packet *p) { return this->ReceiveInvalidPacket(ADMIN_PACKET_SERVER_PONG); }
+NetworkRecvStatus NetworkAdminSocketHandler::Receive_SERVER_TELEMETRY(Packet *p) { return this->ReceiveInvalidPacket(ADMIN_PACKET_SERVER_TELEMETRY); }
@@ -70,6 +70,7 @@ bool NetworkCoordinatorSocketHandler::ReceivePackets()
 	while (--i != 0 && (p = this->ReceivePacket()) != nullptr) {
 		bool cont = this->HandlePacket(p.get());
 		if (!cont) return true;
+		this->ReturnReceivedPacket(std::move(p));
 	}
 
 	return i != MAX_PACKETS_TO_RECEIVE - 1;
@@ -214,6 +214,7 @@ NetworkRecvStatus NetworkGameSocketHandler::ReceivePackets()
 	while ((p = this->ReceivePacket()) != nullptr) {
 		NetworkRecvStatus res = HandlePacket(p.get());
 		if (res != NETWORK_RECV_STATUS_OKAY) return res;
+		this->ReturnReceivedPacket(std::move(p));
 	}
 
 	return NETWORK_RECV_STATUS_OKAY;
@@ -49,6 +49,7 @@ bool NetworkTurnSocketHandler::ReceivePackets()
 	while (--i != 0 && (p = this->ReceivePacket()) != nullptr) {
 		bool cont = this->HandlePacket(p.get());
 		if (!cont) return true;
+		this->ReturnReceivedPacket(std::move(p));
 	}
 
 	return i != MAX_PACKETS_TO_RECEIVE - 1;
@@ -44,11 +44,15 @@
 
 #include "../safeguards.h"
 
-#ifdef DEBUG_DUMP_COMMANDS
-#include "../fileio_func.h"
 /** When running the server till the wait point, run as fast as we can! */
-bool _ddc_fastforward = true;
-#endif /* DEBUG_DUMP_COMMANDS */
+bool _ddc_fastforward = false;
+std::string _replay_command_log_file;
+
+/** Whether a command log is being replayed, see '-replay'. */
+bool IsReplayingCommands()
+{
+	return !_replay_command_log_file.empty();
+}
 
 /** Make sure both pools have the same size. */
 static_assert(NetworkClientInfoPool::MAX_SIZE == NetworkClientSocketPool::MAX_SIZE);
@@ -83,6 +87,7 @@ uint32 _sync_seed_1;                  ///< Seed to compare during sync checks.
 uint32 _sync_seed_2;                  ///< Second part of the seed.
 #endif
 uint64 _sync_state_checksum;          ///< State checksum to compare during sync checks.
+uint64 _sync_subsystem_state_checksums[SCA_END]; ///< Per-subsystem state checksums of the sync frame.
 uint32 _sync_frame;                   ///< The frame to perform the sync check.
 Date   _last_sync_date;               ///< The game date of the last successfully received sync frame
 DateFract _last_sync_date_fract;      ///< "
@@ -853,6 +858,9 @@ void NetworkClientJoinGame()
 
 static void NetworkInitGameInfo()
 {
+	/* Any cached map dump belongs to the previous game. */
+	NetworkServerInvalidateMapDumpCache();
+
 	FillStaticNetworkServerGameInfo();
 	/* The server is a client too */
 	_network_game_info.clients_on = _network_dedicated ? 0 : 1;
@@ -1101,111 +1109,120 @@ void NetworkGameLoop()
 			}
 		}
 
-#ifdef DEBUG_DUMP_COMMANDS
-		/* Loading of the debug commands from -ddesync>=1 */
-		static FILE *f = FioFOpenFile("commands.log", "rb", SAVE_DIR);
-		static Date next_date = 0;
-		static uint32 next_date_fract;
-		static uint8 next_tick_skip_counter;
-		static std::unique_ptr<CommandPacket> cp;
-		static bool check_sync_state = false;
-		static uint32 sync_state[2];
-		if (f == nullptr && next_date == 0) {
-			DEBUG(desync, 0, "Cannot open commands.log");
-			next_date = 1;
-		}
+		if (IsReplayingCommands()) {
+			/* Loading of the debug commands recorded with -ddesync>=1, see '-replay' */
+			static FILE *f = fopen(_replay_command_log_file.c_str(), "rb");
+			static Date next_date = 0;
+			static uint32 next_date_fract;
+			static uint8 next_tick_skip_counter;
+			static std::unique_ptr<CommandPacket> cp;
+			static bool check_sync_state = false;
+			static uint32 sync_state[2];
+			if (f == nullptr && next_date == 0) {
+				DEBUG(desync, 0, "Cannot open replay log %s", _replay_command_log_file.c_str());
+				next_date = 1;
+			} else if (next_date == 0) {
+				/* Run as fast as we can until the log has been replayed or a join point is reached. */
+				_ddc_fastforward = true;
+			}
 
-		while (f != nullptr && !feof(f)) {
-			if (_date == next_date && _date_fract == next_date_fract) {
-				if (cp != nullptr) {
-					NetworkSendCommand(cp->tile, cp->p1, cp->p2, cp->p3, cp->cmd & ~CMD_FLAGS_MASK, nullptr, cp->text.c_str(), cp->company, cp->aux_data);
-					DEBUG(net, 0, "injecting: date{%08x; %02x; %02x}; %02x; %06x; %08x; %08x; " OTTD_PRINTFHEX64PAD " %08x; \"%s\" (%x) (%s)", _date, _date_fract, _tick_skip_counter, (int)_current_company, cp->tile, cp->p1, cp->p2, cp->p3, cp->cmd, cp->text.c_str(), cp->binary_length, GetCommandName(cp->cmd));
-					cp.reset();
-				}
-				if (check_sync_state) {
-					if (sync_state[0] == _random.state[0] && sync_state[1] == _random.state[1]) {
-						DEBUG(net, 0, "sync check: date{%08x; %02x; %02x}; match", _date, _date_fract, _tick_skip_counter);
-					} else {
-						DEBUG(net, 0, "sync check: date{%08x; %02x; %02x}; mismatch expected {%08x, %08x}, got {%08x, %08x}",
-									_date, _date_fract, _tick_skip_counter, sync_state[0], sync_state[1], _random.state[0], _random.state[1]);
-						NOT_REACHED();
+			while (f != nullptr && !feof(f)) {
+				if (_date == next_date && _date_fract == next_date_fract) {
+					if (cp != nullptr) {
+						NetworkSendCommand(cp->tile, cp->p1, cp->p2, cp->p3, cp->cmd & ~CMD_FLAGS_MASK, nullptr, cp->text.c_str(), cp->company, cp->aux_data.get());
+						DEBUG(net, 0, "injecting: date{%08x; %02x; %02x}; %02x; %06x; %08x; %08x; " OTTD_PRINTFHEX64PAD " %08x; \"%s\" (%s)", _date, _date_fract, _tick_skip_counter, (int)_current_company, cp->tile, cp->p1, cp->p2, cp->p3, cp->cmd, cp->text.c_str(), GetCommandName(cp->cmd));
+						cp.reset();
+					}
+					if (check_sync_state) {
+						if (sync_state[0] == _random.state[0] && sync_state[1] == _random.state[1]) {
+							DEBUG(net, 0, "sync check: date{%08x; %02x; %02x}; match", _date, _date_fract, _tick_skip_counter);
+						} else {
+							DEBUG(net, 0, "sync check: date{%08x; %02x; %02x}; mismatch expected {%08x, %08x}, got {%08x, %08x}",
+										_date, _date_fract, _tick_skip_counter, sync_state[0], sync_state[1], _random.state[0], _random.state[1]);
+							NOT_REACHED();
+						}
+						check_sync_state = false;
 					}
-					check_sync_state = false;
 				}
-			}
 
-			if (cp != nullptr || check_sync_state) break;
+				if (cp != nullptr || check_sync_state) break;
 
-			char buff[4096];
-			if (fgets(buff, lengthof(buff), f) == nullptr) break;
+				char buff[4096];
+				if (fgets(buff, lengthof(buff), f) == nullptr) break;
 
-			char *p = buff;
-			/* Ignore the "[date time] " part of the message */
-			if (*p == '[') {
-				p = strchr(p, ']');
-				if (p == nullptr) break;
-				p += 2;
-			}
+				char *p = buff;
+				/* Ignore the "[date time] " part of the message */
+				if (*p == '[') {
+					p = strchr(p, ']');
+					if (p == nullptr) break;
+					p += 2;
+				}
 
-			if (strncmp(p, "cmd: ", 5) == 0
+				if (strncmp(p, "cmd: ", 5) == 0
 #ifdef DEBUG_FAILED_DUMP_COMMANDS
-				|| strncmp(p, "cmdf: ", 6) == 0
+					|| strncmp(p, "cmdf: ", 6) == 0
 #endif
-				) {
-				p += 5;
-				if (*p == ' ') p++;
-				cp.reset(new CommandPacket());
-				int company;
-				cp->text.resize(MAX_CMD_TEXT_LENGTH);
-				static_assert(MAX_CMD_TEXT_LENGTH > 8192);
-				int ret = sscanf(p, "date{%x; %x; %x}; company: %x; tile: %x (%*u x %*u); p1: %x; p2: %x; p3: " OTTD_PRINTFHEX64 "; cmd: %x; \"%8192[^\"]\"",
-						&next_date, &next_date_fract, &next_tick_skip_counter, &company, &cp->tile, &cp->p1, &cp->p2, &cp->p3, &cp->cmd, cp->text.data());
-				/* There are 10 pieces of data to read, however the last is a
-				 * string that might or might not exist. Ignore it if that
-				 * string misses because in 99% of the time it's not used. */
-				assert(ret == 10 || ret == 9);
-				cp->company = (CompanyID)company;
-				cp->aux_data = nullptr;
-			} else if (strncmp(p, "join: ", 6) == 0) {
-				/* Manually insert a pause when joining; this way the client can join at the exact right time. */
-				int ret = sscanf(p + 6, "date{%x; %x; %x}", &next_date, &next_date_fract, &next_tick_skip_counter);
-				assert(ret == 3);
-				DEBUG(net, 0, "injecting pause for join at date{%08x; %02x; %02x}; please join when paused", next_date, next_date_fract, next_tick_skip_counter);
-				cp.reset(new CommandPacket());
-				cp->tile = 0;
-				cp->company = COMPANY_SPECTATOR;
-				cp->cmd = CMD_PAUSE;
-				cp->p1 = PM_PAUSED_NORMAL;
-				cp->p2 = 1;
-				cp->p3 = 0;
-				cp->callback = nullptr;
-				cp->aux_data = nullptr;
-				_ddc_fastforward = false;
-			} else if (strncmp(p, "sync: ", 6) == 0) {
-				int ret = sscanf(p + 6, "date{%x; %x; %x}; %x; %x", &next_date, &next_date_fract, &next_tick_skip_counter, &sync_state[0], &sync_state[1]);
-				assert(ret == 5);
-				check_sync_state = true;
-			} else if (strncmp(p, "msg: ", 5) == 0 || strncmp(p, "client: ", 8) == 0 ||
-						strncmp(p, "load: ", 6) == 0 || strncmp(p, "save: ", 6) == 0 ||
-						strncmp(p, "new_company: ", 13) == 0 || strncmp(p, "new_company_ai: ", 16) == 0 ||
-						strncmp(p, "buy_company: ", 13) == 0 || strncmp(p, "delete_company: ", 16) == 0) {
-				/* A message that is not very important to the log playback, but part of the log. */
+					) {
+					p += 5;
+					if (*p == ' ') p++;
+					cp.reset(new CommandPacket());
+					int company;
+					cp->text.resize(MAX_CMD_TEXT_LENGTH);
+					static_assert(MAX_CMD_TEXT_LENGTH > 8192);
+					int ret = sscanf(p, "date{%x; %x; %x}; company: %x; tile: %x (%*u x %*u); p1: %x; p2: %x; p3: " OTTD_PRINTFHEX64 "; cmd: %x; \"%8192[^\"]\"",
+							&next_date, &next_date_fract, &next_tick_skip_counter, &company, &cp->tile, &cp->p1, &cp->p2, &cp->p3, &cp->cmd, cp->text.data());
+					/* There are 10 pieces of data to read, however the last is a
+					 * string that might or might not exist. Ignore it if that
+					 * string misses because in 99% of the time it's not used. */
+					assert(ret == 10 || ret == 9);
+					cp->company = (CompanyID)company;
+					cp->aux_data = nullptr;
+				} else if (strncmp(p, "join: ", 6) == 0) {
+					/* Manually insert a pause when joining; this way the client can join at the exact right time. */
+					int ret = sscanf(p + 6, "date{%x; %x; %x}", &next_date, &next_date_fract, &next_tick_skip_counter);
+					assert(ret == 3);
+					DEBUG(net, 0, "injecting pause for join at date{%08x; %02x; %02x}; please join when paused", next_date, next_date_fract, next_tick_skip_counter);
+					cp.reset(new CommandPacket());
+					cp->tile = 0;
+					cp->company = COMPANY_SPECTATOR;
+					cp->cmd = CMD_PAUSE;
+					cp->p1 = PM_PAUSED_NORMAL;
+					cp->p2 = 1;
+					cp->p3 = 0;
+					cp->callback = nullptr;
+					cp->aux_data = nullptr;
+					_ddc_fastforward = false;
+				} else if (strncmp(p, "sync: ", 6) == 0) {
+					int ret = sscanf(p + 6, "date{%x; %x; %x}; %x; %x", &next_date, &next_date_fract, &next_tick_skip_counter, &sync_state[0], &sync_state[1]);
+					assert(ret == 5);
+					check_sync_state = true;
+				} else if (strncmp(p, "msg: ", 5) == 0 || strncmp(p, "client: ", 8) == 0 ||
+							strncmp(p, "load: ", 6) == 0 || strncmp(p, "save: ", 6) == 0 ||
+							strncmp(p, "new_company: ", 13) == 0 || strncmp(p, "new_company_ai: ", 16) == 0 ||
+							strncmp(p, "buy_company: ", 13) == 0 || strncmp(p, "delete_company: ", 16) == 0) {
+					/* A message that is not very important to the log playback, but part of the log. */
 #ifndef DEBUG_FAILED_DUMP_COMMANDS
-			} else if (strncmp(p, "cmdf: ", 6) == 0) {
-				DEBUG(desync, 0, "Skipping replay of failed command: %s", p + 6);
+				} else if (strncmp(p, "cmdf: ", 6) == 0) {
+					DEBUG(desync, 0, "Skipping replay of failed command: %s", p + 6);
 #endif
-			} else {
-				/* Can't parse a line; what's wrong here? */
-				DEBUG(desync, 0, "Trying to parse: %s", p);
-				NOT_REACHED();
+				} else {
+					/* Can't parse a line; what's wrong here? */
+					DEBUG(desync, 0, "Trying to parse: %s", p);
+					NOT_REACHED();
+				}
+			}
+			if (f != nullptr && feof(f)) {
+				DEBUG(desync, 0, "End of replay log %s", _replay_command_log_file.c_str());
+				fclose(f);
+				f = nullptr;
+				_ddc_fastforward = false;
+
+				/* Dump the per-subsystem duration percentiles collected over the
+				 * replayed ticks, for profiling recorded incidents offline. */
+				extern void ConPrintFramerateHistogram();
+				ConPrintFramerateHistogram();
 			}
 		}
-		if (f != nullptr && feof(f)) {
-			DEBUG(desync, 0, "End of commands.log");
-			fclose(f);
-			f = nullptr;
-		}
-#endif /* DEBUG_DUMP_COMMANDS */
 		if (_frame_counter >= _frame_counter_max) {
 			/* Only check for active clients just before we're going to send out
 			 * the commands so we don't send multiple pause/unpause commands when
@@ -1236,6 +1253,9 @@ void NetworkGameLoop()
 		_sync_seed_2 = _random.state[1];
 #endif
 		_sync_state_checksum = _state_checksum.state;
+		for (uint i = 0; i < SCA_END; i++) {
+			_sync_subsystem_state_checksums[i] = _subsystem_state_checksums[i].state;
+		}
 
 		(*_network_server_sync_records)[_network_server_sync_records_next] = { _frame_counter, _random.state[0], _state_checksum.state };
 		_network_server_sync_records_next = (_network_server_sync_records_next + 1) % _network_server_sync_records->size();
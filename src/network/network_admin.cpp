@@ -18,8 +18,11 @@
 #include "../company_base.h"
 #include "../console_func.h"
 #include "../core/pool_func.hpp"
+#include "../framerate_type.h"
 #include "../map_func.h"
 #include "../rev.h"
+#include "../station_base.h"
+#include "../vehicle_base.h"
 #include "../game/game.hpp"
 
 #include "../safeguards.h"
@@ -53,6 +56,7 @@ static const AdminUpdateFrequency _admin_update_type_frequencies[] = {
 	ADMIN_FREQUENCY_POLL,                                                                                                                                  ///< ADMIN_UPDATE_CMD_NAMES
 	                       ADMIN_FREQUENCY_AUTOMATIC,                                                                                                      ///< ADMIN_UPDATE_CMD_LOGGING
 	                       ADMIN_FREQUENCY_AUTOMATIC,                                                                                                      ///< ADMIN_UPDATE_GAMESCRIPT
+	ADMIN_FREQUENCY_POLL | ADMIN_FREQUENCY_DAILY | ADMIN_FREQUENCY_WEEKLY | ADMIN_FREQUENCY_MONTHLY | ADMIN_FREQUENCY_QUARTERLY | ADMIN_FREQUENCY_ANUALLY, ///< ADMIN_UPDATE_TELEMETRY
 };
 /** Sanity check. */
 static_assert(lengthof(_admin_update_type_frequencies) == ADMIN_UPDATE_END);
@@ -213,6 +217,41 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendDate()
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** Number of still-unsent packets above which telemetry frames are dropped rather than queued. */
+static const size_t ADMIN_TELEMETRY_MAX_BACKLOG = 8;
+
+/**
+ * Send a compact telemetry frame: frame counter, game loop time, global
+ * vehicle/station counts and per-company money and loan.
+ *
+ * When the connection is backed up the frame is dropped instead of growing
+ * the send queue: every frame is a complete snapshot, so a fresher frame
+ * always supersedes anything that would have queued behind the backlog, and
+ * the game thread never blocks or accumulates memory on a slow admin pipe.
+ */
+NetworkRecvStatus ServerNetworkAdminSocketHandler::SendTelemetry()
+{
+	if (this->GetSendQueueLength() >= ADMIN_TELEMETRY_MAX_BACKLOG) return NETWORK_RECV_STATUS_OKAY;
+
+	Packet *p = new Packet(ADMIN_PACKET_SERVER_TELEMETRY);
+
+	p->Send_uint32(_frame_counter);
+	p->Send_uint32((uint32)(GetAverageGameLoopDurationMilliseconds(8) * 1000)); // in microseconds
+	p->Send_uint32((uint32)Vehicle::GetNumItems());
+	p->Send_uint32((uint32)Station::GetNumItems());
+
+	p->Send_uint8((uint8)Company::GetNumItems());
+	for (const Company *company : Company::Iterate()) {
+		p->Send_uint8(company->index);
+		p->Send_uint64(company->money);
+		p->Send_uint64(company->current_loan);
+	}
+
+	this->SendPacket(p);
+
+	return NETWORK_RECV_STATUS_OKAY;
+}
+
 /**
  * Tell the admin that a client joined.
  * @param client_id The client that joined.
@@ -483,6 +522,9 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendRconEnd(const std::string
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** Maximum number of packets the send queue may hold before further rcon output to the admin is dropped. */
+static const size_t MAX_RCON_RESULT_QUEUE_LENGTH = 1024;
+
 /**
  * Send the reply of an rcon command.
  * @param colour The colour of the text.
@@ -490,6 +532,10 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::SendRconEnd(const std::string
  */
 NetworkRecvStatus ServerNetworkAdminSocketHandler::SendRcon(uint16 colour, const std::string_view result)
 {
+	/* Bound the send queue towards slow admin connections; excess rcon output
+	 * is dropped rather than buffered indefinitely. */
+	if (this->GetSendQueueLength() >= MAX_RCON_RESULT_QUEUE_LENGTH) return NETWORK_RECV_STATUS_OKAY;
+
 	Packet *p = new Packet(ADMIN_PACKET_SERVER_RCON);
 
 	p->Send_uint16(colour);
@@ -755,6 +801,11 @@ NetworkRecvStatus ServerNetworkAdminSocketHandler::Receive_ADMIN_POLL(Packet *p)
 			this->SendCmdNames();
 			break;
 
+		case ADMIN_UPDATE_TELEMETRY:
+			/* The admin is requesting a telemetry frame. */
+			this->SendTelemetry();
+			break;
+
 		default:
 			/* An unsupported "poll" update type. */
 			DEBUG(net, 1, "[admin] Not supported poll %d (%d) from '%s' (%s).", type, d1, this->admin_name.c_str(), this->admin_version.c_str());
@@ -1022,6 +1073,10 @@ void NetworkAdminUpdate(AdminUpdateFrequency freq)
 						as->SendCompanyStats();
 						break;
 
+					case ADMIN_UPDATE_TELEMETRY:
+						as->SendTelemetry();
+						break;
+
 					default: NOT_REACHED();
 				}
 			}
@@ -50,6 +50,7 @@ public:
 	NetworkRecvStatus SendShutdown();
 
 	NetworkRecvStatus SendDate();
+	NetworkRecvStatus SendTelemetry();
 	NetworkRecvStatus SendClientJoin(ClientID client_id);
 	NetworkRecvStatus SendClientInfo(const NetworkClientSocket *cs, const NetworkClientInfo *ci);
 	NetworkRecvStatus SendClientUpdate(const NetworkClientInfo *ci);
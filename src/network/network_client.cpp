@@ -317,7 +317,20 @@ void ClientNetworkGameSocketHandler::ClientError(NetworkRecvStatus res)
 				if (_sync_seed_2 != _random.state[1]) info.flags |= DesyncExtraInfo::DEIF_RAND2;
 				info.flags |= DesyncExtraInfo::DEIF_DBL_RAND;
 #endif
-				if (_sync_state_checksum != _state_checksum.state) info.flags |= DesyncExtraInfo::DEIF_STATE;
+				if (_sync_state_checksum != _state_checksum.state) {
+					info.flags |= DesyncExtraInfo::DEIF_STATE;
+
+					/* The per-subsystem digests cover only the sync frame, so they
+					 * localise the mismatch to the subsystems that diverged there. */
+					static const char * const area_names[] = { "vehicles", "towns", "economy" };
+					static_assert(lengthof(area_names) == SCA_END);
+					for (uint i = 0; i < SCA_END; i++) {
+						if (_sync_subsystem_state_checksums[i] != _subsystem_state_checksums[i].state) {
+							DEBUG(desync, 1, "sync_err: %s state checksum mismatch: " OTTD_PRINTFHEX64 " != " OTTD_PRINTFHEX64,
+									area_names[i], _sync_subsystem_state_checksums[i], _subsystem_state_checksums[i].state);
+						}
+					}
+				}
 
 				ShowNetworkError(STR_NETWORK_ERROR_DESYNC);
 				DEBUG(desync, 1, "sync_err: date{%08x; %02x; %02x} {%x, " OTTD_PRINTFHEX64 "} != {%x, " OTTD_PRINTFHEX64 "}"
@@ -1019,9 +1032,9 @@ NetworkRecvStatus ClientNetworkGameSocketHandler::Receive_SERVER_FRAME(Packet *p
 	/* Test if the server supports this option
 	 *  and if we are at the frame the server is */
 #ifdef NETWORK_SEND_DOUBLE_SEED
-	if (p->CanReadFromPacket(4 + 4 + 8)) {
+	if (p->CanReadFromPacket(4 + 4 + 8 + 8 * SCA_END)) {
 #else
-	if (p->CanReadFromPacket(4 + 8)) {
+	if (p->CanReadFromPacket(4 + 8 + 8 * SCA_END)) {
 #endif
 		_sync_frame = _frame_counter_server;
 		_sync_seed_1 = p->Recv_uint32();
@@ -1029,6 +1042,7 @@ NetworkRecvStatus ClientNetworkGameSocketHandler::Receive_SERVER_FRAME(Packet *p
 		_sync_seed_2 = p->Recv_uint32();
 #endif
 		_sync_state_checksum = p->Recv_uint64();
+		for (uint i = 0; i < SCA_END; i++) _sync_subsystem_state_checksums[i] = p->Recv_uint64();
 	}
 #endif
 	/* Receive the token. */
@@ -1058,6 +1072,7 @@ NetworkRecvStatus ClientNetworkGameSocketHandler::Receive_SERVER_SYNC(Packet *p)
 	_sync_seed_2 = p->Recv_uint32();
 #endif
 	_sync_state_checksum = p->Recv_uint64();
+	for (uint i = 0; i < SCA_END; i++) _sync_subsystem_state_checksums[i] = p->Recv_uint64();
 
 	return NETWORK_RECV_STATUS_OKAY;
 }
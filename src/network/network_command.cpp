@@ -57,6 +57,45 @@ static CommandCallback * const _callback_table[] = {
 	/* 0x22 */ CcAddNewSchDispatchSchedule,
 };
 
+/**
+ * Field-presence flags of a serialised #CommandPacket.
+ * Fields whose flag is clear take their default value and are not included,
+ * see NetworkGameSocketHandler::SendCommand().
+ */
+enum CommandPacketDeltaFlags {
+	CPDF_P1       = 1 << 0, ///< p1 is non-zero and included
+	CPDF_P2       = 1 << 1, ///< p2 is non-zero and included
+	CPDF_P3       = 1 << 2, ///< p3 is non-zero and included
+	CPDF_TEXT     = 1 << 3, ///< the text is non-empty and included
+	CPDF_CALLBACK = 1 << 4, ///< a callback index is included
+	CPDF_AUX_DATA = 1 << 5, ///< auxiliary data is included
+};
+
+/**
+ * Server-side moving average of the execution time of each command type, in
+ * microseconds. Used by DistributeQueue() to estimate how much frame time the
+ * commands it schedules will cost, so that command storms (template
+ * replacements, long drag-and-drop builds) get spread over several frames
+ * instead of blowing the frame budget. Purely a scheduling heuristic on the
+ * server; it does not affect what clients execute, only when commands are
+ * scheduled.
+ */
+static uint32 _command_exec_time_avg[CMD_END];
+
+/** Estimated command execution time the server schedules per frame, in microseconds. */
+static const uint64 COMMAND_TIME_BUDGET = MILLISECONDS_PER_TICK * 1000 / 2;
+
+/**
+ * Update the average execution time of a command type with a new measurement.
+ * @param cmd      The command, flags included.
+ * @param duration Measured execution time in microseconds.
+ */
+static void UpdateCommandExecTime(uint32 cmd, uint64 duration)
+{
+	uint32 &avg = _command_exec_time_avg[cmd & CMD_ID_MASK];
+	avg = (uint32)(((uint64)avg * 7 + std::min<uint64>(duration, 1000000)) / 8);
+}
+
 /**
  * Append a CommandPacket at the end of the queue.
  * @param p The packet to append to the queue.
@@ -204,6 +243,19 @@ void NetworkSyncCommandQueue(NetworkClientSocket *cs)
 	}
 }
 
+/**
+ * Copy the commands still pending in the local command queue into the map
+ * dump cache journal. This mirrors what NetworkSyncCommandQueue does for a
+ * client joining right now, but for the clients that will later join from
+ * the cached map dump.
+ */
+void NetworkSyncCommandQueueToMapDumpJournal()
+{
+	for (CommandPacket *p = _local_execution_queue.Peek(); p != nullptr; p = p->next) {
+		NetworkServerJournalMapDumpCommand(*p);
+	}
+}
+
 /**
  * Execute all commands on the local command queue that ought to be executed this frame.
  */
@@ -230,7 +282,13 @@ void NetworkExecuteLocalCommandQueue()
 		_current_company = cp->company;
 		_cmd_client_id = cp->client_id;
 		cp->cmd |= CMD_NETWORK_COMMAND;
-		DoCommandP(cp, cp->my_cmd);
+		if (_network_server) {
+			auto start = std::chrono::steady_clock::now();
+			DoCommandP(cp, cp->my_cmd);
+			UpdateCommandExecTime(cp->cmd, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+		} else {
+			DoCommandP(cp, cp->my_cmd);
+		}
 
 		queue.Pop();
 	}
@@ -271,39 +329,47 @@ static void DistributeCommandPacket(CommandPacket &cp, const NetworkClientSocket
 
 	cp.callback = (nullptr != owner) ? nullptr : callback;
 	cp.my_cmd = (nullptr == owner);
+	NetworkServerJournalMapDumpCommand(cp);
 	_local_execution_queue.Append(cp);
 }
 
 /**
  * "Send" a particular CommandQueue to all clients.
- * @param queue The queue of commands that has to be distributed.
- * @param owner The client that owns the commands,
+ * @param queue  The queue of commands that has to be distributed.
+ * @param owner  The client that owns the commands,
+ * @param budget Remaining estimated execution time budget for this frame, in
+ *               microseconds; decremented for each distributed command. Each
+ *               queue may always distribute at least one command per frame so
+ *               a storm from one client cannot starve the others.
  */
-static void DistributeQueue(CommandQueue *queue, const NetworkClientSocket *owner)
+static void DistributeQueue(CommandQueue *queue, const NetworkClientSocket *owner, uint64 &budget)
 {
-#ifdef DEBUG_DUMP_COMMANDS
 	/* When replaying we do not want this limitation. */
-	int to_go = UINT16_MAX;
-#else
-	int to_go = _settings_client.network.commands_per_frame;
-#endif
+	int to_go = IsReplayingCommands() ? UINT16_MAX : _settings_client.network.commands_per_frame;
 
+	bool distributed_any = false;
 	std::unique_ptr<CommandPacket> cp;
-	while (--to_go >= 0 && (cp = queue->Pop(true)) != nullptr) {
+	while (--to_go >= 0 && (!distributed_any || budget > 0) && (cp = queue->Pop(true)) != nullptr) {
 		DistributeCommandPacket(*cp, owner);
 		NetworkAdminCmdLogging(owner, cp.get());
+		distributed_any = true;
+
+		uint64 estimate = _command_exec_time_avg[cp->cmd & CMD_ID_MASK];
+		budget -= std::min(estimate, budget);
 	}
 }
 
 /** Distribute the commands of ourself and the clients. */
 void NetworkDistributeCommands()
 {
+	uint64 budget = COMMAND_TIME_BUDGET;
+
 	/* First send the server's commands. */
-	DistributeQueue(&_local_wait_queue, nullptr);
+	DistributeQueue(&_local_wait_queue, nullptr, budget);
 
 	/* Then send the queues of the others. */
 	for (NetworkClientSocket *cs : NetworkClientSocket::Iterate()) {
-		DistributeQueue(&cs->incoming_queue, cs);
+		DistributeQueue(&cs->incoming_queue, cs, budget);
 	}
 }
 
@@ -315,31 +381,38 @@ void NetworkDistributeCommands()
  */
 const char *NetworkGameSocketHandler::ReceiveCommand(Packet *p, CommandPacket *cp)
 {
+	byte flags    = p->Recv_uint8();
 	cp->company = (CompanyID)p->Recv_uint8();
 	cp->cmd     = p->Recv_uint32();
 	if (!IsValidCommand(cp->cmd))               return "invalid command";
 	if (GetCommandFlags(cp->cmd) & CMD_OFFLINE) return "single-player only command";
 	if ((cp->cmd & CMD_FLAGS_MASK) != 0)        return "invalid command flag";
 
-	cp->p1      = p->Recv_uint32();
-	cp->p2      = p->Recv_uint32();
-	cp->p3      = p->Recv_uint64();
+	cp->p1      = (flags & CPDF_P1) ? p->Recv_uint32() : 0;
+	cp->p2      = (flags & CPDF_P2) ? p->Recv_uint32() : 0;
+	cp->p3      = (flags & CPDF_P3) ? p->Recv_uint64() : 0;
 	cp->tile    = p->Recv_uint32();
 
-	StringValidationSettings settings = (!_network_server && GetCommandFlags(cp->cmd) & CMD_STR_CTRL) != 0 ? SVS_ALLOW_CONTROL_CODE | SVS_REPLACE_WITH_QUESTION_MARK : SVS_REPLACE_WITH_QUESTION_MARK;
-	p->Recv_string(cp->text, settings);
+	if (flags & CPDF_TEXT) {
+		StringValidationSettings settings = (!_network_server && GetCommandFlags(cp->cmd) & CMD_STR_CTRL) != 0 ? SVS_ALLOW_CONTROL_CODE | SVS_REPLACE_WITH_QUESTION_MARK : SVS_REPLACE_WITH_QUESTION_MARK;
+		p->Recv_string(cp->text, settings);
+	} else {
+		cp->text.clear();
+	}
 
-	byte callback = p->Recv_uint8();
+	byte callback = (flags & CPDF_CALLBACK) ? p->Recv_uint8() : 0;
 	if (callback >= lengthof(_callback_table))  return "invalid callback";
 
 	cp->callback = _callback_table[callback];
 
-	uint16 aux_data_size = p->Recv_uint16();
-	if (aux_data_size > 0 && p->CanReadFromPacket(aux_data_size, true)) {
-		CommandAuxiliarySerialised *aux_data = new CommandAuxiliarySerialised();
-		cp->aux_data.reset(aux_data);
-		aux_data->serialised_data.resize(aux_data_size);
-		p->Recv_binary((char *)(aux_data->serialised_data.data()), aux_data_size);
+	if (flags & CPDF_AUX_DATA) {
+		uint16 aux_data_size = p->Recv_uint16();
+		if (aux_data_size > 0 && p->CanReadFromPacket(aux_data_size, true)) {
+			CommandAuxiliarySerialised *aux_data = new CommandAuxiliarySerialised();
+			cp->aux_data.reset(aux_data);
+			aux_data->serialised_data.resize(aux_data_size);
+			p->Recv_binary((char *)(aux_data->serialised_data.data()), aux_data_size);
+		}
 	}
 
 	return nullptr;
@@ -347,19 +420,18 @@ const char *NetworkGameSocketHandler::ReceiveCommand(Packet *p, CommandPacket *c
 
 /**
  * Sends a command over the network.
+ *
+ * The fields covered by #CommandPacketDeltaFlags are only included when they
+ * differ from their default; most commands carry no text, callback, auxiliary
+ * data or p3, so this considerably shrinks command streams during large paste
+ * operations. Clients and servers always match revisions, so both sides agree
+ * on this encoding.
+ *
  * @param p the packet to send it in.
  * @param cp the packet to actually send.
  */
 void NetworkGameSocketHandler::SendCommand(Packet *p, const CommandPacket *cp)
 {
-	p->Send_uint8 (cp->company);
-	p->Send_uint32(cp->cmd);
-	p->Send_uint32(cp->p1);
-	p->Send_uint32(cp->p2);
-	p->Send_uint64(cp->p3);
-	p->Send_uint32(cp->tile);
-	p->Send_string(cp->text.c_str());
-
 	byte callback = 0;
 	while (callback < lengthof(_callback_table) && _callback_table[callback] != cp->callback) {
 		callback++;
@@ -369,11 +441,28 @@ void NetworkGameSocketHandler::SendCommand(Packet *p, const CommandPacket *cp)
 		DEBUG(net, 0, "Unknown callback for command; no callback sent (command: %d)", cp->cmd);
 		callback = 0; // _callback_table[0] == nullptr
 	}
-	p->Send_uint8 (callback);
 
-	size_t aux_data_size_pos = p->Size();
-	p->Send_uint16(0);
-	if (cp->aux_data != nullptr) {
+	byte flags = 0;
+	if (cp->p1 != 0)               flags |= CPDF_P1;
+	if (cp->p2 != 0)               flags |= CPDF_P2;
+	if (cp->p3 != 0)               flags |= CPDF_P3;
+	if (!cp->text.empty())         flags |= CPDF_TEXT;
+	if (callback != 0)             flags |= CPDF_CALLBACK;
+	if (cp->aux_data != nullptr)   flags |= CPDF_AUX_DATA;
+
+	p->Send_uint8 (flags);
+	p->Send_uint8 (cp->company);
+	p->Send_uint32(cp->cmd);
+	if (flags & CPDF_P1) p->Send_uint32(cp->p1);
+	if (flags & CPDF_P2) p->Send_uint32(cp->p2);
+	if (flags & CPDF_P3) p->Send_uint64(cp->p3);
+	p->Send_uint32(cp->tile);
+	if (flags & CPDF_TEXT) p->Send_string(cp->text.c_str());
+	if (flags & CPDF_CALLBACK) p->Send_uint8(callback);
+
+	if (flags & CPDF_AUX_DATA) {
+		size_t aux_data_size_pos = p->Size();
+		p->Send_uint16(0);
 		CommandSerialisationBuffer serialiser(p->GetSerialisationBuffer(), p->GetSerialisationLimit());
 		cp->aux_data->Serialise(serialiser);
 		p->WriteAtOffset_uint16(aux_data_size_pos, (uint16)(p->Size() - aux_data_size_pos - 2));
@@ -15,8 +15,11 @@
 #include "../error.h"
 #include "../base_media_base.h"
 #include "../settings_type.h"
+#include "../worker_thread.h"
 #include "network_content.h"
 
+#include <atomic>
+
 #include "table/strings.h"
 
 #if defined(WITH_ZLIB)
@@ -472,6 +475,23 @@ static bool GunzipFile(const ContentInfo *ci)
 #endif /* defined(WITH_ZLIB) */
 }
 
+/** A downloaded file whose gunzipping is being done by a worker thread. */
+struct ContentPendingExtraction {
+	ContentInfo *info = nullptr;   ///< Information about the downloaded file.
+	std::atomic<bool> done{false}; ///< Whether the extraction job has finished.
+	bool success = false;          ///< Whether gunzipping the file succeeded.
+
+	~ContentPendingExtraction() { delete this->info; }
+};
+
+/** Worker thread job to gunzip a downloaded content file; data1 is the #ContentPendingExtraction to process. */
+static void GunzipContentJobProc(void *data1, void *data2, void *data3)
+{
+	ContentPendingExtraction *pe = static_cast<ContentPendingExtraction *>(data1);
+	pe->success = GunzipFile(pe->info);
+	pe->done.store(true, std::memory_order_release);
+}
+
 /**
  * Simple wrapper around fwrite to be able to pass it to Packet's TransferOut.
  * @param file   The file to write data to.
@@ -556,17 +576,39 @@ void ClientNetworkContentSocketHandler::AfterDownload()
 	fclose(this->curFile);
 	this->curFile = nullptr;
 
-	if (GunzipFile(this->curInfo)) {
-		unlink(GetFullFilename(this->curInfo, true).c_str());
+	if (_general_worker_pool.HasWorkers()) {
+		/* Gunzip the tar on a worker thread, so the next file can be received
+		 * while this one is extracted. ProcessPendingExtractions picks up the
+		 * result. The pending entry takes over ownership of the content info. */
+		std::unique_ptr<ContentPendingExtraction> pe(new ContentPendingExtraction());
+		pe->info = this->curInfo;
+		this->curInfo = nullptr;
+		_general_worker_pool.EnqueueJob(&GunzipContentJobProc, pe.get());
+		this->pending_extractions.push_back(std::move(pe));
+	} else {
+		this->FinishDownloadedContent(this->curInfo, GunzipFile(this->curInfo));
+	}
+}
+
+/**
+ * Handle the result of gunzipping a downloaded file: make the content
+ * known on success, or tell the user about the failure.
+ * @param ci        The content that was downloaded.
+ * @param gunzip_ok Whether gunzipping the file succeeded.
+ */
+void ClientNetworkContentSocketHandler::FinishDownloadedContent(const ContentInfo *ci, bool gunzip_ok)
+{
+	if (gunzip_ok) {
+		unlink(GetFullFilename(ci, true).c_str());
 
-		Subdirectory sd = GetContentInfoSubDir(this->curInfo->type);
+		Subdirectory sd = GetContentInfoSubDir(ci->type);
 		if (sd == NO_DIRECTORY) NOT_REACHED();
 
 		TarScanner ts;
-		std::string fname = GetFullFilename(this->curInfo, false);
+		std::string fname = GetFullFilename(ci, false);
 		ts.AddFile(sd, fname);
 
-		if (this->curInfo->type == CONTENT_TYPE_BASE_MUSIC) {
+		if (ci->type == CONTENT_TYPE_BASE_MUSIC) {
 			/* Music can't be in a tar. So extract the tar! */
 			ExtractTar(fname, BASESET_DIR);
 			unlink(fname.c_str());
@@ -576,12 +618,25 @@ void ClientNetworkContentSocketHandler::AfterDownload()
 		EM_ASM(if (window["openttd_syncfs"]) openttd_syncfs());
 #endif
 
-		this->OnDownloadComplete(this->curInfo->id);
+		this->OnDownloadComplete(ci->id);
 	} else {
 		ShowErrorMessage(STR_CONTENT_ERROR_COULD_NOT_EXTRACT, INVALID_STRING_ID, WL_ERROR);
 	}
 }
 
+/**
+ * Pick up the results of finished background extraction jobs, in download order.
+ */
+void ClientNetworkContentSocketHandler::ProcessPendingExtractions()
+{
+	while (!this->pending_extractions.empty()) {
+		ContentPendingExtraction *pe = this->pending_extractions.front().get();
+		if (!pe->done.load(std::memory_order_acquire)) break;
+		this->FinishDownloadedContent(pe->info, pe->success);
+		this->pending_extractions.pop_front();
+	}
+}
+
 bool ClientNetworkContentSocketHandler::IsCancelled() const
 {
 	return this->isCancelled;
@@ -818,6 +873,8 @@ NetworkRecvStatus ClientNetworkContentSocketHandler::CloseConnection(bool error)
  */
 void ClientNetworkContentSocketHandler::SendReceive()
 {
+	this->ProcessPendingExtractions();
+
 	if (this->sock == INVALID_SOCKET || this->isConnecting) return;
 
 	if (std::chrono::steady_clock::now() > this->lastActivity + IDLE_TIMEOUT) {
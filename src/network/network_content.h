@@ -14,6 +14,11 @@
 #include "core/http.h"
 #include "../3rdparty/cpp-btree/btree_map.h"
 
+#include <deque>
+#include <memory>
+
+struct ContentPendingExtraction;
+
 /** Vector with content info */
 typedef std::vector<ContentInfo *> ContentVector;
 /** Vector with constant content info */
@@ -75,6 +80,7 @@ protected:
 
 	FILE *curFile;        ///< Currently downloaded file
 	ContentInfo *curInfo; ///< Information about the currently downloaded file
+	std::deque<std::unique_ptr<ContentPendingExtraction>> pending_extractions; ///< Downloaded files whose extraction runs on a worker thread
 	bool isConnecting;    ///< Whether we're connecting
 	bool isCancelled;     ///< Whether the download has been cancelled
 	std::chrono::steady_clock::time_point lastActivity;  ///< The last time there was network activity
@@ -100,6 +106,8 @@ protected:
 
 	bool BeforeDownload();
 	void AfterDownload();
+	void FinishDownloadedContent(const ContentInfo *ci, bool gunzip_ok);
+	void ProcessPendingExtractions();
 
 	void DownloadSelectedContentHTTP(const ContentIDList &content);
 	void DownloadSelectedContentFallback(const ContentIDList &content);
@@ -11,10 +11,11 @@
 #define NETWORK_FUNC_H
 
 /**
- * Uncomment the following define to enable command replaying.
- * See docs/desync.txt for details.
+ * Command replaying is available at runtime through the '-replay' command
+ * line option. Uncomment the following define to additionally replay
+ * commands that failed on the recording server.
+ * See docs/desync.md for details.
  */
-// #define DEBUG_DUMP_COMMANDS
 // #define DEBUG_FAILED_DUMP_COMMANDS
 
 #include "network_type.h"
@@ -24,6 +25,12 @@
 #include "../company_type.h"
 #include "../string_type.h"
 
+/** Command log to replay on the server, set with the '-replay' command line option. Empty when not replaying. */
+extern std::string _replay_command_log_file;
+
+/** Whether a command log is being replayed, see '-replay'. */
+bool IsReplayingCommands();
+
 extern NetworkCompanyState *_network_company_states;
 extern std::string _network_company_server_id;
 extern uint8 _network_company_password_storage_token[16];
@@ -44,16 +44,11 @@ static const uint32 FIND_SERVER_EXTENDED_TOKEN = 0x2A49582A;
 
 /**
  * Helper variable to make the dedicated server go fast until the (first) join.
- * Used to load the desync debug logs, i.e. for reproducing a desync.
- * There's basically no need to ever enable this, unless you really know what
- * you are doing, i.e. debugging a desync.
- * See docs/desync.txt for details.
+ * Set while replaying a desync debug log, i.e. for reproducing a desync or
+ * profiling a recorded incident, see the '-replay' command line option.
+ * See docs/desync.md for details.
  */
-#ifdef DEBUG_DUMP_COMMANDS
 extern bool _ddc_fastforward;
-#else
-#define _ddc_fastforward (false)
-#endif /* DEBUG_DUMP_COMMANDS */
 
 typedef class ServerNetworkGameSocketHandler NetworkClientSocket;
 
@@ -84,6 +79,7 @@ extern uint32 _sync_seed_1;
 extern uint32 _sync_seed_2;
 #endif
 extern uint64 _sync_state_checksum;
+extern uint64 _sync_subsystem_state_checksums[]; ///< Per-subsystem state checksums of the sync frame, SCA_END entries.
 extern uint32 _sync_frame;
 extern Date   _last_sync_date;
 extern DateFract _last_sync_date_fract;
@@ -140,6 +136,10 @@ void NetworkDistributeCommands();
 void NetworkExecuteLocalCommandQueue();
 void NetworkFreeLocalCommandQueue();
 void NetworkSyncCommandQueue(NetworkClientSocket *cs);
+void NetworkSyncCommandQueueToMapDumpJournal();
+
+void NetworkServerJournalMapDumpCommand(const CommandPacket &cp);
+void NetworkServerInvalidateMapDumpCache();
 
 void ShowNetworkError(StringID error_string);
 void NetworkTextMessage(NetworkAction action, TextColour colour, bool self_send, const std::string &name, const std::string &str = "", NetworkTextMessageData data = NetworkTextMessageData(), const char *data_str = "");
@@ -26,6 +26,7 @@
 #include "../company_gui.h"
 #include "../roadveh.h"
 #include "../order_backup.h"
+#include "../core/checksum_func.hpp"
 #include "../core/pool_func.hpp"
 #include "../core/random_func.hpp"
 #include "../rev.h"
@@ -58,6 +59,74 @@ INSTANTIATE_POOL_METHODS(NetworkClientSocket)
 /** Instantiate the listen sockets. */
 template SocketList TCPListenHandler<ServerNetworkGameSocketHandler, PACKET_SERVER_FULL, PACKET_SERVER_BANNED>::sockets;
 
+/**
+ * Cache of the last map dump sent to a joining client.
+ *
+ * Joins shortly after that dump was made reuse it instead of triggering
+ * another full savegame cycle. Clients downloading the map already receive
+ * and replay every command distributed after the frame of their snapshot,
+ * so a cached dump together with the journal of commands distributed since
+ * it was made looks no different on the wire than a fresh dump; the joining
+ * client merely starts its catch-up a few hundred frames further back.
+ */
+static struct MapDumpCache {
+	std::vector<std::unique_ptr<Packet>> packets; ///< Copies of the map data packets of the dump.
+	std::vector<CommandPacket> journal; ///< Commands distributed since the dump was made.
+	uint32 frame;            ///< Frame the dump was made at.
+	size_t total_size;       ///< Total size of the compressed dump.
+	bool zstd;               ///< Whether the dump was compressed with zstd.
+	bool capturing = false;  ///< A dump is currently being captured into the cache.
+	bool valid = false;      ///< The cache holds a complete dump.
+} _map_dump_cache;
+
+/** Maximum age of the cached map dump, in frames; clients joining from it have to replay this many frames extra. */
+static const uint32 MAP_DUMP_CACHE_MAX_AGE = 4 * DAY_TICKS;
+
+/** Throw away the cached map dump and its command journal. */
+void NetworkServerInvalidateMapDumpCache()
+{
+	_map_dump_cache.packets.clear();
+	_map_dump_cache.journal.clear();
+	_map_dump_cache.capturing = false;
+	_map_dump_cache.valid = false;
+}
+
+/** Is a client currently being sent the map from the cached dump? */
+static bool IsMapDumpCacheBusy()
+{
+	for (NetworkClientSocket *cs : NetworkClientSocket::Iterate()) {
+		if (cs->status == NetworkClientSocket::STATUS_MAP && cs->savegame == nullptr) return true;
+	}
+	return false;
+}
+
+/** May the cached map dump still be served to a client with the given zstd support? */
+static bool IsMapDumpCacheUsable(bool zstd)
+{
+	return _map_dump_cache.valid && _map_dump_cache.zstd == zstd &&
+			_frame_counter - _map_dump_cache.frame <= MAP_DUMP_CACHE_MAX_AGE;
+}
+
+/**
+ * Record a just-distributed command in the map dump cache journal, so that
+ * clients later joining from the cached dump still receive it.
+ * @param cp The command as appended to the local execution queue.
+ */
+void NetworkServerJournalMapDumpCommand(const CommandPacket &cp)
+{
+	if (!_map_dump_cache.capturing && !_map_dump_cache.valid) return;
+
+	if (_map_dump_cache.valid && _frame_counter - _map_dump_cache.frame > MAP_DUMP_CACHE_MAX_AGE) {
+		/* The dump has outlived its reuse window; drop it once nobody is downloading it any more. */
+		if (!IsMapDumpCacheBusy()) NetworkServerInvalidateMapDumpCache();
+		return;
+	}
+
+	CommandPacket c = cp;
+	c.callback = nullptr;
+	_map_dump_cache.journal.push_back(std::move(c));
+}
+
 /** Writing a savegame directly to a number of packets. */
 struct PacketWriter : SaveFilter {
 	ServerNetworkGameSocketHandler *cs; ///< Socket we are associated with.
@@ -102,6 +171,9 @@ struct PacketWriter : SaveFilter {
 	 */
 	void Destroy()
 	{
+		/* If the dump was still being captured it is incomplete, throw it away. */
+		if (_map_dump_cache.capturing) NetworkServerInvalidateMapDumpCache();
+
 		std::unique_lock<std::mutex> lock(this->mutex);
 
 		this->cs = nullptr;
@@ -132,11 +204,19 @@ struct PacketWriter : SaveFilter {
 		bool last_packet = false;
 		for (auto &p : this->packets) {
 			if (p->GetPacketType() == PACKET_SERVER_MAP_DONE) last_packet = true;
+			if (_map_dump_cache.capturing) _map_dump_cache.packets.push_back(p->Clone());
 			socket->SendPacket(std::move(p));
 
 		}
 		this->packets.clear();
 
+		if (last_packet && _map_dump_cache.capturing) {
+			/* The whole dump has been captured, it can now be served to other joiners. */
+			_map_dump_cache.total_size = this->total_size;
+			_map_dump_cache.capturing = false;
+			_map_dump_cache.valid = true;
+		}
+
 		return last_packet;
 	}
 
@@ -272,9 +352,12 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::CloseConnection(NetworkRecvSta
 	/* If we were transfering a map to this client, stop the savegame creation
 	 * process and queue the next client to receive the map. */
 	if (this->status == STATUS_MAP) {
-		/* Ensure the saving of the game is stopped too. */
-		this->savegame->Destroy();
-		this->savegame = nullptr;
+		/* Ensure the saving of the game is stopped too; when serving from the
+		 * cached dump there is no savegame in progress. */
+		if (this->savegame != nullptr) {
+			this->savegame->Destroy();
+			this->savegame = nullptr;
+		}
 
 		this->CheckNextClientToSendMap(this);
 	}
@@ -357,13 +440,40 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendClientInfo(NetworkClientIn
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** State from which the cached game info response packet was serialised. */
+struct GameInfoCacheState {
+	uint32 generation = 0;  ///< Generation of the static part of the game info.
+	Date game_date = 0;     ///< Game date when the packet was serialised.
+	byte clients_on = 0;    ///< Client count when the packet was serialised.
+	byte companies_on = 0;  ///< Company count when the packet was serialised.
+	byte spectators_on = 0; ///< Spectator count when the packet was serialised.
+
+	bool operator!=(const GameInfoCacheState &other) const
+	{
+		return this->generation != other.generation || this->game_date != other.game_date ||
+				this->clients_on != other.clients_on || this->companies_on != other.companies_on ||
+				this->spectators_on != other.spectators_on;
+	}
+};
+static GameInfoCacheState _game_info_cache_state; ///< State the cached game info response was built from.
+static std::unique_ptr<Packet> _game_info_cache;  ///< Cached serialised PACKET_SERVER_GAME_INFO response.
+
 /** Send the client information about the server. */
 NetworkRecvStatus ServerNetworkGameSocketHandler::SendGameInfo()
 {
-	Packet *p = new Packet(PACKET_SERVER_GAME_INFO, TCP_MTU);
-	SerializeNetworkGameInfo(p, GetCurrentNetworkServerGameInfo());
+	/* A server list refresh queries every known server at much the same time,
+	 * and serialising the game info (including the NewGRF list) for each of
+	 * those queries adds up. Reuse the serialised packet until the information
+	 * it was built from changes. */
+	const NetworkServerGameInfo *ngi = GetCurrentNetworkServerGameInfo();
+	GameInfoCacheState state = { GetNetworkServerGameInfoGeneration(), ngi->game_date, ngi->clients_on, ngi->companies_on, ngi->spectators_on };
+	if (_game_info_cache == nullptr || _game_info_cache_state != state) {
+		_game_info_cache.reset(new Packet(PACKET_SERVER_GAME_INFO, TCP_MTU));
+		SerializeNetworkGameInfo(_game_info_cache.get(), ngi);
+		_game_info_cache_state = state;
+	}
 
-	this->SendPacket(p);
+	this->SendPacket(_game_info_cache->Clone());
 
 	return NETWORK_RECV_STATUS_OKAY;
 }
@@ -583,33 +693,89 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendMap()
 	}
 
 	if (this->status == STATUS_AUTHORIZED) {
-		WaitTillSaved();
-		this->savegame = new PacketWriter(this);
-
-		/* Now send the _frame_counter and how many packets are coming */
-		Packet *p = new Packet(PACKET_SERVER_MAP_BEGIN, SHRT_MAX);
-		p->Send_uint32(_frame_counter);
-		this->SendPacket(p);
-
-		NetworkSyncCommandQueue(this);
-		this->status = STATUS_MAP;
-		/* Mark the start of download */
-		this->last_frame = _frame_counter;
-		this->last_frame_server = _frame_counter;
-
-		/* Make a dump of the current game */
-		SaveModeFlags flags = SMF_NET_SERVER;
-		if (this->supports_zstd) flags |= SMF_ZSTD_OK;
-		if (SaveWithFilter(this->savegame, true, flags) != SL_OK) usererror("network savedump failed");
+		if (IsMapDumpCacheUsable(this->supports_zstd)) {
+			/* A recent dump is cached: serve that one, together with the
+			 * commands distributed since it was made, instead of saving again. */
+			Packet *p = new Packet(PACKET_SERVER_MAP_BEGIN, SHRT_MAX);
+			p->Send_uint32(_map_dump_cache.frame);
+			this->SendPacket(p);
+
+			p = new Packet(PACKET_SERVER_MAP_SIZE, SHRT_MAX);
+			p->Send_uint32((uint32)_map_dump_cache.total_size);
+			this->SendPacket(p);
+
+			/* The journal takes the place of NetworkSyncCommandQueue: it holds
+			 * every command the client has to replay between the frame of the
+			 * dump and the commands it will receive live from here on. */
+			for (const CommandPacket &cp : _map_dump_cache.journal) {
+				this->outgoing_queue.Append(CommandPacket(cp));
+			}
+			this->status = STATUS_MAP;
+			/* The client starts catching up from the frame of the cached dump. */
+			this->last_frame = _map_dump_cache.frame;
+			this->last_frame_server = _map_dump_cache.frame;
+			this->map_cache_pos = 0;
+		} else {
+			if (IsSaveInProgress()) {
+				/* A save (e.g. an autosave) is still being written. Joining the
+				 * save thread here would stall the game loop for everyone, so
+				 * let the client wait until the saver is idle instead; the tick
+				 * handler promotes it again. */
+				this->status = STATUS_MAP_WAIT;
+				return this->SendWait();
+			}
+			/* The save thread is idle; joining a finished thread does not block. */
+			WaitTillSaved();
+			this->savegame = new PacketWriter(this);
+
+			/* Now send the _frame_counter and how many packets are coming */
+			Packet *p = new Packet(PACKET_SERVER_MAP_BEGIN, SHRT_MAX);
+			p->Send_uint32(_frame_counter);
+			this->SendPacket(p);
+
+			NetworkSyncCommandQueue(this);
+			this->status = STATUS_MAP;
+			/* Mark the start of download */
+			this->last_frame = _frame_counter;
+			this->last_frame_server = _frame_counter;
+
+			/* Start capturing this dump, so that further joins within the reuse
+			 * window do not have to save the game again. The journal is seeded
+			 * with the same pending commands that NetworkSyncCommandQueue sends. */
+			NetworkServerInvalidateMapDumpCache();
+			_map_dump_cache.capturing = true;
+			_map_dump_cache.frame = _frame_counter;
+			_map_dump_cache.zstd = this->supports_zstd;
+			NetworkSyncCommandQueueToMapDumpJournal();
+
+			/* Make a dump of the current game */
+			SaveModeFlags flags = SMF_NET_SERVER;
+			if (this->supports_zstd) flags |= SMF_ZSTD_OK;
+			if (SaveWithFilter(this->savegame, true, flags) != SL_OK) usererror("network savedump failed");
+		}
 	}
 
 	if (this->status == STATUS_MAP) {
-		bool last_packet = this->savegame->TransferToNetworkQueue(this);
+		bool last_packet;
+		if (this->savegame != nullptr) {
+			last_packet = this->savegame->TransferToNetworkQueue(this);
+			if (last_packet) {
+				/* Done reading, make sure saving is done as well */
+				this->savegame->Destroy();
+				this->savegame = nullptr;
+			}
+		} else {
+			/* Serving from the cached dump: queue the next batch of packets. */
+			static const size_t MAP_DUMP_CACHE_PACKETS_PER_PUMP = 16;
+			last_packet = false;
+			size_t end = std::min(_map_dump_cache.packets.size(), this->map_cache_pos + MAP_DUMP_CACHE_PACKETS_PER_PUMP);
+			for (; this->map_cache_pos != end; this->map_cache_pos++) {
+				const std::unique_ptr<Packet> &p = _map_dump_cache.packets[this->map_cache_pos];
+				if (p->GetPacketType() == PACKET_SERVER_MAP_DONE) last_packet = true;
+				this->SendPacket(p->Clone());
+			}
+		}
 		if (last_packet) {
-			/* Done reading, make sure saving is done as well */
-			this->savegame->Destroy();
-			this->savegame = nullptr;
-
 			/* Set the status to DONE_MAP, no we will wait for the client
 			 *  to send it is ready (maybe that happens like never ;)) */
 			this->status = STATUS_DONE_MAP;
@@ -646,6 +812,7 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendFrame()
 	p->Send_uint32(_sync_seed_2);
 #endif
 	p->Send_uint64(_sync_state_checksum);
+	for (uint i = 0; i < SCA_END; i++) p->Send_uint64(_sync_subsystem_state_checksums[i]);
 #endif
 
 	/* If token equals 0, we need to make a new token and send that. */
@@ -669,6 +836,7 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendSync()
 	p->Send_uint32(_sync_seed_2);
 #endif
 	p->Send_uint64(_sync_state_checksum);
+	for (uint i = 0; i < SCA_END; i++) p->Send_uint64(_sync_subsystem_state_checksums[i]);
 	this->SendPacket(p);
 	return NETWORK_RECV_STATUS_OKAY;
 }
@@ -781,6 +949,9 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendNewGame()
 	return NETWORK_RECV_STATUS_OKAY;
 }
 
+/** Maximum number of packets the send queue may hold before further rcon output to the client is dropped. */
+static const size_t MAX_RCON_RESULT_QUEUE_LENGTH = 1024;
+
 /**
  * Send the result of a console action.
  * @param colour The colour of the result.
@@ -788,6 +959,11 @@ NetworkRecvStatus ServerNetworkGameSocketHandler::SendNewGame()
  */
 NetworkRecvStatus ServerNetworkGameSocketHandler::SendRConResult(uint16 colour, const std::string &command)
 {
+	/* An rcon command that produces output faster than the client can take it
+	 * in would otherwise grow the send queue without bound; drop the excess
+	 * output instead of buffering or blocking on it. */
+	if (this->GetSendQueueLength() >= MAX_RCON_RESULT_QUEUE_LENGTH) return NETWORK_RECV_STATUS_OKAY;
+
 	Packet *p = new Packet(PACKET_SERVER_RCON, SHRT_MAX);
 
 	p->Send_uint16(colour);
@@ -1904,6 +2080,19 @@ void NetworkServer_Tick(bool send_frame)
 	}
 #endif
 
+	/* Clients may be waiting for the map because a save was still being
+	 * written when they asked for it; start the next download once the
+	 * saver is idle and nobody else is downloading. */
+	if (!IsSaveInProgress()) {
+		NetworkClientSocket *waiting = nullptr;
+		bool map_busy = false;
+		for (NetworkClientSocket *cs : NetworkClientSocket::Iterate()) {
+			if (cs->status == NetworkClientSocket::STATUS_MAP) map_busy = true;
+			if (cs->status == NetworkClientSocket::STATUS_MAP_WAIT) waiting = cs;
+		}
+		if (waiting != nullptr && !map_busy) waiting->CheckNextClientToSendMap();
+	}
+
 	/* Now we are done with the frame, inform the clients that they can
 	 *  do their frame! */
 	for (NetworkClientSocket *cs : NetworkClientSocket::Iterate()) {
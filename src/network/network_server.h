@@ -83,6 +83,7 @@ public:
 	bool supports_zstd = false;  ///< Client supports zstd compression
 
 	struct PacketWriter *savegame; ///< Writer used to write the savegame.
+	size_t map_cache_pos = 0;      ///< Next packet to queue when the map is being served from the cached dump.
 	NetworkAddress client_address; ///< IP-address of the client (so they can be banned)
 
 	std::string desync_log;
@@ -37,6 +37,7 @@
 #include "newgrf_object.h"
 #include "newgrf_newsignals.h"
 #include "newgrf_newlandscape.h"
+#include "newgrf_railtype.h"
 #include "newgrf_extension.h"
 #include "rev.h"
 #include "fios.h"
@@ -48,6 +49,7 @@
 #include "genworld.h"
 #include "error.h"
 #include "vehicle_func.h"
+#include "station_func.h"
 #include "language.h"
 #include "vehicle_base.h"
 #include "road.h"
@@ -10327,6 +10329,8 @@ static void ResetCustomStations()
 		free(stations);
 		stations = nullptr;
 	}
+
+	InvalidateStationTileLayoutCache();
 }
 
 /** Reset and clear all NewGRF houses */
@@ -10447,6 +10451,7 @@ static void ResetNewGRF()
 	_new_signals_grfs.clear();
 	MemSetT<NewSignalStyle>(_new_signal_styles.data(), 0, MAX_NEW_SIGNAL_STYLES);
 	_num_new_signal_styles = 0;
+	InvalidateCustomSignalSpriteCache();
 	_new_landscape_rocks_grfs.clear();
 }
 
@@ -10558,6 +10563,7 @@ void ResetNewGRFData()
 	InitializeSoundPool();
 	_spritegroup_pool.CleanPool();
 	_callback_result_cache.clear();
+	ClearEngineCB36ResultMemo();
 	_deterministic_sg_shadows.clear();
 	_randomized_sg_shadows.clear();
 	_grfs_loaded_with_sg_shadow_enable = HasBit(_misc_debug_flags, MDF_NEWGRF_SG_SAVE_RAW);
@@ -11749,6 +11755,24 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 
 	_cur.spriteid = load_index;
 
+	/* The sprite section of each container v2 GRF is scanned in its entirety
+	 * at both the init and the activation stage. Do that scan once per file up
+	 * front, across files in parallel: the per-file parsing is independent,
+	 * unlike the pseudo-sprite action processing below which must stay serial
+	 * (actions mutate shared state and may refer to earlier files). */
+	{
+		std::vector<std::pair<std::string, Subdirectory>> files;
+		uint num_grfs = 0;
+		for (GRFConfig *c = _grfconfig; c != nullptr; c = c->next) {
+			if (c->status == GCS_DISABLED || c->status == GCS_NOT_FOUND) continue;
+			Subdirectory subdir = num_grfs < num_baseset ? BASESET_DIR : NEWGRF_DIR;
+			if (!FioCheckFileExists(c->filename, subdir)) continue;
+			num_grfs++;
+			files.push_back({ c->filename, subdir });
+		}
+		PrecacheGRFSpriteOffsets(files);
+	}
+
 	/* Load newgrf sprites
 	 * in each loading stage, (try to) open each file specified in the config
 	 * and load information from it. */
@@ -11819,6 +11843,7 @@ void LoadNewGRF(uint load_index, uint num_baseset)
 	/* Pseudo sprite processing is finished; free temporary stuff */
 	_cur.ClearDataForNextFile();
 	_callback_result_cache.clear();
+	ClearGRFSpriteOffsetsPrecache();
 
 	/* Call any functions that should be run after GRFs have been loaded. */
 	AfterLoadGRFs();
@@ -10,6 +10,30 @@
 #ifndef NEWGRF_CACHE_CHECK_H
 #define NEWGRF_CACHE_CHECK_H
 
+/**
+ * These flags implement the vehicle sprite resolution cache validity check.
+ *
+ * Resolving a vehicle sprite (Vehicle::GetImage() and below) can be expensive
+ * for complex NewGRFs, so the result in Vehicle::sprite_seq is cached and only
+ * re-resolved when something it depended on may have changed. The dependencies
+ * are discovered during resolution itself: UpdateImageState() sets these flags
+ * before calling GetImage(), and VehicleGetVariable() et al. classify every
+ * variable that the sprite chain reads.
+ *
+ *  - Variables that cannot change without the image cache being invalidated
+ *    elsewhere (engine properties, cargo type, liveries, ...) leave the flags
+ *    untouched.
+ *  - Variables covered by a targeted invalidation hook set a redraw flag on
+ *    the vehicle instead (see VCF_REDRAW_ON_TRIGGER/VCF_REDRAW_ON_SPEED_CHANGE,
+ *    and VCF_IMAGE_CURVATURE via _sprite_group_resolve_check_veh_curvature_check).
+ *  - Any other (volatile) variable clears _sprite_group_resolve_check_veh_check,
+ *    which makes UpdateImageState() store INVALID_DIR in cur_image_valid_dir so
+ *    the vehicle is re-resolved on every viewport update.
+ *
+ * Otherwise cur_image_valid_dir records the direction the cached sprite_seq
+ * is valid for, and UpdateViewport() skips resolution entirely until the
+ * direction changes or one of the invalidation hooks fires.
+ */
 extern bool _sprite_group_resolve_check_veh_check;
 extern bool _sprite_group_resolve_check_veh_curvature_check;
 
@@ -26,10 +26,16 @@
 
 #include "fileio_func.h"
 #include "fios.h"
+#include "core/serialisation.hpp"
 
 #include "thread.h"
+#include <sys/stat.h>
+#include <map>
 #include <mutex>
 #include <condition_variable>
+#ifndef _WIN32
+# include <unistd.h>
+#endif /* _WIN32 */
 #if defined(__MINGW32__)
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
 #include "3rdparty/mingw-std-threads/mingw.condition_variable.h"
@@ -666,6 +672,315 @@ compatible_grf:
 }
 
 
+/**
+ * Persistent cache of NewGRF scan results.
+ *
+ * Filling a GRFConfig requires parsing the file's Action 14/8 data and hashing
+ * its whole data section, which adds up to a noticeable delay when many NewGRFs
+ * are installed. The scan results only depend on the file contents, so they are
+ * kept in a cache file keyed on the file name, with the file size and
+ * modification time as the change check. Files whose identity matches are
+ * loaded from the cache without being opened at all; anything else falls
+ * through to a normal scan. For files inside tars the identity of the
+ * containing tar is used instead.
+ */
+
+static const uint32 GRF_SCAN_CACHE_MAGIC = 'G' | ('R' << 8) | ('F' << 16) | ('S' << 24);
+static const uint32 GRF_SCAN_CACHE_VERSION = 1;
+
+/** Cached scan result for a single NewGRF file. */
+struct GRFScanCacheEntry {
+	uint64 size = 0;        ///< Size of the file (or containing tar) when it was scanned.
+	uint64 mtime = 0;       ///< Modification time of the file (or containing tar) when it was scanned.
+	std::vector<byte> data; ///< Serialised scan result, see SerialiseScannedGRFConfig.
+	bool used = false;      ///< Entry matched a file during the current scan.
+};
+
+static std::map<std::string, GRFScanCacheEntry> _grf_scan_cache;
+static bool _grf_scan_cache_modified = false;
+
+struct GRFScanCacheWriteBuffer : public BufferSerialisationHelper<GRFScanCacheWriteBuffer> {
+	std::vector<byte> &buffer;
+
+	GRFScanCacheWriteBuffer(std::vector<byte> &buffer) : buffer(buffer) {}
+
+	std::vector<byte> &GetSerialisationBuffer() { return this->buffer; }
+	size_t GetSerialisationLimit() const { return SIZE_MAX; }
+};
+
+struct GRFScanCacheReadBuffer : public BufferDeserialisationHelper<GRFScanCacheReadBuffer> {
+	const byte *buffer;
+	size_t size;
+	size_t pos = 0;
+	bool error = false;
+
+	GRFScanCacheReadBuffer(const byte *buffer, size_t size) : buffer(buffer), size(size) {}
+
+	const byte *GetDeserialisationBuffer() const { return this->buffer; }
+	size_t GetDeserialisationBufferSize() const { return this->size; }
+	size_t &GetDeserialisationPosition() { return this->pos; }
+
+	bool CanDeserialiseBytes(size_t bytes_to_read, bool raise_error)
+	{
+		if (this->error) return false;
+
+		if (this->pos + bytes_to_read > this->size) {
+			if (raise_error) this->error = true;
+			return false;
+		}
+
+		return true;
+	}
+};
+
+/** Cached GRF texts were already validated when the GRF was first parsed, so keep them as-is. */
+static const StringValidationSettings GRF_SCAN_CACHE_SVS = SVS_REPLACE_WITH_QUESTION_MARK | SVS_ALLOW_CONTROL_CODE | SVS_ALLOW_NEWLINE;
+
+static std::string GetGRFScanCachePath()
+{
+	return _personal_dir + "newgrf-scan-cache.dat";
+}
+
+/**
+ * Get the change-detection identity of a file on disk.
+ * @param path Path of the file to check.
+ * @param[out] size Size of the file.
+ * @param[out] mtime Modification time of the file.
+ * @return Whether the file could be examined.
+ */
+static bool GetGRFScanFileIdentity(const std::string &path, uint64 &size, uint64 &mtime)
+{
+	struct stat sb;
+	if (stat(path.c_str(), &sb) != 0) return false;
+	size = (uint64)sb.st_size;
+	mtime = (uint64)sb.st_mtime;
+	return true;
+}
+
+static void SerialiseGRFTextList(GRFScanCacheWriteBuffer &buf, const GRFTextList &list)
+{
+	size_t count = std::min<size_t>(list.size(), UINT8_MAX);
+	buf.Send_uint8((uint8)count);
+	for (size_t i = 0; i < count; i++) {
+		buf.Send_uint8(list[i].langid);
+		buf.Send_string(list[i].text);
+	}
+}
+
+static void SerialiseGRFTextWrapper(GRFScanCacheWriteBuffer &buf, const GRFTextWrapper &wrapper)
+{
+	if (wrapper == nullptr) {
+		buf.Send_uint8(0);
+	} else {
+		SerialiseGRFTextList(buf, *wrapper);
+	}
+}
+
+static bool DeserialiseGRFTextList(GRFScanCacheReadBuffer &buf, GRFTextList &list)
+{
+	uint count = buf.Recv_uint8();
+	for (uint i = 0; i < count; i++) {
+		GRFText text;
+		text.langid = buf.Recv_uint8();
+		buf.Recv_string(text.text, GRF_SCAN_CACHE_SVS);
+		if (buf.error) return false;
+		list.push_back(std::move(text));
+	}
+	return !buf.error;
+}
+
+static bool DeserialiseGRFTextWrapper(GRFScanCacheReadBuffer &buf, GRFTextWrapper &wrapper)
+{
+	GRFTextList list;
+	if (!DeserialiseGRFTextList(buf, list)) return false;
+	if (!list.empty()) wrapper = std::make_shared<GRFTextList>(std::move(list));
+	return true;
+}
+
+/**
+ * Serialise the fields of a GRFConfig which are filled in by FillGRFDetails.
+ * @param c Config to serialise; its md5sum must have been fully computed.
+ * @param[out] data Buffer to serialise into.
+ */
+static void SerialiseScannedGRFConfig(const GRFConfig *c, std::vector<byte> &data)
+{
+	GRFScanCacheWriteBuffer buf(data);
+
+	buf.Send_uint32(c->ident.grfid);
+	buf.Send_binary((const char *)c->ident.md5sum, lengthof(c->ident.md5sum));
+	buf.Send_uint32(c->version);
+	buf.Send_uint32(c->min_loadable_version);
+	buf.Send_uint8(c->flags);
+	buf.Send_uint8(c->palette);
+	buf.Send_uint8(c->num_valid_params);
+	buf.Send_bool(c->has_param_defaults);
+	SerialiseGRFTextWrapper(buf, c->name);
+	SerialiseGRFTextWrapper(buf, c->info);
+	SerialiseGRFTextWrapper(buf, c->url);
+
+	buf.Send_uint8((uint8)c->param_info.size());
+	for (const GRFParameterInfo *info : c->param_info) {
+		buf.Send_bool(info != nullptr);
+		if (info == nullptr) continue;
+		buf.Send_uint8(info->type);
+		buf.Send_uint32(info->min_value);
+		buf.Send_uint32(info->max_value);
+		buf.Send_uint32(info->def_value);
+		buf.Send_uint8(info->param_nr);
+		buf.Send_uint8(info->first_bit);
+		buf.Send_uint8(info->num_bit);
+		buf.Send_bool(info->complete_labels);
+		SerialiseGRFTextList(buf, info->name);
+		SerialiseGRFTextList(buf, info->desc);
+		buf.Send_uint16((uint16)std::min<size_t>(info->value_names.size(), UINT16_MAX));
+		for (const auto &it : info->value_names) {
+			buf.Send_uint32(it.first);
+			SerialiseGRFTextList(buf, it.second);
+		}
+	}
+}
+
+/**
+ * Fill a fresh GRFConfig from a cached scan result.
+ * @param c Config to fill; on failure it is left partially filled and must be discarded.
+ * @param data Buffer created by SerialiseScannedGRFConfig.
+ * @return Whether the buffer was deserialised successfully.
+ */
+static bool DeserialiseScannedGRFConfig(GRFConfig *c, const std::vector<byte> &data)
+{
+	GRFScanCacheReadBuffer buf(data.data(), data.size());
+
+	c->ident.grfid = buf.Recv_uint32();
+	buf.Recv_binary((char *)c->ident.md5sum, lengthof(c->ident.md5sum));
+	c->version = buf.Recv_uint32();
+	c->min_loadable_version = buf.Recv_uint32();
+	c->flags = buf.Recv_uint8();
+	c->palette = buf.Recv_uint8();
+	c->num_valid_params = buf.Recv_uint8();
+	c->has_param_defaults = buf.Recv_bool();
+	if (!DeserialiseGRFTextWrapper(buf, c->name)) return false;
+	if (!DeserialiseGRFTextWrapper(buf, c->info)) return false;
+	if (!DeserialiseGRFTextWrapper(buf, c->url)) return false;
+
+	uint num_param_info = buf.Recv_uint8();
+	if (num_param_info > lengthof(c->param)) return false;
+	for (uint i = 0; i < num_param_info; i++) {
+		if (!buf.Recv_bool()) {
+			c->param_info.push_back(nullptr);
+			continue;
+		}
+		GRFParameterInfo *info = new GRFParameterInfo(i);
+		c->param_info.push_back(info);
+		info->type = (GRFParameterType)buf.Recv_uint8();
+		info->min_value = buf.Recv_uint32();
+		info->max_value = buf.Recv_uint32();
+		info->def_value = buf.Recv_uint32();
+		info->param_nr = buf.Recv_uint8();
+		info->first_bit = buf.Recv_uint8();
+		info->num_bit = buf.Recv_uint8();
+		info->complete_labels = buf.Recv_bool();
+		if (info->type >= PTYPE_END) return false;
+		if (info->param_nr >= lengthof(c->param) || info->first_bit >= 32 || info->num_bit > 32) return false;
+		if (!DeserialiseGRFTextList(buf, info->name)) return false;
+		if (!DeserialiseGRFTextList(buf, info->desc)) return false;
+		uint num_values = buf.Recv_uint16();
+		for (uint j = 0; j < num_values; j++) {
+			uint32 value = buf.Recv_uint32();
+			GRFTextList list;
+			if (!DeserialiseGRFTextList(buf, list)) return false;
+			info->value_names.Insert(value, list);
+		}
+	}
+	if (buf.error || buf.pos != buf.size) return false;
+
+	/* Entries are only written for files which scanned successfully, so this should not trigger. */
+	if (c->ident.grfid == 0 || HasBit(c->flags, GCF_SYSTEM)) return false;
+
+	return true;
+}
+
+static void LoadGRFScanCache()
+{
+	static bool loaded = false;
+	if (loaded) return;
+	loaded = true;
+
+	FILE *f = fopen(GetGRFScanCachePath().c_str(), "rb");
+	if (f == nullptr) return;
+
+	std::vector<byte> file_data;
+	if (fseek(f, 0, SEEK_END) == 0) {
+		long pos = ftell(f);
+		if (pos > 0 && pos <= (64 << 20) && fseek(f, 0, SEEK_SET) == 0) {
+			file_data.resize(pos);
+			if (fread(file_data.data(), file_data.size(), 1, f) != 1) file_data.clear();
+		}
+	}
+	fclose(f);
+
+	GRFScanCacheReadBuffer buf(file_data.data(), file_data.size());
+	if (buf.Recv_uint32() != GRF_SCAN_CACHE_MAGIC || buf.Recv_uint32() != GRF_SCAN_CACHE_VERSION) return;
+
+	uint32 count = buf.Recv_uint32();
+	for (uint i = 0; i < count && !buf.error; i++) {
+		std::string name;
+		buf.Recv_binary(name, buf.Recv_uint16());
+		GRFScanCacheEntry entry;
+		entry.size = buf.Recv_uint64();
+		entry.mtime = buf.Recv_uint64();
+		uint32 data_len = buf.Recv_uint32();
+		if (data_len > (1 << 20)) buf.error = true;
+		if (buf.error) break;
+		entry.data.resize(data_len);
+		buf.Recv_binary((char *)entry.data.data(), data_len);
+		if (buf.error) break;
+		_grf_scan_cache[std::move(name)] = std::move(entry);
+	}
+	if (buf.error) {
+		DEBUG(grf, 1, "Discarding unusable NewGRF scan cache");
+		_grf_scan_cache.clear();
+	} else {
+		DEBUG(grf, 2, "Loaded NewGRF scan cache with " PRINTF_SIZE " entries", _grf_scan_cache.size());
+	}
+}
+
+static void SaveGRFScanCache()
+{
+	if (!_grf_scan_cache_modified) return;
+	_grf_scan_cache_modified = false;
+
+	std::vector<byte> file_data;
+	GRFScanCacheWriteBuffer buf(file_data);
+	buf.Send_uint32(GRF_SCAN_CACHE_MAGIC);
+	buf.Send_uint32(GRF_SCAN_CACHE_VERSION);
+	buf.Send_uint32((uint32)_grf_scan_cache.size());
+	for (const auto &it : _grf_scan_cache) {
+		buf.Send_uint16((uint16)it.first.size());
+		buf.Send_binary(it.first.data(), it.first.size());
+		buf.Send_uint64(it.second.size);
+		buf.Send_uint64(it.second.mtime);
+		buf.Send_uint32((uint32)it.second.data.size());
+		buf.Send_binary((const char *)it.second.data.data(), it.second.data.size());
+	}
+
+	std::string path = GetGRFScanCachePath();
+	std::string tmp_path = path + ".tmp";
+	FILE *f = fopen(tmp_path.c_str(), "wb");
+	if (f == nullptr) {
+		DEBUG(grf, 0, "Failed to write NewGRF scan cache file: %s", tmp_path.c_str());
+		return;
+	}
+	bool ok = fwrite(file_data.data(), file_data.size(), 1, f) == 1;
+	fclose(f);
+
+	if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+		DEBUG(grf, 0, "Failed to write NewGRF scan cache file: %s", path.c_str());
+		unlink(tmp_path.c_str());
+		return;
+	}
+	DEBUG(grf, 2, "Wrote NewGRF scan cache file: %s, " PRINTF_SIZE " entries", path.c_str(), _grf_scan_cache.size());
+}
+
 /** Set this flag to prevent any NewGRF scanning from being done. */
 int _skip_all_newgrf_scanning = 0;
 
@@ -675,6 +990,15 @@ class GRFFileScanner : FileScanner {
 	uint num_scanned; ///< The number of GRFs we have scanned.
 	std::vector<GRFConfig *> grfs;
 
+	/** Freshly scanned file to be added to the scan cache once its md5sum is complete. */
+	struct PendingCacheEntry {
+		const GRFConfig *config; ///< Scanned config; owned by #grfs.
+		std::string filename;    ///< Key to store the entry under.
+		uint64 size;             ///< File identity: size.
+		uint64 mtime;            ///< File identity: modification time.
+	};
+	std::vector<PendingCacheEntry> pending_cache;
+
 public:
 	GRFFileScanner() : num_scanned(0)
 	{
@@ -683,6 +1007,36 @@ public:
 
 	bool AddFile(const std::string &filename, size_t basepath_length, const std::string &tar_filename) override;
 
+	/** Record freshly scanned files in the scan cache and write it back to disk. */
+	void FlushScanCache()
+	{
+		/* When the scan was aborted the md5 threads skip hashing, don't cache bogus sums. */
+		if (_exit_game) return;
+
+		for (const PendingCacheEntry &pending : this->pending_cache) {
+			GRFScanCacheEntry &entry = _grf_scan_cache[pending.filename];
+			entry.size = pending.size;
+			entry.mtime = pending.mtime;
+			entry.data.clear();
+			SerialiseScannedGRFConfig(pending.config, entry.data);
+			entry.used = true;
+			_grf_scan_cache_modified = true;
+		}
+		this->pending_cache.clear();
+
+		/* Drop entries for files which no longer exist or have changed. */
+		for (auto it = _grf_scan_cache.begin(); it != _grf_scan_cache.end();) {
+			if (!it->second.used) {
+				it = _grf_scan_cache.erase(it);
+				_grf_scan_cache_modified = true;
+			} else {
+				++it;
+			}
+		}
+
+		SaveGRFScanCache();
+	}
+
 	/** Do the scan for GRFs. */
 	static uint DoScan()
 	{
@@ -691,11 +1045,15 @@ public:
 			return 0;
 		}
 
+		LoadGRFScanCache();
+		for (auto &it : _grf_scan_cache) it.second.used = false;
+
 		CalcGRFMD5ThreadingStart();
 		GRFFileScanner fs;
 		fs.grfs.clear();
 		int ret = fs.Scan(".grf", NEWGRF_DIR);
 		CalcGRFMD5ThreadingEnd();
+		fs.FlushScanCache();
 
 		for (GRFConfig *c : fs.grfs) {
 			bool added = true;
@@ -741,7 +1099,34 @@ bool GRFFileScanner::AddFile(const std::string &filename, size_t basepath_length
 
 	GRFConfig *c = new GRFConfig(filename.c_str() + basepath_length);
 
-	bool added = FillGRFDetails(c, false);
+	uint64 file_size = 0;
+	uint64 file_mtime = 0;
+	const std::string &identity_file = tar_filename.empty() ? filename : tar_filename;
+	bool have_identity = GetGRFScanFileIdentity(identity_file, file_size, file_mtime);
+
+	bool added = false;
+	if (have_identity) {
+		auto iter = _grf_scan_cache.find(filename);
+		if (iter != _grf_scan_cache.end() && iter->second.size == file_size && iter->second.mtime == file_mtime) {
+			if (DeserialiseScannedGRFConfig(c, iter->second.data)) {
+				iter->second.used = true;
+				added = true;
+			} else {
+				/* Corrupt entry, fall back to scanning the file. */
+				delete c;
+				c = new GRFConfig(filename.c_str() + basepath_length);
+			}
+		}
+	}
+
+	if (!added) {
+		added = FillGRFDetails(c, false);
+		if (added && have_identity) {
+			/* The md5sum is computed asynchronously; defer serialising the
+			 * entry until the hashing threads have been joined. */
+			this->pending_cache.push_back({ c, filename, file_size, file_mtime });
+		}
+	}
 	if (added) {
 		this->grfs.push_back(c);
 	}
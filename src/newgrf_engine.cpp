@@ -1151,6 +1151,9 @@ static uint32 VehicleGetVariable(Vehicle *v, const VehicleScopeResolver *object,
 
 /* virtual */ const SpriteGroup *VehicleResolverObject::ResolveReal(const RealSpriteGroup *group) const
 {
+	/* The set choice below reads vehicle state the input recorder cannot see. */
+	if (_sprite_group_input_recorder.active) _sprite_group_input_recorder.MarkUncacheable();
+
 	const Vehicle *v = this->self_scope.v;
 
 	if (v == nullptr) {
@@ -1350,6 +1353,27 @@ int GetVehicleProperty(const Vehicle *v, PropertyID property, int orig_value, bo
 }
 
 
+/** A memoised callback 36 result, valid while replaying its reads yields the recorded values. */
+struct CB36ResultMemoEntry {
+	std::vector<SpriteGroupVariableRead> reads;
+	uint16 result;
+};
+
+static const size_t CB36_RESULT_MEMO_MAX_ENTRIES = 8; ///< Maximum number of distinct input states memoised per group/property.
+
+/**
+ * Memoised callback 36 results, keyed on root sprite group and property.
+ * Vehicles of the same engine and state validate against the same entry,
+ * so a homogeneous fleet resolves the chain once instead of per vehicle.
+ */
+static btree::btree_map<std::pair<const SpriteGroup *, uint8>, std::vector<CB36ResultMemoEntry>> _cb36_result_memo;
+
+/** To be called when sprite groups are (re)created, invalidating memoised pointers. */
+void ClearEngineCB36ResultMemo()
+{
+	_cb36_result_memo.clear();
+}
+
 int GetEngineProperty(EngineID engine, PropertyID property, int orig_value, const Vehicle *v, bool is_signed)
 {
 	const Engine *e = Engine::Get(engine);
@@ -1362,7 +1386,34 @@ int GetEngineProperty(EngineID engine, PropertyID property, int orig_value, cons
 			if (!HasBit(iter->second, property)) return orig_value;
 		}
 	}
-	uint16 callback = object.ResolveCallback();
+
+	uint16 callback = CALLBACK_FAILED;
+	bool resolved = false;
+	std::vector<CB36ResultMemoEntry> *memo = nullptr;
+	if (static_cast<uint>(property) < 64) {
+		memo = &_cb36_result_memo[std::make_pair(object.root_spritegroup, (uint8)property)];
+		for (CB36ResultMemoEntry &entry : *memo) {
+			if (ValidateSpriteGroupVariableReads(object, entry.reads)) {
+				callback = entry.result;
+				resolved = true;
+				break;
+			}
+		}
+	}
+
+	if (!resolved) {
+		bool record = memo != nullptr && !_sprite_group_input_recorder.active;
+		if (record) _sprite_group_input_recorder.Start();
+		callback = object.ResolveCallback();
+		if (record) {
+			_sprite_group_input_recorder.Stop();
+			if (_sprite_group_input_recorder.cacheable) {
+				if (memo->size() >= CB36_RESULT_MEMO_MAX_ENTRIES) memo->erase(memo->begin());
+				memo->push_back({ std::move(_sprite_group_input_recorder.reads), callback });
+			}
+		}
+	}
+
 	if (callback != CALLBACK_FAILED) {
 		if (is_signed) {
 			/* Sign extend 15 bit integer */
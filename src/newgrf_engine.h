@@ -102,6 +102,7 @@ bool UsesWagonOverride(const Vehicle *v);
  * time) orig_value is returned */
 int GetVehicleProperty(const Vehicle *v, PropertyID property, int orig_value, bool is_signed = false);
 int GetEngineProperty(EngineID engine, PropertyID property, int orig_value, const Vehicle *v = nullptr, bool is_signed = false);
+void ClearEngineCB36ResultMemo();
 
 enum VehicleTrigger {
 	VEHICLE_TRIGGER_NEW_CARGO     = 0x01,
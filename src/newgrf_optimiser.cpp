@@ -15,7 +15,11 @@
 #include "core/y_combinator.hpp"
 #include "scope.h"
 #include "newgrf_station.h"
+#include "worker_thread.h"
+#include "3rdparty/cpp-btree/btree_set.h"
 
+#include <atomic>
+#include <mutex>
 #include <tuple>
 
 #include "safeguards.h"
@@ -1808,6 +1812,25 @@ static bool CheckDeterministicSpriteGroupOutputVarBits(const DeterministicSprite
 	return dse;
 }
 
+/**
+ * Protects the parts of \c _cur which are shared between the per-group optimisation
+ * pass jobs dispatched by HandleVarAction2OptimisationPasses(): the group variable
+ * tracking and procedure annotation maps (including their arena allocators).
+ * Accessors on paths which only run during sequential sprite group loading are
+ * deliberately left unsynchronised.
+ */
+static std::mutex _varaction2_optimiser_state_lock;
+
+/**
+ * Thread-safe wrapper around GrfProcessingState::GetVarAction2GroupVariableTracking,
+ * for use in the optimisation passes which may run concurrently on the worker pool.
+ */
+static VarAction2GroupVariableTracking *GetVarAction2GroupVariableTrackingShared(const SpriteGroup *group, bool make_new)
+{
+	std::lock_guard<std::mutex> lock(_varaction2_optimiser_state_lock);
+	return _cur.GetVarAction2GroupVariableTracking(group, make_new);
+}
+
 static bool OptimiseVarAction2DeterministicSpriteGroupExpensiveVarsInner(DeterministicSpriteGroup *group, const GrfSpecFeature scope_feature, VarAction2GroupVariableTracking *var_tracking)
 {
 	btree::btree_map<uint64, uint32> seen_expensive_variables;
@@ -1916,7 +1939,7 @@ static bool OptimiseVarAction2DeterministicSpriteGroupExpensiveVarsInner(Determi
 			if (adjust.variable == 0x7E) {
 				auto handle_group = y_combinator([&](auto handle_group, const SpriteGroup *sg) -> void {
 					if (sg != nullptr && sg->type == SGT_DETERMINISTIC) {
-						VarAction2GroupVariableTracking *var_tracking = _cur.GetVarAction2GroupVariableTracking(sg, false);
+						VarAction2GroupVariableTracking *var_tracking = GetVarAction2GroupVariableTrackingShared(sg, false);
 						if (var_tracking != nullptr) usable_vars &= ~var_tracking->in;
 					}
 					if (sg != nullptr && sg->type == SGT_RANDOMIZED) {
@@ -1942,7 +1965,7 @@ static bool OptimiseVarAction2DeterministicSpriteGroupExpensiveVarsInner(Determi
 
 static void OptimiseVarAction2DeterministicSpriteGroupExpensiveVars(DeterministicSpriteGroup *group, const GrfSpecFeature scope_feature)
 {
-	VarAction2GroupVariableTracking *var_tracking = _cur.GetVarAction2GroupVariableTracking(group, false);
+	VarAction2GroupVariableTracking *var_tracking = GetVarAction2GroupVariableTrackingShared(group, false);
 	while (OptimiseVarAction2DeterministicSpriteGroupExpensiveVarsInner(group, scope_feature, var_tracking)) {}
 }
 
@@ -2113,6 +2136,11 @@ static bool TryCombineTempStoreLoadWithStoreSourceAdjust(DeterministicSpriteGrou
 
 static VarAction2ProcedureAnnotation *OptimiseVarAction2GetFilledProcedureAnnotation(const SpriteGroup *group)
 {
+	/* Hold the lock across the fill as well, so that a concurrent caller for the same
+	 * procedure never sees a partially-filled annotation. The lock release/acquire pair
+	 * also publishes the filled contents for lock-free reading afterwards. */
+	std::lock_guard<std::mutex> lock(_varaction2_optimiser_state_lock);
+
 	VarAction2ProcedureAnnotation *anno;
 	bool is_new;
 	std::tie(anno, is_new) = _cur.GetVarAction2ProcedureAnnotation(group);
@@ -2210,7 +2238,10 @@ struct VarAction2ProcedureCallVarReadAnnotation {
 	std::bitset<256> last_reads;
 	bool unskippable;
 };
-static std::vector<VarAction2ProcedureCallVarReadAnnotation> _varaction2_proc_call_var_read_annotations;
+/* This is per-group scratch state: it is populated and then consumed and cleared again
+ * within OptimiseVarAction2DeterministicSpriteGroupInsertJumps, so it only needs to be
+ * thread-local for the optimisation passes to run concurrently on the worker pool. */
+static thread_local std::vector<VarAction2ProcedureCallVarReadAnnotation> _varaction2_proc_call_var_read_annotations;
 
 static void OptimiseVarAction2DeterministicSpriteGroupPopulateLastVarReadAnnotations(DeterministicSpriteGroup *group, VarAction2GroupVariableTracking *var_tracking)
 {
@@ -2288,7 +2319,7 @@ static void OptimiseVarAction2DeterministicSpriteGroupPopulateLastVarReadAnnotat
 					anno.unskippable = true;
 				} else if (sg->type == SGT_DETERMINISTIC) {
 					const DeterministicSpriteGroup *sub = static_cast<const DeterministicSpriteGroup *>(sg);
-					VarAction2GroupVariableTracking *var_tracking = _cur.GetVarAction2GroupVariableTracking(sub, false);
+					VarAction2GroupVariableTracking *var_tracking = GetVarAction2GroupVariableTrackingShared(sub, false);
 					if (var_tracking != nullptr) {
 						bits |= var_tracking->in;
 						anno.last_reads |= (var_tracking->in & ~orig_bits);
@@ -3021,7 +3052,7 @@ static std::bitset<256> HandleVarAction2DeadStoreElimination(DeterministicSprite
 					}
 				} else if (sg->type == SGT_DETERMINISTIC) {
 					const DeterministicSpriteGroup *sub = static_cast<const DeterministicSpriteGroup *>(sg);
-					VarAction2GroupVariableTracking *var_tracking = _cur.GetVarAction2GroupVariableTracking(sub, false);
+					VarAction2GroupVariableTracking *var_tracking = GetVarAction2GroupVariableTrackingShared(sub, false);
 					if (var_tracking != nullptr) {
 						all_bits |= var_tracking->in;
 						propagate_bits |= var_tracking->in;
@@ -3082,63 +3113,161 @@ static void PopulateRailStationAdvancedLayoutVariableUsage()
 	}
 }
 
+static void HandleVarAction2OptimisationPassesForGroup(DeterministicSpriteGroup *group)
+{
+	VarAction2GroupVariableTracking *var_tracking = GetVarAction2GroupVariableTrackingShared(group, false);
+	if (!group->calculated_result) {
+		/* Add bits from any groups previously marked with DSGF_VAR_TRACKING_PENDING which should now be correctly updated after DSE */
+		auto handle_group = y_combinator([&](auto handle_group, const SpriteGroup *sg) -> void {
+			if (sg != nullptr && sg->type == SGT_DETERMINISTIC) {
+				VarAction2GroupVariableTracking *targ_var_tracking = GetVarAction2GroupVariableTrackingShared(sg, false);
+				if (targ_var_tracking != nullptr) {
+					if (var_tracking == nullptr) var_tracking = GetVarAction2GroupVariableTrackingShared(group, true);
+					var_tracking->out |= targ_var_tracking->in;
+				}
+			}
+			if (sg != nullptr && sg->type == SGT_RANDOMIZED) {
+				const RandomizedSpriteGroup *rsg = (const RandomizedSpriteGroup*)sg;
+				for (const auto &group : rsg->groups) {
+					handle_group(group);
+				}
+			}
+		});
+		handle_group(group->default_group);
+		group->default_group = PruneTargetSpriteGroup(group->default_group);
+		for (auto &range : group->ranges) {
+			handle_group(range.group);
+			range.group = PruneTargetSpriteGroup(range.group);
+		}
+	}
+
+	/* Always run this even DSGF_NO_DSE is set because the load/store tracking is needed to re-calculate the input bits,
+	 * even if no stores are actually eliminated */
+	std::bitset<256> in_bits = HandleVarAction2DeadStoreElimination(group, var_tracking, group->dsg_flags & DSGF_NO_DSE);
+	if (var_tracking == nullptr && in_bits.any()) {
+		var_tracking = GetVarAction2GroupVariableTrackingShared(group, true);
+		var_tracking->in = in_bits;
+	} else if (var_tracking != nullptr) {
+		var_tracking->in = in_bits;
+	}
+
+	const GrfSpecFeature scope_feature = GetGrfSpecFeatureForScope(group->feature, group->var_scope);
+
+	OptimiseVarAction2DeterministicSpriteGroupSimplifyStores(group);
+	OptimiseVarAction2DeterministicSpriteGroupAdjustOrdering(group, scope_feature);
+	if (group->dsg_flags & DSGF_CHECK_INSERT_JUMP) {
+		OptimiseVarAction2DeterministicSpriteGroupInsertJumps(group, var_tracking);
+	}
+	if (group->dsg_flags & DSGF_CHECK_EXPENSIVE_VARS) {
+		OptimiseVarAction2DeterministicSpriteGroupExpensiveVars(group, scope_feature);
+	}
+	if (group->dsg_flags & DSGF_CHECK_INSERT_JUMP) {
+		OptimiseVarAction2DeterministicSpriteResolveJumps(group);
+	}
+}
+
+/** Worker pool scheduling state for the optimisation passes on one DSE candidate group. */
+struct VarAction2OptimiserTask {
+	DeterministicSpriteGroup *group = nullptr;         ///< Group to run the optimisation passes on.
+	std::vector<uint32> dependents;                    ///< Indices of tasks which depend on this task.
+	std::atomic<uint32> unfinished_dependencies{0};    ///< Number of tasks which must complete before this task may run.
+};
+
+static void HandleVarAction2OptimisationPassesJob(void *data1, void *data2, void *data3)
+{
+	VarAction2OptimiserTask *tasks = static_cast<VarAction2OptimiserTask *>(data1);
+	VarAction2OptimiserTask &task = tasks[reinterpret_cast<uintptr_t>(data2)];
+	WorkerJobGroup *job_group = static_cast<WorkerJobGroup *>(data3);
+
+	HandleVarAction2OptimisationPassesForGroup(task.group);
+
+	for (uint32 dependent : task.dependents) {
+		if (tasks[dependent].unfinished_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			_general_worker_pool.EnqueueJob(&HandleVarAction2OptimisationPassesJob, data1, reinterpret_cast<void *>((uintptr_t)dependent), data3, job_group);
+		}
+	}
+}
+
 void HandleVarAction2OptimisationPasses()
 {
 	if (unlikely(HasGrfOptimiserFlag(NGOF_NO_OPT_VARACT2))) return;
 
 	PopulateRailStationAdvancedLayoutVariableUsage();
 
-	for (DeterministicSpriteGroup *group : _cur.dead_store_elimination_candidates) {
-		VarAction2GroupVariableTracking *var_tracking = _cur.GetVarAction2GroupVariableTracking(group, false);
-		if (!group->calculated_result) {
-			/* Add bits from any groups previously marked with DSGF_VAR_TRACKING_PENDING which should now be correctly updated after DSE */
-			auto handle_group = y_combinator([&](auto handle_group, const SpriteGroup *sg) -> void {
-				if (sg != nullptr && sg->type == SGT_DETERMINISTIC) {
-					VarAction2GroupVariableTracking *targ_var_tracking = _cur.GetVarAction2GroupVariableTracking(sg, false);
-					if (targ_var_tracking != nullptr) {
-						if (var_tracking == nullptr) var_tracking = _cur.GetVarAction2GroupVariableTracking(group, true);
-						var_tracking->out |= targ_var_tracking->in;
-					}
+	const std::vector<DeterministicSpriteGroup *> &candidates = _cur.dead_store_elimination_candidates;
+
+	if (!_general_worker_pool.HasWorkers() || candidates.size() < 4) {
+		/* Without workers EnqueueJob() executes jobs inline, which would recurse down dependency chains. */
+		for (DeterministicSpriteGroup *group : candidates) {
+			HandleVarAction2OptimisationPassesForGroup(group);
+		}
+		return;
+	}
+
+	/* The passes for one group read state which the passes for groups referenced by it write:
+	 * the variable tracking input bits, the post-DSE adjusts (via procedure annotations), and
+	 * the pruned default/range pointers. Sprite groups only reference previously defined groups,
+	 * so the candidate list (in creation order) is already topologically sorted; build a
+	 * dependency graph over it and dispatch each task once all tasks it references are done.
+	 * Candidates only reachable through other candidates are ordered transitively. */
+	std::vector<VarAction2OptimiserTask> tasks(candidates.size());
+	btree::btree_map<const SpriteGroup *, uint32> task_indices;
+	for (uint32 i = 0; i < (uint32)candidates.size(); i++) {
+		tasks[i].group = candidates[i];
+		task_indices[candidates[i]] = i;
+	}
+
+	for (uint32 i = 0; i < (uint32)tasks.size(); i++) {
+		uint32 dependency_count = 0;
+		btree::btree_set<const SpriteGroup *> visited;
+		visited.insert(tasks[i].group);
+		auto scan_refs = y_combinator([&](auto scan_refs, const SpriteGroup *sg) -> void {
+			if (sg == nullptr || !visited.insert(sg).second) return;
+			if (sg->type == SGT_RANDOMIZED) {
+				const RandomizedSpriteGroup *rsg = (const RandomizedSpriteGroup*)sg;
+				for (const auto &group : rsg->groups) {
+					scan_refs(group);
 				}
-				if (sg != nullptr && sg->type == SGT_RANDOMIZED) {
-					const RandomizedSpriteGroup *rsg = (const RandomizedSpriteGroup*)sg;
-					for (const auto &group : rsg->groups) {
-						handle_group(group);
+			} else if (sg->type == SGT_DETERMINISTIC) {
+				auto iter = task_indices.find(sg);
+				if (iter != task_indices.end()) {
+					/* Reference to another candidate: order this task after its task. */
+					tasks[iter->second].dependents.push_back(i);
+					dependency_count++;
+					return;
+				}
+				const DeterministicSpriteGroup *dsg = static_cast<const DeterministicSpriteGroup *>(sg);
+				for (const DeterministicSpriteGroupAdjust &adjust : dsg->adjusts) {
+					if (adjust.variable == 0x7E) scan_refs(adjust.subroutine);
+				}
+				if (!dsg->calculated_result) {
+					scan_refs(dsg->default_group);
+					for (const auto &range : dsg->ranges) {
+						scan_refs(range.group);
 					}
 				}
-			});
-			handle_group(group->default_group);
-			group->default_group = PruneTargetSpriteGroup(group->default_group);
-			for (auto &range : group->ranges) {
-				handle_group(range.group);
-				range.group = PruneTargetSpriteGroup(range.group);
 			}
+		});
+		DeterministicSpriteGroup *group = tasks[i].group;
+		for (const DeterministicSpriteGroupAdjust &adjust : group->adjusts) {
+			if (adjust.variable == 0x7E) scan_refs(adjust.subroutine);
 		}
-
-		/* Always run this even DSGF_NO_DSE is set because the load/store tracking is needed to re-calculate the input bits,
-		 * even if no stores are actually eliminated */
-		std::bitset<256> in_bits = HandleVarAction2DeadStoreElimination(group, var_tracking, group->dsg_flags & DSGF_NO_DSE);
-		if (var_tracking == nullptr && in_bits.any()) {
-			var_tracking = _cur.GetVarAction2GroupVariableTracking(group, true);
-			var_tracking->in = in_bits;
-		} else if (var_tracking != nullptr) {
-			var_tracking->in = in_bits;
+		if (!group->calculated_result) {
+			scan_refs(group->default_group);
+			for (const auto &range : group->ranges) {
+				scan_refs(range.group);
+			}
 		}
+		tasks[i].unfinished_dependencies.store(dependency_count, std::memory_order_relaxed);
+	}
 
-		const GrfSpecFeature scope_feature = GetGrfSpecFeatureForScope(group->feature, group->var_scope);
-
-		OptimiseVarAction2DeterministicSpriteGroupSimplifyStores(group);
-		OptimiseVarAction2DeterministicSpriteGroupAdjustOrdering(group, scope_feature);
-		if (group->dsg_flags & DSGF_CHECK_INSERT_JUMP) {
-			OptimiseVarAction2DeterministicSpriteGroupInsertJumps(group, var_tracking);
-		}
-		if (group->dsg_flags & DSGF_CHECK_EXPENSIVE_VARS) {
-			OptimiseVarAction2DeterministicSpriteGroupExpensiveVars(group, scope_feature);
-		}
-		if (group->dsg_flags & DSGF_CHECK_INSERT_JUMP) {
-			OptimiseVarAction2DeterministicSpriteResolveJumps(group);
+	WorkerJobGroup job_group;
+	for (uint32 i = 0; i < (uint32)tasks.size(); i++) {
+		if (tasks[i].unfinished_dependencies.load(std::memory_order_relaxed) == 0) {
+			_general_worker_pool.EnqueueJob(&HandleVarAction2OptimisationPassesJob, tasks.data(), reinterpret_cast<void *>((uintptr_t)i), &job_group, &job_group);
 		}
 	}
+	_general_worker_pool.WaitForGroupCompletion(&job_group);
 }
 
 const SpriteGroup *PruneTargetSpriteGroup(const SpriteGroup *result)
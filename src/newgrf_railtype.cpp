@@ -17,8 +17,28 @@
 #include "town.h"
 #include "signal_func.h"
 
+#include "3rdparty/cpp-btree/btree_map.h"
+
+#include <atomic>
+
 #include "safeguards.h"
 
+/** Cache of resolved custom signal sprites, see GetCustomSignalSprite. */
+struct CustomSignalSpriteCache {
+	btree::btree_map<std::pair<const RailtypeInfo *, uint64>, CustomSignalSpriteResult> entries;
+	uint64 tick = 0;  ///< Value of _scaled_tick_counter which the entries were resolved at.
+	uint32 epoch = 0; ///< Value of _custom_signal_sprite_cache_epoch which the entries were resolved at.
+};
+
+static std::atomic<uint32> _custom_signal_sprite_cache_epoch;
+static thread_local CustomSignalSpriteCache _custom_signal_sprite_cache;
+
+/** Invalidate all cached custom signal sprite resolutions, on all threads. */
+void InvalidateCustomSignalSpriteCache()
+{
+	_custom_signal_sprite_cache_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
 /* virtual */ uint32 RailTypeScopeResolver::GetRandomBits() const
 {
 	uint tmp = CountBits(this->tile + (TileX(this->tile) + TileY(this->tile)) * TILE_SIZE);
@@ -159,21 +179,9 @@ static PalSpriteID GetRailTypeCustomSignalSprite(const RailtypeInfo *rti, TileIn
 	return { group->GetResult(), pal };
 }
 
-/**
- * Get the sprite to draw for a given signal.
- * @param rti The rail type data (spec).
- * @param tile The tile to get the sprite for.
- * @param type Signal type.
- * @param var Signal variant.
- * @param state Signal state.
- * @param gui Is the sprite being used on the map or in the GUI?
- * @return The sprite to draw.
- */
-CustomSignalSpriteResult GetCustomSignalSprite(const RailtypeInfo *rti, TileIndex tile, SignalType type, SignalVariant var, uint8 aspect,
+static CustomSignalSpriteResult ResolveCustomSignalSprite(const RailtypeInfo *rti, TileIndex tile, SignalType type, SignalVariant var, uint8 aspect,
 		CustomSignalSpriteContext context, uint8 style, const TraceRestrictProgram *prog, uint z)
 {
-	if (_settings_client.gui.show_all_signal_default && style == 0) return { { 0, PAL_NONE }, false };
-
 	if (style == 0) {
 		PalSpriteID spr = GetRailTypeCustomSignalSprite(rti, tile, type, var, aspect, context, prog, z);
 		if (spr.sprite != 0) return { spr, HasBit(rti->ctrl_flags, RTCF_RESTRICTEDSIG) };
@@ -201,6 +209,65 @@ CustomSignalSpriteResult GetCustomSignalSprite(const RailtypeInfo *rti, TileInde
 	return { { 0, PAL_NONE }, false };
 }
 
+/**
+ * Get the sprite to draw for a given signal.
+ *
+ * The result is cached, keyed on the values of all the variables which the signal
+ * sprite resolvers can expose, so that identical resolutions are shared between all
+ * signals drawn in the same game tick.
+ *
+ * @param rti The rail type data (spec).
+ * @param tile The tile to get the sprite for.
+ * @param type Signal type.
+ * @param var Signal variant.
+ * @param aspect Signal aspect.
+ * @param context Signal context.
+ * @param style Signal style.
+ * @param prog Routing restriction program.
+ * @param z Signal pixel z.
+ * @return The sprite to draw.
+ */
+CustomSignalSpriteResult GetCustomSignalSprite(const RailtypeInfo *rti, TileIndex tile, SignalType type, SignalVariant var, uint8 aspect,
+		CustomSignalSpriteContext context, uint8 style, const TraceRestrictProgram *prog, uint z)
+{
+	if (_settings_client.gui.show_all_signal_default && style == 0) return { { 0, PAL_NONE }, false };
+
+	CustomSignalSpriteCache &cache = _custom_signal_sprite_cache;
+	const uint32 epoch = _custom_signal_sprite_cache_epoch.load(std::memory_order_relaxed);
+	if (cache.epoch != epoch || cache.tick != _scaled_tick_counter) {
+		/* Time-varying resolver inputs (e.g. the date or the animation counter) may have changed, start afresh. */
+		cache.entries.clear();
+		cache.epoch = epoch;
+		cache.tick = _scaled_tick_counter;
+	}
+
+	uint64 key = type;
+	key |= ((uint64)var) << 4;
+	key |= ((uint64)aspect) << 5;
+	key |= ((uint64)context) << 13;
+	key |= ((uint64)style) << 17;
+	if (prog != nullptr) key |= 1ULL << 21;
+	if (tile != INVALID_TILE) {
+		uint tmp = CountBits(tile + (TileX(tile) + TileY(tile)) * TILE_SIZE);
+		key |= ((uint64)GB(tmp, 0, 2)) << 22;
+		key |= ((uint64)GetNewSignalsRestrictedSignalsInfo(prog, tile, style)) << 24;
+		key |= ((uint64)(GetNewSignalsSignalContext(context, tile) >> 8)) << 27;
+		key |= ((uint64)GetTerrainType(tile, TCX_NORMAL)) << 28;
+		key |= ((uint64)GetNewSignalsVerticalClearanceInfo(tile, z)) << 32;
+	} else {
+		key |= 0xFFULL << 32;
+	}
+	key |= ((uint64)GetNewSignalsSideVariable()) << 40;
+
+	const std::pair<const RailtypeInfo *, uint64> cache_key(rti, key);
+	auto iter = cache.entries.lower_bound(cache_key);
+	if (iter != cache.entries.end() && iter->first == cache_key) return iter->second;
+
+	CustomSignalSpriteResult result = ResolveCustomSignalSprite(rti, tile, type, var, aspect, context, style, prog, z);
+	cache.entries.insert(iter, std::make_pair(cache_key, result));
+	return result;
+}
+
 /**
  * Translate an index to the GRF-local railtype-translation table into a RailType.
  * @param railtype  Index into GRF-local translation table.
@@ -31,6 +31,8 @@ std::map<const DeterministicSpriteGroup *, DeterministicSpriteGroupShadowCopy> _
 std::map<const RandomizedSpriteGroup *, RandomizedSpriteGroupShadowCopy> _randomized_sg_shadows;
 bool _grfs_loaded_with_sg_shadow_enable = false;
 
+SpriteGroupInputRecorder _sprite_group_input_recorder;
+
 GrfSpecFeature GetGrfSpecFeatureForParentScope(GrfSpecFeature feature)
 {
 	switch (feature) {
@@ -250,20 +252,47 @@ uint32 EvaluateDeterministicSpriteGroupAdjust(DeterministicSpriteGroupSize size,
 	}
 }
 
+/**
+ * Replay a list of recorded variable reads against \a object and check that
+ * each still yields the recorded value, i.e. that a result memoised together
+ * with these reads is still valid for \a object.
+ * @return True if every read matches.
+ */
+bool ValidateSpriteGroupVariableReads(ResolverObject &object, const std::vector<SpriteGroupVariableRead> &reads)
+{
+	for (const SpriteGroupVariableRead &read : reads) {
+		ScopeResolver *scope = object.GetScope(read.scope, read.scope_count);
+		GetVariableExtra extra(read.mask);
+		uint32 value = GetVariable(object, scope, read.variable, read.parameter, &extra);
+		if (!extra.available || value != read.value) return false;
+	}
+	return true;
+}
+
 static bool RangeHighComparator(const DeterministicSpriteGroupRange& range, uint32 value)
 {
 	return range.high < value;
 }
 
-const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+/*
+ * Evaluate the adjust list of a deterministic group.
+ *
+ * The adjusts are a flat linear program over the list (the optimiser inserts
+ * DSGA_OP_JZ et al to skip over dead regions), so this is the hot interpreter
+ * loop for all VarAction2 evaluation. It is templated on the operand size so
+ * that the per-adjust size dispatch is hoisted out of the loop and EvalAdjustT
+ * is fully inlined into one tight loop per size.
+ * @param result Result value of the adjust list, if it could be evaluated.
+ * @return True unless an unavailable variable was queried.
+ */
+template <typename U, typename S>
+static bool EvalDeterministicAdjusts(const DeterministicSpriteGroup *dsg, ResolverObject &object, ScopeResolver *scope, uint32 &result)
 {
 	uint32 last_value = 0;
 	uint32 value = 0;
 
-	ScopeResolver *scope = object.GetScope(this->var_scope, this->var_scope_count);
-
-	const DeterministicSpriteGroupAdjust *end = this->adjusts.data() + this->adjusts.size();
-	for (const DeterministicSpriteGroupAdjust *iter = this->adjusts.data(); iter != end; ++iter) {
+	const DeterministicSpriteGroupAdjust *end = dsg->adjusts.data() + dsg->adjusts.size();
+	for (const DeterministicSpriteGroupAdjust *iter = dsg->adjusts.data(); iter != end; ++iter) {
 		const DeterministicSpriteGroupAdjust &adjust = *iter;
 
 		if ((adjust.adjust_flags & DSGAF_SKIP_ON_ZERO) && (last_value == 0)) continue;
@@ -274,7 +303,7 @@ const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) con
 		if (adjust.variable == 0x7E) {
 			const Vehicle *relative_scope_vehicle = nullptr;
 			VarSpriteGroupScopeOffset relative_scope_cached_count = 0;
-			if (this->var_scope == VSG_SCOPE_RELATIVE) {
+			if (dsg->var_scope == VSG_SCOPE_RELATIVE) {
 				/* Save relative scope vehicle in case it will be changed during the procedure */
 				VehicleResolverObject *veh_object = dynamic_cast<VehicleResolverObject *>(&object);
 				if (veh_object != nullptr) {
@@ -306,21 +335,47 @@ const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) con
 		}
 
 		if (!extra.available) {
-			/* Unsupported variable: skip further processing and return either
-			 * the group from the first range or the default group. */
-			return SpriteGroup::Resolve(this->error_group, object, false);
+			if (_sprite_group_input_recorder.active) _sprite_group_input_recorder.MarkUncacheable();
+			return false;
 		}
 
-		switch (this->size) {
-			case DSG_SIZE_BYTE:  value = EvalAdjustT<uint8,  int8> (adjust, scope, last_value, value, &iter); break;
-			case DSG_SIZE_WORD:  value = EvalAdjustT<uint16, int16>(adjust, scope, last_value, value, &iter); break;
-			case DSG_SIZE_DWORD: value = EvalAdjustT<uint32, int32>(adjust, scope, last_value, value, &iter); break;
-			default: NOT_REACHED();
+		if (_sprite_group_input_recorder.active && adjust.variable != 0x7E) {
+			/* Reads made inside a procedure (0x7E) are recorded individually. */
+			if (adjust.operation == DSGA_OP_STOP) {
+				/* Persistent storage write: a side effect a replay would skip. */
+				_sprite_group_input_recorder.MarkUncacheable();
+			} else {
+				_sprite_group_input_recorder.RecordRead(dsg->var_scope, dsg->var_scope_count, adjust.variable, adjust.parameter, extra.mask, value);
+			}
 		}
+
+		value = EvalAdjustT<U, S>(adjust, scope, last_value, value, &iter);
 		last_value = value;
 	}
 
 	object.last_value = last_value;
+	result = value;
+	return true;
+}
+
+const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+{
+	ScopeResolver *scope = object.GetScope(this->var_scope, this->var_scope_count);
+
+	uint32 value = 0;
+	bool available;
+	switch (this->size) {
+		case DSG_SIZE_BYTE:  available = EvalDeterministicAdjusts<uint8,  int8> (this, object, scope, value); break;
+		case DSG_SIZE_WORD:  available = EvalDeterministicAdjusts<uint16, int16>(this, object, scope, value); break;
+		case DSG_SIZE_DWORD: available = EvalDeterministicAdjusts<uint32, int32>(this, object, scope, value); break;
+		default: NOT_REACHED();
+	}
+
+	if (!available) {
+		/* Unsupported variable: skip further processing and return either
+		 * the group from the first range or the default group. */
+		return SpriteGroup::Resolve(this->error_group, object, false);
+	}
 
 	if (this->calculated_result) {
 		/* nvar == 0 is a special case -- we turn our value into a callback result */
@@ -357,6 +412,9 @@ bool DeterministicSpriteGroup::GroupMayBeBypassed() const
 
 const SpriteGroup *RandomizedSpriteGroup::Resolve(ResolverObject &object) const
 {
+	/* Random bits and triggers are not visible to the input recorder. */
+	if (_sprite_group_input_recorder.active) _sprite_group_input_recorder.MarkUncacheable();
+
 	ScopeResolver *scope = object.GetScope(this->var_scope, this->var_scope_count);
 	if (object.callback == CBID_RANDOM_TRIGGER) {
 		/* Handle triggers */
@@ -630,6 +630,80 @@ struct GetVariableExtra {
 			: available(true), mask(mask_) {}
 };
 
+/** A single variable read observed while resolving a sprite group chain. */
+struct SpriteGroupVariableRead {
+	uint16 variable;
+	VarSpriteGroupScope scope;
+	VarSpriteGroupScopeOffset scope_count;
+	uint32 parameter;
+	uint32 mask;
+	uint32 value;
+};
+
+/**
+ * Records the variable reads made while resolving a sprite group chain.
+ *
+ * A deterministic chain is a pure function of the values its variable reads
+ * return, so a result can be memoised together with the recorded reads and
+ * reused as long as replaying the reads yields the same values (see
+ * ValidateSpriteGroupVariableReads()). Reads which depend on resolution state
+ * (chain registers, temporary storage, the previously computed result) cannot
+ * be replayed in isolation and mark the resolution as uncacheable, as do
+ * randomized groups and other sources of state not visible to the recorder.
+ */
+struct SpriteGroupInputRecorder {
+	static const size_t MAX_READS = 16; ///< Give up on chains reading more than this many variables.
+
+	bool active = false;   ///< Whether reads are currently being recorded.
+	bool cacheable = true; ///< Whether the resolution seen so far can be replayed.
+	std::vector<SpriteGroupVariableRead> reads;
+
+	void Start()
+	{
+		this->active = true;
+		this->cacheable = true;
+		this->reads.clear();
+	}
+
+	void Stop() { this->active = false; }
+
+	void MarkUncacheable()
+	{
+		this->active = false;
+		this->cacheable = false;
+	}
+
+	void RecordRead(VarSpriteGroupScope scope, VarSpriteGroupScopeOffset scope_count, uint16 variable, uint32 parameter, uint32 mask, uint32 value)
+	{
+		switch (variable) {
+			case 0x1C: // Previously computed result: resolution state.
+			case 0x61: // Variable of n-th vehicle: indirect via chain registers.
+			case 0x62: // Curvature/position of n-th vehicle: indirect via chain registers.
+			case 0x7B: // Variable of variable: parameter is the chain's last value.
+			case 0x7D: // Temporary storage read.
+				this->MarkUncacheable();
+				return;
+
+			default:
+				break;
+		}
+		if (scope == VSG_SCOPE_RELATIVE && HasBit(scope_count, 15)) {
+			/* Relative scope offset comes from a chain register. */
+			this->MarkUncacheable();
+			return;
+		}
+		if (this->reads.size() >= MAX_READS) {
+			this->MarkUncacheable();
+			return;
+		}
+		this->reads.push_back({ variable, scope, scope_count, parameter, mask, value });
+	}
+};
+
+extern SpriteGroupInputRecorder _sprite_group_input_recorder;
+
+bool ValidateSpriteGroupVariableReads(ResolverObject &object, const std::vector<SpriteGroupVariableRead> &reads);
+
 /**
  * Interface to query and set values specific to a single #VarSpriteGroupScope (action 2 scope).
  *
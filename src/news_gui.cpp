@@ -61,6 +61,14 @@ static const NewsItem *_forced_news = nullptr;
 /** Current news item (last item shown regularly). */
 static const NewsItem *_current_news = nullptr;
 
+/**
+ * Whether the message history window still needs to be marked dirty.
+ * Adding or deleting news items only sets this flag, the actual dirtying is
+ * done once per tick in NewsLoop(), so that mass events (e.g. the year end
+ * vehicle profit sweep) do not redo it for every single item.
+ */
+static bool _news_gui_update_pending = false;
+
 
 /**
  * Get the position a news-reference is referencing.
@@ -647,6 +655,7 @@ void InitNewsItemStructs()
 	_forced_news = nullptr;
 	_current_news = nullptr;
 	_statusbar_news_item = nullptr;
+	_news_gui_update_pending = false;
 	NewsWindow::duration = 0;
 }
 
@@ -701,6 +710,16 @@ static void MoveToNextTickerItem()
 				break;
 
 			case ND_SUMMARY: // Summary - show ticker
+				/* Rate-limit the ticker: when several items of the same type were
+				 * queued on the same date (e.g. a year end sweep of vehicle profit
+				 * warnings), only show the newest of the run. The skipped items
+				 * remain available in the message history. */
+				while (_statusbar_news_item != _latest_news) {
+					const NewsItem *next = _statusbar_news_item->next;
+					if (next->type != type || next->date != ni->date) break;
+					_statusbar_news_item = next;
+					ni = next;
+				}
 				ShowTicker(ni);
 				break;
 
@@ -789,7 +808,7 @@ static void DeleteNewsItem(NewsItem *ni)
 
 	delete ni;
 
-	SetWindowDirty(WC_MESSAGE_HISTORY, 0);
+	_news_gui_update_pending = true;
 }
 
 /**
@@ -851,7 +870,7 @@ void AddNewsItem(StringID string, NewsType type, NewsFlag flags, NewsReferenceTy
 		DeleteNewsItem(_oldest_news);
 	}
 
-	SetWindowDirty(WC_MESSAGE_HISTORY, 0);
+	_news_gui_update_pending = true;
 }
 
 /**
@@ -1016,6 +1035,11 @@ void ChangeVehicleNews(VehicleID from_index, VehicleID to_index)
 
 void NewsLoop()
 {
+	if (_news_gui_update_pending) {
+		_news_gui_update_pending = false;
+		SetWindowDirty(WC_MESSAGE_HISTORY, 0);
+	}
+
 	/* no news item yet */
 	if (_total_news == 0) return;
 
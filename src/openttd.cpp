@@ -126,6 +126,7 @@ bool _request_newgrf_scan = false;
 NewGRFScanCallback *_request_newgrf_scan_callback = nullptr;
 
 SimpleChecksum64 _state_checksum;
+SimpleChecksum64 _subsystem_state_checksums[SCA_END];
 
 /**
  * Error handling for fatal user errors.
@@ -264,6 +265,8 @@ static void ShowHelp()
 		"  -Q                  = Don't scan for/load NewGRF files on startup\n"
 		"  -QQ                 = Disable NewGRF scanning/loading entirely\n"
 		"  -Z                  = Write detailed version information and exit\n"
+		"  -J days             = Quit after this many in-game days\n"
+		"  -replay log_file    = Replay a recorded command log against the started savegame\n"
 		"\n",
 		lastof(buf)
 	);
@@ -440,6 +443,8 @@ static void ShutdownGame()
 
 	if (_network_available) NetworkShutDown(); // Shut down the network and close any open connections
 
+	SpriteDiskCacheSave();
+
 	DriverFactoryBase::ShutdownDrivers();
 
 	UnInitWindowSystem();
@@ -694,6 +699,7 @@ static const OptionData _options[] = {
 	 GETOPT_SHORT_NOVAL('Q'),
 	 GETOPT_SHORT_VALUE('J'),
 	 GETOPT_SHORT_NOVAL('Z'),
+	GETOPT_GENERAL('R', '\0', "-replay", ODF_HAS_VALUE),
 	GETOPT_END()
 };
 
@@ -841,6 +847,7 @@ int openttd_main(int argc, char *argv[])
 		case 'c': _config_file = mgo.opt; break;
 		case 'x': scanner->save_config = false; break;
 		case 'J': _quit_after_days = Clamp(atoi(mgo.opt), 0, INT_MAX); break;
+		case 'R': _replay_command_log_file = mgo.opt; break;
 		case 'Z': {
 			CrashLog::VersionInfoLog();
 			return ret;
@@ -1004,7 +1011,8 @@ int openttd_main(int argc, char *argv[])
 	/* ScanNewGRFFiles now has control over the scanner. */
 	RequestNewGRFScan(scanner.release());
 
-	_general_worker_pool.Start("ottd:worker", 8);
+	_general_worker_pool.Start("ottd:worker", _worker_thread_count, ParseCpuAffinityMask(_worker_thread_affinity));
+	StartDebugOutputThread();
 
 	VideoDriver::GetInstance()->MainLoop();
 
@@ -1022,6 +1030,7 @@ int openttd_main(int argc, char *argv[])
 
 	/* Reset windowing system, stop drivers, free used memory, ... */
 	ShutdownGame();
+	StopDebugOutputThread();
 	return ret;
 }
 
@@ -1584,6 +1593,16 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 			if (!(old_station_tiles[i] == st->station_tiles)) {
 				CCLOG("station station_tiles mismatch: st %i, (old: %u, new: %u)", (int)st->index, old_station_tiles[i], st->station_tiles);
 			}
+			/* goods_rating_pending may contain spurious extra bits, but must
+			 * cover every entry the rating sweep has work on. */
+			CargoTypes rating_pending = 0;
+			for (CargoID c = 0; c < NUM_CARGO; c++) {
+				const GoodsEntry &ge = st->goods[c];
+				if (ge.HasRating() || ge.rating < INITIAL_STATION_RATING) SetBit(rating_pending, c);
+			}
+			if ((st->goods_rating_pending & rating_pending) != rating_pending) {
+				CCLOG("station goods_rating_pending mismatch: st %i, (flagged: " OTTD_PRINTFHEX64 ", expected: " OTTD_PRINTFHEX64 ")", (int)st->index, st->goods_rating_pending, rating_pending);
+			}
 			i++;
 		}
 		i = 0;
@@ -1925,8 +1944,17 @@ void CheckCaches(bool force_check, std::function<void(const char *)> log, CheckC
 					++iter;
 				}
 			}
+			btree::btree_map<uint64, uint32> saved_order_destination_orderlist_map = std::move(_order_destination_orderlist_map);
+			for (auto iter = saved_order_destination_orderlist_map.begin(); iter != saved_order_destination_orderlist_map.end();) {
+				if (iter->second == 0) {
+					iter = saved_order_destination_orderlist_map.erase(iter);
+				} else {
+					++iter;
+				}
+			}
 			IntialiseOrderDestinationRefcountMap();
 			if (saved_order_destination_refcount_map != _order_destination_refcount_map) CCLOG("Order destination refcount map mismatch");
+			if (saved_order_destination_orderlist_map != _order_destination_orderlist_map) CCLOG("Order destination order list map mismatch");
 		} else {
 			CCLOG("Order destination refcount map not valid");
 		}
@@ -1971,6 +1999,9 @@ CommandCost CmdDesyncCheck(TileIndex tile, DoCommandFlag flags, uint32 p1, uint3
  */
 void StateGameLoop()
 {
+	/* The per-subsystem digests cover exactly one state frame. */
+	ResetSubsystemStateChecksums();
+
 	if (!_networking || _network_server) {
 		StateGameLoop_LinkGraphPauseControl();
 	}
@@ -1986,9 +2017,8 @@ void StateGameLoop()
 		PerformanceMeasurer::Paused(PFE_GL_LANDSCAPE);
 
 		if (!HasModalProgress()) UpdateLandscapingLimits();
-#ifndef DEBUG_DUMP_COMMANDS
-		Game::GameLoop();
-#endif
+		/* When replaying, the scripts' commands come from the replayed log. */
+		if (!IsReplayingCommands()) Game::GameLoop();
 		return;
 	}
 
@@ -2049,13 +2079,12 @@ void StateGameLoop()
 		}
 		BasePersistentStorageArray::SwitchMode(PSM_LEAVE_GAMELOOP);
 
-#ifndef DEBUG_DUMP_COMMANDS
-		{
+		/* When replaying, the scripts' commands come from the replayed log. */
+		if (!IsReplayingCommands()) {
 			PerformanceMeasurer script_framerate(PFE_ALLSCRIPTS);
 			AI::GameLoop();
 			Game::GameLoop();
 		}
-#endif
 		UpdateLandscapingLimits();
 
 		CallWindowGameTickEvent();
@@ -2064,24 +2093,24 @@ void StateGameLoop()
 		if (_networking) {
 			for (Company *c : Company::Iterate()) {
 				DEBUG_UPDATESTATECHECKSUM("Company: %u, Money: " OTTD_PRINTF64, c->index, (int64)c->money);
-				UpdateStateChecksum(c->money);
+				UpdateStateChecksum(c->money, SCA_ECONOMY);
 
 				for (uint i = 0; i < ROADTYPE_END; i++) {
 					DEBUG_UPDATESTATECHECKSUM("Company: %u, road[%u]: %u", c->index, i, c->infrastructure.road[i]);
-					UpdateStateChecksum(c->infrastructure.road[i]);
+					UpdateStateChecksum(c->infrastructure.road[i], SCA_ECONOMY);
 				}
 
 				for (uint i = 0; i < RAILTYPE_END; i++) {
 					DEBUG_UPDATESTATECHECKSUM("Company: %u, rail[%u]: %u", c->index, i, c->infrastructure.rail[i]);
-					UpdateStateChecksum(c->infrastructure.rail[i]);
+					UpdateStateChecksum(c->infrastructure.rail[i], SCA_ECONOMY);
 				}
 
 				DEBUG_UPDATESTATECHECKSUM("Company: %u, signal: %u, water: %u, station: %u, airport: %u",
 						c->index, c->infrastructure.signal, c->infrastructure.water, c->infrastructure.station, c->infrastructure.airport);
-				UpdateStateChecksum(c->infrastructure.signal);
-				UpdateStateChecksum(c->infrastructure.water);
-				UpdateStateChecksum(c->infrastructure.station);
-				UpdateStateChecksum(c->infrastructure.airport);
+				UpdateStateChecksum(c->infrastructure.signal, SCA_ECONOMY);
+				UpdateStateChecksum(c->infrastructure.water, SCA_ECONOMY);
+				UpdateStateChecksum(c->infrastructure.station, SCA_ECONOMY);
+				UpdateStateChecksum(c->infrastructure.airport, SCA_ECONOMY);
 			}
 		}
 		cur_company.Restore();
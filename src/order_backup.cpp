@@ -56,10 +56,11 @@ OrderBackup::OrderBackup(const Vehicle *v, uint32 user)
 	if (v->IsOrderListShared()) {
 		this->clone = (v->FirstShared() == v) ? v->NextShared() : v->FirstShared();
 	} else {
-		/* Else copy the orders */
+		/* Else copy the orders. The copies come from the order pool, like all
+		 * orders, so this does not touch the heap; autoreplace does not get
+		 * here at all, as it transfers orders by sharing with the old head. */
 		Order **tail = &this->orders;
 
-		/* Count the number of orders */
 		for (const Order *order : v->Orders()) {
 			Order *copy = new Order();
 			copy->AssignOrder(*order);
@@ -86,6 +87,8 @@ void OrderBackup::DoRestore(Vehicle *v)
 	if (this->clone != nullptr) {
 		DoCommand(0, v->index | CO_SHARE << 30, this->clone->index, DC_EXEC, CMD_CLONE_ORDER);
 	} else if (this->orders != nullptr && OrderList::CanAllocateItem()) {
+		/* Hand the whole backed up chain over to the new order list, rather
+		 * than copying it order by order. */
 		v->orders = new OrderList(this->orders, v);
 		this->orders = nullptr;
 
@@ -31,6 +31,7 @@ typedef Pool<OrderList, OrderListID, 128, 64000> OrderListPool;
 extern OrderPool _order_pool;
 extern OrderListPool _orderlist_pool;
 extern btree::btree_map<uint32, uint32> _order_destination_refcount_map;
+extern btree::btree_map<uint64, uint32> _order_destination_orderlist_map;
 extern bool _order_destination_refcount_map_valid;
 
 inline uint32 OrderDestinationRefcountMapKey(DestinationID dest, CompanyID cid, OrderType order_type, VehicleType veh_type)
@@ -48,6 +49,26 @@ template <typename F> void IterateOrderRefcountMapForDestinationID(DestinationID
 	}
 }
 
+inline uint64 OrderDestinationOrderListMapKey(DestinationID dest, VehicleType veh_type, OrderListID id)
+{
+	static_assert(sizeof(dest) == 2);
+	static_assert(VEH_END <= 16);
+	static_assert(sizeof(id) == 2);
+	return (((uint64) dest) << 24) | (((uint64) veh_type) << 20) | ((uint64) id);
+}
+
+/**
+ * Call handler with the OrderListID of each order list which contains at least one
+ * OT_GOTO_STATION, OT_GOTO_WAYPOINT or OT_IMPLICIT order to dest, for vehicles of type veh_type.
+ */
+template <typename F> void IterateOrderListsForDestinationID(DestinationID dest, VehicleType veh_type, F handler)
+{
+	for (auto lb = _order_destination_orderlist_map.lower_bound(OrderDestinationOrderListMapKey(dest, veh_type, (OrderListID) 0)); lb != _order_destination_orderlist_map.end(); ++lb) {
+		if ((lb->first >> 20) != ((((uint64) dest) << 4) | veh_type)) return;
+		if (lb->second) handler((OrderListID) GB(lb->first, 0, 20));
+	}
+}
+
 void IntialiseOrderDestinationRefcountMap();
 void ClearOrderDestinationRefcountMap();
 
@@ -837,13 +858,16 @@ private:
 	Ticks timetable_duration;         ///< NOSAVE: Total timetabled duration of the order list.
 	Ticks total_duration;             ///< NOSAVE: Total (timetabled or not) duration of the order list.
 
+	Date last_full_refresh_date;        ///< Date of the last deduplicated full link refresh, see LinkRefresher::Run().
+	uint64 last_full_refresh_signature; ///< Consist/cargo signature of the last deduplicated full link refresh, see LinkRefresher::Run().
+
 	std::vector<DispatchSchedule> dispatch_schedules; ///< Scheduled dispatch schedules
 
 public:
 	/** Default constructor producing an invalid order list. */
 	OrderList(VehicleOrderID num_orders = INVALID_VEH_ORDER_ID)
 		: first(nullptr), num_manual_orders(0), num_vehicles(0), first_shared(nullptr),
-		  timetable_duration(0), total_duration(0) { }
+		  timetable_duration(0), total_duration(0), last_full_refresh_date(0), last_full_refresh_signature(0) { }
 
 	/**
 	 * Create an order list with the given order chain for the given vehicle.
@@ -953,6 +977,31 @@ public:
 	 */
 	inline Ticks GetTotalDuration() const { return this->total_duration; }
 
+	/**
+	 * Check whether an equivalent full link refresh has already been performed on the given date.
+	 * @param date Current date.
+	 * @param signature Signature of the refresh run, see LinkRefresher::Run().
+	 * @return whether the refreshed links are already up to date for this signature.
+	 */
+	inline bool IsFullRefreshCurrent(Date date, uint64 signature) const
+	{
+		return this->last_full_refresh_date == date && this->last_full_refresh_signature == signature;
+	}
+
+	/**
+	 * Record that a full link refresh has been performed.
+	 * @param date Current date.
+	 * @param signature Signature of the refresh run, see LinkRefresher::Run().
+	 */
+	inline void SetLastFullRefresh(Date date, uint64 signature)
+	{
+		this->last_full_refresh_date = date;
+		this->last_full_refresh_signature = signature;
+	}
+
+	/** Forget the last recorded full link refresh, e.g. because the orders changed. */
+	inline void InvalidateFullRefresh() { this->last_full_refresh_date = 0; }
+
 	/**
 	 * Must be called if an order's timetable is changed to update internal book keeping.
 	 * @param delta By how many ticks has the timetable duration changed
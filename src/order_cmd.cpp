@@ -58,6 +58,7 @@ OrderListPool _orderlist_pool("OrderList");
 INSTANTIATE_POOL_METHODS(OrderList)
 
 btree::btree_map<uint32, uint32> _order_destination_refcount_map;
+btree::btree_map<uint64, uint32> _order_destination_orderlist_map;
 bool _order_destination_refcount_map_valid = false;
 
 CommandCost CmdInsertOrderIntl(DoCommandFlag flags, Vehicle *v, VehicleOrderID sel_ord, const Order &new_order, bool allow_load_by_cargo_type);
@@ -70,6 +71,7 @@ void IntialiseOrderDestinationRefcountMap()
 		for(const Order *order : v->Orders()) {
 			if (order->IsType(OT_GOTO_STATION) || order->IsType(OT_GOTO_WAYPOINT) || order->IsType(OT_IMPLICIT)) {
 				_order_destination_refcount_map[OrderDestinationRefcountMapKey(order->GetDestination(), v->owner, order->GetType(), v->type)]++;
+				_order_destination_orderlist_map[OrderDestinationOrderListMapKey(order->GetDestination(), v->type, v->orders->index)]++;
 			}
 		}
 	}
@@ -79,13 +81,15 @@ void IntialiseOrderDestinationRefcountMap()
 void ClearOrderDestinationRefcountMap()
 {
 	_order_destination_refcount_map.clear();
+	_order_destination_orderlist_map.clear();
 	_order_destination_refcount_map_valid = false;
 }
 
-void UpdateOrderDestinationRefcount(const Order *order, VehicleType type, Owner owner, int delta)
+void UpdateOrderDestinationRefcount(const Order *order, VehicleType type, Owner owner, const OrderList *list, int delta)
 {
 	if (order->IsType(OT_GOTO_STATION) || order->IsType(OT_GOTO_WAYPOINT) || order->IsType(OT_IMPLICIT)) {
 		_order_destination_refcount_map[OrderDestinationRefcountMapKey(order->GetDestination(), owner, order->GetType(), type)] += delta;
+		_order_destination_orderlist_map[OrderDestinationOrderListMapKey(order->GetDestination(), type, list->index)] += delta;
 	}
 }
 
@@ -426,8 +430,41 @@ void Order::DeAllocExtraInfo()
 	this->extra.reset();
 }
 
+/**
+ * Memoisation of next stopping station results across vehicles sharing an
+ * order list, see SetNextStoppingStationCacheEnabled. The result of
+ * FillNextStoppingStation only depends on the order list, the vehicle's
+ * current order index and its last visited station, so vehicles of a shared
+ * orders group loading at the same station can reuse it.
+ */
+static robin_hood::unordered_flat_map<uint64, CargoStationIDStackSet> _next_stopping_station_cache;
+static bool _next_stopping_station_cache_enabled = false;
+
+/**
+ * Enable or disable the next stopping station cache.
+ * This may only be enabled for sections where no order list is modified,
+ * such as the station load/unload loop; entries are not invalidated until
+ * the cache is disabled again.
+ * @param enabled Whether to enable the cache.
+ */
+void SetNextStoppingStationCacheEnabled(bool enabled)
+{
+	_next_stopping_station_cache_enabled = enabled;
+	_next_stopping_station_cache.clear();
+}
+
 void CargoStationIDStackSet::FillNextStoppingStation(const Vehicle *v, const OrderList *o, const Order *first, uint hops)
 {
+	uint64 cache_key = 0;
+	if (_next_stopping_station_cache_enabled && first == nullptr && hops == 0) {
+		cache_key = (((uint64)o->index) << 32) | (((uint64)v->cur_implicit_order_index) << 16) | v->last_station_visited;
+		auto iter = _next_stopping_station_cache.find(cache_key);
+		if (iter != _next_stopping_station_cache.end()) {
+			*this = iter->second;
+			return;
+		}
+	}
+
 	this->more.clear();
 	this->first = o->GetNextStoppingStation(v, ALL_CARGOTYPES, first, hops);
 	if (this->first.cargo_mask != ALL_CARGOTYPES) {
@@ -437,6 +474,10 @@ void CargoStationIDStackSet::FillNextStoppingStation(const Vehicle *v, const Ord
 			have_cargoes |= this->more.back().cargo_mask;
 		} while (have_cargoes != ALL_CARGOTYPES);
 	}
+
+	if (_next_stopping_station_cache_enabled && first == nullptr && hops == 0) {
+		_next_stopping_station_cache[cache_key] = *this;
+	}
 }
 
 void OrderList::ReindexOrderList()
@@ -445,6 +486,7 @@ void OrderList::ReindexOrderList()
 	for (Order *o = this->first; o != nullptr; o = o->next) {
 		this->order_index.push_back(o);
 	}
+	this->InvalidateFullRefresh();
 }
 
 bool OrderList::CheckOrderListIndexing() const
@@ -472,6 +514,7 @@ void OrderList::Initialize(Order *chain, Vehicle *v)
 	this->timetable_duration = 0;
 	this->total_duration = 0;
 	this->order_index.clear();
+	this->InvalidateFullRefresh();
 
 	VehicleType type = v->type;
 	Owner owner = v->owner;
@@ -483,7 +526,7 @@ void OrderList::Initialize(Order *chain, Vehicle *v)
 			this->total_duration += o->GetWaitTime() + o->GetTravelTime();
 		}
 		this->order_index.push_back(o);
-		RegisterOrderDestination(o, type, owner);
+		RegisterOrderDestination(o, type, owner, this);
 	}
 
 	for (Vehicle *u = this->first_shared->PreviousShared(); u != nullptr; u = u->PreviousShared()) {
@@ -519,7 +562,7 @@ void OrderList::FreeChain(bool keep_orderlist)
 	VehicleType type = this->GetFirstSharedVehicle()->type;
 	Owner owner = this->GetFirstSharedVehicle()->owner;
 	for (Order *o = this->first; o != nullptr; o = next) {
-		UnregisterOrderDestination(o, type, owner);
+		UnregisterOrderDestination(o, type, owner, this);
 		next = o->next;
 		delete o;
 	}
@@ -737,7 +780,7 @@ void OrderList::InsertOrderAt(Order *new_order, int index)
 		this->timetable_duration += new_order->GetTimetabledWait() + new_order->GetTimetabledTravel();
 		this->total_duration += new_order->GetWaitTime() + new_order->GetTravelTime();
 	}
-	RegisterOrderDestination(new_order, this->GetFirstSharedVehicle()->type, this->GetFirstSharedVehicle()->owner);
+	RegisterOrderDestination(new_order, this->GetFirstSharedVehicle()->type, this->GetFirstSharedVehicle()->owner, this);
 	this->ReindexOrderList();
 
 	/* We can visit oil rigs and buoys that are not our own. They will be shown in
@@ -773,7 +816,7 @@ void OrderList::DeleteOrderAt(int index)
 		this->timetable_duration -= (to_remove->GetTimetabledWait() + to_remove->GetTimetabledTravel());
 		this->total_duration -= (to_remove->GetWaitTime() + to_remove->GetTravelTime());
 	}
-	UnregisterOrderDestination(to_remove, this->GetFirstSharedVehicle()->type, this->GetFirstSharedVehicle()->owner);
+	UnregisterOrderDestination(to_remove, this->GetFirstSharedVehicle()->type, this->GetFirstSharedVehicle()->owner, this);
 	delete to_remove;
 	this->ReindexOrderList();
 }
@@ -2097,6 +2140,7 @@ CommandCost CmdModifyOrder(TileIndex tile, DoCommandFlag flags, uint32 p1, uint3
 	}
 
 	if (flags & DC_EXEC) {
+		v->orders->InvalidateFullRefresh();
 		switch (mof) {
 			case MOF_NON_STOP:
 				order->SetNonStopType((OrderNonStopFlags)data);
@@ -2733,6 +2777,7 @@ CommandCost CmdOrderRefit(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 	if (order->GetLoadType() & OLFB_NO_LOAD) return CMD_ERROR;
 
 	if (flags & DC_EXEC) {
+		v->orders->InvalidateFullRefresh();
 		order->SetRefit(cargo);
 
 		/* Make the depot order an 'always go' order. */
@@ -21,6 +21,7 @@ void CheckOrders(const Vehicle*);
 void DeleteVehicleOrders(Vehicle *v, bool keep_orderlist = false, bool reset_order_indices = true);
 bool ProcessOrders(Vehicle *v);
 bool UpdateOrderDest(Vehicle *v, const Order *order, int conditional_depth = 0, bool pbs_look_ahead = false);
+void SetNextStoppingStationCacheEnabled(bool enabled);
 
 enum ProcessConditionalOrderMode {
 	PCO_EXEC,
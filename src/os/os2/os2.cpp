@@ -213,6 +213,8 @@ void SetCurrentThreadName(const char *)
 {
 }
 
+void SetCurrentThreadAffinity(uint64) { }
+
 int GetCurrentThreadName(char *str, const char *last) { return 0; }
 
 void SetSelfAsMainThread() { }
@@ -533,6 +533,7 @@ class CrashLogUnix : public CrashLog {
 
 #if defined(WITH_BFD)
 		bfd_init();
+		sym_bfd_obj_cache bfd_obj_cache;
 #endif /* WITH_BFD */
 
 		for (int i = 0; i < trace_size; i++) {
@@ -581,7 +582,7 @@ class CrashLogUnix : public CrashLog {
 			/* subtract one to get the line before the return address, i.e. the function call line */
 			sym_info_bfd bfd_info(reinterpret_cast<bfd_vma>(trace[i]) - reinterpret_cast<bfd_vma>(info.dli_fbase) - 1);
 			if (dladdr_result && info.dli_fname) {
-				lookup_addr_bfd(info.dli_fname, bfd_info);
+				lookup_addr_bfd(info.dli_fname, bfd_obj_cache, bfd_info);
 				if (bfd_info.file_name != nullptr) file_name = bfd_info.file_name;
 				if (bfd_info.function_name != nullptr) func_name = bfd_info.function_name;
 				if (bfd_info.function_addr != 0) func_addr = reinterpret_cast<void *>(bfd_info.function_addr + reinterpret_cast<bfd_vma>(info.dli_fbase));
@@ -323,6 +323,19 @@ void SetCurrentThreadName(const char *threadName) {
 #endif /* defined(__APPLE__) */
 }
 
+void SetCurrentThreadAffinity(uint64 mask)
+{
+#if !defined(NO_THREADS) && defined(__GLIBC__)
+	if (mask == 0) return;
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	for (uint cpu = 0; cpu < 64; cpu++) {
+		if (mask & (((uint64) 1) << cpu)) CPU_SET(cpu, &cpuset);
+	}
+	pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#endif /* !defined(NO_THREADS) && defined(__GLIBC__) */
+}
+
 int GetCurrentThreadName(char *str, const char *last)
 {
 #if !defined(NO_THREADS) && defined(__GLIBC__)
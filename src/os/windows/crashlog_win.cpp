@@ -513,6 +513,10 @@ char *CrashLogWindows::AppendDecodedStacktrace(char *buffer, const char *last) c
 		sym_info->SizeOfStruct = sizeof(IMAGEHLP_SYMBOL64);
 		sym_info->MaxNameLength = MAX_SYMBOL_LEN;
 
+#if defined (WITH_BFD)
+		sym_bfd_obj_cache bfd_obj_cache;
+#endif
+
 		/* Walk stack at most MAX_FRAMES deep in case the stack is corrupt. */
 		for (uint num = 0; num < MAX_FRAMES; num++) {
 			if (!proc.pStackWalk64(
@@ -557,7 +561,7 @@ char *CrashLogWindows::AppendDecodedStacktrace(char *buffer, const char *last) c
 #if defined (WITH_BFD)
 				/* subtract one to get the line before the return address, i.e. the function call line */
 				sym_info_bfd bfd_info(static_cast<bfd_vma>(frame.AddrPC.Offset) - 1);
-				lookup_addr_bfd(image_name, bfd_info);
+				lookup_addr_bfd(image_name, bfd_obj_cache, bfd_info);
 				if (bfd_info.function_name != nullptr) {
 					const char *func_name = bfd_info.function_name;
 #if defined(WITH_DEMANGLE)
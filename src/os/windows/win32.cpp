@@ -822,3 +822,9 @@ void SetCurrentThreadName(const char *threadName)
 	Win32SetThreadName(GetCurrentThreadId(), threadName);
 }
 #endif
+
+void SetCurrentThreadAffinity(uint64 mask)
+{
+	if (mask == 0) return;
+	SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)mask);
+}
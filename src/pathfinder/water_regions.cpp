@@ -0,0 +1,225 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file water_regions.cpp Coarse-grained water connectivity for ship pathfinding. */
+
+#include "../stdafx.h"
+#include "../map_func.h"
+#include "../tile_cmd.h"
+#include "../tunnelbridge_map.h"
+#include "../3rdparty/cpp-btree/btree_set.h"
+#include "water_regions.h"
+
+#include "../safeguards.h"
+
+/** Side length of a water region, in tiles. Must divide all valid map sizes. */
+static const uint WATER_REGION_EDGE_LENGTH = 16;
+
+static const uint16 WATER_REGION_DIST_UNREACHABLE = 0xFFFF;
+
+/** Extra region distance allowed beyond the best distance to the destination, for detours around in-region obstacles. */
+static const uint WATER_REGION_CORRIDOR_SLACK = 2;
+
+/** Lazily maintained connectivity summary of one region of the map. */
+struct WaterRegionData {
+	uint32 generation = 0;           ///< Data below is current iff this matches _water_region_generation.
+	uint16 edge_water[DIAGDIR_END];  ///< Mask of ship-traversable tiles along each region edge, indexed by position along the edge.
+	bool has_water = false;          ///< Whether the region contains any ship-traversable tile.
+};
+
+static std::vector<WaterRegionData> _water_regions;
+static uint32 _water_region_generation = 1;
+static uint _water_region_cols = 0;
+static uint _water_region_rows = 0;
+
+/** Region pairs directly connected by an aqueduct, keyed origin-region << 32 | target-region. */
+static btree::btree_set<uint64> _water_region_aqueducts;
+
+/* Scratch state of the most recent corridor computation, epoch-marked to avoid clearing per search. */
+static std::vector<uint16> _water_region_dist;
+static std::vector<uint32> _water_region_dist_epoch;
+static uint32 _water_region_search_epoch = 0;
+
+static inline uint32 WaterRegionIndex(TileIndex tile)
+{
+	return (TileX(tile) / WATER_REGION_EDGE_LENGTH) + (TileY(tile) / WATER_REGION_EDGE_LENGTH) * _water_region_cols;
+}
+
+/** Throw away all water region state, e.g. before loading or generating a map. */
+void InitializeWaterRegions()
+{
+	_water_regions.clear();
+	_water_region_aqueducts.clear();
+	_water_region_dist.clear();
+	_water_region_dist_epoch.clear();
+	_water_region_cols = 0;
+	_water_region_rows = 0;
+	_water_region_generation = 1;
+	_water_region_search_epoch = 0;
+}
+
+/**
+ * To be called whenever a map change may add ship-traversable connectivity
+ * (canal/lock/aqueduct construction, flooding). Affected regions are then
+ * rescanned on their next use. Changes which only remove connectivity may
+ * skip this; stale extra connectivity merely costs a wasted search.
+ */
+void NotifyWaterRegionLayoutChange()
+{
+	_water_region_generation++;
+}
+
+static void EnsureWaterRegionsAllocated()
+{
+	uint cols = MapSizeX() / WATER_REGION_EDGE_LENGTH;
+	uint rows = MapSizeY() / WATER_REGION_EDGE_LENGTH;
+	if (cols == _water_region_cols && rows == _water_region_rows) return;
+
+	_water_region_cols = cols;
+	_water_region_rows = rows;
+	_water_regions.clear();
+	_water_regions.resize(cols * rows);
+	_water_region_aqueducts.clear();
+	_water_region_dist.assign(cols * rows, WATER_REGION_DIST_UNREACHABLE);
+	_water_region_dist_epoch.assign(cols * rows, 0);
+	_water_region_search_epoch = 0;
+}
+
+/**
+ * Rescan the ship-traversable tiles of a region.
+ * A tile counts as water iff it has any trackdirs for TRANSPORT_WATER, which
+ * matches what the ship track follower can enter.
+ */
+static void ScanWaterRegion(uint32 index)
+{
+	WaterRegionData &wr = _water_regions[index];
+	wr.generation = _water_region_generation;
+	wr.has_water = false;
+	for (DiagDirection d = DIAGDIR_BEGIN; d < DIAGDIR_END; d++) wr.edge_water[d] = 0;
+	_water_region_aqueducts.erase(_water_region_aqueducts.lower_bound((uint64)index << 32), _water_region_aqueducts.lower_bound((uint64)(index + 1) << 32));
+
+	uint base_x = (index % _water_region_cols) * WATER_REGION_EDGE_LENGTH;
+	uint base_y = (index / _water_region_cols) * WATER_REGION_EDGE_LENGTH;
+	for (uint y = 0; y < WATER_REGION_EDGE_LENGTH; y++) {
+		for (uint x = 0; x < WATER_REGION_EDGE_LENGTH; x++) {
+			TileIndex tile = TileXY(base_x + x, base_y + y);
+			if (GetTileTrackdirBits(tile, TRANSPORT_WATER, 0) == TRACKDIR_BIT_NONE) continue;
+
+			wr.has_water = true;
+			if (x == 0) SetBit(wr.edge_water[DIAGDIR_NE], y);
+			if (x == WATER_REGION_EDGE_LENGTH - 1) SetBit(wr.edge_water[DIAGDIR_SW], y);
+			if (y == 0) SetBit(wr.edge_water[DIAGDIR_NW], x);
+			if (y == WATER_REGION_EDGE_LENGTH - 1) SetBit(wr.edge_water[DIAGDIR_SE], x);
+
+			if (IsTileType(tile, MP_TUNNELBRIDGE) && GetTunnelBridgeTransportType(tile) == TRANSPORT_WATER) {
+				uint32 other = WaterRegionIndex(GetOtherTunnelBridgeEnd(tile));
+				if (other != index) _water_region_aqueducts.insert((uint64)index << 32 | other);
+			}
+		}
+	}
+}
+
+static inline const WaterRegionData &GetWaterRegion(uint32 index)
+{
+	if (_water_regions[index].generation != _water_region_generation) ScanWaterRegion(index);
+	return _water_regions[index];
+}
+
+/**
+ * Compute a corridor between an origin tile and a destination.
+ *
+ * A breadth-first search over the region grid assigns regions their hop
+ * distance from the origin; IsTileAllowed() then admits regions up to the
+ * destination distance plus a small slack.
+ *
+ * @param origin The tile the ship path search starts from; must be ship-traversable.
+ * @param dest_tile The destination tile of the search.
+ * @param dest_area Area covering the dock tiles when heading for a station, or nullptr.
+ * @return false iff no destination region can be reached, i.e. no tile path can exist.
+ */
+bool WaterRegionCorridor::Init(TileIndex origin, TileIndex dest_tile, const TileArea *dest_area)
+{
+	EnsureWaterRegionsAllocated();
+	_water_region_search_epoch++;
+
+	/* Determine the target regions: those the docking area, padded by one
+	 * tile for the adjacent docking tiles, overlaps; or just the region of
+	 * the destination tile. */
+	std::vector<uint32> targets;
+	if (dest_area != nullptr && dest_area->tile != INVALID_TILE) {
+		uint x0 = TileX(dest_area->tile);
+		uint y0 = TileY(dest_area->tile);
+		uint rx0 = (x0 > 0 ? x0 - 1 : 0) / WATER_REGION_EDGE_LENGTH;
+		uint ry0 = (y0 > 0 ? y0 - 1 : 0) / WATER_REGION_EDGE_LENGTH;
+		uint rx1 = std::min<uint>(MapMaxX(), x0 + dest_area->w) / WATER_REGION_EDGE_LENGTH;
+		uint ry1 = std::min<uint>(MapMaxY(), y0 + dest_area->h) / WATER_REGION_EDGE_LENGTH;
+		for (uint ry = ry0; ry <= ry1; ry++) {
+			for (uint rx = rx0; rx <= rx1; rx++) {
+				targets.push_back(rx + ry * _water_region_cols);
+			}
+		}
+	} else {
+		targets.push_back(WaterRegionIndex(dest_tile));
+	}
+	auto is_target = [&](uint32 index) {
+		return std::find(targets.begin(), targets.end(), index) != targets.end();
+	};
+
+	auto set_dist = [&](uint32 index, uint16 dist) {
+		_water_region_dist[index] = dist;
+		_water_region_dist_epoch[index] = _water_region_search_epoch;
+	};
+	auto is_visited = [&](uint32 index) {
+		return _water_region_dist_epoch[index] == _water_region_search_epoch;
+	};
+
+	const uint32 origin_region = WaterRegionIndex(origin);
+	std::vector<uint32> queue;
+	set_dist(origin_region, 0);
+	queue.push_back(origin_region);
+
+	uint16 target_dist = is_target(origin_region) ? 0 : WATER_REGION_DIST_UNREACHABLE;
+
+	for (size_t head = 0; head < queue.size(); head++) {
+		const uint32 index = queue[head];
+		const uint16 dist = _water_region_dist[index];
+
+		/* Deep enough: everything within reach of the destination is known. */
+		if (target_dist != WATER_REGION_DIST_UNREACHABLE && dist >= target_dist + WATER_REGION_CORRIDOR_SLACK) break;
+		if (dist + 1 >= WATER_REGION_DIST_UNREACHABLE) break;
+
+		auto visit = [&](uint32 next) {
+			if (is_visited(next)) return;
+			set_dist(next, dist + 1);
+			queue.push_back(next);
+			if (target_dist == WATER_REGION_DIST_UNREACHABLE && is_target(next)) target_dist = dist + 1;
+		};
+
+		const WaterRegionData &wr = GetWaterRegion(index);
+		const uint rx = index % _water_region_cols;
+		const uint ry = index / _water_region_cols;
+		if (rx > 0 && (wr.edge_water[DIAGDIR_NE] & GetWaterRegion(index - 1).edge_water[DIAGDIR_SW]) != 0) visit(index - 1);
+		if (rx + 1 < _water_region_cols && (wr.edge_water[DIAGDIR_SW] & GetWaterRegion(index + 1).edge_water[DIAGDIR_NE]) != 0) visit(index + 1);
+		if (ry > 0 && (wr.edge_water[DIAGDIR_NW] & GetWaterRegion(index - _water_region_cols).edge_water[DIAGDIR_SE]) != 0) visit(index - _water_region_cols);
+		if (ry + 1 < _water_region_rows && (wr.edge_water[DIAGDIR_SE] & GetWaterRegion(index + _water_region_cols).edge_water[DIAGDIR_NW]) != 0) visit(index + _water_region_cols);
+		for (auto iter = _water_region_aqueducts.lower_bound((uint64)index << 32); iter != _water_region_aqueducts.end() && (uint32)(*iter >> 32) == index; ++iter) {
+			visit((uint32)*iter);
+		}
+	}
+
+	if (target_dist == WATER_REGION_DIST_UNREACHABLE) return false;
+
+	this->limit = target_dist + WATER_REGION_CORRIDOR_SLACK;
+	return true;
+}
+
+/** Test whether a tile lies inside the corridor computed by the last Init(). */
+bool WaterRegionCorridor::IsTileAllowed(TileIndex tile) const
+{
+	const uint32 index = WaterRegionIndex(tile);
+	return _water_region_dist_epoch[index] == _water_region_search_epoch && _water_region_dist[index] <= this->limit;
+}
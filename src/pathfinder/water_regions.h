@@ -0,0 +1,41 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file water_regions.h Coarse-grained water connectivity for ship pathfinding. */
+
+#ifndef WATER_REGIONS_H
+#define WATER_REGIONS_H
+
+#include "../tile_type.h"
+#include "../tilearea_type.h"
+
+void InitializeWaterRegions();
+void NotifyWaterRegionLayoutChange();
+
+/**
+ * Corridor of water regions between an origin and a destination, used to
+ * bound the tile-level ship pathfinder.
+ *
+ * The map is divided into square regions which lazily cache which of their
+ * boundary tiles are ship-traversable, and which other regions they connect
+ * to via aqueducts. Region connectivity is an over-approximation of real
+ * water connectivity: a failed Init() is an authoritative "no path", while a
+ * successful one yields a corridor which usually, but not always, contains a
+ * traversable tile path.
+ *
+ * Only one corridor can be in use at a time; Init() claims shared scratch
+ * state which the next Init() call invalidates.
+ */
+struct WaterRegionCorridor {
+	bool Init(TileIndex origin, TileIndex dest_tile, const TileArea *dest_area);
+	bool IsTileAllowed(TileIndex tile) const;
+
+private:
+	uint16 limit = 0;           ///< Maximum region distance from the origin still inside the corridor.
+};
+
+#endif /* WATER_REGIONS_H */
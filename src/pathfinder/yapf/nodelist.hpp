@@ -12,7 +12,7 @@
 
 #include "../../misc/array.hpp"
 #include "../../misc/hashtable.hpp"
-#include "../../misc/binaryheap.hpp"
+#include "../../misc/dary_heap.hpp"
 
 /**
  * Hash table based node list multi-container class.
@@ -27,7 +27,7 @@ public:
 	typedef SmallArray<Titem_, 65536, 256> CItemArray;           ///< Type that we will use as item container.
 	typedef CHashTableT<Titem_, Thash_bits_open_  > COpenList;   ///< How pointers to open nodes will be stored.
 	typedef CHashTableT<Titem_, Thash_bits_closed_> CClosedList; ///< How pointers to closed nodes will be stored.
-	typedef CBinaryHeapT<Titem_> CPriorityQueue;                 ///< How the priority queue will be managed.
+	typedef CDaryHeapT<Titem_> CPriorityQueue;                   ///< How the priority queue will be managed.
 
 protected:
 	CItemArray      m_arr;        ///< Here we store full item data (Titem_).
@@ -82,7 +82,7 @@ public:
 	{
 		dbg_assert(m_closed.Find(item.GetKey()) == nullptr);
 		m_open.Push(item);
-		m_open_queue.Include(&item);
+		m_open_queue.Include(&item, item.GetCostEstimate());
 		if (&item == m_new_node) {
 			m_new_node = nullptr;
 		}
@@ -116,7 +116,7 @@ public:
 
 	inline void ReenqueueOpenNode(Titem_ &item)
 	{
-		m_open_queue.Include(&item);
+		m_open_queue.Include(&item, item.GetCostEstimate());
 	}
 
 	inline Titem_& PopAlreadyDequeuedOpenNode(const Key &key)
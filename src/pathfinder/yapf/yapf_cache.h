@@ -10,8 +10,11 @@
 #ifndef YAPF_CACHE_H
 #define YAPF_CACHE_H
 
+#include "../../tile_type.h"
 #include "../../track_type.h"
 
+#include <vector>
+
 /**
  * Use this function to notify YAPF that track layout (or signal configuration) has change.
  * @param tile  the tile that is changed
@@ -19,4 +22,21 @@
  */
 void YapfNotifyTrackLayoutChange(TileIndex tile, Track track);
 
+/** Plain-data snapshot of one cached rail segment, used to persist the segment cost cache in savegames. */
+struct YapfRailSegmentCacheEntry {
+	uint32 key;                ///< raw CYapfRailSegmentKey value: (tile << 4) | trackdir
+	TileIndex last_tile;       ///< last tile of the segment
+	uint8 last_td;             ///< last trackdir of the segment
+	int32 cost;                ///< cost of the segment
+	TileIndex last_signal_tile;///< last signal tile of the segment
+	uint8 last_signal_td;      ///< last signal trackdir of the segment
+	uint16 end_segment_reason; ///< reasons why the segment was ended
+};
+
+/** Number of global rail segment cost caches that can be exported/imported (90-deg allowed/forbidden variants). */
+static const uint YAPF_RAIL_SEGMENT_CACHE_COUNT = 2;
+
+void YapfExportRailSegmentCostCache(uint cache_id, std::vector<YapfRailSegmentCacheEntry> &entries);
+void YapfImportRailSegmentCostCache(uint cache_id, const std::vector<YapfRailSegmentCacheEntry> &entries);
+
 #endif /* YAPF_CACHE_H */
@@ -179,6 +179,7 @@ protected:
 		return *static_cast<Tpf *>(this);
 	}
 
+public:
 	inline static Cache& stGetGlobalCache()
 	{
 		static int last_rail_change_counter = 0;
@@ -192,7 +193,6 @@ protected:
 		return C;
 	}
 
-public:
 	/**
 	 * Called by YAPF to attach cached or local segment cost data to the given node.
 	 *  @return true if globally cached data were used or false if local data was used
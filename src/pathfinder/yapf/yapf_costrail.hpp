@@ -14,6 +14,7 @@
 
 #include "../../pbs.h"
 #include "../../tracerestrict.h"
+#include "yapf_rail_region.h"
 
 template <class Types>
 class CYapfCostRailT : public CYapfCostBase {
@@ -57,6 +58,7 @@ protected:
 	 */
 	int m_max_cost;
 	bool m_disable_cache;
+	const RailRegionCorridor *m_corridor = nullptr; ///< Corridor of the current long-distance search, or nullptr.
 	std::vector<int> m_sig_look_ahead_costs;
 
 public:
@@ -868,6 +870,12 @@ no_entry_cost: // jump here at the beginning if the node has no parent (it is th
 			extra_cost += Yapf().TeleportCost(n.GetLastTile(), n.m_parent->GetLastTile());
 		}
 
+		/* Penalise leaving the corridor of a long-distance search. This is kept
+		 * out of the segment cost so the shared segment cache stays corridor-agnostic. */
+		if (m_corridor != nullptr && !m_corridor->Contains(n.GetLastTile())) {
+			extra_cost += RAIL_REGION_OUTSIDE_CORRIDOR_PENALTY;
+		}
+
 		/* total node cost */
 		n.m_cost = parent_cost + segment_entry_cost + segment_cost + extra_cost;
 
@@ -895,6 +903,12 @@ no_entry_cost: // jump here at the beginning if the node has no parent (it is th
 	{
 		m_disable_cache = disable;
 	}
+
+	/** Set (or clear, with nullptr) the corridor of the current long-distance search. */
+	void SetCorridor(const RailRegionCorridor *corridor)
+	{
+		m_corridor = corridor;
+	}
 };
 
 #endif /* YAPF_COSTRAIL_HPP */
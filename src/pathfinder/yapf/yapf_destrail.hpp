@@ -137,6 +137,12 @@ protected:
 	}
 
 public:
+	/** Get the destination tile, e.g. for seeding a region corridor. */
+	inline TileIndex GetDestinationTile() const
+	{
+		return m_destTile;
+	}
+
 	void SetDestination(const Train *v)
 	{
 		m_any_depot = false;
@@ -20,6 +20,9 @@ struct CYapfRailSegmentKey
 		Set(node_key);
 	}
 
+	/** construct from a raw key value, as stored in a savegame */
+	explicit inline CYapfRailSegmentKey(uint32 value) : m_value(value) {}
+
 	inline void Set(const CYapfRailSegmentKey &src)
 	{
 		m_value = src.m_value;
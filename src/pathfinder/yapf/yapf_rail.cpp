@@ -553,8 +553,19 @@ public:
 		Yapf().SetOrigin(origin.tile, origin.trackdir, INVALID_TILE, INVALID_TRACKDIR, 1, true);
 		Yapf().SetDestination(v);
 
+		/* For long-distance searches, build a coarse corridor over the rail
+		 * region graph first and let the fine search prefer to stay inside it. */
+		RailRegionCorridor corridor;
+		TileIndex dest_tile = Yapf().GetDestinationTile();
+		if (dest_tile != INVALID_TILE && origin.tile != INVALID_TILE &&
+				DistanceManhattan(origin.tile, dest_tile) >= RAIL_REGION_MIN_CORRIDOR_DISTANCE &&
+				FindRailRegionCorridor(origin.tile, dest_tile, corridor)) {
+			Yapf().SetCorridor(&corridor);
+		}
+
 		/* find the best path */
 		path_found = Yapf().FindPath(v);
+		Yapf().SetCorridor(nullptr);
 
 		/* if path not found - return INVALID_TRACKDIR */
 		Trackdir next_trackdir = INVALID_TRACKDIR;
@@ -659,6 +670,74 @@ struct CYapfAnyDepotRail2 : CYapfT<CYapfRail_TypesT<CYapfAnyDepotRail2, CFollowT
 struct CYapfAnySafeTileRail1 : CYapfT<CYapfRail_TypesT<CYapfAnySafeTileRail1, CFollowTrackFreeRail    , CRailNodeListTrackDir, CYapfDestinationAnySafeTileRailT , CYapfFollowAnySafeTileRailT> > {};
 struct CYapfAnySafeTileRail2 : CYapfT<CYapfRail_TypesT<CYapfAnySafeTileRail2, CFollowTrackFreeRailNo90, CRailNodeListTrackDir, CYapfDestinationAnySafeTileRailT , CYapfFollowAnySafeTileRailT> > {};
 
+template <class Tpf>
+static void ExportRailSegmentCostCache(std::vector<YapfRailSegmentCacheEntry> &entries)
+{
+	const typename Tpf::Cache &cache = Tpf::stGetGlobalCache();
+	for (uint i = 0; i < cache.m_heap.Length(); i++) {
+		const CYapfRailSegment &seg = cache.m_heap[i];
+		YapfRailSegmentCacheEntry &entry = entries.emplace_back();
+		entry.key = seg.m_key.m_value;
+		entry.last_tile = seg.m_last_tile;
+		entry.last_td = seg.m_last_td;
+		entry.cost = seg.m_cost;
+		entry.last_signal_tile = seg.m_last_signal_tile;
+		entry.last_signal_td = seg.m_last_signal_td;
+		entry.end_segment_reason = seg.m_end_segment_reason;
+	}
+}
+
+template <class Tpf>
+static void ImportRailSegmentCostCache(const std::vector<YapfRailSegmentCacheEntry> &entries)
+{
+	typename Tpf::Cache &cache = Tpf::stGetGlobalCache();
+	for (const YapfRailSegmentCacheEntry &entry : entries) {
+		CYapfRailSegmentKey key(entry.key);
+		if (key.GetTile() >= MapSize()) continue;
+		if (entry.cost < 0) continue;
+		bool found;
+		CYapfRailSegment &seg = cache.Get(key, &found);
+		if (found) continue;
+		seg.m_last_tile = entry.last_tile;
+		seg.m_last_td = (Trackdir)entry.last_td;
+		seg.m_cost = entry.cost;
+		seg.m_last_signal_tile = entry.last_signal_tile;
+		seg.m_last_signal_td = (Trackdir)entry.last_signal_td;
+		seg.m_end_segment_reason = (EndSegmentReasonBits)entry.end_segment_reason;
+	}
+}
+
+/**
+ * Export the content of one of the global rail segment cost caches, for saving.
+ * @param cache_id which cache: 0 = 90-deg allowed, 1 = 90-deg forbidden
+ * @param entries  container to append the cached segments to
+ */
+void YapfExportRailSegmentCostCache(uint cache_id, std::vector<YapfRailSegmentCacheEntry> &entries)
+{
+	switch (cache_id) {
+		case 0: ExportRailSegmentCostCache<CYapfRail1>(entries); break;
+		case 1: ExportRailSegmentCostCache<CYapfRail2>(entries); break;
+		default: NOT_REACHED();
+	}
+}
+
+/**
+ * Re-populate one of the global rail segment cost caches from saved entries.
+ * Entries which fail basic validation or which are already present are skipped.
+ * This must only be called once all load-time track layout fixups (and the
+ * resulting cache flush) are done, otherwise the imported entries are lost.
+ * @param cache_id which cache: 0 = 90-deg allowed, 1 = 90-deg forbidden
+ * @param entries  the saved segments
+ */
+void YapfImportRailSegmentCostCache(uint cache_id, const std::vector<YapfRailSegmentCacheEntry> &entries)
+{
+	switch (cache_id) {
+		case 0: ImportRailSegmentCostCache<CYapfRail1>(entries); break;
+		case 1: ImportRailSegmentCostCache<CYapfRail2>(entries); break;
+		default: NOT_REACHED();
+	}
+}
+
 
 Track YapfTrainChooseTrack(const Train *v, TileIndex tile, DiagDirection enterdir, TrackBits tracks, bool &path_found, bool reserve_track, PBSTileInfo *target, TileIndex *dest)
 {
@@ -790,6 +869,7 @@ int CSegmentCostCacheBase::s_rail_change_counter = 0;
 void YapfNotifyTrackLayoutChange(TileIndex tile, Track track)
 {
 	CSegmentCostCacheBase::NotifyTrackLayoutChange(tile, track);
+	InvalidateRailRegionChunks(tile);
 }
 
 void YapfCheckRailSignalPenalties()
@@ -0,0 +1,222 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_rail_region.cpp Coarse rail region graph used to build corridors for long-distance rail path searches. */
+
+#include "../../stdafx.h"
+
+#include "yapf_rail_region.h"
+#include "../../rail_map.h"
+#include "../../road_map.h"
+#include "../../station_map.h"
+#include "../../tunnelbridge_map.h"
+#include "../../bridge_map.h"
+#include "../../tunnel_base.h"
+
+#include <deque>
+
+#include "../../safeguards.h"
+
+/**
+ * Cached information about one 16x16 chunk of the map.
+ *
+ * Chunks are recomputed lazily: YapfNotifyTrackLayoutChange() only marks the
+ * affected chunk dirty, the rescan happens on the next corridor query that
+ * actually touches the chunk. The information is a pure function of the map
+ * array, so it is identical on all network clients.
+ */
+struct RailRegionChunk {
+	uint8 border_rail; ///< Per-DiagDirection bit: rail present on the chunk edge towards that neighbour.
+	bool has_rail;     ///< Whether the chunk contains any rail at all.
+	bool dirty;        ///< Whether the cached information needs recomputing.
+};
+
+static std::vector<RailRegionChunk> _rail_region_chunks; ///< Chunk grid, row-major like the tile array.
+static uint _rail_region_map_size = 0;                   ///< MapSize() the chunk grid was built for.
+
+/** Does this tile carry rail track for region purposes (signals and reservations are irrelevant here)? */
+static bool IsRailRegionTile(TileIndex t)
+{
+	switch (GetTileType(t)) {
+		case MP_RAILWAY:      return true;
+		case MP_ROAD:         return IsLevelCrossing(t);
+		case MP_STATION:      return HasStationRail(t);
+		case MP_TUNNELBRIDGE: return GetTunnelBridgeTransportType(t) == TRANSPORT_RAIL;
+		default:              return false;
+	}
+}
+
+/** (Re)build the chunk grid for the current map size, marking everything dirty. */
+static void EnsureRailRegionChunks()
+{
+	if (_rail_region_map_size == MapSize() && !_rail_region_chunks.empty()) return;
+
+	uint count = (MapSizeX() >> RAIL_REGION_CHUNK_BITS) * (MapSizeY() >> RAIL_REGION_CHUNK_BITS);
+	_rail_region_chunks.assign(count, { 0, false, true });
+	_rail_region_map_size = MapSize();
+}
+
+/** Rescan the given chunk's tiles and update its cached information. */
+static void UpdateRailRegionChunk(uint index)
+{
+	RailRegionChunk &chunk = _rail_region_chunks[index];
+
+	uint chunks_x = MapSizeX() >> RAIL_REGION_CHUNK_BITS;
+	uint x0 = (index % chunks_x) << RAIL_REGION_CHUNK_BITS;
+	uint y0 = (index / chunks_x) << RAIL_REGION_CHUNK_BITS;
+	uint last = (1 << RAIL_REGION_CHUNK_BITS) - 1;
+
+	chunk.border_rail = 0;
+	chunk.has_rail = false;
+
+	for (uint y = y0; y <= y0 + last; y++) {
+		for (uint x = x0; x <= x0 + last; x++) {
+			TileIndex t = TileXY(x, y);
+			uint8 edges = 0;
+			if (IsRailRegionTile(t)) {
+				/* All four edges the tile touches count as rail borders. */
+				if (x == x0) edges |= 1 << DIAGDIR_NE;
+				if (x == x0 + last) edges |= 1 << DIAGDIR_SW;
+				if (y == y0) edges |= 1 << DIAGDIR_NW;
+				if (y == y0 + last) edges |= 1 << DIAGDIR_SE;
+			} else if (IsBridgeAbove(t)) {
+				/* A bridge passing over this tile may carry rail; treat it as
+				 * rail along its axis. This over-approximates (road bridges
+				 * count too), which only widens the corridor slightly. */
+				if (GetBridgeAxis(t) == AXIS_X) {
+					if (x == x0) edges |= 1 << DIAGDIR_NE;
+					if (x == x0 + last) edges |= 1 << DIAGDIR_SW;
+				} else {
+					if (y == y0) edges |= 1 << DIAGDIR_NW;
+					if (y == y0 + last) edges |= 1 << DIAGDIR_SE;
+				}
+				if (edges == 0) continue;
+			} else {
+				continue;
+			}
+			chunk.has_rail = true;
+			chunk.border_rail |= edges;
+		}
+	}
+
+	chunk.dirty = false;
+}
+
+/** Get the chunk at the given index, rescanning it first if it is dirty. */
+static const RailRegionChunk &GetRailRegionChunk(uint index)
+{
+	if (_rail_region_chunks[index].dirty) UpdateRailRegionChunk(index);
+	return _rail_region_chunks[index];
+}
+
+/**
+ * Mark the chunk containing the given tile as dirty, or all chunks for INVALID_TILE.
+ * Called from YapfNotifyTrackLayoutChange(), i.e. by the same track layout
+ * change notifications that invalidate the YAPF segment cost cache.
+ * @param tile the changed tile, or INVALID_TILE for a global change
+ */
+void InvalidateRailRegionChunks(TileIndex tile)
+{
+	if (_rail_region_chunks.empty()) return;
+	if (tile == INVALID_TILE || _rail_region_map_size != MapSize()) {
+		_rail_region_chunks.clear();
+		return;
+	}
+	_rail_region_chunks[RailRegionChunkIndex(tile)].dirty = true;
+}
+
+/** BFS over the chunk graph from the given chunk, writing chunk-step distances into dist. */
+static void RailRegionBFS(uint start, std::vector<uint16> &dist)
+{
+	static const uint16 UNREACHED = UINT16_MAX;
+	dist.assign(_rail_region_chunks.size(), UNREACHED);
+
+	/* Rail tunnels have no surface tiles between their heads, so the plain
+	 * border adjacency cannot see them; add their head chunks as extra edges. */
+	std::vector<std::pair<uint, uint>> tunnel_edges;
+	for (const Tunnel *t : Tunnel::Iterate()) {
+		if (GetTunnelBridgeTransportType(t->tile_n) != TRANSPORT_RAIL) continue;
+		tunnel_edges.emplace_back(RailRegionChunkIndex(t->tile_n), RailRegionChunkIndex(t->tile_s));
+	}
+
+	uint chunks_x = MapSizeX() >> RAIL_REGION_CHUNK_BITS;
+	uint chunks_y = MapSizeY() >> RAIL_REGION_CHUNK_BITS;
+
+	std::deque<uint> queue;
+	dist[start] = 0;
+	queue.push_back(start);
+
+	while (!queue.empty()) {
+		uint c = queue.front();
+		queue.pop_front();
+		uint16 d = dist[c];
+
+		const RailRegionChunk &info = GetRailRegionChunk(c);
+		uint cx = c % chunks_x;
+		uint cy = c / chunks_x;
+
+		auto visit = [&](uint next) {
+			if (dist[next] == UNREACHED) {
+				dist[next] = d + 1;
+				queue.push_back(next);
+			}
+		};
+
+		for (DiagDirection dir = DIAGDIR_BEGIN; dir != DIAGDIR_END; dir++) {
+			if (!HasBit(info.border_rail, dir)) continue;
+			TileIndexDiffC offs = TileIndexDiffCByDiagDir(dir);
+			uint nx = cx + offs.x;
+			uint ny = cy + offs.y;
+			if (nx >= chunks_x || ny >= chunks_y) continue;
+			uint next = ny * chunks_x + nx;
+			if (!HasBit(GetRailRegionChunk(next).border_rail, ReverseDiagDir(dir))) continue;
+			visit(next);
+		}
+
+		for (const auto &edge : tunnel_edges) {
+			if (edge.first == c) visit(edge.second);
+			if (edge.second == c) visit(edge.first);
+		}
+	}
+}
+
+/**
+ * Build the corridor of chunks for a long-distance rail path search.
+ *
+ * Runs a BFS over the coarse chunk graph from both end points and keeps every
+ * chunk that lies on a route at most a few chunk-steps longer than the coarse
+ * shortest route.
+ *
+ * @param from origin tile of the fine search
+ * @param to destination tile of the fine search
+ * @param[out] corridor receives the corridor chunk set
+ * @return true if a coarse route was found and the corridor is usable
+ */
+bool FindRailRegionCorridor(TileIndex from, TileIndex to, RailRegionCorridor &corridor)
+{
+	static const uint16 UNREACHED = UINT16_MAX;
+	static const uint CORRIDOR_SLACK = 4;
+
+	EnsureRailRegionChunks();
+
+	uint start = RailRegionChunkIndex(from);
+	uint end = RailRegionChunkIndex(to);
+
+	static std::vector<uint16> dist_from;
+	static std::vector<uint16> dist_to;
+	RailRegionBFS(start, dist_from);
+	if (dist_from[end] == UNREACHED) return false;
+	RailRegionBFS(end, dist_to);
+
+	uint max_dist = dist_from[end] + CORRIDOR_SLACK;
+	corridor.chunks.assign(_rail_region_chunks.size(), 0);
+	for (uint c = 0; c < _rail_region_chunks.size(); c++) {
+		if (dist_from[c] == UNREACHED || dist_to[c] == UNREACHED) continue;
+		if (dist_from[c] + dist_to[c] <= max_dist) corridor.chunks[c] = 1;
+	}
+	return true;
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_rail_region.h Coarse rail region graph used to build corridors for long-distance rail path searches. */
+
+#ifndef YAPF_RAIL_REGION_H
+#define YAPF_RAIL_REGION_H
+
+#include "../../map_func.h"
+
+#include <vector>
+
+static const uint RAIL_REGION_CHUNK_BITS = 4; ///< Rail region chunks are 2^4 x 2^4 tiles.
+
+/** Manhattan distance between origin and destination from which ChooseRailTrack() searches use a corridor. */
+static const uint RAIL_REGION_MIN_CORRIDOR_DISTANCE = 192;
+
+/** Penalty for expanding a node outside the corridor of a long-distance search. */
+static const int RAIL_REGION_OUTSIDE_CORRIDOR_PENALTY = 100 * 64;
+
+/**
+ * Get the index of the region chunk containing the given tile.
+ * @param tile a valid tile
+ * @return index into the chunk grid
+ */
+inline uint RailRegionChunkIndex(TileIndex tile)
+{
+	uint cx = TileX(tile) >> RAIL_REGION_CHUNK_BITS;
+	uint cy = TileY(tile) >> RAIL_REGION_CHUNK_BITS;
+	return cy * (MapSizeX() >> RAIL_REGION_CHUNK_BITS) + cx;
+}
+
+/**
+ * Set of region chunks making up the corridor of one long-distance rail path search.
+ *
+ * The corridor is only a search-guidance heuristic: tiles outside it are still
+ * expandable, they just receive #RAIL_REGION_OUTSIDE_CORRIDOR_PENALTY, so the
+ * fine search stays inside the corridor unless there really is no path there.
+ */
+struct RailRegionCorridor {
+	std::vector<uint8> chunks; ///< One flag per chunk; non-zero if the chunk is inside the corridor.
+
+	/** Is the given tile inside the corridor? */
+	inline bool Contains(TileIndex tile) const
+	{
+		return this->chunks[RailRegionChunkIndex(tile)] != 0;
+	}
+};
+
+void InvalidateRailRegionChunks(TileIndex tile);
+bool FindRailRegionCorridor(TileIndex from, TileIndex to, RailRegionCorridor &corridor);
+
+#endif /* YAPF_RAIL_REGION_H */
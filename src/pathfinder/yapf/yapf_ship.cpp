@@ -11,7 +11,9 @@
 #include "../../ship.h"
 #include "../../industry.h"
 #include "../../vehicle_func.h"
+#include "../../station_base.h"
 
+#include "../water_regions.h"
 #include "yapf.hpp"
 #include "yapf_node_ship.hpp"
 
@@ -110,6 +112,8 @@ public:
 	typedef typename Node::Key Key;                      ///< key to hash tables
 
 protected:
+	const WaterRegionCorridor *m_corridor = nullptr; ///< Optional region corridor the search is restricted to.
+
 	/** to access inherited path finder */
 	inline Tpf& Yapf()
 	{
@@ -117,6 +121,12 @@ protected:
 	}
 
 public:
+	/** Restrict the search to the given water region corridor. */
+	void SetCorridor(const WaterRegionCorridor *corridor)
+	{
+		this->m_corridor = corridor;
+	}
+
 	/**
 	 * Called by YAPF to move from the given node to the next tile. For each
 	 *  reachable trackdir on the new tile creates new node, initializes it
@@ -126,6 +136,7 @@ public:
 	{
 		TrackFollower F(Yapf().GetVehicle());
 		if (F.Follow(old_node.m_key.m_tile, old_node.m_key.m_td)) {
+			if (this->m_corridor != nullptr && !this->m_corridor->IsTileAllowed(F.m_new_tile)) return;
 			Yapf().AddMultipleNodes(&old_node, F);
 		}
 	}
@@ -158,41 +169,68 @@ public:
 		/* convert origin trackdir to TrackdirBits */
 		TrackdirBits trackdirs = TrackdirToTrackdirBits(trackdir);
 
-		/* create pathfinder instance */
-		Tpf pf;
-		/* set origin and destination nodes */
-		pf.SetOrigin(src_tile, trackdirs);
-		pf.SetDestination(v);
-		/* find best path */
-		path_found = pf.FindPath(v);
+		/* Region prefilter: reject unreachable destinations without flooding
+		 * the map with nodes, and restrict the tile search to a corridor of
+		 * regions along a coarse shortest path. */
+		TileIndex region_dest_tile;
+		const TileArea *region_dest_area = nullptr;
+		if (v->current_order.IsType(OT_GOTO_STATION)) {
+			const Station *st = Station::Get(v->current_order.GetDestination());
+			region_dest_tile = CalcClosestStationTile(st->index, v->tile, STATION_DOCK);
+			region_dest_area = &st->docking_station;
+		} else {
+			region_dest_tile = v->dest_tile;
+		}
+		WaterRegionCorridor corridor;
+		if (!corridor.Init(src_tile, region_dest_tile, region_dest_area)) {
+			path_found = false;
+			return INVALID_TRACKDIR;
+		}
 
 		Trackdir next_trackdir = INVALID_TRACKDIR; // this would mean "path not found"
 
-		Node *pNode = pf.GetBestNode();
-		if (pNode != nullptr) {
-			uint steps = 0;
-			for (Node *n = pNode; n->m_parent != nullptr; n = n->m_parent) steps++;
-			uint skip = 0;
-			if (path_found) skip = YAPF_SHIP_PATH_CACHE_LENGTH / 2;
-
-			/* walk through the path back to the origin */
-			Node *pPrevNode = nullptr;
-			while (pNode->m_parent != nullptr) {
-				steps--;
-				/* Skip tiles at end of path near destination. */
-				if (skip > 0) skip--;
-				if (skip == 0 && steps > 0 && steps < YAPF_SHIP_PATH_CACHE_LENGTH) {
-					path_cache.push_front(pNode->GetTrackdir());
+		for (uint attempt = 0; attempt < 2; attempt++) {
+			/* create pathfinder instance */
+			Tpf pf;
+			/* set origin and destination nodes */
+			pf.SetOrigin(src_tile, trackdirs);
+			pf.SetDestination(v);
+			if (attempt == 0) pf.SetCorridor(&corridor);
+			/* find best path */
+			path_found = pf.FindPath(v);
+
+			if (attempt == 0 && !path_found) {
+				/* The corridor may have been too tight, retry unrestricted. */
+				continue;
+			}
+
+			Node *pNode = pf.GetBestNode();
+			if (pNode != nullptr) {
+				uint steps = 0;
+				for (Node *n = pNode; n->m_parent != nullptr; n = n->m_parent) steps++;
+				uint skip = 0;
+				if (path_found) skip = YAPF_SHIP_PATH_CACHE_LENGTH / 2;
+
+				/* walk through the path back to the origin */
+				Node *pPrevNode = nullptr;
+				while (pNode->m_parent != nullptr) {
+					steps--;
+					/* Skip tiles at end of path near destination. */
+					if (skip > 0) skip--;
+					if (skip == 0 && steps > 0 && steps < YAPF_SHIP_PATH_CACHE_LENGTH) {
+						path_cache.push_front(pNode->GetTrackdir());
+					}
+					pPrevNode = pNode;
+					pNode = pNode->m_parent;
 				}
-				pPrevNode = pNode;
-				pNode = pNode->m_parent;
+				/* return trackdir from the best next node (direct child of origin) */
+				Node &best_next_node = *pPrevNode;
+				assert(best_next_node.GetTile() == tile);
+				next_trackdir = best_next_node.GetTrackdir();
+				/* remove last element for the special case when tile == dest_tile */
+				if (path_found && !path_cache.empty()) path_cache.pop_back();
 			}
-			/* return trackdir from the best next node (direct child of origin) */
-			Node &best_next_node = *pPrevNode;
-			assert(best_next_node.GetTile() == tile);
-			next_trackdir = best_next_node.GetTrackdir();
-			/* remove last element for the special case when tile == dest_tile */
-			if (path_found && !path_cache.empty()) path_cache.pop_back();
+			break;
 		}
 		return next_trackdir;
 	}
@@ -880,6 +880,15 @@ bool ValidateLookAhead(const Train *v)
 /**
  * Follow a train reservation to the last tile.
  *
+ * Under realistic braking the walk starts from the cached reservation end in
+ * the train's lookahead rather than from the train itself (unless
+ * FTRF_IGNORE_LOOKAHEAD), so repeated calls while a reservation is extended
+ * only cover the new part of the path. The reservation state itself is only
+ * stored in the map bits: they are the authoritative (and saved) state, and
+ * decoding them is a few bit operations on a tile the walk touches anyway, so
+ * a parallel per-tile reservation index would add sync hazards without
+ * removing meaningful work.
+ *
  * @param v the vehicle
  * @param train_on_res Is set to a train we might encounter
  * @returns The last tile of the reservation or the current train tile if no reservation present.
@@ -24,6 +24,7 @@ void PlanLine::UpdateVisualExtents()
 
 	if (this->tiles.size() < 2) {
 		this->viewport_extents = { INT_MAX, INT_MAX, INT_MAX, INT_MAX };
+		this->lod_tiles.clear();
 		return;
 	}
 
@@ -46,6 +47,41 @@ void PlanLine::UpdateVisualExtents()
 
 	this->viewport_extents = { (int)(min_x * TILE_SIZE * 2 * ZOOM_LVL_BASE), (int)(min_y * TILE_SIZE * ZOOM_LVL_BASE),
 			(int)((max_x + 1) * TILE_SIZE * 2 * ZOOM_LVL_BASE), (int)((max_y + 1) * TILE_SIZE * ZOOM_LVL_BASE) };
+
+	/* Precompute the polyline drawn at far zoom levels: drop vertices closer
+	 * than PLAN_LOD_GRID tiles to the previously kept one. At the zoom levels
+	 * where this list is used such detail is a pixel or two at most. */
+	const uint PLAN_LOD_GRID = 4;
+	this->lod_tiles.clear();
+	if (this->tiles.size() > 2) {
+		this->lod_tiles.push_back(this->tiles.front());
+		TileIndex last = this->tiles.front();
+		for (size_t i = 1; i + 1 < this->tiles.size(); i++) {
+			const TileIndex t = this->tiles[i];
+			if (DistanceMax(last, t) >= PLAN_LOD_GRID) {
+				this->lod_tiles.push_back(t);
+				last = t;
+			}
+		}
+		this->lod_tiles.push_back(this->tiles.back());
+
+		/* No saving over the full polyline, don't keep a copy. */
+		if (this->lod_tiles.size() == this->tiles.size()) this->lod_tiles.clear();
+	}
+}
+
+/** Update the whole-plan visual extents from the extents of all lines. */
+void Plan::UpdateVisualExtents()
+{
+	Rect r = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+	for (const PlanLine *pl : this->lines) {
+		if (pl->viewport_extents.left == INT_MAX) continue;
+		r.left   = std::min(r.left,   pl->viewport_extents.left);
+		r.top    = std::min(r.top,    pl->viewport_extents.top);
+		r.right  = std::max(r.right,  pl->viewport_extents.right);
+		r.bottom = std::max(r.bottom, pl->viewport_extents.bottom);
+	}
+	this->viewport_extents = r;
 }
 
 bool Plan::ValidateNewLine()
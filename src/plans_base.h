@@ -30,6 +30,7 @@ struct PlanLine {
 	bool visible;
 	bool focused;
 	TileVector tiles;
+	TileVector lod_tiles; ///< NOSAVE: simplified polyline drawn at far zoom, built by UpdateVisualExtents().
 	Rect viewport_extents;
 
 	PlanLine()
@@ -46,6 +47,7 @@ struct PlanLine {
 	void Clear()
 	{
 		this->tiles.clear();
+		this->lod_tiles.clear();
 	}
 
 	bool AppendTile(TileIndex tile)
@@ -137,6 +139,7 @@ struct Plan : PlanPool::PoolItem<&_plan_pool> {
 	Owner owner;
 	PlanLineVector lines;
 	PlanLine *temp_line;
+	Rect viewport_extents; ///< NOSAVE: union of the visual extents of all lines, for whole-plan view culling.
 	TileIndex last_tile;
 	bool visible;
 	bool visible_by_all;
@@ -154,6 +157,7 @@ struct Plan : PlanPool::PoolItem<&_plan_pool> {
 		this->show_lines = false;
 		this->colour = COLOUR_WHITE;
 		this->temp_line = new PlanLine();
+		this->viewport_extents = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
 		this->last_tile = INVALID_TILE;
 	}
 
@@ -203,6 +207,8 @@ struct Plan : PlanPool::PoolItem<&_plan_pool> {
 
 	bool ValidateNewLine();
 
+	void UpdateVisualExtents();
+
 	bool IsListable()
 	{
 		return (this->owner == _local_company || this->visible_by_all);
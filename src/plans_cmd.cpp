@@ -101,6 +101,7 @@ CommandCost CmdAddPlanLine(TileIndex tile, DoCommandFlag flags, uint32 p1, uint3
 		if (!pl) return_cmd_error(STR_ERROR_NO_MORE_SPACE_FOR_LINES);
 		pl->tiles = std::move(data->tiles);
 		pl->UpdateVisualExtents();
+		p->UpdateVisualExtents();
 		if (p->IsListable()) {
 			pl->SetVisibility(p->visible);
 			if (p->visible) pl->MarkDirty();
@@ -219,6 +220,7 @@ CommandCost CmdRemovePlanLine(TileIndex tile, DoCommandFlag flags, uint32 p1, ui
 		(*it)->SetVisibility(false);
 		delete *it;
 		p->lines.erase(it);
+		p->UpdateVisualExtents();
 		if (p->IsListable()) {
 			Window *w = FindWindowById(WC_PLANS, 0);
 			if (w) w->InvalidateData(p->index, false);
@@ -1359,6 +1359,64 @@ CommandCost CmdRemoveRailroadTrack(TileIndex tile, DoCommandFlag flags, uint32 p
 	return CmdRailTrackHelper(tile, flags, p1, SetBit(p2, 9), text);
 }
 
+/**
+ * Build or remove an area of parallel rail tracks.
+ * Every row of the rectangle spanned by the two corner tiles is laid as one
+ * stretch of straight track, so the whole area is validated and applied
+ * within a single command execution and pending signal updates are only
+ * flushed once for the entire area.
+ * @param tile one corner of the area
+ * @param flags operation to perform
+ * @param p1 opposite corner of the area
+ * @param p2 various bitstuffed elements
+ * - p2 = (bit 0-5) - railroad type normal/maglev (0 = normal, 1 = mono, 2 = maglev), only used for building
+ * - p2 = (bit 6-8) - track-orientation, only TRACK_X and TRACK_Y are valid
+ * - p2 = (bit 9)   - 0 = build, 1 = remove tracks
+ * - p2 = (bit 10)  - 0 = build up to an obstacle, 1 = fail if an obstacle is found (used for AIs).
+ * - p2 = (bit 13)  - 0 = error on signal in the way, 1 = auto remove signals when in the way
+ * @param text unused
+ * @return the cost of this operation or an error
+ * @see CmdRailTrackHelper
+ */
+CommandCost CmdBuildRailGrid(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32 p2, const char *text)
+{
+	if (p1 >= MapSize()) return CMD_ERROR;
+
+	Track track = Extract<Track, 6, 3>(p2);
+	/* Only straight tracks can be repeated as parallel rows. */
+	if (track != TRACK_X && track != TRACK_Y) return CMD_ERROR;
+	bool fail_if_obstacle = HasBit(p2, 10);
+
+	uint sx = TileX(tile);
+	uint sy = TileY(tile);
+	uint ex = TileX(p1);
+	uint ey = TileY(p1);
+	if (sx > ex) Swap(sx, ex);
+	if (sy > ey) Swap(sy, ey);
+
+	CommandCost total_cost(EXPENSES_CONSTRUCTION);
+	CommandCost last_error = CMD_ERROR;
+	bool had_success = false;
+
+	uint last_row = (track == TRACK_X) ? ey : ex;
+	for (uint row = (track == TRACK_X) ? sy : sx; row <= last_row; row++) {
+		TileIndex row_start = (track == TRACK_X) ? TileXY(sx, row) : TileXY(row, sy);
+		TileIndex row_end   = (track == TRACK_X) ? TileXY(ex, row) : TileXY(row, ey);
+
+		CommandCost ret = CmdRailTrackHelper(row_start, flags, row_end, p2, text);
+		if (ret.Failed()) {
+			last_error = ret;
+			if (fail_if_obstacle) return last_error;
+		} else {
+			had_success = true;
+			total_cost.AddCost(ret);
+		}
+	}
+
+	if (had_success) return total_cost;
+	return last_error;
+}
+
 /**
  * Build a train depot
  * @param tile position of the train depot
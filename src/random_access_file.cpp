@@ -10,6 +10,10 @@
 #include "stdafx.h"
 #include "random_access_file_type.h"
 
+#if defined(UNIX)
+#include <fcntl.h>
+#endif
+
 #include "debug.h"
 #include "fileio_func.h"
 #include "string_func.h"
@@ -93,6 +97,20 @@ void RandomAccessFile::SeekTo(size_t pos, int mode)
 	this->buffer = this->buffer_end = this->buffer_start;
 }
 
+/**
+ * Hint to the OS that the given byte range of the file is likely to be read
+ * soon, so it can schedule readahead in the background. Purely advisory and
+ * asynchronous; a no-op on platforms without such a facility.
+ * @param begin Start of the byte range within the file.
+ * @param size  Length of the byte range in bytes.
+ */
+void RandomAccessFile::ReadaheadHint(size_t begin, size_t size)
+{
+#if defined(UNIX) && defined(POSIX_FADV_WILLNEED)
+	posix_fadvise(fileno(this->file_handle), begin, size, POSIX_FADV_WILLNEED);
+#endif
+}
+
 /**
  * Read a byte from the file.
  * @return Read byte.
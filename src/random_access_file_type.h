@@ -51,6 +51,7 @@ public:
 
 	size_t GetPos() const;
 	void SeekTo(size_t pos, int mode);
+	void ReadaheadHint(size_t begin, size_t size);
 
 	inline byte ReadByte()
 	{
@@ -1622,6 +1622,66 @@ CommandCost CmdBuildLongRoad(TileIndex start_tile, DoCommandFlag flags, uint32 p
 	return had_success ? cost : last_error;
 }
 
+/**
+ * Build an area of parallel road stretches.
+ * Every row of the rectangle spanned by the two corner tiles is built as one
+ * long piece of road, so the whole area is validated and applied within a
+ * single command execution.
+ * @param start_tile one corner of the area (the building cost will appear over this tile)
+ * @param flags operation to perform
+ * @param p1 opposite corner of the area
+ * @param p2 various bitstuffed elements
+ * - p2 = (bit 2) - direction: 0 = rows along x-axis, 1 = rows along y-axis (p2 & 4)
+ * - p2 = (bit 3..8) - road type
+ * - p2 = (bit 10) - set road direction
+ * - p2 = (bit 11) - 0 = build up to an obstacle, 1 = fail if an obstacle is found. This behavior is used for scripts
+ * @param text unused
+ * @return the cost of this operation or an error
+ * @see CmdBuildLongRoad
+ */
+CommandCost CmdBuildRoadGrid(TileIndex start_tile, DoCommandFlag flags, uint32 p1, uint32 p2, const char *text)
+{
+	if (p1 >= MapSize()) return CMD_ERROR;
+
+	RoadType rt = Extract<RoadType, 3, 6>(p2);
+	if (!ValParamRoadType(rt)) return CMD_ERROR;
+
+	Axis axis = Extract<Axis, 2, 1>(p2);
+	bool is_ai = HasBit(p2, 11);
+
+	uint sx = TileX(start_tile);
+	uint sy = TileY(start_tile);
+	uint ex = TileX(p1);
+	uint ey = TileY(p1);
+	if (sx > ex) Swap(sx, ex);
+	if (sy > ey) Swap(sy, ey);
+
+	/* The half-tile drag bits only make sense for a single stretch. */
+	uint32 row_p2 = p2 & ~3;
+
+	CommandCost total_cost(EXPENSES_CONSTRUCTION);
+	CommandCost last_error = CMD_ERROR;
+	bool had_success = false;
+
+	uint last_row = (axis == AXIS_X) ? ey : ex;
+	for (uint row = (axis == AXIS_X) ? sy : sx; row <= last_row; row++) {
+		TileIndex row_start = (axis == AXIS_X) ? TileXY(sx, row) : TileXY(row, sy);
+		TileIndex row_end   = (axis == AXIS_X) ? TileXY(ex, row) : TileXY(row, ey);
+
+		CommandCost ret = CmdBuildLongRoad(row_start, flags, row_end, row_p2, text);
+		if (ret.Failed()) {
+			last_error = ret;
+			if (is_ai) return last_error;
+		} else {
+			had_success = true;
+			total_cost.AddCost(ret);
+		}
+	}
+
+	if (had_success) return total_cost;
+	return last_error;
+}
+
 /**
  * Remove a long piece of road.
  * @param start_tile start tile of drag
@@ -82,10 +82,17 @@ static const byte RV_OVERTAKE_TIMEOUT = 35;
 void RoadVehUpdateCache(RoadVehicle *v, bool same_length = false);
 void GetRoadVehSpriteSize(EngineID engine, uint &width, uint &height, int &xoffs, int &yoffs, EngineImageType image_type);
 
+/**
+ * Cached path of a road vehicle, front entry first.
+ * Entries are consumed at junction tiles, so steady-state driving needs no
+ * pathfinder calls. The whole cache is discarded when layout_ctr no longer
+ * matches _road_layout_change_counter, which road modification commands bump
+ * via NotifyRoadLayoutChanged().
+ */
 struct RoadVehPathCache {
 	std::deque<Trackdir> td;
 	std::deque<TileIndex> tile;
-	uint32 layout_ctr;
+	uint32 layout_ctr;      ///< Value of _road_layout_change_counter when the path was computed.
 
 	inline bool empty() const { return this->td.empty(); }
 
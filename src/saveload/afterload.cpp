@@ -1967,6 +1967,8 @@ bool AfterLoadGame()
 		}
 	}
 
+	RebuildStationsWithLoadingVehiclesSet();
+
 	if (IsSavegameVersionBefore(SLV_58)) {
 		/* Setting difficulty industry_density other than zero get bumped to +1
 		 * since a new option (very low at position 1) has been added */
@@ -3525,14 +3527,12 @@ bool AfterLoadGame()
 	 * saved-by-server savegame. There are no clients with a backup, so clear it.
 	 * Furthermore before savegame version SLV_192 the actual content was always corrupt.
 	 */
-	if (!_networking || _network_server || IsSavegameVersionBefore(SLV_192)) {
-#ifndef DEBUG_DUMP_COMMANDS
+	if ((!_networking || _network_server || IsSavegameVersionBefore(SLV_192)) && !IsReplayingCommands()) {
 		/* Note: We cannot use CleanPool since that skips part of the destructor
 		 * and then leaks un-reachable Orders in the order pool. */
 		for (OrderBackup *ob : OrderBackup::Iterate()) {
 			delete ob;
 		}
-#endif
 	}
 
 	if (IsSavegameVersionBefore(SLV_198) && !SlXvIsFeaturePresent(XSLFI_JOKERPP, SL_JOKER_1_27)) {
@@ -4257,6 +4257,11 @@ bool AfterLoadGame()
 #endif
 	}
 
+	/* Repopulate the YAPF segment cost cache from the savegame, now that all
+	 * track layout fixups (and the resulting cache flush) are behind us. */
+	extern void SlApplyYapfSegmentCostCache();
+	SlApplyYapfSegmentCostCache();
+
 	_game_load_cur_date_ymd = _cur_date_ymd;
 	_game_load_date_fract = _date_fract;
 	_game_load_tick_skip_counter = _tick_skip_counter;
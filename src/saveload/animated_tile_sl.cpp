@@ -9,6 +9,7 @@
 
 #include "../stdafx.h"
 #include "../animated_tile.h"
+#include "../animated_tile_func.h"
 #include "../tile_type.h"
 #include "../core/alloc_func.hpp"
 #include "../core/smallvec_type.hpp"
@@ -74,7 +75,7 @@ static void Load_ANIT()
  * the animated tile table.
  */
 static const ChunkHandler animated_tile_chunk_handlers[] = {
-	{ 'ANIT', Save_ANIT, Load_ANIT, nullptr, nullptr, CH_RIFF },
+	{ 'ANIT', Save_ANIT, Load_ANIT, nullptr, nullptr, CH_RIFF, nullptr, GetAnimatedTileGeneration },
 };
 
 extern const ChunkHandlerTable _animated_tile_chunk_handlers(animated_tile_chunk_handlers);
@@ -41,25 +41,41 @@ static CargoMonitorID FixupCargoMonitor(CargoMonitorID number)
 	return number;
 }
 
-/** Save the #_cargo_deliveries monitoring map. */
-static void SaveDelivery()
+/**
+ * Save a cargo monitoring map.
+ * The hash map has no defined iteration order, write the entries sorted by
+ * monitor number so the same state always produces the same chunk.
+ * @param monitor_map Map to save.
+ */
+static void SaveMonitorMap(const CargoMonitorMap &monitor_map)
 {
+	std::vector<std::pair<CargoMonitorID, uint32>> entries;
+	entries.reserve(monitor_map.size());
+	for (const auto &it : monitor_map) {
+		entries.push_back({ it.first, it.second });
+	}
+	std::sort(entries.begin(), entries.end());
+
 	TempStorage storage;
 
 	int i = 0;
-	CargoMonitorMap::const_iterator iter = _cargo_deliveries.begin();
-	while (iter != _cargo_deliveries.end()) {
-		storage.number = iter->first;
-		storage.amount = iter->second;
+	for (const auto &entry : entries) {
+		storage.number = entry.first;
+		storage.amount = entry.second;
 
 		SlSetArrayIndex(i);
 		SlObject(&storage, _cargomonitor_pair_desc);
 
 		i++;
-		iter++;
 	}
 }
 
+/** Save the #_cargo_deliveries monitoring map. */
+static void SaveDelivery()
+{
+	SaveMonitorMap(_cargo_deliveries);
+}
+
 /** Load the #_cargo_deliveries monitoring map. */
 static void LoadDelivery()
 {
@@ -73,8 +89,7 @@ static void LoadDelivery()
 
 		if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-		std::pair<CargoMonitorID, uint32> p(storage.number, storage.amount);
-		_cargo_deliveries.insert(p);
+		_cargo_deliveries[storage.number] = storage.amount;
 	}
 }
 
@@ -82,20 +97,7 @@ static void LoadDelivery()
 /** Save the #_cargo_pickups monitoring map. */
 static void SavePickup()
 {
-	TempStorage storage;
-
-	int i = 0;
-	CargoMonitorMap::const_iterator iter = _cargo_pickups.begin();
-	while (iter != _cargo_pickups.end()) {
-		storage.number = iter->first;
-		storage.amount = iter->second;
-
-		SlSetArrayIndex(i);
-		SlObject(&storage, _cargomonitor_pair_desc);
-
-		i++;
-		iter++;
-	}
+	SaveMonitorMap(_cargo_pickups);
 }
 
 /** Load the #_cargo_pickups monitoring map. */
@@ -111,8 +113,7 @@ static void LoadPickup()
 
 		if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-		std::pair<CargoMonitorID, uint32> p(storage.number, storage.amount);
-		_cargo_pickups.insert(p);
+		_cargo_pickups[storage.number] = storage.amount;
 	}
 }
 
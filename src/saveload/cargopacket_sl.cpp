@@ -115,8 +115,8 @@ SaveLoadTable GetCargoPacketDesc()
 		     SLE_VAR(CargoPacket, source_xy,       SLE_UINT32),
 		     SLE_VAR(CargoPacket, loaded_at_xy,    SLE_UINT32),
 		     SLE_VAR(CargoPacket, count,           SLE_UINT16),
-		SLE_CONDVAR_X(CargoPacket, days_in_transit, SLE_FILE_U8 | SLE_VAR_U16, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_MORE_CARGO_AGE, 0, 0)),
-		SLE_CONDVAR_X(CargoPacket, days_in_transit, SLE_UINT16, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_MORE_CARGO_AGE)),
+		SLE_CONDVAR_X(CargoPacket, days_in_transit, SLE_FILE_U8 | SLE_VAR_I32, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_MORE_CARGO_AGE, 0, 0)),
+		SLE_CONDVAR_X(CargoPacket, days_in_transit, SLE_FILE_U16 | SLE_VAR_I32, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_MORE_CARGO_AGE)),
 		     SLE_VAR(CargoPacket, feeder_share,    SLE_INT64),
 		 SLE_CONDVAR(CargoPacket, source_type,     SLE_UINT8,  SLV_125, SL_MAX_VERSION),
 		 SLE_CONDVAR(CargoPacket, source_id,       SLE_UINT16, SLV_125, SL_MAX_VERSION),
@@ -132,10 +132,10 @@ SaveLoadTable GetCargoPacketDesc()
  */
 static void Save_CAPA()
 {
-	std::vector<SaveLoad> filtered_packet_desc = SlFilterObject(GetCargoPacketDesc());
+	SaveLoadPlan packet_plan = SlCompileObjectPlan(SlFilterObject(GetCargoPacketDesc()));
 	for (CargoPacket *cp : CargoPacket::Iterate()) {
 		SlSetArrayIndex(cp->index);
-		SlObjectSaveFiltered(cp, filtered_packet_desc);
+		SlObjectSavePlanned(cp, packet_plan);
 	}
 }
 
@@ -144,11 +144,11 @@ static void Save_CAPA()
  */
 static void Load_CAPA()
 {
-	std::vector<SaveLoad> filtered_packet_desc = SlFilterObject(GetCargoPacketDesc());
+	SaveLoadPlan packet_plan = SlCompileObjectPlan(SlFilterObject(GetCargoPacketDesc()));
 	int index;
 	while ((index = SlIterateArray()) != -1) {
 		CargoPacket *cp = new (index) CargoPacket();
-		SlObjectLoadFiltered(cp, filtered_packet_desc);
+		SlObjectLoadPlanned(cp, packet_plan);
 	}
 }
 
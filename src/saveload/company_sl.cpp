@@ -97,7 +97,16 @@ CompanyManagerFace ConvertFromOldCompanyManagerFace(uint32 face)
 	return cmf;
 }
 
-/** Rebuilding of company statistics after loading a savegame. */
+/**
+ * Rebuilding of company statistics after loading a savegame.
+ *
+ * This full-map recount only runs at savegame load (old saves do not store
+ * the totals) and from the desync cache verifier (see CheckCaches(),
+ * CHECK_CACHE_INFRA_TOTALS), which uses it to cross-check the live counts.
+ * During normal play CompanyInfrastructure is maintained strictly
+ * incrementally by the build/remove/ownership-change paths; do not call this
+ * from game code.
+ */
 void AfterLoadCompanyStats()
 {
 	/* Reset infrastructure statistics to zero. */
@@ -123,7 +123,7 @@ const SlxiSubChunkInfo _sl_xv_sub_chunk_infos[] = {
 	{ XSLFI_VEHICLE_FLAGS_EXTRA,              XSCF_NULL,                1,   1, "veh_flags_extra",                  nullptr, nullptr, nullptr          },
 	{ XSLFI_TRAIN_THROUGH_LOAD,               XSCF_NULL,                2,   2, "train_through_load",               nullptr, nullptr, nullptr          },
 	{ XSLFI_ORDER_EXTRA_DATA,                 XSCF_NULL,                2,   2, "order_extra_data",                 nullptr, nullptr, nullptr          },
-	{ XSLFI_WHOLE_MAP_CHUNK,                  XSCF_NULL,                2,   2, "whole_map_chunk",                  nullptr, nullptr, "WMAP"           },
+	{ XSLFI_WHOLE_MAP_CHUNK,                  XSCF_NULL,                3,   3, "whole_map_chunk",                  nullptr, nullptr, "WMAP"           },
 	{ XSLFI_ST_LAST_VEH_TYPE,                 XSCF_NULL,                1,   1, "station_last_veh_type",            nullptr, nullptr, nullptr          },
 	{ XSLFI_SELL_AT_DEPOT_ORDER,              XSCF_NULL,                1,   1, "sell_at_depot_order",              nullptr, nullptr, nullptr          },
 	{ XSLFI_BUY_LAND_RATE_LIMIT,              XSCF_NULL,                1,   1, "buy_land_rate_limit",              nullptr, nullptr, nullptr          },
@@ -188,6 +188,11 @@ const SlxiSubChunkInfo _sl_xv_sub_chunk_infos[] = {
 	{ XSLFI_MULTI_CARGO_SHIPS,                XSCF_NULL,                1,   1, "multi_cargo_ships",                nullptr, nullptr, nullptr          },
 	{ XSLFI_REMAIN_NEXT_ORDER_STATION,        XSCF_IGNORABLE_UNKNOWN,   1,   1, "remain_next_order_station",        nullptr, nullptr, nullptr          },
 	{ XSLFI_LABEL_ORDERS,                     XSCF_NULL,                2,   2, "label_orders",                     nullptr, nullptr, nullptr          },
+	{ XSLFI_YAPF_SEGMENT_CACHE,               XSCF_IGNORABLE_ALL,       1,   1, "yapf_segment_cache",               nullptr, nullptr, "YSCC"           },
+	{ XSLFI_LINKGRAPH_INCREMENTAL,            XSCF_NULL,                1,   1, "linkgraph_incremental",            nullptr, nullptr, nullptr          },
+	{ XSLFI_ORDER_FULL_REFRESH_CACHE,         XSCF_IGNORABLE_ALL,       1,   1, "order_full_refresh_cache",         nullptr, nullptr, nullptr          },
+	{ XSLFI_LINKGRAPH_COMPACT_SL,             XSCF_NULL,                1,   1, "linkgraph_compact_sl",             nullptr, nullptr, nullptr          },
+	{ XSLFI_LOAD_CHECK_FIRST,                 XSCF_IGNORABLE_ALL,       1,   1, "load_check_chunks_first",          nullptr, nullptr, nullptr          },
 	{ XSLFI_SCRIPT_INT64,                     XSCF_NULL,                1,   1, "script_int64",                     nullptr, nullptr, nullptr          },
 	{ XSLFI_U64_TICK_COUNTER,                 XSCF_NULL,                1,   1, "u64_tick_counter",                 nullptr, nullptr, nullptr          },
 	{ XSLFI_LINKGRAPH_TRAVEL_TIME,            XSCF_NULL,                1,   1, "linkgraph_travel_time",            nullptr, nullptr, nullptr          },
@@ -286,6 +291,7 @@ void SlXvSetCurrentState()
 	}
 	if (IsScenarioSave()) {
 		_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] = 0;
+		_sl_xv_feature_versions[XSLFI_LOAD_CHECK_FIRST] = 0;
 	}
 	if (IsNetworkServerSave()) {
 		_sl_xv_feature_versions[XSLFI_VENC_CHUNK] = 1;
@@ -139,6 +139,11 @@ enum SlXvFeatureIndex {
 	XSLFI_MULTI_CARGO_SHIPS,                      ///< Multi-cargo ships
 	XSLFI_REMAIN_NEXT_ORDER_STATION,              ///< Remain in station if next order is for same station
 	XSLFI_LABEL_ORDERS,                           ///< Label orders
+	XSLFI_YAPF_SEGMENT_CACHE,                     ///< YAPF rail segment cost cache is persisted in the savegame
+	XSLFI_LINKGRAPH_INCREMENTAL,                  ///< Link graphs track when they were last solved, for incremental recalculation
+	XSLFI_ORDER_FULL_REFRESH_CACHE,               ///< Order lists remember the last deduplicated full link refresh
+	XSLFI_LINKGRAPH_COMPACT_SL,                   ///< Link graph nodes/edges are saved varint-packed with date fields delta-encoded
+	XSLFI_LOAD_CHECK_FIRST,                       ///< Chunks with load-check data are written before all others, so a savegame check can stop early
 
 	XSLFI_SCRIPT_INT64,                           ///< See: SLV_SCRIPT_INT64
 	XSLFI_U64_TICK_COUNTER,                       ///< See: SLV_U64_TICK_COUNTER
@@ -32,6 +32,7 @@ SaveLoadTable GetLinkGraphDesc()
 {
 	static const SaveLoad link_graph_desc[] = {
 		 SLE_VAR(LinkGraph, last_compression, SLE_INT32),
+		SLE_CONDVAR_X(LinkGraph, last_solved, SLE_INT32, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_LINKGRAPH_INCREMENTAL)),
 		SLEG_VAR(_num_nodes,                  SLE_UINT16),
 		 SLE_VAR(LinkGraph, cargo,            SLE_UINT8),
 	};
@@ -144,26 +145,88 @@ static void FilterDescs()
 	_filtered_job_desc = SlFilterObject(GetLinkGraphJobDesc());
 }
 
+/**
+ * Write an unsigned value as a little-endian base-128 varint.
+ * Most link graph quantities are small, so this typically uses one or two
+ * bytes instead of the four or eight of a fixed-width field.
+ */
+static void SlWriteVarUint(uint64 value)
+{
+	do {
+		byte b = value & 0x7F;
+		value >>= 7;
+		if (value != 0) b |= 0x80;
+		SlWriteByte(b);
+	} while (value != 0);
+}
+
+/** Read an unsigned base-128 varint, see SlWriteVarUint(). */
+static uint64 SlReadVarUint()
+{
+	uint64 value = 0;
+	uint shift = 0;
+	byte b;
+	do {
+		if (shift >= 64) SlErrorCorrupt("Link graph varint overflow");
+		b = SlReadByte();
+		value |= uint64(b & 0x7F) << shift;
+		shift += 7;
+	} while (b & 0x80);
+	return value;
+}
+
+/** Write a signed value as a zig-zag encoded varint, see SlWriteVarUint(). */
+static void SlWriteVarDelta(int64 value)
+{
+	SlWriteVarUint((uint64(value) << 1) ^ uint64(value >> 63));
+}
+
+/** Read a zig-zag encoded signed varint, see SlWriteVarDelta(). */
+static int64 SlReadVarDelta()
+{
+	uint64 value = SlReadVarUint();
+	return int64(value >> 1) ^ -int64(value & 1);
+}
+
 /**
  * Save a link graph.
- * @param lg Link graph to be saved or loaded.
+ * Nodes and edges are varint-packed, with all date fields delta-encoded
+ * against the last compression date of the graph. Dates cluster around the
+ * compression date and capacities/usages are mostly small, so this shrinks
+ * the chunk considerably compared to fixed-width fields.
+ * @param lg Link graph to be saved.
  */
 void Save_LinkGraph(LinkGraph &lg)
 {
+	const int64 base_date = lg.last_compression;
 	uint16 size = lg.Size();
 	auto edge_iter = lg.edges.begin();
 	auto edge_end = lg.edges.end();
 	for (NodeID from = 0; from < size; ++from) {
-		Node *node = &lg.nodes[from];
-		SlObjectSaveFiltered(node, _filtered_node_desc);
-
+		const Node &node = lg.nodes[from];
+		SlWriteVarUint(node.xy);
+		SlWriteVarUint(node.supply);
+		SlWriteVarUint(node.demand);
+		SlWriteVarUint(node.station);
+		SlWriteVarDelta(node.last_update - base_date);
+
+		/* Edge destinations are strictly increasing per node, so store the
+		 * gap (+1) between consecutive destinations; 0 is the end marker. */
+		uint last = 0;
 		while (edge_iter != edge_end && edge_iter->first.first == from) {
-			SlWriteUint16(edge_iter->first.second);
-			Edge *edge = &edge_iter->second;
-			SlObjectSaveFiltered(edge, _filtered_edge_desc);
+			NodeID to = edge_iter->first.second;
+			SlWriteVarUint(to - last + 1);
+			last = to + 1;
+			const Edge &edge = edge_iter->second;
+			SlWriteVarUint(edge.capacity);
+			SlWriteVarUint(edge.usage);
+			SlWriteVarUint(edge.travel_time_sum);
+			SlWriteVarDelta(edge.last_unrestricted_update - base_date);
+			SlWriteVarDelta(edge.last_restricted_update - base_date);
+			SlWriteVarDelta(edge.last_aircraft_update - base_date);
 			++edge_iter;
 		}
-		SlWriteUint16(INVALID_NODE);
+		SlWriteVarUint(0);
 	}
 }
 
@@ -174,7 +237,33 @@ void Save_LinkGraph(LinkGraph &lg)
 void Load_LinkGraph(LinkGraph &lg)
 {
 	uint size = lg.Size();
-	if (SlXvIsFeaturePresent(XSLFI_LINKGRAPH_SPARSE_EDGES)) {
+	if (SlXvIsFeaturePresent(XSLFI_LINKGRAPH_COMPACT_SL)) {
+		const int64 base_date = lg.last_compression;
+		for (NodeID from = 0; from < size; ++from) {
+			Node &node = lg.nodes[from];
+			node.xy = (TileIndex)SlReadVarUint();
+			node.supply = (uint)SlReadVarUint();
+			node.demand = (uint)SlReadVarUint();
+			node.station = (StationID)SlReadVarUint();
+			node.last_update = (Date)(SlReadVarDelta() + base_date);
+
+			uint last = 0;
+			for (;;) {
+				uint64 gap = SlReadVarUint();
+				if (gap == 0) break;
+				uint64 to = last + gap - 1;
+				if (to >= size) SlErrorCorrupt("Link graph structure overflow");
+				last = (uint)to + 1;
+				Edge &edge = lg.edges[std::make_pair(from, (NodeID)to)];
+				edge.capacity = (uint)SlReadVarUint();
+				edge.usage = (uint)SlReadVarUint();
+				edge.travel_time_sum = SlReadVarUint();
+				edge.last_unrestricted_update = (Date)(SlReadVarDelta() + base_date);
+				edge.last_restricted_update = (Date)(SlReadVarDelta() + base_date);
+				edge.last_aircraft_update = (Date)(SlReadVarDelta() + base_date);
+			}
+		}
+	} else if (SlXvIsFeaturePresent(XSLFI_LINKGRAPH_SPARSE_EDGES)) {
 		for (NodeID from = 0; from < size; ++from) {
 			Node *node = &lg.nodes[from];
 			SlObjectLoadFiltered(node, _filtered_node_desc);
@@ -24,6 +24,65 @@ static uint32 _map_dim_x;
 static uint32 _map_dim_y;
 
 extern bool _sl_maybe_chillpp;
+extern byte *_map_storage;
+extern byte *_map_ext_storage;
+extern MapTileColumns _map_cols;
+
+/**
+ * Snapshot of the map storage, taken on the game thread so that the map
+ * chunks can be serialised from it on the save thread while the game keeps
+ * running. The column locations are rebased onto the copied blocks.
+ */
+struct MapSaveSnapshot {
+	byte *storage = nullptr;     ///< Copy of _map_storage.
+	byte *ext_storage = nullptr; ///< Copy of _map_ext_storage.
+	MapTileColumns cols = {};    ///< Column locations within the copies.
+};
+static MapSaveSnapshot _map_snapshot;
+static bool _map_snapshot_active = false;
+
+/** Copy the map storage into the save snapshot. Call on the game thread only. */
+void TakeMapSaveSnapshot()
+{
+	assert(!_map_snapshot_active);
+	const size_t base_size = (size_t)MapSize() * sizeof(Tile);
+	const size_t ext_size = (size_t)MapSize() * sizeof(TileExtended);
+	_map_snapshot.storage = MallocT<byte>(base_size);
+	_map_snapshot.ext_storage = MallocT<byte>(ext_size);
+	memcpy(_map_snapshot.storage, _map_storage, base_size);
+	memcpy(_map_snapshot.ext_storage, _map_ext_storage, ext_size);
+
+	auto rebase = [](const MapTileColumn &col, const byte *old_base, byte *new_base) -> MapTileColumn {
+		return { new_base + (col.base - old_base), col.shift };
+	};
+	_map_snapshot.cols.type   = rebase(_map_cols.type,   _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.height = rebase(_map_cols.height, _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m2     = rebase(_map_cols.m2,     _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m1     = rebase(_map_cols.m1,     _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m3     = rebase(_map_cols.m3,     _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m4     = rebase(_map_cols.m4,     _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m5     = rebase(_map_cols.m5,     _map_storage, _map_snapshot.storage);
+	_map_snapshot.cols.m6     = rebase(_map_cols.m6,     _map_ext_storage, _map_snapshot.ext_storage);
+	_map_snapshot.cols.m7     = rebase(_map_cols.m7,     _map_ext_storage, _map_snapshot.ext_storage);
+	_map_snapshot.cols.m8     = rebase(_map_cols.m8,     _map_ext_storage, _map_snapshot.ext_storage);
+	_map_snapshot_active = true;
+}
+
+/** Release the map save snapshot, if any. */
+void FreeMapSaveSnapshot()
+{
+	free(_map_snapshot.storage);
+	free(_map_snapshot.ext_storage);
+	_map_snapshot.storage = nullptr;
+	_map_snapshot.ext_storage = nullptr;
+	_map_snapshot_active = false;
+}
+
+/** Get the column locations the map chunks should be saved from. */
+static inline const MapTileColumns &SaveMapCols()
+{
+	return _map_snapshot_active ? _map_snapshot.cols : _map_cols;
+}
 
 static const SaveLoad _map_dimensions[] = {
 	SLEG_CONDVAR(_map_dim_x, SLE_UINT32, SLV_6, SL_MAX_VERSION),
@@ -211,18 +270,127 @@ static void Load_MAP8()
 	}
 }
 
+/**
+ * Append a PackBits-style run-length encoding of a byte plane to \a out.
+ * Tokens 0x00-0x7F are followed by token + 1 literal bytes; tokens
+ * 0x80-0xFF are followed by one byte which is repeated token - 0x7E times.
+ * Runs are extended eight bytes at a time, so the runny map planes (ocean,
+ * flat land) are scanned at close to memory speed.
+ * @param data Plane to encode.
+ * @param size Size of the plane in bytes.
+ * @param out Buffer to append the encoding to.
+ */
+static void EncodeRLEPlane(const byte *data, size_t size, std::vector<byte> &out)
+{
+	size_t i = 0;
+	size_t literal_start = 0;
+	auto flush_literals = [&](size_t end) {
+		size_t pos = literal_start;
+		while (pos < end) {
+			size_t chunk = std::min<size_t>(end - pos, 128);
+			out.push_back((byte)(chunk - 1));
+			out.insert(out.end(), data + pos, data + pos + chunk);
+			pos += chunk;
+		}
+	};
+	while (i < size) {
+		const byte value = data[i];
+		size_t run_end = i + 1;
+		if (run_end < size && data[run_end] == value) {
+			uint64 pattern;
+			memset(&pattern, value, sizeof(pattern));
+			run_end++;
+			while (run_end + 8 <= size) {
+				uint64 block;
+				memcpy(&block, data + run_end, 8);
+				if (block != pattern) break;
+				run_end += 8;
+			}
+			while (run_end < size && data[run_end] == value) run_end++;
+		}
+		size_t run = run_end - i;
+		if (run >= 3) {
+			flush_literals(i);
+			while (run >= 3) {
+				size_t chunk = std::min<size_t>(run, 129);
+				out.push_back((byte)(chunk + 0x7E));
+				out.push_back(value);
+				i += chunk;
+				run -= chunk;
+			}
+			/* Any remaining 1 or 2 bytes join the next literal block. */
+			literal_start = i;
+		} else {
+			i = run_end;
+		}
+	}
+	flush_literals(size);
+}
+
+/**
+ * Decode a run-length encoded byte plane, see EncodeRLEPlane().
+ * @param reader Read buffer to decode from.
+ * @param data Plane to decode into.
+ * @param size Size of the plane in bytes.
+ */
+static void DecodeRLEPlane(ReadBuffer *reader, byte *data, size_t size)
+{
+	size_t i = 0;
+	while (i < size) {
+		reader->CheckBytes(1);
+		byte token = reader->RawReadByte();
+		if (token & 0x80) {
+			size_t count = token - 0x7E;
+			if (count > size - i) SlErrorCorrupt("Map RLE run overflow");
+			reader->CheckBytes(1);
+			memset(data + i, reader->RawReadByte(), count);
+			i += count;
+		} else {
+			size_t count = token + 1;
+			if (count > size - i) SlErrorCorrupt("Map RLE literal overflow");
+			reader->CopyBytes(data + i, count);
+			i += count;
+		}
+	}
+}
+
 static void Load_WMAP()
 {
 	static_assert(sizeof(Tile) == 8);
 	static_assert(sizeof(TileExtended) == 4);
-	assert(_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 1 || _sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 2);
+	assert(_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] >= 1 && _sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] <= 3);
 
 	ReadBuffer *reader = ReadBuffer::GetCurrent();
 	const TileIndex size = MapSize();
 
+	if (_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 3) {
+		/* Run-length encoded planes, in the same field order as version 2. */
+		std::vector<byte> plane(size);
+		auto load8 = [&](auto &&assign) {
+			DecodeRLEPlane(reader, plane.data(), size);
+			for (TileIndex i = 0; i != size; i++) assign(i, plane[i]);
+		};
+		load8([](TileIndex i, byte v) { _m[i].type = v; });
+		load8([](TileIndex i, byte v) { _m[i].height = v; });
+		load8([](TileIndex i, byte v) { _m[i].m2 = v; });
+		load8([](TileIndex i, byte v) { _m[i].m2 |= ((uint16)v) << 8; });
+		load8([](TileIndex i, byte v) { _m[i].m1 = v; });
+		load8([](TileIndex i, byte v) { _m[i].m3 = v; });
+		load8([](TileIndex i, byte v) { _m[i].m4 = v; });
+		load8([](TileIndex i, byte v) { _m[i].m5 = v; });
+		load8([](TileIndex i, byte v) { _me[i].m6 = v; });
+		load8([](TileIndex i, byte v) { _me[i].m7 = v; });
+		load8([](TileIndex i, byte v) { _me[i].m8 = v; });
+		load8([](TileIndex i, byte v) { _me[i].m8 |= ((uint16)v) << 8; });
+		return;
+	}
+
 #if TTD_ENDIAN == TTD_LITTLE_ENDIAN
-	reader->CopyBytes((byte *) _m, size * 8);
-#else
+	if (_map_storage_mode == MSM_INTERLEAVED) {
+		extern byte *_map_storage;
+		reader->CopyBytes(_map_storage, size * 8);
+	} else
+#endif
 	for (TileIndex i = 0; i != size; i++) {
 		reader->CheckBytes(8);
 		_m[i].type = reader->RawReadByte();
@@ -235,7 +403,6 @@ static void Load_WMAP()
 		_m[i].m4 = reader->RawReadByte();
 		_m[i].m5 = reader->RawReadByte();
 	}
-#endif
 
 	if (_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 1) {
 		for (TileIndex i = 0; i != size; i++) {
@@ -245,8 +412,11 @@ static void Load_WMAP()
 		}
 	} else if (_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 2) {
 #if TTD_ENDIAN == TTD_LITTLE_ENDIAN
-		reader->CopyBytes((byte *) _me, size * 4);
-#else
+		if (_map_storage_mode == MSM_INTERLEAVED) {
+			extern byte *_map_ext_storage;
+			reader->CopyBytes(_map_ext_storage, size * 4);
+		} else
+#endif
 		for (TileIndex i = 0; i != size; i++) {
 			reader->CheckBytes(4);
 			_me[i].m6 = reader->RawReadByte();
@@ -255,7 +425,6 @@ static void Load_WMAP()
 			m8 |= ((uint16) reader->RawReadByte()) << 8;
 			_me[i].m8 = m8;
 		}
-#endif
 	} else {
 		NOT_REACHED();
 	}
@@ -265,85 +434,89 @@ static void Save_WMAP()
 {
 	static_assert(sizeof(Tile) == 8);
 	static_assert(sizeof(TileExtended) == 4);
-	assert(_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 2);
+	assert(_sl_xv_feature_versions[XSLFI_WHOLE_MAP_CHUNK] == 3);
 
-	MemoryDumper *dumper = MemoryDumper::GetCurrent();
 	const TileIndex size = MapSize();
-	SlSetLength(size * 12);
-
-#if TTD_ENDIAN == TTD_LITTLE_ENDIAN
-	dumper->CopyBytes((byte *) _m, size * 8);
-	dumper->CopyBytes((byte *) _me, size * 4);
-#else
-	for (TileIndex i = 0; i != size; i++) {
-		dumper->CheckBytes(8);
-		dumper->RawWriteByte(_m[i].type);
-		dumper->RawWriteByte(_m[i].height);
-		dumper->RawWriteByte(GB(_m[i].m2, 0, 8));
-		dumper->RawWriteByte(GB(_m[i].m2, 8, 8));
-		dumper->RawWriteByte(_m[i].m1);
-		dumper->RawWriteByte(_m[i].m3);
-		dumper->RawWriteByte(_m[i].m4);
-		dumper->RawWriteByte(_m[i].m5);
-	}
-	for (TileIndex i = 0; i != size; i++) {
-		dumper->CheckBytes(4);
-		dumper->RawWriteByte(_me[i].m6);
-		dumper->RawWriteByte(_me[i].m7);
-		dumper->RawWriteByte(GB(_me[i].m8, 0, 8));
-		dumper->RawWriteByte(GB(_me[i].m8, 8, 8));
-	}
-#endif
+	const MapTileColumns &cols = SaveMapCols();
+
+	/* Gather each map field into a contiguous plane and run-length encode
+	 * it. The planes are highly runny (ocean, flat land), so this shrinks
+	 * the chunk and cuts the bytes pushed into the compression filter. */
+	std::vector<byte> out;
+	std::vector<byte> plane(size);
+	auto encode_plane8 = [&](const MapTileColumn &col) {
+		for (TileIndex i = 0; i != size; i++) plane[i] = MapTileField<byte>(col, i);
+		EncodeRLEPlane(plane.data(), size, out);
+	};
+	auto encode_plane16 = [&](const MapTileColumn &col) {
+		for (TileIndex i = 0; i != size; i++) plane[i] = GB(MapTileField<uint16>(col, i), 0, 8);
+		EncodeRLEPlane(plane.data(), size, out);
+		for (TileIndex i = 0; i != size; i++) plane[i] = GB(MapTileField<uint16>(col, i), 8, 8);
+		EncodeRLEPlane(plane.data(), size, out);
+	};
+	encode_plane8(cols.type);
+	encode_plane8(cols.height);
+	encode_plane16(cols.m2);
+	encode_plane8(cols.m1);
+	encode_plane8(cols.m3);
+	encode_plane8(cols.m4);
+	encode_plane8(cols.m5);
+	encode_plane8(cols.m6);
+	encode_plane8(cols.m7);
+	encode_plane16(cols.m8);
+
+	SlSetLength(out.size());
+	MemoryDumper::GetCurrent()->CopyBytes(out.data(), out.size());
 }
 
 struct MAPT {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].type; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().type, t); }
 };
 
 struct MAPH {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].height; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().height, t); }
 };
 
 struct MAP1 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].m1; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m1, t); }
 };
 
 struct MAP2 {
 	typedef uint16 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].m2; }
+	static FieldT GetField(TileIndex t) { return MapTileField<uint16>(SaveMapCols().m2, t); }
 };
 
 struct MAP3 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].m3; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m3, t); }
 };
 
 struct MAP4 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].m4; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m4, t); }
 };
 
 struct MAP5 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _m[t].m5; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m5, t); }
 };
 
 struct MAP6 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _me[t].m6; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m6, t); }
 };
 
 struct MAP7 {
 	typedef uint8 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _me[t].m7; }
+	static FieldT GetField(TileIndex t) { return MapTileField<byte>(SaveMapCols().m7, t); }
 };
 
 struct MAP8 {
 	typedef uint16 FieldT;
-	static const FieldT &GetField(TileIndex t) { return _me[t].m8; }
+	static FieldT GetField(TileIndex t) { return MapTileField<uint16>(SaveMapCols().m8, t); }
 };
 
 template <typename T>
@@ -278,6 +278,8 @@ SaveLoadTable GetOrderListDescription()
 		      SLE_REF(OrderList, first,                                    REF_ORDER),
 		SLEG_CONDVAR_X(_jokerpp_separation_mode,                           SLE_UINT32, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_JOKERPP)),
 		SLE_CONDNULL_X(21,                                                             SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_JOKERPP)),
+		SLE_CONDVAR_X(OrderList, last_full_refresh_date,                   SLE_INT32,  SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_ORDER_FULL_REFRESH_CACHE)),
+		SLE_CONDVAR_X(OrderList, last_full_refresh_signature,              SLE_UINT64, SL_MIN_VERSION, SL_MAX_VERSION, SlXvFeatureTest(XSLFTO_AND, XSLFI_ORDER_FULL_REFRESH_CACHE)),
 	};
 
 	return _orderlist_desc;
@@ -66,6 +66,7 @@ void GenerateDefaultSaveName(char *buf, const char *last);
 void SetSaveLoadError(StringID str);
 const char *GetSaveLoadErrorString();
 SaveOrLoadResult SaveOrLoad(const std::string &filename, SaveLoadOperation fop, DetailedFileType dft, Subdirectory sb, bool threaded = true, SaveModeFlags flags = SMF_NONE);
+bool IsSaveInProgress();
 void WaitTillSaved();
 void ProcessAsyncSaveFinish();
 void DoExitSave();
@@ -94,6 +95,13 @@ enum ChunkSaveLoadSpecialOpResult {
 };
 typedef ChunkSaveLoadSpecialOpResult ChunkSaveLoadSpecialProc(uint32, ChunkSaveLoadSpecialOp);
 
+/**
+ * Returns a generation counter for the state saved by a chunk.
+ * The counter must change whenever the saved form of the chunk may have changed.
+ * Chunks which provide this may have their serialised data reused between saves, see SlSaveChunk.
+ */
+typedef uint64 ChunkSaveGenerationProc();
+
 /** Type of a chunk. */
 enum ChunkType {
 	CH_RIFF = 0,
@@ -113,6 +121,7 @@ struct ChunkHandler {
 	ChunkSaveLoadProc *load_check_proc; ///< Load procedure for game preview.
 	ChunkType type;                     ///< Type of the chunk. @see ChunkType
 	ChunkSaveLoadSpecialProc *special_proc = nullptr;
+	ChunkSaveGenerationProc *save_generation_proc = nullptr; ///< Optional: generation counter of the saved state, enables reuse of serialised data between saves.
 };
 
 template <typename F>
@@ -751,6 +760,36 @@ void SlObjectSaveFiltered(void *object, const SaveLoadTable &slt);
 void SlObjectLoadFiltered(void *object, const SaveLoadTable &slt);
 void SlObjectPtrOrNullFiltered(void *object, const SaveLoadTable &slt);
 
+/** Field of a save/load plan which is copied directly between the object and the savegame buffer. */
+struct SaveLoadPlanCopy {
+	uint32 offset; ///< Offset of the field in the object.
+	uint8 size;    ///< Width of the field in bytes; identical in memory and in the savegame.
+};
+
+/** Run of consecutive fields of a save/load plan: direct copies followed by generic fields. */
+struct SaveLoadPlanRun {
+	uint16 copy_count;    ///< Number of direct field copies to perform.
+	uint16 generic_count; ///< Number of fields to handle via the generic member code afterwards.
+	uint32 copy_bytes;    ///< Total width in bytes of the direct copies.
+};
+
+/**
+ * A version-filtered SaveLoad table compiled into a flat sequence of direct
+ * field copies, with the generic field-by-field code only used for the fields
+ * which require conversion. See SlCompileObjectPlan().
+ */
+struct SaveLoadPlan {
+	std::vector<SaveLoadPlanCopy> copies; ///< Fields handled by direct copies, in table order.
+	std::vector<SaveLoad> generics;       ///< Fields which go through the generic member code, in table order.
+	std::vector<SaveLoadPlanRun> runs;    ///< Interleaving of copies and generics.
+	size_t fixed_length;                  ///< Savegame size of one object, only valid if fixed_size is set.
+	bool fixed_size;                      ///< Whether every object occupies exactly fixed_length bytes in the savegame.
+};
+
+SaveLoadPlan SlCompileObjectPlan(const SaveLoadTable &slt);
+void SlObjectSavePlanned(void *object, const SaveLoadPlan &plan);
+void SlObjectLoadPlanned(void *object, const SaveLoadPlan &plan);
+
 void NORETURN CDECL SlErrorFmt(StringID string, const char *msg, ...) WARN_FORMAT(2, 3);
 
 bool SaveloadCrashWithMissingNewGRFs();
@@ -40,6 +40,16 @@ struct ReadBuffer {
 	{
 	}
 
+	/**
+	 * Initialise the buffer to decode directly from a block of memory (e.g. a file mapping).
+	 * Running out of \a data is treated as the end of the savegame.
+	 * @param data The data to decode from, must stay valid for the lifetime of this buffer.
+	 * @param len  The number of bytes in \a data.
+	 */
+	ReadBuffer(const byte *data, size_t len) : bufp(const_cast<byte *>(data)), bufe(const_cast<byte *>(data) + len), reader(nullptr), read(len)
+	{
+	}
+
 	static ReadBuffer *GetCurrent();
 
 	void SkipBytesSlowPath(size_t bytes);
@@ -175,6 +185,8 @@ struct MemoryDumper {
 
 	void FinaliseBlock();
 	void AllocateBuffer();
+	void WriteBlocks(SaveFilter *writer);
+	void CopyRange(size_t start, std::vector<byte> &out) const;
 
 	inline void CheckBytes(size_t bytes)
 	{
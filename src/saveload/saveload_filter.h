@@ -10,6 +10,8 @@
 #ifndef SAVELOAD_FILTER_H
 #define SAVELOAD_FILTER_H
 
+#include <utility>
+
 /** Interface for filtering a savegame till it is loaded. */
 struct LoadFilter {
 	/** Chained to the (savegame) filters. */
@@ -44,6 +46,16 @@ struct LoadFilter {
 	{
 		this->chain->Reset();
 	}
+
+	/**
+	 * Get direct access to the remaining data of this filter, if supported.
+	 * When non-null is returned the data can be decoded in place, without going through Read.
+	 * @return Pointer to and size of the remaining data, or { nullptr, 0 } when not supported.
+	 */
+	virtual std::pair<const byte *, size_t> GetDirectReadData()
+	{
+		return { nullptr, 0 };
+	}
 };
 
 /**
@@ -131,6 +131,13 @@ void AfterLoadStations()
 			Station *sta = Station::From(st);
 			for (const RoadStop *rs = sta->bus_stops; rs != nullptr; rs = rs->next) sta->bus_station.Add(rs->xy);
 			for (const RoadStop *rs = sta->truck_stops; rs != nullptr; rs = rs->next) sta->truck_station.Add(rs->xy);
+
+			/* Rebuild the rating sweep mask, it is not saved. */
+			sta->goods_rating_pending = 0;
+			for (CargoID c = 0; c < NUM_CARGO; c++) {
+				const GoodsEntry &ge = sta->goods[c];
+				if (ge.HasRating() || ge.rating < INITIAL_STATION_RATING) SetBit(sta->goods_rating_pending, c);
+			}
 		}
 
 		StationUpdateCachedTriggers(st);
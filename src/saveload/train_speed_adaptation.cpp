@@ -31,7 +31,7 @@ static void Load_TSAS()
 	while ((index = SlIterateArray()) != -1) {
 		const_cast<SignalSpeedKey &>(data.first).signal_tile = index;
 		SlObjectLoadFiltered(&data, _filtered_train_speed_adaptation_map_desc);
-		_signal_speeds.insert(data);
+		_signal_speeds[data.first] = data.second;
 	}
 	_filtered_train_speed_adaptation_map_desc.clear();
 }
@@ -46,8 +46,9 @@ static void Save_TSAS()
 	_filtered_train_speed_adaptation_map_desc = SlFilterObject(_train_speed_adaptation_map_desc);
 	for (auto &it : _signal_speeds) {
 		SlSetArrayIndex(it.first.signal_tile);
-		SignalSpeedType *data = &it;
-		SlAutolength((AutolengthProc*) RealSave_TSAS, data);
+		/* The map stores robin_hood::pair, copy into the std::pair the field offsets are based on. */
+		SignalSpeedType data(it.first, it.second);
+		SlAutolength((AutolengthProc*) RealSave_TSAS, &data);
 	}
 	_filtered_train_speed_adaptation_map_desc.clear();
 }
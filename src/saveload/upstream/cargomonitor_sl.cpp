@@ -30,6 +30,33 @@ static const SaveLoad _cargomonitor_pair_desc[] = {
 	SLE_VAR(TempStorage, amount, SLE_UINT32),
 };
 
+/**
+ * Save a cargo monitor map, ordered by monitor number for deterministic output.
+ * @param monitor_map The map to save.
+ */
+static void SaveMonitorMap(const CargoMonitorMap &monitor_map)
+{
+	std::vector<std::pair<CargoMonitorID, uint32>> entries;
+	entries.reserve(monitor_map.size());
+	for (const auto &it : monitor_map) {
+		entries.push_back({ it.first, (uint32)it.second });
+	}
+	std::sort(entries.begin(), entries.end());
+
+	TempStorage storage;
+
+	int i = 0;
+	for (const auto &entry : entries) {
+		storage.number = entry.first;
+		storage.amount = entry.second;
+
+		SlSetArrayIndex(i);
+		SlObject(&storage, _cargomonitor_pair_desc);
+
+		i++;
+	}
+}
+
 static CargoMonitorID FixupCargoMonitor(CargoMonitorID number)
 {
 	/* Between SLV_EXTEND_CARGOTYPES and SLV_FIX_CARGO_MONITOR, the
@@ -53,20 +80,7 @@ struct CMDLChunkHandler : ChunkHandler {
 	{
 		SlTableHeader(_cargomonitor_pair_desc);
 
-		TempStorage storage;
-
-		int i = 0;
-		CargoMonitorMap::const_iterator iter = _cargo_deliveries.begin();
-		while (iter != _cargo_deliveries.end()) {
-			storage.number = iter->first;
-			storage.amount = iter->second;
-
-			SlSetArrayIndex(i);
-			SlObject(&storage, _cargomonitor_pair_desc);
-
-			i++;
-			iter++;
-		}
+		SaveMonitorMap(_cargo_deliveries);
 	}
 
 	void Load() const override
@@ -83,8 +97,7 @@ struct CMDLChunkHandler : ChunkHandler {
 
 			if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-			std::pair<CargoMonitorID, uint32> p(storage.number, storage.amount);
-			_cargo_deliveries.insert(p);
+			_cargo_deliveries[storage.number] = storage.amount;
 		}
 	}
 };
@@ -97,20 +110,7 @@ struct CMPUChunkHandler : ChunkHandler {
 	{
 		SlTableHeader(_cargomonitor_pair_desc);
 
-		TempStorage storage;
-
-		int i = 0;
-		CargoMonitorMap::const_iterator iter = _cargo_pickups.begin();
-		while (iter != _cargo_pickups.end()) {
-			storage.number = iter->first;
-			storage.amount = iter->second;
-
-			SlSetArrayIndex(i);
-			SlObject(&storage, _cargomonitor_pair_desc);
-
-			i++;
-			iter++;
-		}
+		SaveMonitorMap(_cargo_pickups);
 	}
 
 	void Load() const override
@@ -127,8 +127,7 @@ struct CMPUChunkHandler : ChunkHandler {
 
 			if (fix) storage.number = FixupCargoMonitor(storage.number);
 
-			std::pair<CargoMonitorID, uint32> p(storage.number, storage.amount);
-			_cargo_pickups.insert(p);
+			_cargo_pickups[storage.number] = storage.amount;
 		}
 	}
 };
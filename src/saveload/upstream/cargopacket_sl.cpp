@@ -31,8 +31,8 @@ SaveLoadTable GetCargoPacketDesc()
 		SLE_VAR(CargoPacket, source_xy,       SLE_UINT32),
 		SLE_VAR(CargoPacket, loaded_at_xy,    SLE_UINT32),
 		SLE_VAR(CargoPacket, count,           SLE_UINT16),
-		SLE_CONDVAR(CargoPacket, days_in_transit, SLE_FILE_U8 | SLE_VAR_U16, SL_MIN_VERSION, SLV_MORE_CARGO_AGE),
-		SLE_CONDVAR(CargoPacket, days_in_transit, SLE_UINT16, SLV_MORE_CARGO_AGE, SL_MAX_VERSION),
+		SLE_CONDVAR(CargoPacket, days_in_transit, SLE_FILE_U8 | SLE_VAR_I32, SL_MIN_VERSION, SLV_MORE_CARGO_AGE),
+		SLE_CONDVAR(CargoPacket, days_in_transit, SLE_FILE_U16 | SLE_VAR_I32, SLV_MORE_CARGO_AGE, SL_MAX_VERSION),
 		SLE_VAR(CargoPacket, feeder_share,    SLE_INT64),
 		SLE_CONDVAR(CargoPacket, source_type,     SLE_UINT8,  SLV_125, SL_MAX_VERSION),
 		SLE_CONDVAR(CargoPacket, source_id,       SLE_UINT16, SLV_125, SL_MAX_VERSION),
@@ -1009,10 +1009,13 @@ const SaveLoadTable GetVehicleDescriptionFiltered(VehicleType vt)
 	return *(_filtered_veh_descs[vt]);
 }
 
+static SaveLoadPlan _veh_plans[lengthof(_filtered_veh_descs)];
+
 static void SetupDescs_VEHS()
 {
 	for (size_t i = 0; i < lengthof(_filtered_veh_descs); i++) {
 		*(_filtered_veh_descs[i]) = SlFilterObject(GetVehicleDescription((VehicleType) i));
+		_veh_plans[i] = SlCompileObjectPlan(*(_filtered_veh_descs[i]));
 	}
 }
 
@@ -1023,7 +1026,7 @@ static void Save_VEHS()
 	/* Write the vehicles */
 	for (Vehicle *v : Vehicle::Iterate()) {
 		SlSetArrayIndex(v->index);
-		SlObjectSaveFiltered(v, GetVehicleDescriptionFiltered(v->type));
+		SlObjectSavePlanned(v, _veh_plans[v->type]);
 	}
 }
 
@@ -1054,7 +1057,7 @@ void Load_VEHS()
 			default: SlErrorCorrupt("Invalid vehicle type");
 		}
 
-		SlObjectLoadFiltered(v, GetVehicleDescriptionFiltered(vtype));
+		SlObjectLoadPlanned(v, _veh_plans[vtype]);
 
 		if (_cargo_count != 0 && IsCompanyBuildableVehicleType(v) && CargoPacket::CanAllocateItem()) {
 			/* Don't construct the packet with station here, because that'll fail with old savegames */
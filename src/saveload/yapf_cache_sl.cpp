@@ -0,0 +1,126 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_cache_sl.cpp Code handling saving and loading of the YAPF rail segment cost cache */
+
+#include "../stdafx.h"
+#include "../pathfinder/yapf/yapf_cache.h"
+#include <vector>
+#include "saveload.h"
+#include "saveload_buffer.h"
+
+typedef std::vector<byte> Buffer;
+
+/* Variable length integers are stored in Variable Length Quantity
+ * format (http://en.wikipedia.org/wiki/Variable-length_quantity) */
+
+static void WriteVLI(Buffer &b, uint i)
+{
+	uint lsmask =  0x7F;
+	uint msmask = ~0x7F;
+	while (i & msmask) {
+		byte part = (i & lsmask) | 0x80;
+		b.push_back(part);
+		i >>= 7;
+	}
+	b.push_back((byte) i);
+}
+
+static uint ReadVLI()
+{
+	uint shift = 0;
+	uint val = 0;
+	byte b;
+
+	b = SlReadByte();
+	while (b & 0x80) {
+		val |= uint(b & 0x7F) << shift;
+		shift += 7;
+		b = SlReadByte();
+	}
+	val |= uint(b) << shift;
+	return val;
+}
+
+/**
+ * Loaded cache entries are staged here instead of being written into the live
+ * caches directly: AfterLoadGame() notifies YAPF of a track layout change,
+ * which would flush anything imported earlier. SlApplyYapfSegmentCostCache()
+ * injects the staged entries once all load-time fixups are done.
+ */
+static std::vector<YapfRailSegmentCacheEntry> _yapf_cache_staging[YAPF_RAIL_SEGMENT_CACHE_COUNT];
+
+static void Save_YSCC()
+{
+	Buffer b;
+	WriteVLI(b, YAPF_RAIL_SEGMENT_CACHE_COUNT);
+	for (uint cache_id = 0; cache_id < YAPF_RAIL_SEGMENT_CACHE_COUNT; cache_id++) {
+		std::vector<YapfRailSegmentCacheEntry> entries;
+		YapfExportRailSegmentCostCache(cache_id, entries);
+		WriteVLI(b, (uint)entries.size());
+		for (const YapfRailSegmentCacheEntry &entry : entries) {
+			WriteVLI(b, entry.key);
+			WriteVLI(b, entry.last_tile);
+			WriteVLI(b, entry.last_td);
+			WriteVLI(b, (uint)entry.cost);
+			WriteVLI(b, entry.last_signal_tile);
+			WriteVLI(b, entry.last_signal_td);
+			WriteVLI(b, entry.end_segment_reason);
+		}
+	}
+
+	uint size = (uint)b.size();
+	SlSetLength(size);
+	MemoryDumper::GetCurrent()->CopyBytes(b.data(), size);
+}
+
+static void Load_YSCC()
+{
+	uint cache_count = ReadVLI();
+	for (uint cache_id = 0; cache_id < cache_count; cache_id++) {
+		uint count = ReadVLI();
+		if (cache_id >= YAPF_RAIL_SEGMENT_CACHE_COUNT) {
+			/* More caches than this version knows about, skip the entries. */
+			for (uint i = 0; i < count * 7; i++) ReadVLI();
+			continue;
+		}
+		std::vector<YapfRailSegmentCacheEntry> &staging = _yapf_cache_staging[cache_id];
+		staging.clear();
+		staging.reserve(count);
+		for (uint i = 0; i < count; i++) {
+			YapfRailSegmentCacheEntry &entry = staging.emplace_back();
+			entry.key = ReadVLI();
+			entry.last_tile = (TileIndex)ReadVLI();
+			entry.last_td = (uint8)ReadVLI();
+			entry.cost = (int32)ReadVLI();
+			entry.last_signal_tile = (TileIndex)ReadVLI();
+			entry.last_signal_td = (uint8)ReadVLI();
+			entry.end_segment_reason = (uint16)ReadVLI();
+		}
+	}
+}
+
+/**
+ * Import the staged segment cost cache entries into the live caches.
+ * Called at the end of AfterLoadGame(), after the load-time cache flush.
+ */
+void SlApplyYapfSegmentCostCache()
+{
+	for (uint cache_id = 0; cache_id < YAPF_RAIL_SEGMENT_CACHE_COUNT; cache_id++) {
+		std::vector<YapfRailSegmentCacheEntry> &staging = _yapf_cache_staging[cache_id];
+		if (staging.empty()) continue;
+		YapfImportRailSegmentCostCache(cache_id, staging);
+		staging.clear();
+		staging.shrink_to_fit();
+	}
+}
+
+extern const ChunkHandler yapf_cache_chunk_handlers[] = {
+	{ 'YSCC', Save_YSCC, Load_YSCC, nullptr, nullptr, CH_RIFF },
+};
+
+extern const ChunkHandlerTable _yapf_cache_chunk_handlers(yapf_cache_chunk_handlers);
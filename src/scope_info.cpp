@@ -24,17 +24,20 @@
 
 #ifdef USE_SCOPE_INFO
 
-std::vector<std::function<int(char *, const char *)>> _scope_stack;
+thread_local scope_stack_record _scope_stack[SCOPE_STACK_MAX_DEPTH];
+thread_local uint _scope_stack_depth = 0;
 
 int WriteScopeLog(char *buf, const char *last)
 {
 	char *b = buf;
-	if (!_scope_stack.empty()) {
+	if (_scope_stack_depth > 0) {
 		b += seprintf(b, last, "Within context:");
 		int depth = 0;
-		for (auto it = _scope_stack.rbegin(); it != _scope_stack.rend(); ++it, depth++) {
+		uint count = std::min<uint>(_scope_stack_depth, SCOPE_STACK_MAX_DEPTH);
+		for (uint i = count; i > 0; i--, depth++) {
+			const scope_stack_record &record = _scope_stack[i - 1];
 			b += seprintf(b, last, "\n    %2d: ", depth);
-			b += (*it)(b, last);
+			b += record.dumper(record, b, last);
 		}
 		b += seprintf(b, last, "\n\n");
 	}
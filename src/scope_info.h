@@ -12,28 +12,52 @@
 
 #include "tile_type.h"
 
-#include <functional>
-#include <vector>
-
 struct Vehicle;
 struct BaseStation;
 struct Window;
 
 #ifdef USE_SCOPE_INFO
 
-extern std::vector<std::function<int(char *, const char *)>> _scope_stack;
+/** Record on the scope info stack: a dump trampoline plus a pointer to the lambda in the owning stack frame. */
+struct scope_stack_record {
+	int (*dumper)(const scope_stack_record &record, char *buf, const char *last); ///< Trampoline which invokes the lambda.
+	const void *lambda; ///< The lambda holding the captured scope arguments, lives in the owning stack frame.
+};
+
+static const uint SCOPE_STACK_MAX_DEPTH = 32;
 
+extern thread_local scope_stack_record _scope_stack[SCOPE_STACK_MAX_DEPTH];
+extern thread_local uint _scope_stack_depth;
+
+/**
+ * Pushes a record pointing at \a lambda onto the scope info stack for the lifetime of the scope.
+ * Entering writes two words and bumps the depth, leaving decrements it again; the lambda is only
+ * ever invoked when the crash logger dumps the scope stack. Frames beyond SCOPE_STACK_MAX_DEPTH
+ * are counted but not recorded.
+ */
+template <typename T>
 struct scope_info_func_obj {
-	scope_info_func_obj(std::function<int(char *, const char *)> func)
+	scope_info_func_obj(const T &lambda)
 	{
-		_scope_stack.emplace_back(std::move(func));
+		if (_scope_stack_depth < SCOPE_STACK_MAX_DEPTH) {
+			scope_stack_record &record = _scope_stack[_scope_stack_depth];
+			record.dumper = &DumpViaLambda;
+			record.lambda = &lambda;
+		}
+		_scope_stack_depth++;
 	}
 
 	scope_info_func_obj(const scope_info_func_obj &copysrc) = delete;
 
 	~scope_info_func_obj()
 	{
-		_scope_stack.pop_back();
+		_scope_stack_depth--;
+	}
+
+private:
+	static int DumpViaLambda(const scope_stack_record &record, char *buf, const char *last)
+	{
+		return (*static_cast<const T *>(record.lambda))(buf, last);
 	}
 };
 
@@ -43,16 +67,14 @@ int WriteScopeLog(char *buf, const char *last);
 
 /**
  * This creates a lambda in the current scope with the specified capture which outputs the given args as a format string.
- * This lambda is then captured by reference in a std::function which is pushed onto the scope stack
+ * A record pointing at this lambda is then pushed onto the scope stack.
  * The scope stack is popped at the end of the scope
  */
 #define SCOPE_INFO_FMT(capture, ...) \
 	auto SCOPE_INFO_PASTE(_sc_lm_, __LINE__) = capture (char *buf, const char *last) { \
 		return seprintf(buf, last, __VA_ARGS__); \
 	}; \
-	scope_info_func_obj SCOPE_INFO_PASTE(_sc_obj_, __LINE__) ([&](char *buf, const char *last) -> int { \
-		return SCOPE_INFO_PASTE(_sc_lm_, __LINE__) (buf, last); \
-	});
+	scope_info_func_obj<decltype(SCOPE_INFO_PASTE(_sc_lm_, __LINE__))> SCOPE_INFO_PASTE(_sc_obj_, __LINE__) (SCOPE_INFO_PASTE(_sc_lm_, __LINE__));
 
 #else /* USE_SCOPE_INFO */
 
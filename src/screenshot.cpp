@@ -190,8 +190,10 @@ static bool MakeBMPImage(const char *name, ScreenshotCallback *callb, void *user
 		}
 	}
 
-	/* Try to use 64k of memory, store between 16 and 128 lines */
-	uint maxlines = Clamp(65536 / (w * pixelformat / 8), 16, 128); // number of lines per iteration
+	/* Try to use 4M of memory, store between 16 and 128 lines. Wide (world)
+	 * screenshots render each stripe in parallel 1600 pixel blocks, so taller
+	 * stripes mean fewer render/join rounds. */
+	uint maxlines = Clamp(4194304 / (w * pixelformat / 8), 16, 128); // number of lines per iteration
 
 	uint8 *buff = MallocT<uint8>(maxlines * w * pixelformat / 8); // buffer which is rendered to
 	uint8 *line = AllocaM(uint8, bytewidth); // one line, stored to file
@@ -389,8 +391,8 @@ static bool MakePNGImage(const char *name, ScreenshotCallback *callb, void *user
 #endif /* TTD_ENDIAN == TTD_LITTLE_ENDIAN */
 	}
 
-	/* use by default 64k temp memory */
-	maxlines = Clamp(65536 / w, 16, 128);
+	/* use by default 4M temp memory; see MakeBMPImage for the stripe sizing rationale */
+	maxlines = Clamp(4194304 / (w * bpp), 16, 128);
 
 	/* now generate the bitmap bits */
 	void *buff = CallocT<uint8>(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
@@ -496,8 +498,8 @@ static bool MakePCXImage(const char *name, ScreenshotCallback *callb, void *user
 		return false;
 	}
 
-	/* use by default 64k temp memory */
-	maxlines = Clamp(65536 / w, 16, 128);
+	/* use by default 4M temp memory; see MakeBMPImage for the stripe sizing rationale */
+	maxlines = Clamp(4194304 / w, 16, 128);
 
 	/* now generate the bitmap bits */
 	uint8 *buff = CallocT<uint8>(static_cast<size_t>(w) * maxlines); // by default generate 128 lines at a time.
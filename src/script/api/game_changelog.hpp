@@ -20,6 +20,7 @@
  * API additions:
  * \li GSCompanyMode::IsValid
  * \li GSCompanyMode::IsDeity
+ * \li GSController::EnableProfiling
  * \li GSTown::ROAD_LAYOUT_RANDOM
  * \li GSVehicle::IsPrimaryVehicle
  *
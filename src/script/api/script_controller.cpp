@@ -100,6 +100,11 @@ ScriptController::~ScriptController()
 	Squirrel::DecreaseOps(ScriptObject::GetActiveInstance()->engine->GetVM(), amount);
 }
 
+/* static */ void ScriptController::EnableProfiling(bool enable)
+{
+	ScriptObject::GetActiveInstance()->SetProfilingEnabled(enable);
+}
+
 /* static */ int ScriptController::GetSetting(const char *name)
 {
 	return ScriptObject::GetActiveInstance()->GetSetting(name);
@@ -131,6 +131,19 @@ public:
 	 */
 	static void DecreaseOps(int amount);
 
+	/**
+	 * Enable or disable the execution profiler of this script. While the
+	 *  profiler is enabled, the number of calls of, and the time spent in,
+	 *  every script function is recorded. The collected data can be printed
+	 *  from the console with the 'script_profile' command, which can also
+	 *  enable the profiler without cooperation of the script.
+	 * @param enable True to start collecting data, false to stop and discard
+	 *  the collected data.
+	 * @note Profiling adds overhead to every function call of the script, so
+	 *  leave it disabled when not investigating performance.
+	 */
+	static void EnableProfiling(bool enable);
+
 	/**
 	 * Get the value of one of your settings you set via info.nut.
 	 * @param name The name of the setting.
@@ -12,6 +12,9 @@
 #include "script_controller.hpp"
 #include "../../debug.h"
 #include "../../script/squirrel.hpp"
+#include <../squirrel/sqpcheader.h>
+#include <../squirrel/sqvm.h>
+#include <../squirrel/sqclosure.h>
 
 #include "../../safeguards.h"
 
@@ -842,6 +845,129 @@ SQInteger ScriptList::_nexti(HSQUIRRELVM vm)
 	return 1;
 }
 
+bool ScriptList::ValuateNative(HSQUIRRELVM vm, int nparam, SQInteger &result)
+{
+	HSQOBJECT obj;
+	sq_getstackobj(vm, 2, &obj);
+	SQNativeClosure *nclosure = _nativeclosure(obj);
+	SQInteger nargs = nparam + 1; // the root table and the item replace the valuator itself
+
+	/* Leave raising the parameter count error to the generic path. */
+	SQInteger nparamscheck = nclosure->_nparamscheck;
+	if ((nparamscheck > 0 && nparamscheck != nargs) || (nparamscheck < 0 && nargs < -nparamscheck)) return false;
+
+	/* Make sure PUSH_CALLINFO below cannot hit its stack overflow path,
+	 * as by then the arguments have already been pushed. */
+	if (vm->_callsstacksize == vm->_alloccallsstacksize && vm->_callsstacksize > 65535) return false;
+
+	/* Build the call frame once: root table, item placeholder, extra parameters. */
+	sq_pushroottable(vm);
+	sq_pushinteger(vm, 0);
+	for (int i = 0; i < nparam - 1; i++) {
+		sq_push(vm, i + 3);
+	}
+
+	SQInteger stackbase = vm->_top - nargs;
+
+	/* Match the parameter type check of the call dispatch we are bypassing.
+	 * The types do not change between items, as the item slot always holds
+	 * an integer; leave raising the error to the generic path. */
+	SQInteger tcs = nclosure->_typecheck.size();
+	for (SQInteger i = 0; i < nargs && i < tcs; i++) {
+		if (nclosure->_typecheck._vals[i] != -1 && !(type(vm->_stack._vals[stackbase + i]) & nclosure->_typecheck._vals[i])) {
+			vm->Pop(nargs);
+			return false;
+		}
+	}
+
+	if (vm->_top + MIN_STACK_OVERHEAD > (SQInteger)vm->_stack.size()) {
+		vm->_stack.resize(vm->_stack.size() + (MIN_STACK_OVERHEAD << 1));
+	}
+
+	SQInteger oldtop = vm->_top;
+	SQInteger oldstackbase = vm->_stackbase;
+	vm->_nnativecalls++;
+
+	SQVM::CallInfo lci = {};
+	lci._closure = nclosure;
+	lci._generator = nullptr;
+	lci._etraps = 0;
+	lci._prevstkbase = (SQInt32)(stackbase - vm->_stackbase);
+	lci._ncalls = 1;
+	lci._prevtop = (SQInt32)(oldtop - oldstackbase);
+	PUSH_CALLINFO(vm, lci);
+	vm->_stackbase = stackbase;
+
+	/* Push the free variables and bind the environment, as a call would. */
+	for (SQUnsignedInteger i = 0; i < nclosure->_outervalues.size(); i++) {
+		vm->Push(nclosure->_outervalues[i]);
+	}
+	if (type(nclosure->_env) == OT_WEAKREF) {
+		vm->_stack[stackbase] = _weakref(nclosure->_env)->_obj;
+	}
+
+	SQInteger frame_top = vm->_top;
+	result = 0;
+
+	try {
+		for (ScriptListMap::iterator iter = this->items.begin(); iter != this->items.end(); iter++) {
+			/* Check for changing of items. */
+			int previous_modification_count = this->modifications;
+
+			/* Write the item into its argument slot and call the function. */
+			vm->_stack._vals[stackbase + 1] = (*iter).first;
+			vm->_top = frame_top;
+			SQInteger ret = (nclosure->_function)(vm);
+			if (ret < 0) {
+				result = SQ_ERROR;
+				break;
+			}
+
+			/* Retrieve the return value */
+			SQInteger value;
+			const SQObjectPtr &retval = vm->_stack._vals[vm->_top - 1];
+			if (ret > 0 && type(retval) == OT_INTEGER) {
+				value = _integer(retval);
+			} else if (ret > 0 && type(retval) == OT_BOOL) {
+				value = _integer(retval) ? 1 : 0;
+			} else {
+				result = sq_throwerror(vm, "return value of valuator is not valid (not integer/bool)");
+				break;
+			}
+
+			/* Kill the script when the valuator call takes way too long. */
+			if (ScriptController::GetOpsTillSuspend() < -1000000) {
+				result = sq_throwerror(vm, "excessive CPU usage in valuator function");
+				break;
+			}
+
+			/* Was something changed? */
+			if (previous_modification_count != this->modifications) {
+				result = sq_throwerror(vm, "modifying valuated list outside of valuator function");
+				break;
+			}
+
+			this->SetValue((*iter).first, value);
+
+			Squirrel::DecreaseOps(vm, 5);
+		}
+	} catch (...) {
+		/* Unwind the frame before passing on the (script fatal) error. */
+		vm->_nnativecalls--;
+		vm->_stackbase = oldstackbase;
+		while (vm->_top > stackbase) vm->_stack._vals[--vm->_top].Null();
+		POP_CALLINFO(vm);
+		throw;
+	}
+
+	vm->_nnativecalls--;
+	vm->_stackbase = oldstackbase;
+	while (vm->_top > stackbase) vm->_stack._vals[--vm->_top].Null();
+	POP_CALLINFO(vm);
+
+	return true;
+}
+
 SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 {
 	this->modifications++;
@@ -866,6 +992,16 @@ SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 	bool backup_allow = ScriptObject::GetAllowDoCommand();
 	ScriptObject::SetAllowDoCommand(false);
 
+	/* Valuating with a native API function, the common case for the simple
+	 * getters, can be done without a full closure call per item. */
+	if (valuator_type == OT_NATIVECLOSURE) {
+		SQInteger fast_result;
+		if (this->ValuateNative(vm, nparam, fast_result)) {
+			ScriptObject::SetAllowDoCommand(backup_allow);
+			return fast_result;
+		}
+	}
+
 	/* Push the function to call */
 	sq_push(vm, 2);
 
@@ -41,6 +41,17 @@ private:
 	bool initialized;             ///< Whether an iteration has been started
 	int modifications;            ///< Number of modification that has been done. To prevent changing data while valuating.
 
+	/**
+	 * Valuate the items with a native API function by calling its C++
+	 *  implementation directly on a reused call frame, skipping the
+	 *  per-item closure call overhead.
+	 * @param vm     The VM, with the valuator at stack position 2.
+	 * @param nparam The number of parameters given to Valuate(), including the valuator.
+	 * @param result The value Valuate() should return, set when the fast path ran.
+	 * @return True if the fast path ran, false if the generic path must be used.
+	 */
+	bool ValuateNative(HSQUIRRELVM vm, int nparam, SQInteger &result);
+
 public:
 	typedef std::set<SQInteger> ScriptItemList;                   ///< The list of items inside the bucket
 	typedef std::map<SQInteger, ScriptItemList> ScriptListBucket; ///< The bucket list per value
@@ -830,6 +830,22 @@ void ScriptInstance::SetMemoryAllocationLimit(size_t limit) const
 	if (this->engine != nullptr) this->engine->SetMemoryAllocationLimit(limit);
 }
 
+void ScriptInstance::SetProfilingEnabled(bool enable)
+{
+	if (this->engine != nullptr) this->engine->SetProfilingEnabled(enable);
+}
+
+bool ScriptInstance::IsProfilingEnabled() const
+{
+	return this->engine != nullptr && this->engine->IsProfilingEnabled();
+}
+
+std::vector<ScriptProfileLine> ScriptInstance::GetProfileData() const
+{
+	if (this->engine == nullptr) return {};
+	return this->engine->GetProfileData();
+}
+
 void ScriptInstance::ReleaseSQObject(HSQOBJECT *obj)
 {
 	if (!this->in_shutdown) this->engine->ReleaseObject(obj);
@@ -12,6 +12,7 @@
 
 #include <variant>
 #include <list>
+#include <vector>
 #include <squirrel.h>
 #include "script_suspend.hpp"
 
@@ -239,6 +240,22 @@ public:
 
 	void SetMemoryAllocationLimit(size_t limit) const;
 
+	/**
+	 * Enable or disable the execution profiler of this script.
+	 * @param enable True to start collecting data, false to stop and discard it.
+	 */
+	void SetProfilingEnabled(bool enable);
+
+	/**
+	 * Whether the execution profiler of this script is collecting data.
+	 */
+	bool IsProfilingEnabled() const;
+
+	/**
+	 * Get the data collected by the execution profiler, sorted by descending total time.
+	 */
+	std::vector<struct ScriptProfileLine> GetProfileData() const;
+
 	/**
 	 * Indicate whether this instance is currently being destroyed.
 	 */
@@ -20,7 +20,9 @@
 #include "../core/alloc_func.hpp"
 
 #include <stdarg.h>
+#include <chrono>
 #include <map>
+#include <vector>
 
 /**
  * In the memory allocator for Squirrel we want to directly use malloc/realloc, so when the OS
@@ -49,6 +51,20 @@ struct ScriptAllocator {
 
 	static const size_t SAFE_LIMIT = 0x8000000; ///< 128 MiB, a safe choice for almost any situation
 
+	static const size_t BIN_GRANULARITY = 8;         ///< Size difference between adjacent free block bins.
+	static const size_t MAX_BINNED_SIZE = 256;       ///< Largest allocation served from the free block bins.
+	static const size_t MAX_CACHED_SIZE = 0x100000;  ///< 1 MiB, maximum total size of blocks kept in the free block bins.
+
+	/**
+	 * Free blocks kept for reuse, one singly-linked list per size class. Squirrel allocates
+	 * and frees vast numbers of small fixed-size objects, in particular during garbage
+	 * collection runs; serving those from per-VM bins avoids hammering the OS allocator
+	 * and stops the churn from fragmenting the global heap. As the bins are part of this
+	 * allocator they are torn down together with the VM that filled them.
+	 */
+	void *free_bins[MAX_BINNED_SIZE / BIN_GRANULARITY];
+	size_t cached_size; ///< Total size of the blocks currently held in #free_bins.
+
 #ifdef SCRIPT_DEBUG_ALLOCATIONS
 	std::map<void *, size_t> allocations;
 #endif
@@ -99,9 +115,53 @@ struct ScriptAllocator {
 		}
 	}
 
+	/**
+	 * Get a block that can hold the given size, reusing a cached free block when
+	 * one of a suitable size class is available. Blocks for binned sizes are always
+	 * allocated at the size class capacity, so a block recycled via PutBlock() can
+	 * serve any later request that maps to the same bin.
+	 * @param size The requested allocation size.
+	 * @return The allocated block, or null if the OS allocation failed.
+	 */
+	void *GetBlock(SQUnsignedInteger size)
+	{
+		if (size > 0 && size <= MAX_BINNED_SIZE) {
+			size_t bin = (size - 1) / BIN_GRANULARITY;
+			void *p = this->free_bins[bin];
+			if (p != nullptr) {
+				this->free_bins[bin] = *(void **)p;
+				this->cached_size -= (bin + 1) * BIN_GRANULARITY;
+				return p;
+			}
+			return malloc((bin + 1) * BIN_GRANULARITY);
+		}
+		return malloc(size);
+	}
+
+	/**
+	 * Release a block, caching it in the free block bin of its size class when
+	 * it is small enough and the cache is not full yet.
+	 * @param p    The block to release.
+	 * @param size The size the block was requested with.
+	 */
+	void PutBlock(void *p, SQUnsignedInteger size)
+	{
+		if (size > 0 && size <= MAX_BINNED_SIZE) {
+			size_t bin = (size - 1) / BIN_GRANULARITY;
+			size_t capacity = (bin + 1) * BIN_GRANULARITY;
+			if (this->cached_size + capacity <= MAX_CACHED_SIZE) {
+				*(void **)p = this->free_bins[bin];
+				this->free_bins[bin] = p;
+				this->cached_size += capacity;
+				return;
+			}
+		}
+		free(p);
+	}
+
 	void *Malloc(SQUnsignedInteger size)
 	{
-		void *p = malloc(size);
+		void *p = this->GetBlock(size);
 
 		this->CheckAllocation(size, p);
 
@@ -134,13 +194,13 @@ struct ScriptAllocator {
 		 * If memory exception is thrown, the old pointer is expected
 		 * to be valid for engine cleanup.
 		 */
-		void *new_p = malloc(size);
+		void *new_p = this->GetBlock(size);
 
 		this->CheckAllocation(size - oldsize, new_p);
 
 		/* Memory limit test passed, we can copy data and free old pointer. */
 		memcpy(new_p, p, std::min(oldsize, size));
-		free(p);
+		this->PutBlock(p, oldsize);
 
 		this->allocated_size -= oldsize;
 		this->allocated_size += size;
@@ -157,7 +217,7 @@ struct ScriptAllocator {
 	void Free(void *p, SQUnsignedInteger size)
 	{
 		if (p == nullptr) return;
-		free(p);
+		this->PutBlock(p, size);
 		this->allocated_size -= size;
 
 #ifdef SCRIPT_DEBUG_ALLOCATIONS
@@ -172,10 +232,20 @@ struct ScriptAllocator {
 		this->allocation_limit = static_cast<size_t>(_settings_game.script.script_max_memory_megabytes) << 20;
 		if (this->allocation_limit == 0) this->allocation_limit = SAFE_LIMIT; // in case the setting is somehow zero
 		this->error_thrown = false;
+		memset(this->free_bins, 0, sizeof(this->free_bins));
+		this->cached_size = 0;
 	}
 
 	~ScriptAllocator()
 	{
+		for (void *&bin : this->free_bins) {
+			void *p = bin;
+			while (p != nullptr) {
+				void *next = *(void **)p;
+				free(p);
+				p = next;
+			}
+		}
 #ifdef SCRIPT_DEBUG_ALLOCATIONS
 		assert(this->allocations.size() == 0);
 #endif
@@ -212,6 +282,100 @@ void Squirrel::SetMemoryAllocationLimit(size_t limit) noexcept
 	}
 }
 
+/** State of the execution profiler of a script VM, see Squirrel::SetProfilingEnabled. */
+struct ScriptProfilerData {
+	/** Accumulated data of a single script function. */
+	struct Function {
+		uint64 calls = 0;    ///< Number of completed calls.
+		uint64 total_ns = 0; ///< Time spent in the function and its callees, in nanoseconds of VM execution time.
+	};
+
+	/** A function call currently in progress. */
+	struct StackEntry {
+		Function *func;  ///< Function being timed.
+		uint64 enter_ns; ///< Value of the profiler clock when the function was entered.
+	};
+
+	std::map<std::string, Function> functions; ///< Collected data, keyed by function name and source file.
+	std::vector<StackEntry> stack;             ///< Script functions currently being executed.
+
+	std::chrono::steady_clock::time_point resume_time; ///< Time the VM last started executing, only valid while it is executing.
+	uint64 executed_ns = 0; ///< VM execution time accumulated over earlier executions.
+	int executing = 0;      ///< Depth of the VM execution the profiler is timing.
+
+	/**
+	 * Get the current value of the profiler clock. The clock only advances while
+	 * the VM is executing, so that the time a script spends suspended between
+	 * ticks is not attributed to the function it suspended in.
+	 */
+	uint64 Now() const
+	{
+		uint64 ns = this->executed_ns;
+		if (this->executing > 0) ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->resume_time).count();
+		return ns;
+	}
+
+	/** The VM is about to start executing; start the profiler clock. */
+	void EnterVM()
+	{
+		if (this->executing++ == 0) this->resume_time = std::chrono::steady_clock::now();
+	}
+
+	/** The VM has stopped executing; stop the profiler clock. */
+	void LeaveVM()
+	{
+		if (--this->executing == 0) {
+			this->executed_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->resume_time).count();
+		}
+	}
+};
+
+/* static */ void Squirrel::ProfileHook(HSQUIRRELVM vm, SQInteger event_type, const SQChar *source, const SQChar *funcname)
+{
+	Squirrel *engine = (Squirrel *)sq_getforeignptr(vm);
+	if (engine == nullptr || engine->profiler == nullptr) return;
+	ScriptProfilerData *data = engine->profiler.get();
+
+	if (event_type == 'c') {
+		char name[512];
+		seprintf(name, lastof(name), "%s (%s)", funcname != nullptr ? funcname : "<anonymous>", source != nullptr ? source : "<unknown>");
+		ScriptProfilerData::Function *func = &data->functions[name];
+		data->stack.push_back({ func, data->Now() });
+	} else {
+		/* Calls that were already in progress when the profiler was enabled
+		 * have no stack entry; ignore their returns. */
+		if (data->stack.empty()) return;
+		ScriptProfilerData::StackEntry entry = data->stack.back();
+		data->stack.pop_back();
+		entry.func->calls++;
+		entry.func->total_ns += data->Now() - entry.enter_ns;
+	}
+}
+
+void Squirrel::SetProfilingEnabled(bool enable)
+{
+	if (enable == (this->profiler != nullptr)) return;
+	if (enable) {
+		this->profiler.reset(new ScriptProfilerData());
+		sq_setprofilehook(this->vm, &Squirrel::ProfileHook);
+	} else {
+		sq_setprofilehook(this->vm, nullptr);
+		this->profiler.reset();
+	}
+}
+
+std::vector<ScriptProfileLine> Squirrel::GetProfileData() const
+{
+	std::vector<ScriptProfileLine> lines;
+	if (this->profiler == nullptr) return lines;
+
+	for (const auto &it : this->profiler->functions) {
+		lines.push_back({ it.first, it.second.calls, it.second.total_ns / 1000 });
+	}
+	std::sort(lines.begin(), lines.end(), [](const ScriptProfileLine &a, const ScriptProfileLine &b) { return a.time_us > b.time_us; });
+	return lines;
+}
+
 
 void Squirrel::CompileError(HSQUIRRELVM vm, const SQChar *desc, const SQChar *source, SQInteger line, SQInteger column)
 {
@@ -406,7 +570,9 @@ bool Squirrel::Resume(int suspend)
 		suspend = -this->overdrawn_ops;
 	}
 
+	if (this->profiler != nullptr) this->profiler->EnterVM();
 	this->crashed = !sq_resumecatch(this->vm, suspend);
+	if (this->profiler != nullptr) this->profiler->LeaveVM();
 	this->overdrawn_ops = -this->vm->_ops_till_suspend;
 	this->allocator->CheckLimit();
 	return this->vm->_suspended != 0;
@@ -448,7 +614,10 @@ bool Squirrel::CallMethod(HSQOBJECT instance, const char *method_name, HSQOBJECT
 	}
 	/* Call the method */
 	sq_pushobject(this->vm, instance);
-	if (SQ_FAILED(sq_call(this->vm, 1, ret == nullptr ? SQFalse : SQTrue, SQTrue, suspend))) return false;
+	if (this->profiler != nullptr) this->profiler->EnterVM();
+	bool failed = SQ_FAILED(sq_call(this->vm, 1, ret == nullptr ? SQFalse : SQTrue, SQTrue, suspend));
+	if (this->profiler != nullptr) this->profiler->LeaveVM();
+	if (failed) return false;
 	if (ret != nullptr) sq_getstackobj(vm, -1, ret);
 	/* Reset the top, but don't do so for the script main function, as we need
 	 *  a correct stack when resuming. */
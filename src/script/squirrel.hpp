@@ -12,6 +12,9 @@
 
 #include <squirrel.h>
 
+#include <string>
+#include <vector>
+
 /** The type of script we're working with, i.e. for who is it? */
 enum ScriptType {
 	ST_AI, ///< The script is for AI scripts.
@@ -19,6 +22,14 @@ enum ScriptType {
 };
 
 struct ScriptAllocator;
+struct ScriptProfilerData;
+
+/** Aggregated data of the execution profiler for a single script function. */
+struct ScriptProfileLine {
+	std::string function; ///< Name of the function, with the source file it was compiled from.
+	uint64 calls;         ///< Number of completed calls.
+	uint64 time_us;       ///< Time spent in the function and its callees, in microseconds of VM execution time.
+};
 
 class Squirrel {
 	friend class ScriptAllocatorScope;
@@ -33,6 +44,12 @@ private:
 	int overdrawn_ops;       ///< The amount of operations we have overdrawn.
 	const char *APIName;     ///< Name of the API used for this squirrel.
 	std::unique_ptr<ScriptAllocator> allocator; ///< Allocator object used by this script.
+	std::unique_ptr<ScriptProfilerData> profiler; ///< Execution profiler data, only present while the profiler is enabled.
+
+	/**
+	 * The hook the VM calls on every script function call and return while the profiler is enabled.
+	 */
+	static void ProfileHook(HSQUIRRELVM vm, SQInteger event_type, const SQChar *source, const SQChar *funcname);
 
 	/**
 	 * The internal RunError handler. It looks up the real error and calls RunError with it.
@@ -282,6 +299,24 @@ public:
 	size_t GetAllocatedMemory() const noexcept;
 
 	void SetMemoryAllocationLimit(size_t limit) noexcept;
+
+	/**
+	 * Enable or disable the execution profiler. While enabled, the number of
+	 *  calls of, and the VM execution time spent in, every script function is
+	 *  collected. Disabling the profiler discards the collected data.
+	 * @param enable True to start collecting data, false to stop and discard it.
+	 */
+	void SetProfilingEnabled(bool enable);
+
+	/**
+	 * Whether the execution profiler is currently collecting data.
+	 */
+	bool IsProfilingEnabled() const { return this->profiler != nullptr; }
+
+	/**
+	 * Get the data collected by the execution profiler so far, sorted by descending total time.
+	 */
+	std::vector<ScriptProfileLine> GetProfileData() const;
 };
 
 
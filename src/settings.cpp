@@ -73,6 +73,7 @@
 #include "vehicle_func.h"
 #include "scope_info.h"
 #include "viewport_func.h"
+#include "core/hashtable_map_type.hpp"
 #include "gui.h"
 #include "statusbar_gui.h"
 #include "graph_gui.h"
@@ -2544,27 +2545,67 @@ static const SettingDesc *GetCompanySettingFromName(const char *name)
 }
 
 /**
- * Given a name of any setting, return any setting description of it.
- * @param name  Name of the setting to return a setting description of.
- * @return Pointer to the setting description of setting \a name if it can be found,
- *         \c nullptr indicates failure to obtain the description.
+ * Index over all setting tables for O(1) by-name resolution, built on first
+ * use. Only settings valid for the current savegame version are entered, and
+ * entries are inserted in the same order as the linear searches they replace
+ * (per table: all full names, then all shortcut names; first insertion wins),
+ * so the precedence of ambiguous names is unchanged. Validity only depends on
+ * compile-time version constants, hence the index never needs rebuilding.
+ * The returned SettingDesc pointers are stable for the lifetime of the
+ * process and may be cached by callers doing repeated lookups.
  */
-const SettingDesc *GetSettingFromName(const char *name)
+static HashMap<std::string, const SettingDesc *> _setting_name_index;
+
+/** Add the currently valid settings of one table to the setting name index. */
+static void AddSettingNameIndexEntries(const SettingTable &settings, const char *prefix)
+{
+	auto insert = [](std::string key, const SettingDesc *sd) {
+		/* emplace does not overwrite: the first insertion of a name wins */
+		_setting_name_index.emplace(std::move(key), sd);
+	};
+
+	for (auto &sd : settings) {
+		if (!SlIsObjectCurrentlyValid(sd->save.version_from, sd->save.version_to, sd->save.ext_feature_test)) continue;
+		insert(sd->name, sd.get());
+		if (prefix != nullptr) insert(std::string(prefix) + sd->name, sd.get());
+	}
+	for (auto &sd : settings) {
+		if (!SlIsObjectCurrentlyValid(sd->save.version_from, sd->save.version_to, sd->save.ext_feature_test)) continue;
+		const char *short_name = strchr(sd->name, '.');
+		if (short_name == nullptr) continue;
+		short_name++;
+		insert(short_name, sd.get());
+		if (prefix != nullptr) insert(std::string(prefix) + short_name, sd.get());
+	}
+}
+
+/** Build the setting name index, see _setting_name_index. */
+static void BuildSettingNameIndex()
 {
 	for (auto &table : _generic_setting_tables) {
-		auto sd = GetSettingFromName(name, table);
-		if (sd != nullptr) return sd;
+		AddSettingNameIndexEntries(table, nullptr);
 	}
 	for (auto &table : _private_setting_tables) {
-		auto sd = GetSettingFromName(name, table);
-		if (sd != nullptr) return sd;
+		AddSettingNameIndexEntries(table, nullptr);
 	}
 	for (auto &table : _secrets_setting_tables) {
-		auto sd = GetSettingFromName(name, table);
-		if (sd != nullptr) return sd;
+		AddSettingNameIndexEntries(table, nullptr);
 	}
+	AddSettingNameIndexEntries(_company_settings, "company.");
+}
+
+/**
+ * Given a name of any setting, return any setting description of it.
+ * @param name  Name of the setting to return a setting description of.
+ * @return Pointer to the setting description of setting \a name if it can be found,
+ *         \c nullptr indicates failure to obtain the description.
+ */
+const SettingDesc *GetSettingFromName(const char *name)
+{
+	if (_setting_name_index.empty()) BuildSettingNameIndex();
 
-	return GetCompanySettingFromName(name);
+	auto iter = _setting_name_index.find(name);
+	return iter != _setting_name_index.end() ? iter->second : nullptr;
 }
 
 /**
@@ -231,6 +231,7 @@ struct GUISettings : public TimeSettings {
 	bool   auto_remove_signals;              ///< automatically remove signals when in the way during rail construction
 	uint16 refresh_rate;                     ///< How often we refresh the screen (time between draw-ticks).
 	uint16 fast_forward_speed_limit;         ///< Game speed to use when fast-forward is enabled.
+	uint16 fast_forward_refresh_rate;        ///< Screen refresh rate cap while fast-forward is enabled, to leave more time for game loops (0 = no cap).
 	uint8  show_vehicle_route_mode;          ///< How to show a vehicle's route when one of its windows is focused
 	bool   show_vehicle_route;               ///< Show route lines when vehicles route overlay is being shown
 	bool   show_vehicle_route_steps;         ///< Show route step markers when vehicles route overlay is being shown
@@ -712,6 +713,7 @@ struct LinkGraphSettings {
 	uint16 recalc_time;                         ///< time (in days) for recalculating each link graph component.
 	uint16 recalc_interval;                     ///< time (in days) between subsequent checks for link graphs to be calculated.
 	bool recalc_not_scaled_by_daylength;        ///< whether the time should be in daylength-scaled days (false) or unscaled days (true)
+	bool recalc_only_changed;                   ///< skip recalculating components whose links and stations are unchanged since their last calculation
 	DistributionType distribution_pax;          ///< distribution type for passengers
 	DistributionType distribution_mail;         ///< distribution type for mail
 	DistributionType distribution_armoured;     ///< distribution type for armoured cargo class
@@ -586,7 +586,7 @@ static Track ChooseShipTrack(Ship *v, TileIndex tile, DiagDirection enterdir, Tr
 		}
 	}
 	DEBUG_UPDATESTATECHECKSUM("ChooseShipTrack: v: %u, path_found: %d, track: %d", v->index, path_found, track);
-	UpdateStateChecksum((((uint64) v->index) << 32) | (path_found << 16) | track);
+	UpdateStateChecksum((((uint64) v->index) << 32) | (path_found << 16) | track, SCA_VEHICLES);
 
 	v->HandlePathfindingResult(path_found);
 	return track;
@@ -1084,7 +1084,7 @@ direction_changed:
 bool Ship::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("Ship::Tick: v: %u, x: %d, y: %d", this->index, this->x_pos, this->y_pos);
-	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos);
+	UpdateStateChecksum((((uint64) this->x_pos) << 32) | this->y_pos, SCA_VEHICLES);
 	if (!((this->vehstatus & VS_STOPPED) || this->IsWaitingInDepot())) this->running_ticks++;
 
 	ShipController(this);
@@ -23,6 +23,7 @@
 #include "tunnelbridge.h"
 #include "bridge_signal_map.h"
 #include "newgrf_newsignals.h"
+#include "newgrf_railtype.h"
 #include "core/checksum_func.hpp"
 #include "core/hash_func.hpp"
 #include "pathfinder/follow_track.hpp"
@@ -47,8 +48,8 @@ static void MarkDependencidesForUpdate(SignalReference sig);
 /** these are the maximums used for updating signal blocks */
 static const uint SIG_TBU_SIZE    =  64; ///< number of signals entering to block
 static const uint SIG_TBD_SIZE    = 256; ///< number of intersections - open nodes in current block
-static const uint SIG_GLOB_SIZE   = 128; ///< number of open blocks (block can be opened more times until detected)
-static const uint SIG_GLOB_UPDATE =  64; ///< how many items need to be in _globset to force update
+static const uint SIG_GLOB_SIZE   = 512; ///< number of open blocks (block can be opened more times until detected)
+static const uint SIG_GLOB_UPDATE = 448; ///< how many items need to be in _globset to force update
 
 static_assert(SIG_GLOB_UPDATE <= SIG_GLOB_SIZE);
 
@@ -72,6 +73,8 @@ static const TrackdirBits _enterdir_to_trackdirbits[DIAGDIR_END] = {
  * Set containing 'items' items of 'tile and Tdir'
  * No tree structure is used because it would cause
  * slowdowns in most usual cases
+ * A small bloom-style filter makes negative membership
+ * tests cheap when the set is large
  */
 template <typename Tdir, uint items>
 struct SmallSet {
@@ -79,6 +82,7 @@ private:
 	uint n;           // actual number of units
 	bool overflowed;  // did we try to overflow the set?
 	const char *name; // name, used for debugging purposes...
+	uint64 hint;      // bloom-style filter over the tiles in the set, a clear bit means the tile is certainly absent
 
 	/** Element of set */
 	struct SSdata {
@@ -86,15 +90,26 @@ private:
 		Tdir dir;
 	} data[items];
 
+	/**
+	 * Filter bit for given tile
+	 * Mix in some upper bits so that tiles adjacent along the Y axis
+	 * (which differ by the map width) do not all map to the same bit
+	 */
+	static uint64 HintBit(TileIndex tile)
+	{
+		return (uint64)1 << ((tile ^ (tile >> 6)) & 0x3F);
+	}
+
 public:
 	/** Constructor - just set default values and 'name' */
-	SmallSet(const char *name) : n(0), overflowed(false), name(name) { }
+	SmallSet(const char *name) : n(0), overflowed(false), name(name), hint(0) { }
 
 	/** Reset variables to default values */
 	void Reset()
 	{
 		this->n = 0;
 		this->overflowed = false;
+		this->hint = 0;
 	}
 
 	/**
@@ -142,6 +157,8 @@ public:
 	 */
 	bool Remove(TileIndex tile, Tdir dir)
 	{
+		if ((this->hint & HintBit(tile)) == 0) return false; // tile is certainly not in the set
+
 		for (uint i = 0; i < this->n; i++) {
 			if (this->data[i].tile == tile && this->data[i].dir == dir) {
 				this->data[i] = this->data[--this->n];
@@ -160,6 +177,8 @@ public:
 	 */
 	bool IsIn(TileIndex tile, Tdir dir)
 	{
+		if ((this->hint & HintBit(tile)) == 0) return false; // tile is certainly not in the set
+
 		for (uint i = 0; i < this->n; i++) {
 			if (this->data[i].tile == tile && this->data[i].dir == dir) return true;
 		}
@@ -185,10 +204,27 @@ public:
 		this->data[this->n].tile = tile;
 		this->data[this->n].dir = dir;
 		this->n++;
+		/* The hint is only ever cleared by Reset(), as bits may be shared between tiles,
+		 * so stale bits merely cost a scan, they can never cause a wrong result */
+		this->hint |= HintBit(tile);
 
 		return true;
 	}
 
+	/**
+	 * Adds tile & dir into the set, unless an identical item is already present
+	 * Sets the 'overflowed' flag if the item was missing and the set was full
+	 * @param tile tile
+	 * @param dir and dir to add
+	 * @return true iff the item is in the set afterwards
+	 */
+	bool AddDedupe(TileIndex tile, Tdir dir)
+	{
+		if (this->IsIn(tile, dir)) return true;
+
+		return this->Add(tile, dir);
+	}
+
 	/**
 	 * Reads the last added element into the set
 	 * @param tile pointer where tile is written to
@@ -862,14 +898,14 @@ static void UpdateSignalsAroundSegment(SigInfo info)
 			if (IsExitSignal(sig)) {
 				/* for pre-signal exits, add block to the global set */
 				DiagDirection exitdir = TrackdirToExitdir(ReverseTrackdir(trackdir));
-				_globset.Add(tile, exitdir); // do not check for full global set, first update all signals
+				_globset.AddDedupe(tile, exitdir); // do not check for full global set, first update all signals
 
 				// Progsig dependencies
 				MarkDependencidesForUpdate(SignalReference(tile, track));
 			} else if (_settings_game.vehicle.train_braking_model == TBM_REALISTIC && GetSignalAlwaysReserveThrough(tile, track)) {
 				/* for reserve through signals, add block to the global set */
 				DiagDirection exitdir = TrackdirToExitdir(ReverseTrackdir(trackdir));
-				_globset.Add(tile, exitdir); // do not check for full global set, first update all signals
+				_globset.AddDedupe(tile, exitdir); // do not check for full global set, first update all signals
 			}
 			SetSignalStateByTrackdir(tile, trackdir, newstate);
 			refresh = true;
@@ -1178,9 +1214,11 @@ void FreeSignalDependencies()
 
 void UpdateSignalDependency(SignalReference sr)
 {
+	/* Deduplicate: several signals changing in one update run may share this
+	 * dependant, and each queued duplicate would re-walk its block in full */
 	Trackdir td = TrackToTrackdir(sr.track);
-	_globset.Add(sr.tile, TrackdirToExitdir(td));
-	_globset.Add(sr.tile, TrackdirToExitdir(ReverseTrackdir(td)));
+	_globset.AddDedupe(sr.tile, TrackdirToExitdir(td));
+	_globset.AddDedupe(sr.tile, TrackdirToExitdir(ReverseTrackdir(td)));
 }
 
 static void MarkDependencidesForUpdate(SignalReference on)
@@ -1777,6 +1815,8 @@ static bool DetermineExtraAspectsVariable()
 	bool changed = false;
 	uint8 new_extra_aspects = 0;
 
+	InvalidateCustomSignalSpriteCache();
+
 	_signal_style_masks = {};
 
 	_enabled_new_signal_styles_mask = 1;
@@ -27,6 +27,7 @@
 #include "zoom_func.h"
 #include "object_map.h"
 #include "newgrf_object.h"
+#include "worker_thread.h"
 
 #include "smallmap_colours.h"
 #include "smallmap_gui.h"
@@ -166,6 +167,43 @@ static bool _smallmap_industry_highlight_state;
 /** For connecting company ID to position in owner list (small map legend) */
 uint _company_to_list_pos[MAX_COMPANIES];
 
+/**
+ * Cached per-tile colour layer for the currently displayed smallmap mode.
+ *
+ * Recomputing the tile colours from map state for the whole visible area makes the
+ * periodic full refresh expensive on large maps, so the colour pattern and the
+ * importance of every tile are cached at map resolution. Tile content changes are
+ * recorded through SmallMapNotifyTileChange(), hooked into the viewport tile dirtying
+ * path, and only those tiles are recomputed before the next draw. Everything that
+ * changes colours wholesale (display mode switches, legend toggles, company colours,
+ * the heightlevel-to-colour index) invalidates the whole layer instead.
+ */
+static std::vector<uint32> _smallmap_colour_cache;     ///< Colour pattern of each tile in the current display mode.
+static std::vector<uint8> _smallmap_importance_cache;  ///< Importance of each tile, to pick the tile shown for zoomed-out blocks.
+static bool _smallmap_colour_cache_valid = false;      ///< Whether the cached colour layer matches the current display state.
+static std::vector<TileIndex> _smallmap_dirty_tiles;   ///< Tiles to recompute before the next draw.
+static bool _smallmap_dirty_tiles_overflowed = false;  ///< Too many tiles were dirtied, recompute the whole layer instead.
+bool _smallmap_colour_cache_tracking = false;          ///< Whether tile changes need to be recorded (any smallmap window is open).
+
+static uint _smallmap_window_count = 0; ///< Number of open smallmap windows.
+
+/** Above this many dirtied tiles a full recompute is cheaper than tracking them individually. */
+static const size_t SMALLMAP_DIRTY_TILE_LIMIT = 0x4000;
+
+/**
+ * Record that the contents of a tile changed, so its cached colour needs recomputing.
+ * Use SmallMapNotifyTileChange() instead of calling this directly.
+ * @param tile The tile that changed.
+ */
+void SmallMapTileColourChanged(TileIndex tile)
+{
+	if (_smallmap_dirty_tiles.size() >= SMALLMAP_DIRTY_TILE_LIMIT) {
+		_smallmap_dirty_tiles_overflowed = true;
+		return;
+	}
+	_smallmap_dirty_tiles.push_back(tile);
+}
+
 static void NotifyAllViewports(ViewportMapType map_type)
 {
 	for (Window *w : Window::IterateFromBack()) {
@@ -715,6 +753,20 @@ void SmallMapWindow::SetZoomLevel(ZoomLevelChange change, const Point *zoom_pt)
  */
 inline uint32 SmallMapWindow::GetTileColours(const TileArea &ta) const
 {
+	if (_smallmap_colour_cache_valid && _smallmap_industry_highlight == INVALID_INDUSTRYTYPE) {
+		/* Pick the most important tile of the block from the cached colour layer. */
+		uint8 importance = 0;
+		uint32 colour = 0;
+		for (TileIndex ti : ta) {
+			uint8 imp = _smallmap_importance_cache[ti];
+			if (imp > importance) {
+				importance = imp;
+				colour = _smallmap_colour_cache[ti];
+			}
+		}
+		return colour;
+	}
+
 	int importance = 0;
 	TileIndex tile = INVALID_TILE; // Position of the most important tile.
 	TileType et = MP_VOID;         // Effective tile type at that position.
@@ -789,6 +841,100 @@ inline uint32 SmallMapWindow::GetTileColours(const TileArea &ta) const
 	}
 }
 
+/**
+ * Recompute the cached colour pattern and importance of a single tile.
+ * This mirrors GetTileColours() for a block of one tile; the industry highlight
+ * is not cached, the cache is bypassed entirely while it blinks.
+ * @param tile The tile to recompute.
+ */
+void SmallMapWindow::UpdateCachedTileColour(TileIndex tile) const
+{
+	TileType ttype = GetTileType(tile);
+
+	switch (ttype) {
+		case MP_TUNNELBRIDGE: {
+			TransportType tt = GetTunnelBridgeTransportType(tile);
+
+			switch (tt) {
+				case TRANSPORT_RAIL: ttype = MP_RAILWAY; break;
+				case TRANSPORT_ROAD: ttype = MP_ROAD;    break;
+				default:             ttype = MP_WATER;   break;
+			}
+			break;
+		}
+
+		case MP_INDUSTRY:
+			/* Special handling of industries while in "Industries" smallmap view. */
+			if (this->map_type == SMT_INDUSTRY) {
+				/* A shown industry has the highest priority above any value in _tiletype_importance. */
+				IndustryType type = Industry::GetByTile(tile)->type;
+				if (_legend_from_industries[_industry_to_list_pos[type]].show_on_map) {
+					_smallmap_colour_cache[tile] = GetIndustrySpec(type)->map_colour * 0x01010101;
+					_smallmap_importance_cache[tile] = 0xFF;
+					return;
+				}
+				/* Otherwise make it disappear */
+				ttype = IsTileOnWater(tile) ? MP_WATER : MP_CLEAR;
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	uint32 colour;
+	switch (this->map_type) {
+		case SMT_CONTOUR:    colour = GetSmallMapContoursPixels(tile, ttype); break;
+		case SMT_VEHICLES:   colour = GetSmallMapVehiclesPixels(tile, ttype); break;
+		case SMT_INDUSTRY:   colour = GetSmallMapIndustriesPixels(tile, ttype); break;
+		case SMT_LINKSTATS:  colour = GetSmallMapLinkStatsPixels(tile, ttype); break;
+		case SMT_ROUTES:     colour = GetSmallMapRoutesPixels(tile, ttype); break;
+		case SMT_VEGETATION: colour = GetSmallMapVegetationPixels(tile, ttype); break;
+		case SMT_OWNER:      colour = GetSmallMapOwnerPixels(tile, ttype); break;
+		default: NOT_REACHED();
+	}
+
+	_smallmap_colour_cache[tile] = colour;
+	_smallmap_importance_cache[tile] = _tiletype_importance[ttype];
+}
+
+/**
+ * Bring the cached colour layer up to date before drawing: recompute the tiles
+ * dirtied since the last draw, or the whole layer when it was invalidated.
+ */
+void SmallMapWindow::UpdateColourCache()
+{
+	/* The industry highlight blink is not representable in the cache; GetTileColours
+	 * falls back to computing colours directly while it is active. */
+	if (_smallmap_industry_highlight != INVALID_INDUSTRYTYPE) return;
+
+	if (!_smallmap_colour_cache_valid || _smallmap_dirty_tiles_overflowed) {
+		_smallmap_colour_cache.resize(MapSize());
+		_smallmap_importance_cache.resize(MapSize());
+		for (TileIndex tile = 0; tile < MapSize(); tile++) {
+			this->UpdateCachedTileColour(tile);
+		}
+		_smallmap_colour_cache_valid = true;
+	} else {
+		for (TileIndex tile : _smallmap_dirty_tiles) {
+			this->UpdateCachedTileColour(tile);
+		}
+	}
+	_smallmap_dirty_tiles.clear();
+	_smallmap_dirty_tiles_overflowed = false;
+}
+
+/**
+ * Invalidate the cached colour layer, e.g. because the display mode or a legend
+ * selection changed. The layer is recomputed before the next draw.
+ */
+/* static */ void SmallMapWindow::InvalidateColourCache()
+{
+	_smallmap_colour_cache_valid = false;
+	_smallmap_dirty_tiles.clear();
+	_smallmap_dirty_tiles_overflowed = false;
+}
+
 /**
  * Draws one column of tiles of the small map in a certain mode onto the screen buffer, skipping the shifted rows in between.
  *
@@ -865,6 +1011,51 @@ void SmallMapWindow::DrawSmallMapColumn(void *dst, uint xc, uint yc, int pitch,
 	} while (xc += this->tile_zoom, yc += this->tile_zoom, dst = blitter->MoveTo(dst, pitch * this->ui_zoom * 2, 0), y += 2 * this->ui_zoom, --reps != 0);
 }
 
+/** Shared state for drawing a batch of smallmap columns, possibly from worker threads. */
+struct SmallMapColumnsJob {
+	const SmallMapWindow *smap; ///< The window being drawn.
+	const DrawPixelInfo *dpi;   ///< The part of the smallmap to be drawn into.
+	Blitter *blitter;           ///< Current blitter.
+	int base_x;                 ///< X position of column 0.
+	int base_y;                 ///< Y position of column 0.
+	int base_tile_x;            ///< Tile X coordinate of column 0.
+	int base_tile_y;            ///< Tile Y coordinate of column 0.
+};
+
+/**
+ * Draw a contiguous range of smallmap columns.
+ * Each column only writes its own pixels, so disjoint ranges may be drawn concurrently.
+ * @param job   Shared column drawing state.
+ * @param start First column to draw.
+ * @param end   One past the last column to draw.
+ */
+void SmallMapWindow::DrawSmallMapColumnRange(const SmallMapColumnsJob &job, uint start, uint end) const
+{
+	const DrawPixelInfo *dpi = job.dpi;
+	for (uint k = start; k < end; k++) {
+		int x = job.base_x + 2 * this->ui_zoom * (int)k;
+		if (x <= -4 * this->ui_zoom) continue; // Column is entirely left of the draw area.
+
+		int y = job.base_y + this->ui_zoom * (int)(k & 1);
+		int tile_x = job.base_tile_x - this->tile_zoom * (int)(k / 2);
+		int tile_y = job.base_tile_y + this->tile_zoom * (int)((k + 1) / 2);
+
+		int end_pos = std::min(dpi->width, x + 4 * this->ui_zoom);
+		int reps = (dpi->height - y + 3 * this->ui_zoom - 1) / 2 / this->ui_zoom; // Number of lines.
+		if (reps > 0) {
+			void *ptr = job.blitter->MoveTo(dpi->dst_ptr, x, y);
+			this->DrawSmallMapColumn(ptr, tile_x, tile_y, dpi->pitch, reps, x, end_pos, y, dpi->height, job.blitter);
+		}
+	}
+}
+
+/** Worker job trampoline for DrawSmallMapColumnRange. */
+/* static */ void SmallMapWindow::DrawSmallMapColumnsJobProc(void *data1, void *data2, void *data3)
+{
+	const SmallMapColumnsJob *job = static_cast<const SmallMapColumnsJob *>(data1);
+	job->smap->DrawSmallMapColumnRange(*job, (uint)(uintptr_t)data2, (uint)(uintptr_t)data3);
+}
+
 /**
  * Adds vehicles to the smallmap.
  * @param dpi the part of the smallmap to be drawn into
@@ -971,34 +1162,25 @@ void SmallMapWindow::DrawSmallMap(DrawPixelInfo *dpi, bool draw_indicators) cons
 	int dx = tile_pos.x - dpi->left;
 	int dy = tile_pos.y - dpi->top;
 
-	int x = dx - 2 * this->ui_zoom;
-	int y = dy;
-	void *ptr = blitter->MoveTo(dpi->dst_ptr, x, y);
-	bool even = true;
+	int base_x = dx - 2 * this->ui_zoom;
+	uint num_cols = (uint)std::max(0, (dpi->width - base_x + 2 * this->ui_zoom - 1) / (2 * this->ui_zoom));
 
-	for (;;) {
-		/* Distance from left edge */
-		if (x > -4 * this->ui_zoom) {
-			if (x >= dpi->width) break; // Exit the loop.
+	SmallMapColumnsJob job = { this, dpi, blitter, base_x, dy, tile_x, tile_y };
 
-			int end_pos = std::min(dpi->width, x + 4 * this->ui_zoom);
-			int reps = (dpi->height - y + 3 * this->ui_zoom - 1) / 2 / this->ui_zoom; // Number of lines.
-			if (reps > 0) {
-				this->DrawSmallMapColumn(ptr, tile_x, tile_y, dpi->pitch, reps, x, end_pos, y, dpi->height, blitter);
-			}
-		}
-		if (even) {
-			tile_y += this->tile_zoom;
-			y += this->ui_zoom;
-			ptr = blitter->MoveTo(ptr, 0, this->ui_zoom);
-		} else {
-			tile_x -= this->tile_zoom;
-			y -= this->ui_zoom;
-			ptr = blitter->MoveTo(ptr, 0, -this->ui_zoom);
+	/* Columns only write their own pixels, so disjoint column ranges can be
+	 * drawn from the worker pool; large surfaces are split into ranges with
+	 * the first range drawn on this thread. */
+	const uint COLUMN_RANGE_SIZE = 32;
+	if (num_cols > COLUMN_RANGE_SIZE && _general_worker_pool.HasWorkers()) {
+		WorkerJobGroup group;
+		for (uint start = COLUMN_RANGE_SIZE; start < num_cols; start += COLUMN_RANGE_SIZE) {
+			_general_worker_pool.EnqueueJob(&SmallMapWindow::DrawSmallMapColumnsJobProc, &job,
+					(void *)(uintptr_t)start, (void *)(uintptr_t)std::min(start + COLUMN_RANGE_SIZE, num_cols), &group);
 		}
-		even = !even;
-		ptr = blitter->MoveTo(ptr, 2 * this->ui_zoom, 0);
-		x += 2 * this->ui_zoom;
+		this->DrawSmallMapColumnRange(job, 0, COLUMN_RANGE_SIZE);
+		group.WaitForCompletion();
+	} else {
+		this->DrawSmallMapColumnRange(job, 0, num_cols);
 	}
 
 	/* Draw vehicles */
@@ -1065,6 +1247,10 @@ void SmallMapWindow::SetupWidgetData()
 SmallMapWindow::SmallMapWindow(WindowDesc *desc, int window_number) : Window(desc), refresh(GUITimer())
 {
 	_smallmap_industry_highlight = INVALID_INDUSTRYTYPE;
+	if (_smallmap_window_count++ == 0) {
+		_smallmap_colour_cache_tracking = true;
+		InvalidateColourCache();
+	}
 	this->overlay = new LinkGraphOverlay(this, WID_SM_MAP, 0, this->GetOverlayCompanyMask(), 1);
 	this->InitNested(window_number);
 	this->LowerWidget(this->map_type + WID_SM_CONTOUR);
@@ -1087,6 +1273,15 @@ SmallMapWindow::~SmallMapWindow()
 {
 	delete this->overlay;
 	this->BreakIndustryChainLink();
+	if (--_smallmap_window_count == 0) {
+		/* Release the colour layer when the last smallmap window closes. */
+		_smallmap_colour_cache_tracking = false;
+		InvalidateColourCache();
+		_smallmap_colour_cache.clear();
+		_smallmap_colour_cache.shrink_to_fit();
+		_smallmap_importance_cache.clear();
+		_smallmap_importance_cache.shrink_to_fit();
+	}
 }
 
 /**
@@ -1189,7 +1384,15 @@ void SmallMapWindow::RebuildColourIndexIfNecessary()
 		}
 	}
 
+	this->UpdateColourCache();
+
+	/* Rebuild the link stat overlay cache on the worker pool while the map itself is drawn. */
+	if (this->map_type == SMT_LINKSTATS) this->overlay->QueueRebuildCacheJob();
+
 	this->DrawWidgets();
+
+	/* The job must not outlive the draw pass; this is a no-op if the map widget was drawn. */
+	if (this->map_type == SMT_LINKSTATS) this->overlay->JoinRebuildCacheJob();
 }
 
 /* virtual */ void SmallMapWindow::DrawWidget(const Rect &r, int widget) const
@@ -1303,6 +1506,7 @@ void SmallMapWindow::SwitchMapType(SmallMapType map_type)
 
 	if (map_type == SMT_LINKSTATS) this->overlay->SetDirty();
 	if (map_type != SMT_INDUSTRY) this->BreakIndustryChainLink();
+	InvalidateColourCache();
 	this->SetDirty();
 	this->refresh.SetInterval(this->GetRefreshPeriod());
 }
@@ -1356,6 +1560,7 @@ void SmallMapWindow::SelectLegendItem(int click_pos, LegendAndColour *legend, in
 		legend[click_pos].show_on_map = !legend[click_pos].show_on_map;
 	}
 
+	InvalidateColourCache();
 	if (this->map_type == SMT_INDUSTRY) this->BreakIndustryChainLink();
 }
 
@@ -1507,6 +1712,7 @@ int SmallMapWindow::GetPositionOnLegend(Point pt)
 				tbl->show_on_map = (widget == WID_SM_ENABLE_ALL);
 			}
 			if (this->map_type == SMT_LINKSTATS) this->SetOverlayCargoMask();
+			InvalidateColourCache();
 			this->SetDirty();
 			break;
 		}
@@ -1515,6 +1721,7 @@ int SmallMapWindow::GetPositionOnLegend(Point pt)
 			_smallmap_show_heightmap = !_smallmap_show_heightmap;
 			this->SetWidgetLoweredState(WID_SM_SHOW_HEIGHT, _smallmap_show_heightmap);
 			NotifyAllViewports(VPMT_INDUSTRY);
+			InvalidateColourCache();
 			this->SetDirty();
 			break;
 
@@ -1553,6 +1760,7 @@ int SmallMapWindow::GetPositionOnLegend(Point pt)
 
 		default: NOT_REACHED();
 	}
+	InvalidateColourCache();
 	this->SetDirty();
 }
 
@@ -1724,6 +1932,7 @@ void SmallMapWindow::ScreenshotCallbackHandler(void *buf, uint y, uint pitch, ui
 	this->scroll_y = -pos;
 
 	/* make the screenshot */
+	this->UpdateColourCache();
 	this->DrawSmallMap(&dpi, false);
 }
 
@@ -40,6 +40,19 @@ static const byte _tiletype_importance[] = {
 /* set up the cargos to be displayed in the smallmap's route legend */
 void BuildLinkStatsLegend();
 
+extern bool _smallmap_colour_cache_tracking;
+void SmallMapTileColourChanged(TileIndex tile);
+
+/**
+ * Notify the smallmap colour cache about a changed tile.
+ * Cheap no-op when no smallmap window is open.
+ * @param tile The tile that changed.
+ */
+static inline void SmallMapNotifyTileChange(TileIndex tile)
+{
+	if (_smallmap_colour_cache_tracking) SmallMapTileColourChanged(tile);
+}
+
 struct TunnelBridgeToMap {
 	TileIndex from_tile;
 	TileIndex to_tile;
@@ -64,6 +77,8 @@ struct LegendAndColour {
 	bool col_break;            ///< Perform a column break and go further at the next column.
 };
 
+struct SmallMapColumnsJob;
+
 /** Class managing the smallmap window. */
 class SmallMapWindow : public Window {
 protected:
@@ -182,6 +197,8 @@ protected:
 
 	void DrawMapIndicators() const;
 	void DrawSmallMapColumn(void *dst, uint xc, uint yc, int pitch, int reps, int start_pos, int end_pos, int y, int end_y, Blitter *blitter) const;
+	void DrawSmallMapColumnRange(const SmallMapColumnsJob &job, uint start, uint end) const;
+	static void DrawSmallMapColumnsJobProc(void *data1, void *data2, void *data3);
 	void DrawVehicles(const DrawPixelInfo *dpi, Blitter *blitter) const;
 	void DrawTowns(const DrawPixelInfo *dpi) const;
 	void DrawSmallMap(DrawPixelInfo *dpi, bool draw_indicators = true) const;
@@ -192,6 +209,8 @@ protected:
 	void SetOverlayCargoMask();
 	void SetupWidgetData();
 	uint32 GetTileColours(const TileArea &ta) const;
+	void UpdateCachedTileColour(TileIndex tile) const;
+	void UpdateColourCache();
 
 	int GetPositionOnLegend(Point pt);
 
@@ -202,6 +221,7 @@ public:
 	virtual ~SmallMapWindow();
 
 	static void RebuildColourIndexIfNecessary();
+	static void InvalidateColourCache();
 
 	void SmallMapCenterOnCurrentPos();
 	Point GetStationMiddle(const Station *st) const;
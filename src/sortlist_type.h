@@ -22,7 +22,8 @@ enum SortListFlags {
 	VL_RESORT     = 1 << 1, ///< instruct the code to resort the list in the next loop
 	VL_REBUILD    = 1 << 2, ///< rebuild the sort list
 	VL_FILTER     = 1 << 3, ///< filter disabled/enabled
-	VL_END        = 1 << 4,
+	VL_PARTIAL_RESORT = 1 << 4, ///< only a few items changed, restore sorted order incrementally
+	VL_END        = 1 << 5,
 };
 DECLARE_ENUM_AS_BIT_SET(SortListFlags)
 
@@ -216,6 +217,16 @@ public:
 		SETBITS(this->flags, VL_RESORT);
 	}
 
+	/**
+	 * Request that the sorted order is restored incrementally on the next Sort call,
+	 * because only a few known items may have moved. The caller keeps track of which
+	 * items are dirtied and passes a predicate for them to Sort().
+	 */
+	void ForcePartialResort()
+	{
+		SETBITS(this->flags, VL_PARTIAL_RESORT);
+	}
+
 	void SetResortInterval(uint16 resort_interval)
 	{
 		this->resort_interval = std::max<uint16>(1, resort_interval);
@@ -273,12 +284,49 @@ public:
 		/* Do not sort when the list is not sortable */
 		if (!this->IsSortable()) return false;
 
+		CLRBITS(this->flags, VL_PARTIAL_RESORT);
+
 		const bool desc = (this->flags & VL_DESC) != 0;
 
 		std::sort(std::vector<T>::begin(), std::vector<T>::end(), [&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); });
 		return true;
 	}
 
+	/**
+	 * Sort the list, restoring the order incrementally when only some items were dirtied.
+	 *
+	 * If a full resort is pending this behaves like Sort(). Otherwise, if a partial resort
+	 * was requested with ForcePartialResort(), the dirtied items are extracted, sorted among
+	 * themselves and merged back into the otherwise still sorted remainder; this is
+	 * O(n + d log d) for d dirtied items instead of a full O(n log n) sort.
+	 *
+	 * @param compare The function to compare two list items
+	 * @param dirty Predicate returning whether an item may have moved since the last sort
+	 * @return true if the list sequence may have been altered
+	 */
+	template <typename Comp, typename DirtyPred>
+	bool Sort(Comp compare, DirtyPred dirty)
+	{
+		if (this->flags & VL_RESORT) return this->Sort(compare);
+
+		if (!(this->flags & VL_PARTIAL_RESORT)) return false;
+
+		CLRBITS(this->flags, VL_PARTIAL_RESORT);
+
+		if (!this->IsSortable()) return false;
+
+		const bool desc = (this->flags & VL_DESC) != 0;
+		auto full_compare = [&](const T &a, const T &b) { return desc ? compare(b, a) : compare(a, b); };
+
+		/* The clean items are still in sorted order relative to each other. */
+		auto middle = std::stable_partition(std::vector<T>::begin(), std::vector<T>::end(), [&](const T &item) { return !dirty(item); });
+		if (middle == std::vector<T>::end()) return false;
+
+		std::sort(middle, std::vector<T>::end(), full_compare);
+		std::inplace_merge(std::vector<T>::begin(), middle, std::vector<T>::end(), full_compare);
+		return true;
+	}
+
 	/**
 	 * Hand the array of sort function pointers to the sort list
 	 *
@@ -20,6 +20,9 @@
 #include "core/mem_func.hpp"
 #include "video/video_driver.hpp"
 #include "scope_info.h"
+#include "fileio_func.h"
+#include "rev.h"
+#include "worker_thread.h"
 
 #include "table/sprites.h"
 #include "table/strings.h"
@@ -29,6 +32,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <map>
 
 #include "safeguards.h"
 
@@ -38,6 +42,15 @@ uint _sprite_cache_size = 4;
 static size_t _spritecache_bytes_used = 0;
 static uint32 _sprite_lru_counter;
 
+/** Runtime statistics of the sprite cache, for tuning the cache budget. */
+static struct SpriteCacheStats {
+	uint64 hits = 0;          ///< Lookups satisfied from the cache.
+	uint64 misses = 0;        ///< Lookups which had to load and decode the sprite.
+	uint64 evictions = 0;     ///< Entries evicted to stay within the cache budget.
+	uint64 evicted_bytes = 0; ///< Bytes freed by evictions.
+	uint32 eviction_runs = 0; ///< Eviction passes performed.
+} _spritecache_stats;
+
 PACK_N(class SpriteDataBuffer {
 	void *ptr = nullptr;
 	uint32 size = 0;
@@ -429,20 +442,40 @@ static bool PadSprites(SpriteLoader::Sprite *sprite, unsigned int sprite_avail,
 	return true;
 }
 
-static bool ResizeSprites(SpriteLoader::Sprite *sprite, unsigned int sprite_avail, SpriteEncoder *encoder)
+/**
+ * Materialise the zoom levels of a sprite which the encoder will read.
+ * Zoom levels outside [zoom_min, zoom_max] which the source material does not
+ * provide are not generated: in particular a sprite only available at e.g.
+ * ZOOM_LVL_OUT_4X is not upscaled to ZOOM_LVL_NORMAL when the encoder never
+ * reads the zoomed-in levels.
+ */
+static bool ResizeSprites(SpriteLoader::Sprite *sprite, unsigned int sprite_avail, SpriteEncoder *encoder, ZoomLevel zoom_min, ZoomLevel zoom_max)
 {
-	/* Create a fully zoomed image if it does not exist */
+	/* Create the finest needed zoom level if only coarser source material is available. */
 	ZoomLevel first_avail = static_cast<ZoomLevel>(FindFirstBit(sprite_avail));
-	if (first_avail != ZOOM_LVL_NORMAL) {
-		if (!ResizeSpriteIn(sprite, first_avail, ZOOM_LVL_NORMAL)) return false;
-		SetBit(sprite_avail, ZOOM_LVL_NORMAL);
+	if (first_avail > zoom_min) {
+		if (!ResizeSpriteIn(sprite, first_avail, zoom_min)) return false;
+		SetBit(sprite_avail, zoom_min);
+		first_avail = zoom_min;
 	}
 
 	/* Pad sprites to make sizes match. */
 	if (!PadSprites(sprite, sprite_avail, encoder)) return false;
 
+	if (first_avail != ZOOM_LVL_NORMAL) {
+		/* ZOOM_LVL_NORMAL itself is not materialised, but its metadata is still
+		 * the dimensional reference for the checks and scaling below. */
+		uint8 scaled_1 = ScaleByZoom(1, first_avail);
+		if (sprite[first_avail].width * scaled_1 > UINT16_MAX || sprite[first_avail].height * scaled_1 > UINT16_MAX) return false;
+		sprite[ZOOM_LVL_NORMAL].width  = sprite[first_avail].width  * scaled_1;
+		sprite[ZOOM_LVL_NORMAL].height = sprite[first_avail].height * scaled_1;
+		sprite[ZOOM_LVL_NORMAL].x_offs = sprite[first_avail].x_offs * scaled_1;
+		sprite[ZOOM_LVL_NORMAL].y_offs = sprite[first_avail].y_offs * scaled_1;
+		sprite[ZOOM_LVL_NORMAL].colours = sprite[first_avail].colours;
+	}
+
 	/* Create other missing zoom levels */
-	for (ZoomLevel zoom = ZOOM_LVL_OUT_2X; zoom != ZOOM_LVL_END; zoom++) {
+	for (ZoomLevel zoom = std::max(ZOOM_LVL_OUT_2X, (ZoomLevel)(first_avail + 1)); zoom <= zoom_max; zoom++) {
 		if (HasBit(sprite_avail, zoom)) {
 			/* Check that size and offsets match the fully zoomed image. */
 			assert(sprite[zoom].width  == UnScaleByZoom(sprite[ZOOM_LVL_NORMAL].width,  zoom));
@@ -491,6 +524,300 @@ static void *ReadRecolourSprite(SpriteFile &file, uint num)
 	return dest;
 }
 
+/*
+ * Persistent disk cache of encoded sprites.
+ *
+ * ReadSprite() work is dominated by decoding the GRF data and re-encoding it
+ * for the current blitter. The blob produced by SpriteEncoder::Encode() is
+ * self-contained, so it can be stored and replayed across sessions. Entries
+ * are keyed on the origin file (name, size and a sample of its contents), the
+ * position within it and the sprite control flags; the file as a whole is
+ * keyed on the blitter, the sprite zoom settings and the revision, as the
+ * blob layout is blitter and build specific.
+ */
+
+#if defined(UNIX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct SpriteDiskCache {
+	struct Entry {
+		size_t offset;     ///< Offset of the blob in the data area.
+		uint32 size;       ///< Size of the blob in bytes.
+		bool used = false; ///< Whether this entry was used this session.
+	};
+
+	btree::btree_map<uint64, Entry> entries;     ///< Entries of the loaded cache file.
+	const byte *data = nullptr;                  ///< Data area of the loaded cache file.
+	size_t data_size = 0;                        ///< Size of the data area.
+	const byte *map = nullptr;                   ///< File mapping backing data, if any.
+	size_t map_size = 0;                         ///< Size of the file mapping.
+	std::vector<byte> heap_data;                 ///< Data storage when not mapped.
+
+	btree::btree_map<uint64, Entry> new_entries; ///< Entries encoded this session.
+	std::vector<byte> new_data;                  ///< Blob storage for new_entries.
+
+	bool loaded = false;                         ///< Whether loading the cache file was attempted.
+	std::string blitter;                         ///< Name of the blitter the loaded data is for.
+
+	void Unload()
+	{
+#if defined(UNIX)
+		if (this->map != nullptr) munmap(const_cast<byte *>(this->map), this->map_size);
+#endif
+		this->entries.clear();
+		this->data = nullptr;
+		this->data_size = 0;
+		this->map = nullptr;
+		this->map_size = 0;
+		this->heap_data.clear();
+		this->new_entries.clear();
+		this->new_data.clear();
+		this->loaded = false;
+		this->blitter.clear();
+	}
+};
+
+static SpriteDiskCache _sprite_disk_cache;
+
+static const uint32 SPRITE_DISK_CACHE_MAGIC = 'S' | ('P' << 8) | ('R' << 16) | ('C' << 24);
+static const uint32 SPRITE_DISK_CACHE_VERSION = 1;
+static const size_t SPRITE_DISK_CACHE_MAX_NEW_BYTES = 256 << 20;  ///< Stop recording new blobs beyond this much memory.
+static const size_t SPRITE_DISK_CACHE_MAX_FILE_BYTES = 512 << 20; ///< Drop unused old entries beyond this file size.
+
+/** FNV-1a, iteratively foldable so keys can be built up from multiple fields. */
+static uint64 SpriteDiskCacheHash(const void *data, size_t size, uint64 h = 0xCBF29CE484222325ULL)
+{
+	const byte *p = (const byte *)data;
+	for (size_t i = 0; i < size; i++) {
+		h = (h ^ p[i]) * 0x100000001B3ULL;
+	}
+	return h;
+}
+
+/**
+ * Get a signature for the content of a sprite file, so that cache entries do
+ * not survive the file being modified. Reading the whole file would defeat the
+ * point of the cache, so the size and the first 4KB (which for GRFs covers the
+ * header and data offsets that shift on nearly every edit) stand in for it.
+ */
+static uint64 GetSpriteFileSignature(const SpriteFile &file)
+{
+	static std::map<std::string, uint64> signatures;
+	auto iter = signatures.lower_bound(file.GetFilename());
+	if (iter != signatures.end() && iter->first == file.GetFilename()) return iter->second;
+
+	uint64 h = SpriteDiskCacheHash(file.GetFilename().data(), file.GetFilename().size());
+	FILE *f = fopen(file.GetFilename().c_str(), "rb");
+	if (f != nullptr) {
+		fseek(f, 0, SEEK_END);
+		long size = ftell(f);
+		h = SpriteDiskCacheHash(&size, sizeof(size), h);
+		fseek(f, 0, SEEK_SET);
+		byte buffer[4096];
+		size_t read = fread(buffer, 1, sizeof(buffer), f);
+		h = SpriteDiskCacheHash(buffer, read, h);
+		fclose(f);
+	}
+	signatures.insert(iter, { file.GetFilename(), h });
+	return h;
+}
+
+/** Hash of everything which invalidates the cache file as a whole. */
+static uint64 GetSpriteDiskCacheConfigHash()
+{
+	const char *blitter = BlitterFactory::GetCurrentBlitter()->GetName();
+	uint64 h = SpriteDiskCacheHash(blitter, strlen(blitter));
+	h = SpriteDiskCacheHash(_openttd_revision, strlen(_openttd_revision), h);
+	uint32 fields[] = { ZOOM_LVL_END, (uint32)_settings_client.gui.sprite_zoom_min, (uint32)_settings_client.gui.zoom_min, (uint32)_settings_client.gui.zoom_max, (uint32)sizeof(size_t) };
+	return SpriteDiskCacheHash(fields, sizeof(fields), h);
+}
+
+static std::string GetSpriteDiskCachePath()
+{
+	return _personal_dir + "sprite-cache-" + BlitterFactory::GetCurrentBlitter()->GetName() + ".dat";
+}
+
+static void LoadSpriteDiskCache()
+{
+	_sprite_disk_cache.loaded = true;
+	_sprite_disk_cache.blitter = BlitterFactory::GetCurrentBlitter()->GetName();
+
+	std::string path = GetSpriteDiskCachePath();
+	FILE *f = fopen(path.c_str(), "rb");
+	if (f == nullptr) return;
+
+	auto fail = [&]() {
+		DEBUG(sprite, 1, "Discarding unusable sprite cache file: %s", path.c_str());
+		_sprite_disk_cache.entries.clear();
+		fclose(f);
+	};
+
+	uint32 header[4];
+	uint32 count;
+	if (fread(header, sizeof(header), 1, f) != 1 ||
+			header[0] != SPRITE_DISK_CACHE_MAGIC || header[1] != SPRITE_DISK_CACHE_VERSION) return fail();
+	uint64 config_hash = header[2] | ((uint64)header[3] << 32);
+	if (config_hash != GetSpriteDiskCacheConfigHash()) return fail();
+	if (fread(&count, sizeof(count), 1, f) != 1 || count > 4 * 1024 * 1024) return fail();
+
+	size_t offset = 0;
+	for (uint32 i = 0; i < count; i++) {
+		uint64 key;
+		uint32 size;
+		if (fread(&key, sizeof(key), 1, f) != 1 || fread(&size, sizeof(size), 1, f) != 1) return fail();
+		_sprite_disk_cache.entries[key] = { offset, size };
+		offset += size;
+	}
+
+	const size_t data_begin = ftell(f);
+
+#if defined(UNIX)
+	struct stat sb;
+	if (fstat(fileno(f), &sb) == 0 && (size_t)sb.st_size >= data_begin + offset) {
+		void *map = mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+		if (map != MAP_FAILED) {
+			_sprite_disk_cache.map = (const byte *)map;
+			_sprite_disk_cache.map_size = sb.st_size;
+			_sprite_disk_cache.data = _sprite_disk_cache.map + data_begin;
+			_sprite_disk_cache.data_size = offset;
+			fclose(f);
+			DEBUG(sprite, 2, "Mapped sprite cache file: %s, %u sprites", path.c_str(), count);
+			return;
+		}
+	}
+#endif
+
+	_sprite_disk_cache.heap_data.resize(offset);
+	if (offset != 0 && fread(_sprite_disk_cache.heap_data.data(), offset, 1, f) != 1) {
+		_sprite_disk_cache.heap_data.clear();
+		return fail();
+	}
+	_sprite_disk_cache.data = _sprite_disk_cache.heap_data.data();
+	_sprite_disk_cache.data_size = offset;
+	fclose(f);
+	DEBUG(sprite, 2, "Read sprite cache file: %s, %u sprites", path.c_str(), count);
+}
+
+/** Make sure the disk cache state matches the current blitter. */
+static void EnsureSpriteDiskCacheLoaded()
+{
+	if (_sprite_disk_cache.loaded) {
+		if (_sprite_disk_cache.blitter == BlitterFactory::GetCurrentBlitter()->GetName()) return;
+		/* Blitter changed: the loaded blobs are for another encoding. */
+		SpriteDiskCacheSave();
+		_sprite_disk_cache.Unload();
+	}
+	LoadSpriteDiskCache();
+}
+
+static void *SpriteDiskCacheLookup(uint64 key, AllocatorProc *allocator)
+{
+	EnsureSpriteDiskCacheLoaded();
+
+	const byte *src;
+	SpriteDiskCache::Entry *entry;
+	auto new_iter = _sprite_disk_cache.new_entries.find(key);
+	if (new_iter != _sprite_disk_cache.new_entries.end()) {
+		entry = &new_iter->second;
+		src = _sprite_disk_cache.new_data.data() + entry->offset;
+	} else {
+		auto iter = _sprite_disk_cache.entries.find(key);
+		if (iter == _sprite_disk_cache.entries.end()) return nullptr;
+		entry = &iter->second;
+		if (entry->offset + entry->size > _sprite_disk_cache.data_size) return nullptr;
+		src = _sprite_disk_cache.data + entry->offset;
+	}
+
+	entry->used = true;
+	void *ptr = allocator(entry->size);
+	memcpy(ptr, src, entry->size);
+	return ptr;
+}
+
+static void SpriteDiskCacheStore(uint64 key, const void *blob, size_t size)
+{
+	if (size > UINT32_MAX) return;
+	if (_sprite_disk_cache.new_data.size() + size > SPRITE_DISK_CACHE_MAX_NEW_BYTES) return;
+
+	SpriteDiskCache::Entry entry = { _sprite_disk_cache.new_data.size(), (uint32)size, true };
+	if (!_sprite_disk_cache.new_entries.insert({ key, entry }).second) return;
+	const byte *p = (const byte *)blob;
+	_sprite_disk_cache.new_data.insert(_sprite_disk_cache.new_data.end(), p, p + size);
+}
+
+/** Write the sprite disk cache for the current blitter back to its file. */
+void SpriteDiskCacheSave()
+{
+	if (!_sprite_disk_cache.loaded || _sprite_disk_cache.new_entries.empty()) return;
+
+	std::string path = GetSpriteDiskCachePath();
+	std::string tmp_path = path + ".tmp";
+	FILE *f = fopen(tmp_path.c_str(), "wb");
+	if (f == nullptr) {
+		DEBUG(sprite, 0, "Failed to write sprite cache file: %s", tmp_path.c_str());
+		return;
+	}
+
+	/* New entries are always kept; old ones are dropped when over the size
+	 * budget, least useful (not used this session) first. */
+	std::vector<std::pair<uint64, const SpriteDiskCache::Entry *>> keep;
+	size_t total = 0;
+	for (const auto &it : _sprite_disk_cache.new_entries) {
+		keep.push_back({ it.first, &it.second });
+		total += it.second.size;
+	}
+	for (uint pass = 0; pass < 2; pass++) {
+		for (const auto &it : _sprite_disk_cache.entries) {
+			if (it.second.used != (pass == 0)) continue;
+			if (total + it.second.size > SPRITE_DISK_CACHE_MAX_FILE_BYTES) continue;
+			if (it.second.offset + it.second.size > _sprite_disk_cache.data_size) continue;
+			if (_sprite_disk_cache.new_entries.find(it.first) != _sprite_disk_cache.new_entries.end()) continue;
+			keep.push_back({ it.first, &it.second });
+			total += it.second.size;
+		}
+	}
+
+	bool ok = true;
+	uint64 config_hash = GetSpriteDiskCacheConfigHash();
+	uint32 header[4] = { SPRITE_DISK_CACHE_MAGIC, SPRITE_DISK_CACHE_VERSION, (uint32)config_hash, (uint32)(config_hash >> 32) };
+	uint32 count = (uint32)keep.size();
+	ok = ok && fwrite(header, sizeof(header), 1, f) == 1;
+	ok = ok && fwrite(&count, sizeof(count), 1, f) == 1;
+	for (const auto &it : keep) {
+		ok = ok && fwrite(&it.first, sizeof(it.first), 1, f) == 1;
+		ok = ok && fwrite(&it.second->size, sizeof(it.second->size), 1, f) == 1;
+	}
+	for (const auto &it : keep) {
+		bool is_new = _sprite_disk_cache.new_entries.find(it.first) != _sprite_disk_cache.new_entries.end();
+		const byte *src = (is_new ? _sprite_disk_cache.new_data.data() : _sprite_disk_cache.data) + it.second->offset;
+		if (it.second->size != 0) ok = ok && fwrite(src, it.second->size, 1, f) == 1;
+	}
+	fclose(f);
+
+	if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+		DEBUG(sprite, 0, "Failed to write sprite cache file: %s", path.c_str());
+		unlink(tmp_path.c_str());
+		return;
+	}
+	DEBUG(sprite, 2, "Wrote sprite cache file: %s, %u sprites (" PRINTF_SIZE " bytes)", path.c_str(), count, total);
+}
+
+static AllocatorProc *_sprite_disk_cache_wrapped_allocator;
+static void *_sprite_disk_cache_last_alloc_ptr;
+static size_t _sprite_disk_cache_last_alloc_size;
+
+/** Allocator shim recording the size of the encoded sprite, which the encoder does not expose. */
+static void *SpriteDiskCacheCaptureAlloc(size_t size)
+{
+	void *ptr = _sprite_disk_cache_wrapped_allocator(size);
+	_sprite_disk_cache_last_alloc_ptr = ptr;
+	_sprite_disk_cache_last_alloc_size = size;
+	return ptr;
+}
+
 /**
  * Read a sprite from disk.
  * @param sc          Location of sprite.
@@ -516,6 +843,29 @@ static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_ty
 
 	DEBUG(sprite, 9, "Load sprite %d", id);
 
+	/* Only blobs encoded for the current blitter may be cached on disk: other
+	 * encoders (e.g. the OpenGL sprite backend) are not registered blitters and
+	 * their blobs would collide with the blitter's in the cache file. Fonts are
+	 * excluded as their encoding additionally depends on _font_zoom. */
+	const bool disk_cacheable = sprite_type == ST_NORMAL &&
+			encoder == BlitterFactory::GetCurrentBlitter() &&
+			strcmp(BlitterFactory::GetCurrentBlitter()->GetName(), "null") != 0;
+	uint64 disk_cache_key = 0;
+	if (disk_cacheable) {
+		uint64 h = GetSpriteFileSignature(file);
+		h = SpriteDiskCacheHash(&file_pos, sizeof(file_pos), h);
+		uint32 count = sc->count;
+		h = SpriteDiskCacheHash(&count, sizeof(count), h);
+		byte fields[2] = { (byte)(sc->flags & ~(1 << SCCF_WARNED)), (byte)file.NeedsPaletteRemap() };
+		disk_cache_key = SpriteDiskCacheHash(fields, sizeof(fields), h);
+
+		void *ptr = SpriteDiskCacheLookup(disk_cache_key, allocator);
+		if (ptr != nullptr) return ptr;
+	}
+
+	/* A genuine on-demand miss: nearby sprites of this file are likely next. */
+	file.HintSpriteReadahead(file_pos);
+
 	SpriteLoader::Sprite sprite[ZOOM_LVL_COUNT];
 	uint8 sprite_avail = 0;
 	sprite[ZOOM_LVL_NORMAL].type = sprite_type;
@@ -563,7 +913,17 @@ static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_ty
 		return s;
 	}
 
-	if (!ResizeSprites(sprite, sprite_avail, encoder)) {
+	/* Materialise only the zoom levels the encoder (or the font hack below) will read. */
+	ZoomLevel zoom_min = ZOOM_LVL_MIN;
+	ZoomLevel zoom_max = ZOOM_LVL_MAX;
+	if (sprite_type == ST_NORMAL) {
+		encoder->GetNormalSpriteZoomRange(zoom_min, zoom_max);
+	} else if (sprite_type == ST_FONT) {
+		zoom_min = ZOOM_LVL_NORMAL;
+		zoom_max = _font_zoom;
+	}
+
+	if (!ResizeSprites(sprite, sprite_avail, encoder, zoom_min, zoom_max)) {
 		if (id == SPR_IMG_QUERY) usererror("Okay... something went horribly wrong. I couldn't resize the fallback sprite. What should I do?");
 		return (void*)GetRawSprite(SPR_IMG_QUERY, ST_NORMAL, allocator, encoder);
 	}
@@ -578,6 +938,16 @@ static void *ReadSprite(const SpriteCache *sc, SpriteID id, SpriteType sprite_ty
 		sprite[ZOOM_LVL_NORMAL].colours = sprite[_font_zoom].colours;
 	}
 
+	if (disk_cacheable) {
+		_sprite_disk_cache_wrapped_allocator = allocator;
+		_sprite_disk_cache_last_alloc_ptr = nullptr;
+		void *ptr = encoder->Encode(sprite, SpriteDiskCacheCaptureAlloc);
+		if (ptr != nullptr && ptr == _sprite_disk_cache_last_alloc_ptr) {
+			SpriteDiskCacheStore(disk_cache_key, ptr, _sprite_disk_cache_last_alloc_size);
+		}
+		return ptr;
+	}
+
 	return encoder->Encode(sprite, allocator);
 }
 
@@ -601,6 +971,100 @@ size_t GetGRFSpriteOffset(uint32 id)
 	return iter != _grf_sprite_offsets.end() ? iter->second.file_pos : SIZE_MAX;
 }
 
+/**
+ * Parse the sprite section of a container version 2 GRF into \a offsets.
+ * @param file    File positioned at the sprite section offset field.
+ * @param offsets Map to store the parsed offsets into.
+ */
+static void ReadGRFSpriteOffsetsInternal(SpriteFile &file, btree::btree_map<uint32, GrfSpriteOffset> &offsets)
+{
+	/* Seek to sprite section of the GRF. */
+	size_t data_offset = file.ReadDword();
+	size_t old_pos = file.GetPos();
+	file.SeekTo(data_offset, SEEK_CUR);
+
+	GrfSpriteOffset offset = { 0, 0, 0 };
+
+	/* Loop over all sprite section entries and store the file
+	 * offset for each newly encountered ID. */
+	uint32 id, prev_id = 0;
+	while ((id = file.ReadDword()) != 0) {
+		if (id != prev_id) {
+			offsets[prev_id] = offset;
+			offset.file_pos = file.GetPos() - 4;
+			offset.count = 0;
+			offset.control_flags = 0;
+		}
+		offset.count++;
+		prev_id = id;
+		uint length = file.ReadDword();
+		if (length > 0) {
+			byte colour = file.ReadByte() & SCC_MASK;
+			if (colour != SCC_PAL) SetBit(offset.control_flags, SCCF_HAS_NON_PALETTE);
+			length--;
+			if (length > 0) {
+				byte zoom = file.ReadByte();
+				length--;
+				if (colour != 0 && zoom == 0) { // ZOOM_LVL_OUT_4X (normal zoom)
+					SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_1X_32BPP : SCCF_ALLOW_ZOOM_MIN_1X_PAL);
+					SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_2X_32BPP : SCCF_ALLOW_ZOOM_MIN_2X_PAL);
+				}
+				if (colour != 0 && zoom == 2) { // ZOOM_LVL_OUT_2X (2x zoomed in)
+					SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_2X_32BPP : SCCF_ALLOW_ZOOM_MIN_2X_PAL);
+				}
+			}
+		}
+		file.SkipBytes(length);
+	}
+	if (prev_id != 0) offsets[prev_id] = offset;
+
+	/* Continue processing the data section. */
+	file.SeekTo(old_pos, SEEK_SET);
+}
+
+/** Sprite section offsets parsed ahead of time by PrecacheGRFSpriteOffsets(). */
+static std::map<std::string, btree::btree_map<uint32, GrfSpriteOffset>> _grf_sprite_offset_precache;
+
+static void PrecacheGRFSpriteOffsetsJob(void *data1, void *data2, void *data3)
+{
+	const std::string *filename = static_cast<const std::string *>(data1);
+	Subdirectory subdir = (Subdirectory)(uintptr_t)data2;
+	auto *offsets = static_cast<btree::btree_map<uint32, GrfSpriteOffset> *>(data3);
+
+	/* Each job opens its own file handle: SpriteFile reads are stateful. */
+	SpriteFile file(*filename, subdir, false);
+	if (file.GetContainerVersion() >= 2) ReadGRFSpriteOffsetsInternal(file, *offsets);
+}
+
+/**
+ * Parse the sprite sections of the given GRFs ahead of time, in parallel.
+ *
+ * ReadGRFSpriteOffsets() scans the whole sprite section of a GRF from disk and
+ * is run twice per file (init and activation stage) during the otherwise
+ * serial NewGRF loading; this primes a cache so each file is scanned once, on
+ * the worker pool. Files which cannot be precached (or are not listed here)
+ * are simply parsed on demand as before.
+ * @param files Filenames and their sub directories to precache.
+ */
+void PrecacheGRFSpriteOffsets(const std::vector<std::pair<std::string, Subdirectory>> &files)
+{
+	WorkerJobGroup group;
+	for (const auto &it : files) {
+		auto res = _grf_sprite_offset_precache.insert({ it.first, {} });
+		if (!res.second) continue;
+		/* Map nodes are stable, so each job can fill its own slot without locking. */
+		_general_worker_pool.EnqueueJob(&PrecacheGRFSpriteOffsetsJob, const_cast<std::string *>(&res.first->first),
+				(void *)(uintptr_t)it.second, &res.first->second, &group);
+	}
+	_general_worker_pool.WaitForGroupCompletion(&group);
+}
+
+/** Release the memory held by the sprite section offset precache. */
+void ClearGRFSpriteOffsetsPrecache()
+{
+	_grf_sprite_offset_precache.clear();
+}
+
 /**
  * Parse the sprite section of GRFs.
  * @param container_version Container version of the GRF we're currently processing.
@@ -610,48 +1074,14 @@ void ReadGRFSpriteOffsets(SpriteFile &file)
 	_grf_sprite_offsets.clear();
 
 	if (file.GetContainerVersion() >= 2) {
-		/* Seek to sprite section of the GRF. */
-		size_t data_offset = file.ReadDword();
-		size_t old_pos = file.GetPos();
-		file.SeekTo(data_offset, SEEK_CUR);
-
-		GrfSpriteOffset offset = { 0, 0, 0 };
-
-		/* Loop over all sprite section entries and store the file
-		 * offset for each newly encountered ID. */
-		uint32 id, prev_id = 0;
-		while ((id = file.ReadDword()) != 0) {
-			if (id != prev_id) {
-				_grf_sprite_offsets[prev_id] = offset;
-				offset.file_pos = file.GetPos() - 4;
-				offset.count = 0;
-				offset.control_flags = 0;
-			}
-			offset.count++;
-			prev_id = id;
-			uint length = file.ReadDword();
-			if (length > 0) {
-				byte colour = file.ReadByte() & SCC_MASK;
-				if (colour != SCC_PAL) SetBit(offset.control_flags, SCCF_HAS_NON_PALETTE);
-				length--;
-				if (length > 0) {
-					byte zoom = file.ReadByte();
-					length--;
-					if (colour != 0 && zoom == 0) { // ZOOM_LVL_OUT_4X (normal zoom)
-						SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_1X_32BPP : SCCF_ALLOW_ZOOM_MIN_1X_PAL);
-						SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_2X_32BPP : SCCF_ALLOW_ZOOM_MIN_2X_PAL);
-					}
-					if (colour != 0 && zoom == 2) { // ZOOM_LVL_OUT_2X (2x zoomed in)
-						SetBit(offset.control_flags, (colour != SCC_PAL) ? SCCF_ALLOW_ZOOM_MIN_2X_32BPP : SCCF_ALLOW_ZOOM_MIN_2X_PAL);
-					}
-				}
-			}
-			file.SkipBytes(length);
+		auto iter = _grf_sprite_offset_precache.find(file.GetFilename());
+		if (iter != _grf_sprite_offset_precache.end()) {
+			/* Skip the sprite section offset field, as the parser would. */
+			file.ReadDword();
+			_grf_sprite_offsets = iter->second;
+			return;
 		}
-		if (prev_id != 0) _grf_sprite_offsets[prev_id] = offset;
-
-		/* Continue processing the data section. */
-		file.SeekTo(old_pos, SEEK_SET);
+		ReadGRFSpriteOffsetsInternal(file, _grf_sprite_offsets);
 	}
 }
 
@@ -826,10 +1256,43 @@ static void DeleteEntriesFromSpriteCache(size_t target)
 		DeleteEntryFromSpriteCache(it.id);
 	}
 
+	_spritecache_stats.evictions += candidates.size();
+	_spritecache_stats.evicted_bytes += candidate_bytes;
+	_spritecache_stats.eviction_runs++;
+
 	DEBUG(sprite, 3, "DeleteEntriesFromSpriteCache, deleted: " PRINTF_SIZE ", freed: " PRINTF_SIZE ", in use: " PRINTF_SIZE " --> " PRINTF_SIZE ", delta: " PRINTF_SIZE ", requested: " PRINTF_SIZE,
 			candidates.size(), candidate_bytes, initial_in_use, GetSpriteCacheUsage(), initial_in_use - GetSpriteCacheUsage(), target);
 }
 
+/** Dump sprite cache usage and hit/miss/eviction statistics, for the console. */
+void DumpSpriteCacheStats(char *buffer, const char *last)
+{
+	int bpp = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
+	size_t budget = (bpp > 0 ? _sprite_cache_size * bpp / 8 : 1) * 1024 * 1024;
+
+	size_t loaded = 0;
+	size_t pinned = 0;
+	size_t pinned_bytes = 0;
+	for (SpriteID i = 0; i != _spritecache.size(); i++) {
+		SpriteCache *sc = GetSpriteCache(i);
+		if (sc->GetPtr() == nullptr) continue;
+		loaded++;
+		if (sc->GetType() == ST_RECOLOUR) {
+			pinned++;
+			pinned_bytes += sc->buffer.GetSize();
+		}
+	}
+
+	buffer += seprintf(buffer, last, "sprite cache: budget " PRINTF_SIZE " KB, in use " PRINTF_SIZE " KB, entries " PRINTF_SIZE " loaded of " PRINTF_SIZE ", pinned " PRINTF_SIZE " (" PRINTF_SIZE " KB)\n",
+			budget >> 10, GetSpriteCacheUsage() >> 10, loaded, _spritecache.size(), pinned, pinned_bytes >> 10);
+	uint64 lookups = _spritecache_stats.hits + _spritecache_stats.misses;
+	uint hit_permille = (lookups == 0) ? 0 : (uint)((_spritecache_stats.hits * 1000) / lookups);
+	buffer += seprintf(buffer, last, "lookups: " OTTD_PRINTF64U " (hits " OTTD_PRINTF64U ", misses " OTTD_PRINTF64U ", hit rate %u.%u%%)\n",
+			lookups, _spritecache_stats.hits, _spritecache_stats.misses, hit_permille / 10, hit_permille % 10);
+	buffer += seprintf(buffer, last, "evictions: " OTTD_PRINTF64U " entries, " OTTD_PRINTF64U " KB, in %u passes\n",
+			_spritecache_stats.evictions, _spritecache_stats.evicted_bytes >> 10, _spritecache_stats.eviction_runs);
+}
+
 void IncreaseSpriteLRU()
 {
 	int bpp = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
@@ -951,9 +1414,12 @@ void *GetRawSprite(SpriteID sprite, SpriteType type, AllocatorProc *allocator, S
 
 		/* Load the sprite, if it is not loaded, yet */
 		if (sc->GetPtr() == nullptr) {
+			_spritecache_stats.misses++;
 			void *ptr = ReadSprite(sc, sprite, type, AllocSprite, nullptr);
 			assert(ptr == _last_sprite_allocation.GetPtr());
 			sc->buffer = std::move(_last_sprite_allocation);
+		} else {
+			_spritecache_stats.hits++;
 		}
 
 		return sc->GetPtr();
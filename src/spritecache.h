@@ -63,10 +63,13 @@ void GfxInitSpriteMem();
 void GfxClearSpriteCache();
 void GfxClearFontSpriteCache();
 void IncreaseSpriteLRU();
+void SpriteDiskCacheSave();
 
 SpriteFile &OpenCachedSpriteFile(const std::string &filename, Subdirectory subdir, bool palette_remap);
 
 void ReadGRFSpriteOffsets(SpriteFile &file);
+void PrecacheGRFSpriteOffsets(const std::vector<std::pair<std::string, Subdirectory>> &files);
+void ClearGRFSpriteOffsetsPrecache();
 size_t GetGRFSpriteOffset(uint32 id);
 bool LoadNextSprite(int load_index, SpriteFile &file, uint file_sprite_id);
 bool SkipSpriteData(SpriteFile &file, byte type, uint16 num);
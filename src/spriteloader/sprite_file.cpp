@@ -48,3 +48,26 @@ SpriteFile::SpriteFile(const std::string &filename, Subdirectory subdir, bool pa
 	this->container_version = GetGRFContainerVersion(*this);
 	this->content_begin = this->GetPos();
 }
+
+/**
+ * Ask the OS to read ahead around a sprite which is about to be loaded on demand.
+ *
+ * Sprites of one GRF tend to be loaded in bursts in roughly ascending file
+ * order (e.g. when a window showing a vehicle set opens), so when one sprite
+ * misses the cache its neighbours are likely to be needed shortly after.
+ * Hinting a window of the file keeps those follow-up reads out of the
+ * synchronous path. Tracks the last hinted window to avoid re-issuing the
+ * hint for every sprite of a burst.
+ * @param pos Position of the sprite within the file.
+ */
+void SpriteFile::HintSpriteReadahead(size_t pos)
+{
+	static const size_t READAHEAD_WINDOW = 512 * 1024;
+
+	/* Still comfortably inside the previously hinted window? */
+	if (pos >= this->readahead_begin && pos + 16384 <= this->readahead_end) return;
+
+	this->ReadaheadHint(pos, READAHEAD_WINDOW);
+	this->readahead_begin = pos;
+	this->readahead_end = pos + READAHEAD_WINDOW;
+}
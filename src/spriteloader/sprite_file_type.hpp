@@ -28,6 +28,8 @@ class SpriteFile : public RandomAccessFile {
 	size_t content_begin;   ///< The begin of the content of the sprite file, i.e. after the container metadata.
 	bool palette_remap;     ///< Whether or not a remap of the palette is required for this file.
 	byte container_version; ///< Container format of the sprite file.
+	size_t readahead_begin = 0; ///< Start of the last window hinted by HintSpriteReadahead.
+	size_t readahead_end = 0;   ///< End of the last window hinted by HintSpriteReadahead.
 
 public:
 	SpriteFileFlags flags = SFF_NONE;
@@ -52,6 +54,8 @@ public:
 	 * Seek to the begin of the content, i.e. the position just after the container version has been determined.
 	 */
 	void SeekToBegin() { this->SeekTo(this->content_begin, SEEK_SET); }
+
+	void HintSpriteReadahead(size_t pos);
 };
 
 #endif /* SPRITE_FILE_TYPE_HPP */
@@ -96,6 +96,16 @@ public:
 	 */
 	virtual Sprite *Encode(const SpriteLoader::Sprite *sprite, AllocatorProc *allocator) = 0;
 
+	/**
+	 * Get the range of zoom levels which Encode() reads from a ST_NORMAL sprite.
+	 * Zoom levels outside this range do not have to be materialised by the caller.
+	 */
+	virtual void GetNormalSpriteZoomRange(ZoomLevel &zoom_min, ZoomLevel &zoom_max)
+	{
+		zoom_min = ZOOM_LVL_MIN;
+		zoom_max = ZOOM_LVL_MAX;
+	}
+
 	/**
 	 * Get the value which the height and width on a sprite have to be aligned by.
 	 * @return The needed alignment or 0 if any alignment is accepted.
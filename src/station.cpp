@@ -29,6 +29,7 @@
 #include "linkgraph/linkgraphschedule.h"
 #include "tracerestrict.h"
 #include "newgrf_debug.h"
+#include "worker_thread.h"
 
 #include "table/strings.h"
 
@@ -54,6 +55,44 @@ void RebuildStationKdtree()
 	_station_kdtree.Build(stids.begin(), stids.end());
 }
 
+/** Set of all stations with a non-empty loading_vehicles list, so that the load/unload tick need not visit every station. */
+btree::btree_set<StationID> _stations_with_loading_vehicles;
+
+/** Rebuild #_stations_with_loading_vehicles, e.g. after loading a game. */
+void RebuildStationsWithLoadingVehiclesSet()
+{
+	_stations_with_loading_vehicles.clear();
+	for (const Station *st : Station::Iterate()) {
+		if (!st->loading_vehicles.empty()) _stations_with_loading_vehicles.insert(st->index);
+	}
+}
+
+/**
+ * Find candidate stations which could cover any tile of an area, by querying
+ * the station kdtree instead of scanning all surrounding tiles.
+ * Catchment tiles lie at most the maximum catchment radius outside the
+ * station rect, and the station sign is always within the rect, whose extent
+ * is capped at #MAX_STATION_SPREAD, so expanding the search window by both
+ * bounds cannot miss a station covering the area.
+ * @param ta The area to find stations around.
+ * @param seen_stations Set to fill with the candidate station IDs.
+ */
+void FindStationsAroundTilesCandidates(const TileArea &ta, btree::btree_set<StationID> &seen_stations)
+{
+	uint max_c = _settings_game.station.modified_catchment ? MAX_CATCHMENT : CA_UNMODIFIED;
+	max_c += _settings_game.station.catchment_increase;
+	const uint radius = max_c + MAX_STATION_SPREAD;
+
+	uint32 x1 = (uint32)std::max<int>(0, (int)TileX(ta.tile) - (int)radius);
+	uint32 y1 = (uint32)std::max<int>(0, (int)TileY(ta.tile) - (int)radius);
+	uint32 x2 = std::min<uint32>(TileX(ta.tile) + ta.w + radius, MapSizeX());
+	uint32 y2 = std::min<uint32>(TileY(ta.tile) + ta.h + radius, MapSizeY());
+
+	_station_kdtree.FindContained(x1, y1, x2, y2, [&seen_stations](StationID id) {
+		seen_stations.insert(id);
+	});
+}
+
 
 BaseStation::~BaseStation()
 {
@@ -76,6 +115,7 @@ Station::Station(TileIndex tile) :
 	extra_name_index(UINT16_MAX),
 	time_since_load(255),
 	time_since_unload(255),
+	goods_rating_pending(0),
 	station_cargo_history_cargoes(0),
 	station_cargo_history_offset(0)
 {
@@ -270,6 +310,10 @@ void Station::MarkTilesDirty(bool cargo_change) const
 		if (this->speclist.size() == 0) return;
 	}
 
+	/* The redrawn tiles must be resolved afresh, their sprite layouts may
+	 * depend on whatever this redraw is reflecting (e.g. waiting cargo). */
+	this->layout_cache_epoch++;
+
 	for (h = 0; h < train_station.h; h++) {
 		for (w = 0; w < train_station.w; w++) {
 			if (this->TileBelongsToRailStation(tile)) {
@@ -477,14 +521,16 @@ bool Station::CatchmentCoversTown(TownID t) const
 }
 
 /**
- * Recompute tiles covered in our catchment area.
- * This will additionally recompute nearby towns and industries.
- * @param no_clear_nearby_lists If Station::RemoveFromAllNearbyLists does not need to be called.
+ * Recompute tiles covered in our catchment area, scan phase.
+ * This recomputes Station::catchment_tiles, Station::station_tiles and
+ * Station::industries_near, and records the towns/industries found in
+ * \a scan. Only fields of this station are written, so this may be run
+ * for several stations concurrently; see Station::ApplyCatchmentScan.
+ * @param scan Scan state to fill in.
  */
-void Station::RecomputeCatchment(bool no_clear_nearby_lists)
+void Station::ScanCatchment(StationCatchmentScan &scan)
 {
 	this->industries_near.clear();
-	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
 
 	if (this->rect.IsEmpty()) {
 		this->catchment_tiles.Reset();
@@ -499,12 +545,8 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 				this->catchment_tiles.SetTile(tile);
 			}
 		}
-		/* The industry's stations_near may have been computed before its neutral station was built so clear and re-add here. */
-		for (Station *st : this->industry->stations_near) {
-			st->RemoveIndustryToDeliver(this->industry);
-		}
-		this->industry->stations_near.clear();
-		this->industry->stations_near.insert(this);
+		/* The industry's nearby lists are fixed up in the apply phase. */
+		scan.neutral = this->industry;
 		this->industries_near.insert(IndustryListEntry{0, this->industry});
 
 		/* Loop finding all station tiles */
@@ -539,8 +581,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 	BitmapTileIterator it(this->catchment_tiles);
 	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
 		if (IsTileType(tile, MP_HOUSE)) {
-			Town *t = Town::GetByTile(tile);
-			t->stations_near.insert(this);
+			scan.towns.insert(Town::GetByTile(tile));
 		}
 		if (IsTileType(tile, MP_INDUSTRY)) {
 			Industry *i = Industry::GetByTile(tile);
@@ -548,7 +589,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 			/* Ignore industry if it has a neutral station. It already can't be this station. */
 			if (!_settings_game.station.serve_neutral_industries && i->neutral_station != nullptr) continue;
 
-			i->stations_near.insert(this);
+			scan.industries.insert(i);
 
 			/* Add if we can deliver to this industry as well */
 			this->AddIndustryToDeliver(i, tile);
@@ -556,6 +597,54 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 	}
 }
 
+/**
+ * Recompute tiles covered in our catchment area, apply phase.
+ * This links the towns/industries found by Station::ScanCatchment back to
+ * this station. This mutates the shared nearby lists of towns and
+ * industries and must therefore run sequentially.
+ * @param scan Scan state filled in by Station::ScanCatchment.
+ */
+void Station::ApplyCatchmentScan(const StationCatchmentScan &scan)
+{
+	if (scan.neutral != nullptr) {
+		/* The industry's stations_near may have been computed before its neutral station was built so clear and re-add here. */
+		for (Station *st : scan.neutral->stations_near) {
+			st->RemoveIndustryToDeliver(scan.neutral);
+		}
+		scan.neutral->stations_near.clear();
+		scan.neutral->stations_near.insert(this);
+		return;
+	}
+
+	for (Town *t : scan.towns) { t->stations_near.insert(this); }
+	for (Industry *i : scan.industries) { i->stations_near.insert(this); }
+}
+
+/**
+ * Recompute tiles covered in our catchment area.
+ * This will additionally recompute nearby towns and industries.
+ * @param no_clear_nearby_lists If Station::RemoveFromAllNearbyLists does not need to be called.
+ */
+void Station::RecomputeCatchment(bool no_clear_nearby_lists)
+{
+	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
+
+	StationCatchmentScan scan;
+	this->ScanCatchment(scan);
+	this->ApplyCatchmentScan(scan);
+}
+
+/** Worker job: scan the catchment of a contiguous range of stations. */
+static void RecomputeCatchmentScanJob(void *data1, void *data2, void *data3)
+{
+	std::vector<std::pair<Station *, StationCatchmentScan>> &scans = *static_cast<std::vector<std::pair<Station *, StationCatchmentScan>> *>(data1);
+	size_t start = (size_t)(uintptr_t)data2;
+	size_t end = (size_t)(uintptr_t)data3;
+	for (size_t i = start; i < end; i++) {
+		scans[i].first->ScanCatchment(scans[i].second);
+	}
+}
+
 /**
  * Recomputes catchment of all stations.
  * This will additionally recompute nearby stations for all towns and industries.
@@ -564,7 +653,31 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	for (Town *t : Town::Iterate()) { t->stations_near.clear(); }
 	for (Industry *i : Industry::Iterate()) { i->stations_near.clear(); }
-	for (Station *st : Station::Iterate()) { st->RecomputeCatchment(true); }
+
+	/* The scan phase only touches the station's own fields, so it can be spread
+	 * across the worker pool. The apply phase below runs sequentially in station
+	 * index order, so the result does not depend on the number of workers. */
+	std::vector<std::pair<Station *, StationCatchmentScan>> scans;
+	scans.reserve(Station::GetNumItems());
+	for (Station *st : Station::Iterate()) {
+		scans.emplace_back(std::piecewise_construct, std::forward_as_tuple(st), std::forward_as_tuple());
+	}
+
+	const size_t RANGE_SIZE = 16;
+	if (scans.size() > RANGE_SIZE) {
+		WorkerJobGroup group;
+		for (size_t start = RANGE_SIZE; start < scans.size(); start += RANGE_SIZE) {
+			_general_worker_pool.EnqueueJob(&RecomputeCatchmentScanJob, &scans, (void *)(uintptr_t)start, (void *)(uintptr_t)std::min(start + RANGE_SIZE, scans.size()), &group);
+		}
+		RecomputeCatchmentScanJob(&scans, (void *)(uintptr_t)0, (void *)(uintptr_t)RANGE_SIZE);
+		group.WaitForCompletion();
+	} else {
+		RecomputeCatchmentScanJob(&scans, (void *)(uintptr_t)0, (void *)(uintptr_t)scans.size());
+	}
+
+	for (auto &it : scans) {
+		it.first->ApplyCatchmentScan(it.second);
+	}
 }
 
 /************************************************************************/
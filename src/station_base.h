@@ -357,12 +357,15 @@ static_assert(std::is_nothrow_move_constructible<FlowStat>::value, "FlowStat mus
 static_assert(sizeof(FlowStat) == 24, "");
 #endif
 
+/** Index of a FlowStatMap: origin station to position in the storage vector, kept sorted by origin. */
+typedef std::vector<std::pair<StationID, uint16>> FlowStatMapIndex;
+
 template<typename cv_value, typename cv_container, typename cv_index_iter>
 class FlowStatMapIterator
 {
 	friend FlowStatMap;
-	friend FlowStatMapIterator<FlowStat, FlowStatMap, btree::btree_map<StationID, uint16>::iterator>;
-	friend FlowStatMapIterator<const FlowStat, const FlowStatMap, btree::btree_map<StationID, uint16>::const_iterator>;
+	friend FlowStatMapIterator<FlowStat, FlowStatMap, FlowStatMapIndex::iterator>;
+	friend FlowStatMapIterator<const FlowStat, const FlowStatMap, FlowStatMapIndex::const_iterator>;
 public:
 	typedef FlowStat value_type;
 	typedef cv_value& reference;
@@ -373,7 +376,7 @@ public:
 	FlowStatMapIterator(cv_container *fsm, cv_index_iter current) :
 		fsm(fsm), current(current) {}
 
-	FlowStatMapIterator(const FlowStatMapIterator<FlowStat, FlowStatMap, btree::btree_map<StationID, uint16>::iterator> &other) :
+	FlowStatMapIterator(const FlowStatMapIterator<FlowStat, FlowStatMap, FlowStatMapIndex::iterator> &other) :
 		fsm(other.fsm), current(other.current) {}
 
 	FlowStatMapIterator &operator=(const FlowStatMapIterator &) = default;
@@ -398,11 +401,23 @@ private:
 /** Flow descriptions by origin stations. */
 class FlowStatMap {
 	std::vector<FlowStat> flows_storage;
-	btree::btree_map<StationID, uint16> flows_index;
+	FlowStatMapIndex flows_index;
+
+	inline FlowStatMapIndex::iterator index_lower_bound(StationID from)
+	{
+		return std::lower_bound(this->flows_index.begin(), this->flows_index.end(), from,
+				[](const std::pair<StationID, uint16> &a, StationID b) -> bool { return a.first < b; });
+	}
+
+	inline FlowStatMapIndex::const_iterator index_lower_bound(StationID from) const
+	{
+		return std::lower_bound(this->flows_index.begin(), this->flows_index.end(), from,
+				[](const std::pair<StationID, uint16> &a, StationID b) -> bool { return a.first < b; });
+	}
 
 public:
-	using iterator = FlowStatMapIterator<FlowStat, FlowStatMap, btree::btree_map<StationID, uint16>::iterator>;
-	using const_iterator = FlowStatMapIterator<const FlowStat, const FlowStatMap, btree::btree_map<StationID, uint16>::const_iterator>;
+	using iterator = FlowStatMapIterator<FlowStat, FlowStatMap, FlowStatMapIndex::iterator>;
+	using const_iterator = FlowStatMapIterator<const FlowStat, const FlowStatMap, FlowStatMapIndex::const_iterator>;
 
 	friend iterator;
 	friend const_iterator;
@@ -419,13 +434,13 @@ public:
 	void FinalizeLocalConsumption(StationID self);
 
 private:
-	btree::btree_map<StationID, uint16>::iterator erase_priv(btree::btree_map<StationID, uint16>::iterator iter)
+	FlowStatMapIndex::iterator erase_priv(FlowStatMapIndex::iterator iter)
 	{
 		uint16 index = iter->second;
 		iter = this->flows_index.erase(iter);
 		if (index != this->flows_storage.size() - 1) {
 			this->flows_storage[index] = std::move(this->flows_storage.back());
-			this->flows_index[this->flows_storage[index].GetOrigin()] = index;
+			this->index_lower_bound(this->flows_storage[index].GetOrigin())->second = index;
 		}
 		this->flows_storage.pop_back();
 		return iter;
@@ -439,11 +454,15 @@ public:
 
 	iterator find(StationID from)
 	{
-		return iterator(this, this->flows_index.find(from));
+		FlowStatMapIndex::iterator iter = this->index_lower_bound(from);
+		if (iter != this->flows_index.end() && iter->first != from) iter = this->flows_index.end();
+		return iterator(this, iter);
 	}
 	const_iterator find(StationID from) const
 	{
-		return const_iterator(this, this->flows_index.find(from));
+		FlowStatMapIndex::const_iterator iter = this->index_lower_bound(from);
+		if (iter != this->flows_index.end() && iter->first != from) iter = this->flows_index.end();
+		return const_iterator(this, iter);
 	}
 
 	bool empty() const
@@ -458,8 +477,8 @@ public:
 
 	void erase(StationID st)
 	{
-		auto iter = this->flows_index.find(st);
-		if (iter != this->flows_index.end()) {
+		auto iter = this->index_lower_bound(st);
+		if (iter != this->flows_index.end() && iter->first == st) {
 			this->erase_priv(iter);
 		}
 	}
@@ -472,20 +491,20 @@ public:
 	std::pair<iterator, bool> insert(FlowStat flow_stat)
 	{
 		StationID st = flow_stat.GetOrigin();
-		auto res = this->flows_index.insert(std::pair<StationID, uint16>(st, (uint16)this->flows_storage.size()));
-		if (res.second) {
-			this->flows_storage.push_back(std::move(flow_stat));
+		FlowStatMapIndex::iterator iter = this->index_lower_bound(st);
+		if (iter != this->flows_index.end() && iter->first == st) {
+			return std::make_pair(iterator(this, iter), false);
 		}
-		return std::make_pair(iterator(this, res.first), res.second);
+		iter = this->flows_index.insert(iter, std::pair<StationID, uint16>(st, (uint16)this->flows_storage.size()));
+		this->flows_storage.push_back(std::move(flow_stat));
+		return std::make_pair(iterator(this, iter), true);
 	}
 
 	iterator insert(iterator hint, FlowStat flow_stat)
 	{
-		auto res = this->flows_index.insert(hint.current, std::pair<StationID, uint16>(flow_stat.GetOrigin(), (uint16)this->flows_storage.size()));
-		if (res->second == this->flows_storage.size()) {
-			this->flows_storage.push_back(std::move(flow_stat));
-		}
-		return iterator(this, res);
+		/* The index is a flat vector, the insertion point is found by binary
+		 * search and the hint is not needed. */
+		return this->insert(std::move(flow_stat)).first;
 	}
 
 	StationID FirstStationID() const
@@ -799,6 +818,21 @@ struct IndustryCompare {
 
 typedef btree::btree_set<IndustryListEntry, IndustryCompare> IndustryList;
 
+struct Town;
+
+/**
+ * Towns/industries found by Station::ScanCatchment, to be linked back to the
+ * station by Station::ApplyCatchmentScan. The scan phase only writes the
+ * station's own fields, so scans of multiple stations may run concurrently;
+ * the apply phase mutates the shared town/industry nearby lists and must run
+ * sequentially.
+ */
+struct StationCatchmentScan {
+	btree::btree_set<Town *> towns;          ///< Towns with at least one house tile in the catchment area.
+	btree::btree_set<Industry *> industries; ///< Industries with at least one tile in the catchment area.
+	Industry *neutral = nullptr;             ///< Set if the station exclusively serves its neutral industry.
+};
+
 /** Station data structure */
 struct Station FINAL : SpecializedStation<Station, false> {
 public:
@@ -833,6 +867,7 @@ public:
 	std::vector<Vehicle *> loading_vehicles;
 	GoodsEntry goods[NUM_CARGO];  ///< Goods at this station
 	CargoTypes always_accepted;       ///< Bitmask of always accepted cargo types (by houses, HQs, industry tiles when industry doesn't accept cargo)
+	CargoTypes goods_rating_pending;  ///< NOSAVE: Bitmask of cargo types the rating sweep must process: rated, or with a rating below the initial one. May contain spurious extra bits; rebuilt on load.
 
 	IndustryList industries_near; ///< Cached list of industries near the station that can accept cargo, @see DeliverGoodsToIndustry()
 	Industry *industry;           ///< NOSAVE: Associated industry for neutral stations. (Rebuilt on load from Industry->st)
@@ -859,6 +894,8 @@ public:
 	uint GetPlatformLength(TileIndex tile, DiagDirection dir) const override;
 	uint GetPlatformLength(TileIndex tile) const override;
 	void RecomputeCatchment(bool no_clear_nearby_lists = false);
+	void ScanCatchment(StationCatchmentScan &scan);
+	void ApplyCatchmentScan(const StationCatchmentScan &scan);
 	static void RecomputeCatchmentForAll();
 
 	uint GetCatchmentRadius() const;
@@ -931,6 +968,10 @@ public:
 };
 
 void RebuildStationKdtree();
+void FindStationsAroundTilesCandidates(const TileArea &ta, btree::btree_set<StationID> &seen_stations);
+
+extern btree::btree_set<StationID> _stations_with_loading_vehicles;
+void RebuildStationsWithLoadingVehiclesSet();
 
 /**
  * Call a function on all stations that have any part of the requested area within their catchment.
@@ -945,17 +986,10 @@ void ForAllStationsAroundTiles(const TileArea &ta, Func func)
 	/* There are no stations, so we will never find anything. */
 	if (Station::GetNumItems() == 0) return;
 
-	/* Not using, or don't have a nearby stations list, so we need to scan. */
+	/* Not using, or don't have a nearby stations list, so we need to
+	 * query the station kdtree for possible nearby stations. */
 	btree::btree_set<StationID> seen_stations;
-
-	/* Scan an area around the building covering the maximum possible station
-	 * to find the possible nearby stations. */
-	uint max_c = _settings_game.station.modified_catchment ? MAX_CATCHMENT : CA_UNMODIFIED;
-	max_c += _settings_game.station.catchment_increase;
-	TileArea ta_ext = TileArea(ta).Expand(max_c);
-	for (TileIndex tile : ta_ext) {
-		if (IsTileType(tile, MP_STATION)) seen_stations.insert(GetStationIndex(tile));
-	}
+	FindStationsAroundTilesCandidates(ta, seen_stations);
 
 	for (StationID stationid : seen_stations) {
 		Station *st = Station::GetIfValid(stationid);
@@ -64,7 +64,9 @@
 #include "table/strings.h"
 
 #include "3rdparty/cpp-btree/btree_set.h"
+#include "3rdparty/cpp-btree/btree_map.h"
 
+#include <atomic>
 #include <bitset>
 
 #include "safeguards.h"
@@ -3251,6 +3253,69 @@ const DrawTileSprites *GetStationTileLayout(StationType st, byte gfx)
 	return &_station_display_datas[st][gfx];
 }
 
+/** Cached resolution of a custom rail station tile's sprite layout. */
+struct StationTileLayoutCacheEntry {
+	const StationSpec *statspec;        ///< Spec the entry was resolved for; identity only, never dereferenced.
+	StationGfx gfx;                     ///< Raw station gfx of the tile.
+	RailType railtype;                  ///< Rail type of the tile.
+	uint8 anim_frame;                   ///< Animation frame of the tile.
+	uint8 tile_random;                  ///< Random bits of the tile.
+	uint16 station_random;              ///< Random bits of the station.
+	uint32 station_epoch;               ///< Value of the station's layout_cache_epoch at resolution time.
+	uint tile_layout;                   ///< Chosen tile layout, including the sprite layout callback result.
+	uint32 relocation;                  ///< Sprite relocation offset to apply when drawing.
+	uint32 ground_relocation;           ///< Ground sprite relocation offset to apply when drawing.
+	int32 total_offset;                 ///< Rail type sprite offset to apply when drawing.
+	PalSpriteID ground;                 ///< Resolved ground sprite.
+	std::vector<DrawTileSeqStruct> seq; ///< Resolved sprite sequence, terminator included.
+};
+
+/* Viewport drawing can run on multiple threads, so each thread caches on its
+ * own; the shared epoch lets game-state code throw all of them away at once. */
+static std::atomic<uint32> _station_layout_cache_epoch;
+static thread_local uint32 _station_layout_cache_seen_epoch;
+static thread_local btree::btree_map<TileIndex, StationTileLayoutCacheEntry> _station_layout_cache;
+
+/**
+ * Invalidate all cached station tile sprite layout resolutions, e.g. because
+ * the station specs they were resolved against are being freed.
+ */
+void InvalidateStationTileLayoutCache()
+{
+	_station_layout_cache_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Get this thread's station tile layout cache slot for a tile, and check
+ * whether its contents are still valid for the tile's current state. The
+ * identity fields cover everything the existing animation/trigger hooks
+ * change; cargo-driven and spec lifetime invalidations go via the epochs.
+ * @param tile The station tile being drawn.
+ * @param statspec Station spec of the tile.
+ * @param st Station of the tile.
+ * @param[out] valid Whether the returned slot holds a usable resolution.
+ * @return The cache slot for this tile.
+ */
+static StationTileLayoutCacheEntry *GetStationTileLayoutCacheSlot(TileIndex tile, const StationSpec *statspec, const BaseStation *st, bool &valid)
+{
+	uint32 epoch = _station_layout_cache_epoch.load(std::memory_order_relaxed);
+	if (_station_layout_cache_seen_epoch != epoch) {
+		_station_layout_cache.clear();
+		_station_layout_cache_seen_epoch = epoch;
+	}
+
+	StationTileLayoutCacheEntry &entry = _station_layout_cache[tile];
+	valid = entry.statspec == statspec &&
+			entry.gfx == GetStationGfx(tile) &&
+			entry.railtype == GetRailType(tile) &&
+			entry.anim_frame == GetAnimationFrame(tile) &&
+			entry.tile_random == GetStationTileRandomBits(tile) &&
+			entry.station_random == st->random_bits &&
+			entry.station_epoch == st->layout_cache_epoch &&
+			!entry.seq.empty();
+	return &entry;
+}
+
 /**
  * Check whether a sprite is a track sprite, which can be replaced by a non-track ground sprite and a rail overlay.
  * If the ground sprite is suitable, \a ground is replaced with the new non-track ground sprite, and \a overlay_offset
@@ -3321,6 +3386,8 @@ static void DrawTile_Station(TileInfo *ti, DrawTileProcParams params)
 	const NewGRFSpriteLayout *layout = nullptr;
 	DrawTileSprites tmp_rail_layout;
 	const DrawTileSprites *t = nullptr;
+	StationTileLayoutCacheEntry *cache_entry = nullptr;
+	bool layout_cache_hit = false;
 	int32 total_offset;
 	const RailtypeInfo *rti = nullptr;
 	uint32 relocation = 0;
@@ -3341,17 +3408,29 @@ static void DrawTile_Station(TileInfo *ti, DrawTileProcParams params)
 			if (statspec != nullptr) {
 				tile_layout = GetStationGfx(ti->tile);
 
-				if (HasBit(statspec->callback_mask, CBM_STATION_SPRITE_LAYOUT)) {
-					uint16 callback = GetStationCallback(CBID_STATION_SPRITE_LAYOUT, 0, 0, statspec, st, ti->tile, INVALID_RAILTYPE);
-					if (callback != CALLBACK_FAILED) tile_layout = (callback & ~1) + GetRailStationAxis(ti->tile);
-				}
+				cache_entry = GetStationTileLayoutCacheSlot(ti->tile, statspec, st, layout_cache_hit);
+				if (layout_cache_hit) {
+					/* Replay the cached resolution instead of resolving again. */
+					tile_layout = cache_entry->tile_layout;
+					relocation = cache_entry->relocation;
+					ground_relocation = cache_entry->ground_relocation;
+					total_offset = cache_entry->total_offset;
+					tmp_rail_layout.ground = cache_entry->ground;
+					tmp_rail_layout.seq = cache_entry->seq.data();
+					t = &tmp_rail_layout;
+				} else {
+					if (HasBit(statspec->callback_mask, CBM_STATION_SPRITE_LAYOUT)) {
+						uint16 callback = GetStationCallback(CBID_STATION_SPRITE_LAYOUT, 0, 0, statspec, st, ti->tile, INVALID_RAILTYPE);
+						if (callback != CALLBACK_FAILED) tile_layout = (callback & ~1) + GetRailStationAxis(ti->tile);
+					}
 
-				/* Ensure the chosen tile layout is valid for this custom station */
-				if (!statspec->renderdata.empty()) {
-					layout = &statspec->renderdata[tile_layout < statspec->renderdata.size() ? tile_layout : (uint)GetRailStationAxis(ti->tile)];
-					if (!layout->NeedsPreprocessing()) {
-						t = layout;
-						layout = nullptr;
+					/* Ensure the chosen tile layout is valid for this custom station */
+					if (!statspec->renderdata.empty()) {
+						layout = &statspec->renderdata[tile_layout < statspec->renderdata.size() ? tile_layout : (uint)GetRailStationAxis(ti->tile)];
+						if (!layout->NeedsPreprocessing()) {
+							t = layout;
+							layout = nullptr;
+						}
 					}
 				}
 			}
@@ -3512,7 +3591,7 @@ draw_default_foundation:
 			tmp_rail_layout.seq = layout->GetLayout(&tmp_rail_layout.ground);
 			t = &tmp_rail_layout;
 			total_offset = 0;
-		} else if (statspec != nullptr) {
+		} else if (statspec != nullptr && !layout_cache_hit) {
 			/* Simple sprite layout */
 			ground_relocation = relocation = GetCustomStationRelocation(statspec, st, ti->tile, INVALID_RAILTYPE, 0);
 			if (HasBit(statspec->flags, SSF_SEPARATE_GROUND)) {
@@ -3521,6 +3600,26 @@ draw_default_foundation:
 			ground_relocation += rti->fallback_railtype;
 		}
 
+		if (cache_entry != nullptr && !layout_cache_hit && t != nullptr && t->seq != nullptr) {
+			/* Remember this resolution for the next draw of the tile. */
+			cache_entry->statspec = statspec;
+			cache_entry->gfx = GetStationGfx(ti->tile);
+			cache_entry->railtype = GetRailType(ti->tile);
+			cache_entry->anim_frame = GetAnimationFrame(ti->tile);
+			cache_entry->tile_random = GetStationTileRandomBits(ti->tile);
+			cache_entry->station_random = st->random_bits;
+			cache_entry->station_epoch = st->layout_cache_epoch;
+			cache_entry->tile_layout = tile_layout;
+			cache_entry->relocation = relocation;
+			cache_entry->ground_relocation = ground_relocation;
+			cache_entry->total_offset = total_offset;
+			cache_entry->ground = t->ground;
+			cache_entry->seq.clear();
+			const DrawTileSeqStruct *dtss = t->seq;
+			while (!dtss->IsTerminator()) cache_entry->seq.push_back(*dtss++);
+			cache_entry->seq.push_back(*dtss); /* keep the terminator */
+		}
+
 		draw_ground = true;
 	}
 
@@ -4260,7 +4359,16 @@ static void UpdateStationRating(Station *st)
 	byte_inc_sat(&st->time_since_load);
 	byte_inc_sat(&st->time_since_unload);
 
-	for (const CargoSpec *cs : CargoSpec::Iterate()) {
+	/* Only the flagged cargo types can have anything to do: a rating is only
+	 * graded while the cargo is moving, and only sub-initial ratings age back.
+	 * The flags are set again wherever either condition can arise, so the
+	 * sweep need not touch the goods entries of idle cargo types at all. */
+	const CargoTypes pending = st->goods_rating_pending;
+	st->goods_rating_pending = 0;
+
+	for (CargoID cid : SetBitIterator<CargoID, CargoTypes>(pending)) {
+		const CargoSpec *cs = CargoSpec::Get(cid);
+		if (!cs->IsValid()) continue;
 		GoodsEntry *ge = &st->goods[cs->Index()];
 
 		/* Slowly increase the rating back to its original level in the case we
@@ -4279,6 +4387,7 @@ static void UpdateStationRating(Station *st)
 				ge->last_speed = 0;
 				TruncateCargo(cs, ge);
 				waiting_changed = true;
+				if (ge->rating < INITIAL_STATION_RATING) SetBit(st->goods_rating_pending, cid);
 				continue;
 			}
 
@@ -4359,6 +4468,9 @@ static void UpdateStationRating(Station *st)
 				}
 			}
 		}
+
+		/* Flag the entry again if the next sweep still has work on it. */
+		if (ge->HasRating() || ge->rating < INITIAL_STATION_RATING) SetBit(st->goods_rating_pending, cid);
 	}
 
 	StationID index = st->index;
@@ -4671,6 +4783,7 @@ void ModifyStationRatingAround(TileIndex tile, Owner owner, int amount, uint rad
 
 				if (ge->status != 0) {
 					ge->rating = Clamp(ge->rating + amount, 0, 255);
+					SetBit(st->goods_rating_pending, i);
 				}
 			}
 		}
@@ -4712,6 +4825,7 @@ static uint UpdateStationWaiting(Station *st, CargoID type, uint amount, SourceT
 		InvalidateWindowData(WC_STATION_LIST, st->index);
 		SetBit(ge.status, GoodsEntry::GES_RATING);
 	}
+	SetBit(st->goods_rating_pending, type);
 
 	TriggerStationRandomisation(st, st->xy, SRT_NEW_CARGO, type);
 	TriggerStationAnimation(st, st->xy, SAT_NEW_CARGO, type);
@@ -4924,7 +5038,10 @@ uint MoveGoodsToStation(CargoID type, uint amount, SourceType source_type, Sourc
 
 	Station *first_station = nullptr;
 	typedef std::pair<Station *, uint> StationInfo;
-	std::vector<StationInfo> used_stations;
+	/* Re-use the buffer between calls: this runs for every producer/cargo
+	 * production cycle, only ever from the game loop. */
+	static std::vector<StationInfo> used_stations;
+	used_stations.clear();
 
 	for (Station *st : *all_stations) {
 		if (exclusivity != INVALID_OWNER && exclusivity != st->owner) continue;
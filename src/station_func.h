@@ -25,6 +25,7 @@ void ModifyStationRatingAround(TileIndex tile, Owner owner, int amount, uint rad
 void ShowStationViewWindow(StationID station);
 void UpdateAllStationVirtCoords();
 void ClearAllStationCachedNames();
+void InvalidateStationTileLayoutCache();
 
 CargoArray GetProductionAroundTiles(TileIndex tile, int w, int h, int rad);
 CargoArray GetAcceptanceAroundTiles(TileIndex tile, int w, int h, int rad, CargoTypes *always_accepted = nullptr);
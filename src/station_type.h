@@ -95,6 +95,8 @@ enum StationDelivery : byte {
 
 static const uint MAX_LENGTH_STATION_NAME_CHARS = 128; ///< The maximum length of a station name in characters including '\0'
 
+static const uint MAX_STATION_SPREAD = 64; ///< Maximum possible extent of a station's tiles; the hard limit of the station_spread setting
+
 struct StationCompare {
 	bool operator() (const Station *lhs, const Station *rhs) const;
 };
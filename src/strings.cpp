@@ -195,10 +195,15 @@ struct LanguagePackDeleter {
 struct LoadedLanguagePack {
 	std::unique_ptr<LanguagePack, LanguagePackDeleter> langpack;
 
-	std::vector<char *> offsets;
+	std::vector<uint32> offsets; ///< Offsets into the langpack data of each zero terminated string.
 
 	std::array<uint, TEXT_TAB_END> langtab_num;   ///< Offset into langpack offs
 	std::array<uint, TEXT_TAB_END> langtab_start; ///< Offset into langpack offs
+
+	const char *GetString(size_t index) const
+	{
+		return this->langpack->data + this->offsets[index];
+	}
 };
 
 static LoadedLanguagePack _langpack;
@@ -213,7 +218,7 @@ const char *GetStringPtr(StringID string)
 		/* 0xD0xx and 0xD4xx IDs have been converted earlier. */
 		case TEXT_TAB_OLD_NEWGRF: NOT_REACHED();
 		case TEXT_TAB_NEWGRF_START: return GetGRFStringPtr(GetStringIndex(string));
-		default: return _langpack.offsets[_langpack.langtab_start[GetStringTab(string)] + GetStringIndex(string)];
+		default: return _langpack.GetString(_langpack.langtab_start[GetStringTab(string)] + GetStringIndex(string));
 	}
 }
 
@@ -2230,6 +2235,9 @@ bool LanguagePackHeader::IsReasonablyFinished() const
  */
 bool ReadLanguagePack(const LanguageMetadata *lang)
 {
+	/* Re-selecting the current language does not need a reload. */
+	if (lang == _current_language) return true;
+
 	/* Current language pack */
 	size_t len = 0;
 	std::unique_ptr<LanguagePack, LanguagePackDeleter> lang_pack(reinterpret_cast<LanguagePack *>(ReadFileToMem(lang->file, len, 1U << 20).release()));
@@ -2262,7 +2270,7 @@ bool ReadLanguagePack(const LanguageMetadata *lang)
 	}
 
 	/* Allocate offsets */
-	std::vector<char *> offs(count);
+	std::vector<uint32> offs(count);
 
 	/* Fill offsets */
 	char *s = lang_pack->data;
@@ -2274,7 +2282,7 @@ bool ReadLanguagePack(const LanguageMetadata *lang)
 			len = ((len & 0x3F) << 8) + (byte)*s++;
 			if (s + len >= end) return false;
 		}
-		offs[i] = s;
+		offs[i] = (uint32)(s - lang_pack->data);
 		s += len;
 		len = (byte)*s;
 		*s++ = '\0'; // zero terminate the string
@@ -2561,7 +2569,7 @@ class LanguagePackGlyphSearcher : public MissingGlyphSearcher {
 	{
 		if (this->i >= TEXT_TAB_END) return nullptr;
 
-		const char *ret = _langpack.offsets[_langpack.langtab_start[this->i] + this->j];
+		const char *ret = _langpack.GetString(_langpack.langtab_start[this->i] + this->j);
 
 		this->j++;
 		while (this->i < TEXT_TAB_END && this->j >= _langpack.langtab_num[this->i]) {
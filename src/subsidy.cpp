@@ -286,29 +286,44 @@ CommandCost CmdCreateSubsidy(TileIndex tile, DoCommandFlag flags, uint32 p1, uin
 
 /**
  * Tries to create a passenger subsidy between two towns.
+ * Candidates are taken from a list of all eligible towns, rather than by
+ * rejection sampling, so sparse maps get the same chance of an offer as dense ones.
  * @return True iff the subsidy was created.
  */
 bool FindSubsidyPassengerRoute()
 {
 	if (!Subsidy::CanAllocateItem()) return false;
 
-	const Town *src = Town::GetRandom();
-	if (src->cache.population < SUBSIDY_PAX_MIN_POPULATION ||
-			src->GetPercentTransported(CT_PASSENGERS) > SUBSIDY_MAX_PCT_TRANSPORTED) {
-		return false;
+	/* Towns eligible to be the source or destination of a passenger subsidy. */
+	std::vector<const Town *> candidates;
+	for (const Town *t : Town::Iterate()) {
+		if (t->cache.population >= SUBSIDY_PAX_MIN_POPULATION) candidates.push_back(t);
 	}
+	if (candidates.size() < 2) return false;
 
-	const Town *dst = Town::GetRandom();
-	if (dst->cache.population < SUBSIDY_PAX_MIN_POPULATION || src == dst) {
-		return false;
-	}
+	for (uint attempt = 0; attempt < SUBSIDY_CANDIDATE_ATTEMPTS; attempt++) {
+		const Town *src = candidates[RandomRange((uint32)candidates.size())];
+		if (src->GetPercentTransported(CT_PASSENGERS) > SUBSIDY_MAX_PCT_TRANSPORTED) continue;
 
-	if (DistanceManhattan(src->xy, dst->xy) > SUBSIDY_MAX_DISTANCE) return false;
-	if (CheckSubsidyDuplicate(CT_PASSENGERS, ST_TOWN, src->index, ST_TOWN, dst->index)) return false;
+		/* Eligible destinations within subsidy distance of the source. */
+		std::vector<const Town *> dests;
+		for (const Town *t : candidates) {
+			if (t != src && DistanceManhattan(src->xy, t->xy) <= SUBSIDY_MAX_DISTANCE) dests.push_back(t);
+		}
 
-	CreateSubsidy(CT_PASSENGERS, ST_TOWN, src->index, ST_TOWN, dst->index);
+		while (!dests.empty()) {
+			uint32 i = RandomRange((uint32)dests.size());
+			const Town *dst = dests[i];
+			if (!CheckSubsidyDuplicate(CT_PASSENGERS, ST_TOWN, src->index, ST_TOWN, dst->index)) {
+				CreateSubsidy(CT_PASSENGERS, ST_TOWN, src->index, ST_TOWN, dst->index);
+				return true;
+			}
+			dests[i] = dests.back();
+			dests.pop_back();
+		}
+	}
 
-	return true;
+	return false;
 }
 
 bool FindSubsidyCargoDestination(CargoID cid, SourceType src_type, SourceID src);
@@ -324,52 +339,56 @@ bool FindSubsidyTownCargoRoute()
 
 	SourceType src_type = ST_TOWN;
 
-	/* Select a random town. */
-	const Town *src_town = Town::GetRandom();
-	if (src_town->cache.population < SUBSIDY_CARGO_MIN_POPULATION) return false;
+	/* Towns eligible to be the source of a cargo subsidy. */
+	std::vector<const Town *> candidates;
+	for (const Town *t : Town::Iterate()) {
+		if (t->cache.population >= SUBSIDY_CARGO_MIN_POPULATION) candidates.push_back(t);
+	}
 
-	/* Calculate the produced cargo of houses around town center. */
-	CargoArray town_cargo_produced;
-	TileArea ta = TileArea(src_town->xy, 1, 1).Expand(SUBSIDY_TOWN_CARGO_RADIUS);
-	for (TileIndex tile : ta) {
-		if (IsTileType(tile, MP_HOUSE)) {
-			AddProducedCargo(tile, town_cargo_produced);
+	for (uint attempt = 0; attempt < SUBSIDY_CANDIDATE_ATTEMPTS && !candidates.empty(); attempt++) {
+		uint32 candidate = RandomRange((uint32)candidates.size());
+		const Town *src_town = candidates[candidate];
+		candidates[candidate] = candidates.back();
+		candidates.pop_back();
+
+		/* Calculate the produced cargo of houses around town center. */
+		CargoArray town_cargo_produced;
+		TileArea ta = TileArea(src_town->xy, 1, 1).Expand(SUBSIDY_TOWN_CARGO_RADIUS);
+		for (TileIndex tile : ta) {
+			if (IsTileType(tile, MP_HOUSE)) {
+				AddProducedCargo(tile, town_cargo_produced);
+			}
 		}
-	}
 
-	/* Passenger subsidies are not handled here. */
-	town_cargo_produced[CT_PASSENGERS] = 0;
+		/* Passenger subsidies are not handled here. */
+		town_cargo_produced[CT_PASSENGERS] = 0;
 
-	uint8 cargo_count = 0;
-	for (CargoID i = 0; i < NUM_CARGO; i++) {
-		if (town_cargo_produced[i] > 0) cargo_count++;
-	}
+		/* Collect the produced cargoes which can be subsidised at all. */
+		CargoID cargoes[NUM_CARGO];
+		uint8 cargo_count = 0;
+		for (CargoID cid = 0; cid < NUM_CARGO; cid++) {
+			if (town_cargo_produced[cid] == 0) continue;
+
+			/* Avoid using invalid NewGRF cargoes, and cargoes not distributed manually. */
+			if (!CargoSpec::Get(cid)->IsValid() ||
+					_settings_game.linkgraph.GetDistributionType(cid) != DT_MANUAL) {
+				continue;
+			}
 
-	/* No cargo produced at all? */
-	if (cargo_count == 0) return false;
+			/* Skip if the percentage transported is large enough. */
+			if (src_town->GetPercentTransported(cid) > SUBSIDY_MAX_PCT_TRANSPORTED) continue;
 
-	/* Choose a random cargo that is produced in the town. */
-	uint8 cargo_number = RandomRange(cargo_count);
-	CargoID cid;
-	for (cid = 0; cid < NUM_CARGO; cid++) {
-		if (town_cargo_produced[cid] > 0) {
-			if (cargo_number == 0) break;
-			cargo_number--;
+			cargoes[cargo_count++] = cid;
 		}
-	}
-
-	/* Avoid using invalid NewGRF cargoes. */
-	if (!CargoSpec::Get(cid)->IsValid() ||
-			_settings_game.linkgraph.GetDistributionType(cid) != DT_MANUAL) {
-		return false;
-	}
+		if (cargo_count == 0) continue;
 
-	/* Quit if the percentage transported is large enough. */
-	if (src_town->GetPercentTransported(cid) > SUBSIDY_MAX_PCT_TRANSPORTED) return false;
+		/* Choose a random eligible cargo that is produced in the town. */
+		CargoID cid = cargoes[RandomRange(cargo_count)];
 
-	SourceID src = src_town->index;
+		if (FindSubsidyCargoDestination(cid, src_type, src_town->index)) return true;
+	}
 
-	return FindSubsidyCargoDestination(cid, src_type, src);
+	return false;
 }
 
 /**
@@ -382,43 +401,35 @@ bool FindSubsidyIndustryCargoRoute()
 
 	SourceType src_type = ST_INDUSTRY;
 
-	/* Select a random industry. */
-	const Industry *src_ind = Industry::GetRandom();
-	if (src_ind == nullptr) return false;
+	/* Eligible (industry, produced cargo) pairs: production present, not too much
+	 * of it already transported, and the cargo is distributed manually. */
+	struct IndustryCargoCandidate {
+		const Industry *ind;
+		CargoID cid;
+	};
+	std::vector<IndustryCargoCandidate> candidates;
+	for (const Industry *ind : Industry::Iterate()) {
+		for (uint cargo_index = 0; cargo_index < lengthof(ind->produced_cargo); cargo_index++) {
+			CargoID cid = ind->produced_cargo[cargo_index];
+			if (cid == CT_INVALID) continue;
+			if (ind->last_month_production[cargo_index] == 0) continue;
+			if (ind->last_month_pct_transported[cargo_index] > SUBSIDY_MAX_PCT_TRANSPORTED) continue;
+			if (_settings_game.linkgraph.GetDistributionType(cid) != DT_MANUAL) continue;
+			candidates.push_back({ ind, cid });
+		}
+	}
 
-	uint trans, total;
+	for (uint attempt = 0; attempt < SUBSIDY_CANDIDATE_ATTEMPTS && !candidates.empty(); attempt++) {
+		uint32 candidate = RandomRange((uint32)candidates.size());
+		const IndustryCargoCandidate &ic = candidates[candidate];
 
-	CargoID cid;
+		if (FindSubsidyCargoDestination(ic.cid, src_type, ic.ind->index)) return true;
 
-	/* Randomize cargo type */
-	int num_cargos = 0;
-	uint cargo_index;
-	for (cargo_index = 0; cargo_index < lengthof(src_ind->produced_cargo); cargo_index++) {
-		if (src_ind->produced_cargo[cargo_index] != CT_INVALID) num_cargos++;
-	}
-	if (num_cargos == 0) return false; // industry produces nothing
-	int cargo_num = RandomRange(num_cargos) + 1;
-	for (cargo_index = 0; cargo_index < lengthof(src_ind->produced_cargo); cargo_index++) {
-		if (src_ind->produced_cargo[cargo_index] != CT_INVALID) cargo_num--;
-		if (cargo_num == 0) break;
+		candidates[candidate] = candidates.back();
+		candidates.pop_back();
 	}
-	assert(cargo_num == 0); // indicates loop didn't break as intended
-	cid = src_ind->produced_cargo[cargo_index];
-	trans = src_ind->last_month_pct_transported[cargo_index];
-	total = src_ind->last_month_production[cargo_index];
-
-	/* Quit if no production in this industry
-	 * or if the pct transported is already large enough
-	 * or if the cargo is automatically distributed */
-	if (total == 0 || trans > SUBSIDY_MAX_PCT_TRANSPORTED ||
-			cid == CT_INVALID ||
-			_settings_game.linkgraph.GetDistributionType(cid) != DT_MANUAL) {
-		return false;
-	}
-
-	SourceID src = src_ind->index;
 
-	return FindSubsidyCargoDestination(cid, src_type, src);
+	return false;
 }
 
 /**
@@ -433,56 +444,72 @@ bool FindSubsidyCargoDestination(CargoID cid, SourceType src_type, SourceID src)
 	/* Choose a random destination. */
 	SourceType dst_type = Chance16(1, 2) ? ST_TOWN : ST_INDUSTRY;
 
-	SourceID dst;
+	TileIndex src_tile = (src_type == ST_TOWN) ? Town::Get(src)->xy : Industry::Get(src)->location.tile;
+
 	switch (dst_type) {
 		case ST_TOWN: {
-			/* Select a random town. */
-			const Town *dst_town = Town::GetRandom();
-
-			/* Calculate cargo acceptance of houses around town center. */
-			CargoArray town_cargo_accepted;
-			TileArea ta = TileArea(dst_town->xy, 1, 1).Expand(SUBSIDY_TOWN_CARGO_RADIUS);
-			for (TileIndex tile : ta) {
-				if (IsTileType(tile, MP_HOUSE)) {
-					AddAcceptedCargo(tile, town_cargo_accepted, nullptr);
-				}
+			/* Towns within subsidy distance of the source. */
+			std::vector<const Town *> candidates;
+			for (const Town *t : Town::Iterate()) {
+				if (src_type == ST_TOWN && t->index == src) continue;
+				if (DistanceManhattan(src_tile, t->xy) > SUBSIDY_MAX_DISTANCE) continue;
+				candidates.push_back(t);
 			}
 
-			/* Check if the town can accept this cargo. */
-			if (town_cargo_accepted[cid] < 8) return false;
+			for (uint attempt = 0; attempt < SUBSIDY_CANDIDATE_ATTEMPTS && !candidates.empty(); attempt++) {
+				uint32 candidate = RandomRange((uint32)candidates.size());
+				const Town *dst_town = candidates[candidate];
+				candidates[candidate] = candidates.back();
+				candidates.pop_back();
+
+				/* Calculate cargo acceptance of houses around town center. */
+				CargoArray town_cargo_accepted;
+				TileArea ta = TileArea(dst_town->xy, 1, 1).Expand(SUBSIDY_TOWN_CARGO_RADIUS);
+				for (TileIndex tile : ta) {
+					if (IsTileType(tile, MP_HOUSE)) {
+						AddAcceptedCargo(tile, town_cargo_accepted, nullptr);
+					}
+				}
 
-			dst = dst_town->index;
-			break;
+				/* Check if the town can accept this cargo. */
+				if (town_cargo_accepted[cid] < 8) continue;
+
+				/* Avoid duplicate subsidies. */
+				if (CheckSubsidyDuplicate(cid, src_type, src, ST_TOWN, dst_town->index)) continue;
+
+				CreateSubsidy(cid, src_type, src, ST_TOWN, dst_town->index);
+				return true;
+			}
+			return false;
 		}
 
 		case ST_INDUSTRY: {
-			/* Select a random industry. */
-			const Industry *dst_ind = Industry::GetRandom();
-			if (dst_ind == nullptr) return false;
+			/* Industries accepting the cargo within subsidy distance of the source. */
+			std::vector<const Industry *> candidates;
+			for (const Industry *ind : Industry::Iterate()) {
+				if (src_type == ST_INDUSTRY && ind->index == src) continue;
+				if (std::find(ind->accepts_cargo, endof(ind->accepts_cargo), cid) == endof(ind->accepts_cargo)) continue;
+				if (DistanceManhattan(src_tile, ind->location.tile) > SUBSIDY_MAX_DISTANCE) continue;
+				candidates.push_back(ind);
+			}
 
-			/* The industry must accept the cargo */
-			bool valid = std::find(dst_ind->accepts_cargo, endof(dst_ind->accepts_cargo), cid) != endof(dst_ind->accepts_cargo);
-			if (!valid) return false;
+			while (!candidates.empty()) {
+				uint32 candidate = RandomRange((uint32)candidates.size());
+				const Industry *dst_ind = candidates[candidate];
+				candidates[candidate] = candidates.back();
+				candidates.pop_back();
 
-			dst = dst_ind->index;
-			break;
+				/* Avoid duplicate subsidies. */
+				if (CheckSubsidyDuplicate(cid, src_type, src, ST_INDUSTRY, dst_ind->index)) continue;
+
+				CreateSubsidy(cid, src_type, src, ST_INDUSTRY, dst_ind->index);
+				return true;
+			}
+			return false;
 		}
 
 		default: NOT_REACHED();
 	}
-
-	/* Check that the source and the destination are not the same. */
-	if (src_type == dst_type && src == dst) return false;
-
-	/* Check distance between source and destination. */
-	if (!CheckSubsidyDistance(src_type, src, dst_type, dst)) return false;
-
-	/* Avoid duplicate subsidies. */
-	if (CheckSubsidyDuplicate(cid, src_type, src, dst_type, dst)) return false;
-
-	CreateSubsidy(cid, src_type, src, dst_type, dst);
-
-	return true;
 }
 
 /** Perform the monthly update of open subsidies, and try to create a new one. */
@@ -532,25 +559,13 @@ void SubsidyMonthlyLoop()
 
 	if (random_chance < 2 && _settings_game.linkgraph.distribution_pax == DT_MANUAL) {
 		/* There is a 1/8 chance each month of generating a passenger subsidy. */
-		int n = 1000;
-
-		do {
-			passenger_subsidy = FindSubsidyPassengerRoute();
-		} while (!passenger_subsidy && n--);
+		passenger_subsidy = FindSubsidyPassengerRoute();
 	} else if (random_chance == 2) {
 		/* Cargo subsidies with a town as a source have a 1/16 chance. */
-		int n = 1000;
-
-		do {
-			town_subsidy = FindSubsidyTownCargoRoute();
-		} while (!town_subsidy && n--);
+		town_subsidy = FindSubsidyTownCargoRoute();
 	} else if (random_chance == 3) {
 		/* Cargo subsidies with an industry as a source have a 1/16 chance. */
-		int n = 1000;
-
-		do {
-			industry_subsidy = FindSubsidyIndustryCargoRoute();
-		} while (!industry_subsidy && n--);
+		industry_subsidy = FindSubsidyIndustryCargoRoute();
 	}
 
 	modified |= passenger_subsidy || town_subsidy || industry_subsidy;
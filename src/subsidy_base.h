@@ -57,6 +57,7 @@ static const uint SUBSIDY_CARGO_MIN_POPULATION = 900; ///< Min. population of de
 static const uint SUBSIDY_MAX_PCT_TRANSPORTED  =  42; ///< Subsidy will be created only for towns/industries with less % transported
 static const uint SUBSIDY_MAX_DISTANCE         =  70; ///< Max. length of subsidised route (DistanceManhattan)
 static const uint SUBSIDY_TOWN_CARGO_RADIUS    =   6; ///< Extent of a tile area around town center when scanning for town cargo acceptance and production (6 ~= min catchmement + min station / 2)
+static const uint SUBSIDY_CANDIDATE_ATTEMPTS   =  10; ///< Max. candidates tried per subsidy creation attempt, when trying a candidate involves a tile area scan
 
 /** Types of subsidy news messages, which determine how the date is printed and whether to use singular or plural cargo names */
 enum class SubsidyDecodeParamType {
@@ -606,6 +606,11 @@ public:
 		int y = r.top;
 		int max = std::min<int>(this->vscroll[0]->GetPosition() + this->vscroll[0]->GetCapacity(), (int)this->groups.size());
 
+		/* Get the counts for all drawn groups with one pass over the trains,
+		 * instead of one pass per drawn group. */
+		std::map<GroupID, uint> counts;
+		CountTrainsNeedingTemplateReplacement(this->owner, counts);
+
 		/* Then treat all groups defined by/for the current company */
 		for (int i = this->vscroll[0]->GetPosition(); i < max; ++i) {
 			const Group *g = (this->groups)[i];
@@ -648,8 +653,8 @@ public:
 
 			/* Draw the number of trains that still need to be treated by the currently selected template replacement */
 			if (tid != INVALID_TEMPLATE) {
-				const TemplateVehicle *tv = TemplateVehicle::Get(tid);
-				const uint num_trains = CountsTrainsNeedingTemplateReplacement(g_id, tv);
+				auto count_iter = counts.find(g_id);
+				const uint num_trains = count_iter != counts.end() ? count_iter->second : 0;
 				// Draw number
 				SetDParam(0, num_trains);
 				int inner_right = DrawString(col2 + ScaleGUITrad(4), right - ScaleGUITrad(4), text_y, STR_JUST_INT, num_trains ? TC_ORANGE : TC_GREY, SA_RIGHT);
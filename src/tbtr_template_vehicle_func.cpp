@@ -343,6 +343,34 @@ uint CountsTrainsNeedingTemplateReplacement(GroupID g_id, const TemplateVehicle
 	return count;
 }
 
+/**
+ * Count the trains needing template replacement in each group of a company.
+ *
+ * This yields the same counts as calling CountsTrainsNeedingTemplateReplacement()
+ * for each group in turn, but iterates the trains only once in total, which
+ * matters when the counts of many groups are wanted at the same time.
+ * @param owner  The company to count for.
+ * @param counts Filled with the number of mismatching trains per group. Groups without template replacement get no entry.
+ */
+void CountTrainsNeedingTemplateReplacement(Owner owner, std::map<GroupID, uint> &counts)
+{
+	std::map<GroupID, const TemplateVehicle *> group_templates;
+
+	for (const Train *t : Train::Iterate()) {
+		if (t->owner != owner || !t->IsPrimaryVehicle()) continue;
+
+		auto iter = group_templates.find(t->group_id);
+		if (iter == group_templates.end()) {
+			const TemplateID tid = GetTemplateIDByGroupIDRecursive(t->group_id);
+			iter = group_templates.insert({ t->group_id, tid != INVALID_TEMPLATE ? TemplateVehicle::Get(tid) : nullptr }).first;
+		}
+		const TemplateVehicle *tv = iter->second;
+		if (tv == nullptr) continue;
+
+		if (!TrainMatchesTemplate(t, tv) || !TrainMatchesTemplateRefit(t, tv)) counts[t->group_id]++;
+	}
+}
+
 // refit each vehicle in t as is in tv, assume t and tv contain the same types of vehicles
 CommandCost CmdRefitTrainFromTemplate(Train *t, TemplateVehicle *tv, DoCommandFlag flags)
 {
@@ -15,6 +15,8 @@
 #include "tbtr_template_vehicle.h"
 #include "3rdparty/cpp-btree/btree_set.h"
 
+#include <map>
+
 Train* VirtualTrainFromTemplateVehicle(const TemplateVehicle* tv, StringID &err, uint32 user);
 
 void BuildTemplateGuiList(GUITemplateList*, Scrollbar*, Owner, RailType);
@@ -43,6 +45,7 @@ struct TemplateDepotVehicles {
 };
 
 uint CountsTrainsNeedingTemplateReplacement(GroupID g_id, const TemplateVehicle *tv);
+void CountTrainsNeedingTemplateReplacement(Owner owner, std::map<GroupID, uint> &counts);
 
 CommandCost TestBuyAllTemplateVehiclesInChain(TemplateVehicle *tv, TileIndex tile);
 
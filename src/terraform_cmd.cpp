@@ -13,6 +13,7 @@
 #include "bridge_map.h"
 #include "viewport_func.h"
 #include "genworld.h"
+#include "industry_type.h"
 #include "object_base.h"
 #include "company_base.h"
 #include "company_func.h"
@@ -36,6 +37,43 @@ struct TerraformerState {
 	TileIndexToHeightMap tile_to_new_height; ///< The tiles for which the height has changed.
 };
 
+/**
+ * Collects the viewport invalidation of the individual terraform steps of an
+ * area levelling command, so the affected tiles are marked dirty once at the
+ * end instead of once per height step. See CmdLevelLand.
+ */
+struct TerraformDirtyBatch {
+	bool active = false; ///< Whether terraform steps add their dirty tiles here instead of marking them immediately.
+	btree::btree_map<TileIndex, std::pair<int, int>> tiles; ///< Dirty tiles, with the lowest and highest height they were seen at.
+
+	void Add(TileIndex tile, int height)
+	{
+		auto res = this->tiles.insert({ tile, { height, height } });
+		if (!res.second) {
+			res.first->second.first = std::min(res.first->second.first, height);
+			res.first->second.second = std::max(res.first->second.second, height);
+		}
+	}
+};
+
+static TerraformDirtyBatch _terraform_dirty_batch;
+
+/**
+ * Mark the tiles collected in #_terraform_dirty_batch dirty and deactivate the
+ * batch. Marking at the lowest and highest recorded height covers all
+ * intermediate heights, as the marked area extends well beyond a single
+ * height step in either direction.
+ */
+static void FlushTerraformDirtyBatch()
+{
+	for (const auto &it : _terraform_dirty_batch.tiles) {
+		MarkTileDirtyByTile(it.first, VMDF_NONE, 0, it.second.second);
+		if (it.second.first != it.second.second) MarkTileDirtyByTile(it.first, VMDF_NONE, 0, it.second.first);
+	}
+	_terraform_dirty_batch.tiles.clear();
+	_terraform_dirty_batch.active = false;
+}
+
 /**
  * Gets the TileHeight (height of north corner) of a tile as of current terraforming progress.
  *
@@ -310,8 +348,14 @@ CommandCost CmdTerraformLand(TileIndex tile, DoCommandFlag flags, uint32 p1, uin
 	if (flags & DC_EXEC) {
 		/* Mark affected areas dirty. */
 		for (TileIndexSet::const_iterator it = ts.dirty_tiles.begin(); it != ts.dirty_tiles.end(); it++) {
-			MarkTileDirtyByTile(*it);
 			TileIndexToHeightMap::const_iterator new_height = ts.tile_to_new_height.find(*it);
+			if (_terraform_dirty_batch.active) {
+				/* A levelling command is running: collect the tiles so they are marked once at the end. */
+				_terraform_dirty_batch.Add(*it, TileHeight(*it));
+				if (new_height != ts.tile_to_new_height.end()) _terraform_dirty_batch.Add(*it, new_height->second);
+				continue;
+			}
+			MarkTileDirtyByTile(*it);
 			if (new_height == ts.tile_to_new_height.end()) continue;
 			MarkTileDirtyByTile(*it, VMDF_NONE, 0, new_height->second);
 		}
@@ -325,6 +369,8 @@ CommandCost CmdTerraformLand(TileIndex tile, DoCommandFlag flags, uint32 p1, uin
 			SetTileHeight(t, (uint)height);
 		}
 
+		if (!ts.tile_to_new_height.empty()) NotifyIndustryPlacementChange();
+
 		if (c != nullptr) c->terraform_limit -= (uint32)ts.tile_to_new_height.size() << 16;
 	}
 	return total_cost;
@@ -371,6 +417,9 @@ CommandCost CmdLevelLand(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 	int limit = (c == nullptr ? INT32_MAX : GB(c->terraform_limit, 16, 16));
 	if (limit == 0) return_cmd_error(STR_ERROR_TERRAFORM_LIMIT_REACHED);
 
+	/* Collect the dirty marking of the individual terraform steps and apply it in one go afterwards. */
+	if (flags & DC_EXEC) _terraform_dirty_batch.active = true;
+
 	OrthogonalOrDiagonalTileIterator iter(tile, p1, HasBit(p2, 0));
 	for (; *iter != INVALID_TILE; ++iter) {
 		TileIndex t = *iter;
@@ -389,6 +438,7 @@ CommandCost CmdLevelLand(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 				money -= ret.GetCost();
 				if (money < 0) {
 					_additional_cash_required = ret.GetCost();
+					FlushTerraformDirtyBatch();
 					return cost;
 				}
 				DoCommand(t, SLOPE_N, (curh > h) ? 0 : 1, flags, CMD_TERRAFORM_LAND);
@@ -412,5 +462,7 @@ CommandCost CmdLevelLand(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 		if (limit <= 0) break;
 	}
 
+	if (flags & DC_EXEC) FlushTerraformDirtyBatch();
+
 	return had_success ? cost : last_error;
 }
@@ -11,18 +11,29 @@
 #include "texteff.hpp"
 #include "transparency.h"
 #include "strings_func.h"
+#include "core/container_func.hpp"
 #include "core/smallvec_type.hpp"
 #include "viewport_func.h"
 #include "settings_type.h"
 #include "guitimer_func.h"
 #include "zoom_func.h"
 #include "window_gui.h"
+#include "3rdparty/cpp-btree/btree_map.h"
 
 #include "safeguards.h"
 
 static std::vector<struct TextEffect> _text_effects; ///< Text effects are stored there
 static TextEffectID _free_text_effect = 0;
 
+/** Width of one horizontal viewport culling bucket, as a shift of virtual coordinates. */
+static const uint TEXT_EFFECT_BUCKET_SHIFT = 12;
+
+/** Live text effects per coarse horizontal bucket, so viewport drawing only visits nearby effects. */
+static btree::btree_map<int32, std::vector<TextEffectID>> _text_effect_buckets;
+
+/** Live #TE_RISING text effects, so per-tick movement does not scan dead slots. */
+static std::vector<TextEffectID> _moving_text_effects;
+
 /** Container for all information about a text effect */
 struct TextEffect : public ViewportSign {
 	uint64 params_1;     ///< DParam parameter
@@ -30,18 +41,41 @@ struct TextEffect : public ViewportSign {
 	StringID string_id;  ///< String to draw for the text effect, if INVALID_STRING_ID then it's not valid
 	uint8 duration;      ///< How long the text effect should stay, in ticks (applies only when mode == TE_RISING)
 	TextEffectMode mode; ///< Type of text effect
+	bool moving = false; ///< Whether this slot is queued in #_moving_text_effects.
 
-	/** Reset the text effect */
-	void Reset()
-	{
-		this->MarkDirty(ZOOM_LVL_OUT_8X);
-		this->width_normal = 0;
-		this->string_id = INVALID_STRING_ID;
-		this->params_1 = _free_text_effect;
-		_free_text_effect = this - _text_effects.data();
-	}
+	void Reset();
 };
 
+/** Get the horizontal culling bucket a virtual x coordinate falls into. */
+static int32 TextEffectBucket(int32 center)
+{
+	return center >> TEXT_EFFECT_BUCKET_SHIFT;
+}
+
+static void AddTextEffectToBucket(TextEffectID te_id)
+{
+	_text_effect_buckets[TextEffectBucket(_text_effects[te_id].center)].push_back(te_id);
+}
+
+static void RemoveTextEffectFromBucket(TextEffectID te_id)
+{
+	auto it = _text_effect_buckets.find(TextEffectBucket(_text_effects[te_id].center));
+	if (it == _text_effect_buckets.end()) return;
+	container_unordered_remove(it->second, te_id);
+	if (it->second.empty()) _text_effect_buckets.erase(it);
+}
+
+/** Reset the text effect */
+void TextEffect::Reset()
+{
+	this->MarkDirty(ZOOM_LVL_OUT_8X);
+	RemoveTextEffectFromBucket(this - _text_effects.data());
+	this->width_normal = 0;
+	this->string_id = INVALID_STRING_ID;
+	this->params_1 = _free_text_effect;
+	_free_text_effect = this - _text_effects.data();
+}
+
 /* Text Effects */
 TextEffectID AddTextEffect(StringID msg, int center, int y, uint8 duration, TextEffectMode mode)
 {
@@ -68,6 +102,12 @@ TextEffectID AddTextEffect(StringID msg, int center, int y, uint8 duration, Text
 	te.width_normal = 0;
 	te.UpdatePosition(ZOOM_LVL_OUT_8X, center, y, msg);
 
+	AddTextEffectToBucket(i);
+	if (mode == TE_RISING && !te.moving) {
+		te.moving = true;
+		_moving_text_effects.push_back(i);
+	}
+
 	return i;
 }
 
@@ -104,11 +144,21 @@ void MoveAllTextEffects(uint delta_ms)
 	uint count = texteffecttimer.CountElapsed(delta_ms);
 	if (count == 0) return;
 
-	for (TextEffect &te : _text_effects) {
-		if (te.string_id == INVALID_STRING_ID) continue;
-		if (te.mode != TE_RISING) continue;
+	for (size_t i = 0; i < _moving_text_effects.size();) {
+		TextEffect &te = _text_effects[_moving_text_effects[i]];
+
+		/* The slot may have been freed, or reused for a static effect, since it was queued. */
+		if (te.string_id == INVALID_STRING_ID || te.mode != TE_RISING) {
+			te.moving = false;
+			_moving_text_effects[i] = _moving_text_effects.back();
+			_moving_text_effects.pop_back();
+			continue;
+		}
 
 		if (te.duration < count) {
+			te.moving = false;
+			_moving_text_effects[i] = _moving_text_effects.back();
+			_moving_text_effects.pop_back();
 			te.Reset();
 			continue;
 		}
@@ -117,6 +167,7 @@ void MoveAllTextEffects(uint delta_ms)
 		te.duration -= count;
 		te.top -= count * ZOOM_LVL_BASE;
 		te.MarkDirty(ZOOM_LVL_OUT_8X);
+		i++;
 	}
 }
 
@@ -124,6 +175,9 @@ void InitTextEffects()
 {
 	_text_effects.clear();
 	_text_effects.shrink_to_fit();
+	_text_effect_buckets.clear();
+	_moving_text_effects.clear();
+	_moving_text_effects.shrink_to_fit();
 	_free_text_effect = 0;
 }
 
@@ -136,10 +190,17 @@ void DrawTextEffects(ViewportDrawerDynamic *vdd, DrawPixelInfo *dpi, bool load_t
 	const int top_threshold = dpi->top - ScaleByZoom(WidgetDimensions::scaled.framerect.Horizontal() + FONT_HEIGHT_NORMAL, dpi->zoom);
 	const bool show_loading = (_settings_client.gui.loading_indicators && !load_transparent);
 
-	for (TextEffect &te : _text_effects) {
-		if (te.string_id == INVALID_STRING_ID) continue;
-		if ((te.mode == TE_RISING || show_loading) && te.top > top_threshold && te.top < bottom_threshold) {
-			ViewportAddString(vdd, dpi, ZOOM_LVL_OUT_8X, &te, te.string_id, te.string_id - 1, STR_NULL, te.params_1, te.params_2);
+	/* One bucket of margin on each side covers the half-widths of the signs. */
+	const int32 first_bucket = TextEffectBucket(dpi->left) - 1;
+	const int32 last_bucket = TextEffectBucket(dpi->left + dpi->width) + 1;
+
+	for (auto it = _text_effect_buckets.lower_bound(first_bucket); it != _text_effect_buckets.end() && it->first <= last_bucket; ++it) {
+		for (TextEffectID te_id : it->second) {
+			TextEffect &te = _text_effects[te_id];
+			if (te.string_id == INVALID_STRING_ID) continue;
+			if ((te.mode == TE_RISING || show_loading) && te.top > top_threshold && te.top < bottom_threshold) {
+				ViewportAddString(vdd, dpi, ZOOM_LVL_OUT_8X, &te, te.string_id, te.string_id - 1, STR_NULL, te.params_1, te.params_2);
+			}
 		}
 	}
 }
@@ -14,6 +14,7 @@
 #include "genworld.h"
 #include "core/random_func.hpp"
 #include "landscape_type.h"
+#include "worker_thread.h"
 
 #include "safeguards.h"
 
@@ -340,6 +341,34 @@ static inline void FreeHeightMap()
 	_height_map.h.clear();
 }
 
+/**
+ * Run fn(start, end) over the range [0, count) in contiguous chunks of at most
+ * range_size, spread across the general worker pool (inline when the pool has
+ * no workers).
+ *
+ * fn must only write height map cells within its own chunk and must not
+ * consume the shared random stream, so that the generated map depends only on
+ * the seed, not on the number of workers or their scheduling.
+ */
+template <typename F>
+static void RunHeightMapChunks(int count, int range_size, F &fn)
+{
+	WorkerJobFunc *trampoline = [](void *data1, void *data2, void *data3) {
+		F &f = *static_cast<F *>(data1);
+		f((int)(uintptr_t)data2, (int)(uintptr_t)data3);
+	};
+	if (count > range_size && _general_worker_pool.HasWorkers()) {
+		WorkerJobGroup group;
+		for (int start = range_size; start < count; start += range_size) {
+			_general_worker_pool.EnqueueJob(trampoline, &fn, (void *)(uintptr_t)start, (void *)(uintptr_t)(size_t)std::min(start + range_size, count), &group);
+		}
+		trampoline(&fn, (void *)(uintptr_t)0, (void *)(uintptr_t)range_size);
+		group.WaitForCompletion();
+	} else {
+		trampoline(&fn, (void *)(uintptr_t)0, (void *)(uintptr_t)count);
+	}
+}
+
 /**
  * Generates new random height in given amplitude (generated numbers will range from - amplitude to + amplitude)
  * @param rMax Limit of result
@@ -388,27 +417,39 @@ static void HeightMapGenerate()
 		}
 
 		/* It is regular iteration round.
-		 * Interpolate height values at odd x, even y tiles */
-		for (int y = 0; y <= _height_map.size_y; y += 2 * step) {
-			for (int x = 0; x <= _height_map.size_x - 2 * step; x += 2 * step) {
-				height_t h00 = _height_map.height(x + 0 * step, y);
-				height_t h02 = _height_map.height(x + 2 * step, y);
-				height_t h01 = (h00 + h02) / 2;
-				_height_map.height(x + 1 * step, y) = h01;
+		 * Interpolate height values at odd x, even y tiles.
+		 * Each chunk of rows only reads even rows/columns and writes its own rows,
+		 * so the rounds can be spread across the worker pool. */
+		auto interpolate_odd_x = [step](int start, int end) {
+			for (int r = start; r < end; r++) {
+				int y = r * 2 * step;
+				for (int x = 0; x <= _height_map.size_x - 2 * step; x += 2 * step) {
+					height_t h00 = _height_map.height(x + 0 * step, y);
+					height_t h02 = _height_map.height(x + 2 * step, y);
+					height_t h01 = (h00 + h02) / 2;
+					_height_map.height(x + 1 * step, y) = h01;
+				}
 			}
-		}
+		};
+		RunHeightMapChunks(_height_map.size_y / (2 * step) + 1, 64, interpolate_odd_x);
 
 		/* Interpolate height values at odd y tiles */
-		for (int y = 0; y <= _height_map.size_y - 2 * step; y += 2 * step) {
-			for (int x = 0; x <= _height_map.size_x; x += step) {
-				height_t h00 = _height_map.height(x, y + 0 * step);
-				height_t h20 = _height_map.height(x, y + 2 * step);
-				height_t h10 = (h00 + h20) / 2;
-				_height_map.height(x, y + 1 * step) = h10;
+		auto interpolate_odd_y = [step](int start, int end) {
+			for (int r = start; r < end; r++) {
+				int y = r * 2 * step;
+				for (int x = 0; x <= _height_map.size_x; x += step) {
+					height_t h00 = _height_map.height(x, y + 0 * step);
+					height_t h20 = _height_map.height(x, y + 2 * step);
+					height_t h10 = (h00 + h20) / 2;
+					_height_map.height(x, y + 1 * step) = h10;
+				}
 			}
-		}
+		};
+		RunHeightMapChunks(_height_map.size_y / (2 * step), 64, interpolate_odd_y);
 
-		/* Add noise for next higher frequency (smaller steps) */
+		/* Add noise for next higher frequency (smaller steps).
+		 * This stays serial: the row-major order of the RandomHeight() draws
+		 * defines the map for a given seed. */
 		for (int y = 0; y <= _height_map.size_y; y += step) {
 			for (int x = 0; x <= _height_map.size_x; x += step) {
 				_height_map.height(x, y) += RandomHeight(amplitude);
@@ -457,76 +498,81 @@ static int *HeightMapMakeHistogram(height_t h_min, height_t h_max, int *hist_buf
 /** Applies sine wave redistribution onto height map */
 static void HeightMapSineTransform(height_t h_min, height_t h_max)
 {
-	for (height_t &h : _height_map.h) {
-		double fheight;
-
-		if (h < h_min) continue;
-
-		/* Transform height into 0..1 space */
-		fheight = (double)(h - h_min) / (double)(h_max - h_min);
-		/* Apply sine transform depending on landscape type */
-		switch (_settings_game.game_creation.landscape) {
-			case LT_TOYLAND:
-			case LT_TEMPERATE:
-				/* Move and scale 0..1 into -1..+1 */
-				fheight = 2 * fheight - 1;
-				/* Sine transform */
-				fheight = sin(fheight * M_PI_2);
-				/* Transform it back from -1..1 into 0..1 space */
-				fheight = 0.5 * (fheight + 1);
-				break;
-
-			case LT_ARCTIC:
-				{
-					/* Arctic terrain needs special height distribution.
-					 * Redistribute heights to have more tiles at highest (75%..100%) range */
-					double sine_upper_limit = 0.75;
-					double linear_compression = 2;
-					if (fheight >= sine_upper_limit) {
-						/* Over the limit we do linear compression up */
-						fheight = 1.0 - (1.0 - fheight) / linear_compression;
-					} else {
-						double m = 1.0 - (1.0 - sine_upper_limit) / linear_compression;
-						/* Get 0..sine_upper_limit into -1..1 */
-						fheight = 2.0 * fheight / sine_upper_limit - 1.0;
-						/* Sine wave transform */
-						fheight = sin(fheight * M_PI_2);
-						/* Get -1..1 back to 0..(1 - (1 - sine_upper_limit) / linear_compression) == 0.0..m */
-						fheight = 0.5 * (fheight + 1.0) * m;
+	/* Purely per-cell transform, so rows can be spread across the worker pool */
+	auto transform_rows = [h_min, h_max](int start, int end) {
+		for (size_t i = (size_t)start * _height_map.dim_x, last = (size_t)end * _height_map.dim_x; i < last; i++) {
+			height_t &h = _height_map.h[i];
+			double fheight;
+
+			if (h < h_min) continue;
+
+			/* Transform height into 0..1 space */
+			fheight = (double)(h - h_min) / (double)(h_max - h_min);
+			/* Apply sine transform depending on landscape type */
+			switch (_settings_game.game_creation.landscape) {
+				case LT_TOYLAND:
+				case LT_TEMPERATE:
+					/* Move and scale 0..1 into -1..+1 */
+					fheight = 2 * fheight - 1;
+					/* Sine transform */
+					fheight = sin(fheight * M_PI_2);
+					/* Transform it back from -1..1 into 0..1 space */
+					fheight = 0.5 * (fheight + 1);
+					break;
+
+				case LT_ARCTIC:
+					{
+						/* Arctic terrain needs special height distribution.
+						 * Redistribute heights to have more tiles at highest (75%..100%) range */
+						double sine_upper_limit = 0.75;
+						double linear_compression = 2;
+						if (fheight >= sine_upper_limit) {
+							/* Over the limit we do linear compression up */
+							fheight = 1.0 - (1.0 - fheight) / linear_compression;
+						} else {
+							double m = 1.0 - (1.0 - sine_upper_limit) / linear_compression;
+							/* Get 0..sine_upper_limit into -1..1 */
+							fheight = 2.0 * fheight / sine_upper_limit - 1.0;
+							/* Sine wave transform */
+							fheight = sin(fheight * M_PI_2);
+							/* Get -1..1 back to 0..(1 - (1 - sine_upper_limit) / linear_compression) == 0.0..m */
+							fheight = 0.5 * (fheight + 1.0) * m;
+						}
 					}
-				}
-				break;
-
-			case LT_TROPIC:
-				{
-					/* Desert terrain needs special height distribution.
-					 * Half of tiles should be at lowest (0..25%) heights */
-					double sine_lower_limit = 0.5;
-					double linear_compression = 2;
-					if (fheight <= sine_lower_limit) {
-						/* Under the limit we do linear compression down */
-						fheight = fheight / linear_compression;
-					} else {
-						double m = sine_lower_limit / linear_compression;
-						/* Get sine_lower_limit..1 into -1..1 */
-						fheight = 2.0 * ((fheight - sine_lower_limit) / (1.0 - sine_lower_limit)) - 1.0;
-						/* Sine wave transform */
-						fheight = sin(fheight * M_PI_2);
-						/* Get -1..1 back to (sine_lower_limit / linear_compression)..1.0 */
-						fheight = 0.5 * ((1.0 - m) * fheight + (1.0 + m));
+					break;
+
+				case LT_TROPIC:
+					{
+						/* Desert terrain needs special height distribution.
+						 * Half of tiles should be at lowest (0..25%) heights */
+						double sine_lower_limit = 0.5;
+						double linear_compression = 2;
+						if (fheight <= sine_lower_limit) {
+							/* Under the limit we do linear compression down */
+							fheight = fheight / linear_compression;
+						} else {
+							double m = sine_lower_limit / linear_compression;
+							/* Get sine_lower_limit..1 into -1..1 */
+							fheight = 2.0 * ((fheight - sine_lower_limit) / (1.0 - sine_lower_limit)) - 1.0;
+							/* Sine wave transform */
+							fheight = sin(fheight * M_PI_2);
+							/* Get -1..1 back to (sine_lower_limit / linear_compression)..1.0 */
+							fheight = 0.5 * ((1.0 - m) * fheight + (1.0 + m));
+						}
 					}
-				}
-				break;
+					break;
 
-			default:
-				NOT_REACHED();
-				break;
+				default:
+					NOT_REACHED();
+					break;
+			}
+			/* Transform it back into h_min..h_max space */
+			h = (height_t)(fheight * (h_max - h_min) + h_min);
+			if (h < 0) h = I2H(0);
+			if (h >= h_max) h = h_max - 1;
 		}
-		/* Transform it back into h_min..h_max space */
-		h = (height_t)(fheight * (h_max - h_min) + h_min);
-		if (h < 0) h = I2H(0);
-		if (h >= h_max) h = h_max - 1;
-	}
+	};
+	RunHeightMapChunks(_height_map.size_y + 1, 64, transform_rows);
 }
 
 /**
@@ -574,9 +620,6 @@ static void HeightMapCurves(uint level)
 		{ lengthof(curve_map_4), curve_map_4 },
 	};
 
-	height_t ht[lengthof(curve_maps)];
-	MemSetT(ht, 0, lengthof(ht));
-
 	/* Set up a grid to choose curve maps based on location; attempt to get a somewhat square grid */
 	float factor = sqrt((float)_height_map.size_x / (float)_height_map.size_y);
 	uint sx = Clamp((int)(((1 << level) * factor) + 0.5), 1, 128);
@@ -587,90 +630,97 @@ static void HeightMapCurves(uint level)
 		c[i] = Random() % lengthof(curve_maps);
 	}
 
-	/* Apply curves */
-	for (int x = 0; x < _height_map.size_x; x++) {
-
-		/* Get our X grid positions and bi-linear ratio */
-		float fx = (float)(sx * x) / _height_map.size_x + 1.0f;
-		uint x1 = (uint)fx;
-		uint x2 = x1;
-		float xr = 2.0f * (fx - x1) - 1.0f;
-		xr = sin(xr * M_PI_2);
-		xr = sin(xr * M_PI_2);
-		xr = 0.5f * (xr + 1.0f);
-		float xri = 1.0f - xr;
-
-		if (x1 > 0) {
-			x1--;
-			if (x2 >= sx) x2--;
-		}
-
-		for (int y = 0; y < _height_map.size_y; y++) {
-
-			/* Get our Y grid position and bi-linear ratio */
-			float fy = (float)(sy * y) / _height_map.size_y + 1.0f;
-			uint y1 = (uint)fy;
-			uint y2 = y1;
-			float yr = 2.0f * (fy - y1) - 1.0f;
-			yr = sin(yr * M_PI_2);
-			yr = sin(yr * M_PI_2);
-			yr = 0.5f * (yr + 1.0f);
-			float yri = 1.0f - yr;
-
-			if (y1 > 0) {
-				y1--;
-				if (y2 >= sy) y2--;
+	/* Apply curves. The grid randomness is drawn above and each column only
+	 * writes its own cells, so columns can be spread across the worker pool. */
+	auto apply_curves = [&](int x_start, int x_end) {
+		height_t ht[lengthof(curve_maps)];
+		MemSetT(ht, 0, lengthof(ht));
+
+		for (int x = x_start; x < x_end; x++) {
+
+			/* Get our X grid positions and bi-linear ratio */
+			float fx = (float)(sx * x) / _height_map.size_x + 1.0f;
+			uint x1 = (uint)fx;
+			uint x2 = x1;
+			float xr = 2.0f * (fx - x1) - 1.0f;
+			xr = sin(xr * M_PI_2);
+			xr = sin(xr * M_PI_2);
+			xr = 0.5f * (xr + 1.0f);
+			float xri = 1.0f - xr;
+
+			if (x1 > 0) {
+				x1--;
+				if (x2 >= sx) x2--;
 			}
 
-			uint corner_a = c[x1 + sx * y1];
-			uint corner_b = c[x1 + sx * y2];
-			uint corner_c = c[x2 + sx * y1];
-			uint corner_d = c[x2 + sx * y2];
+			for (int y = 0; y < _height_map.size_y; y++) {
+
+				/* Get our Y grid position and bi-linear ratio */
+				float fy = (float)(sy * y) / _height_map.size_y + 1.0f;
+				uint y1 = (uint)fy;
+				uint y2 = y1;
+				float yr = 2.0f * (fy - y1) - 1.0f;
+				yr = sin(yr * M_PI_2);
+				yr = sin(yr * M_PI_2);
+				yr = 0.5f * (yr + 1.0f);
+				float yri = 1.0f - yr;
+
+				if (y1 > 0) {
+					y1--;
+					if (y2 >= sy) y2--;
+				}
+
+				uint corner_a = c[x1 + sx * y1];
+				uint corner_b = c[x1 + sx * y2];
+				uint corner_c = c[x2 + sx * y1];
+				uint corner_d = c[x2 + sx * y2];
 
-			/* Bitmask of which curve maps are chosen, so that we do not bother
-			 * calculating a curve which won't be used. */
-			uint corner_bits = 0;
-			corner_bits |= 1 << corner_a;
-			corner_bits |= 1 << corner_b;
-			corner_bits |= 1 << corner_c;
-			corner_bits |= 1 << corner_d;
+				/* Bitmask of which curve maps are chosen, so that we do not bother
+				 * calculating a curve which won't be used. */
+				uint corner_bits = 0;
+				corner_bits |= 1 << corner_a;
+				corner_bits |= 1 << corner_b;
+				corner_bits |= 1 << corner_c;
+				corner_bits |= 1 << corner_d;
 
-			height_t *h = &_height_map.height(x, y);
+				height_t *h = &_height_map.height(x, y);
 
-			/* Do not touch sea level */
-			if (*h < I2H(1)) continue;
+				/* Do not touch sea level */
+				if (*h < I2H(1)) continue;
 
-			/* Only scale above sea level */
-			*h -= I2H(1);
+				/* Only scale above sea level */
+				*h -= I2H(1);
 
-			/* Apply all curve maps that are used on this tile. */
-			for (uint t = 0; t < lengthof(curve_maps); t++) {
-				if (!HasBit(corner_bits, t)) continue;
+				/* Apply all curve maps that are used on this tile. */
+				for (uint t = 0; t < lengthof(curve_maps); t++) {
+					if (!HasBit(corner_bits, t)) continue;
 
-				[[maybe_unused]] bool found = false;
-				const control_point_t *cm = curve_maps[t].list;
-				for (uint i = 0; i < curve_maps[t].length - 1; i++) {
-					const control_point_t &p1 = cm[i];
-					const control_point_t &p2 = cm[i + 1];
+					[[maybe_unused]] bool found = false;
+					const control_point_t *cm = curve_maps[t].list;
+					for (uint i = 0; i < curve_maps[t].length - 1; i++) {
+						const control_point_t &p1 = cm[i];
+						const control_point_t &p2 = cm[i + 1];
 
-					if (*h >= p1.x && *h < p2.x) {
-						ht[t] = p1.y + (*h - p1.x) * (p2.y - p1.y) / (p2.x - p1.x);
+						if (*h >= p1.x && *h < p2.x) {
+							ht[t] = p1.y + (*h - p1.x) * (p2.y - p1.y) / (p2.x - p1.x);
 #ifdef WITH_FULL_ASSERTS
-						found = true;
+							found = true;
 #endif
-						break;
+							break;
+						}
 					}
+					dbg_assert(found);
 				}
-				dbg_assert(found);
-			}
 
-			/* Apply interpolation of curve map results. */
-			*h = (height_t)((ht[corner_a] * yri + ht[corner_b] * yr) * xri + (ht[corner_c] * yri + ht[corner_d] * yr) * xr);
+				/* Apply interpolation of curve map results. */
+				*h = (height_t)((ht[corner_a] * yri + ht[corner_b] * yr) * xri + (ht[corner_c] * yri + ht[corner_d] * yr) * xr);
 
-			/* Readd sea level */
-			*h += I2H(1);
+				/* Readd sea level */
+				*h += I2H(1);
+			}
 		}
-	}
+	};
+	RunHeightMapChunks(_height_map.size_x, 16, apply_curves);
 }
 
 /** Adjusts heights in height map to contain required amount of water tiles */
@@ -35,6 +35,15 @@ inline void CSleep(int milliseconds)
  */
 void SetCurrentThreadName(const char *name);
 
+/**
+ * Restrict the thread this function is called on to the logical CPUs set in
+ * the given mask. Bit n of the mask corresponds to logical CPU n; a zero mask
+ * leaves the thread unpinned. Does nothing on platforms without thread
+ * affinity support.
+ * @param mask Mask of logical CPUs the thread may run on.
+ */
+void SetCurrentThreadAffinity(uint64 mask);
+
 /**
  * Get the name of the current thread, if any.
  * @param str The start of the buffer.
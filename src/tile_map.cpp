@@ -91,6 +91,41 @@ Slope GetTilePixelSlopeOutsideMap(int x, int y, int *h)
 	return s;
 }
 
+/**
+ * Compute the slopes and pixel-Z heights of a run of tiles along a viewport
+ * row, i.e. tiles stepping (x - 1, y + 1) from the given north-eastern tile.
+ *
+ * Diagonal neighbours share a corner: the east corner of one tile is the west
+ * corner of the next tile in the run. Batching a whole run therefore reads
+ * three corner heights per tile instead of four, and keeps the per-corner
+ * address computations out of the per-tile draw loop.
+ *
+ * @param x First tile's X coordinate, must be inside the map.
+ * @param y First tile's Y coordinate, must be inside the map.
+ * @param count Number of tiles in the run; all of them must be inside the map.
+ * @param[out] slopes Receives each tile's slope, except for the HALFTILE part.
+ * @param[out] heights Receives each tile's pixel-Z height.
+ */
+void GetTilePixelSlopeRow(uint x, uint y, uint count, Slope *slopes, int *heights)
+{
+	int hwest = TileHeight(TileXY(std::min(x + 1, MapMaxX()), y)); // West corner of the first tile.
+
+	for (uint i = 0; i != count; i++, x--, y++) {
+		uint x2 = std::min(x + 1, MapMaxX());
+		uint y2 = std::min(y + 1, MapMaxY());
+
+		int hnorth = TileHeight(TileXY(x, y));   // Height of the North corner.
+		int heast  = TileHeight(TileXY(x, y2));  // Height of the East corner.
+		int hsouth = TileHeight(TileXY(x2, y2)); // Height of the South corner.
+
+		slopes[i] = GetTileSlopeGivenHeight(hnorth, hwest, heast, hsouth, &heights[i]);
+		heights[i] *= TILE_HEIGHT;
+
+		/* The next tile in the run is our south-western neighbour; its west corner is our east corner. */
+		hwest = heast;
+	}
+}
+
 /**
  * Check if a given tile is flat
  * @param tile Tile to check
@@ -289,6 +289,7 @@ static inline Slope GetTilePixelSlope(TileIndex tile, int *h)
 }
 
 Slope GetTilePixelSlopeOutsideMap(int x, int y, int *h);
+void GetTilePixelSlopeRow(uint x, uint y, uint count, Slope *slopes, int *heights);
 
 /**
  * Get bottom height of the tile
@@ -681,24 +681,34 @@ static inline bool IsOrderUsableForSeparation(const Order *order)
 std::vector<TimetableProgress> PopulateSeparationState(const Vehicle *v_start)
 {
 	std::vector<TimetableProgress> out;
-	if (v_start->GetNumOrders() == 0) return out;
+	const VehicleOrderID num_orders = v_start->GetNumOrders();
+	if (num_orders == 0) return out;
+
+	/* All vehicles in the shared group walk the same order list, so derive the
+	 * per-order-index aggregate state once up front instead of re-walking the
+	 * order list for every vehicle. Entry i covers all orders before order i. */
+	struct OrderPrefixState {
+		int cumulative_ticks = 0;   ///< Sum of the travel and wait times of the preceding orders.
+		bool usable = true;         ///< All preceding orders are usable for separation.
+		bool no_conditional = true; ///< None of the preceding orders is conditional.
+	};
+	std::vector<OrderPrefixState> prefixes(num_orders);
+	OrderPrefixState state;
+	for (VehicleOrderID i = 0; i < num_orders; i++) {
+		prefixes[i] = state;
+		const Order *order = v_start->GetOrder(i);
+		if (order->IsType(OT_CONDITIONAL)) state.no_conditional = false;
+		if (!IsOrderUsableForSeparation(order)) state.usable = false;
+		state.cumulative_ticks += order->GetTravelTime() + order->GetWaitTime();
+	}
+
 	for (const Vehicle *v = v_start->FirstShared(); v != nullptr; v = v->NextShared()) {
 		if (!HasBit(v->vehicle_flags, VF_SEPARATION_ACTIVE)) continue;
-		bool separation_valid = true;
 		const int n = v->cur_real_order_index;
-		int cumulative_ticks = 0;
-		bool vehicle_ok = true;
+		if (n >= num_orders || !prefixes[n].no_conditional) continue;
+		bool separation_valid = prefixes[n].usable;
+		int cumulative_ticks = prefixes[n].cumulative_ticks;
 		int order_count = n * 2;
-		for (int i = 0; i < n; i++) {
-			const Order *order = v->GetOrder(i);
-			if (order->IsType(OT_CONDITIONAL)) {
-				vehicle_ok = false;
-				break;
-			}
-			if (!IsOrderUsableForSeparation(order)) separation_valid = false;
-			cumulative_ticks += order->GetTravelTime() + order->GetWaitTime();
-		}
-		if (!vehicle_ok) continue;
 
 		const Order *order = v->GetOrder(n);
 		if (order->IsType(OT_CONDITIONAL)) continue;
@@ -281,6 +281,8 @@ Town *CalcClosestTownFromTile(TileIndex tile, uint threshold = UINT_MAX);
 void ResetHouses();
 
 void ClearTownHouse(Town *t, TileIndex tile);
+void StartTownCargoBatching();
+void FlushTownCargoBatching();
 void UpdateTownMaxPass(Town *t);
 void UpdateTownRadius(Town *t);
 void UpdateTownRadii();
@@ -10,6 +10,9 @@
 #include "stdafx.h"
 
 #include <bitset>
+#include <map>
+#include <tuple>
+#include <vector>
 
 #include "road.h"
 #include "road_internal.h" /* Cleaning up road bits */
@@ -44,6 +47,7 @@
 #include "town_kdtree.h"
 #include "townname_func.h"
 #include "core/random_func.hpp"
+#include "core/checksum_func.hpp"
 #include "core/backup_type.hpp"
 #include "depot_base.h"
 #include "object_map.h"
@@ -630,6 +634,66 @@ static void MakeTownHouseBigger(TileIndex tile)
 	if (flags & BUILDING_HAS_4_TILES) MakeSingleHouseBigger(TILE_ADDXY(tile, 1, 1));
 }
 
+/** Key of a pending town cargo production bucket, see TownGenerateCargo(). */
+struct TownCargoBucketKey {
+	TownID town;                     ///< Town to credit with the moved cargo.
+	CargoID cargo;                   ///< Cargo type produced.
+	std::vector<StationID> stations; ///< Catchment station set, sorted by station index.
+
+	bool operator<(const TownCargoBucketKey &other) const
+	{
+		return std::tie(this->town, this->cargo, this->stations) < std::tie(other.town, other.cargo, other.stations);
+	}
+};
+
+/**
+ * Town cargo production accumulated during the current tile loop tick.
+ *
+ * Houses produce cargo in tiny amounts, with each MoveGoodsToStation() call
+ * paying the full station distribution cost. Houses which share a catchment,
+ * the common case within a town, are therefore batched: production is
+ * accumulated per town, cargo type and station set, and flushed through one
+ * distribution call per bucket at the end of the tile loop. Station ratings
+ * do not change within a tile loop tick and both the key and the flush order
+ * are deterministic, so the batched distribution only differs from the
+ * unbatched one by sub-unit rounding.
+ */
+static std::map<TownCargoBucketKey, uint> _town_cargo_buckets;
+static bool _town_cargo_batching = false;
+
+/** Start accumulating town cargo production, see FlushTownCargoBatching(). */
+void StartTownCargoBatching()
+{
+	_town_cargo_batching = true;
+}
+
+/**
+ * Distribute the town cargo production accumulated since StartTownCargoBatching(),
+ * one MoveGoodsToStation() call per town/cargo/catchment bucket.
+ */
+void FlushTownCargoBatching()
+{
+	_town_cargo_batching = false;
+	if (_town_cargo_buckets.empty()) return;
+
+	StationList stations;
+	for (const auto &iter : _town_cargo_buckets) {
+		const TownCargoBucketKey &key = iter.first;
+		Town *t = Town::GetIfValid(key.town);
+		if (t == nullptr) continue;
+
+		/* Re-validate the stations, the tile loop may have removed some in the meantime. */
+		stations.clear();
+		for (StationID id : key.stations) {
+			Station *st = Station::GetIfValid(id);
+			if (st != nullptr) stations.insert(st);
+		}
+
+		t->supplied[key.cargo].new_act += MoveGoodsToStation(key.cargo, iter.second, ST_TOWN, key.town, &stations);
+	}
+	_town_cargo_buckets.clear();
+}
+
 /**
  * Generate cargo for a town (house).
  *
@@ -653,7 +717,20 @@ static void TownGenerateCargo(Town *t, CargoID ct, uint amount, StationFinder &s
 	if (amount == 0) return;
 
 	t->supplied[ct].new_max += amount;
-	t->supplied[ct].new_act += MoveGoodsToStation(ct, amount, ST_TOWN, t->index, stations.GetStations());
+
+	if (_town_cargo_batching) {
+		const StationList *list = stations.GetStations();
+		if (list->empty()) return;
+
+		TownCargoBucketKey key;
+		key.town = t->index;
+		key.cargo = ct;
+		key.stations.reserve(list->size());
+		for (const Station *st : *list) key.stations.push_back(st->index);
+		_town_cargo_buckets[std::move(key)] += amount;
+	} else {
+		t->supplied[ct].new_act += MoveGoodsToStation(ct, amount, ST_TOWN, t->index, stations.GetStations());
+	}
 }
 
 /**
@@ -692,8 +769,14 @@ static void TileLoop_Town(TileIndex tile)
 	StationFinder stations(TileArea(tile, 1, 1));
 
 	if (HasBit(hs->callback_mask, CBM_HOUSE_PRODUCE_CARGO)) {
+		/* Resolve all the iterations of the callback with a single resolver
+		 * object, like GetCustomEngineSprite() does for sprite stacks. Setting
+		 * up the house and town scopes is not cheap enough to redo per result. */
+		HouseResolverObject object(house_id, tile, t, CBID_HOUSE_PRODUCE_CARGO, 0, r);
 		for (uint i = 0; i < 256; i++) {
-			uint16 callback = GetHouseCallback(CBID_HOUSE_PRODUCE_CARGO, i, r, house_id, t, tile);
+			object.ResetState();
+			object.callback_param1 = i;
+			uint16 callback = object.ResolveCallback();
 
 			if (callback == CALLBACK_FAILED || callback == CALLBACK_HOUSEPRODCARGO_END) break;
 
@@ -939,17 +1022,26 @@ static void ChangeTileOwner_Town(TileIndex tile, Owner old_owner, Owner new_owne
 
 static bool GrowTown(Town *t);
 
+static uint _town_growth_tick_budget; ///< Number of grow attempts still allowed this tick, to spread bursts of simultaneously expiring grow counters
+
 static void TownTickHandler(Town *t)
 {
 	if (HasBit(t->flags, TOWN_IS_GROWING)) {
 		int i = (int)t->grow_counter - 1;
 		if (i < 0) {
+			if (_town_growth_tick_budget == 0) {
+				/* Out of budget for this tick, keep the counter expired and retry next tick */
+				t->grow_counter = 0;
+				return;
+			}
+			_town_growth_tick_budget--;
 			if (GrowTown(t)) {
 				i = t->growth_rate;
 			} else {
 				/* If growth failed wait a bit before retrying */
 				i = std::min<uint16>(t->growth_rate, TOWN_GROWTH_TICKS - 1);
 			}
+			UpdateStateChecksum((((uint64) t->index) << 32) | (uint32)i, SCA_TOWNS);
 		}
 		t->grow_counter = i;
 	}
@@ -959,6 +1051,11 @@ void OnTick_Town()
 {
 	if (_game_mode == GM_EDITOR) return;
 
+	/* A town can come up for growth at most once per TOWN_GROWTH_TICKS ticks,
+	 * so this budget covers the maximum sustained growth rate of all towns
+	 * while spreading simultaneous expiries over several ticks */
+	_town_growth_tick_budget = 1 + Town::GetNumItems() / TOWN_GROWTH_TICKS;
+
 	for (Town *t : Town::Iterate()) {
 		TownTickHandler(t);
 	}
@@ -2196,6 +2293,9 @@ static void DoCreateTown(Town *t, TileIndex tile, uint32 townnameparts, TownSize
 	UpdateTownGrowthRate(t);
 	UpdateTownMaxPass(t);
 	UpdateAirportsNoise();
+
+	/* Nearby tiles may now have a different closest town. */
+	ZoningTownAuthorityRatingChange();
 }
 
 /**
@@ -3496,6 +3596,9 @@ CommandCost CmdDeleteTown(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 		_town_kdtree.Remove(t->index);
 		if (_viewport_sign_kdtree_valid && t->cache.sign.kdtree_valid) _viewport_sign_kdtree.Remove(ViewportSignKdtreeItem::MakeTown(t->index));
 		delete t;
+
+		/* Nearby tiles may now have a different closest town. */
+		ZoningTownAuthorityRatingChange();
 	}
 
 	return CommandCost();
@@ -16,10 +16,11 @@
 #include "newgrf_townname.h"
 #include "town_type.h"
 #include "string_type.h"
-#include <set>
+#include "core/hashtable_map_type.hpp"
 #include <string>
 
-typedef std::set<std::string> TownNames;
+/** Set of names already given out, for checking candidate names against. Iteration order is unspecified. */
+typedef HashSet<std::string> TownNames;
 
 static constexpr uint BUILTIN_TOWNNAME_GENERATOR_COUNT = SPECSTR_TOWNNAME_LAST - SPECSTR_TOWNNAME_START + 1; ///< Number of built-in town name generators.
 
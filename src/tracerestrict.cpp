@@ -153,6 +153,25 @@ static void HandleCondition(std::vector<TraceRestrictCondStackFlags> &condstack,
 	}
 }
 
+/**
+ * Returns whether the result of evaluating a condition cannot influence the
+ * condition stack, i.e. HandleCondition would behave identically for either
+ * outcome. This is the case inside dead branches and for or-chains which are
+ * already satisfied, where evaluating the condition can be skipped entirely.
+ */
+static bool ConditionResultIsIgnored(const std::vector<TraceRestrictCondStackFlags> &condstack, TraceRestrictCondFlags condflags)
+{
+	if (condflags & TRCF_OR) {
+		if (condstack.back() & TRCSF_ACTIVE) return true;
+	}
+	if (condflags & (TRCF_OR | TRCF_ELSE)) {
+		if (condstack.back() & (TRCSF_DONE_IF | TRCSF_PARENT_INACTIVE)) return true;
+	} else {
+		if (!(condstack.back() & TRCSF_ACTIVE)) return true;
+	}
+	return false;
+}
+
 /**
  * Integer condition testing
  * Test value op condvalue
@@ -272,6 +291,13 @@ void TraceRestrictProgram::Execute(const Train* v, const TraceRestrictProgramInp
 					condstack.pop_back();
 				}
 			} else {
+				if (!condstack.empty() && ConditionResultIsIgnored(condstack, condflags)) {
+					/* The outcome of this condition cannot change the condition
+					 * stack, skip evaluating it (and any extra data word). */
+					if (IsTraceRestrictDoubleItem(item)) i++;
+					HandleCondition(condstack, condflags, false);
+					continue;
+				}
 				uint16 condvalue = GetTraceRestrictValue(item);
 				bool result = false;
 				switch(type) {
@@ -2496,6 +2522,32 @@ void TraceRestrictUpdateCompanyID(CompanyID old_company, CompanyID new_company)
 
 static btree::btree_multimap<VehicleID, TraceRestrictSlotID> slot_vehicle_index;
 
+/** Remove a single vehicle -> slot entry from the reverse index, without any flag or window updates */
+static void EraseSlotVehicleIndexEntry(VehicleID id, TraceRestrictSlotID slot)
+{
+	for (auto it = slot_vehicle_index.lower_bound(id); it != slot_vehicle_index.end() && it->first == id; ++it) {
+		if (it->second == slot) {
+			slot_vehicle_index.erase(it);
+			return;
+		}
+	}
+}
+
+/**
+ * Test whether vehicle ID is already an occupant.
+ * This is answered from the vehicle -> slot reverse index, as a vehicle is typically
+ * in far fewer slots than a slot has occupants.
+ * @param id Vehicle ID
+ * @return whether vehicle ID is an occupant
+ */
+bool TraceRestrictSlot::IsOccupant(VehicleID id) const
+{
+	for (auto it = slot_vehicle_index.lower_bound(id); it != slot_vehicle_index.end() && it->first == id; ++it) {
+		if (it->second == this->index) return true;
+	}
+	return false;
+}
+
 /**
  * Add vehicle ID to occupants if possible and not already an occupant
  * @param id Vehicle ID
@@ -2538,6 +2590,7 @@ bool TraceRestrictSlot::OccupyDryRunUsingTemporaryState(VehicleID id)
 	if (this->occupants.size() >= this->max_occupancy) return false;
 
 	this->occupants.push_back(id);
+	slot_vehicle_index.insert({ id, this->index });
 
 	if (find_index(veh_temporarily_removed, this->index) < 0) {
 		include(veh_temporarily_added, this->index);
@@ -2565,6 +2618,7 @@ void TraceRestrictSlot::Vacate(VehicleID id)
 void TraceRestrictSlot::VacateUsingTemporaryState(VehicleID id)
 {
 	if (container_unordered_remove(this->occupants, id)) {
+		EraseSlotVehicleIndexEntry(id, this->index);
 		if (find_index(veh_temporarily_added, this->index) < 0) {
 			include(veh_temporarily_removed, this->index);
 		}
@@ -2662,11 +2716,16 @@ void TraceRestrictSlot::RevertTemporaryChanges(VehicleID veh)
 {
 	for (TraceRestrictSlotID id : veh_temporarily_added) {
 		TraceRestrictSlot *slot = TraceRestrictSlot::Get(id);
-		container_unordered_remove(slot->occupants, veh);
+		if (container_unordered_remove(slot->occupants, veh)) {
+			EraseSlotVehicleIndexEntry(veh, id);
+		}
 	}
 	for (TraceRestrictSlotID id : veh_temporarily_removed) {
 		TraceRestrictSlot *slot = TraceRestrictSlot::Get(id);
-		include(slot->occupants, veh);
+		if (!slot->IsOccupant(veh)) {
+			slot->occupants.push_back(veh);
+			slot_vehicle_index.insert({ veh, id });
+		}
 	}
 	veh_temporarily_added.clear();
 	veh_temporarily_removed.clear();
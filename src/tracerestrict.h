@@ -1115,13 +1115,7 @@ struct TraceRestrictSlot : TraceRestrictSlotPool::PoolItem<&_tracerestrictslot_p
 		if (!CleaningPool()) this->Clear();
 	}
 
-	/** Test whether vehicle ID is already an occupant */
-	bool IsOccupant(VehicleID id) const {
-		for (size_t i = 0; i < occupants.size(); i++) {
-			if (occupants[i] == id) return true;
-		}
-		return false;
-	}
+	bool IsOccupant(VehicleID id) const;
 
 	bool Occupy(VehicleID id, bool force = false);
 	bool OccupyDryRun(VehicleID ids);
@@ -3818,7 +3818,7 @@ public:
 			/* This needs to be done in command-scope to enforce rebuilding before resorting invalid data */
 			this->vehgroups.ForceRebuild();
 			this->slots.ForceRebuild();
-		} else {
+		} else if (!this->HandleVehicleDirtyInvalidation(data)) {
 			this->vehgroups.ForceResort();
 			this->slots.ForceResort();
 		}
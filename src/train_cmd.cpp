@@ -81,7 +81,7 @@ enum ChooseTrainTrackFlags {
 };
 DECLARE_ENUM_AS_BIT_SET(ChooseTrainTrackFlags)
 
-std::unordered_map<SignalSpeedKey, SignalSpeedValue, SignalSpeedKeyHashFunc> _signal_speeds(1 << 16);
+HashMap<SignalSpeedKey, SignalSpeedValue, SignalSpeedKeyHashFunc> _signal_speeds;
 
 static void TryLongReserveChooseTrainTrackFromReservationEnd(Train *v, bool no_reserve_vehicle_tile = false);
 static Track ChooseTrainTrack(Train *v, TileIndex tile, DiagDirection enterdir, TrackBits tracks, ChooseTrainTrackFlags flags, bool *p_got_reservation, ChooseTrainTrackLookAheadState lookahead_state = {});
@@ -2643,14 +2643,12 @@ static bool TrainApproachingCrossing(TileIndex tile)
 	dbg_assert_tile(IsLevelCrossingTile(tile), tile);
 
 	DiagDirection dir = AxisToDiagDir(GetCrossingRailAxis(tile));
-	TileIndex tile_from = tile + TileOffsByDiagDir(dir);
-
-	if (HasVehicleOnPos(tile_from, VEH_TRAIN, reinterpret_cast<void *>((uintptr_t)tile), &TrainApproachingCrossingEnum)) return true;
-
-	dir = ReverseDiagDir(dir);
-	tile_from = tile + TileOffsByDiagDir(dir);
+	const TileIndex tiles_from[2] = {
+		tile + TileOffsByDiagDir(dir),
+		tile + TileOffsByDiagDir(ReverseDiagDir(dir)),
+	};
 
-	return HasVehicleOnPos(tile_from, VEH_TRAIN, reinterpret_cast<void *>((uintptr_t)tile), &TrainApproachingCrossingEnum);
+	return HasVehicleOnTiles(tiles_from, VEH_TRAIN, reinterpret_cast<void *>((uintptr_t)tile), &TrainApproachingCrossingEnum);
 }
 
 /** Check if the crossing should be closed
@@ -4394,7 +4392,7 @@ static Track ChooseTrainTrack(Train *v, TileIndex tile, DiagDirection enterdir,
 
 		Track next_track = DoTrainPathfind(v, new_tile, dest_enterdir, tracks, path_found, do_track_reservation, &res_dest, &final_dest);
 		DEBUG_UPDATESTATECHECKSUM("ChooseTrainTrack: v: %u, path_found: %d, next_track: %d", v->index, path_found, next_track);
-		UpdateStateChecksum((((uint64) v->index) << 32) | (path_found << 16) | next_track);
+		UpdateStateChecksum((((uint64) v->index) << 32) | (path_found << 16) | next_track, SCA_VEHICLES);
 		if (new_tile == tile) best_track = next_track;
 		v->HandlePathfindingResult(path_found);
 	}
@@ -5429,6 +5427,15 @@ bool TrainController(Train *v, Vehicle *nomove, bool reverse)
 
 	/* For every vehicle after and including the given vehicle */
 	for (prev = v->Previous(); v != nomove; prev = v, v = v->Next()) {
+		/* Parts are scattered through the pool and the walk is a dependent
+		 * pointer chase, so start fetching the next part's movement state
+		 * while this one is being processed. */
+		Train *next_part = v->Next();
+		if (next_part != nullptr && next_part != nomove) {
+			PREFETCH_RW(next_part);
+			PREFETCH_RW(&next_part->track);
+		}
+
 		old_direction = v->direction;
 		old_trackbits = v->track;
 		old_gv_flags = v->gv_flags;
@@ -6126,14 +6133,15 @@ static bool IsRailStationPlatformOccupied(TileIndex tile)
 {
 	TileIndexDiff delta = (GetRailStationAxis(tile) == AXIS_X ? TileDiffXY(1, 0) : TileDiffXY(0, 1));
 
+	std::vector<TileIndex> tiles;
 	for (TileIndex t = tile; IsCompatibleTrainStationTile(t, tile); t -= delta) {
-		if (HasVehicleOnPos(t, VEH_TRAIN, nullptr, &TrainOnTileEnum)) return true;
+		tiles.push_back(t);
 	}
 	for (TileIndex t = tile + delta; IsCompatibleTrainStationTile(t, tile); t += delta) {
-		if (HasVehicleOnPos(t, VEH_TRAIN, nullptr, &TrainOnTileEnum)) return true;
+		tiles.push_back(t);
 	}
 
-	return false;
+	return HasVehicleOnTiles(tiles, VEH_TRAIN, nullptr, &TrainOnTileEnum);
 }
 
 /**
@@ -6693,7 +6701,7 @@ Money Train::GetRunningCost() const
 bool Train::Tick()
 {
 	DEBUG_UPDATESTATECHECKSUM("Train::Tick: v: %u, x: %d, y: %d, track: %d", this->index, this->x_pos, this->y_pos, this->track);
-	UpdateStateChecksum((((uint64) this->x_pos) << 32) | (this->y_pos << 16) | this->track);
+	UpdateStateChecksum((((uint64) this->x_pos) << 32) | (this->y_pos << 16) | this->track, SCA_VEHICLES);
 	if (this->IsFrontEngine()) {
 		if (!((this->vehstatus & VS_STOPPED) || this->IsWaitingInDepot()) || this->cur_speed > 0) this->running_ticks++;
 
@@ -13,8 +13,7 @@
 #include "date_type.h"
 #include "track_type.h"
 #include "tile_type.h"
-
-#include <unordered_map>
+#include "core/hashtable_map_type.hpp"
 
 struct SignalSpeedKey
 {
@@ -40,15 +39,13 @@ struct SignalSpeedKeyHashFunc
 {
 	std::size_t operator() (const SignalSpeedKey &key) const
 	{
-		const std::size_t h1 = std::hash<TileIndex>()(key.signal_tile);
-		const std::size_t h2 = std::hash<Trackdir>()(key.last_passing_train_dir);
-		const std::size_t h3 = std::hash<uint16>()(key.signal_track);
-
-		return (h1 ^ h2) ^ h3;
+		/* The fields are disjoint, so pack them into one word and mix that,
+		 * instead of xor-combining the (identity) integer hashes. */
+		return robin_hood::hash<uint64>()(((uint64)key.signal_tile << 32) | ((uint64)key.signal_track << 16) | (uint64)key.last_passing_train_dir);
 	}
 };
 
-extern std::unordered_map<SignalSpeedKey, SignalSpeedValue, SignalSpeedKeyHashFunc> _signal_speeds;
+extern HashMap<SignalSpeedKey, SignalSpeedValue, SignalSpeedKeyHashFunc> _signal_speeds;
 
 struct Train;
 void SetSignalTrainAdaptationSpeed(const Train *v, TileIndex tile, uint16 track);
@@ -1072,12 +1072,27 @@ void OnTick_Trees()
 
 	/* place a tree at a random rainforest spot */
 	if (_settings_game.game_creation.landscape == LT_TROPIC) {
-		for (uint c = ScaleByMapSize(1); c > 0; c--) {
-			if ((r = Random(), tile = RandomTileSeed(r), GetTropicZone(tile) == TROPICZONE_RAINFOREST) &&
-				CanPlantTreesOnTile(tile, false) &&
-				(tree = GetRandomTreeType(tile, GB(r, 24, 8))) != TREE_INVALID) {
-				PlantTreesOnTile(tile, tree, 0, 0);
+		/* The probes themselves draw no randomness, so the random values of a
+		 * whole batch can be drawn up front and the scattered target tiles
+		 * prefetched, without changing which tiles receive trees. */
+		static const uint BATCH = 8;
+		uint32 rs[BATCH];
+		for (uint c = ScaleByMapSize(1); c > 0; ) {
+			uint n = std::min(c, BATCH);
+			for (uint i = 0; i < n; i++) {
+				rs[i] = Random();
+				PREFETCH_NTA(_m.PrefetchPtr(RandomTileSeed(rs[i])));
 			}
+			for (uint i = 0; i < n; i++) {
+				r = rs[i];
+				tile = RandomTileSeed(r);
+				if (GetTropicZone(tile) == TROPICZONE_RAINFOREST &&
+					CanPlantTreesOnTile(tile, false) &&
+					(tree = GetRandomTreeType(tile, GB(r, 24, 8))) != TREE_INVALID) {
+					PlantTreesOnTile(tile, tree, 0, 0);
+				}
+			}
+			c -= n;
 		}
 	}
 
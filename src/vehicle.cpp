@@ -537,6 +537,56 @@ Vehicle *VehicleFromPos(TileIndex tile, VehicleType type, void *data, VehicleFro
 	return nullptr;
 }
 
+/**
+ * Helper function for FindVehicleOnTiles/HasVehicleOnTiles.
+ * This probes the tile hash for a batch of tiles at a time so that the chain
+ * head cache lines can be prefetched before the chains are walked.
+ * @note Do not call this function directly!
+ * @note For each tile, vehicles are iterated in the same order as
+ *       #VehicleFromPos would iterate them, to keep \a proc call order
+ *       deterministic.
+ * @param tiles The locations on the map
+ * @param data Arbitrary data passed to \a proc.
+ * @param proc The proc that determines whether a vehicle will be "found".
+ * @param find_first Whether to return on the first found or iterate over
+ *                   all vehicles
+ * @return the best matching or first vehicle (depending on find_first).
+ */
+Vehicle *VehicleFromTiles(span<const TileIndex> tiles, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first)
+{
+	static const uint BATCH = 8;
+
+	const TileIndex *pos = tiles.begin();
+	while (pos != tiles.end()) {
+		uint n = (uint)std::min<size_t>(BATCH, tiles.end() - pos);
+
+		Vehicle *heads[BATCH];
+		for (uint i = 0; i < n; i++) {
+			TileIndex tile = pos[i];
+			int x = GB(TileX(tile), HASH_RES, HASH_BITS);
+			int y = GB(TileY(tile), HASH_RES, HASH_BITS) << HASH_BITS;
+
+			Vehicle *head = _vehicle_tile_hash[((x + y) & TOTAL_HASH_MASK) + (TOTAL_HASH_SIZE * type)];
+			heads[i] = head;
+			if (head != nullptr) PREFETCH_NTA(&head->tile);
+		}
+
+		for (uint i = 0; i < n; i++) {
+			TileIndex tile = pos[i];
+			for (Vehicle *v = heads[i]; v != nullptr; v = v->hash_tile_next) {
+				if (v->tile != tile) continue;
+
+				Vehicle *a = proc(v, data);
+				if (find_first && a != nullptr) return a;
+			}
+		}
+
+		pos += n;
+	}
+
+	return nullptr;
+}
+
 /**
  * Callback that returns 'real' vehicles lower or at height \c *(int*)data .
  * @param v Vehicle to examine.
@@ -897,6 +947,46 @@ static void UpdateVehicleViewportHash(Vehicle *v, int x, int y)
 	}
 }
 
+/**
+ * Pending vehicle view rectangles to mark dirty, separately for effect vehicles
+ * (which are not drawn in map mode). While a vehicle tick is in progress the
+ * rectangles are aggregated here and flushed in one pass at the end of the tick,
+ * instead of walking all viewports for every single vehicle movement.
+ */
+static std::vector<Rect> _dirty_vehicle_rects[2];
+static bool _dirty_vehicle_rect_batching = false;
+
+static void AddDirtyVehicleRect(const Rect &rect, bool is_effect)
+{
+	std::vector<Rect> &rects = _dirty_vehicle_rects[is_effect ? 1 : 0];
+	if (!rects.empty()) {
+		/* The parts of an articulated vehicle are updated consecutively and their
+		 * rectangles overlap, as do repeated updates of the same vehicle: extend
+		 * the previous rectangle instead of accumulating one per part. */
+		Rect &last = rects.back();
+		if (rect.left <= last.right && rect.right >= last.left && rect.top <= last.bottom && rect.bottom >= last.top) {
+			last.left   = std::min(last.left,   rect.left);
+			last.top    = std::min(last.top,    rect.top);
+			last.right  = std::max(last.right,  rect.right);
+			last.bottom = std::max(last.bottom, rect.bottom);
+			return;
+		}
+	}
+	rects.push_back(rect);
+}
+
+static void FlushDirtyVehicleRects()
+{
+	for (const Rect &r : _dirty_vehicle_rects[0]) {
+		::MarkAllViewportsDirty(r.left, r.top, r.right, r.bottom, VMDF_NOT_LANDSCAPE);
+	}
+	for (const Rect &r : _dirty_vehicle_rects[1]) {
+		::MarkAllViewportsDirty(r.left, r.top, r.right, r.bottom, VMDF_NOT_LANDSCAPE | VMDF_NOT_MAP_MODE);
+	}
+	_dirty_vehicle_rects[0].clear();
+	_dirty_vehicle_rects[1].clear();
+}
+
 struct ViewportHashDeferredItem {
 	Vehicle *v;
 	int new_hash;
@@ -1102,6 +1192,7 @@ void Vehicle::PreDestructor()
 	if (Station::IsValidID(this->last_station_visited)) {
 		Station *st = Station::Get(this->last_station_visited);
 		st->loading_vehicles.erase(std::remove(st->loading_vehicles.begin(), st->loading_vehicles.end(), this), st->loading_vehicles.end());
+		if (st->loading_vehicles.empty()) _stations_with_loading_vehicles.erase(st->index);
 
 		HideFillingPercent(&this->fill_percent_te_id);
 		this->CancelReservation(INVALID_STATION, st);
@@ -1255,17 +1346,21 @@ void CallVehicleOnNewDay(Vehicle *v)
 
 /**
  * Increases the day counter for all vehicles and calls 1-day and 32-day handlers.
- * Each tick, it processes vehicles with "index % DAY_TICKS == _date_fract",
- * so each day, all vehicles are processes in DAY_TICKS steps.
+ * Each tick, it processes vehicles with "index % (DAY_TICKS * day length) == sub-day slot",
+ * so each day, all vehicles are processed in DAY_TICKS * day length steps.
+ * At day lengths > 1 this spreads each date fract's slice across its sub-ticks,
+ * instead of processing it as one burst on the first sub-tick.
  */
 static void RunVehicleDayProc()
 {
 	if (_game_mode != GM_NORMAL) return;
 
-	/* Run the day_proc for every DAY_TICKS vehicle starting at _date_fract. */
+	/* Run the day_proc for every DAY_TICKS * day length vehicle starting at the current sub-day slot. */
+	const size_t stride = (size_t)DAY_TICKS * _settings_game.economy.day_length_factor;
+	const size_t slot = ((size_t)_date_fract * _settings_game.economy.day_length_factor) + _tick_skip_counter;
 	Vehicle *v = nullptr;
 	SCOPE_INFO_FMT([&v], "RunVehicleDayProc: %s", scope_dumper().VehicleInfo(v));
-	for (size_t i = _date_fract; i < Vehicle::GetPoolSize(); i += DAY_TICKS) {
+	for (size_t i = slot; i < Vehicle::GetPoolSize(); i += stride) {
 		v = Vehicle::Get(i);
 		if (v == nullptr) continue;
 
@@ -1332,8 +1427,7 @@ std::vector<Aircraft *> _tick_aircraft_front_cache;
 std::vector<Ship *> _tick_ship_cache;
 std::vector<Vehicle *> _tick_other_veh_cache;
 
-std::vector<VehicleID> _remove_from_tick_effect_veh_cache;
-btree::btree_set<VehicleID> _tick_effect_veh_cache;
+std::vector<VehicleID> _tick_effect_veh_cache;
 
 void ClearVehicleTickCaches()
 {
@@ -1343,7 +1437,6 @@ void ClearVehicleTickCaches()
 	_tick_aircraft_front_cache.clear();
 	_tick_ship_cache.clear();
 	_tick_effect_veh_cache.clear();
-	_remove_from_tick_effect_veh_cache.clear();
 	_tick_other_veh_cache.clear();
 }
 
@@ -1386,7 +1479,7 @@ void RebuildVehicleTickCaches()
 				break;
 
 			case VEH_EFFECT:
-				_tick_effect_veh_cache.insert(v->index);
+				_tick_effect_veh_cache.push_back(v->index);
 				break;
 		}
 	}
@@ -1406,10 +1499,7 @@ void ValidateVehicleTickCaches()
 	std::vector<RoadVehicle *> saved_tick_road_veh_front_cache = std::move(_tick_road_veh_front_cache);
 	std::vector<Aircraft *> saved_tick_aircraft_front_cache = std::move(_tick_aircraft_front_cache);
 	std::vector<Ship *> saved_tick_ship_cache = std::move(_tick_ship_cache);
-	btree::btree_set<VehicleID> saved_tick_effect_veh_cache = std::move(_tick_effect_veh_cache);
-	for (VehicleID id : _remove_from_tick_effect_veh_cache) {
-		saved_tick_effect_veh_cache.erase(id);
-	}
+	std::vector<VehicleID> saved_tick_effect_veh_cache = std::move(_tick_effect_veh_cache);
 	std::vector<Vehicle *> saved_tick_other_veh_cache = std::move(_tick_other_veh_cache);
 	saved_tick_other_veh_cache.erase(std::remove(saved_tick_other_veh_cache.begin(), saved_tick_other_veh_cache.end(), nullptr), saved_tick_other_veh_cache.end());
 
@@ -1457,6 +1547,45 @@ void VehicleTickMotion(Vehicle *v, Vehicle *front)
 	}
 }
 
+/*
+ * Idle skip: a front vehicle parked (stopped) in a depot with no pending
+ * crash/breakdown/reversal state is known to do nothing in its Tick() handler
+ * beyond the uniform per-tick counter updates, so the movement phase can apply
+ * those updates directly and skip the handler entirely. The predicates below
+ * must exactly match the inert early-exit paths of the respective handlers;
+ * anything not provably inert falls through to a normal Tick().
+ */
+
+static bool VehicleTickIdleInDepot(const Train *t)
+{
+	if ((t->vehstatus & (VS_STOPPED | VS_CRASHED)) != VS_STOPPED || t->cur_speed != 0) return false;
+	if (t->crash_anim_pos != 0 || t->force_proceed != TFP_NONE) return false;
+	if (t->flags & ((1 << VRF_REVERSING) | (1 << VRF_CONSIST_BREAKDOWN) | (1 << VRF_TOO_HEAVY) | (1 << VRF_TRAIN_STUCK))) return false;
+	return t->IsChainInDepot();
+}
+
+static bool VehicleTickIdleInDepot(const RoadVehicle *rv)
+{
+	if ((rv->vehstatus & (VS_STOPPED | VS_CRASHED)) != VS_STOPPED || rv->cur_speed != 0) return false;
+	if (rv->breakdown_ctr != 0 || rv->reverse_ctr != 0 || rv->gcache.last_speed != 0) return false;
+	return rv->IsChainInDepot();
+}
+
+static bool VehicleTickIdleInDepot(const Ship *s)
+{
+	if ((s->vehstatus & (VS_STOPPED | VS_CRASHED)) != VS_STOPPED || s->cur_speed != 0) return false;
+	if (s->breakdown_ctr != 0) return false;
+	return s->IsChainInDepot();
+}
+
+/* Scratch lists of vehicles whose Tick() survived the current movement phase,
+ * used to batch the cheap uniform per-vehicle updates separately from movement. */
+static std::vector<Train *> _tick_train_ticked_cache;
+static std::vector<RoadVehicle *> _tick_road_veh_ticked_cache;
+static std::vector<Aircraft *> _tick_aircraft_ticked_cache;
+static std::vector<Ship *> _tick_ship_ticked_cache;
+static std::vector<StationID> _tick_loading_station_cache;
+
 void CallVehicleTicks()
 {
 	_vehicles_to_autoreplace.clear();
@@ -1464,7 +1593,10 @@ void CallVehicleTicks()
 	_vehicles_to_pay_repair.clear();
 	_vehicles_to_sell.clear();
 
-	if (_tick_skip_counter == 0) RunVehicleDayProc();
+	/* Aggregate the viewport dirty marking of all vehicle movement in this tick. */
+	_dirty_vehicle_rect_batching = true;
+
+	RunVehicleDayProc();
 
 	if (_settings_game.economy.day_length_factor >= 8 && _game_mode == GM_NORMAL) {
 		/*
@@ -1502,25 +1634,35 @@ void CallVehicleTicks()
 		PerformanceMeasurer framerate(PFE_GL_ECONOMY);
 		Station *si_st = nullptr;
 		SCOPE_INFO_FMT([&si_st], "CallVehicleTicks: LoadUnloadStation: %s", scope_dumper().StationInfo(si_st));
-		for (Station *st : Station::Iterate()) {
+		/* Only stations with loading vehicles are of interest, and the set is in
+		 * station index order, i.e. the same order as iterating all stations.
+		 * Iterate over a copy as LoadUnloadStation may alter the set. */
+		_tick_loading_station_cache.assign(_stations_with_loading_vehicles.begin(), _stations_with_loading_vehicles.end());
+		/* No order list is modified while loading/unloading, so next stopping
+		 * station results may be shared between vehicles with shared orders. */
+		SetNextStoppingStationCacheEnabled(true);
+		for (StationID sid : _tick_loading_station_cache) {
+			Station *st = Station::GetIfValid(sid);
+			if (st == nullptr) continue;
 			si_st = st;
 			LoadUnloadStation(st);
 		}
+		SetNextStoppingStationCacheEnabled(false);
 	}
 
 	if (!_tick_caches_valid || HasChickenBit(DCBF_VEH_TICK_CACHE)) RebuildVehicleTickCaches();
 
+	const bool skip_idle_vehicles = !HasChickenBit(DCBF_VEH_TICK_IDLE_SKIP);
+
 	Vehicle *v = nullptr;
 	SCOPE_INFO_FMT([&v], "CallVehicleTicks: %s", scope_dumper().VehicleInfo(v));
 	{
-		for (VehicleID id : _remove_from_tick_effect_veh_cache) {
-			_tick_effect_veh_cache.erase(id);
-		}
-		_remove_from_tick_effect_veh_cache.clear();
-		for (VehicleID id : _tick_effect_veh_cache) {
-			EffectVehicle *u = EffectVehicle::Get(id);
+		/* Effect vehicles tick from an id-sorted array; a particle that
+		 * expires erases itself, shifting the next id into position i. */
+		for (size_t i = 0; i < _tick_effect_veh_cache.size();) {
+			EffectVehicle *u = EffectVehicle::Get(_tick_effect_veh_cache[i]);
 			v = u;
-			u->EffectVehicle::Tick();
+			if (u->EffectVehicle::Tick()) i++;
 		}
 	}
 	{
@@ -1536,9 +1678,25 @@ void CallVehicleTicks()
 			}
 		}
 		_tick_train_too_heavy_cache.clear();
+
+		/* Movement phase: run the heavyweight per-chain Tick() handlers first
+		 * and collect the fronts which survived them. The cheap uniform
+		 * per-vehicle updates (tick counter, cargo ageing, motion counter and
+		 * running sounds) then run as a second batched walk over the surviving
+		 * chains, away from the scattered map accesses of the movement code. */
+		_tick_train_ticked_cache.clear();
 		for (Train *front : _tick_train_front_cache) {
 			v = front;
-			if (!front->Train::Tick()) continue;
+			if (skip_idle_vehicles && VehicleTickIdleInDepot(front)) {
+				/* Tick() would only do this and the batched updates below. */
+				front->current_order_time++;
+				_tick_train_ticked_cache.push_back(front);
+				continue;
+			}
+			if (front->Train::Tick()) _tick_train_ticked_cache.push_back(front);
+		}
+		for (Train *front : _tick_train_ticked_cache) {
+			v = front;
 			for (Train *u = front; u != nullptr; u = u->Next()) {
 				u->tick_counter++;
 				VehicleTickCargoAging(u);
@@ -1548,9 +1706,19 @@ void CallVehicleTicks()
 	}
 	{
 		PerformanceMeasurer framerate(PFE_GL_ROADVEHS);
+		_tick_road_veh_ticked_cache.clear();
 		for (RoadVehicle *front : _tick_road_veh_front_cache) {
 			v = front;
-			if (!front->RoadVehicle::Tick()) continue;
+			if (skip_idle_vehicles && VehicleTickIdleInDepot(front)) {
+				/* Tick() would only do this and the batched updates below. */
+				front->current_order_time++;
+				_tick_road_veh_ticked_cache.push_back(front);
+				continue;
+			}
+			if (front->RoadVehicle::Tick()) _tick_road_veh_ticked_cache.push_back(front);
+		}
+		for (RoadVehicle *front : _tick_road_veh_ticked_cache) {
+			v = front;
 			for (RoadVehicle *u = front; u != nullptr; u = u->Next()) {
 				u->tick_counter++;
 				VehicleTickCargoAging(u);
@@ -1560,9 +1728,13 @@ void CallVehicleTicks()
 	}
 	{
 		PerformanceMeasurer framerate(PFE_GL_AIRCRAFT);
+		_tick_aircraft_ticked_cache.clear();
 		for (Aircraft *front : _tick_aircraft_front_cache) {
 			v = front;
-			if (!front->Aircraft::Tick()) continue;
+			if (front->Aircraft::Tick()) _tick_aircraft_ticked_cache.push_back(front);
+		}
+		for (Aircraft *front : _tick_aircraft_ticked_cache) {
+			v = front;
 			for (Aircraft *u = front; u != nullptr; u = u->Next()) {
 				VehicleTickCargoAging(u);
 			}
@@ -1571,9 +1743,20 @@ void CallVehicleTicks()
 	}
 	{
 		PerformanceMeasurer framerate(PFE_GL_SHIPS);
+		_tick_ship_ticked_cache.clear();
 		for (Ship *s : _tick_ship_cache) {
 			v = s;
-			if (!s->Ship::Tick()) continue;
+			if (skip_idle_vehicles && VehicleTickIdleInDepot(s)) {
+				/* Tick() would only do this and the batched updates below. */
+				s->tick_counter++;
+				s->current_order_time++;
+				_tick_ship_ticked_cache.push_back(s);
+				continue;
+			}
+			if (s->Ship::Tick()) _tick_ship_ticked_cache.push_back(s);
+		}
+		for (Ship *s : _tick_ship_ticked_cache) {
+			v = s;
 			for (Ship *u = s; u != nullptr; u = u->Next()) {
 				VehicleTickCargoAging(u);
 			}
@@ -1742,6 +1925,9 @@ void CallVehicleTicks()
 	}
 	repair_cur_company.Restore();
 	_vehicles_to_pay_repair.clear();
+
+	_dirty_vehicle_rect_batching = false;
+	FlushDirtyVehicleRects();
 }
 
 void RemoveVirtualTrainsOfUser(uint32 user)
@@ -2252,7 +2438,7 @@ bool Vehicle::HandleBreakdown()
 						default: NOT_REACHED();
 					}
 					this->First()->MarkDirty();
-					SetWindowDirty(WC_VEHICLE_VIEW, this->index);
+					SetWindowWidgetDirty(WC_VEHICLE_VIEW, this->index, WID_VV_START_STOP);
 					SetWindowDirty(WC_VEHICLE_DETAILS, this->index);
 				} else {
 					this->breakdown_ctr = 2; // wait until slowdown
@@ -2306,7 +2492,7 @@ bool Vehicle::HandleBreakdown()
 					if (u != nullptr) u->animation_state = 25;
 				}
 				this->First()->MarkDirty();
-				SetWindowDirty(WC_VEHICLE_VIEW, this->index);
+				SetWindowWidgetDirty(WC_VEHICLE_VIEW, this->index, WID_VV_START_STOP);
 				SetWindowDirty(WC_VEHICLE_DETAILS, this->index);
 				return (this->breakdown_type == BREAKDOWN_CRITICAL || this->breakdown_type == BREAKDOWN_EM_STOP);
 			}
@@ -2323,10 +2509,10 @@ bool Vehicle::HandleBreakdown()
 					if (this->type == VEH_TRAIN) {
 						CheckBreakdownFlags(Train::From(this->First()));
 						this->First()->MarkDirty();
-						SetWindowDirty(WC_VEHICLE_VIEW, this->First()->index);
+						SetWindowWidgetDirty(WC_VEHICLE_VIEW, this->First()->index, WID_VV_START_STOP);
 					} else {
 						this->MarkDirty();
-						SetWindowDirty(WC_VEHICLE_VIEW, this->index);
+						SetWindowWidgetDirty(WC_VEHICLE_VIEW, this->index, WID_VV_START_STOP);
 					}
 				}
 			}
@@ -2651,13 +2837,18 @@ void Vehicle::UpdateViewport(bool dirty)
 		if (old_coord.left == INVALID_COORD) {
 			this->MarkAllViewportsDirty();
 		} else {
-			::MarkAllViewportsDirty(
+			const Rect rect = {
 					std::min(old_coord.left,   this->coord.left),
 					std::min(old_coord.top,    this->coord.top),
 					std::max(old_coord.right,  this->coord.right),
-					std::max(old_coord.bottom, this->coord.bottom),
-					VMDF_NOT_LANDSCAPE | (this->type != VEH_EFFECT ? VMDF_NONE : VMDF_NOT_MAP_MODE)
-			);
+					std::max(old_coord.bottom, this->coord.bottom)
+			};
+			if (_dirty_vehicle_rect_batching) {
+				AddDirtyVehicleRect(rect, this->type == VEH_EFFECT);
+			} else {
+				::MarkAllViewportsDirty(rect.left, rect.top, rect.right, rect.bottom,
+						VMDF_NOT_LANDSCAPE | (this->type != VEH_EFFECT ? VMDF_NONE : VMDF_NOT_MAP_MODE));
+			}
 		}
 	}
 }
@@ -2691,6 +2882,10 @@ void Vehicle::UpdatePositionAndViewport()
  */
 void Vehicle::MarkAllViewportsDirty() const
 {
+	if (_dirty_vehicle_rect_batching && this->coord.left != INVALID_COORD) {
+		AddDirtyVehicleRect(this->coord, this->type == VEH_EFFECT);
+		return;
+	}
 	::MarkAllViewportsDirty(this->coord.left, this->coord.top, this->coord.right, this->coord.bottom, VMDF_NOT_LANDSCAPE | (this->type != VEH_EFFECT ? VMDF_NONE : VMDF_NOT_MAP_MODE));
 }
 
@@ -3424,6 +3619,7 @@ void Vehicle::LeaveStation()
 	Station *st = Station::Get(this->last_station_visited);
 	this->CancelReservation(INVALID_STATION, st);
 	st->loading_vehicles.erase(std::remove(st->loading_vehicles.begin(), st->loading_vehicles.end(), this), st->loading_vehicles.end());
+	if (st->loading_vehicles.empty()) _stations_with_loading_vehicles.erase(st->index);
 
 	HideFillingPercent(&this->fill_percent_te_id);
 	trip_occupancy = CalcPercentVehicleFilled(this, nullptr);
@@ -283,6 +283,11 @@ public:
 
 	static void PreCleanPool();
 
+	/* The fields below are grouped by access pattern: the state read and
+	 * written by the per-tick movement code comes first so that it shares as
+	 * few cache lines as possible, state which is only touched on events
+	 * (loading, breakdowns, aging) or by the GUI comes last. */
+
 	TileIndex tile;                     ///< Current tile index
 
 	/**
@@ -292,47 +297,23 @@ public:
 	 */
 	TileIndex dest_tile;
 
-	Money profit_this_year;             ///< Profit this year << 8, low 8 bits are fract
-	Money profit_last_year;             ///< Profit last year << 8, low 8 bits are fract
-	Money profit_lifetime;              ///< Profit lifetime << 8, low 8 bits are fract
-	Money value;                        ///< Value of the vehicle
-
-	CargoPayment *cargo_payment;        ///< The cargo payment we're currently in
-
-	/* Used for timetabling. */
-	uint32 current_loading_time;        ///< How long loading took. Less than current_order_time if vehicle is early.
-
-	Rect coord;                         ///< NOSAVE: Graphical bounding box of the vehicle, i.e. what to redraw on moves.
-
-	Vehicle *hash_viewport_next;        ///< NOSAVE: Next vehicle in the visual location hash.
-	Vehicle **hash_viewport_prev;       ///< NOSAVE: Previous vehicle in the visual location hash.
-
-	Vehicle *hash_tile_next;            ///< NOSAVE: Next vehicle in the tile location hash.
-	Vehicle **hash_tile_prev;           ///< NOSAVE: Previous vehicle in the tile location hash.
-	Vehicle **hash_tile_current;        ///< NOSAVE: Cache of the current hash chain.
-
-	byte breakdown_severity;            ///< severity of the breakdown. Note that lower means more severe
-	byte breakdown_type;                ///< Type of breakdown
-	byte breakdown_chance_factor;       ///< Improved breakdowns: current multiplier for breakdown_chance * 128, used for head vehicle only
-	SpriteID colourmap;                 ///< NOSAVE: cached colour mapping
-
-	/* Related to age and service time */
-	Year build_year;                    ///< Year the vehicle has been built.
-	Date age;                           ///< Age in days
-	Date max_age;                       ///< Maximum age
-	Date date_of_last_service;          ///< Last date the vehicle had a service at a depot.
-	uint16 reliability;                 ///< Reliability.
-	uint16 reliability_spd_dec;         ///< Reliability decrease speed.
-	byte breakdown_ctr;                 ///< Counter for managing breakdown events. @see Vehicle::HandleBreakdown
-	byte breakdown_delay;               ///< Counter for managing breakdown length.
-	byte breakdowns_since_last_service; ///< Counter for the amount of breakdowns.
-	byte breakdown_chance;              ///< Current chance of breakdowns.
-
 	int32 x_pos;                        ///< x coordinate.
 	int32 y_pos;                        ///< y coordinate.
 	int32 z_pos;                        ///< z coordinate.
 	Direction direction;                ///< facing
 
+	byte vehstatus;                     ///< Status
+	byte day_counter;                   ///< Increased by one for each day
+	byte tick_counter;                  ///< Increased by one for each tick
+	uint16 running_ticks;               ///< Number of ticks this vehicle was not stopped this day
+
+	uint16 cur_speed;                   ///< current speed
+	byte subspeed;                      ///< fractional speed
+	byte acceleration;                  ///< used by train & aircraft
+	byte progress;                      ///< The percentage (if divided by 256) this vehicle already crossed the tile unit.
+	byte breakdown_ctr;                 ///< Counter for managing breakdown events. @see Vehicle::HandleBreakdown
+	uint32 motion_counter;              ///< counter to occasionally play a vehicle sound. (Also used as virtual train client ID).
+
 	Owner owner;                        ///< Which company owns the vehicle?
 	/**
 	 * currently displayed sprite index
@@ -349,38 +330,21 @@ public:
 	int8 y_bb_offs;                     ///< y offset of vehicle bounding box
 	int8 x_offs;                        ///< x offset for vehicle sprite
 	int8 y_offs;                        ///< y offset for vehicle sprite
+	Direction cur_image_valid_dir;      ///< NOSAVE: direction for which cur_image does not need to be regenerated on the next tick
 	EngineID engine_type;               ///< The type of engine used for this vehicle.
 
-	TextEffectID fill_percent_te_id;    ///< a text-effect id to a loading indicator object
-	UnitID unitnumber;                  ///< unit number, for display purposes only
+	Vehicle *hash_tile_next;            ///< NOSAVE: Next vehicle in the tile location hash.
+	Vehicle **hash_tile_prev;           ///< NOSAVE: Previous vehicle in the tile location hash.
+	Vehicle **hash_tile_current;        ///< NOSAVE: Cache of the current hash chain.
 
-	uint16 cur_speed;                   ///< current speed
-	byte subspeed;                      ///< fractional speed
-	byte acceleration;                  ///< used by train & aircraft
-	uint32 motion_counter;              ///< counter to occasionally play a vehicle sound. (Also used as virtual train client ID).
-	byte progress;                      ///< The percentage (if divided by 256) this vehicle already crossed the tile unit.
+	Vehicle *hash_viewport_next;        ///< NOSAVE: Next vehicle in the visual location hash.
+	Vehicle **hash_viewport_prev;       ///< NOSAVE: Previous vehicle in the visual location hash.
+
+	Rect coord;                         ///< NOSAVE: Graphical bounding box of the vehicle, i.e. what to redraw on moves.
 
 	byte random_bits;                   ///< Bits used for determining which randomized variational spritegroups to use when drawing.
 	byte waiting_triggers;              ///< Triggers to be yet matched before rerandomizing the random bits.
 
-	StationID last_station_visited;     ///< The last station we stopped at.
-	StationID last_loading_station;     ///< Last station the vehicle has stopped at and could possibly leave from with any cargo loaded. (See VF_LAST_LOAD_ST_SEP).
-	uint64 last_loading_tick;           ///< Last time (relative to _scaled_tick_counter) the vehicle has stopped at a station and could possibly leave with any cargo loaded. (See VF_LAST_LOAD_ST_SEP).
-
-	CargoID cargo_type;                 ///< type of cargo this vehicle is carrying
-	byte cargo_subtype;                 ///< Used for livery refits (NewGRF variations)
-	uint16 cargo_cap;                   ///< total capacity
-	uint16 refit_cap;                   ///< Capacity left over from before last refit.
-	VehicleCargoList cargo;             ///< The cargo this vehicle is carrying
-	uint16 cargo_age_counter;           ///< Ticks till cargo is aged next.
-	int8 trip_occupancy;                ///< NOSAVE: Occupancy of vehicle of the current trip (updated after leaving a station).
-
-	byte day_counter;                   ///< Increased by one for each day
-	byte tick_counter;                  ///< Increased by one for each tick
-	uint16 running_ticks;               ///< Number of ticks this vehicle was not stopped this day
-
-	byte vehstatus;                     ///< Status
-
 	uint8 order_occupancy_average;      ///< NOSAVE: order occupancy average. 0 = invalid, 1 = n/a, 16-116 = 0-100%
 	Order current_order;                ///< The current order (+ status, like: loading)
 
@@ -392,11 +356,54 @@ public:
 	uint16 load_unload_ticks;           ///< Ticks to wait before starting next cycle.
 	GroupID group_id;                   ///< Index of group Pool array
 	byte subtype;                       ///< subtype (Filled with values from #AircraftSubType/#DisasterSubType/#EffectVehicleType/#GroundVehicleSubtypeFlags)
-	Direction cur_image_valid_dir;      ///< NOSAVE: direction for which cur_image does not need to be regenerated on the next tick
+
+	CargoID cargo_type;                 ///< type of cargo this vehicle is carrying
+	byte cargo_subtype;                 ///< Used for livery refits (NewGRF variations)
+	uint16 cargo_cap;                   ///< total capacity
+	uint16 refit_cap;                   ///< Capacity left over from before last refit.
+	VehicleCargoList cargo;             ///< The cargo this vehicle is carrying
+	uint16 cargo_age_counter;           ///< Ticks till cargo is aged next.
+	int8 trip_occupancy;                ///< NOSAVE: Occupancy of vehicle of the current trip (updated after leaving a station).
 
 	NewGRFCache grf_cache;              ///< Cache of often used calculated NewGRF values
 	VehicleCache vcache;                ///< Cache of often used vehicle values.
 
+	/* The fields below are only touched on events (loading, breakdowns,
+	 * servicing, economy days) or for the GUI, not by per-tick movement. */
+
+	StationID last_station_visited;     ///< The last station we stopped at.
+	StationID last_loading_station;     ///< Last station the vehicle has stopped at and could possibly leave from with any cargo loaded. (See VF_LAST_LOAD_ST_SEP).
+	uint64 last_loading_tick;           ///< Last time (relative to _scaled_tick_counter) the vehicle has stopped at a station and could possibly leave with any cargo loaded. (See VF_LAST_LOAD_ST_SEP).
+
+	Money profit_this_year;             ///< Profit this year << 8, low 8 bits are fract
+	Money profit_last_year;             ///< Profit last year << 8, low 8 bits are fract
+	Money profit_lifetime;              ///< Profit lifetime << 8, low 8 bits are fract
+	Money value;                        ///< Value of the vehicle
+
+	CargoPayment *cargo_payment;        ///< The cargo payment we're currently in
+
+	/* Used for timetabling. */
+	uint32 current_loading_time;        ///< How long loading took. Less than current_order_time if vehicle is early.
+
+	byte breakdown_severity;            ///< severity of the breakdown. Note that lower means more severe
+	byte breakdown_type;                ///< Type of breakdown
+	byte breakdown_chance_factor;       ///< Improved breakdowns: current multiplier for breakdown_chance * 128, used for head vehicle only
+	byte breakdown_delay;               ///< Counter for managing breakdown length.
+	byte breakdowns_since_last_service; ///< Counter for the amount of breakdowns.
+	byte breakdown_chance;              ///< Current chance of breakdowns.
+	SpriteID colourmap;                 ///< NOSAVE: cached colour mapping
+
+	/* Related to age and service time */
+	Year build_year;                    ///< Year the vehicle has been built.
+	Date age;                           ///< Age in days
+	Date max_age;                       ///< Maximum age
+	Date date_of_last_service;          ///< Last date the vehicle had a service at a depot.
+	uint16 reliability;                 ///< Reliability.
+	uint16 reliability_spd_dec;         ///< Reliability decrease speed.
+
+	TextEffectID fill_percent_te_id;    ///< a text-effect id to a loading indicator object
+	UnitID unitnumber;                  ///< unit number, for display purposes only
+
 	/**
 	 * Calculates the weight value that this vehicle will have when fully loaded with its current cargo.
 	 * @return Weight value in tonnes.
@@ -1818,7 +1818,7 @@ CommandCost CmdRenameVehicle(TileIndex tile, DoCommandFlag flags, uint32 p1, uin
 		} else {
 			v->name = text;
 		}
-		InvalidateWindowClassesData(GetWindowClassForVehicleType(v->type), 1);
+		InvalidateWindowClassesData(GetWindowClassForVehicleType(v->type), VIWD_VEHICLE_DIRTY | v->index);
 		InvalidateWindowClassesData(WC_DEPARTURES_BOARD, 0);
 		MarkWholeScreenDirty();
 	}
@@ -20,6 +20,7 @@
 #include "track_type.h"
 #include "livery.h"
 #include "cargo_type.h"
+#include "core/span_type.hpp"
 
 #define is_custom_sprite(x) (x >= 0xFD)
 #define IS_CUSTOM_FIRSTHEAD_SPRITE(x) (x == 0xFD)
@@ -79,6 +80,41 @@ inline bool HasVehicleOnPos(TileIndex tile, VehicleType type, void *data, Vehicl
 	return VehicleFromPos(tile, type, data, proc, true) != nullptr;
 }
 
+/**
+ * Find a vehicle from several specific locations at once. It will call \a proc
+ * for ALL vehicles on the tiles and YOU must make SURE that the "best one" is
+ * stored in the data value and is ALWAYS the same regardless of the order of
+ * the vehicles where proc was called on!
+ * When you fail to do this properly you create an almost untraceable DESYNC!
+ * @note The return value of \a proc will be ignored.
+ * @note Equivalent to calling #FindVehicleOnPos for each tile in order, but
+ *       the hash probes of all tiles are batched/overlapped.
+ * @param tiles The locations on the map
+ * @param data Arbitrary data passed to \a proc.
+ * @param proc The proc that determines whether a vehicle will be "found".
+ */
+inline void FindVehicleOnTiles(span<const TileIndex> tiles, VehicleType type, void *data, VehicleFromPosProc *proc)
+{
+	extern Vehicle *VehicleFromTiles(span<const TileIndex> tiles, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first);
+	VehicleFromTiles(tiles, type, data, proc, false);
+}
+
+/**
+ * Checks whether a vehicle is on any of several specific locations. It will
+ * call \a proc for vehicles until it returns non-nullptr.
+ * @note Use #FindVehicleOnTiles when you have the intention that all vehicles
+ *       should be iterated over.
+ * @param tiles The locations on the map
+ * @param data Arbitrary data passed to \a proc.
+ * @param proc The \a proc that determines whether a vehicle will be "found".
+ * @return True if proc returned non-nullptr.
+ */
+inline bool HasVehicleOnTiles(span<const TileIndex> tiles, VehicleType type, void *data, VehicleFromPosProc *proc)
+{
+	extern Vehicle *VehicleFromTiles(span<const TileIndex> tiles, VehicleType type, void *data, VehicleFromPosProc *proc, bool find_first);
+	return VehicleFromTiles(tiles, type, data, proc, true) != nullptr;
+}
+
 /**
  * Find a vehicle from a specific location. It will call proc for ALL vehicles
  * on the tile and YOU must make SURE that the "best one" is stored in the
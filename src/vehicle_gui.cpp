@@ -271,6 +271,9 @@ void BaseVehicleListWindow::BuildVehicleList()
 	this->FilterVehicleList();
 	this->CountOwnVehicles();
 
+	/* The rebuild is followed by a full resort anyway. */
+	this->dirty_vehicles.clear();
+
 	this->vehgroups.RebuildDone();
 	this->vscroll->SetCount(static_cast<int>(this->vehgroups.size()));
 }
@@ -444,17 +447,47 @@ DropDownList BaseVehicleListWindow::BuildActionDropdownList(bool show_autoreplac
 	return list;
 }
 
-/* cached values for VehicleNameSorter to spare many GetString() calls */
-static const Vehicle *_last_vehicle[2] = { nullptr, nullptr };
+/* cached vehicle names for VehicleNameSorter to spare many GetString() calls */
+static btree::btree_map<VehicleID, std::string> _vehicle_name_sorter_names;
 
 static btree::btree_map<VehicleID, int> _vehicle_max_speed_loaded;
 
+/**
+ * Handle a window invalidation that identifies a single changed vehicle.
+ * The vehicle is remembered for an incremental resort instead of re-sorting the whole list.
+ * @param data The data parameter of OnInvalidateData.
+ * @return true if \a data identified a single vehicle, so no full resort is needed.
+ */
+bool BaseVehicleListWindow::HandleVehicleDirtyInvalidation(int data)
+{
+	if (data <= 0 || (data & VIWD_VEHICLE_DIRTY) == 0) return false;
+
+	this->dirty_vehicles.insert((VehicleID)GB(data, 0, 20));
+	this->vehgroups.ForcePartialResort();
+	return true;
+}
+
 void BaseVehicleListWindow::SortVehicleList()
 {
+	if (!this->dirty_vehicles.empty()) {
+		/* invalidate cached values for name sorter - the dirtied vehicles may have been renamed */
+		for (VehicleID id : this->dirty_vehicles) _vehicle_name_sorter_names.erase(id);
+		_vehicle_max_speed_loaded.clear();
+
+		this->vehgroups.Sort(this->GetVehicleSorterFuncs()[this->vehgroups.SortType()], [this](const GUIVehicleGroup &group) {
+			for (auto it = group.vehicles_begin; it != group.vehicles_end; ++it) {
+				if (this->dirty_vehicles.count((*it)->index) != 0) return true;
+			}
+			return false;
+		});
+		this->dirty_vehicles.clear();
+		return;
+	}
+
 	if (this->vehgroups.Sort()) return;
 
 	/* invalidate cached values for name sorter - vehicle names could change */
-	_last_vehicle[0] = _last_vehicle[1] = nullptr;
+	_vehicle_name_sorter_names.clear();
 	_vehicle_max_speed_loaded.clear();
 }
 
@@ -1541,24 +1574,23 @@ static bool VehicleNumberSorter(const Vehicle * const &a, const Vehicle * const
 	return a->unitnumber < b->unitnumber;
 }
 
-/** Sort vehicles by their name */
-static bool VehicleNameSorter(const Vehicle * const &a, const Vehicle * const &b)
+/** Get the name of a vehicle for sorting purposes, formatting and caching it on first use. */
+static const std::string &GetVehicleSorterName(const Vehicle *v)
 {
-	static char last_name[2][64];
-
-	if (a != _last_vehicle[0]) {
-		_last_vehicle[0] = a;
-		SetDParam(0, a->index);
-		GetString(last_name[0], STR_VEHICLE_NAME, lastof(last_name[0]));
-	}
-
-	if (b != _last_vehicle[1]) {
-		_last_vehicle[1] = b;
-		SetDParam(0, b->index);
-		GetString(last_name[1], STR_VEHICLE_NAME, lastof(last_name[1]));
+	auto iter = _vehicle_name_sorter_names.lower_bound(v->index);
+	if (iter == _vehicle_name_sorter_names.end() || iter->first != v->index) {
+		char buf[64];
+		SetDParam(0, v->index);
+		GetString(buf, STR_VEHICLE_NAME, lastof(buf));
+		iter = _vehicle_name_sorter_names.insert(iter, std::make_pair(v->index, std::string(buf)));
 	}
+	return iter->second;
+}
 
-	int r = strnatcmp(last_name[0], last_name[1]); // Sort by name (natural sorting).
+/** Sort vehicles by their name */
+static bool VehicleNameSorter(const Vehicle * const &a, const Vehicle * const &b)
+{
+	int r = strnatcmp(GetVehicleSorterName(a).c_str(), GetVehicleSorterName(b).c_str()); // Sort by name (natural sorting).
 	return (r != 0) ? r < 0: VehicleNumberSorter(a, b);
 }
 
@@ -1711,7 +1743,7 @@ static inline void ChangeVehicleWindow(WindowClass window_class, VehicleID from_
 	Window *w = FindWindowById(window_class, from_index);
 	if (w != nullptr) {
 		/* Update window_number */
-		w->window_number = to_index;
+		w->ChangeWindowNumber(to_index);
 		if (w->viewport != nullptr) w->viewport->follow_vehicle = to_index;
 
 		/* Update vehicle drag data */
@@ -2661,7 +2693,7 @@ public:
 		if (!gui_scope && HasBit(data, 31) && this->vli.type == VL_SHARED_ORDERS) {
 			/* Needs to be done in command-scope, so everything stays valid */
 			this->vli.index = GB(data, 0, 20);
-			this->window_number = this->vli.Pack();
+			this->ChangeWindowNumber(this->vli.Pack());
 			this->vehgroups.ForceRebuild();
 			return;
 		}
@@ -2673,7 +2705,7 @@ public:
 				delete this;
 				return;
 			}
-		} else {
+		} else if (!this->HandleVehicleDirtyInvalidation(data)) {
 			this->vehgroups.ForceResort();
 		}
 
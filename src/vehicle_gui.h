@@ -36,6 +36,14 @@ enum VehicleInvalidateWindowData {
 	VIWD_AUTOREPLACE       = -4, ///< Autoreplace replaced the vehicle.
 };
 
+/**
+ * Flag bit for the data parameter of #InvalidateWindowData of vehicle list windows:
+ * the displayed properties (e.g. the name) of a single vehicle changed, the low 20 bits
+ * hold its vehicle index. Lists restore their sorted order incrementally for these
+ * instead of performing a full resort.
+ */
+static const int VIWD_VEHICLE_DIRTY = 1 << 30;
+
 /** Extra information about refitted cargo and capacity */
 struct TestedEngineDetails {
 	Money cost;           ///< Refit cost
@@ -19,6 +19,7 @@
 #include "window_gui.h"
 #include "widgets/dropdown_type.h"
 #include "cargo_type.h"
+#include "3rdparty/cpp-btree/btree_set.h"
 #include <iterator>
 #include <numeric>
 
@@ -82,6 +83,7 @@ public:
 	uint own_vehicles = 0;                    ///< Count of vehicles of the local company
 	CompanyID own_company;                    ///< Company ID used for own_vehicles
 	GUIVehicleGroupList vehgroups;            ///< List of (groups of) vehicles.  This stores iterators of `vehicles`, and should be rebuilt if `vehicles` is structurally changed.
+	btree::btree_set<VehicleID> dirty_vehicles; ///< Vehicles whose displayed properties changed since the last sort, for incremental resorting.
 	Listing *sorting;                         ///< Pointer to the vehicle type related sorting.
 	byte unitnumber_digits;                   ///< The number of digits of the highest unit number.
 	Scrollbar *vscroll;
@@ -131,6 +133,7 @@ public:
 
 	void DrawVehicleListItems(VehicleID selected_vehicle, int line_height, const Rect &r) const;
 	void UpdateVehicleGroupBy(GroupBy group_by);
+	bool HandleVehicleDirtyInvalidation(int data);
 	void SortVehicleList();
 	void CountOwnVehicles();
 	void BuildVehicleList();
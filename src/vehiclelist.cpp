@@ -11,6 +11,7 @@
 #include "train.h"
 #include "vehiclelist.h"
 #include "group.h"
+#include "order_base.h"
 #include "tracerestrict.h"
 
 #include "safeguards.h"
@@ -164,6 +165,18 @@ bool GenerateVehicleSortList(VehicleList *list, const VehicleListIdentifier &vli
 
 	switch (vli.type) {
 		case VL_STATION_LIST:
+			if (_order_destination_refcount_map_valid) {
+				/* Enumerate only the order lists known to contain an order to this station,
+				 * instead of scanning every vehicle's orders. */
+				IterateOrderListsForDestinationID(vli.index, vli.vtype, [&](OrderListID id) {
+					const OrderList *orders = OrderList::GetIfValid(id);
+					if (orders == nullptr) return;
+					for (const Vehicle *v = orders->GetFirstSharedVehicle(); v != nullptr; v = v->NextShared()) {
+						if (v->IsPrimaryVehicle()) add_veh(v);
+					}
+				});
+				break;
+			}
 			for (const Vehicle *v : Vehicle::Iterate()) {
 				if (v->type == vli.vtype && v->IsPrimaryVehicle()) {
 					for (const Order *order : v->Orders()) {
@@ -39,6 +39,8 @@ public:
 	bool HasAnimBuffer() override { return true; }
 	uint8 *GetAnimBuffer() override { return this->anim_buffer; }
 
+	void MakeDirty(int left, int top, int width, int height) override;
+
 	/** Return driver name */
 	const char *GetName() const override { return "cocoa-opengl"; }
 
@@ -235,6 +235,13 @@ void VideoDriver_CocoaOpenGL::Stop()
 	CGLReleaseContext(this->gl_context);
 }
 
+void VideoDriver_CocoaOpenGL::MakeDirty(int left, int top, int width, int height)
+{
+	this->VideoDriver_Cocoa::MakeDirty(left, top, width, height);
+	/* Also record the individual rect with the back-end for per-rect texture uploads. */
+	if (OpenGLBackend::Get() != nullptr) OpenGLBackend::Get()->MakeDirty(left, top, width, height);
+}
+
 void VideoDriver_CocoaOpenGL::PopulateSystemSprites()
 {
 	VideoDriver_Cocoa::PopulateSystemSprites();
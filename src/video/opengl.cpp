@@ -132,6 +132,9 @@ struct Simple2DVertex {
 /** Maximum number of cursor sprites to cache. */
 static const int MAX_CACHED_CURSORS = 48;
 
+/** Maximum number of damage rectangles to track before falling back to a bounding rectangle upload. */
+static const size_t MAX_DIRTY_RECTS = 100;
+
 /* static */ OpenGLBackend *OpenGLBackend::instance = nullptr;
 
 GetOGLProcAddressProc GetOGLProcAddress;
@@ -924,6 +927,10 @@ bool OpenGLBackend::Resize(int w, int h, bool force)
 
 	_glPixelStorei(GL_UNPACK_ROW_LENGTH, pitch);
 
+	/* The whole buffer is re-uploaded on resize, forget any recorded damage. */
+	this->dirty_rects.clear();
+	this->dirty_rect_overflow = false;
+
 	this->vid_buffer = nullptr;
 	if (this->persistent_mapping_supported) {
 		_glDeleteBuffers(1, &this->vid_pbo);
@@ -1149,6 +1156,45 @@ void OpenGLBackend::ClearCursorCache()
 	this->clear_cursor_cache = true;
 }
 
+/**
+ * Record a damaged region of the video buffer for the next texture upload.
+ *
+ * Tracking the individual rectangles allows small UI updates to upload only
+ * the changed pixels instead of the whole bounding rectangle of all changes.
+ * If too many rectangles accumulate, the next upload falls back to the
+ * bounding rectangle passed to ReleaseVideoBuffer().
+ * @param left Left edge of the damaged region.
+ * @param top Top edge of the damaged region.
+ * @param width Width of the damaged region.
+ * @param height Height of the damaged region.
+ */
+void OpenGLBackend::MakeDirty(int left, int top, int width, int height)
+{
+	if (this->dirty_rect_overflow) return;
+
+	if (this->dirty_rects.size() >= MAX_DIRTY_RECTS) {
+		this->dirty_rects.clear();
+		this->dirty_rect_overflow = true;
+		return;
+	}
+
+	this->dirty_rects.push_back({ left, top, left + width, top + height });
+}
+
+/**
+ * Upload a rectangle of the bound pixel buffer to the bound texture.
+ * @param update_rect Region of the buffer to upload.
+ * @param bpp Bits per pixel of the buffer, either 8 or 32.
+ */
+static void UpdateTextureRect(const Rect &update_rect, int bpp)
+{
+	if (bpp == 8) {
+		_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_RED, GL_UNSIGNED_BYTE, (GLvoid *)(size_t)(update_rect.top * _screen.pitch + update_rect.left));
+	} else {
+		_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid *)(size_t)(update_rect.top * _screen.pitch * 4 + update_rect.left * 4));
+	}
+}
+
 /**
  * Get a pointer to the memory for the video driver to draw to.
  * @return Pointer to draw on.
@@ -1196,6 +1242,11 @@ uint8 *OpenGLBackend::GetAnimBuffer()
 
 /**
  * Update video buffer texture after the video buffer was filled.
+ *
+ * If damage rectangles were recorded with MakeDirty(), only those regions are
+ * uploaded; otherwise the whole of \a update_rect is. The recorded damage is
+ * consumed by this call, so when a separate animation buffer is in use,
+ * ReleaseAnimBuffer() has to be called first.
  * @param update_rect Rectangle encompassing the dirty region of the video buffer.
  */
 void OpenGLBackend::ReleaseVideoBuffer(const Rect &update_rect)
@@ -1215,25 +1266,35 @@ void OpenGLBackend::ReleaseVideoBuffer(const Rect &update_rect)
 	}
 #endif
 
-	/* Update changed rect of the video buffer texture. */
+	/* Update changed rects of the video buffer texture. */
 	if (!IsEmptyRect(update_rect)) {
+		int bpp = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
+
 		_glActiveTexture(GL_TEXTURE0);
 		_glBindTexture(GL_TEXTURE_2D, this->vid_texture);
 		_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
-		if (BlitterFactory::GetCurrentBlitter()->GetScreenDepth() == 8) {
-			_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_RED, GL_UNSIGNED_BYTE, (GLvoid*)(size_t)(update_rect.top * _screen.pitch + update_rect.left));
+		if (this->dirty_rect_overflow || this->dirty_rects.empty()) {
+			UpdateTextureRect(update_rect, bpp);
 		} else {
-			_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid*)(size_t)(update_rect.top * _screen.pitch * 4 + update_rect.left * 4));
+			for (const Rect &r : this->dirty_rects) {
+				UpdateTextureRect(r, bpp);
+			}
 		}
 
 #ifndef NO_GL_BUFFER_SYNC
 		if (this->persistent_mapping_supported) this->sync_vid_mapping = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 #endif
 	}
+
+	this->dirty_rects.clear();
+	this->dirty_rect_overflow = false;
 }
 
 /**
  * Update animation buffer texture after the animation buffer was filled.
+ *
+ * Damage rectangles recorded with MakeDirty() are used like in
+ * ReleaseVideoBuffer(), but are not consumed by this call.
  * @param update_rect Rectangle encompassing the dirty region of the animation buffer.
  */
 void OpenGLBackend::ReleaseAnimBuffer(const Rect &update_rect)
@@ -1253,12 +1314,18 @@ void OpenGLBackend::ReleaseAnimBuffer(const Rect &update_rect)
 	}
 #endif
 
-	/* Update changed rect of the video buffer texture. */
+	/* Update changed rects of the animation buffer texture. */
 	if (update_rect.left != update_rect.right) {
 		_glActiveTexture(GL_TEXTURE0);
 		_glBindTexture(GL_TEXTURE_2D, this->anim_texture);
 		_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
-		_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_RED, GL_UNSIGNED_BYTE, (GLvoid *)(size_t)(update_rect.top * _screen.pitch + update_rect.left));
+		if (this->dirty_rect_overflow || this->dirty_rects.empty()) {
+			UpdateTextureRect(update_rect, 8);
+		} else {
+			for (const Rect &r : this->dirty_rects) {
+				UpdateTextureRect(r, 8);
+			}
+		}
 
 #ifndef NO_GL_BUFFER_SYNC
 		if (this->persistent_mapping_supported) this->sync_anim_mapping = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
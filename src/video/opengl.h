@@ -15,6 +15,7 @@
 #include "../gfx_type.h"
 #include "../spriteloader/spriteloader.hpp"
 #include "../misc/lrucache.hpp"
+#include <vector>
 
 typedef void (*OGLProc)();
 typedef OGLProc (*GetOGLProcAddressProc)(const char *proc);
@@ -33,6 +34,9 @@ private:
 	GLsync sync_vid_mapping;           ///< Sync object for the persistently mapped video buffer.
 	GLsync sync_anim_mapping;          ///< Sync object for the persistently mapped animation buffer.
 
+	std::vector<Rect> dirty_rects; ///< Damage rectangles recorded since the last video buffer upload.
+	bool dirty_rect_overflow;      ///< Too many damage rectangles were recorded; upload the bounding rectangle instead.
+
 	void *vid_buffer;   ///< Pointer to the mapped video buffer.
 	GLuint vid_pbo;     ///< Pixel buffer object storing the memory used for the video driver to draw to.
 	GLuint vid_texture; ///< Texture handle for the video buffer texture.
@@ -100,6 +104,8 @@ public:
 	void PopulateCursorCache();
 	void ClearCursorCache();
 
+	void MakeDirty(int left, int top, int width, int height);
+
 	void *GetVideoBuffer();
 	uint8 *GetAnimBuffer();
 	void ReleaseVideoBuffer(const Rect &update_rect);
@@ -130,6 +130,13 @@ const char *VideoDriver_SDL_OpenGL::AllocateContext()
 	return OpenGLBackend::Create(&GetOGLProcAddressCallback, this->GetScreenSize());
 }
 
+void VideoDriver_SDL_OpenGL::MakeDirty(int left, int top, int width, int height)
+{
+	this->VideoDriver_SDL_Base::MakeDirty(left, top, width, height);
+	/* Also record the individual rect with the back-end for per-rect texture uploads. */
+	if (OpenGLBackend::Get() != nullptr) OpenGLBackend::Get()->MakeDirty(left, top, width, height);
+}
+
 void VideoDriver_SDL_OpenGL::PopulateSystemSprites()
 {
 	OpenGLBackend::Get()->PopulateCursorCache();
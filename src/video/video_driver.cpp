@@ -188,8 +188,29 @@ void VideoDriver::SleepTillNextTick()
 		next_tick = min(next_tick, this->next_game_tick);
 	}
 
-	if (next_tick > now) {
-		std::this_thread::sleep_for(next_tick - now);
+	if (next_tick <= now) return;
+
+	/* sleep_for reliably wakes up somewhat after the requested time, which
+	 * makes every tick start late and causes catch-up bursts under load.
+	 * Request a correspondingly shorter sleep, track the observed wake-up
+	 * overshoot as a clamped moving average, and wait out the small
+	 * remainder by yielding so ticks start on schedule. */
+	static const std::chrono::nanoseconds MAX_SLEEP_OVERSHOOT = std::chrono::milliseconds(2);
+
+	auto sleep_till = next_tick - this->sleep_overshoot;
+	if (sleep_till > now) {
+		std::this_thread::sleep_for(sleep_till - now);
+		now = std::chrono::steady_clock::now();
+
+		std::chrono::nanoseconds overshoot = std::chrono::duration_cast<std::chrono::nanoseconds>(now - sleep_till);
+		if (overshoot < std::chrono::nanoseconds::zero()) overshoot = std::chrono::nanoseconds::zero();
+		if (overshoot > MAX_SLEEP_OVERSHOOT) overshoot = MAX_SLEEP_OVERSHOOT;
+		this->sleep_overshoot = (this->sleep_overshoot * 7 + overshoot) / 8;
+	}
+
+	while (now < next_tick) {
+		std::this_thread::yield();
+		now = std::chrono::steady_clock::now();
 	}
 }
 
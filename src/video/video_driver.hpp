@@ -330,7 +330,13 @@ protected:
 	{
 		/* If vsync, draw interval is decided by the display driver */
 		if (_video_vsync && _video_hw_accel) return std::chrono::microseconds(0);
-		return std::chrono::microseconds(1000000 / _settings_client.gui.refresh_rate);
+
+		uint refresh_rate = _settings_client.gui.refresh_rate;
+		/* During fast-forward, decimate drawing so more of the frame budget goes to game loops. */
+		if (_game_speed != 100 && !_pause_mode && _settings_client.gui.fast_forward_refresh_rate != 0) {
+			refresh_rate = std::min<uint>(refresh_rate, _settings_client.gui.fast_forward_refresh_rate);
+		}
+		return std::chrono::microseconds(1000000 / refresh_rate);
 	}
 
 	/** Execute all queued commands. */
@@ -353,6 +359,7 @@ protected:
 
 	std::chrono::steady_clock::time_point next_game_tick;
 	std::chrono::steady_clock::time_point next_draw_tick;
+	std::chrono::nanoseconds sleep_overshoot = std::chrono::nanoseconds::zero(); ///< Moving average of how much later than requested sleep_for wakes up, see SleepTillNextTick().
 
 	bool fast_forward_key_pressed; ///< The fast-forward key is being pressed.
 	bool fast_forward_via_key; ///< The fast-forward was enabled by key press.
@@ -1451,6 +1451,13 @@ bool VideoDriver_Win32OpenGL::AfterBlitterChange()
 	return true;
 }
 
+void VideoDriver_Win32OpenGL::MakeDirty(int left, int top, int width, int height)
+{
+	this->VideoDriver_Win32Base::MakeDirty(left, top, width, height);
+	/* Also record the individual rect with the back-end for per-rect texture uploads. */
+	if (OpenGLBackend::Get() != nullptr) OpenGLBackend::Get()->MakeDirty(left, top, width, height);
+}
+
 void VideoDriver_Win32OpenGL::PopulateSystemSprites()
 {
 	OpenGLBackend::Get()->PopulateCursorCache();
@@ -142,6 +142,8 @@ public:
 	bool HasAnimBuffer() override { return true; }
 	uint8 *GetAnimBuffer() override { return this->anim_buffer; }
 
+	void MakeDirty(int left, int top, int width, int height) override;
+
 	void ToggleVsync(bool vsync) override;
 
 	const char *GetName() const override { return "win32-opengl"; }
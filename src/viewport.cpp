@@ -287,10 +287,18 @@ struct ViewportDrawerDynamic {
 	btree::btree_map<TileIndex, TileIndex, BridgeSetXComparator> bridge_to_map_x;
 	btree::btree_map<TileIndex, TileIndex, BridgeSetYComparator> bridge_to_map_y;
 
+	/* Scratch lists for ViewportAddKdtreeSigns, members to re-use their allocations. */
+	std::vector<const BaseStation *> station_signs_to_draw;
+	std::vector<const Town *> town_signs_to_draw;
+	std::vector<const Sign *> signs_to_draw;
+
 	uint8 display_flags;
 
 	std::atomic<uint> draw_jobs_active;
 
+	Viewport *return_vp;                ///< Viewport this job was drawn for, set when the completed job is handed back.
+	ViewportDrawerDynamic *return_next; ///< Next item in the lock-free completed job list.
+
 	TransparencyOptionBits transparency_opt;
 	TransparencyOptionBits invisibility_opt;
 
@@ -327,12 +335,14 @@ static void HideMeasurementTooltips();
 static std::unique_ptr<ViewportDrawerDynamic> _vdd;
 std::vector<std::unique_ptr<ViewportDrawerDynamic>> _spare_viewport_drawers;
 
-struct ViewportDrawerReturn {
-	Viewport *vp;
-	std::unique_ptr<ViewportDrawerDynamic> vdd;
-};
+/* Completed render jobs are handed back to the main thread via a lock-free
+ * intrusive list (linked through ViewportDrawerDynamic::return_next), so
+ * worker threads never block on the main thread for queue access. The
+ * mutex/condition variable pair below only lets the main thread sleep while
+ * no completed job is available; workers touch it solely to deliver the
+ * wakeup on the empty -> non-empty transition. */
+static std::atomic<ViewportDrawerDynamic *> _viewport_drawer_returns{nullptr};
 static std::mutex _viewport_drawer_return_lock;
-static std::vector<ViewportDrawerReturn> _viewport_drawer_returns;
 static std::condition_variable _viewport_drawer_empty_cv;
 static uint _viewport_drawer_jobs = 0;
 
@@ -463,11 +473,72 @@ static void FillViewportCoverageRect()
 	}
 }
 
+/**
+ * Invalidate the whole land pixel cache of a viewport, so that all landscape
+ * pixels are recomputed from map state on the next map mode draw.
+ * Prefer MarkViewportDirty where the affected area is known.
+ * @param vp the viewport to invalidate the cache of
+ */
 void ClearViewportLandPixelCache(Viewport *vp)
 {
 	vp->land_pixel_cache.assign(vp->land_pixel_cache.size(), 0xD7);
 }
 
+/**
+ * Scroll the land pixel cache of a viewport, so that its contents stay aligned
+ * with the world as the viewport moves. Only pixels which have become exposed
+ * are marked invalid, instead of discarding the whole cache.
+ * @param vp the viewport to scroll the cache of
+ * @param xo the number of (unscaled) pixels the content moves right
+ * @param yo the number of (unscaled) pixels the content moves down
+ */
+static void ScrollViewportLandPixelCache(Viewport *vp, int xo, int yo)
+{
+	if (vp->land_pixel_cache.empty()) return;
+
+	if (abs(xo) >= vp->width || abs(yo) >= vp->height) {
+		/* Nothing cached remains visible, invalidate everything. */
+		ClearViewportLandPixelCache(vp);
+		return;
+	}
+
+	const uint bitdepth = BlitterFactory::GetCurrentBlitter()->GetScreenDepth() / 8;
+	const uint row_size = vp->width * bitdepth;
+	byte *cache = vp->land_pixel_cache.data();
+
+	const uint move_size = (vp->width - abs(xo)) * bitdepth;
+	const int height = vp->height - abs(yo);
+	const uint src_x = (xo < 0 ? -xo : 0) * bitdepth;
+	const uint dst_x = (xo > 0 ? xo : 0) * bitdepth;
+	const int src_y = yo < 0 ? -yo : 0;
+	const int dst_y = yo > 0 ? yo : 0;
+
+	if (yo > 0) {
+		/* Content moves down: copy bottom-up so the source is not overwritten. */
+		for (int y = height - 1; y >= 0; y--) {
+			memmove(cache + (dst_y + y) * row_size + dst_x, cache + (src_y + y) * row_size + src_x, move_size);
+		}
+	} else {
+		for (int y = 0; y < height; y++) {
+			memmove(cache + (dst_y + y) * row_size + dst_x, cache + (src_y + y) * row_size + src_x, move_size);
+		}
+	}
+
+	/* Mark the newly exposed edges invalid. */
+	if (yo > 0) {
+		memset(cache, 0xD7, yo * row_size);
+	} else if (yo < 0) {
+		memset(cache + (vp->height + yo) * row_size, 0xD7, -yo * row_size);
+	}
+	if (xo != 0) {
+		byte *row = cache + dst_y * row_size + (xo > 0 ? 0 : (vp->width + xo) * bitdepth);
+		for (int y = 0; y < height; y++) {
+			memset(row, 0xD7, abs(xo) * bitdepth);
+			row += row_size;
+		}
+	}
+}
+
 void ClearViewportCache(Viewport *vp)
 {
 	if (vp->zoom >= ZOOM_LVL_DRAW_MAP) {
@@ -816,7 +887,7 @@ static void SetViewportPosition(Window *w, int x, int y, bool force_update_overl
 		if (i >= 0) height -= i;
 
 		if (height > 0 && (_vp_move_offs.x != 0 || _vp_move_offs.y != 0)) {
-			ClearViewportLandPixelCache(vp);
+			ScrollViewportLandPixelCache(vp, _vp_move_offs.x, _vp_move_offs.y);
 			SCOPE_INFO_FMT([&], "DoSetViewportPosition: %d, %d, %d, %d, %d, %d, %s", left, top, width, height, _vp_move_offs.x, _vp_move_offs.y, scope_dumper().WindowInfo(w));
 			w->viewport->update_vehicles = true;
 			DoSetViewportPosition((Window *) w->z_front, left, top, width, height);
@@ -1694,8 +1765,30 @@ static void ViewportAddLandscape()
 	 */
 	int row = DivTowardsNegativeInf(upper_left.y + upper_left.x, (int)TILE_SIZE) - 1;
 	bool last_row = false;
+
+	/* Per-row batch of tile slopes/heights, filled by GetTilePixelSlopeRow(). */
+	std::vector<Slope> row_slopes;
+	std::vector<int> row_heights;
+
 	for (; !last_row; row++) {
 		last_row = true;
+
+		/* Determine the columns of this row whose tiles are inside the map,
+		 * and batch-compute their slopes and heights up front. The in-map
+		 * tiles of one viewport row form a single contiguous diagonal run. */
+		int first_valid_column = std::max(left_column, std::max(row - 2 * (int)MapMaxX(), -row));
+		int last_valid_column = std::min(right_column, std::min(row, 2 * (int)MapMaxY() - row));
+		if ((first_valid_column + row) % 2 != 0) first_valid_column++;
+		if ((last_valid_column + row) % 2 != 0) last_valid_column--;
+		uint valid_count = (last_valid_column >= first_valid_column) ? (uint)(last_valid_column - first_valid_column) / 2 + 1 : 0;
+		if (valid_count > 0) {
+			if (valid_count > row_slopes.size()) {
+				row_slopes.resize(valid_count);
+				row_heights.resize(valid_count);
+			}
+			GetTilePixelSlopeRow((row - first_valid_column) / 2, (row + first_valid_column) / 2, valid_count, row_slopes.data(), row_heights.data());
+		}
+
 		for (int column = left_column; column <= right_column; column++) {
 			/* Valid row/column? */
 			if ((row + column) % 2 != 0) continue;
@@ -1720,8 +1813,11 @@ static void ViewportAddLandscape()
 			}
 
 			if (tile_type != MP_VOID) {
-				/* We are inside the map => paint landscape. */
-				_cur_ti.tileh = GetTilePixelSlope(_cur_ti.tile, &_cur_ti.z);
+				/* We are inside the map => landscape slope/height comes from this row's batch. */
+				dbg_assert(column >= first_valid_column && column <= last_valid_column);
+				uint idx = (uint)(column - first_valid_column) / 2;
+				_cur_ti.tileh = row_slopes[idx];
+				_cur_ti.z = row_heights[idx];
 			} else {
 				/* We are outside the map => paint black. */
 				_cur_ti.tileh = GetTilePixelSlopeOutsideMap(tilecoord.x, tilecoord.y, &_cur_ti.z);
@@ -1839,9 +1935,6 @@ static Rect ExpandRectWithViewportSignMargins(Rect r, ZoomLevel zoom)
 
 static void ViewportAddKdtreeSigns(ViewportDrawerDynamic *vdd, DrawPixelInfo *dpi, bool towns_only)
 {
-	Rect search_rect{ dpi->left, dpi->top, dpi->left + dpi->width, dpi->top + dpi->height };
-	search_rect = ExpandRectWithViewportSignMargins(search_rect, dpi->zoom);
-
 	bool show_stations = HasBit(_display_opt, DO_SHOW_STATION_NAMES) && _game_mode != GM_MENU && !towns_only;
 	bool show_waypoints = HasBit(_display_opt, DO_SHOW_WAYPOINT_NAMES) && _game_mode != GM_MENU && !towns_only;
 	bool show_towns = HasBit(_display_opt, DO_SHOW_TOWN_NAMES) && _game_mode != GM_MENU;
@@ -1849,10 +1942,19 @@ static void ViewportAddKdtreeSigns(ViewportDrawerDynamic *vdd, DrawPixelInfo *dp
 	bool show_competitors = HasBit(_display_opt, DO_SHOW_COMPETITOR_SIGNS) && !towns_only;
 	bool hide_hidden_waypoints = _settings_client.gui.allow_hiding_waypoint_labels && !HasBit(_extra_display_opt, XDO_SHOW_HIDDEN_SIGNS);
 
+	/* Don't query the kdtree when no category of sign is drawn at all. */
+	if (!show_stations && !show_waypoints && !show_towns && !show_signs) return;
+
+	Rect search_rect{ dpi->left, dpi->top, dpi->left + dpi->width, dpi->top + dpi->height };
+	search_rect = ExpandRectWithViewportSignMargins(search_rect, dpi->zoom);
+
 	/* Collect all the items first and draw afterwards, to ensure layering */
-	std::vector<const BaseStation *> stations;
-	std::vector<const Town *> towns;
-	std::vector<const Sign *> signs;
+	std::vector<const BaseStation *> &stations = vdd->station_signs_to_draw;
+	std::vector<const Town *> &towns = vdd->town_signs_to_draw;
+	std::vector<const Sign *> &signs = vdd->signs_to_draw;
+	stations.clear();
+	towns.clear();
+	signs.clear();
 
 	_viewport_sign_kdtree.FindContained(search_rect.left, search_rect.top, search_rect.right, search_rect.bottom, [&](const ViewportSignKdtreeItem & item) {
 		switch (item.type) {
@@ -1933,6 +2035,19 @@ static void ViewportAddKdtreeSigns(ViewportDrawerDynamic *vdd, DrawPixelInfo *dp
 }
 
 
+/**
+ * Cache of formatted viewport sign strings, keyed on the string ID and parameters.
+ *
+ * Object name lookups are already cached (see e.g. Town::GetCachedName), this additionally
+ * avoids re-running FormatString for every visible sign on every viewport redraw.
+ * Every change that can alter a sign's text also changes its width and therefore passes
+ * through ViewportSign::UpdatePosition, which bumps the generation; the cache is emptied
+ * lazily when the generation changes. Only used from the main thread (see ViewportDrawStrings).
+ */
+static std::map<std::tuple<StringID, uint64, uint64>, std::string> _viewport_sign_string_cache;
+static uint32 _viewport_sign_string_cache_generation = 0;        ///< Bumped whenever any sign text may have changed.
+static uint32 _viewport_sign_string_cache_filled_generation = 0; ///< Generation the cache contents were formatted at.
+
 /**
  * Update the position of the viewport sign.
  * @param center the (preferred) center of the viewport sign
@@ -1942,6 +2057,16 @@ static void ViewportAddKdtreeSigns(ViewportDrawerDynamic *vdd, DrawPixelInfo *dp
  */
 void ViewportSign::UpdatePosition(ZoomLevel maxzoom, int center, int top, StringID str, StringID str_small)
 {
+	if (_network_dedicated) {
+		/* Dedicated servers draw no viewports, so skip the string layout
+		 * work; the sign kdtree is not built either, see RebuildViewportKdtree(). */
+		this->center = center;
+		this->top = top;
+		return;
+	}
+
+	_viewport_sign_string_cache_generation++;
+
 	if (this->width_normal != 0) this->MarkDirty(maxzoom);
 
 	this->top = top;
@@ -2262,6 +2387,11 @@ void ViewportDrawDirtyBlocks(const DrawPixelInfo *dpi, bool increment_colour)
 
 static void ViewportDrawStrings(ViewportDrawerDynamic *vdd, ZoomLevel zoom, const StringSpriteToDrawVector *sstdv)
 {
+	if (_viewport_sign_string_cache_filled_generation != _viewport_sign_string_cache_generation) {
+		_viewport_sign_string_cache.clear();
+		_viewport_sign_string_cache_filled_generation = _viewport_sign_string_cache_generation;
+	}
+
 	for (const StringSpriteToDraw &ss : *sstdv) {
 		TextColour colour = TC_BLACK;
 		bool small = HasBit(ss.width, 15);
@@ -2270,8 +2400,14 @@ static void ViewportDrawStrings(ViewportDrawerDynamic *vdd, ZoomLevel zoom, cons
 		int y = UnScaleByZoom(ss.y, zoom);
 		int h = WidgetDimensions::scaled.fullbevel.Vertical() + (small ? FONT_HEIGHT_SMALL : FONT_HEIGHT_NORMAL);
 
-		SetDParam(0, ss.params[0]);
-		SetDParam(1, ss.params[1]);
+		std::string &text = _viewport_sign_string_cache[std::make_tuple(ss.string, ss.params[0], ss.params[1])];
+		if (text.empty()) {
+			SetDParam(0, ss.params[0]);
+			SetDParam(1, ss.params[1]);
+			char buffer[DRAW_STRING_BUFFER];
+			GetString(buffer, ss.string, lastof(buffer));
+			text.assign(buffer);
+		}
 
 		if (ss.colour != INVALID_COLOUR) {
 			/* Do not draw signs nor station names if they are set invisible */
@@ -2292,7 +2428,7 @@ static void ViewportDrawStrings(ViewportDrawerDynamic *vdd, ZoomLevel zoom, cons
 			}
 		}
 
-		DrawString(x + WidgetDimensions::scaled.fullbevel.left, x + w - 1 - WidgetDimensions::scaled.fullbevel.right, y + WidgetDimensions::scaled.fullbevel.top, ss.string, colour, SA_HOR_CENTER, false, small ? FS_SMALL : FS_NORMAL);
+		DrawString(x + WidgetDimensions::scaled.fullbevel.left, x + w - 1 - WidgetDimensions::scaled.fullbevel.right, y + WidgetDimensions::scaled.fullbevel.top, text, colour, SA_HOR_CENTER, false, small ? FS_SMALL : FS_NORMAL);
 	}
 }
 
@@ -2661,8 +2797,19 @@ void ViewportDrawPlans(const Viewport *vp)
 	const int min_coord_delta = bounds.left / (int)(2 * ZOOM_LVL_BASE * TILE_SIZE);
 	const int max_coord_delta = (bounds.right / (int)(2 * ZOOM_LVL_BASE * TILE_SIZE)) + 1;
 
+	/* At these zoom levels the detail dropped from the LOD polylines is at most a pixel or two. */
+	const bool use_lod = vp->zoom >= ZOOM_LVL_OUT_16X;
+
 	for (Plan *p : Plan::Iterate()) {
 		if (!p->IsVisible()) continue;
+		if (
+			bounds.left   > p->viewport_extents.right ||
+			bounds.right  < p->viewport_extents.left ||
+			bounds.top    > p->viewport_extents.bottom ||
+			bounds.bottom < p->viewport_extents.top
+		) {
+			continue;
+		}
 		for (PlanLineVector::iterator it = p->lines.begin(); it != p->lines.end(); it++) {
 			PlanLine *pl = *it;
 			if (!pl->visible) continue;
@@ -2676,12 +2823,13 @@ void ViewportDrawPlans(const Viewport *vp)
 				continue;
 			}
 
-			TileIndex to_tile = pl->tiles[0];
+			const TileVector &tiles = (use_lod && pl->lod_tiles.size() > 1) ? pl->lod_tiles : pl->tiles;
+			TileIndex to_tile = tiles[0];
 			int to_coord_delta = (int)TileY(to_tile) - (int)TileX(to_tile);
-			for (uint i = 1; i < pl->tiles.size(); i++) {
+			for (uint i = 1; i < tiles.size(); i++) {
 				const TileIndex from_tile = to_tile;
 				const int from_coord_delta = to_coord_delta;
-				to_tile = pl->tiles[i];
+				to_tile = tiles[i];
 				to_coord_delta = (int)TileY(to_tile) - (int)TileX(to_tile);
 
 				if (to_coord_delta < min_coord_delta && from_coord_delta < min_coord_delta) continue;
@@ -3588,6 +3736,83 @@ void ViewportMapDraw(Viewport * const vp)
 	}
 }
 
+/** Trampoline for running the sprite sorter on the worker pool. */
+static void ViewportSortParentSpritesJob(void *data1, void *data2, void *data3)
+{
+	_vp_sprite_sorter(static_cast<ParentSpriteToSortVector *>(data1));
+}
+
+/**
+ * Sort the parent sprites of a draw region, using the worker pool when the list
+ * can be partitioned into spans of sprites whose screen footprints do not overlap
+ * horizontally.
+ *
+ * Sprites in different spans cannot overlap on screen, so their relative drawing
+ * order is irrelevant and each span can be sorted independently. Footprints are
+ * expanded by the same half tile margin the region split logic uses, to cover
+ * child sprites extending slightly beyond their parent.
+ */
+static void ViewportSortParentSpriteSet(ViewportProcessParentSpritesData *data)
+{
+	ParentSpriteToSortVector &psts = data->psts;
+
+	/* Minimum number of sprites in a span for a separate sort job to be worthwhile. */
+	static const uint MIN_SPAN_SPRITES = 20;
+
+	if (psts.size() < MIN_SPAN_SPRITES * 2 || !_general_worker_pool.HasWorkers() || unlikely(HasBit(_viewport_debug_flags, VDF_DISABLE_THREAD))) {
+		_vp_sprite_sorter(&psts);
+		return;
+	}
+
+	/* Order sprite indices by left edge, so that overlapping runs are contiguous. */
+	std::vector<std::pair<int32, uint32>> order;
+	order.reserve(psts.size());
+	for (uint32 i = 0; i < (uint32)psts.size(); i++) {
+		order.push_back({ psts[i]->left, i });
+	}
+	std::sort(order.begin(), order.end());
+
+	const int margin = UnScaleByZoom(128, data->dpi.zoom); // Half tile (1 column) margin either side of each footprint
+
+	std::vector<ParentSpriteToSortVector> spans;
+	std::vector<uint32> span_members;
+	int span_right = INT32_MIN;
+
+	auto flush_span = [&]() {
+		if (span_members.empty()) return;
+		/* Each span is sorted in the original list order, as the unsplit sort would be. */
+		std::sort(span_members.begin(), span_members.end());
+		ParentSpriteToSortVector &span = spans.emplace_back();
+		span.reserve(span_members.size());
+		for (uint32 i : span_members) span.push_back(psts[i]);
+		span_members.clear();
+	};
+	for (const auto &it : order) {
+		if (it.first - margin > span_right && span_members.size() >= MIN_SPAN_SPRITES) flush_span();
+		span_members.push_back(it.second);
+		span_right = std::max(span_right, psts[it.second]->left + psts[it.second]->width + margin);
+	}
+	flush_span();
+
+	if (spans.size() == 1) {
+		_vp_sprite_sorter(&psts);
+		return;
+	}
+
+	WorkerJobGroup group;
+	for (uint i = 1; i < (uint)spans.size(); i++) {
+		_general_worker_pool.EnqueueJob(ViewportSortParentSpritesJob, &spans[i], nullptr, nullptr, &group);
+	}
+	ViewportSortParentSpritesJob(&spans[0], nullptr, nullptr);
+	_general_worker_pool.WaitForGroupCompletion(&group);
+
+	/* Spans do not overlap on screen, so any relative order will do: use left to right. */
+	psts.clear();
+	for (ParentSpriteToSortVector &span : spans) {
+		psts.insert(psts.end(), span.begin(), span.end());
+	}
+}
+
 static void ViewportProcessParentSprites(ViewportDrawerDynamic *vdd, uint data_index)
 {
 	ViewportProcessParentSpritesData *data = &vdd->parent_sprite_sets[data_index];
@@ -3657,7 +3882,7 @@ static void ViewportProcessParentSprites(ViewportDrawerDynamic *vdd, uint data_i
 			ViewportProcessParentSprites(vdd, data_index);
 		}
 	} else {
-		_vp_sprite_sorter(&data->psts);
+		ViewportSortParentSpriteSet(data);
 	}
 }
 
@@ -3668,6 +3893,10 @@ static void ViewportDoDrawRenderJob(Viewport *vp, ViewportDrawerDynamic *vdd);
 /* This is run in the main thread */
 void ViewportDoDraw(Viewport *vp, int left, int top, int right, int bottom, uint8 display_flags)
 {
+#ifdef POOL_ALLOC_STATS
+	PoolAllocTag pool_alloc_tag("viewport");
+#endif
+
 	if (_spare_viewport_drawers.empty()) {
 		_vdd.reset(new ViewportDrawerDynamic());
 	} else {
@@ -3701,7 +3930,9 @@ void ViewportDoDraw(Viewport *vp, int left, int top, int right, int bottom, uint
 	AutoRestoreBackup dpi_backup(_cur_dpi, &_vdd->dpi);
 
 	if (vp->overlay != nullptr && vp->overlay->GetCargoMask() != 0 && vp->overlay->GetCompanyMask() != 0) {
-		vp->overlay->PrepareDraw();
+		/* Run a pending cache rebuild on the worker pool while the rest of the
+		 * viewport is drawn; it is joined before the overlay itself is drawn. */
+		vp->overlay->QueueRebuildCacheJob();
 	}
 
 	if (vp->zoom >= ZOOM_LVL_DRAW_MAP) {
@@ -3761,13 +3992,19 @@ static void ViewportDoDrawRenderSubJob(Viewport *vp, ViewportDrawerDynamic *vdd,
 
 	ViewportDoDrawPhase2(vp, vdd);
 
-	std::unique_lock<std::mutex> lk(_viewport_drawer_return_lock);
-	bool notify = _viewport_drawer_returns.empty();
-	ViewportDrawerReturn &ret = _viewport_drawer_returns.emplace_back();
-	ret.vp = vp;
-	ret.vdd.reset(vdd);
-	lk.unlock();
-	if (notify) _viewport_drawer_empty_cv.notify_one();
+	/* Push the completed job onto the lock-free return list. */
+	vdd->return_vp = vp;
+	ViewportDrawerDynamic *head = _viewport_drawer_returns.load(std::memory_order_relaxed);
+	do {
+		vdd->return_next = head;
+	} while (!_viewport_drawer_returns.compare_exchange_weak(head, vdd, std::memory_order_release, std::memory_order_relaxed));
+	if (head == nullptr) {
+		/* The list was empty, so the main thread may be about to sleep: deliver
+		 * the wakeup. The main thread only holds this lock around the empty
+		 * check of its condition variable wait, so this cannot block for long. */
+		std::lock_guard<std::mutex> lk(_viewport_drawer_return_lock);
+		_viewport_drawer_empty_cv.notify_one();
+	}
 }
 
 /* This is run in a worker thread */
@@ -3811,25 +4048,30 @@ void ViewportDoDrawProcessAllPending()
 
 	PerformanceAccumulator framerate(PFE_DRAWWORLD);
 
-	std::unique_lock<std::mutex> lk(_viewport_drawer_return_lock);
+	ViewportDrawerDynamic *pending = nullptr;
 	while (true) {
-		if (_viewport_drawer_returns.empty()) {
-			_viewport_drawer_empty_cv.wait(lk);
-		} else {
-			Viewport *vp = _viewport_drawer_returns.back().vp;
-			_vdd = std::move(_viewport_drawer_returns.back().vdd);
-			_viewport_drawer_returns.pop_back();
-			lk.unlock();
-
-			{
-				AutoRestoreBackup dpi_backup(_cur_dpi, AutoRestoreBackupNoNewValueTag{});
-				ViewportDoDrawPhase3(vp);
+		if (pending == nullptr) {
+			pending = _viewport_drawer_returns.exchange(nullptr, std::memory_order_acquire);
+			if (pending == nullptr) {
+				/* No completed job ready yet: sleep until a worker delivers one. */
+				std::unique_lock<std::mutex> lk(_viewport_drawer_return_lock);
+				_viewport_drawer_empty_cv.wait(lk, []() { return _viewport_drawer_returns.load(std::memory_order_acquire) != nullptr; });
+				continue;
 			}
+		}
+
+		Viewport *vp = pending->return_vp;
+		ViewportDrawerDynamic *next = pending->return_next;
+		_vdd.reset(pending);
+		pending = next;
 
-			_viewport_drawer_jobs--;
-			if (_viewport_drawer_jobs == 0) return;
-			lk.lock();
+		{
+			AutoRestoreBackup dpi_backup(_cur_dpi, AutoRestoreBackupNoNewValueTag{});
+			ViewportDoDrawPhase3(vp);
 		}
+
+		_viewport_drawer_jobs--;
+		if (_viewport_drawer_jobs == 0) return;
 	}
 }
 
@@ -3841,6 +4083,8 @@ static void ViewportDoDrawPhase2(Viewport *vp, ViewportDrawerDynamic *vdd)
 	}
 
 	if (vp->overlay != nullptr && vp->overlay->GetCargoMask() != 0 && vp->overlay->GetCompanyMask() != 0) {
+		vp->overlay->PrepareDraw();
+
 		/* translate to window coordinates */
 		DrawPixelInfo dp = vdd->dpi;
 		ZoomLevel zoom = vdd->dpi.zoom;
@@ -4298,6 +4542,7 @@ void ConstrainAllViewportsZoom()
  */
 void MarkTileDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags, int bridge_level_offset, int tile_height_override)
 {
+	SmallMapNotifyTileChange(tile);
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, tile_height_override * TILE_HEIGHT);
 	MarkAllViewportsDirty(
 			pt.x - 31  * ZOOM_LVL_BASE,
@@ -4310,6 +4555,7 @@ void MarkTileDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags, int bridg
 
 void MarkTileGroundDirtyByTile(TileIndex tile, ViewportMarkDirtyFlags flags)
 {
+	SmallMapNotifyTileChange(tile);
 	int x = TileX(tile) * TILE_SIZE;
 	int y = TileY(tile) * TILE_SIZE;
 	Point top = RemapCoords(x, y, GetTileMaxPixelZ(tile));
@@ -6352,7 +6598,7 @@ struct ViewportSSCSS {
 
 /** List of sorters ordered from best to worst. */
 static ViewportSSCSS _vp_sprite_sorters[] = {
-#ifdef WITH_SSE
+#if defined(WITH_SSE) && !defined(DEDICATED)
 	{ &ViewportSortParentSpritesSSE41Checker, &ViewportSortParentSpritesSSE41 },
 #endif
 	{ &ViewportSortParentSpritesChecker, &ViewportSortParentSprites }
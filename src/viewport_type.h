@@ -62,6 +62,13 @@ struct Viewport {
 	bool is_drawn = false;
 	bool update_vehicles = false;
 	ViewPortMapDrawVehiclesCache map_draw_vehicles_cache;
+
+	/**
+	 * Map mode only: cached landscape pixels at screen resolution and blitter depth.
+	 * Pixels whose bytes are all 0xD7 are invalid and are recomputed from map state
+	 * on the next draw; tile changes invalidate only the pixels they cover
+	 * (see MarkViewportDirty) and scrolling shifts the cache in place.
+	 */
 	std::vector<byte> land_pixel_cache;
 
 	uint GetDirtyBlockWidthShift() const { return this->GetDirtyBlockShift(); }
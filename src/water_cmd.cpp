@@ -41,6 +41,7 @@
 #include "object_base.h"
 #include "object_map.h"
 #include "newgrf_object.h"
+#include "pathfinder/water_regions.h"
 
 #include "table/strings.h"
 
@@ -91,6 +92,14 @@ static void MarkCanalsAndRiversAroundDirty(TileIndex tile)
 	}
 }
 
+/**
+ * Clear the non-flooding water tile flag of all eight neighbours of a tile.
+ *
+ * Must be called whenever \a tile is removed as a water tile or stops being
+ * plain floodable water, so that neighbouring tiles which skipped flood
+ * evaluation re-evaluate against the changed surroundings.
+ * @param tile The tile whose surroundings changed.
+ */
 void ClearNeighbourNonFloodingStates(TileIndex tile)
 {
 	for (Direction dir = DIR_BEGIN; dir < DIR_END; dir++) {
@@ -267,7 +276,11 @@ void MakeWaterKeepingClass(TileIndex tile, Owner o)
 		default: break;
 	}
 
-	if (wc != WATER_CLASS_INVALID) CheckForDockingTile(tile);
+	if (wc != WATER_CLASS_INVALID) {
+		CheckForDockingTile(tile);
+		/* Restoring water where a structure stood adds ship connectivity. */
+		NotifyWaterRegionLayoutChange();
+	}
 	MarkTileDirtyByTile(tile);
 }
 
@@ -374,6 +387,7 @@ static CommandCost DoBuildLock(TileIndex tile, DiagDirection dir, DoCommandFlag
 		MarkTileDirtyByTile(tile + delta);
 		MarkCanalsAndRiversAroundDirty(tile - delta);
 		MarkCanalsAndRiversAroundDirty(tile + delta);
+		NotifyWaterRegionLayoutChange();
 	}
 	cost.AddCost(_price[PR_BUILD_LOCK]);
 
@@ -420,6 +434,7 @@ static CommandCost RemoveLock(TileIndex tile, DoCommandFlag flags)
 		MarkCanalsAndRiversAroundDirty(tile);
 		MarkCanalsAndRiversAroundDirty(tile - delta);
 		MarkCanalsAndRiversAroundDirty(tile + delta);
+		NotifyWaterRegionLayoutChange();
 	}
 
 	return CommandCost(EXPENSES_CONSTRUCTION, _price[PR_CLEAR_LOCK]);
@@ -547,6 +562,7 @@ CommandCost CmdBuildCanal(TileIndex tile, DoCommandFlag flags, uint32 p1, uint32
 			MarkTileDirtyByTile(current_tile);
 			MarkCanalsAndRiversAroundDirty(current_tile);
 			CheckForDockingTile(current_tile);
+			NotifyWaterRegionLayoutChange();
 		}
 
 		cost.AddCost(_price[PR_BUILD_CANAL]);
@@ -1258,6 +1274,8 @@ void DoFloodTile(TileIndex target)
 		UpdateSignalsInBuffer();
 
 		if (IsPossibleDockingTile(target)) CheckForDockingTile(target);
+
+		NotifyWaterRegionLayoutChange();
 	}
 
 	cur_company.Restore();
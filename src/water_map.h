@@ -507,6 +507,14 @@ static inline void MakeLock(TileIndex t, Owner o, DiagDirection d, WaterClass wc
 
 /**
  * Set the non-flooding water tile state of a tile.
+ *
+ * This flag caches that a water tile has no non-water neighbours and so its
+ * flood evaluation can be skipped entirely by the (auxiliary) tile loop. On
+ * mostly-water maps this reduces flood processing to the shore tiles only.
+ * It is set lazily when a tile loop visit finds no non-water neighbour, and
+ * MUST be cleared on all eight neighbours whenever a water tile is removed or
+ * stops being plain water (trees on shore, buoys, objects, ...); use
+ * ClearNeighbourNonFloodingStates() for that.
  * @param t the tile
  * @param b the non-flooding water tile state
  */
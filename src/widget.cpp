@@ -2608,6 +2608,8 @@ Dimension NWidgetScrollbar::horizontal_dimension = {0, 0};
 	resizebox_dimension.width  = resizebox_dimension.height  = 0;
 	closebox_dimension.width   = closebox_dimension.height   = 0;
 	dropdown_dimension.width   = dropdown_dimension.height   = 0;
+	arrowbtn_dimension.width   = arrowbtn_dimension.height   = 0;
+	editbox_dimension.width    = editbox_dimension.height    = 0;
 }
 
 Dimension NWidgetLeaf::shadebox_dimension   = {0, 0};
@@ -2617,6 +2619,8 @@ Dimension NWidgetLeaf::stickybox_dimension  = {0, 0};
 Dimension NWidgetLeaf::resizebox_dimension  = {0, 0};
 Dimension NWidgetLeaf::closebox_dimension   = {0, 0};
 Dimension NWidgetLeaf::dropdown_dimension   = {0, 0};
+Dimension NWidgetLeaf::arrowbtn_dimension   = {0, 0};
+Dimension NWidgetLeaf::editbox_dimension    = {0, 0};
 
 /**
  * Nested leaf widget.
@@ -2797,9 +2801,13 @@ void NWidgetLeaf::SetupSmallestSize(Window *w, bool init_array)
 			break;
 		}
 		case WWT_EDITBOX: {
-			Dimension sprite_size = GetScaledSpriteSize(_current_text_dir == TD_RTL ? SPR_IMG_DELETE_RIGHT : SPR_IMG_DELETE_LEFT);
-			size.width = std::max(size.width, ScaleGUITrad(30) + sprite_size.width);
-			size.height = std::max(sprite_size.height, GetStringBoundingBox("_").height + WidgetDimensions::scaled.framerect.Vertical());
+			if (NWidgetLeaf::editbox_dimension.width == 0) {
+				Dimension sprite_size = GetScaledSpriteSize(_current_text_dir == TD_RTL ? SPR_IMG_DELETE_RIGHT : SPR_IMG_DELETE_LEFT);
+				NWidgetLeaf::editbox_dimension.width = ScaleGUITrad(30) + sprite_size.width;
+				NWidgetLeaf::editbox_dimension.height = std::max(sprite_size.height, GetStringBoundingBox("_").height + WidgetDimensions::scaled.framerect.Vertical());
+			}
+			size.width = std::max(size.width, NWidgetLeaf::editbox_dimension.width);
+			size.height = std::max(size.height, NWidgetLeaf::editbox_dimension.height);
 		}
 		FALLTHROUGH;
 		case WWT_PUSHBTN: {
@@ -2820,10 +2828,12 @@ void NWidgetLeaf::SetupSmallestSize(Window *w, bool init_array)
 		case WWT_ARROWBTN:
 		case WWT_PUSHARROWBTN: {
 			padding = {WidgetDimensions::scaled.imgbtn.Horizontal(), WidgetDimensions::scaled.imgbtn.Vertical()};
-			Dimension d2 = maxdim(GetScaledSpriteSize(SPR_ARROW_LEFT), GetScaledSpriteSize(SPR_ARROW_RIGHT));
-			d2.width += padding.width;
-			d2.height += padding.height;
-			size = maxdim(size, d2);
+			if (NWidgetLeaf::arrowbtn_dimension.width == 0) {
+				NWidgetLeaf::arrowbtn_dimension = maxdim(GetScaledSpriteSize(SPR_ARROW_LEFT), GetScaledSpriteSize(SPR_ARROW_RIGHT));
+				NWidgetLeaf::arrowbtn_dimension.width += padding.width;
+				NWidgetLeaf::arrowbtn_dimension.height += padding.height;
+			}
+			size = maxdim(size, NWidgetLeaf::arrowbtn_dimension);
 			break;
 		}
 
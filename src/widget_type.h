@@ -860,6 +860,8 @@ private:
 	static Dimension debugbox_dimension;  ///< Cached size of a debugbox widget.
 	static Dimension defsizebox_dimension; ///< Cached size of a defsizebox widget.
 	static Dimension stickybox_dimension; ///< Cached size of a stickybox widget.
+	static Dimension arrowbtn_dimension;  ///< Cached size of an arrow button widget.
+	static Dimension editbox_dimension;   ///< Cached base size of an edit box widget.
 };
 
 /**
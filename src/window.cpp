@@ -40,6 +40,8 @@
 #include "guitimer_func.h"
 #include "news_func.h"
 #include "core/backup_type.hpp"
+#include "core/container_func.hpp"
+#include "core/hashtable_map_type.hpp"
 
 #include "safeguards.h"
 
@@ -62,6 +64,57 @@ WindowBase *_z_back_window  = nullptr;
 /** List of windows in an arbitrary order, that is not instantaneously changed by bringing windows to the front. */
 WindowBase *_first_window  = nullptr;
 
+/**
+ * Index of all open windows by (class, number), so that by-id lookups need not
+ * walk the whole window list. Windows of class WC_INVALID are not indexed.
+ * Kept in sync by InitializeData(), ~Window() and ChangeWindowClass()/ChangeWindowNumber().
+ */
+static NodeHashMap<uint64, std::vector<Window *>> _windows_by_id;
+
+/** Key into #_windows_by_id for a window class and number. */
+static uint64 WindowIdKey(WindowClass cls, WindowNumber number)
+{
+	return (static_cast<uint64>(cls) << 32) | static_cast<uint32>(number);
+}
+
+/** Add a window to #_windows_by_id under its current class and number. */
+static void InsertWindowIntoIdIndex(Window *w)
+{
+	if (w->window_class == WC_INVALID) return;
+	_windows_by_id[WindowIdKey(w->window_class, w->window_number)].push_back(w);
+}
+
+/** Remove a window from #_windows_by_id, if it is indexed under its current class and number. */
+static void RemoveWindowFromIdIndex(Window *w)
+{
+	auto iter = _windows_by_id.find(WindowIdKey(w->window_class, w->window_number));
+	if (iter == _windows_by_id.end()) return;
+	container_unordered_remove(iter->second, w);
+	if (iter->second.empty()) _windows_by_id.erase(iter);
+}
+
+/**
+ * Change the class of this window, keeping the by-id window index in sync.
+ * @param cls The new window class.
+ */
+void Window::ChangeWindowClass(WindowClass cls)
+{
+	RemoveWindowFromIdIndex(this);
+	this->window_class = cls;
+	InsertWindowIntoIdIndex(this);
+}
+
+/**
+ * Change the number of this window, keeping the by-id window index in sync.
+ * @param number The new window number.
+ */
+void Window::ChangeWindowNumber(WindowNumber number)
+{
+	RemoveWindowFromIdIndex(this);
+	this->window_number = number;
+	InsertWindowIntoIdIndex(this);
+}
+
 /** If false, highlight is white, otherwise the by the widget defined colour. */
 bool _window_highlight_colour = false;
 
@@ -1149,6 +1202,8 @@ Window::~Window()
 	free(this->nested_array); // Contents is released through deletion of #nested_root.
 	delete this->nested_root;
 
+	RemoveWindowFromIdIndex(this);
+
 	/*
 	 * Make fairly sure that this is written, and not "optimized" away.
 	 * The delete operator is overwritten to not delete it; the deletion
@@ -1169,7 +1224,10 @@ Window::~Window()
  */
 Window *FindWindowById(WindowClass cls, WindowNumber number)
 {
-	for (Window *w : Window::IterateFromBack()) {
+	auto iter = _windows_by_id.find(WindowIdKey(cls, number));
+	if (iter == _windows_by_id.end()) return nullptr;
+
+	for (Window *w : iter->second) {
 		if (w->window_class == cls && w->window_number == number) return w;
 	}
 
@@ -1525,6 +1583,8 @@ void Window::InitializeData(WindowNumber window_number)
 	this->nested_focus = nullptr;
 	this->window_number = window_number;
 
+	InsertWindowIntoIdIndex(this);
+
 	this->OnInit();
 	/* Initialize nested widget tree. */
 	if (this->nested_array == nullptr) {
@@ -1952,6 +2012,7 @@ void InitWindowSystem()
 	_z_back_window = nullptr;
 	_z_front_window = nullptr;
 	_first_window = nullptr;
+	_windows_by_id.clear();
 	_focused_window = nullptr;
 	_mouseover_last_w = nullptr;
 	_last_scroll_window = nullptr;
@@ -3277,6 +3338,9 @@ void UpdateWindows()
 
 	_window_update_number++;
 
+	extern void FlushDirtyCompanyWindows();
+	FlushDirtyCompanyWindows();
+
 	/* Process invalidations before anything else. */
 	for (Window *w : Window::IterateFromFront()) {
 		w->ProcessScheduledInvalidations();
@@ -3340,8 +3404,11 @@ void UpdateWindows()
  */
 void SetWindowDirty(WindowClass cls, WindowNumber number)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) w->SetDirty();
+	auto iter = _windows_by_id.find(WindowIdKey(cls, number));
+	if (iter == _windows_by_id.end()) return;
+
+	for (Window *w : iter->second) {
+		w->SetDirty();
 	}
 }
 
@@ -3353,10 +3420,11 @@ void SetWindowDirty(WindowClass cls, WindowNumber number)
  */
 void SetWindowWidgetDirty(WindowClass cls, WindowNumber number, byte widget_index)
 {
-	for (Window *w : Window::IterateFromBack()) {
-		if (w->window_class == cls && w->window_number == number) {
-			w->SetWidgetDirty(widget_index);
-		}
+	auto iter = _windows_by_id.find(WindowIdKey(cls, number));
+	if (iter == _windows_by_id.end()) return;
+
+	for (Window *w : iter->second) {
+		w->SetWidgetDirty(widget_index);
 	}
 }
 
@@ -3379,8 +3447,14 @@ void SetWindowClassesDirty(WindowClass cls)
 void Window::InvalidateData(int data, bool gui_scope)
 {
 	if (!gui_scope) {
-		/* Schedule GUI-scope invalidation for next redraw. */
-		this->scheduled_invalidation_data.push_back(data);
+		/* Schedule GUI-scope invalidation for next redraw. Identical data values
+		 * are coalesced: handlers may not process differential changes in GUI
+		 * scope (see InvalidateWindowData()), so processing the same data twice
+		 * in one redraw is redundant. A busy tick can otherwise schedule the
+		 * same invalidation dozens of times. */
+		if (std::find(this->scheduled_invalidation_data.begin(), this->scheduled_invalidation_data.end(), data) == this->scheduled_invalidation_data.end()) {
+			this->scheduled_invalidation_data.push_back(data);
+		}
 	} else {
 		this->SetDirty();
 	}
@@ -3440,7 +3514,12 @@ void Window::ProcessHighlightedInvalidations()
  */
 void InvalidateWindowData(WindowClass cls, WindowNumber number, int data, bool gui_scope)
 {
-	for (Window *w : Window::IterateFromBack()) {
+	auto iter = _windows_by_id.find(WindowIdKey(cls, number));
+	if (iter == _windows_by_id.end()) return;
+
+	/* Iterate a copy, OnInvalidateData() handlers may delete or re-id windows. */
+	std::vector<Window *> windows = iter->second;
+	for (Window *w : windows) {
 		if (w->window_class == cls && w->window_number == number) {
 			w->InvalidateData(data, gui_scope);
 		}
@@ -3759,7 +3838,7 @@ void RelocateAllWindows(int neww, int newh)
  */
 PickerWindowBase::~PickerWindowBase()
 {
-	this->window_class = WC_INVALID; // stop the ancestor from freeing the already (to be) child
+	this->ChangeWindowClass(WC_INVALID); // stop the ancestor from freeing the already (to be) child
 	ResetObjectToPlace();
 }
 
@@ -531,6 +531,9 @@ public:
 
 	void SetShaded(bool make_shaded);
 
+	void ChangeWindowClass(WindowClass cls);
+	void ChangeWindowNumber(WindowNumber number);
+
 	void InvalidateData(int data = 0, bool gui_scope = true);
 	void ProcessScheduledInvalidations();
 	void ProcessHighlightedInvalidations();
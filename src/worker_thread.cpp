@@ -10,12 +10,59 @@
 #include "stdafx.h"
 #include "worker_thread.h"
 #include "thread.h"
+#include "core/bitmath_func.hpp"
 
 #include "safeguards.h"
 
 WorkerThreadPool _general_worker_pool;
 
-void WorkerThreadPool::Start(const char *thread_name, uint max_workers)
+uint8 _worker_thread_count = 8;         ///< Maximum number of threads in the general worker pool.
+std::string _worker_thread_affinity;    ///< CPU affinity mask specification for general worker pool threads.
+std::string _linkgraph_thread_affinity; ///< CPU affinity mask specification for link graph job threads.
+
+/**
+ * Parse a CPU affinity mask specification into a bit mask.
+ *
+ * Accepts either a hexadecimal mask ("0xF0"), or a comma-separated list of
+ * logical CPU indices and inclusive ranges ("0-3,8,10-11"). Logical CPUs
+ * above 63 cannot be expressed and are ignored.
+ * @param spec The specification text.
+ * @return The parsed mask, 0 (no pinning) if spec is empty or unparseable.
+ */
+uint64 ParseCpuAffinityMask(const std::string &spec)
+{
+	const char *p = spec.c_str();
+	if (*p == '\0') return 0;
+
+	if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+		return strtoull(p + 2, nullptr, 16);
+	}
+
+	uint64 mask = 0;
+	while (*p != '\0') {
+		char *end;
+		long first = strtol(p, &end, 10);
+		if (end == p || first < 0) return 0;
+		long last = first;
+		p = end;
+		if (*p == '-') {
+			last = strtol(p + 1, &end, 10);
+			if (end == p + 1 || last < first) return 0;
+			p = end;
+		}
+		for (long cpu = first; cpu <= last; cpu++) {
+			if (cpu < 64) SetBit(mask, (uint)cpu);
+		}
+		if (*p == ',') {
+			p++;
+		} else if (*p != '\0') {
+			return 0;
+		}
+	}
+	return mask;
+}
+
+void WorkerThreadPool::Start(const char *thread_name, uint max_workers, uint64 affinity_mask)
 {
 	uint cpus = std::thread::hardware_concurrency();
 	if (cpus <= 1) return;
@@ -23,6 +70,7 @@ void WorkerThreadPool::Start(const char *thread_name, uint max_workers)
 	std::lock_guard<std::mutex> lk(this->lock);
 
 	this->exit = false;
+	this->affinity = affinity_mask;
 
 	uint worker_target = std::min<uint>(max_workers, cpus);
 	if (this->workers >= worker_target) return;
@@ -46,23 +94,76 @@ void WorkerThreadPool::Stop()
 	this->done_cv.wait(lk, [this]() { return this->workers == 0; });
 }
 
-void WorkerThreadPool::EnqueueJob(WorkerJobFunc *func, void *data1, void *data2, void *data3)
+void WorkerThreadPool::EnqueueJob(WorkerJobFunc *func, void *data1, void *data2, void *data3, WorkerJobGroup *group)
 {
+	if (group != nullptr) {
+		std::lock_guard<std::mutex> lk(group->lock);
+		group->pending++;
+	}
 	std::unique_lock<std::mutex> lk(this->lock);
 	if (this->workers == 0) {
 		/* Just execute it here and now */
 		lk.unlock();
 		func(data1, data2, data3);
+		if (group != nullptr) group->NotifyJobDone();
 		return;
 	}
 	bool notify = this->jobs.size() < (size_t)this->workers_waiting;
-	this->jobs.push({ func, data1, data2, data3 });
+	this->jobs.push({ func, data1, data2, data3, group });
 	lk.unlock();
 	if (notify) this->worker_wait_cv.notify_one();
 }
 
+void WorkerJobGroup::NotifyJobDone()
+{
+	std::unique_lock<std::mutex> lk(this->lock);
+	if (--this->pending == 0) {
+		lk.unlock();
+		this->done_cv.notify_all();
+	}
+}
+
+/** Wait until all jobs enqueued with this group have finished executing. */
+void WorkerJobGroup::WaitForCompletion()
+{
+	std::unique_lock<std::mutex> lk(this->lock);
+	this->done_cv.wait(lk, [this]() { return this->pending == 0; });
+}
+
+/**
+ * Wait until all jobs enqueued with \a group have finished executing, running
+ * pending pool jobs on the calling thread in the meantime.
+ *
+ * Unlike WorkerJobGroup::WaitForCompletion() this is safe to call from within a
+ * worker job: the queue keeps being drained, so the pool cannot end up with all
+ * workers waiting on jobs which nobody is left to execute.
+ */
+void WorkerThreadPool::WaitForGroupCompletion(WorkerJobGroup *group)
+{
+	while (true) {
+		{
+			std::lock_guard<std::mutex> glk(group->lock);
+			if (group->pending == 0) return;
+		}
+		std::unique_lock<std::mutex> lk(this->lock);
+		if (this->jobs.empty()) {
+			/* The remaining jobs of the group are being executed by other workers. */
+			lk.unlock();
+			group->WaitForCompletion();
+			return;
+		}
+		WorkerJob job = this->jobs.front();
+		this->jobs.pop();
+		lk.unlock();
+		job.func(job.data1, job.data2, job.data3);
+		if (job.group != nullptr) job.group->NotifyJobDone();
+	}
+}
+
 void WorkerThreadPool::Run(WorkerThreadPool *pool)
 {
+	SetCurrentThreadAffinity(pool->affinity);
+
 	std::unique_lock<std::mutex> lk(pool->lock);
 	while (!pool->exit || !pool->jobs.empty()) {
 		if (pool->jobs.empty()) {
@@ -74,6 +175,7 @@ void WorkerThreadPool::Run(WorkerThreadPool *pool)
 			pool->jobs.pop();
 			lk.unlock();
 			job.func(job.data1, job.data2, job.data3);
+			if (job.group != nullptr) job.group->NotifyJobDone();
 			lk.lock();
 		}
 	}
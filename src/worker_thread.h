@@ -12,6 +12,7 @@
 
 #include <queue>
 #include <mutex>
+#include <string>
 #include <condition_variable>
 #if defined(__MINGW32__)
 #include "3rdparty/mingw-std-threads/mingw.mutex.h"
@@ -20,6 +21,30 @@
 
 typedef void WorkerJobFunc(void *, void *, void *);
 
+struct WorkerThreadPool;
+
+/**
+ * Tracks completion of a set of jobs enqueued on a WorkerThreadPool.
+ *
+ * Enqueue jobs with WorkerThreadPool::EnqueueJob() passing this group, then
+ * call WaitForCompletion() to join. This is the building block for running a
+ * batch of independent read-only computations (e.g. path queries) on the pool
+ * and joining before their results are consumed.
+ */
+struct WorkerJobGroup {
+private:
+	friend struct WorkerThreadPool;
+
+	std::mutex lock;
+	std::condition_variable done_cv;
+	uint pending = 0;
+
+	void NotifyJobDone();
+
+public:
+	void WaitForCompletion();
+};
+
 struct WorkerThreadPool {
 private:
 	struct WorkerJob {
@@ -27,10 +52,12 @@ private:
 		void *data1;
 		void *data2;
 		void *data3;
+		WorkerJobGroup *group;
 	};
 
 	uint workers = 0;
 	uint workers_waiting = 0;
+	uint64 affinity = 0;
 	bool exit = false;
 	std::mutex lock;
 	std::queue<WorkerJob> jobs;
@@ -41,9 +68,13 @@ private:
 
 public:
 
-	void Start(const char *thread_name, uint max_workers);
+	void Start(const char *thread_name, uint max_workers, uint64 affinity_mask = 0);
 	void Stop();
-	void EnqueueJob(WorkerJobFunc *func, void *data1 = nullptr, void *data2 = nullptr, void *data3 = nullptr);
+	void EnqueueJob(WorkerJobFunc *func, void *data1 = nullptr, void *data2 = nullptr, void *data3 = nullptr, WorkerJobGroup *group = nullptr);
+	void WaitForGroupCompletion(WorkerJobGroup *group);
+
+	/** Whether any worker threads are running; jobs run inline on the enqueuing thread otherwise. */
+	inline bool HasWorkers() const { return this->workers != 0; }
 
 	~WorkerThreadPool()
 	{
@@ -53,4 +84,10 @@ public:
 
 extern WorkerThreadPool _general_worker_pool;
 
+extern uint8 _worker_thread_count;
+extern std::string _worker_thread_affinity;
+extern std::string _linkgraph_thread_affinity;
+
+uint64 ParseCpuAffinityMask(const std::string &spec);
+
 #endif /* WORKER_THREAD_H */
@@ -375,7 +375,7 @@ inline SpriteID TileZoningSpriteEvaluationCached(TileIndex tile, Owner owner, Zo
 {
 	if (ev_mode == ZEM_BUL_UNSER && !IsTileType(tile, MP_HOUSE)) return ZONING_INVALID_SPRITE_ID;
 	if (ev_mode == ZEM_IND_UNSER && !IsTileType(tile, MP_INDUSTRY)) return ZONING_INVALID_SPRITE_ID;
-	if (ev_mode >= ZEM_STA_CATCH && ev_mode <= ZEM_IND_UNSER) {
+	if (ev_mode == ZEM_AUTHORITY || (ev_mode >= ZEM_STA_CATCH && ev_mode <= ZEM_IND_UNSER)) {
 		// cacheable
 		btree::btree_set<uint32> &cache = is_inner ? _zoning_cache_inner : _zoning_cache_outer;
 		auto iter = cache.lower_bound(tile << 3);
@@ -516,6 +516,8 @@ void ZoningTownAuthorityRatingChange()
 	if (_zoning.inner == ZEM_AUTHORITY) mask |= ZMM_INNER;
 	if (_zoning.outer == ZEM_AUTHORITY) mask |= ZMM_OUTER;
 	if (mask != ZMM_NOTHING) {
+		if (mask & ZMM_INNER) _zoning_cache_inner.clear();
+		if (mask & ZMM_OUTER) _zoning_cache_outer.clear();
 		MarkWholeNonMapViewportsDirty();
 	}
 }